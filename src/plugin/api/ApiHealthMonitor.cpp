@@ -0,0 +1,32 @@
+#include "ApiHealthMonitor.h"
+#include "ApiStatusMessage.h"
+#include "api/ApiHealthTracker.h"
+#include "message/UserMessager.h"
+
+namespace UKControllerPlugin::Api {
+
+    ApiHealthMonitor::ApiHealthMonitor(
+        const UKControllerPluginUtils::Api::ApiHealthTracker& health, Message::UserMessager& messager)
+        : health(health), messager(messager)
+    {
+    }
+
+    auto ApiHealthMonitor::Healthy() const -> bool
+    {
+        return healthy;
+    }
+
+    void ApiHealthMonitor::TimedEventTrigger()
+    {
+        const bool nowHealthy = health.Healthy();
+        if (nowHealthy == healthy) {
+            return;
+        }
+
+        healthy = nowHealthy;
+        const auto [slowestEndpoint, slowestLatency] = health.Slowest();
+        const ApiStatusMessage message(healthy, slowestEndpoint, slowestLatency);
+        LogInfo(message.MessageString());
+        messager.SendMessageToUser(message);
+    }
+} // namespace UKControllerPlugin::Api
@@ -0,0 +1,35 @@
+#pragma once
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPluginUtils::Api {
+    class ApiHealthTracker;
+} // namespace UKControllerPluginUtils::Api
+
+namespace UKControllerPlugin::Message {
+    class UserMessager;
+} // namespace UKControllerPlugin::Message
+
+namespace UKControllerPlugin::Api {
+
+    /*
+        Periodically checks the health of the API and lets the user know when it
+        stops responding and when it recovers, including which endpoint has been slowest.
+    */
+    class ApiHealthMonitor : public TimedEvent::AbstractTimedEvent
+    {
+        public:
+        ApiHealthMonitor(const UKControllerPluginUtils::Api::ApiHealthTracker& health, Message::UserMessager& messager);
+        [[nodiscard]] auto Healthy() const -> bool;
+        void TimedEventTrigger() override;
+
+        private:
+        // Tracks how the API is responding
+        const UKControllerPluginUtils::Api::ApiHealthTracker& health;
+
+        // For telling the user
+        Message::UserMessager& messager;
+
+        // Whether the API was healthy last time we checked
+        bool healthy = true;
+    };
+} // namespace UKControllerPlugin::Api
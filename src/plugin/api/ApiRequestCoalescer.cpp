@@ -0,0 +1,136 @@
+#include "ApiRequestCoalescer.h"
+#include "BulkRequestHandlerInterface.h"
+#include "task/TaskRunnerInterface.h"
+
+namespace UKControllerPlugin::Api {
+
+    ApiRequestCoalescer::ApiRequestCoalescer(
+        TaskManager::TaskRunnerInterface& taskRunner, BulkRequestHandlerInterface& handler)
+        : taskRunner(taskRunner), handler(handler)
+    {
+    }
+
+    auto ApiRequestCoalescer::BulkSupported() const -> bool
+    {
+        return this->bulkSupported;
+    }
+
+    auto ApiRequestCoalescer::CountInFlight() const -> size_t
+    {
+        std::lock_guard lock(this->queueLock);
+        return this->inFlight.size();
+    }
+
+    auto ApiRequestCoalescer::CountPending() const -> size_t
+    {
+        std::lock_guard lock(this->queueLock);
+        return this->pending.size();
+    }
+
+    /*
+        Queue an item to be sent next time we're triggered. Returns false if there's already
+        a request queued or in flight for the callsign.
+    */
+    auto ApiRequestCoalescer::Enqueue(const std::string& callsign, nlohmann::json item) -> bool
+    {
+        std::lock_guard lock(this->queueLock);
+        if (this->pending.count(callsign) != 0 || this->inFlight.count(callsign) != 0) {
+            return false;
+        }
+
+        this->pending[callsign] = std::move(item);
+        return true;
+    }
+
+    void ApiRequestCoalescer::TimedEventTrigger()
+    {
+        std::map<std::string, nlohmann::json> batch;
+        {
+            std::lock_guard lock(this->queueLock);
+            if (this->pending.empty()) {
+                return;
+            }
+
+            batch.swap(this->pending);
+            for (const auto& [callsign, item] : batch) {
+                this->inFlight.insert(callsign);
+            }
+        }
+
+        this->taskRunner.QueueAsynchronousTask([this, batch]() { this->SendBatch(batch); });
+    }
+
+    /*
+        Send the batch in one request if we can. Anything that doesn't come back in the bulk
+        response gets sent on its own.
+    */
+    void ApiRequestCoalescer::SendBatch(const std::map<std::string, nlohmann::json>& batch)
+    {
+        if (batch.size() == 1 || !this->bulkSupported) {
+            this->SendIndividually(batch);
+            return;
+        }
+
+        auto items = nlohmann::json::array();
+        for (const auto& [callsign, item] : batch) {
+            items.push_back(item);
+        }
+
+        std::optional<nlohmann::json> results;
+        try {
+            results = this->handler.PerformBulkRequest(items);
+        } catch (const std::exception& exception) {
+            LogWarning("Bulk API request failed, abandoning requests: " + std::string(exception.what()));
+            for (const auto& [callsign, item] : batch) {
+                this->Complete(callsign, [this, &callsign = callsign]() { this->handler.AbandonRequest(callsign); });
+            }
+            return;
+        }
+
+        if (!results) {
+            LogInfo("API does not support bulk requests, sending individually");
+            this->bulkSupported = false;
+            this->SendIndividually(batch);
+            return;
+        }
+
+        std::map<std::string, nlohmann::json> missing;
+        for (const auto& [callsign, item] : batch) {
+            if (!results->is_object() || !results->contains(callsign)) {
+                missing[callsign] = item;
+                continue;
+            }
+
+            this->Complete(callsign, [this, &callsign = callsign, &results]() {
+                this->handler.ProcessBulkResult(callsign, results->at(callsign));
+            });
+        }
+
+        this->SendIndividually(missing);
+    }
+
+    void ApiRequestCoalescer::SendIndividually(const std::map<std::string, nlohmann::json>& batch)
+    {
+        for (const auto& [callsign, item] : batch) {
+            this->Complete(callsign, [this, &callsign = callsign, &item = item]() {
+                this->handler.PerformItemRequest(callsign, item);
+            });
+        }
+    }
+
+    /*
+        Processes the item, then marks it as no longer in flight. This happens even if processing
+        throws, otherwise the callsign would stay in flight and every later request for it would be dropped.
+    */
+    void ApiRequestCoalescer::Complete(const std::string& callsign, const std::function<void(void)>& process)
+    {
+        try {
+            process();
+        } catch (const std::exception& exception) {
+            LogError("Failed to process API request for " + callsign + ": " + std::string(exception.what()));
+        }
+
+        std::lock_guard lock(this->queueLock);
+        this->inFlight.erase(callsign);
+    }
+} // namespace UKControllerPlugin::Api
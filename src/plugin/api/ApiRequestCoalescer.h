@@ -0,0 +1,54 @@
+#pragma once
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPlugin::TaskManager {
+    class TaskRunnerInterface;
+} // namespace UKControllerPlugin::TaskManager
+
+namespace UKControllerPlugin::Api {
+    class BulkRequestHandlerInterface;
+
+    /*
+        Collects API requests of the same type that are made in quick succession (e.g. after logging on)
+        and sends them as a single bulk request every time it is triggered, rather than making one round
+        trip per aircraft.
+
+        Requests for a callsign that is already queued or in flight are dropped. If the server doesn't
+        support bulk requests, falls back to making one request per item from then on. If a bulk request
+        fails, its items are abandoned rather than sent one by one, so a struggling server isn't hit with
+        a request per item.
+    */
+    class ApiRequestCoalescer : public TimedEvent::AbstractTimedEvent
+    {
+        public:
+        ApiRequestCoalescer(TaskManager::TaskRunnerInterface& taskRunner, BulkRequestHandlerInterface& handler);
+        [[nodiscard]] auto BulkSupported() const -> bool;
+        [[nodiscard]] auto CountInFlight() const -> size_t;
+        [[nodiscard]] auto CountPending() const -> size_t;
+        auto Enqueue(const std::string& callsign, nlohmann::json item) -> bool;
+        void TimedEventTrigger() override;
+
+        private:
+        void Complete(const std::string& callsign, const std::function<void(void)>& process);
+        void SendBatch(const std::map<std::string, nlohmann::json>& batch);
+        void SendIndividually(const std::map<std::string, nlohmann::json>& batch);
+
+        // Runs the requests off the main thread
+        TaskManager::TaskRunnerInterface& taskRunner;
+
+        // Makes the requests and processes the results
+        BulkRequestHandlerInterface& handler;
+
+        // Protects the queues
+        mutable std::mutex queueLock;
+
+        // Items waiting to be sent, by callsign
+        std::map<std::string, nlohmann::json> pending;
+
+        // Callsigns whose requests have been sent but not yet completed
+        std::set<std::string> inFlight;
+
+        // Whether the server supports bulk requests, we assume so until it tells us otherwise
+        std::atomic<bool> bulkSupported = true;
+    };
+} // namespace UKControllerPlugin::Api
@@ -0,0 +1,56 @@
+#include "ApiStatusMessage.h"
+
+namespace UKControllerPlugin::Api {
+
+    ApiStatusMessage::ApiStatusMessage(
+        bool healthy, std::string slowestEndpoint, std::chrono::milliseconds slowestLatency)
+        : healthy(healthy), slowestEndpoint(std::move(slowestEndpoint)), slowestLatency(slowestLatency)
+    {
+    }
+
+    auto ApiStatusMessage::MessageHandler() const -> std::string
+    {
+        return "UKCP_API";
+    }
+
+    auto ApiStatusMessage::MessageSender() const -> std::string
+    {
+        return "UKCP";
+    }
+
+    auto ApiStatusMessage::MessageString() const -> std::string
+    {
+        const std::string status =
+            healthy ? "The UKCP API is responding again, normal operation has resumed."
+                    : "The UKCP API is not responding. Requests will be paused and retried automatically.";
+
+        return slowestEndpoint.empty() ? status
+                                       : status + " Slowest endpoint is " + slowestEndpoint + ", averaging " +
+                                             std::to_string(slowestLatency.count()) + "ms.";
+    }
+
+    auto ApiStatusMessage::MessageShowHandler() const -> bool
+    {
+        return true;
+    }
+
+    auto ApiStatusMessage::MessageMarkUnread() const -> bool
+    {
+        return true;
+    }
+
+    auto ApiStatusMessage::MessageOverrideBusy() const -> bool
+    {
+        return false;
+    }
+
+    auto ApiStatusMessage::MessageFlashHandler() const -> bool
+    {
+        return !healthy;
+    }
+
+    auto ApiStatusMessage::MessageRequiresConfirm() const -> bool
+    {
+        return false;
+    }
+} // namespace UKControllerPlugin::Api
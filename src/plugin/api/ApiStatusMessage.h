@@ -0,0 +1,38 @@
+#pragma once
+#include "message/MessageSerializableInterface.h"
+
+namespace UKControllerPlugin::Api {
+
+    /*
+        A message to let the user know that the API has become unavailable, or has recovered, along with
+        the endpoint that has been slowest to respond.
+    */
+    class ApiStatusMessage : public UKControllerPlugin::Message::MessageSerializableInterface
+    {
+        public:
+        explicit ApiStatusMessage(
+            bool healthy,
+            std::string slowestEndpoint = "",
+            std::chrono::milliseconds slowestLatency = std::chrono::milliseconds(0));
+
+        // Inherited via MessageSerializableInterface
+        [[nodiscard]] auto MessageHandler() const -> std::string override;
+        [[nodiscard]] auto MessageSender() const -> std::string override;
+        [[nodiscard]] auto MessageString() const -> std::string override;
+        [[nodiscard]] auto MessageShowHandler() const -> bool override;
+        [[nodiscard]] auto MessageMarkUnread() const -> bool override;
+        [[nodiscard]] auto MessageOverrideBusy() const -> bool override;
+        [[nodiscard]] auto MessageFlashHandler() const -> bool override;
+        [[nodiscard]] auto MessageRequiresConfirm() const -> bool override;
+
+        private:
+        // Whether the API is healthy
+        bool healthy;
+
+        // The endpoint with the highest average latency, if we know of one
+        std::string slowestEndpoint;
+
+        // The average latency of the slowest endpoint
+        std::chrono::milliseconds slowestLatency;
+    };
+} // namespace UKControllerPlugin::Api
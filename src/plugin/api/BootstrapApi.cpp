@@ -1,8 +1,10 @@
 #include "ApiConfigurationMenuItem.h"
+#include "ApiHealthMonitor.h"
 #include "BootstrapApi.h"
 #include "ReplaceApiKeyDialog.h"
 #include "api/ApiBootstrap.h"
 #include "api/ApiFactory.h"
+#include "api/ApiHealthTracker.h"
 #include "api/ApiKeyReceivedEvent.h"
 #include "api/ApiKeyRedirectUrlBuilder.h"
 #include "api/ApiSettingsProviderInterface.h"
@@ -13,6 +15,7 @@
 #include "eventhandler/EventHandlerFlags.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "radarscreen/ConfigurableDisplayCollection.h"
+#include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Euroscope::CallbackFunction;
@@ -22,7 +25,14 @@ namespace UKControllerPlugin::Api {
     {
         container.apiFactory =
             UKControllerPluginUtils::Api::Bootstrap(*container.settingsRepository, *container.windows);
-        container.api = UKControllerPluginUtils::Api::BootstrapLegacy(*container.apiFactory, *container.curl);
+        container.api = UKControllerPluginUtils::Api::BootstrapLegacy(
+            *container.apiFactory, *container.curl, *container.windows);
+
+        // Let the user know when the API stops responding
+        container.apiHealth = container.apiFactory->HealthTracker();
+        container.timedHandler->RegisterEvent(
+            std::make_shared<ApiHealthMonitor>(*container.apiHealth, *container.userMessager),
+            apiHealthCheckFrequency);
 
         // Register dialog
         auto replaceDialog = std::make_shared<ReplaceApiKeyDialog>(
@@ -10,6 +10,9 @@ namespace UKControllerPlugin {
 } // namespace UKControllerPlugin
 
 namespace UKControllerPlugin::Api {
+    // How often to check whether the API has stopped responding, or recovered
+    const int apiHealthCheckFrequency = 5;
+
     void BootstrapApi(Bootstrap::PersistenceContainer& container);
     void BootstrapConfigurationMenuItem(
         const Bootstrap::PersistenceContainer& container,
@@ -0,0 +1,36 @@
+#pragma once
+
+namespace UKControllerPlugin::Api {
+
+    /*
+        Something that can make API requests for many aircraft at once, as well as one at a time.
+        Used by the ApiRequestCoalescer to batch up requests made in quick succession.
+    */
+    class BulkRequestHandlerInterface
+    {
+        public:
+        virtual ~BulkRequestHandlerInterface() = default;
+
+        /*
+            Make one request for all of the items, returning the results as an object keyed by callsign.
+            Returns nullopt if the server doesn't support bulk requests. Throws if the request fails.
+        */
+        [[nodiscard]] virtual auto PerformBulkRequest(const nlohmann::json& items) -> std::optional<nlohmann::json> = 0;
+
+        /*
+            Process the result of a bulk request for a single callsign.
+        */
+        virtual void ProcessBulkResult(const std::string& callsign, const nlohmann::json& result) = 0;
+
+        /*
+            Make the request for a single item, used when bulk requests aren't possible.
+        */
+        virtual void PerformItemRequest(const std::string& callsign, const nlohmann::json& item) = 0;
+
+        /*
+            Called for each item in a bulk request that failed. The item isn't retried, so anything
+            waiting on the result should give up on it.
+        */
+        virtual void AbandonRequest(const std::string& callsign) = 0;
+    };
+} // namespace UKControllerPlugin::Api
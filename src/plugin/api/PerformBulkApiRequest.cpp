@@ -0,0 +1,38 @@
+#include "PerformBulkApiRequest.h"
+#include "api/ApiRequestException.h"
+#include "api/ApiRequestFactory.h"
+
+namespace UKControllerPlugin::Api {
+
+    auto PerformBulkApiRequest(const std::string& endpoint, const nlohmann::json& items)
+        -> std::optional<nlohmann::json>
+    {
+        LogDebug("Making bulk API request to " + endpoint + ": " + items.dump());
+        std::optional<nlohmann::json> results;
+        std::optional<std::string> failure;
+        bool supported = true;
+        ApiRequest()
+            .Post(endpoint, {{"assignments", items}})
+            .Then([&results](const UKControllerPluginUtils::Api::Response& response) { results = response.Data(); })
+            .Catch([&supported, &failure](const UKControllerPluginUtils::Api::ApiRequestException& exception) {
+                if (exception.StatusCode() == UKControllerPluginUtils::Http::HttpStatusCode::NotFound ||
+                    exception.StatusCode() == UKControllerPluginUtils::Http::HttpStatusCode::MethodNotAllowed) {
+                    supported = false;
+                    return;
+                }
+
+                failure = exception.what();
+            })
+            .Await();
+
+        if (!supported) {
+            return std::nullopt;
+        }
+
+        if (failure) {
+            throw std::runtime_error("Failed to make bulk API request to " + endpoint + ": " + *failure);
+        }
+
+        return results ? std::move(results) : nlohmann::json::object();
+    }
+} // namespace UKControllerPlugin::Api
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace UKControllerPlugin::Api {
+
+    /*
+        Posts the items to a bulk endpoint, for use by BulkRequestHandlerInterface implementations.
+
+        Returns the results as an object keyed by callsign, or nullopt if the server doesn't support
+        bulk requests. Throws if the request fails.
+
+        THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
+    */
+    [[nodiscard]] auto PerformBulkApiRequest(const std::string& endpoint, const nlohmann::json& items)
+        -> std::optional<nlohmann::json>;
+} // namespace UKControllerPlugin::Api
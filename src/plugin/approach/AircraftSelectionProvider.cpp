@@ -31,14 +31,14 @@ namespace UKControllerPlugin::Approach {
         std::set<std::string> callsigns;
         this->plugin.ApplyFunctionToAllFlightplans(
             [&callsigns, &sequence, this](
-                const std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface>& fp,
-                const std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface>& rt) {
-                if (fp->GetDestination() != options->Airfield() || sequence.Get(fp->GetCallsign()) != nullptr ||
-                    rt->GetGroundSpeed() < 50) {
+                const Euroscope::EuroScopeCFlightPlanInterface& fp,
+                const Euroscope::EuroScopeCRadarTargetInterface& rt) {
+                if (fp.GetDestination() != options->Airfield() || sequence.Get(fp.GetCallsign()) != nullptr ||
+                    rt.GetGroundSpeed() < 50) {
                     return;
                 }
 
-                callsigns.insert(fp->GetCallsign());
+                callsigns.insert(fp.GetCallsign());
             });
 
         return callsigns;
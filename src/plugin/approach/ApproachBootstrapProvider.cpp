@@ -8,7 +8,9 @@
 #include "ApproachSequencerDisplayAsrLoader.h"
 #include "ApproachSequencerDisplayOptions.h"
 #include "ApproachSequencerOptionsLoader.h"
+#include "ApproachSpacingMonitor.h"
 #include "ApproachSpacingRingRenderer.h"
+#include "ApproachSpacingTagItem.h"
 #include "GlideslopeDeviationEstimator.h"
 #include "GlideslopeDeviationTagItem.h"
 #include "RemoveLandedAircraft.h"
@@ -20,6 +22,7 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "euroscope/AsrEventHandlerCollection.h"
 #include "euroscope/PluginSettingsProviderCollection.h"
+#include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "list/PopupListFactory.h"
 #include "radarscreen/MenuToggleableDisplayFactory.h"
@@ -48,6 +51,16 @@ namespace UKControllerPlugin::Approach {
         container.tagHandler->RegisterTagItem(
             GLIDESLOPE_DEVIATION_TAG_ITEM_ID,
             std::make_shared<GlideslopeDeviationTagItem>(deviationEstimator, container.runwayCollection));
+
+        // Keep track of the spacing between sequenced aircraft as they move and display it
+        const auto spacingMonitor = std::make_shared<ApproachSpacingMonitor>(
+            container.moduleFactories->Approach().Sequencer(),
+            container.moduleFactories->Approach().SpacingCalculator(container));
+        container.radarTargetHandler->RegisterHandler(spacingMonitor);
+
+        const auto spacingTagItem = std::make_shared<ApproachSpacingTagItem>(spacingMonitor);
+        container.tagHandler->RegisterTagItem(ApproachSpacingTagItem::SPACING_TAG_ITEM_ID, spacingTagItem);
+        container.tagHandler->RegisterTagItem(ApproachSpacingTagItem::SPACING_DIFFERENCE_TAG_ITEM_ID, spacingTagItem);
     }
 
     void ApproachBootstrapProvider::BootstrapRadarScreen(
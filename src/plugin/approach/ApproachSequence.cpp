@@ -15,6 +15,7 @@ namespace UKControllerPlugin::Approach {
 
         aircraft->Previous(lastAircraft);
         sequencedAircraft.push_back(aircraft);
+        aircraftIndex[callsign] = std::prev(sequencedAircraft.cend());
     }
 
     void ApproachSequence::AddAircraftToSequence(
@@ -35,7 +36,7 @@ namespace UKControllerPlugin::Approach {
             aircraft->Next(existing);
             existing->Previous(aircraft);
 
-            sequencedAircraft.insert(existingAircraft, aircraft);
+            aircraftIndex[callsign] = sequencedAircraft.insert(existingAircraft, aircraft);
         } else {
             AddAircraftToSequence(callsign, mode);
         }
@@ -55,6 +56,7 @@ namespace UKControllerPlugin::Approach {
                 aircraft->Previous()->Next(nullptr);
             }
 
+            aircraftIndex.erase(callsign);
             sequencedAircraft.erase(sequenced);
         }
     }
@@ -107,9 +109,8 @@ namespace UKControllerPlugin::Approach {
 
         previousAircraft->Next(nextAircraft);
 
-        // Re-sequence the list
-        this->sequencedAircraft.erase(aircraftIterator);
-        this->sequencedAircraft.insert(previousAircraftIterator, aircraft);
+        // Re-sequence the list, splicing keeps the indexed iterators valid
+        this->sequencedAircraft.splice(previousAircraftIterator, this->sequencedAircraft, aircraftIterator);
     }
 
     void ApproachSequence::MoveAircraftDown(const std::string& callsign)
@@ -146,9 +147,8 @@ namespace UKControllerPlugin::Approach {
         }
         nextAircraft->Previous(previousAircraft);
 
-        // Re-sequence the list
-        this->sequencedAircraft.erase(nextAircraftIterator);
-        this->sequencedAircraft.insert(aircraftIterator, nextAircraft);
+        // Re-sequence the list, splicing keeps the indexed iterators valid
+        this->sequencedAircraft.splice(aircraftIterator, this->sequencedAircraft, nextAircraftIterator);
     }
 
     auto ApproachSequence::Callsigns() const -> std::list<std::string>
@@ -162,13 +162,9 @@ namespace UKControllerPlugin::Approach {
     }
 
     auto ApproachSequence::AircraftMatchingCallsign(const std::string& callsign) const
-        -> std::list<std::shared_ptr<ApproachSequencedAircraft>>::const_iterator
+        -> SequenceList::const_iterator
     {
-        return std::find_if(
-            sequencedAircraft.cbegin(),
-            sequencedAircraft.cend(),
-            [&callsign](const std::shared_ptr<ApproachSequencedAircraft>& sequencedAircraft) -> bool {
-                return sequencedAircraft->Callsign() == callsign;
-            });
+        auto indexed = aircraftIndex.find(callsign);
+        return indexed == aircraftIndex.cend() ? sequencedAircraft.cend() : indexed->second;
     }
 } // namespace UKControllerPlugin::Approach
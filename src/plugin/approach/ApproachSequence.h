@@ -21,8 +21,14 @@ namespace UKControllerPlugin::Approach {
         [[nodiscard]] auto Callsigns() const -> std::list<std::string>;
 
         private:
-        [[nodiscard]] auto AircraftMatchingCallsign(const std::string& callsign) const
-            -> std::list<std::shared_ptr<ApproachSequencedAircraft>>::const_iterator;
-        std::list<std::shared_ptr<ApproachSequencedAircraft>> sequencedAircraft;
+        using SequenceList = std::list<std::shared_ptr<ApproachSequencedAircraft>>;
+
+        [[nodiscard]] auto AircraftMatchingCallsign(const std::string& callsign) const -> SequenceList::const_iterator;
+
+        // The aircraft, in sequence order
+        SequenceList sequencedAircraft;
+
+        // Callsign to position in the sequence, list iterators remain valid across insertions and splices
+        std::unordered_map<std::string, SequenceList::const_iterator> aircraftIndex;
     };
 } // namespace UKControllerPlugin::Approach
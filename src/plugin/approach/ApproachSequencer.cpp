@@ -22,6 +22,7 @@ namespace UKControllerPlugin::Approach {
     {
         RemoveAircraftFromSequences(callsign);
         GetOrCreate(airfield).AddAircraftToSequence(callsign, mode);
+        aircraftAirfields[callsign] = airfield;
     }
 
     void ApproachSequencer::AddAircraftToSequence(
@@ -32,16 +33,18 @@ namespace UKControllerPlugin::Approach {
     {
         RemoveAircraftFromSequences(callsign);
         GetOrCreate(airfield).AddAircraftToSequence(callsign, mode, insertBefore);
+        aircraftAirfields[callsign] = airfield;
     }
 
     void ApproachSequencer::RemoveAircraftFromSequences(const std::string& callsign)
     {
-        for (const auto& sequence : sequences) {
-            if (sequence.second->Get(callsign)) {
-                sequence.second->RemoveAircraft(callsign);
-                break;
-            }
+        auto airfield = aircraftAirfields.find(callsign);
+        if (airfield == aircraftAirfields.cend()) {
+            return;
         }
+
+        sequences.at(airfield->second)->RemoveAircraft(callsign);
+        aircraftAirfields.erase(airfield);
     }
 
     void ApproachSequencer::MoveAircraftDown(const std::string& airfield, const std::string& callsign)
@@ -68,12 +71,7 @@ namespace UKControllerPlugin::Approach {
 
     auto ApproachSequencer::AirfieldForAircraft(const std::string& aircraft) const -> std::string
     {
-        for (const auto& sequence : sequences) {
-            if (sequence.second->Get(aircraft) != nullptr) {
-                return sequence.first;
-            }
-        }
-
-        return "";
+        auto airfield = aircraftAirfields.find(aircraft);
+        return airfield == aircraftAirfields.cend() ? "" : airfield->second;
     }
 } // namespace UKControllerPlugin::Approach
@@ -29,5 +29,8 @@ namespace UKControllerPlugin::Approach {
         [[nodiscard]] auto GetOrCreate(const std::string& airfield) -> ApproachSequence&;
 
         std::map<std::string, std::shared_ptr<ApproachSequence>> sequences;
+
+        // Which airfield each sequenced aircraft belongs to
+        std::unordered_map<std::string, std::string> aircraftAirfields;
     };
 } // namespace UKControllerPlugin::Approach
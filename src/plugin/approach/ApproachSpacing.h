@@ -0,0 +1,19 @@
+#pragma once
+
+namespace UKControllerPlugin::Approach {
+    /**
+     * The spacing between an aircraft in the approach sequence and
+     * the aircraft ahead of it.
+     */
+    using ApproachSpacing = struct ApproachSpacing
+    {
+        // The aircraft ahead in the sequence
+        std::string lead;
+
+        // The current distance to the lead aircraft, in nautical miles
+        double actual;
+
+        // The distance required behind the lead aircraft, in nautical miles
+        double required;
+    };
+} // namespace UKControllerPlugin::Approach
@@ -38,20 +38,28 @@ namespace UKControllerPlugin::Approach {
             return NoSpacing();
         }
 
-        const auto thisFlightplan = plugin.GetFlightplanForCallsign(aircraft.Callsign());
-        const auto previousFlightplan = plugin.GetFlightplanForCallsign(aircraft.Previous()->Callsign());
-        if (!thisFlightplan || !previousFlightplan) {
+        // Map the wake categories whilst we have the flightplans, so we don't have to hold on to them
+        auto wakeMapper = wakeMappers.Get(airfieldModel->WakeScheme());
+        std::shared_ptr<Wake::WakeCategory> thisWakeCategory;
+        std::shared_ptr<Wake::WakeCategory> previousWakeCategory;
+        const auto mapWakeCategory = [&wakeMapper](std::shared_ptr<Wake::WakeCategory>& category) {
+            return [&wakeMapper, &category](const Euroscope::EuroScopeCFlightPlanInterface& flightplan) {
+                if (wakeMapper) {
+                    category = wakeMapper->MapForFlightplan(flightplan);
+                }
+            };
+        };
+
+        if (!plugin.ApplyFunctionToFlightplan(aircraft.Callsign(), mapWakeCategory(thisWakeCategory)) ||
+            !plugin.ApplyFunctionToFlightplan(aircraft.Previous()->Callsign(), mapWakeCategory(previousWakeCategory))) {
             return NoSpacing();
         }
 
         auto minimumSeparation = AirfieldMinimumSeparation(airfield);
-        auto wakeMapper = wakeMappers.Get(airfieldModel->WakeScheme());
         if (!wakeMapper) {
             return minimumSeparation;
         }
 
-        auto thisWakeCategory = wakeMapper->MapForFlightplan(*thisFlightplan);
-        auto previousWakeCategory = wakeMapper->MapForFlightplan(*previousFlightplan);
         if (!thisWakeCategory || !previousWakeCategory) {
             return minimumSeparation;
         }
@@ -0,0 +1,109 @@
+#include "ApproachSequence.h"
+#include "ApproachSequencedAircraft.h"
+#include "ApproachSequencer.h"
+#include "ApproachSpacingCalculator.h"
+#include "ApproachSpacingMonitor.h"
+#include "euroscope/EuroScopeCRadarTargetInterface.h"
+
+namespace UKControllerPlugin::Approach {
+
+    ApproachSpacingMonitor::ApproachSpacingMonitor(
+        ApproachSequencer& sequencer, const ApproachSpacingCalculator& spacingCalculator)
+        : sequencer(sequencer), spacingCalculator(spacingCalculator)
+    {
+    }
+
+    void ApproachSpacingMonitor::RadarTargetPositionUpdateEvent(Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        const auto callsign = radarTarget.GetCallsign();
+        const auto airfield = sequencer.AirfieldForAircraft(callsign);
+        if (airfield.empty()) {
+            Forget(callsign);
+            return;
+        }
+
+        positions[callsign] = radarTarget.GetPosition();
+        const auto aircraft = sequencer.GetForAirfield(airfield).Get(callsign);
+        UpdateSpacing(airfield, *aircraft);
+
+        // The aircraft behind only needs its distance updating, unless it has a new lead
+        const auto& next = aircraft->Next();
+        if (!next) {
+            return;
+        }
+
+        const auto nextSpacing = spacings.find(next->Callsign());
+        if (nextSpacing != spacings.cend() && nextSpacing->second.lead == callsign) {
+            UpdateActualSpacing(*next);
+        } else {
+            UpdateSpacing(airfield, *next);
+        }
+    }
+
+    auto ApproachSpacingMonitor::SpacingFor(const std::string& callsign) -> const ApproachSpacing*
+    {
+        const auto airfield = sequencer.AirfieldForAircraft(callsign);
+        if (airfield.empty()) {
+            Forget(callsign);
+            return nullptr;
+        }
+
+        // If the sequence has changed since we last calculated, recalculate now
+        const auto aircraft = sequencer.GetForAirfield(airfield).Get(callsign);
+        auto spacing = spacings.find(callsign);
+        if (spacing == spacings.cend() || !aircraft->Previous() ||
+            spacing->second.lead != aircraft->Previous()->Callsign()) {
+            UpdateSpacing(airfield, *aircraft);
+            spacing = spacings.find(callsign);
+        }
+
+        return spacing == spacings.cend() ? nullptr : &spacing->second;
+    }
+
+    auto ApproachSpacingMonitor::CountTrackedPairs() const -> size_t
+    {
+        return spacings.size();
+    }
+
+    void ApproachSpacingMonitor::UpdateSpacing(const std::string& airfield, const ApproachSequencedAircraft& aircraft)
+    {
+        if (!aircraft.Previous()) {
+            spacings.erase(aircraft.Callsign());
+            return;
+        }
+
+        const auto position = positions.find(aircraft.Callsign());
+        const auto leadPosition = positions.find(aircraft.Previous()->Callsign());
+        if (position == positions.cend() || leadPosition == positions.cend()) {
+            spacings.erase(aircraft.Callsign());
+            return;
+        }
+
+        const auto required = spacingCalculator.Calculate(airfield, aircraft);
+        if (required == ApproachSpacingCalculator::NoSpacing()) {
+            spacings.erase(aircraft.Callsign());
+            return;
+        }
+
+        spacings[aircraft.Callsign()] = {
+            aircraft.Previous()->Callsign(), leadPosition->second.DistanceTo(position->second), required};
+    }
+
+    void ApproachSpacingMonitor::UpdateActualSpacing(const ApproachSequencedAircraft& aircraft)
+    {
+        const auto position = positions.find(aircraft.Callsign());
+        const auto leadPosition = positions.find(aircraft.Previous()->Callsign());
+        if (position == positions.cend() || leadPosition == positions.cend()) {
+            spacings.erase(aircraft.Callsign());
+            return;
+        }
+
+        spacings.at(aircraft.Callsign()).actual = leadPosition->second.DistanceTo(position->second);
+    }
+
+    void ApproachSpacingMonitor::Forget(const std::string& callsign)
+    {
+        positions.erase(callsign);
+        spacings.erase(callsign);
+    }
+} // namespace UKControllerPlugin::Approach
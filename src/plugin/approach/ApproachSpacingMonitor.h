@@ -0,0 +1,42 @@
+#pragma once
+#include "ApproachSpacing.h"
+#include "euroscope/RadarTargetEventHandlerInterface.h"
+
+namespace UKControllerPlugin::Approach {
+    class ApproachSequencedAircraft;
+    class ApproachSequencer;
+    class ApproachSpacingCalculator;
+
+    /**
+     * Keeps track of the actual and required spacing between every consecutive pair
+     * of aircraft in the approach sequences.
+     *
+     * Only the pairs involving an aircraft whose position has been updated are recalculated, and the
+     * required spacing is only recalculated when the follower moves or the lead aircraft changes.
+     */
+    class ApproachSpacingMonitor : public Euroscope::RadarTargetEventHandlerInterface
+    {
+        public:
+        ApproachSpacingMonitor(ApproachSequencer& sequencer, const ApproachSpacingCalculator& spacingCalculator);
+        void RadarTargetPositionUpdateEvent(Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
+        [[nodiscard]] auto SpacingFor(const std::string& callsign) -> const ApproachSpacing*;
+        [[nodiscard]] auto CountTrackedPairs() const -> size_t;
+
+        private:
+        void UpdateSpacing(const std::string& airfield, const ApproachSequencedAircraft& aircraft);
+        void UpdateActualSpacing(const ApproachSequencedAircraft& aircraft);
+        void Forget(const std::string& callsign);
+
+        // The sequences
+        ApproachSequencer& sequencer;
+
+        // Calculates the required spacing between two aircraft
+        const ApproachSpacingCalculator& spacingCalculator;
+
+        // The last known position of each sequenced aircraft
+        std::unordered_map<std::string, EuroScopePlugIn::CPosition> positions;
+
+        // The spacing for each sequenced aircraft that has an aircraft ahead of it
+        std::unordered_map<std::string, ApproachSpacing> spacings;
+    };
+} // namespace UKControllerPlugin::Approach
@@ -41,9 +41,14 @@ namespace UKControllerPlugin::Approach {
                 continue;
             }
 
-            const auto flightplan = plugin.GetFlightplanForCallsign(aircraft->Callsign());
-            const auto radarTarget = plugin.GetRadarTargetForCallsign(aircraft->Callsign());
-            if (!flightplan || !radarTarget) {
+            EuroScopePlugIn::CPosition radarTargetPosition;
+            const auto hasFlightplan = plugin.ApplyFunctionToFlightplan(
+                aircraft->Callsign(), [](const Euroscope::EuroScopeCFlightPlanInterface&) {});
+            const auto hasRadarTarget = plugin.ApplyFunctionToRadarTarget(
+                aircraft->Callsign(), [&radarTargetPosition](const Euroscope::EuroScopeCRadarTargetInterface& target) {
+                    radarTargetPosition = target.GetPosition();
+                });
+            if (!hasFlightplan || !hasRadarTarget) {
                 aircraft = aircraft->Next();
                 return;
             }
@@ -51,7 +56,7 @@ namespace UKControllerPlugin::Approach {
             double requiredDistance = spacingCalculator.Calculate(options->Airfield(), *aircraft);
             if (requiredDistance != spacingCalculator.NoSpacing()) {
                 double circleRadius = Geometry::ScreenRadiusFromDistance(requiredDistance, radarScreen);
-                auto position = radarScreen.ConvertCoordinateToScreenPoint(radarTarget->GetPosition());
+                auto position = radarScreen.ConvertCoordinateToScreenPoint(radarTargetPosition);
 
                 graphics.FillCircle(
                     Gdiplus::RectF{
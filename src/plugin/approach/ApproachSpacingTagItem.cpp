@@ -0,0 +1,44 @@
+#include "ApproachSpacingMonitor.h"
+#include "ApproachSpacingTagItem.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "tag/TagData.h"
+
+namespace UKControllerPlugin::Approach {
+
+    ApproachSpacingTagItem::ApproachSpacingTagItem(std::shared_ptr<ApproachSpacingMonitor> spacingMonitor)
+        : spacingMonitor(std::move(spacingMonitor))
+    {
+        assert(this->spacingMonitor != nullptr && "Spacing monitor cannot be null");
+    }
+
+    auto ApproachSpacingTagItem::GetTagItemDescription(int tagItemId) const -> std::string
+    {
+        switch (tagItemId) {
+        case SPACING_TAG_ITEM_ID:
+            return "Approach Spacing Actual / Required";
+        case SPACING_DIFFERENCE_TAG_ITEM_ID:
+            return "Approach Spacing Difference";
+        default:
+            throw std::invalid_argument("Invalid tag item ID");
+        }
+    }
+
+    void ApproachSpacingTagItem::SetTagItemData(Tag::TagData& tagData)
+    {
+        const auto spacing = spacingMonitor->SpacingFor(tagData.GetFlightplan().GetCallsign());
+        if (spacing == nullptr) {
+            return;
+        }
+
+        if (spacing->actual < spacing->required) {
+            tagData.SetTagColour(INSUFFICIENT_SPACING_COLOUR);
+        }
+
+        if (tagData.GetItemCode() == SPACING_TAG_ITEM_ID) {
+            tagData.SetItemString(fmt::format("{:.1f}/{:.1f}", spacing->actual, spacing->required));
+            return;
+        }
+
+        tagData.SetItemString(fmt::format("{:+.1f}", spacing->actual - spacing->required));
+    }
+} // namespace UKControllerPlugin::Approach
@@ -0,0 +1,29 @@
+#pragma once
+#include "tag/TagItemInterface.h"
+
+namespace UKControllerPlugin::Approach {
+    class ApproachSpacingMonitor;
+
+    /**
+     * Displays the actual versus required spacing between an aircraft in the
+     * approach sequence and the aircraft ahead of it.
+     */
+    class ApproachSpacingTagItem : public Tag::TagItemInterface
+    {
+        public:
+        ApproachSpacingTagItem(std::shared_ptr<ApproachSpacingMonitor> spacingMonitor);
+        [[nodiscard]] auto GetTagItemDescription(int tagItemId) const -> std::string override;
+        void SetTagItemData(Tag::TagData& tagData) override;
+
+        // The TAG Item IDs
+        inline static const int SPACING_TAG_ITEM_ID = 133;
+        inline static const int SPACING_DIFFERENCE_TAG_ITEM_ID = 134;
+
+        private:
+        // Monitors the spacing
+        const std::shared_ptr<ApproachSpacingMonitor> spacingMonitor;
+
+        // Colour to use when the spacing is insufficient
+        inline static const COLORREF INSUFFICIENT_SPACING_COLOUR = RGB(255, 87, 51);
+    };
+} // namespace UKControllerPlugin::Approach
@@ -7,6 +7,7 @@
 #include "flightplan/StoredFlightplanCollection.h"
 #include "ownership/AirfieldOwnershipManager.h"
 #include "radarscreen/RadarRenderableCollection.h"
+#include "timedevent/TimeoutWheel.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Command::CommandHandlerCollection;
@@ -14,12 +15,14 @@ using UKControllerPlugin::Controller::ActiveCallsignCollection;
 using UKControllerPlugin::Dependency::DependencyLoaderInterface;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::RadarScreen::RadarRenderableCollection;
+using UKControllerPlugin::TimedEvent::TimeoutWheel;
 
 namespace UKControllerPlugin::Bootstrap {
 
     void CollectionBootstrap::BootstrapPlugin(PersistenceContainer& persistence, DependencyLoaderInterface& dependency)
     {
         // Reset resources
-        persistence.flightplans = std::make_unique<StoredFlightplanCollection>();
+        persistence.timeouts = std::make_shared<TimeoutWheel>();
+        persistence.flightplans = std::make_unique<StoredFlightplanCollection>(persistence.timeouts);
     }
 } // namespace UKControllerPlugin::Bootstrap
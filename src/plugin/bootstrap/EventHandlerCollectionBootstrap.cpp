@@ -10,6 +10,7 @@
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
 #include "tag/TagItemCollection.h"
+#include "tag/TagItemMemo.h"
 #include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
@@ -34,8 +35,10 @@ namespace UKControllerPlugin::Bootstrap {
         persistence.tagHandler = std::make_unique<TagItemCollection>();
         persistence.radarTargetHandler = std::make_unique<RadarTargetEventHandlerCollection>();
         persistence.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+        persistence.flightplanHandler->RegisterHandler(persistence.tagHandler->Memo());
         persistence.controllerHandler = std::make_unique<ControllerStatusEventHandlerCollection>();
         persistence.timedHandler = std::make_unique<TimedEventCollection>();
+        persistence.timedHandler->SetTickBudget(std::chrono::milliseconds(timedEventTickBudgetMs));
         persistence.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
         persistence.userSettingHandlers = std::make_unique<UserSettingAwareCollection>();
         persistence.commandHandlers = std::make_unique<CommandHandlerCollection>();
@@ -18,6 +18,9 @@ namespace UKControllerPlugin {
         {
             public:
             static void BoostrapPlugin(UKControllerPlugin::Bootstrap::PersistenceContainer& persistence);
+
+            // How long timed events may run for in a single tick before the rest are deferred
+            static const int timedEventTickBudgetMs = 50;
         };
     } // namespace Bootstrap
 } // namespace UKControllerPlugin
@@ -56,12 +56,15 @@
 #include "runway/RunwayModule.h"
 #include "sectorfile/SectorFileBootstrap.h"
 #include "selcal/SelcalModule.h"
+#include "setting/SettingRepository.h"
 #include "sid/SidModule.h"
 #include "squawk/SquawkModule.h"
 #include "srd/SrdModule.h"
 #include "stands/StandModule.h"
+#include "state/StateModule.h"
 #include "task/RunAsyncTask.h"
 #include "task/TaskRunnerInterface.h"
+#include "timedevent/DeferredEventBootstrap.h"
 #include "update/PluginVersion.h"
 #include "wake/WakeModule.h"
 
@@ -100,6 +103,7 @@ namespace UKControllerPlugin {
     void InitialisePlugin::EuroScopeCleanup()
     {
         this->container->apiFactory->RequestFactory().AwaitRequestCompletion();
+        this->container->settingsRepository->Flush();
         this->container->taskRunner.reset();
         UnsetTaskRunner();
         this->container.reset();
@@ -175,6 +179,7 @@ namespace UKControllerPlugin {
         HelperBootstrap::Bootstrap(*this->container);
         Api::BootstrapApi(*this->container);
         Push::BootstrapPlugin(*this->container, this->duplicatePlugin->Duplicate());
+        State::BootstrapPlugin(*this->container, this->duplicatePlugin->Duplicate());
 
         // Datetime
         Datablock::BootstrapPlugin(*this->container);
@@ -221,6 +226,7 @@ namespace UKControllerPlugin {
         Airfield::BootstrapPlugin(*this->container, *this->container->dependencyLoader);
         Runway::BootstrapPlugin(*this->container, *this->container->dependencyLoader);
         CollectionBootstrap::BootstrapPlugin(*this->container, *this->container->dependencyLoader);
+        TimedEvent::DeferredEventBootstrap(*this->container);
         FlightplanStorageBootstrap::BootstrapPlugin(*this->container);
         FlightRules::BootstrapPlugin(*this->container, *this->container->dependencyLoader);
         AirfieldOwnershipModule::BootstrapPlugin(*this->container, *this->container->dependencyLoader);
@@ -287,6 +293,9 @@ namespace UKControllerPlugin {
         // Run the module bootstraps
         this->container->bootstrapProviders->BootstrapPlugin(*this->container);
 
+        // Pick up where we left off if we've been restarted
+        State::RestoreState(*this->container);
+
         // Do post-init and final setup, which involves running tasks that need to happen on load.
         PostInit::Process(*this->container);
         LogInfo("Plugin loaded successfully");
@@ -63,6 +63,7 @@
 #include "squawk/SquawkAssignment.h"
 #include "squawk/SquawkEventHandler.h"
 #include "squawk/SquawkGenerator.h"
+#include "state/PluginStateSnapshot.h"
 #include "tag/TagItemCollection.h"
 #include "task/TaskRunnerInterface.h"
 #include "timedevent/TimedEventCollection.h"
@@ -52,9 +52,11 @@ namespace UKControllerPlugin {
         class RunwayDialogAwareCollection;
         class UserSetting;
         class UserSettingAwareCollection;
+        class WrapperAllocationCounter;
     } // namespace Euroscope
     namespace Flightplan {
         class FlightPlanEventHandlerCollection;
+        class FlightplanSweep;
         class StoredFlightplanCollection;
     } // namespace Flightplan
     namespace FlightRules {
@@ -109,6 +111,8 @@ namespace UKControllerPlugin {
     } // namespace Prenote
     namespace Push {
         class PushEventProcessorCollection;
+        class SharedMemoryMapping;
+        class SharedSyncData;
     } // namespace Push
     namespace RadarScreen {
         class RadarRenderableCollection;
@@ -138,6 +142,9 @@ namespace UKControllerPlugin {
         class SquawkEventHandler;
         class SquawkGenerator;
     } // namespace Squawk
+    namespace State {
+        class PluginStateSnapshot;
+    } // namespace State
     namespace Tag {
         class TagItemCollection;
     } // namespace Tag
@@ -145,7 +152,9 @@ namespace UKControllerPlugin {
         class TaskRunnerInterface;
     } // namespace TaskManager
     namespace TimedEvent {
+        class DeferredEventHandler;
         class TimedEventCollection;
+        class TimeoutWheel;
     } // namespace TimedEvent
     namespace Wake {
         class WakeCategoryMapperCollection;
@@ -161,6 +170,7 @@ namespace UKControllerPlugin {
 namespace UKControllerPluginUtils {
     namespace Api {
         class ApiFactory;
+        class ApiHealthTracker;
     } // namespace Api
 } // namespace UKControllerPluginUtils
 
@@ -186,8 +196,10 @@ namespace UKControllerPlugin::Bootstrap {
         // The helpers and collections
         std::unique_ptr<UKControllerPlugin::Api::ApiInterface> api;
         std::shared_ptr<UKControllerPluginUtils::Api::ApiFactory> apiFactory;
+        std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> apiHealth;
         std::shared_ptr<UKControllerPlugin::TaskManager::TaskRunnerInterface> taskRunner;
         std::shared_ptr<UKControllerPlugin::Controller::ActiveCallsignCollection> activeCallsigns;
+        std::shared_ptr<UKControllerPlugin::TimedEvent::TimeoutWheel> timeouts;
         std::unique_ptr<UKControllerPlugin::Flightplan::StoredFlightplanCollection> flightplans;
         std::unique_ptr<UKControllerPlugin::Message::UserMessager> userMessager;
         std::unique_ptr<UKControllerPlugin::Euroscope::UserSetting> pluginUserSettingHandler;
@@ -203,9 +215,11 @@ namespace UKControllerPlugin::Bootstrap {
 
         // Collections of event handlers
         std::unique_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection> flightplanHandler;
+        std::shared_ptr<UKControllerPlugin::Flightplan::FlightplanSweep> flightplanSweep;
         std::unique_ptr<UKControllerPlugin::Controller::ControllerStatusEventHandlerCollection> controllerHandler;
         std::unique_ptr<UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection> radarTargetHandler;
         std::unique_ptr<UKControllerPlugin::TimedEvent::TimedEventCollection> timedHandler;
+        std::shared_ptr<UKControllerPlugin::TimedEvent::DeferredEventHandler> deferredEvents;
         std::unique_ptr<UKControllerPlugin::Tag::TagItemCollection> tagHandler;
         std::unique_ptr<UKControllerPlugin::Metar::MetarEventHandlerCollection> metarEventHandler;
         std::unique_ptr<UKControllerPlugin::RadarScreen::ScreenControls> screenControls;
@@ -218,6 +232,7 @@ namespace UKControllerPlugin::Bootstrap {
 
         // The plugin
         std::unique_ptr<UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface> plugin;
+        std::shared_ptr<UKControllerPlugin::Euroscope::WrapperAllocationCounter> wrapperAllocations;
 
         // The modules
         std::unique_ptr<ModuleFactories> moduleFactories;
@@ -236,6 +251,7 @@ namespace UKControllerPlugin::Bootstrap {
         std::unique_ptr<UKControllerPlugin::Hold::HoldDisplayFactory> holdDisplayFactory;
         std::shared_ptr<UKControllerPlugin::Notifications::NotificationsMenuItem> notificationsMenuItem;
         std::shared_ptr<UKControllerPlugin::Releases::DepartureReleaseEventHandler> departureReleaseHandler;
+        std::shared_ptr<UKControllerPlugin::State::PluginStateSnapshot> pluginState;
 
         // Collections that are spawned multiple times.
         std::vector<std::shared_ptr<UKControllerPlugin::RadarScreen::RadarRenderableCollection>> allRadarRenders;
@@ -264,6 +280,8 @@ namespace UKControllerPlugin::Bootstrap {
 
         // Push events
         std::shared_ptr<Push::PushEventProcessorCollection> pushEventProcessors;
+        std::shared_ptr<Push::SharedMemoryMapping> sharedPushEventMemory;
+        std::shared_ptr<Push::SharedSyncData> sharedPushSync;
 
         // Some factories
         std::unique_ptr<Aircraft::CallsignSelectionListFactory> callsignSelectionListFactory;
@@ -1,9 +1,11 @@
 #include "datablock/DatablockFunctions.h"
+#include "string/TextMatchers.h"
+
+using UKControllerPluginUtils::String::MatchFlightLevel;
 
 namespace UKControllerPlugin::Datablock {
 
     const int FREQUENCY_BUFFER_LENGTH = 8;
-    const std::regex flightLevelRegex("^(?:FL)?(\\d{2,3})$|^(\\d{4,5})$");
 
     int ConvertAltitudeToFlightLevel(int altitude)
     {
@@ -21,12 +23,13 @@ namespace UKControllerPlugin::Datablock {
         std::transform(level.begin(), level.end(), level.begin(), [](unsigned char c) { return std::toupper(c); });
 
         // Check for matches
-        std::smatch matches;
-        if (!std::regex_match(level, matches, flightLevelRegex)) {
+        const auto digits = MatchFlightLevel(level);
+        if (!digits) {
             return -1;
         }
 
-        int flightLevel = std::stoi(matches[1].str() != "" ? matches[1].str() : matches[2].str());
+        int flightLevel = 0;
+        std::from_chars(digits->data(), digits->data() + digits->size(), flightLevel);
 
         return flightLevel >= 1000 ? flightLevel / 100 : flightLevel;
     }
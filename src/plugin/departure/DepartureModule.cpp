@@ -9,11 +9,12 @@
 #include "euroscope/CallbackFunction.h"
 #include "eventhandler/EventBus.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
 #include "radarscreen/ConfigurableDisplayCollection.h"
 #include "radarscreen/RadarRenderableCollection.h"
-#include "timedevent/TimedEventCollection.h"
+#include "state/PluginStateSnapshot.h"
 
 using UKControllerPlugin::Euroscope::CallbackFunction;
 using UKControllerPluginUtils::EventHandler::EventBus;
@@ -24,9 +25,12 @@ namespace UKControllerPlugin::Departure {
     void BootstrapPlugin(const Bootstrap::PersistenceContainer& container)
     {
         // Create the departure monitor
-        const auto departureMonitor = std::make_shared<DepartureMonitor>(*container.login, *container.plugin);
+        const auto departureMonitor = std::make_shared<DepartureMonitor>(*container.login);
         container.flightplanHandler->RegisterHandler(departureMonitor);
-        container.timedHandler->RegisterEvent(departureMonitor, 10);
+        container.flightplanSweep->RegisterStage(departureMonitor, 10);
+        if (container.pluginState) {
+            container.pluginState->RegisterState(DepartureMonitor::stateKey, departureMonitor);
+        }
 
         // Create the user should clear departure data monitor
         EventBus::Bus().AddHandler<AircraftDepartedEvent>(
@@ -2,41 +2,40 @@
 #include "DepartureMonitor.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
-#include "euroscope/EuroscopePluginLoopbackInterface.h"
 #include "eventhandler/EventBus.h"
 #include "login/Login.h"
 
 namespace UKControllerPlugin::Departure {
 
-    DepartureMonitor::DepartureMonitor(
-        const Controller::Login& login, Euroscope::EuroscopePluginLoopbackInterface& plugin)
-        : login(login), plugin(plugin)
+    DepartureMonitor::DepartureMonitor(const Controller::Login& login) : login(login)
     {
     }
 
-    void DepartureMonitor::TimedEventTrigger()
+    auto DepartureMonitor::ShouldSweep() const -> bool
     {
         // Not logged in long enough
         if (login.GetSecondsLoggedIn() < std::chrono::seconds(10)) {
             LogInfo("Skipping departure monitor check as only just logged in");
-            return;
+            return false;
         }
 
-        plugin.ApplyFunctionToAllFlightplans([this](
-                                                 std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface> fp,
-                                                 std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface> rt) {
-            // You only depart once
-            if (alreadyDeparted.contains(fp->GetCallsign())) {
-                return;
-            }
+        return true;
+    }
 
-            if (HasDeparted(*fp, *rt)) {
-                alreadyDeparted.insert({fp->GetCallsign(), fp->GetOrigin()});
-                LogDebug("Firing AircraftDepartedEvent for " + fp->GetCallsign() + " at " + fp->GetOrigin());
-                UKControllerPluginUtils::EventHandler::EventBus::Bus().OnEvent<AircraftDepartedEvent>(
-                    {fp->GetCallsign(), fp->GetOrigin()});
-            }
-        });
+    void DepartureMonitor::SweepFlightplan(
+        Euroscope::EuroScopeCFlightPlanInterface& flightplan, Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        // You only depart once
+        if (alreadyDeparted.contains(flightplan.GetCallsign())) {
+            return;
+        }
+
+        if (HasDeparted(flightplan, radarTarget)) {
+            alreadyDeparted.insert({flightplan.GetCallsign(), flightplan.GetOrigin()});
+            LogDebug("Firing AircraftDepartedEvent for " + flightplan.GetCallsign() + " at " + flightplan.GetOrigin());
+            UKControllerPluginUtils::EventHandler::EventBus::Bus().OnEvent<AircraftDepartedEvent>(
+                {flightplan.GetCallsign(), flightplan.GetOrigin()});
+        }
     }
 
     auto DepartureMonitor::HasDeparted(
@@ -72,4 +71,26 @@ namespace UKControllerPlugin::Departure {
     {
         // No-op
     }
+
+    /*
+        Remember who's already departed, so we don't say they've departed again after a restart.
+    */
+    auto DepartureMonitor::SaveState() const -> nlohmann::json
+    {
+        return alreadyDeparted;
+    }
+
+    void DepartureMonitor::RestoreState(const nlohmann::json& state)
+    {
+        for (const auto& [callsign, origin] : state.items()) {
+            if (origin.is_string()) {
+                alreadyDeparted[callsign] = origin.get<std::string>();
+            }
+        }
+    }
+
+    void DepartureMonitor::ExpireRestoredState(const std::string& callsign)
+    {
+        alreadyDeparted.erase(callsign);
+    }
 } // namespace UKControllerPlugin::Departure
@@ -1,7 +1,8 @@
 #pragma once
 #include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "flightplan/FlightplanSweepStage.h"
 #include "message/UserMessager.h"
-#include "timedevent/AbstractTimedEvent.h"
+#include "state/PersistentStateInterface.h"
 
 namespace UKControllerPlugin {
     namespace Controller {
@@ -10,22 +11,32 @@ namespace UKControllerPlugin {
     namespace Euroscope {
         class EuroScopeCFlightPlanInterface;
         class EuroScopeCRadarTargetInterface;
-        class EuroscopePluginLoopbackInterface;
     } // namespace Euroscope
 } // namespace UKControllerPlugin
 
 namespace UKControllerPlugin::Departure {
 
-    class DepartureMonitor : public TimedEvent::AbstractTimedEvent, public Flightplan::FlightPlanEventHandlerInterface
+    class DepartureMonitor : public Flightplan::FlightplanSweepStage,
+                             public Flightplan::FlightPlanEventHandlerInterface,
+                             public State::PersistentStateInterface
     {
         public:
-        DepartureMonitor(const Controller::Login& login, Euroscope::EuroscopePluginLoopbackInterface& plugin);
-        void TimedEventTrigger() override;
+        explicit DepartureMonitor(const Controller::Login& login);
+        [[nodiscard]] auto ShouldSweep() const -> bool override;
+        void SweepFlightplan(
+            Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+            Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
         void FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightplan) override;
         void ControllerFlightPlanDataEvent(Euroscope::EuroScopeCFlightPlanInterface& flightplan, int dataType) override;
         void FlightPlanEvent(
             Euroscope::EuroScopeCFlightPlanInterface& flightPlan,
             Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
+        [[nodiscard]] auto SaveState() const -> nlohmann::json override;
+        void RestoreState(const nlohmann::json& state) override;
+        void ExpireRestoredState(const std::string& callsign) override;
+
+        // The key departed aircraft are saved under
+        inline static const std::string stateKey = "departures";
 
         private:
         [[nodiscard]] auto HasDeparted(
@@ -35,9 +46,6 @@ namespace UKControllerPlugin::Departure {
         // For checking controller logins
         const Controller::Login& login;
 
-        // Plugin
-        Euroscope::EuroscopePluginLoopbackInterface& plugin;
-
         // Already departed
         std::map<std::string, std::string> alreadyDeparted;
     };
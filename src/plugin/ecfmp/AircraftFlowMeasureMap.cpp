@@ -1,4 +1,5 @@
 #include "AircraftFlowMeasureMap.h"
+#include "FlowMeasureIndexKeys.h"
 #include "controller/ActiveCallsign.h"
 #include "ECFMP/flowmeasure/FlowMeasure.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
@@ -9,7 +10,10 @@ namespace UKControllerPlugin::ECFMP {
 
     struct AircraftFlowMeasureMap::Impl
     {
-        Impl(Euroscope::EuroscopePluginLoopbackInterface& plugin) : plugin(plugin)
+        Impl(
+            Euroscope::EuroscopePluginLoopbackInterface& plugin,
+            std::function<FlowMeasureIndexKeys(const ::ECFMP::FlowMeasure::FlowMeasure&)> indexKeys)
+            : plugin(plugin), indexKeys(std::move(indexKeys))
         {
         }
 
@@ -29,6 +33,11 @@ namespace UKControllerPlugin::ECFMP {
             callsignFlowMeasureMap.erase(flightplan.GetCallsign());
         }
 
+        void RemoveFlightplanFromIndex(Euroscope::EuroScopeCFlightPlanInterface& flightplan)
+        {
+            index.RemoveFlightplan(flightplan.GetCallsign());
+        }
+
         void RemoveFlowMeasureFromCollection(const ::ECFMP::FlowMeasure::FlowMeasure& measure)
         {
             // Measure never became active
@@ -46,6 +55,7 @@ namespace UKControllerPlugin::ECFMP {
             // Remove from the map by measure and id
             flowMeasureCallsignMap.erase(collectionMeasure);
             flowMeasureIdMap.erase(measure.Id());
+            index.RemoveMeasure(measure.Id());
         }
 
         void FlowMeasureActivated(const std::shared_ptr<const ::ECFMP::FlowMeasure::FlowMeasure>& measure)
@@ -60,28 +70,84 @@ namespace UKControllerPlugin::ECFMP {
 
             // Initialise the flow measure's callsign map
             flowMeasureCallsignMap.emplace(measure, std::unordered_set<std::string>());
+            index.AddMeasure(measure->Id(), indexKeys(*measure));
+
+            // If the measure can't be indexed, check each of the flightplans and see if it applies to them
+            if (!index.MeasureIsIndexed(measure->Id())) {
+                plugin.ApplyFunctionToAllFlightplans(
+                    [&measure, this](
+                        const Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+                        const Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
+                        MapFlightplanIfApplicable(measure, flightplan, radarTarget);
+                    });
+                return;
+            }
+
+            // Otherwise, only check the flightplans that it could apply to
+            IndexAllFlightplans();
+            const auto candidates = index.CandidateFlightplans(measure->Id());
+            if (candidates.empty()) {
+                return;
+            }
+
+            plugin.ApplyFunctionToAllFlightplans(
+                [&measure, &candidates, this](
+                    const Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+                    const Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
+                    if (candidates.contains(flightplan.GetCallsign())) {
+                        MapFlightplanIfApplicable(measure, flightplan, radarTarget);
+                    }
+                });
+        }
+
+        /*
+            The first time a measure is indexed, we need the keys of every flightplan. After that, flightplan
+            events keep them up to date.
+        */
+        void IndexAllFlightplans()
+        {
+            if (flightplansIndexed) {
+                return;
+            }
 
-            // Check each of the flightplans and see if it applies to them
-            plugin.ApplyFunctionToAllFlightplans([&measure, this](
+            index.RemoveAllFlightplans();
+            plugin.ApplyFunctionToAllFlightplans([this](
                                                      const Euroscope::EuroScopeCFlightPlanInterface& flightplan,
                                                      const Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
-                if (measure->ApplicableToAircraft(flightplan.GetEuroScopeObject(), radarTarget.GetEuroScopeObject())) {
-                    callsignFlowMeasureMap[flightplan.GetCallsign()].insert(measure);
-                    flowMeasureCallsignMap[measure].insert(flightplan.GetCallsign());
-                }
+                index.AddFlightplan(
+                    flightplan.GetCallsign(), FlowMeasureApplicabilityIndex::KeysForFlightplan(flightplan));
             });
+            flightplansIndexed = true;
+        }
+
+        void MapFlightplanIfApplicable(
+            const std::shared_ptr<const ::ECFMP::FlowMeasure::FlowMeasure>& measure,
+            const Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+            const Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
+        {
+            if (measure->ApplicableToAircraft(flightplan.GetEuroScopeObject(), radarTarget.GetEuroScopeObject())) {
+                callsignFlowMeasureMap[flightplan.GetCallsign()].insert(measure);
+                flowMeasureCallsignMap[measure].insert(flightplan.GetCallsign());
+            }
         }
 
         void MapFlightplanToActiveFlowMeasures(
             Euroscope::EuroScopeCFlightPlanInterface& flightPlan,
             Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
         {
-            for (const auto& [id, measure] : flowMeasureIdMap) {
-                if (measure->ApplicableToAircraft(flightPlan.GetEuroScopeObject(), radarTarget.GetEuroScopeObject())) {
-                    callsignFlowMeasureMap[flightPlan.GetCallsign()].insert(measure);
-                    flowMeasureCallsignMap[measure].insert(flightPlan.GetCallsign());
+            // Nothing is indexed, so every measure needs checking
+            if (!flightplansIndexed && !index.HasIndexedMeasures()) {
+                for (const auto& [id, measure] : flowMeasureIdMap) {
+                    MapFlightplanIfApplicable(measure, flightPlan, radarTarget);
                 }
+                return;
+            }
+
+            auto keys = FlowMeasureApplicabilityIndex::KeysForFlightplan(flightPlan);
+            for (const auto id : index.CandidateMeasures(keys)) {
+                MapFlightplanIfApplicable(flowMeasureIdMap.at(id), flightPlan, radarTarget);
             }
+            index.AddFlightplan(flightPlan.GetCallsign(), std::move(keys));
         }
 
         void ClearMaps()
@@ -89,11 +155,21 @@ namespace UKControllerPlugin::ECFMP {
             flowMeasureIdMap.clear();
             callsignFlowMeasureMap.clear();
             flowMeasureCallsignMap.clear();
+            index.RemoveAllMeasures();
         }
 
         // The plugin, used to map over flightplans
         Euroscope::EuroscopePluginLoopbackInterface& plugin;
 
+        // Precompiles a flow measure's filters into keys for the index
+        std::function<FlowMeasureIndexKeys(const ::ECFMP::FlowMeasure::FlowMeasure&)> indexKeys;
+
+        // Indexes flow measures and flightplans against each other, so we only check combinations that could apply
+        FlowMeasureApplicabilityIndex index;
+
+        // Whether every flightplan has been added to the index
+        bool flightplansIndexed = false;
+
         // Map of callsigns to flow measures and vice versa
         std::map<int, std::shared_ptr<const ::ECFMP::FlowMeasure::FlowMeasure>> flowMeasureIdMap;
         std::map<std::string, std::unordered_set<std::shared_ptr<const ::ECFMP::FlowMeasure::FlowMeasure>>>
@@ -106,7 +182,14 @@ namespace UKControllerPlugin::ECFMP {
     };
 
     AircraftFlowMeasureMap::AircraftFlowMeasureMap(Euroscope::EuroscopePluginLoopbackInterface& plugin)
-        : impl(std::make_unique<Impl>(plugin))
+        : AircraftFlowMeasureMap(plugin, BuildFlowMeasureIndexKeys)
+    {
+    }
+
+    AircraftFlowMeasureMap::AircraftFlowMeasureMap(
+        Euroscope::EuroscopePluginLoopbackInterface& plugin,
+        std::function<FlowMeasureIndexKeys(const ::ECFMP::FlowMeasure::FlowMeasure&)> indexKeys)
+        : impl(std::make_unique<Impl>(plugin, std::move(indexKeys)))
     {
     }
 
@@ -137,6 +220,7 @@ namespace UKControllerPlugin::ECFMP {
     void AircraftFlowMeasureMap::FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan)
     {
         impl->RemoveFlightplanFromCollection(flightPlan);
+        impl->RemoveFlightplanFromIndex(flightPlan);
     }
 
     const std::unordered_set<std::shared_ptr<const ::ECFMP::FlowMeasure::FlowMeasure>>&
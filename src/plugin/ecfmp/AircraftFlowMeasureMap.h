@@ -2,6 +2,7 @@
 #include "ECFMP/SdkEvents.h"
 #include "ECFMP/flowmeasure/FlowMeasure.h"
 #include "AircraftFlowMeasureMapInterface.h"
+#include "FlowMeasureApplicabilityIndex.h"
 #include "controller/ActiveCallsignEventHandlerInterface.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
@@ -20,6 +21,9 @@ namespace UKControllerPlugin::ECFMP {
     {
         public:
         AircraftFlowMeasureMap(Euroscope::EuroscopePluginLoopbackInterface& plugin);
+        AircraftFlowMeasureMap(
+            Euroscope::EuroscopePluginLoopbackInterface& plugin,
+            std::function<FlowMeasureIndexKeys(const ::ECFMP::FlowMeasure::FlowMeasure&)> indexKeys);
         ~AircraftFlowMeasureMap() override;
         void FlightPlanEvent(
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightPlan,
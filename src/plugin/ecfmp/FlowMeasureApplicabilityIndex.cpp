@@ -0,0 +1,404 @@
+#include "FlowMeasureApplicabilityIndex.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "euroscope/EuroscopeExtractedRouteInterface.h"
+
+namespace UKControllerPlugin::ECFMP {
+
+    void FlowMeasureApplicabilityIndex::AddMeasure(int id, FlowMeasureIndexKeys keys)
+    {
+        RemoveMeasure(id);
+
+        const auto dimension = IndexDimension(keys);
+        const auto& measure = this->measures.emplace(id, IndexedMeasure{std::move(keys), dimension}).first->second;
+        IndexMeasure(id, measure);
+    }
+
+    void FlowMeasureApplicabilityIndex::RemoveMeasure(int id)
+    {
+        const auto measure = this->measures.find(id);
+        if (measure == this->measures.cend()) {
+            return;
+        }
+
+        UnindexMeasure(id, measure->second);
+        this->measures.erase(measure);
+    }
+
+    void FlowMeasureApplicabilityIndex::RemoveAllMeasures()
+    {
+        this->measures.clear();
+        this->unindexedMeasures.clear();
+        this->measuresByDeparture.clear();
+        this->measuresByDeparturePrefix.clear();
+        this->measuresByArrival.clear();
+        this->measuresByArrivalPrefix.clear();
+        this->measuresByWaypoint.clear();
+        this->measuresByLevelBand.clear();
+    }
+
+    auto FlowMeasureApplicabilityIndex::MeasureIsIndexed(int id) const -> bool
+    {
+        const auto measure = this->measures.find(id);
+        return measure != this->measures.cend() && measure->second.dimension != Dimension::None;
+    }
+
+    auto FlowMeasureApplicabilityIndex::HasIndexedMeasures() const -> bool
+    {
+        return this->measures.size() != this->unindexedMeasures.size();
+    }
+
+    /*
+        Returns the ids of all the measures that could apply to the flightplan. Unindexed measures are
+        always returned.
+    */
+    auto FlowMeasureApplicabilityIndex::CandidateMeasures(const FlightplanIndexKeys& flightplan) const
+        -> std::set<int>
+    {
+        std::set<int> candidates;
+        AddCandidateMeasures(this->measuresByDeparture, flightplan.origin, candidates);
+        AddCandidateMeasuresByPrefix(this->measuresByDeparturePrefix, flightplan.origin, candidates);
+        AddCandidateMeasures(this->measuresByArrival, flightplan.destination, candidates);
+        AddCandidateMeasuresByPrefix(this->measuresByArrivalPrefix, flightplan.destination, candidates);
+        for (const auto& waypoint : flightplan.waypoints) {
+            AddCandidateMeasures(this->measuresByWaypoint, waypoint, candidates);
+        }
+
+        const auto levelBand = this->measuresByLevelBand.find(flightplan.levelBand);
+        if (levelBand != this->measuresByLevelBand.cend()) {
+            candidates.insert(levelBand->second.cbegin(), levelBand->second.cend());
+        }
+
+        // Candidates were only found on one dimension, so check the rest of their keys
+        std::erase_if(candidates, [this, &flightplan](int id) {
+            return !Matches(this->measures.at(id).keys, flightplan);
+        });
+
+        candidates.insert(this->unindexedMeasures.cbegin(), this->unindexedMeasures.cend());
+        return candidates;
+    }
+
+    void FlowMeasureApplicabilityIndex::AddFlightplan(const std::string& callsign, FlightplanIndexKeys keys)
+    {
+        RemoveFlightplan(callsign);
+        IndexFlightplan(callsign, this->flightplans.emplace(callsign, std::move(keys)).first->second);
+    }
+
+    void FlowMeasureApplicabilityIndex::RemoveFlightplan(const std::string& callsign)
+    {
+        const auto flightplan = this->flightplans.find(callsign);
+        if (flightplan == this->flightplans.cend()) {
+            return;
+        }
+
+        UnindexFlightplan(callsign, flightplan->second);
+        this->flightplans.erase(flightplan);
+    }
+
+    void FlowMeasureApplicabilityIndex::RemoveAllFlightplans()
+    {
+        this->flightplans.clear();
+        this->flightplansByOrigin.clear();
+        this->flightplansByDestination.clear();
+        this->flightplansByWaypoint.clear();
+        this->flightplansByLevelBand.clear();
+    }
+
+    /*
+        Returns the callsigns of all the indexed flightplans that the measure could apply to. Unindexed measures
+        could apply to any flightplan, so the caller needs to check those against everything.
+    */
+    auto FlowMeasureApplicabilityIndex::CandidateFlightplans(int id) const -> std::set<std::string>
+    {
+        std::set<std::string> candidates;
+        const auto measure = this->measures.find(id);
+        if (measure == this->measures.cend()) {
+            return candidates;
+        }
+
+        const auto& keys = measure->second.keys;
+        switch (measure->second.dimension) {
+            case Dimension::Departure:
+                for (const auto& airfield : keys.departureAirfields) {
+                    AddCandidateFlightplans(this->flightplansByOrigin, airfield, candidates);
+                }
+                break;
+            case Dimension::Arrival:
+                for (const auto& airfield : keys.arrivalAirfields) {
+                    AddCandidateFlightplans(this->flightplansByDestination, airfield, candidates);
+                }
+                break;
+            case Dimension::Waypoint:
+                for (const auto& waypoint : keys.waypoints) {
+                    AddCandidateFlightplans(this->flightplansByWaypoint, waypoint, candidates);
+                }
+                break;
+            case Dimension::Level:
+                for (const auto band : keys.levelBands) {
+                    const auto flightplans = this->flightplansByLevelBand.find(band);
+                    if (flightplans != this->flightplansByLevelBand.cend()) {
+                        candidates.insert(flightplans->second.cbegin(), flightplans->second.cend());
+                    }
+                }
+                break;
+            case Dimension::None:
+                break;
+        }
+
+        std::erase_if(candidates, [this, &keys](const std::string& callsign) {
+            return !Matches(keys, this->flightplans.at(callsign));
+        });
+
+        return candidates;
+    }
+
+    auto FlowMeasureApplicabilityIndex::Matches(
+        const FlowMeasureIndexKeys& measure, const FlightplanIndexKeys& flightplan) -> bool
+    {
+        const auto matchesAirfield = [](const std::set<std::string>& keys, const std::string& airfield) {
+            return keys.empty() || std::any_of(keys.cbegin(), keys.cend(), [&airfield](const std::string& key) {
+                       return AirfieldMatches(key, airfield);
+                   });
+        };
+
+        const auto matchesWaypoint = measure.waypoints.empty() ||
+                                     std::any_of(flightplan.waypoints.cbegin(),
+                                                 flightplan.waypoints.cend(),
+                                                 [&measure](const std::string& waypoint) {
+                                                     return measure.waypoints.contains(waypoint);
+                                                 });
+
+        return matchesAirfield(measure.departureAirfields, flightplan.origin) &&
+               matchesAirfield(measure.arrivalAirfields, flightplan.destination) &&
+               (measure.levelBands.empty() || measure.levelBands.contains(flightplan.levelBand)) && matchesWaypoint;
+    }
+
+    /*
+        Wildcard keys match any airfield that starts with the part before the first wildcard. This is never
+        narrower than ECFMP's own matching, which is all that the index needs.
+    */
+    auto FlowMeasureApplicabilityIndex::AirfieldMatches(const std::string& key, const std::string& airfield) -> bool
+    {
+        const auto wildcard = key.find(airfieldWildcard);
+        return wildcard == std::string::npos ? key == airfield : airfield.starts_with(key.substr(0, wildcard));
+    }
+
+    auto FlowMeasureApplicabilityIndex::LevelBand(int altitude) -> int
+    {
+        return std::clamp(altitude / 1000, 0, maxLevelBand);
+    }
+
+    auto FlowMeasureApplicabilityIndex::KeysForFlightplan(const Euroscope::EuroScopeCFlightPlanInterface& flightplan)
+        -> FlightplanIndexKeys
+    {
+        FlightplanIndexKeys keys{
+            flightplan.GetOrigin(), flightplan.GetDestination(), LevelBand(flightplan.GetCruiseLevel()), {}};
+
+        // Waypoints as filed, minus any speed and level changes
+        std::istringstream route(flightplan.GetRawRouteString());
+        std::string element;
+        while (route >> element) {
+            keys.waypoints.insert(element.substr(0, element.find('/')));
+        }
+
+        // Waypoints on airways, as EuroScope has extracted them
+        auto& extractedRoute = flightplan.GetExtractedRoute();
+        for (int i = 0; i < extractedRoute.GetPointsNumber(); i++) {
+            keys.waypoints.insert(extractedRoute.GetPointName(i));
+        }
+
+        return keys;
+    }
+
+    auto FlowMeasureApplicabilityIndex::IndexDimension(const FlowMeasureIndexKeys& keys) -> Dimension
+    {
+        if (!keys.departureAirfields.empty()) {
+            return Dimension::Departure;
+        }
+
+        if (!keys.arrivalAirfields.empty()) {
+            return Dimension::Arrival;
+        }
+
+        if (!keys.waypoints.empty()) {
+            return Dimension::Waypoint;
+        }
+
+        return keys.levelBands.empty() ? Dimension::None : Dimension::Level;
+    }
+
+    auto FlowMeasureApplicabilityIndex::WildcardPrefix(const std::string& key) -> std::string
+    {
+        return key.substr(0, key.find(airfieldWildcard));
+    }
+
+    void FlowMeasureApplicabilityIndex::IndexMeasure(int id, const IndexedMeasure& measure)
+    {
+        const auto indexAirfields = [id](
+                                        const std::set<std::string>& airfields,
+                                        std::map<std::string, std::set<int>>& exact,
+                                        std::map<std::string, std::set<int>>& prefixes) {
+            for (const auto& airfield : airfields) {
+                if (airfield.find(airfieldWildcard) == std::string::npos) {
+                    exact[airfield].insert(id);
+                } else {
+                    prefixes[WildcardPrefix(airfield)].insert(id);
+                }
+            }
+        };
+
+        switch (measure.dimension) {
+            case Dimension::Departure:
+                indexAirfields(
+                    measure.keys.departureAirfields, this->measuresByDeparture, this->measuresByDeparturePrefix);
+                break;
+            case Dimension::Arrival:
+                indexAirfields(measure.keys.arrivalAirfields, this->measuresByArrival, this->measuresByArrivalPrefix);
+                break;
+            case Dimension::Waypoint:
+                for (const auto& waypoint : measure.keys.waypoints) {
+                    this->measuresByWaypoint[waypoint].insert(id);
+                }
+                break;
+            case Dimension::Level:
+                for (const auto band : measure.keys.levelBands) {
+                    this->measuresByLevelBand[band].insert(id);
+                }
+                break;
+            case Dimension::None:
+                this->unindexedMeasures.insert(id);
+                break;
+        }
+    }
+
+    void FlowMeasureApplicabilityIndex::UnindexMeasure(int id, const IndexedMeasure& measure)
+    {
+        const auto unindex = [id](auto& index, const auto& key) {
+            const auto entry = index.find(key);
+            if (entry == index.end()) {
+                return;
+            }
+
+            entry->second.erase(id);
+            if (entry->second.empty()) {
+                index.erase(entry);
+            }
+        };
+
+        const auto unindexAirfields = [&unindex](
+                                          const std::set<std::string>& airfields,
+                                          std::map<std::string, std::set<int>>& exact,
+                                          std::map<std::string, std::set<int>>& prefixes) {
+            for (const auto& airfield : airfields) {
+                if (airfield.find(airfieldWildcard) == std::string::npos) {
+                    unindex(exact, airfield);
+                } else {
+                    unindex(prefixes, WildcardPrefix(airfield));
+                }
+            }
+        };
+
+        switch (measure.dimension) {
+            case Dimension::Departure:
+                unindexAirfields(
+                    measure.keys.departureAirfields, this->measuresByDeparture, this->measuresByDeparturePrefix);
+                break;
+            case Dimension::Arrival:
+                unindexAirfields(
+                    measure.keys.arrivalAirfields, this->measuresByArrival, this->measuresByArrivalPrefix);
+                break;
+            case Dimension::Waypoint:
+                for (const auto& waypoint : measure.keys.waypoints) {
+                    unindex(this->measuresByWaypoint, waypoint);
+                }
+                break;
+            case Dimension::Level:
+                for (const auto band : measure.keys.levelBands) {
+                    unindex(this->measuresByLevelBand, band);
+                }
+                break;
+            case Dimension::None:
+                this->unindexedMeasures.erase(id);
+                break;
+        }
+    }
+
+    void FlowMeasureApplicabilityIndex::AddCandidateMeasures(
+        const std::map<std::string, std::set<int>>& index, const std::string& key, std::set<int>& candidates)
+    {
+        const auto entry = index.find(key);
+        if (entry != index.cend()) {
+            candidates.insert(entry->second.cbegin(), entry->second.cend());
+        }
+    }
+
+    /*
+        Wildcard measures are indexed by their fixed prefix, so look up every prefix of the airfield.
+    */
+    void FlowMeasureApplicabilityIndex::AddCandidateMeasuresByPrefix(
+        const std::map<std::string, std::set<int>>& index, const std::string& key, std::set<int>& candidates)
+    {
+        if (index.empty()) {
+            return;
+        }
+
+        for (size_t length = 0; length <= key.size(); length++) {
+            AddCandidateMeasures(index, key.substr(0, length), candidates);
+        }
+    }
+
+    /*
+        Flightplans are indexed by their exact keys, so a wildcard key takes every flightplan whose key
+        starts with the fixed prefix.
+    */
+    void FlowMeasureApplicabilityIndex::AddCandidateFlightplans(
+        const std::map<std::string, std::set<std::string>>& index,
+        const std::string& key,
+        std::set<std::string>& candidates)
+    {
+        if (key.find(airfieldWildcard) == std::string::npos) {
+            const auto entry = index.find(key);
+            if (entry != index.cend()) {
+                candidates.insert(entry->second.cbegin(), entry->second.cend());
+            }
+            return;
+        }
+
+        const auto prefix = WildcardPrefix(key);
+        for (auto entry = index.lower_bound(prefix); entry != index.cend() && entry->first.starts_with(prefix);
+             ++entry) {
+            candidates.insert(entry->second.cbegin(), entry->second.cend());
+        }
+    }
+
+    void FlowMeasureApplicabilityIndex::IndexFlightplan(const std::string& callsign, const FlightplanIndexKeys& keys)
+    {
+        this->flightplansByOrigin[keys.origin].insert(callsign);
+        this->flightplansByDestination[keys.destination].insert(callsign);
+        this->flightplansByLevelBand[keys.levelBand].insert(callsign);
+        for (const auto& waypoint : keys.waypoints) {
+            this->flightplansByWaypoint[waypoint].insert(callsign);
+        }
+    }
+
+    void FlowMeasureApplicabilityIndex::UnindexFlightplan(const std::string& callsign, const FlightplanIndexKeys& keys)
+    {
+        const auto unindex = [&callsign](auto& index, const auto& key) {
+            const auto entry = index.find(key);
+            if (entry == index.end()) {
+                return;
+            }
+
+            entry->second.erase(callsign);
+            if (entry->second.empty()) {
+                index.erase(entry);
+            }
+        };
+
+        unindex(this->flightplansByOrigin, keys.origin);
+        unindex(this->flightplansByDestination, keys.destination);
+        unindex(this->flightplansByLevelBand, keys.levelBand);
+        for (const auto& waypoint : keys.waypoints) {
+            unindex(this->flightplansByWaypoint, waypoint);
+        }
+    }
+} // namespace UKControllerPlugin::ECFMP
@@ -0,0 +1,149 @@
+#pragma once
+
+namespace UKControllerPlugin::Euroscope {
+    class EuroScopeCFlightPlanInterface;
+} // namespace UKControllerPlugin::Euroscope
+
+namespace UKControllerPlugin::ECFMP {
+
+    /*
+        The keys that a flow measure's filters have been precompiled into. An aircraft can only be subject to
+        the measure if, for every dimension that has keys, it matches at least one of them. Dimensions without
+        keys place no restriction on the aircraft.
+
+        Keys must only ever be a superset of what the measure's filters accept - the measure itself always has
+        the final say on whether it applies.
+    */
+    using FlowMeasureIndexKeys = struct FlowMeasureIndexKeys
+    {
+        // The airfields the aircraft may depart from, which may contain wildcards e.g. EG**
+        std::set<std::string> departureAirfields;
+
+        // The airfields the aircraft may arrive at, which may contain wildcards e.g. EG**
+        std::set<std::string> arrivalAirfields;
+
+        // The cruise level bands, in thousands of feet, that the aircraft may be cruising in
+        std::set<int> levelBands;
+
+        // The waypoints, one of which the aircraft must be routing via
+        std::set<std::string> waypoints;
+    };
+
+    /*
+        The keys of a flightplan that are matched against those of flow measures.
+    */
+    using FlightplanIndexKeys = struct FlightplanIndexKeys
+    {
+        // The departure airfield
+        std::string origin;
+
+        // The arrival airfield
+        std::string destination;
+
+        // The cruise level band, in thousands of feet
+        int levelBand = 0;
+
+        // The waypoints on the aircraft's route
+        std::set<std::string> waypoints;
+    };
+
+    /*
+        Indexes active flow measures and flightplans against each other, so that when a flightplan changes
+        it only has to be checked against the flow measures that could possibly apply to it, and when a flow
+        measure activates, it only has to be checked against the flightplans it could possibly apply to.
+
+        Each measure is indexed on a single dimension, preferring departure airfields, then arrival airfields,
+        then waypoints and finally level bands. Candidates found via that dimension are then checked against
+        all of the measure's keys. Measures with no keys at all cannot be indexed and are a candidate for
+        every flightplan.
+    */
+    class FlowMeasureApplicabilityIndex
+    {
+        public:
+        void AddMeasure(int id, FlowMeasureIndexKeys keys);
+        void RemoveMeasure(int id);
+        void RemoveAllMeasures();
+        [[nodiscard]] auto MeasureIsIndexed(int id) const -> bool;
+        [[nodiscard]] auto HasIndexedMeasures() const -> bool;
+        [[nodiscard]] auto CandidateMeasures(const FlightplanIndexKeys& flightplan) const -> std::set<int>;
+        void AddFlightplan(const std::string& callsign, FlightplanIndexKeys keys);
+        void RemoveFlightplan(const std::string& callsign);
+        void RemoveAllFlightplans();
+        [[nodiscard]] auto CandidateFlightplans(int id) const -> std::set<std::string>;
+        [[nodiscard]] static auto Matches(const FlowMeasureIndexKeys& measure, const FlightplanIndexKeys& flightplan)
+            -> bool;
+        [[nodiscard]] static auto AirfieldMatches(const std::string& key, const std::string& airfield) -> bool;
+        [[nodiscard]] static auto LevelBand(int altitude) -> int;
+        [[nodiscard]] static auto KeysForFlightplan(const Euroscope::EuroScopeCFlightPlanInterface& flightplan)
+            -> FlightplanIndexKeys;
+
+        // The highest level band, anything cruising above this is considered to be in it
+        inline static const int maxLevelBand = 100;
+
+        // The character used by ECFMP to wildcard parts of an airfield code
+        inline static const char airfieldWildcard = '*';
+
+        private:
+        enum class Dimension
+        {
+            None,
+            Departure,
+            Arrival,
+            Waypoint,
+            Level
+        };
+
+        using IndexedMeasure = struct IndexedMeasure
+        {
+            // The keys for the measure
+            FlowMeasureIndexKeys keys;
+
+            // The dimension the measure is indexed on
+            Dimension dimension;
+        };
+
+        [[nodiscard]] static auto IndexDimension(const FlowMeasureIndexKeys& keys) -> Dimension;
+        [[nodiscard]] static auto WildcardPrefix(const std::string& key) -> std::string;
+        void IndexMeasure(int id, const IndexedMeasure& measure);
+        void UnindexMeasure(int id, const IndexedMeasure& measure);
+        static void AddCandidateMeasures(
+            const std::map<std::string, std::set<int>>& index, const std::string& key, std::set<int>& candidates);
+        static void AddCandidateMeasuresByPrefix(
+            const std::map<std::string, std::set<int>>& index, const std::string& key, std::set<int>& candidates);
+        static void AddCandidateFlightplans(
+            const std::map<std::string, std::set<std::string>>& index,
+            const std::string& key,
+            std::set<std::string>& candidates);
+        void IndexFlightplan(const std::string& callsign, const FlightplanIndexKeys& keys);
+        void UnindexFlightplan(const std::string& callsign, const FlightplanIndexKeys& keys);
+
+        // All the measures, by id
+        std::map<int, IndexedMeasure> measures;
+
+        // Measures that have no keys, so apply to everything
+        std::set<int> unindexedMeasures;
+
+        // Measures indexed by departure airfield, and by the fixed part of wildcard departure airfields
+        std::map<std::string, std::set<int>> measuresByDeparture;
+        std::map<std::string, std::set<int>> measuresByDeparturePrefix;
+
+        // Measures indexed by arrival airfield, and by the fixed part of wildcard arrival airfields
+        std::map<std::string, std::set<int>> measuresByArrival;
+        std::map<std::string, std::set<int>> measuresByArrivalPrefix;
+
+        // Measures indexed by waypoint
+        std::map<std::string, std::set<int>> measuresByWaypoint;
+
+        // Measures indexed by level band
+        std::map<int, std::set<int>> measuresByLevelBand;
+
+        // All the flightplans, by callsign
+        std::map<std::string, FlightplanIndexKeys> flightplans;
+
+        // Flightplans indexed by each of their keys
+        std::map<std::string, std::set<std::string>> flightplansByOrigin;
+        std::map<std::string, std::set<std::string>> flightplansByDestination;
+        std::map<std::string, std::set<std::string>> flightplansByWaypoint;
+        std::map<int, std::set<std::string>> flightplansByLevelBand;
+    };
+} // namespace UKControllerPlugin::ECFMP
@@ -0,0 +1,78 @@
+#include "FlowMeasureIndexKeys.h"
+#include "ECFMP/flowmeasure/AirportFilter.h"
+#include "ECFMP/flowmeasure/FlowMeasure.h"
+#include "ECFMP/flowmeasure/FlowMeasureFilters.h"
+#include "ECFMP/flowmeasure/LevelRangeFilter.h"
+#include "ECFMP/flowmeasure/MultipleLevelFilter.h"
+#include "ECFMP/flowmeasure/RouteFilter.h"
+
+namespace UKControllerPlugin::ECFMP {
+
+    namespace {
+        /*
+            Returns the level bands in which at least one level would pass the filter. Levels are only ever
+            whole flight levels, so checking each hundred feet of the band is enough.
+        */
+        template <typename Filter>
+        auto LevelBandsForFilter(const Filter& filter) -> std::set<int>
+        {
+            std::set<int> bands;
+            for (auto band = 0; band <= FlowMeasureApplicabilityIndex::maxLevelBand; band++) {
+                for (auto altitude = band * 1000; altitude < (band + 1) * 1000; altitude += 100) {
+                    if (filter.ApplicableToAltitude(altitude)) {
+                        bands.insert(band);
+                        break;
+                    }
+                }
+            }
+
+            return bands;
+        }
+    } // namespace
+
+    /*
+        Multiple filters of the same type must all pass for a measure to apply, so the keys from any one of them
+        are a superset of what the measure applies to. We take the first of each.
+    */
+    auto BuildFlowMeasureIndexKeys(const ::ECFMP::FlowMeasure::FlowMeasure& measure) -> FlowMeasureIndexKeys
+    {
+        FlowMeasureIndexKeys keys;
+        bool hasDepartureFilter = false;
+        bool hasArrivalFilter = false;
+        bool hasLevelFilter = false;
+        bool hasRouteFilter = false;
+
+        measure.Filters().ForEachAirportFilter([&](const ::ECFMP::FlowMeasure::AirportFilter& filter) {
+            if (filter.Type() == ::ECFMP::FlowMeasure::AirportFilterType::Departure && !hasDepartureFilter) {
+                keys.departureAirfields = filter.AirportStrings();
+                hasDepartureFilter = true;
+            } else if (filter.Type() == ::ECFMP::FlowMeasure::AirportFilterType::Destination && !hasArrivalFilter) {
+                keys.arrivalAirfields = filter.AirportStrings();
+                hasArrivalFilter = true;
+            }
+        });
+
+        measure.Filters().ForEachLevelFilter([&](const ::ECFMP::FlowMeasure::LevelRangeFilter& filter) {
+            if (!hasLevelFilter) {
+                keys.levelBands = LevelBandsForFilter(filter);
+                hasLevelFilter = true;
+            }
+        });
+
+        measure.Filters().ForEachMultipleLevelFilter([&](const ::ECFMP::FlowMeasure::MultipleLevelFilter& filter) {
+            if (!hasLevelFilter) {
+                keys.levelBands = LevelBandsForFilter(filter);
+                hasLevelFilter = true;
+            }
+        });
+
+        measure.Filters().ForEachRouteFilter([&](const ::ECFMP::FlowMeasure::RouteFilter& filter) {
+            if (!hasRouteFilter) {
+                keys.waypoints = filter.RouteStrings();
+                hasRouteFilter = true;
+            }
+        });
+
+        return keys;
+    }
+} // namespace UKControllerPlugin::ECFMP
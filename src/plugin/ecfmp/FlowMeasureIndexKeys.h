@@ -0,0 +1,11 @@
+#pragma once
+#include "FlowMeasureApplicabilityIndex.h"
+
+namespace ECFMP::FlowMeasure {
+    class FlowMeasure;
+} // namespace ECFMP::FlowMeasure
+
+namespace UKControllerPlugin::ECFMP {
+    [[nodiscard]] auto BuildFlowMeasureIndexKeys(const ::ECFMP::FlowMeasure::FlowMeasure& measure)
+        -> FlowMeasureIndexKeys;
+} // namespace UKControllerPlugin::ECFMP
@@ -39,6 +39,12 @@ namespace UKControllerPlugin {
             GetFlightplanForCallsign(std::string callsign) const = 0;
             virtual std::shared_ptr<EuroScopeCRadarTargetInterface>
             GetRadarTargetForCallsign(std::string callsign) const = 0;
+            virtual auto ApplyFunctionToFlightplan(
+                const std::string& callsign, const std::function<void(const EuroScopeCFlightPlanInterface&)>& function)
+                const -> bool = 0;
+            virtual auto ApplyFunctionToRadarTarget(
+                const std::string& callsign, const std::function<void(const EuroScopeCRadarTargetInterface&)>& function)
+                const -> bool = 0;
             virtual std::shared_ptr<EuroScopeCFlightPlanInterface> GetSelectedFlightplan() const = 0;
             virtual std::shared_ptr<EuroScopeCRadarTargetInterface> GetSelectedRadarTarget() const = 0;
             virtual void TriggerPopupList(RECT area, std::string title, int numColumns) = 0;
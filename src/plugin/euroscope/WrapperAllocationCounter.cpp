@@ -0,0 +1,45 @@
+#include "WrapperAllocationCounter.h"
+
+namespace UKControllerPlugin::Euroscope {
+
+    WrapperAllocationCounter::WrapperAllocationCounter()
+        : WrapperAllocationCounter([]() { return std::chrono::steady_clock::now(); })
+    {
+    }
+
+    WrapperAllocationCounter::WrapperAllocationCounter(Clock clock)
+        : clock(std::move(clock)), lastSample(this->clock())
+    {
+    }
+
+    void WrapperAllocationCounter::Allocated()
+    {
+        this->allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto WrapperAllocationCounter::TotalAllocations() const -> uint64_t
+    {
+        return this->allocations.load(std::memory_order_relaxed);
+    }
+
+    auto WrapperAllocationCounter::AllocationsPerSecond() const -> double
+    {
+        return this->allocationsPerSecond;
+    }
+
+    void WrapperAllocationCounter::TimedEventTrigger()
+    {
+        const auto now = this->clock();
+        const auto total = this->TotalAllocations();
+        const auto elapsed = std::chrono::duration<double>(now - this->lastSample).count();
+        if (elapsed <= 0.0) {
+            return;
+        }
+
+        this->allocationsPerSecond = static_cast<double>(total - this->allocationsAtLastSample) / elapsed;
+        this->allocationsAtLastSample = total;
+        this->lastSample = now;
+
+        LogDebug("EuroScope wrapper allocations per second: " + std::to_string(this->allocationsPerSecond));
+    }
+} // namespace UKControllerPlugin::Euroscope
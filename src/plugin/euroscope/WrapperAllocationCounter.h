@@ -0,0 +1,39 @@
+#pragma once
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPlugin::Euroscope {
+
+    /*
+        Counts how many EuroScope flightplan and radar target wrappers we put on the heap, so that the
+        cost of looking up aircraft can be measured. Every time it is triggered, it works out the rate
+        of allocations per second since the last time and logs it.
+    */
+    class WrapperAllocationCounter : public TimedEvent::AbstractTimedEvent
+    {
+        public:
+        using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+        WrapperAllocationCounter();
+        explicit WrapperAllocationCounter(Clock clock);
+        void Allocated();
+        [[nodiscard]] auto TotalAllocations() const -> uint64_t;
+        [[nodiscard]] auto AllocationsPerSecond() const -> double;
+        void TimedEventTrigger() override;
+
+        private:
+        // Tells us the time
+        Clock clock;
+
+        // All the allocations we've counted
+        std::atomic<uint64_t> allocations = 0;
+
+        // How many allocations there had been when we last worked out the rate
+        uint64_t allocationsAtLastSample = 0;
+
+        // When we last worked out the rate
+        std::chrono::steady_clock::time_point lastSample;
+
+        // The rate, as of the last sample
+        double allocationsPerSecond = 0.0;
+    };
+} // namespace UKControllerPlugin::Euroscope
@@ -1,6 +1,8 @@
 #include "FlightplanStorageBootstrap.h"
+#include "FlightplanSweep.h"
 #include "StoredFlightplanEventHandler.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "state/PluginStateSnapshot.h"
 #include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
@@ -9,14 +11,21 @@ using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
 namespace UKControllerPlugin::Flightplan {
 
     /*
-        Bootstraps the event handler surrounding storage of flightplans.
+        Bootstraps the event handler surrounding storage of flightplans, and the sweep
+        that periodically checks every flightplan. Timed out plans are removed by the
+        shared timeout wheel.
     */
-    void FlightplanStorageBootstrap::BootstrapPlugin(const PersistenceContainer& container)
+    void FlightplanStorageBootstrap::BootstrapPlugin(PersistenceContainer& container)
     {
         std::shared_ptr<StoredFlightplanEventHandler> handler =
             std::make_shared<StoredFlightplanEventHandler>(*container.flightplans);
 
         container.flightplanHandler->RegisterHandler(handler);
-        container.timedHandler->RegisterEvent(handler, FlightplanStorageBootstrap::timedEventFrequency);
+        if (container.pluginState) {
+            container.pluginState->RegisterState(StoredFlightplanEventHandler::stateKey, handler);
+        }
+
+        container.flightplanSweep = std::make_shared<FlightplanSweep>(*container.plugin);
+        container.timedHandler->RegisterEvent(container.flightplanSweep, FlightplanStorageBootstrap::sweepFrequency);
     }
 } // namespace UKControllerPlugin::Flightplan
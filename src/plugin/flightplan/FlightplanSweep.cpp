@@ -0,0 +1,61 @@
+#include "FlightplanSweep.h"
+#include "FlightplanSweepStage.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "euroscope/EuroScopeCRadarTargetInterface.h"
+#include "euroscope/EuroscopePluginLoopbackInterface.h"
+
+namespace UKControllerPlugin::Flightplan {
+
+    FlightplanSweep::FlightplanSweep(Euroscope::EuroscopePluginLoopbackInterface& plugin) : plugin(plugin)
+    {
+    }
+
+    auto FlightplanSweep::CountStages() const -> size_t
+    {
+        return this->stages.size();
+    }
+
+    auto FlightplanSweep::CountStagesForFrequency(int frequency) const -> size_t
+    {
+        return std::count_if(this->stages.cbegin(), this->stages.cend(), [frequency](const RegisteredStage& stage) {
+            return stage.frequency == frequency;
+        });
+    }
+
+    void FlightplanSweep::RegisterStage(std::shared_ptr<FlightplanSweepStage> stage, int frequency)
+    {
+        if (frequency < 1) {
+            LogWarning("Flightplan sweep stage registered with invalid frequency " + std::to_string(frequency));
+            return;
+        }
+
+        this->stages.push_back({std::move(stage), frequency});
+    }
+
+    /*
+        Works out which stages are due, and if any of them want to run, walks the flightplans once and
+        passes each one to those stages in the order they were registered.
+    */
+    void FlightplanSweep::TimedEventTrigger()
+    {
+        this->dueStages.clear();
+        for (const auto& stage : this->stages) {
+            if (this->sweeps % stage.frequency == 0 && stage.stage->ShouldSweep()) {
+                this->dueStages.push_back(stage.stage.get());
+            }
+        }
+        this->sweeps++;
+
+        if (this->dueStages.empty()) {
+            return;
+        }
+
+        this->plugin.ApplyFunctionToAllFlightplans(
+            [this](Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+                   Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
+                for (auto* stage : this->dueStages) {
+                    stage->SweepFlightplan(flightplan, radarTarget);
+                }
+            });
+    }
+} // namespace UKControllerPlugin::Flightplan
@@ -0,0 +1,51 @@
+#pragma once
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPlugin::Euroscope {
+    class EuroscopePluginLoopbackInterface;
+} // namespace UKControllerPlugin::Euroscope
+
+namespace UKControllerPlugin::Flightplan {
+    class FlightplanSweepStage;
+
+    /*
+        Periodically walks all the flightplans once and passes each aircraft to every registered stage
+        that is due, so modules that need to check every aircraft share one loop over EuroScope and one
+        pair of wrappers per aircraft.
+
+        Each stage has a frequency, in seconds, and every stage runs on sweeps that are a multiple of it. Stages
+        with the same frequency, or frequencies that divide one another, therefore land on the same sweep and
+        share a single walk of the flightplans.
+    */
+    class FlightplanSweep : public TimedEvent::AbstractTimedEvent
+    {
+        public:
+        explicit FlightplanSweep(Euroscope::EuroscopePluginLoopbackInterface& plugin);
+        [[nodiscard]] auto CountStages() const -> size_t;
+        [[nodiscard]] auto CountStagesForFrequency(int frequency) const -> size_t;
+        void RegisterStage(std::shared_ptr<FlightplanSweepStage> stage, int frequency);
+        void TimedEventTrigger() override;
+
+        private:
+        using RegisteredStage = struct RegisteredStage
+        {
+            // The stage
+            std::shared_ptr<FlightplanSweepStage> stage;
+
+            // How often the stage runs
+            int frequency;
+        };
+
+        // For walking the flightplans
+        Euroscope::EuroscopePluginLoopbackInterface& plugin;
+
+        // All the registered stages
+        std::vector<RegisteredStage> stages;
+
+        // The stages due on the current sweep, kept between sweeps so we don't reallocate every time
+        std::vector<FlightplanSweepStage*> dueStages;
+
+        // How many times we've been triggered
+        int sweeps = 0;
+    };
+} // namespace UKControllerPlugin::Flightplan
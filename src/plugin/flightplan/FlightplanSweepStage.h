@@ -0,0 +1,33 @@
+#pragma once
+
+namespace UKControllerPlugin::Euroscope {
+    class EuroScopeCFlightPlanInterface;
+    class EuroScopeCRadarTargetInterface;
+} // namespace UKControllerPlugin::Euroscope
+
+namespace UKControllerPlugin::Flightplan {
+
+    /*
+        A stage of the periodic sweep over all the flightplans. Rather than each module walking the
+        flightplans for itself, stages are registered with the FlightplanSweep, which walks them once
+        and hands each aircraft to every stage that is due.
+    */
+    class FlightplanSweepStage
+    {
+        public:
+        virtual ~FlightplanSweepStage() = default;
+
+        /*
+            Called once before each sweep that the stage is due for. Returning false skips the stage
+            for that sweep, for example if the user isn't active.
+        */
+        [[nodiscard]] virtual auto ShouldSweep() const -> bool
+        {
+            return true;
+        }
+
+        virtual void SweepFlightplan(
+            Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+            Euroscope::EuroScopeCRadarTargetInterface& radarTarget) = 0;
+    };
+} // namespace UKControllerPlugin::Flightplan
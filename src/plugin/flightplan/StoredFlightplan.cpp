@@ -12,19 +12,7 @@ namespace UKControllerPlugin::Flightplan {
         const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& euroscopePlan)
         : timeout(defaultTime)
     {
-        this->callsign = euroscopePlan.GetCallsign();
-        this->origin = euroscopePlan.GetOrigin();
-        this->destination = euroscopePlan.GetDestination();
-        this->assignedSquawk =
-            euroscopePlan.HasAssignedSquawk() ? euroscopePlan.GetAssignedSquawk() : StoredFlightplan::noSquawkAllocated;
-        std::chrono::system_clock::time_point edt =
-            HelperFunctions::GetTimeFromNumberString(euroscopePlan.GetExpectedDepartureTime());
-
-        if (edt != (std::chrono::system_clock::time_point::max)()) {
-            this->expectedOffBlockTime = edt - std::chrono::minutes(EDT_MINUTES);
-        } else {
-            this->expectedOffBlockTime = edt;
-        }
+        this->Refresh(euroscopePlan);
     }
 
     StoredFlightplan::StoredFlightplan(std::string callsign, std::string origin, std::string destination)
@@ -151,6 +139,14 @@ namespace UKControllerPlugin::Flightplan {
         this->estimatedDepartureTime = time;
     }
 
+    /*
+        Set the expected off block time
+    */
+    void StoredFlightplan::SetExpectedOffBlockTime(std::chrono::system_clock::time_point time)
+    {
+        this->expectedOffBlockTime = time;
+    }
+
     /*
         Sets the origin.
     */
@@ -175,6 +171,34 @@ namespace UKControllerPlugin::Flightplan {
         this->timeout = time(nullptr) + offset;
     }
 
+    /*
+        Returns true if the flightplan has a timeout set.
+    */
+    auto StoredFlightplan::HasTimeout() const -> bool
+    {
+        return this->timeout != UKControllerPlugin::Flightplan::StoredFlightplan::defaultTime;
+    }
+
+    /*
+        Updates the details that come from EuroScope, keeping everything we've worked out locally.
+    */
+    void StoredFlightplan::Refresh(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& euroscopePlan)
+    {
+        this->callsign = euroscopePlan.GetCallsign();
+        this->origin = euroscopePlan.GetOrigin();
+        this->destination = euroscopePlan.GetDestination();
+        this->assignedSquawk =
+            euroscopePlan.HasAssignedSquawk() ? euroscopePlan.GetAssignedSquawk() : StoredFlightplan::noSquawkAllocated;
+        std::chrono::system_clock::time_point edt =
+            HelperFunctions::GetTimeFromNumberString(euroscopePlan.GetExpectedDepartureTime());
+
+        if (edt != (std::chrono::system_clock::time_point::max)()) {
+            this->expectedOffBlockTime = edt - std::chrono::minutes(EDT_MINUTES);
+        } else {
+            this->expectedOffBlockTime = edt;
+        }
+    }
+
     /*
         Unsets the timeout.
     */
@@ -31,15 +31,18 @@ namespace UKControllerPlugin::Flightplan {
         [[nodiscard]] auto GetPreviouslyAssignedSquawk() const -> std::string;
         [[nodiscard]] auto GetTimeout() const -> std::time_t;
         [[nodiscard]] auto HasPreviouslyAssignedSquawk() const -> bool;
+        [[nodiscard]] auto HasTimeout() const -> bool;
         [[nodiscard]] auto HasTimedOut() const -> bool;
         void SetActualOffBlockTime(std::chrono::system_clock::time_point time);
         void SetCallsign(std::string callsign);
         void SetDestination(std::string destination);
         void SetEstimatedDepartureTime(std::chrono::system_clock::time_point time);
+        void SetExpectedOffBlockTime(std::chrono::system_clock::time_point time);
         void SetOrigin(std::string origin);
         void SetPreviouslyAssignedSquawk(std::string squawk);
         void SetTimeout(int offset);
         void ResetTimeout();
+        void Refresh(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& euroscopePlan);
         auto operator==(const StoredFlightplan& compare) const -> bool;
         auto operator==(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& compare) const -> bool;
         auto operator!=(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& compare) const -> bool;
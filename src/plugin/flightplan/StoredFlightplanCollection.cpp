@@ -6,10 +6,31 @@
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Flightplan::StoredFlightplan;
+using UKControllerPlugin::TimedEvent::TimeoutWheel;
 
 namespace UKControllerPlugin {
     namespace Flightplan {
 
+        StoredFlightplanCollection::StoredFlightplanCollection()
+            : StoredFlightplanCollection(std::make_shared<TimeoutWheel>())
+        {
+        }
+
+        StoredFlightplanCollection::StoredFlightplanCollection(std::shared_ptr<TimeoutWheel> timeouts)
+            : timeouts(std::move(timeouts))
+        {
+        }
+
+        /*
+            The wheel may outlive us, so don't leave anything on it that points back here.
+        */
+        StoredFlightplanCollection::~StoredFlightplanCollection()
+        {
+            for (const auto& [callsign, timeout] : this->scheduledTimeouts) {
+                static_cast<void>(this->timeouts->Cancel(timeout));
+            }
+        }
+
         StoredFlightplan& StoredFlightplanCollection::GetFlightplanForCallsign(std::string callsign) const
         {
             if (!this->HasFlightplanForCallsign(callsign)) {
@@ -36,24 +57,32 @@ namespace UKControllerPlugin {
             std::map<std::string, std::unique_ptr<StoredFlightplan>>::iterator plan = this->flightplans.find(callsign);
 
             if (plan != this->flightplans.end()) {
+                this->CancelTimeout(callsign);
                 this->flightplans.erase(plan);
             }
         }
 
         /*
-            Removes all plans that are deemed to have timed out.
+            Removes all plans that are deemed to have timed out. When the wheel is shared, it's also advanced
+            by whoever owns it.
         */
         void StoredFlightplanCollection::RemoveTimedOutPlans()
         {
-            for (std::map<std::string, std::unique_ptr<StoredFlightplan>>::iterator it = this->flightplans.begin();
-                 it != this->flightplans.end();) {
-                if (it->second->HasTimedOut()) {
-                    LogDebug("Stored flightplan for " + it->second->GetCallsign() + " has timed out");
-                    this->flightplans.erase(it++);
-                } else {
-                    ++it;
-                }
+            this->timeouts->Advance(TimeoutWheel::Clock::now());
+        }
+
+        /*
+            Sets a plan to time out after the given number of seconds.
+        */
+        void StoredFlightplanCollection::SetPlanTimeout(const std::string& callsign, int offset)
+        {
+            const auto plan = this->flightplans.find(callsign);
+            if (plan == this->flightplans.cend()) {
+                return;
             }
+
+            plan->second->SetTimeout(offset);
+            this->ScheduleTimeout(*plan->second);
         }
 
         /*
@@ -64,10 +93,81 @@ namespace UKControllerPlugin {
             if (!this->HasFlightplanForCallsign(flightplan.GetCallsign())) {
                 LogDebug("Now tracking flightplan data for " + flightplan.GetCallsign());
                 this->flightplans[flightplan.GetCallsign()] = std::make_unique<StoredFlightplan>(flightplan);
+            } else {
+                *this->flightplans[flightplan.GetCallsign()] = flightplan;
+            }
+
+            this->ScheduleTimeout(flightplan);
+        }
+
+        /*
+            Updates a plan in place from EuroScope, or adds it if it doesn't exist. As EuroScope
+            still has the plan, it no longer times out.
+        */
+        void StoredFlightplanCollection::UpdatePlan(const EuroScopeCFlightPlanInterface& euroscopePlan)
+        {
+            auto callsign = euroscopePlan.GetCallsign();
+            const auto plan = this->flightplans.find(callsign);
+            if (plan == this->flightplans.end()) {
+                LogDebug("Now tracking flightplan data for " + callsign);
+                this->flightplans.emplace(std::move(callsign), std::make_unique<StoredFlightplan>(euroscopePlan));
+                return;
+            }
+
+            plan->second->Refresh(euroscopePlan);
+            if (plan->second->HasTimeout()) {
+                plan->second->ResetTimeout();
+                this->CancelTimeout(callsign);
+            }
+        }
+
+        void StoredFlightplanCollection::CancelTimeout(const std::string& callsign)
+        {
+            const auto scheduled = this->scheduledTimeouts.find(callsign);
+            if (scheduled == this->scheduledTimeouts.cend()) {
+                return;
+            }
+
+            static_cast<void>(this->timeouts->Cancel(scheduled->second));
+            this->scheduledTimeouts.erase(scheduled);
+        }
+
+        /*
+            Schedule the plan to be checked just after its timeout passes.
+        */
+        void StoredFlightplanCollection::ScheduleTimeout(const StoredFlightplan& flightplan)
+        {
+            this->CancelTimeout(flightplan.GetCallsign());
+            if (!flightplan.HasTimeout()) {
+                return;
+            }
+
+            const auto callsign = flightplan.GetCallsign();
+            this->scheduledTimeouts[callsign] = this->timeouts->Schedule(
+                TimeoutWheel::Clock::now(),
+                std::chrono::seconds(flightplan.GetTimeout() - time(nullptr) + 1),
+                [this, callsign]() { this->TimeoutExpired(callsign); });
+        }
+
+        /*
+            The timeout is against the wall clock and the wheel runs on a monotonic one, so if the two
+            have drifted apart the plan gets rescheduled rather than removed early.
+        */
+        void StoredFlightplanCollection::TimeoutExpired(const std::string& callsign)
+        {
+            this->scheduledTimeouts.erase(callsign);
+            const auto plan = this->flightplans.find(callsign);
+            if (plan == this->flightplans.end()) {
+                return;
+            }
+
+            if (!plan->second->HasTimedOut()) {
+                this->ScheduleTimeout(*plan->second);
                 return;
             }
 
-            *this->flightplans[flightplan.GetCallsign()] = flightplan;
+            LogDebug("Stored flightplan for " + callsign + " has timed out");
+            this->flightplans.erase(plan);
         }
     } // namespace Flightplan
 } // namespace UKControllerPlugin
@@ -1,12 +1,20 @@
 #pragma once
 #include "flightplan/StoredFlightplan.h"
+#include "timedevent/TimeoutWheel.h"
 
 namespace UKControllerPlugin {
+    namespace Euroscope {
+        class EuroScopeCFlightPlanInterface;
+    } // namespace Euroscope
+
     namespace Flightplan {
 
         /*
             A collection of (local) flightplan objects. Also provides functions
             as to when the flightplan is to be invalidated.
+
+            Plans with a timeout are scheduled on a timing wheel, so removing timed out
+            plans only has to look at the plans that are actually expiring.
         */
         class StoredFlightplanCollection
         {
@@ -33,15 +41,34 @@ namespace UKControllerPlugin {
                 return flightplans.cend();
             }
 
+            StoredFlightplanCollection();
+            explicit StoredFlightplanCollection(std::shared_ptr<UKControllerPlugin::TimedEvent::TimeoutWheel> timeouts);
+            ~StoredFlightplanCollection();
+            StoredFlightplanCollection(const StoredFlightplanCollection&) = delete;
+            StoredFlightplanCollection(StoredFlightplanCollection&&) = delete;
+            StoredFlightplanCollection& operator=(const StoredFlightplanCollection&) = delete;
+            StoredFlightplanCollection& operator=(StoredFlightplanCollection&&) = delete;
             UKControllerPlugin::Flightplan::StoredFlightplan& GetFlightplanForCallsign(std::string callsign) const;
             bool HasFlightplanForCallsign(std::string callsign) const;
             void RemoveTimedOutPlans(void);
             void RemovePlanByCallsign(std::string callsign);
+            void SetPlanTimeout(const std::string& callsign, int offset);
             void UpdatePlan(StoredFlightplan flightplan);
+            void UpdatePlan(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& euroscopePlan);
 
             private:
+            void CancelTimeout(const std::string& callsign);
+            void ScheduleTimeout(const StoredFlightplan& flightplan);
+            void TimeoutExpired(const std::string& callsign);
+
             // Storage for the flightplans - plus iterators
             FlightplanMap flightplans;
+
+            // When plans are due to time out
+            std::shared_ptr<UKControllerPlugin::TimedEvent::TimeoutWheel> timeouts;
+
+            // The scheduled timeout for each plan that has one
+            std::map<std::string, UKControllerPlugin::TimedEvent::TimeoutWheel::TimeoutId> scheduledTimeouts;
         };
 
     } // namespace Flightplan
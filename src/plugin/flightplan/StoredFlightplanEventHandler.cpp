@@ -27,10 +27,7 @@ namespace UKControllerPlugin {
         void StoredFlightplanEventHandler::FlightPlanEvent(
             EuroScopeCFlightPlanInterface& euroscopeFlightplan, EuroScopeCRadarTargetInterface& radarTarget)
         {
-            this->storedFlightplans.UpdatePlan(StoredFlightplan(euroscopeFlightplan));
-
-            // Reset anything to do with timeout.
-            this->storedFlightplans.GetFlightplanForCallsign(euroscopeFlightplan.GetCallsign()).ResetTimeout();
+            this->storedFlightplans.UpdatePlan(euroscopeFlightplan);
         }
 
         /*
@@ -38,21 +35,92 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplanEventHandler::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface& euroscopeFlightplan)
         {
-            if (!this->storedFlightplans.HasFlightplanForCallsign(euroscopeFlightplan.GetCallsign())) {
+            this->storedFlightplans.SetPlanTimeout(euroscopeFlightplan.GetCallsign(), this->flightplanTimeout);
+        }
+
+        /*
+            Save the stored flightplans, so that after a restart we still know things like which squawks
+            we've assigned.
+        */
+        auto StoredFlightplanEventHandler::SaveState() const -> nlohmann::json
+        {
+            nlohmann::json state = nlohmann::json::object();
+            for (auto plan = this->storedFlightplans.cbegin(); plan != this->storedFlightplans.cend(); ++plan) {
+                state[plan->first] = {
+                    {"origin", plan->second->GetOrigin()},
+                    {"destination", plan->second->GetDestination()},
+                    {"squawk", plan->second->GetPreviouslyAssignedSquawk()},
+                    {"timeout", plan->second->GetTimeout()},
+                    {"expected_off_block", TimeToJson(plan->second->GetExpectedOffBlockTime())},
+                    {"estimated_departure", TimeToJson(plan->second->GetEstimatedDepartureTime())},
+                    {"actual_off_block", TimeToJson(plan->second->GetActualOffBlockTime())},
+                };
+            }
+
+            return state;
+        }
+
+        void StoredFlightplanEventHandler::RestoreState(const nlohmann::json& state)
+        {
+            for (const auto& [callsign, plan] : state.items()) {
+                if (!plan.is_object() || !plan.contains("origin") || !plan.at("origin").is_string() ||
+                    !plan.contains("destination") || !plan.at("destination").is_string() ||
+                    !plan.contains("squawk") || !plan.at("squawk").is_string() || !plan.contains("timeout") ||
+                    !plan.at("timeout").is_number_integer()) {
+                    LogWarning("Invalid saved flightplan for " + callsign);
+                    continue;
+                }
+
+                StoredFlightplan storedPlan(
+                    callsign, plan.at("origin").get<std::string>(), plan.at("destination").get<std::string>());
+                storedPlan.SetPreviouslyAssignedSquawk(plan.at("squawk").get<std::string>());
+                storedPlan.SetExpectedOffBlockTime(TimeFromJson(plan.value("expected_off_block", nlohmann::json())));
+                storedPlan.SetEstimatedDepartureTime(TimeFromJson(plan.value("estimated_departure", nlohmann::json())));
+                storedPlan.SetActualOffBlockTime(TimeFromJson(plan.value("actual_off_block", nlohmann::json())));
+
+                // Only plans that have disconnected have a timeout
+                const auto timeout = plan.at("timeout").get<std::time_t>();
+                if (timeout > 0) {
+                    storedPlan.SetTimeout(static_cast<int>(timeout - time(nullptr)));
+                }
+
+                this->storedFlightplans.UpdatePlan(storedPlan);
+            }
+        }
+
+        /*
+            A restored plan that never reappears is treated as having disconnected.
+        */
+        void StoredFlightplanEventHandler::ExpireRestoredState(const std::string& callsign)
+        {
+            if (!this->storedFlightplans.HasFlightplanForCallsign(callsign) ||
+                this->storedFlightplans.GetFlightplanForCallsign(callsign).HasTimeout()) {
                 return;
             }
 
-            this->storedFlightplans.GetFlightplanForCallsign(euroscopeFlightplan.GetCallsign())
-                .SetTimeout(this->flightplanTimeout);
+            this->storedFlightplans.SetPlanTimeout(callsign, this->flightplanTimeout);
         }
 
         /*
-            When the timed event triggers, remove any flightplans that are deemed to have timed out from
-            storage.
+            Times that aren't set are saved as null.
         */
-        void StoredFlightplanEventHandler::TimedEventTrigger(void)
+        auto StoredFlightplanEventHandler::TimeToJson(std::chrono::system_clock::time_point time) -> nlohmann::json
         {
-            this->storedFlightplans.RemoveTimedOutPlans();
+            if (time == (std::chrono::system_clock::time_point::max)()) {
+                return nullptr;
+            }
+
+            return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+        }
+
+        auto StoredFlightplanEventHandler::TimeFromJson(const nlohmann::json& json)
+            -> std::chrono::system_clock::time_point
+        {
+            if (!json.is_number_integer()) {
+                return (std::chrono::system_clock::time_point::max)();
+            }
+
+            return std::chrono::system_clock::time_point(std::chrono::seconds(json.get<int64_t>()));
         }
     } // namespace Flightplan
 } // namespace UKControllerPlugin
@@ -1,6 +1,6 @@
 #pragma once
-#include "timedevent/AbstractTimedEvent.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "state/PersistentStateInterface.h"
 
 namespace UKControllerPlugin {
     namespace Euroscope {
@@ -17,10 +17,11 @@ namespace UKControllerPlugin {
 
         /*
             A class for processing events in relations to flightplan details
-            that have been stored in the plugin.
+            that have been stored in the plugin. Plans are timed out on the shared
+            timeout wheel, so there's nothing to do here on a timer.
         */
         class StoredFlightplanEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
-                                             public UKControllerPlugin::TimedEvent::AbstractTimedEvent
+                                             public UKControllerPlugin::State::PersistentStateInterface
         {
             public:
             explicit StoredFlightplanEventHandler(
@@ -32,9 +33,17 @@ namespace UKControllerPlugin {
                 UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface& radarTarget);
             void FlightPlanDisconnectEvent(
                 UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& euroscopeFlightplan);
-            void TimedEventTrigger(void);
+            [[nodiscard]] auto SaveState() const -> nlohmann::json override;
+            void RestoreState(const nlohmann::json& state) override;
+            void ExpireRestoredState(const std::string& callsign) override;
+
+            // The key stored flightplans are saved under between restarts
+            inline static const std::string stateKey = "flightplans";
 
             private:
+            [[nodiscard]] static auto TimeToJson(std::chrono::system_clock::time_point time) -> nlohmann::json;
+            [[nodiscard]] static auto TimeFromJson(const nlohmann::json& json) -> std::chrono::system_clock::time_point;
+
             // Stored flightplans
             UKControllerPlugin::Flightplan::StoredFlightplanCollection& storedFlightplans;
 
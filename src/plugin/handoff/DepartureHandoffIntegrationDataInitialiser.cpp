@@ -25,9 +25,9 @@ namespace UKControllerPlugin::Handoff {
     void DepartureHandoffIntegrationDataInitialiser::Initialise(const Integration::IntegrationClient& client)
     {
         plugin.ApplyFunctionToAllFlightplans([this, &client](
-                                                 const std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface>& fp,
-                                                 const std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface>& rt) {
-            auto resolved = resolver->Resolve(*fp);
+                                                 const Euroscope::EuroScopeCFlightPlanInterface& fp,
+                                                 const Euroscope::EuroScopeCRadarTargetInterface& rt) {
+            auto resolved = resolver->Resolve(fp);
             if (resolved) {
                 client.Connection()->Send(std::make_shared<HandoffFrequencyUpdatedMessage>(
                     resolved->callsign,
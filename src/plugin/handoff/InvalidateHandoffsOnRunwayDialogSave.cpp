@@ -18,10 +18,10 @@ namespace UKControllerPlugin::Handoff {
     void InvalidateHandoffsOnRunwayDialogSave::RunwayDialogSaved()
     {
         plugin.ApplyFunctionToAllFlightplans([this](
-                                                 const std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface>& fp,
-                                                 const std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface>& rt) {
-            resolver->Invalidate(*fp);
-            static_cast<void>(resolver->Resolve(*fp));
+                                                 const Euroscope::EuroScopeCFlightPlanInterface& fp,
+                                                 const Euroscope::EuroScopeCRadarTargetInterface& rt) {
+            resolver->Invalidate(fp);
+            static_cast<void>(resolver->Resolve(fp));
         });
     }
 } // namespace UKControllerPlugin::Handoff
@@ -263,12 +263,14 @@ namespace UKControllerPlugin::HistoryTrail {
         int roundNumber;
         // Loop through the history trails.
 
-        std::shared_ptr<EuroScopeCRadarTargetInterface> radarTarget;
+        int flightLevel = 0;
         for (const auto& aircraft : trails.trailData) {
             // Check the radar target exists
             const auto& callsign = aircraft->GetCallsign();
-            radarTarget = this->plugin.GetRadarTargetForCallsign(callsign);
-            if (!radarTarget) {
+            if (!this->plugin.ApplyFunctionToRadarTarget(
+                    callsign, [&flightLevel](const EuroScopeCRadarTargetInterface& radarTarget) {
+                        flightLevel = radarTarget.GetFlightLevel();
+                    })) {
                 continue;
             }
 
@@ -277,8 +279,7 @@ namespace UKControllerPlugin::HistoryTrail {
             // trail.
             if (trail.size() < 2 || radarScreen.GetGroundspeedForCallsign(callsign) < this->minimumSpeed ||
                 radarScreen.PositionOffScreen(aircraft->GetTrail().rbegin()->position) ||
-                radarTarget->GetFlightLevel() < this->minimumDisplayAltitude ||
-                radarTarget->GetFlightLevel() > this->maximumDisplayAltitude) {
+                flightLevel < this->minimumDisplayAltitude || flightLevel > this->maximumDisplayAltitude) {
                 continue;
             }
 
@@ -20,9 +20,9 @@ namespace UKControllerPlugin::Hold {
 
         this->plugin.ApplyFunctionToAllFlightplans(
             [&callsigns, &holdingAircraft](
-                const std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface>& fp,
-                const std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface>& rt) {
-                if (!fp->IsTrackedByUser()) {
+                const Euroscope::EuroScopeCFlightPlanInterface& fp,
+                const Euroscope::EuroScopeCRadarTargetInterface& rt) {
+                if (!fp.IsTrackedByUser()) {
                     return;
                 }
 
@@ -30,14 +30,14 @@ namespace UKControllerPlugin::Hold {
                                                 holdingAircraft.cbegin(),
                                                 holdingAircraft.cend(),
                                                 [&fp](const std::shared_ptr<HoldingAircraft>& aircraft) -> bool {
-                                                    return aircraft->GetCallsign() == fp->GetCallsign();
+                                                    return aircraft->GetCallsign() == fp.GetCallsign();
                                                 }) != holdingAircraft.cend();
 
                 if (aircraftInHold) {
                     return;
                 }
 
-                callsigns.insert(fp->GetCallsign());
+                callsigns.insert(fp.GetCallsign());
             });
 
         return callsigns;
@@ -2,6 +2,7 @@
 #include "HoldManager.h"
 #include "ProximityHold.h"
 #include "navaids/NavaidCollection.h"
+#include "push/SharedSyncData.h"
 #include "api/ApiRequestFactory.h"
 #include "time/ParseTimeStrings.h"
 
@@ -24,20 +25,45 @@ namespace UKControllerPlugin::Hold {
         return {{Push::PushEventSubscription::SUB_TYPE_EVENT, "hold.area-entered"}};
     }
 
+    /*
+        Use the aircraft another EuroScope instance has shared if we can, otherwise load them from the API
+        and share them.
+    */
     void AircraftEnteredHoldingAreaEventHandler::PluginEventsSynced()
     {
-        ApiRequest().Get("hold/proximity").Then([this](const UKControllerPluginUtils::Api::Response response) {
-            if (!response.Data().is_array()) {
-                LogWarning("Aircraft holding proximity sync data invalid");
+        if (this->sharedSync) {
+            if (const auto shared = this->sharedSync->Get(sharedSyncKey)) {
+                ProcessSyncData(*shared);
                 return;
             }
+        }
 
-            for (const auto& item : response.Data()) {
-                ProcessData(item);
+        ApiRequest().Get("hold/proximity").Then([this](const UKControllerPluginUtils::Api::Response response) {
+            if (this->sharedSync) {
+                this->sharedSync->Publish(sharedSyncKey, response.Data());
             }
+
+            ProcessSyncData(response.Data());
         });
     }
 
+    void AircraftEnteredHoldingAreaEventHandler::SetSharedSyncData(std::shared_ptr<Push::SharedSyncData> sharedSync)
+    {
+        this->sharedSync = std::move(sharedSync);
+    }
+
+    void AircraftEnteredHoldingAreaEventHandler::ProcessSyncData(const nlohmann::json& data) const
+    {
+        if (!data.is_array()) {
+            LogWarning("Aircraft holding proximity sync data invalid");
+            return;
+        }
+
+        for (const auto& item : data) {
+            ProcessData(item);
+        }
+    }
+
     void AircraftEnteredHoldingAreaEventHandler::ProcessData(const nlohmann::json& data) const
     {
         if (!DataValid(data)) {
@@ -5,6 +5,10 @@ namespace UKControllerPlugin::Navaids {
     class NavaidCollection;
 } // namespace UKControllerPlugin::Navaids
 
+namespace UKControllerPlugin::Push {
+    class SharedSyncData;
+} // namespace UKControllerPlugin::Push
+
 namespace UKControllerPlugin::Hold {
     class HoldManager;
 
@@ -15,8 +19,13 @@ namespace UKControllerPlugin::Hold {
         void ProcessPushEvent(const Push::PushEvent& message) override;
         [[nodiscard]] auto GetPushEventSubscriptions() const -> std::set<Push::PushEventSubscription> override;
         void PluginEventsSynced() override;
+        void SetSharedSyncData(std::shared_ptr<Push::SharedSyncData> sharedSync);
+
+        // The key aircraft in holding areas are shared between EuroScope instances under
+        inline static const std::string sharedSyncKey = "hold-proximity";
 
         private:
+        void ProcessSyncData(const nlohmann::json& data) const;
         void ProcessData(const nlohmann::json& data) const;
         [[nodiscard]] auto DataValid(const nlohmann::json& data) const -> bool;
 
@@ -25,5 +34,8 @@ namespace UKControllerPlugin::Hold {
 
         // All the navaids
         const Navaids::NavaidCollection& navaids;
+
+        // Shares aircraft in holding areas with other EuroScope instances, if set
+        std::shared_ptr<Push::SharedSyncData> sharedSync;
     };
 } // namespace UKControllerPlugin::Hold
@@ -2,22 +2,24 @@
 #include "HoldManager.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
+#include "string/TextMatchers.h"
+
+using UKControllerPluginUtils::String::MatchHoldCommand;
+using UKControllerPluginUtils::String::MatchNoholdCommand;
 
 namespace UKControllerPlugin::Hold {
 
     AssignHoldCommand::AssignHoldCommand(HoldManager& holdManager, Euroscope::EuroscopePluginLoopbackInterface& plugin)
-        : holdManager(holdManager), plugin(plugin), noholdRegex("^\\.ukcp nohold( ([A-Za-z0-9\\-_]+))?$"),
-          holdRegex("^\\.ukcp hold ([A-Za-z]+)( ([A-Za-z0-9\\-_]+))?$")
+        : holdManager(holdManager), plugin(plugin)
     {
     }
 
     auto AssignHoldCommand::ProcessCommand(std::string command) -> bool
     {
-        std::smatch regexMatches;
-        if (std::regex_match(command, regexMatches, noholdRegex)) {
+        if (const auto nohold = MatchNoholdCommand(command)) {
             std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface> flightplan =
-                regexMatches[2].matched ? plugin.GetFlightplanForCallsign(regexMatches[2].str())
-                                        : plugin.GetSelectedFlightplan();
+                !nohold->empty() ? plugin.GetFlightplanForCallsign(std::string(*nohold))
+                                 : plugin.GetSelectedFlightplan();
 
             if (!flightplan) {
                 LogInfo("Tried to remove aircraft from hold but flightplan not found");
@@ -28,10 +30,10 @@ namespace UKControllerPlugin::Hold {
             return true;
         }
 
-        if (std::regex_match(command, regexMatches, holdRegex)) {
+        if (const auto hold = MatchHoldCommand(command)) {
 
             std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface> flightplan =
-                regexMatches[3].matched ? plugin.GetFlightplanForCallsign(regexMatches[3].str())
+                !hold->callsign.empty() ? plugin.GetFlightplanForCallsign(std::string(hold->callsign))
                                         : plugin.GetSelectedFlightplan();
 
             if (!flightplan) {
@@ -39,7 +41,7 @@ namespace UKControllerPlugin::Hold {
                 return false;
             }
 
-            holdManager.AssignAircraftToHold(flightplan->GetCallsign(), regexMatches[1].str(), true);
+            holdManager.AssignAircraftToHold(flightplan->GetCallsign(), std::string(hold->hold), true);
             return true;
         }
 
@@ -23,11 +23,5 @@ namespace UKControllerPlugin::Hold {
 
         // The plugin
         Euroscope::EuroscopePluginLoopbackInterface& plugin;
-
-        // The command regex for unassigning the hold
-        std::regex noholdRegex;
-
-        // The command for adding aircraft to a hold
-        std::regex holdRegex;
     };
 } // namespace UKControllerPlugin::Hold
@@ -418,10 +418,11 @@ namespace UKControllerPlugin {
             const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraftAtLevel) const
         {
             // Make sure there's a radar target for the aircraft we're checking.
-            std::shared_ptr<EuroScopeCRadarTargetInterface> aircraftRadarTarget =
-                this->plugin.GetRadarTargetForCallsign(aircraft->GetCallsign());
-
-            if (!aircraftRadarTarget) {
+            EuroScopePlugIn::CPosition aircraftPosition;
+            if (!this->plugin.ApplyFunctionToRadarTarget(
+                    aircraft->GetCallsign(), [&aircraftPosition](const EuroScopeCRadarTargetInterface& radarTarget) {
+                        aircraftPosition = radarTarget.GetPosition();
+                    })) {
                 return false;
             }
 
@@ -429,22 +430,26 @@ namespace UKControllerPlugin {
             return std::find_if(
                        aircraftAtLevel.cbegin(),
                        aircraftAtLevel.cend(),
-                       [&level, &aircraftRadarTarget, &aircraft, this](
+                       [&level, &aircraftPosition, &aircraft, this](
                            const std::shared_ptr<HoldingAircraft>& conflictingAircraft) -> bool {
-                           std::shared_ptr<EuroScopeCRadarTargetInterface> conflictingRadarTarget =
-                               this->plugin.GetRadarTargetForCallsign(conflictingAircraft->GetCallsign());
+                           EuroScopePlugIn::CPosition conflictingPosition;
+                           const bool hasConflictingRadarTarget = this->plugin.ApplyFunctionToRadarTarget(
+                               conflictingAircraft->GetCallsign(),
+                               [&conflictingPosition](const EuroScopeCRadarTargetInterface& radarTarget) {
+                                   conflictingPosition = radarTarget.GetPosition();
+                               });
 
                            /*
                             * 1. Check that the conflicting aircraft has a radar target
                             * 2. Check that the conflicting aircraft is actually assigned to hold here
                             * 3. Check each of the published holds at this fix
                             */
-                           return conflictingRadarTarget != nullptr &&
+                           return hasConflictingRadarTarget &&
                                   this->AircraftAssignedToHold(conflictingAircraft) &&
                                   std::find_if(
                                       this->publishedHolds.cbegin(),
                                       this->publishedHolds.cend(),
-                                      [this, &level, &conflictingRadarTarget, &aircraft, &aircraftRadarTarget](
+                                      [this, &level, &conflictingPosition, &aircraft, &aircraftPosition](
                                           const HoldingData* const publishedHold) -> bool {
                                           /*
                                            * 3a. Make sure that the level the aircraft are at is within the published
@@ -457,8 +462,8 @@ namespace UKControllerPlugin {
                                                      [this,
                                                       &level,
                                                       &aircraft,
-                                                      &aircraftRadarTarget,
-                                                      &conflictingRadarTarget](
+                                                      &aircraftPosition,
+                                                      &conflictingPosition](
                                                          const std::unique_ptr<DeemedSeparatedHold>&
                                                              deemedSeparatedHold) -> bool {
                                                          const HoldingData& publishedSeparatedHold =
@@ -478,8 +483,7 @@ namespace UKControllerPlugin {
                                                                 publishedSeparatedHold.LevelWithinHold(level) &&
                                                                 aircraft->GetAssignedHold() ==
                                                                     publishedSeparatedHold.fix &&
-                                                                aircraftRadarTarget->GetPosition().DistanceTo(
-                                                                    conflictingRadarTarget->GetPosition()) >
+                                                                aircraftPosition.DistanceTo(conflictingPosition) >
                                                                     deemedSeparatedHold->vslInsertDistance;
                                                      }) != publishedHold->deemedSeparatedHolds.cend();
                                       }) != publishedHolds.cend();
@@ -503,17 +507,18 @@ namespace UKControllerPlugin {
             const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraft) const
         {
             std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>> levelMap;
-            std::shared_ptr<EuroScopeCRadarTargetInterface> rt;
+            int occupied = 0;
 
             for (auto it = aircraft.cbegin(); it != aircraft.cend(); ++it) {
                 // Check for the radar target
-                rt = this->plugin.GetRadarTargetForCallsign((*it)->GetCallsign());
-                if (!rt) {
+                if (!this->plugin.ApplyFunctionToRadarTarget(
+                        (*it)->GetCallsign(), [&occupied](const EuroScopeCRadarTargetInterface& radarTarget) {
+                            occupied = GetOccupiedLevel(radarTarget.GetFlightLevel(), radarTarget.GetVerticalSpeed());
+                        })) {
                     continue;
                 }
 
                 // If the aircraft is above the displaying levels of the hold, dont map
-                int occupied = GetOccupiedLevel(rt->GetFlightLevel(), rt->GetVerticalSpeed());
                 if (occupied > this->maximumLevel || occupied < this->minimumLevel) {
                     continue;
                 }
@@ -935,8 +940,10 @@ namespace UKControllerPlugin {
                         holdingAircraft.at(level);
                     int aircraftIndex = 0;
 
-                    std::shared_ptr<EuroScopeCRadarTargetInterface> rt;
-                    std::shared_ptr<EuroScopeCFlightPlanInterface> fp;
+                    EuroScopePlugIn::CPosition position;
+                    int flightLevel = 0;
+                    int verticalSpeed = 0;
+                    int clearedAltitude = 0;
 
                     // We have holding aircraft to deal with, render them in
                     for (std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>::const_iterator it =
@@ -953,11 +960,20 @@ namespace UKControllerPlugin {
                             graphics.DrawString(GetLevelDisplayString(level), numbersDisplay, this->titleBarTextBrush);
                         }
 
-                        rt = this->plugin.GetRadarTargetForCallsign((*it)->GetCallsign());
-                        fp = this->plugin.GetFlightplanForCallsign((*it)->GetCallsign());
-
-                        if (fp && rt) {
-                            if (rt->GetPosition().DistanceTo(this->navaid.coordinates) < this->sameLevelBoxDistance) {
+                        const bool hasRadarTarget = this->plugin.ApplyFunctionToRadarTarget(
+                            (*it)->GetCallsign(),
+                            [&position, &flightLevel, &verticalSpeed](const EuroScopeCRadarTargetInterface& rt) {
+                                position = rt.GetPosition();
+                                flightLevel = rt.GetFlightLevel();
+                                verticalSpeed = rt.GetVerticalSpeed();
+                            });
+                        const bool hasFlightplan = this->plugin.ApplyFunctionToFlightplan(
+                            (*it)->GetCallsign(), [&clearedAltitude](const EuroScopeCFlightPlanInterface& fp) {
+                                clearedAltitude = fp.GetClearedAltitude();
+                            });
+
+                        if (hasFlightplan && hasRadarTarget) {
+                            if (position.DistanceTo(this->navaid.coordinates) < this->sameLevelBoxDistance) {
                                 aircraftInProximity = true;
                             }
 
@@ -966,7 +982,7 @@ namespace UKControllerPlugin {
                             graphics.DrawString(callsign, callsignDisplay, this->dataBrush);
                             radarScreen.RegisterScreenObject(
                                 screenObjectId,
-                                this->navaid.identifier + "/callsign/" + fp->GetCallsign(),
+                                this->navaid.identifier + "/callsign/" + (*it)->GetCallsign(),
                                 {callsignDisplay.X,
                                  callsignDisplay.Y,
                                  callsignDisplay.X + callsignDisplay.Width,
@@ -975,13 +991,13 @@ namespace UKControllerPlugin {
 
                             // Reported level
                             graphics.DrawString(
-                                GetLevelDisplayString(rt->GetFlightLevel()), actualLevelDisplay, this->dataBrush);
-                            if (GetVerticalSpeedDirection(rt->GetVerticalSpeed()) == 1) {
+                                GetLevelDisplayString(flightLevel), actualLevelDisplay, this->dataBrush);
+                            if (GetVerticalSpeedDirection(verticalSpeed) == 1) {
                                 graphics.DrawLine(
                                     this->verticalSpeedAscentPen,
                                     verticalSpeedArrowDisplayStart,
                                     verticalSpeedArrowDisplayEnd);
-                            } else if (GetVerticalSpeedDirection(rt->GetVerticalSpeed()) == -1) {
+                            } else if (GetVerticalSpeedDirection(verticalSpeed) == -1) {
                                 graphics.DrawLine(
                                     this->verticalSpeedDescentPen,
                                     verticalSpeedArrowDisplayStart,
@@ -990,13 +1006,12 @@ namespace UKControllerPlugin {
 
                             // Cleared level - plus a clickspot for the aircraft in question
                             graphics.DrawString(
-                                fp->GetClearedAltitude() == 0 ? L"---"
-                                                              : GetLevelDisplayString(fp->GetClearedAltitude()),
+                                clearedAltitude == 0 ? L"---" : GetLevelDisplayString(clearedAltitude),
                                 clearedLevelDisplay,
                                 this->clearedLevelBrush);
                             radarScreen.RegisterScreenObject(
                                 screenObjectId,
-                                this->navaid.identifier + "/cleared/" + fp->GetCallsign(),
+                                this->navaid.identifier + "/cleared/" + (*it)->GetCallsign(),
                                 {clearedLevelDisplay.X,
                                  clearedLevelDisplay.Y,
                                  clearedLevelDisplay.X + clearedLevelDisplay.Width,
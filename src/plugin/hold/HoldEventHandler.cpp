@@ -4,18 +4,15 @@
 #include "ProximityHold.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
-#include "euroscope/EuroscopePluginLoopbackInterface.h"
 #include "euroscope/EuroscopeSectorFileElementInterface.h"
 #include "navaids/NavaidCollection.h"
 #include "tag/TagData.h"
 
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
-using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 using UKControllerPlugin::Euroscope::EuroscopeSectorFileElementInterface;
 using UKControllerPlugin::Hold::HoldManager;
 using UKControllerPlugin::Navaids::NavaidCollection;
-using UKControllerPlugin::Plugin::PopupMenuItem;
 using UKControllerPlugin::Push::PushEvent;
 using UKControllerPlugin::Push::PushEventSubscription;
 using UKControllerPlugin::Tag::TagData;
@@ -23,8 +20,8 @@ using UKControllerPlugin::Tag::TagData;
 namespace UKControllerPlugin::Hold {
 
     HoldEventHandler::HoldEventHandler(
-        HoldManager& holdManager, const NavaidCollection& navaids, EuroscopePluginLoopbackInterface& plugin)
-        : navaids(navaids), plugin(plugin), holdManager(holdManager)
+        HoldManager& holdManager, const NavaidCollection& navaids)
+        : navaids(navaids), holdManager(holdManager)
     {
     }
 
@@ -50,28 +47,25 @@ namespace UKControllerPlugin::Hold {
         }
     }
 
-    void HoldEventHandler::TimedEventTrigger()
+    void HoldEventHandler::SweepFlightplan(
+        EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget)
     {
-        this->plugin.ApplyFunctionToAllFlightplans([this](
-                                                       const std::shared_ptr<EuroScopeCFlightPlanInterface>& fp,
-                                                       const std::shared_ptr<EuroScopeCRadarTargetInterface>& rt) {
-            for (auto navaids = this->navaids.cbegin(); navaids != this->navaids.cend(); ++navaids) {
-                if (rt->GetPosition().DistanceTo(navaids->coordinates) <= this->proximityDistance) {
-                    this->holdManager.AddAircraftToProximityHold(
-                        std::make_shared<ProximityHold>(fp->GetCallsign(), navaids->identifier));
+        for (auto navaids = this->navaids.cbegin(); navaids != this->navaids.cend(); ++navaids) {
+            if (radarTarget.GetPosition().DistanceTo(navaids->coordinates) <= this->proximityDistance) {
+                this->holdManager.AddAircraftToProximityHold(
+                    std::make_shared<ProximityHold>(flightplan.GetCallsign(), navaids->identifier));
 
-                    if (rt->GetPosition().DistanceTo(navaids->coordinates) <= this->enterDistance) {
-                        auto proximity = this->holdManager.GetHoldingAircraft(fp->GetCallsign())
-                                             ->GetProximityHold(navaids->identifier);
-                        if (!proximity->HasEntered()) {
-                            proximity->Enter();
-                        }
+                if (radarTarget.GetPosition().DistanceTo(navaids->coordinates) <= this->enterDistance) {
+                    auto proximity = this->holdManager.GetHoldingAircraft(flightplan.GetCallsign())
+                                         ->GetProximityHold(navaids->identifier);
+                    if (!proximity->HasEntered()) {
+                        proximity->Enter();
                     }
-                } else {
-                    this->holdManager.RemoveAircraftFromProximityHold(fp->GetCallsign(), navaids->identifier);
                 }
+            } else {
+                this->holdManager.RemoveAircraftFromProximityHold(flightplan.GetCallsign(), navaids->identifier);
             }
-        });
+        }
     }
 
     void HoldEventHandler::ProcessPushEvent(const PushEvent& message)
@@ -97,4 +91,40 @@ namespace UKControllerPlugin::Hold {
     {
         return {{PushEventSubscription::SUB_TYPE_CHANNEL, "private-hold-assignments"}};
     }
+
+    auto HoldEventHandler::SaveState() const -> nlohmann::json
+    {
+        return this->holdManager.GetAssignedHolds();
+    }
+
+    /*
+        Put aircraft back in the holds they were assigned, the API already knows about them.
+    */
+    void HoldEventHandler::RestoreState(const nlohmann::json& state)
+    {
+        for (const auto& [callsign, hold] : state.items()) {
+            if (hold.is_string()) {
+                this->holdManager.AssignAircraftToHold(callsign, hold.get<std::string>(), false);
+                this->restoredHolds[callsign] = hold.get<std::string>();
+            }
+        }
+    }
+
+    /*
+        Only drop the hold if it's still the one we restored, a controller may have assigned another since.
+    */
+    void HoldEventHandler::ExpireRestoredState(const std::string& callsign)
+    {
+        const auto restored = this->restoredHolds.find(callsign);
+        if (restored == this->restoredHolds.cend()) {
+            return;
+        }
+
+        const auto& holding = this->holdManager.GetHoldingAircraft(callsign);
+        if (holding != nullptr && holding->GetAssignedHold() == restored->second) {
+            this->holdManager.UnassignAircraftFromHold(callsign, false);
+        }
+
+        this->restoredHolds.erase(restored);
+    }
 } // namespace UKControllerPlugin::Hold
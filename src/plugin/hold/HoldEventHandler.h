@@ -1,12 +1,10 @@
 #pragma once
+#include "flightplan/FlightplanSweepStage.h"
 #include "push/PushEventProcessorInterface.h"
+#include "state/PersistentStateInterface.h"
 #include "tag/TagItemInterface.h"
-#include "timedevent/AbstractTimedEvent.h"
 
 namespace UKControllerPlugin {
-    namespace Euroscope {
-        class EuroscopePluginLoopbackInterface;
-    } // namespace Euroscope
     namespace Hold {
         class HoldManager;
     } // namespace Hold
@@ -22,33 +20,40 @@ namespace UKControllerPlugin::Hold {
         update of holding data.
     */
     class HoldEventHandler : public UKControllerPlugin::Tag::TagItemInterface,
-                             public UKControllerPlugin::TimedEvent::AbstractTimedEvent,
-                             public Push::PushEventProcessorInterface
+                             public Flightplan::FlightplanSweepStage,
+                             public Push::PushEventProcessorInterface,
+                             public State::PersistentStateInterface
     {
         public:
         HoldEventHandler(
             UKControllerPlugin::Hold::HoldManager& holdManager,
-            const UKControllerPlugin::Navaids::NavaidCollection& navaids,
-            UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface& plugin);
+            const UKControllerPlugin::Navaids::NavaidCollection& navaids);
 
         // Inherited via TagItemInterface
         [[nodiscard]] auto GetTagItemDescription(int tagItemId) const -> std::string override;
         void SetTagItemData(UKControllerPlugin::Tag::TagData& tagData) override;
 
-        // Inherited via AbstractTimedEvent
-        void TimedEventTrigger() override;
+        // Inherited via FlightplanSweepStage
+        void SweepFlightplan(
+            Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+            Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
 
         // Inherited via WebsocketEventProcessorInterface
         void ProcessPushEvent(const Push::PushEvent& message) override;
         [[nodiscard]] auto GetPushEventSubscriptions() const -> std::set<Push::PushEventSubscription> override;
 
+        // Inherited via PersistentStateInterface
+        [[nodiscard]] auto SaveState() const -> nlohmann::json override;
+        void RestoreState(const nlohmann::json& state) override;
+        void ExpireRestoredState(const std::string& callsign) override;
+
+        // The key assigned holds are saved under between restarts
+        inline static const std::string stateKey = "assigned-holds";
+
         private:
         // Navaids against which holds are based
         const UKControllerPlugin::Navaids::NavaidCollection& navaids;
 
-        // Gives access to the plugin
-        UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface& plugin;
-
         // Manages holds
         UKControllerPlugin::Hold::HoldManager& holdManager;
 
@@ -60,5 +65,8 @@ namespace UKControllerPlugin::Hold {
 
         // How far from a navaid an aircraft can be before its considered to have entered the hold
         const double enterDistance = 3.0;
+
+        // The holds restored from saved state, so they're only expired if nobody has changed them since
+        std::map<std::string, std::string> restoredHolds;
     };
 } // namespace UKControllerPlugin::Hold
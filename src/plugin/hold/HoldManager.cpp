@@ -97,6 +97,22 @@ namespace UKControllerPlugin::Hold {
         return aircraft != this->aircraft.cend() ? *aircraft : this->invalidAircraft;
     }
 
+    /*
+        Get the hold each aircraft has been assigned to, by callsign
+    */
+    auto HoldManager::GetAssignedHolds() const -> std::map<std::string, std::string>
+    {
+        auto lock = std::lock_guard(this->dataMutex);
+        std::map<std::string, std::string> assignedHolds;
+        for (const auto& holdingAircraft : this->aircraft) {
+            if (holdingAircraft->GetAssignedHold() != holdingAircraft->GetNoHoldAssigned()) {
+                assignedHolds[holdingAircraft->GetCallsign()] = holdingAircraft->GetAssignedHold();
+            }
+        }
+
+        return assignedHolds;
+    }
+
     /*
         Unassign an aircrafts hold
     */
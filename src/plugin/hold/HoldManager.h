@@ -34,6 +34,7 @@ namespace UKControllerPlugin::Hold {
         const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>&
         GetAircraftForHold(const std::string& hold) const;
         const std::shared_ptr<HoldingAircraft>& GetHoldingAircraft(const std::string& callsign);
+        [[nodiscard]] auto GetAssignedHolds() const -> std::map<std::string, std::string>;
         void UnassignAircraftFromHold(const std::string& callsign, bool updateApi);
         void RemoveAircraftFromProximityHold(const std::string& callsign, const std::string& hold);
 
@@ -25,15 +25,17 @@
 #include "dialog/DialogManager.h"
 #include "euroscope/AsrEventHandlerCollection.h"
 #include "euroscope/CallbackFunction.h"
+#include "flightplan/FlightplanSweep.h"
 #include "message/UserMessager.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
 #include "push/PushEventProcessorCollection.h"
+#include "push/SharedSyncData.h"
 #include "radarscreen/ConfigurableDisplayCollection.h"
+#include "state/PluginStateSnapshot.h"
 #include "task/TaskRunnerInterface.h"
 #include "tag/TagItemCollection.h"
 #include "tag/TagFunction.h"
-#include "timedevent/TimedEventCollection.h"
 #include "windows/WinApiInterface.h"
 
 using UKControllerPlugin::Api::ApiException;
@@ -66,7 +68,7 @@ namespace UKControllerPlugin::Hold {
     // The id of the popup menu tag function
     const unsigned int popupMenuTagItemId = 9003;
 
-    const int eventHandlerTimedEventFrequency = 7;
+    const int eventHandlerSweepFrequency = 7;
 
     /*
         Bootstrap the module into the plugin
@@ -124,12 +126,14 @@ namespace UKControllerPlugin::Hold {
              displayDialog});
 
         // Create the event handler and register
-        auto eventHandler =
-            std::make_shared<HoldEventHandler>(*container.holdManager, *container.navaids, *container.plugin);
+        auto eventHandler = std::make_shared<HoldEventHandler>(*container.holdManager, *container.navaids);
 
         container.tagHandler->RegisterTagItem(selectedHoldTagItemId, eventHandler);
-        container.timedHandler->RegisterEvent(eventHandler, eventHandlerTimedEventFrequency);
+        container.flightplanSweep->RegisterStage(eventHandler, eventHandlerSweepFrequency);
         container.pushEventProcessors->AddProcessor(eventHandler);
+        if (container.pluginState) {
+            container.pluginState->RegisterState(HoldEventHandler::stateKey, eventHandler);
+        }
 
         // Create the hold display factory
         container.holdDisplayFactory = std::make_unique<HoldDisplayFactory>(
@@ -175,9 +179,15 @@ namespace UKControllerPlugin::Hold {
                 " aircraft into assigned holds");
         });
 
-        // Hold proximity detection handlers
-        container.pushEventProcessors->AddProcessor(
-            std::make_shared<AircraftEnteredHoldingAreaEventHandler>(*container.holdManager, *container.navaids));
+        // Hold proximity detection handlers, sharing who's in the holding areas with other EuroScope instances
+        const auto enteredHoldingAreaHandler =
+            std::make_shared<AircraftEnteredHoldingAreaEventHandler>(*container.holdManager, *container.navaids);
+        container.pushEventProcessors->AddProcessor(enteredHoldingAreaHandler);
+        if (container.sharedPushSync) {
+            enteredHoldingAreaHandler->SetSharedSyncData(container.sharedPushSync);
+            container.sharedPushSync->Share(
+                AircraftEnteredHoldingAreaEventHandler::sharedSyncKey, enteredHoldingAreaHandler);
+        }
         container.pushEventProcessors->AddProcessor(
             std::make_shared<AircraftExitedHoldingAreaEventHandler>(*container.holdManager, *container.navaids));
     }
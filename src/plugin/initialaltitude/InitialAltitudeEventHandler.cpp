@@ -204,15 +204,17 @@ namespace UKControllerPlugin::InitialAltitude {
     }
 
     /*
-     * Periodically, check all flightplans to see if they need an initial altitude update.
-     */
-    void InitialAltitudeEventHandler::TimedEventTrigger()
+        Only sweep the flightplans if the user is active.
+    */
+    auto InitialAltitudeEventHandler::ShouldSweep() const -> bool
     {
-        if (!this->activeCallsigns.UserHasCallsign()) {
-            return;
-        }
+        return this->activeCallsigns.UserHasCallsign();
+    }
 
-        this->CheckAllFlightplansForAssignment();
+    void InitialAltitudeEventHandler::SweepFlightplan(
+        EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        this->FlightPlanEvent(flightplan, radarTarget);
     }
 
     /*
@@ -221,9 +223,9 @@ namespace UKControllerPlugin::InitialAltitude {
     void InitialAltitudeEventHandler::CheckAllFlightplansForAssignment()
     {
         this->plugin.ApplyFunctionToAllFlightplans(
-            [this](
-                const std::shared_ptr<EuroScopeCFlightPlanInterface>& fp,
-                const std::shared_ptr<EuroScopeCRadarTargetInterface>& rt) { this->FlightPlanEvent(*fp, *rt); });
+            [this](EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget) {
+                this->FlightPlanEvent(flightplan, radarTarget);
+            });
     }
 
     /*
@@ -234,4 +236,26 @@ namespace UKControllerPlugin::InitialAltitude {
         this->userAutomaticAssignmentsAllowed =
             userSettings.GetBooleanEntry(GeneralSettingsEntries::initialAltitudeToggleSettingsKey, true);
     }
+
+    /*
+        Remember which SIDs we've already set altitudes for, so that we don't set them again after a restart.
+    */
+    auto InitialAltitudeEventHandler::SaveState() const -> nlohmann::json
+    {
+        return this->alreadySetMap;
+    }
+
+    void InitialAltitudeEventHandler::RestoreState(const nlohmann::json& state)
+    {
+        for (const auto& [callsign, sid] : state.items()) {
+            if (sid.is_string()) {
+                this->alreadySetMap[callsign] = sid.get<std::string>();
+            }
+        }
+    }
+
+    void InitialAltitudeEventHandler::ExpireRestoredState(const std::string& callsign)
+    {
+        this->alreadySetMap.erase(callsign);
+    }
 } // namespace UKControllerPlugin::InitialAltitude
@@ -7,11 +7,12 @@
 #include "eventhandler/EventBus.h"
 #include "eventhandler/EventHandlerFlags.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "InitialAltitudeEventHandler.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
+#include "state/PluginStateSnapshot.h"
 #include "tag/TagFunction.h"
-#include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
@@ -21,7 +22,7 @@ using UKControllerPluginUtils::EventHandler::EventBus;
 
 namespace UKControllerPlugin::InitialAltitude {
 
-    const int timedHandlerFrequency = 10;
+    const int sweepFrequency = 10;
 
     /*
         Initialises the initial altitude module. Gets the altitudes from the dependency cache
@@ -39,7 +40,10 @@ namespace UKControllerPlugin::InitialAltitude {
         persistence.userSettingHandlers->RegisterHandler(initialAltitudeEventHandler);
         persistence.flightplanHandler->RegisterHandler(initialAltitudeEventHandler);
         persistence.activeCallsigns->AddHandler(initialAltitudeEventHandler);
-        persistence.timedHandler->RegisterEvent(initialAltitudeEventHandler, timedHandlerFrequency);
+        persistence.flightplanSweep->RegisterStage(initialAltitudeEventHandler, sweepFrequency);
+        if (persistence.pluginState) {
+            persistence.pluginState->RegisterState(InitialAltitudeEventHandler::stateKey, initialAltitudeEventHandler);
+        }
 
         TagFunction recycleFunction(
             recycleFunctionId,
@@ -135,9 +135,9 @@ namespace UKControllerPlugin::InitialHeading {
     void InitialHeadingEventHandler::CheckAllFlightplansForAssignment()
     {
         this->plugin.ApplyFunctionToAllFlightplans(
-            [this](
-                const std::shared_ptr<EuroScopeCFlightPlanInterface>& fp,
-                const std::shared_ptr<EuroScopeCRadarTargetInterface>& rt) { this->FlightPlanEvent(*fp, *rt); });
+            [this](EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget) {
+                this->FlightPlanEvent(flightplan, radarTarget);
+            });
     }
     /*
         Returns true if the aircraft meets the prerequisites for initial heading assignment.
@@ -207,13 +207,18 @@ namespace UKControllerPlugin::InitialHeading {
     {
     }
 
-    void InitialHeadingEventHandler::TimedEventTrigger()
+    /*
+        Only sweep the flightplans if the user is active.
+    */
+    auto InitialHeadingEventHandler::ShouldSweep() const -> bool
     {
-        if (!this->activeCallsigns.UserHasCallsign()) {
-            return;
-        }
+        return this->activeCallsigns.UserHasCallsign();
+    }
 
-        this->CheckAllFlightplansForAssignment();
+    void InitialHeadingEventHandler::SweepFlightplan(
+        EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        this->FlightPlanEvent(flightplan, radarTarget);
     }
 
     /*
@@ -224,4 +229,26 @@ namespace UKControllerPlugin::InitialHeading {
         this->userAutomaticAssignmentsAllowed =
             userSettings.GetBooleanEntry(GeneralSettingsEntries::initialHeadingToggleSettingsKey, true);
     }
+
+    /*
+        Remember which SIDs we've already set headings for, so that we don't set them again after a restart.
+    */
+    auto InitialHeadingEventHandler::SaveState() const -> nlohmann::json
+    {
+        return this->alreadySetMap;
+    }
+
+    void InitialHeadingEventHandler::RestoreState(const nlohmann::json& state)
+    {
+        for (const auto& [callsign, sid] : state.items()) {
+            if (sid.is_string()) {
+                this->alreadySetMap[callsign] = sid.get<std::string>();
+            }
+        }
+    }
+
+    void InitialHeadingEventHandler::ExpireRestoredState(const std::string& callsign)
+    {
+        this->alreadySetMap.erase(callsign);
+    }
 } // namespace UKControllerPlugin::InitialHeading
@@ -2,7 +2,8 @@
 #include "controller/ActiveCallsignEventHandlerInterface.h"
 #include "euroscope/UserSettingAwareInterface.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
-#include "timedevent/AbstractTimedEvent.h"
+#include "flightplan/FlightplanSweepStage.h"
+#include "state/PersistentStateInterface.h"
 
 // Forward declarations
 
@@ -34,7 +35,8 @@ namespace UKControllerPlugin::InitialHeading {
     class InitialHeadingEventHandler : public Flightplan::FlightPlanEventHandlerInterface,
                                        public Euroscope::UserSettingAwareInterface,
                                        public Controller::ActiveCallsignEventHandlerInterface,
-                                       public TimedEvent::AbstractTimedEvent
+                                       public Flightplan::FlightplanSweepStage,
+                                       public State::PersistentStateInterface
     {
         public:
         InitialHeadingEventHandler(
@@ -59,7 +61,20 @@ namespace UKControllerPlugin::InitialHeading {
         // Inherited via ActiveCallsignEventHandlerInterface
         void ActiveCallsignAdded(const Controller::ActiveCallsign& callsign) override;
         void ActiveCallsignRemoved(const Controller::ActiveCallsign& callsign) override;
-        void TimedEventTrigger() override;
+
+        // Inherited via FlightplanSweepStage
+        [[nodiscard]] auto ShouldSweep() const -> bool override;
+        void SweepFlightplan(
+            Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+            Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
+
+        // Inherited via PersistentStateInterface
+        [[nodiscard]] auto SaveState() const -> nlohmann::json override;
+        void RestoreState(const nlohmann::json& state) override;
+        void ExpireRestoredState(const std::string& callsign) override;
+
+        // The key the headings already set are saved under
+        inline static const std::string stateKey = "initial-headings";
 
         private:
         void CheckAllFlightplansForAssignment();
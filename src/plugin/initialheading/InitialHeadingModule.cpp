@@ -4,13 +4,14 @@
 #include "euroscope/UserSettingAwareCollection.h"
 #include "eventhandler/EventBus.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "initialheading/ClearInitialHeading.h"
 #include "initialheading/InitialHeadingEventHandler.h"
 #include "initialheading/InitialHeadingModule.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
+#include "state/PluginStateSnapshot.h"
 #include "tag/TagFunction.h"
-#include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
@@ -22,7 +23,7 @@ namespace UKControllerPlugin::InitialHeading {
     // The function id for the recycle initial heading function
     const int recycleFunctionId = 9011;
 
-    const int timedHandlerFrequency = 10;
+    const int sweepFrequency = 10;
 
     /*
         Initialises the initial heading module. Gets the headings from the dependency cache
@@ -39,7 +40,10 @@ namespace UKControllerPlugin::InitialHeading {
         persistence.userSettingHandlers->RegisterHandler(handler);
         persistence.flightplanHandler->RegisterHandler(handler);
         persistence.activeCallsigns->AddHandler(handler);
-        persistence.timedHandler->RegisterEvent(handler, timedHandlerFrequency);
+        persistence.flightplanSweep->RegisterStage(handler, sweepFrequency);
+        if (persistence.pluginState) {
+            persistence.pluginState->RegisterState(InitialHeadingEventHandler::stateKey, handler);
+        }
 
         TagFunction recycleFunction(
             recycleFunctionId,
@@ -28,8 +28,31 @@ namespace UKControllerPlugin::Integration {
         this->connections[std::move(connection)] = Time::TimeNow();
     }
 
+    /*
+     * Queue a connection from another thread, it'll be added when we next run.
+     */
+    void ClientInitialisationManager::QueueConnection(std::shared_ptr<IntegrationConnection> connection)
+    {
+        std::lock_guard lock(this->queuedConnectionsLock);
+        this->queuedConnections.push_back(std::move(connection));
+    }
+
+    void ClientInitialisationManager::AddQueuedConnections()
+    {
+        std::vector<std::shared_ptr<IntegrationConnection>> connectionsToAdd;
+        {
+            std::lock_guard lock(this->queuedConnectionsLock);
+            std::swap(connectionsToAdd, this->queuedConnections);
+        }
+
+        for (auto& connection : connectionsToAdd) {
+            this->AddConnection(std::move(connection));
+        }
+    }
+
     void ClientInitialisationManager::TimedEventTrigger()
     {
+        this->AddQueuedConnections();
         for (auto connection = this->connections.begin(); connection != this->connections.end();) {
             // If it's taken too long to initialise, then kill the connection
             if (Time::TimeNow() > connection->second + INITIALISATION_TIMEOUT) {
@@ -74,8 +97,11 @@ namespace UKControllerPlugin::Integration {
                 continue;
             }
 
+            // The success message goes out in JSON, everything after it is in the negotiated encoding
+            const auto encoding = RequestedEncoding(incomingMessages.front());
             const auto client = this->UpgradeToClient(connection, incomingMessages.front());
-            SendInitialisationSuccessMessage(connection, incomingMessages.front());
+            SendInitialisationSuccessMessage(connection, incomingMessages.front(), encoding);
+            connection->SetEncoding(encoding);
             this->dataInitialisers->InitialiseClient(*client);
 
             return true;
@@ -121,6 +147,11 @@ namespace UKControllerPlugin::Integration {
             errors.end(),
             std::make_move_iterator(eventSubscriptionErrors.cbegin()),
             std::make_move_iterator(eventSubscriptionErrors.cend()));
+        auto encodingErrors = ValidateEncoding(messageData);
+        errors.insert(
+            errors.end(),
+            std::make_move_iterator(encodingErrors.cbegin()),
+            std::make_move_iterator(encodingErrors.cend()));
         return errors;
     }
 
@@ -164,6 +195,32 @@ namespace UKControllerPlugin::Integration {
         return errors;
     }
 
+    /*
+     * The encoding is optional, integrations that don't ask for one get JSON.
+     */
+    auto ClientInitialisationManager::ValidateEncoding(const nlohmann::json& data) -> std::vector<std::string>
+    {
+        if (!data.contains("encoding")) {
+            return {};
+        }
+
+        if (!data.at("encoding").is_string() ||
+            !MessageEncodingFromString(data.at("encoding").get<std::string>()).has_value()) {
+            return {VALIDATION_ERROR_INVALID_ENCODING};
+        }
+
+        return {};
+    }
+
+    auto ClientInitialisationManager::RequestedEncoding(const std::shared_ptr<MessageInterface>& initialisationMessage)
+        -> MessageEncoding
+    {
+        const auto data = initialisationMessage->GetMessageData();
+        return data.contains("encoding")
+                   ? MessageEncodingFromString(data.at("encoding").get<std::string>()).value_or(MessageEncoding::Json)
+                   : MessageEncoding::Json;
+    }
+
     auto ClientInitialisationManager::UpgradeToClient(
         const std::shared_ptr<IntegrationConnection>& connection,
         const std::shared_ptr<MessageInterface>& initialisationMessage) -> std::shared_ptr<IntegrationClient>
@@ -185,9 +242,11 @@ namespace UKControllerPlugin::Integration {
 
     void ClientInitialisationManager::SendInitialisationSuccessMessage(
         const std::shared_ptr<IntegrationConnection>& connection,
-        const std::shared_ptr<MessageInterface>& initialisationMessage)
+        const std::shared_ptr<MessageInterface>& initialisationMessage,
+        MessageEncoding encoding)
     {
-        connection->Send(std::make_shared<InitialisationSuccessMessage>(initialisationMessage->GetMessageId()));
+        connection->Send(
+            std::make_shared<InitialisationSuccessMessage>(initialisationMessage->GetMessageId(), encoding));
     }
 
     void ClientInitialisationManager::SendInitialisationFailureMessage(
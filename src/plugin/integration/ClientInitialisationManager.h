@@ -1,4 +1,5 @@
 #pragma once
+#include "MessageEncoding.h"
 #include "timedevent/AbstractTimedEvent.h"
 
 namespace UKControllerPlugin::Integration {
@@ -20,6 +21,7 @@ namespace UKControllerPlugin::Integration {
             std::shared_ptr<IntegrationClientManager> clientManager,
             std::shared_ptr<IntegrationDataInitialisers> dataInitialisers);
         void AddConnection(std::shared_ptr<IntegrationConnection> connection);
+        void QueueConnection(std::shared_ptr<IntegrationConnection> connection);
         void TimedEventTrigger() override;
         [[nodiscard]] auto CountConnections() const -> size_t;
 
@@ -43,7 +45,11 @@ namespace UKControllerPlugin::Integration {
 
         const inline static std::string VALIDATION_ERROR_INVALID_SUBSCRIPTION_VERSION = "Invalid subscription version";
 
+        const inline static std::string VALIDATION_ERROR_INVALID_ENCODING =
+            "Invalid encoding - must be one of json, msgpack or cbor";
+
         private:
+        void AddQueuedConnections();
         auto AttemptInitialisation(
             const std::shared_ptr<IntegrationConnection>& connection,
             std::queue<std::shared_ptr<MessageInterface>> incomingMessages) -> bool;
@@ -52,12 +58,16 @@ namespace UKControllerPlugin::Integration {
         static auto ValidateMessageData(const std::shared_ptr<MessageInterface>& message) -> std::vector<std::string>;
         static auto ValidateIntegrationDetails(const nlohmann::json& data) -> std::vector<std::string>;
         static auto ValidateEventSubscriptions(const nlohmann::json& data) -> std::vector<std::string>;
+        static auto ValidateEncoding(const nlohmann::json& data) -> std::vector<std::string>;
+        [[nodiscard]] static auto RequestedEncoding(const std::shared_ptr<MessageInterface>& initialisationMessage)
+            -> MessageEncoding;
         [[nodiscard]] auto UpgradeToClient(
             const std::shared_ptr<IntegrationConnection>& connection,
             const std::shared_ptr<MessageInterface>& initialisationMessage) -> std::shared_ptr<IntegrationClient>;
         static void SendInitialisationSuccessMessage(
             const std::shared_ptr<IntegrationConnection>& connection,
-            const std::shared_ptr<MessageInterface>& initialisationMessage);
+            const std::shared_ptr<MessageInterface>& initialisationMessage,
+            MessageEncoding encoding);
         static void SendInitialisationFailureMessage(
             const std::shared_ptr<IntegrationConnection>& connection,
             const std::shared_ptr<MessageInterface>& initialisationMessage,
@@ -72,6 +82,12 @@ namespace UKControllerPlugin::Integration {
         // Clients that are fully initialised
         std::map<std::shared_ptr<IntegrationConnection>, std::chrono::system_clock::time_point> connections;
 
+        // Connections accepted on the integration server's thread, waiting to be picked up
+        std::vector<std::shared_ptr<IntegrationConnection>> queuedConnections;
+
+        // Protects the queued connections
+        std::mutex queuedConnectionsLock;
+
         // The next unique id for the integration
         int nextIntegrationId = 1;
 
@@ -23,6 +23,27 @@ namespace UKControllerPlugin::Integration {
          */
         [[nodiscard]] virtual auto Receive() -> std::queue<std::string> = 0;
 
+        /*
+         * Receive queued messages, handing each one to the callback in turn. The message is only
+         * valid for the duration of the callback, which allows connections to avoid copying it.
+         */
+        virtual void ReceiveEach(const std::function<void(std::string_view)>& callback)
+        {
+            auto messages = this->Receive();
+            while (!messages.empty()) {
+                callback(messages.front());
+                messages.pop();
+            }
+        }
+
+        /*
+         * Switch to frames that are prefixed with their length, rather than delimited, for
+         * when the messages are binary. Connections that frame messages themselves can ignore this.
+         */
+        virtual void UseLengthPrefixedFrames()
+        {
+        }
+
         /*
          * Is the connection still active
          */
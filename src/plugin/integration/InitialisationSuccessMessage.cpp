@@ -3,13 +3,14 @@
 
 namespace UKControllerPlugin::Integration {
 
-    InitialisationSuccessMessage::InitialisationSuccessMessage(std::string messageId) : messageId(std::move(messageId))
+    InitialisationSuccessMessage::InitialisationSuccessMessage(std::string messageId, MessageEncoding encoding)
+        : messageId(std::move(messageId)), encoding(encoding)
     {
     }
 
     nlohmann::json InitialisationSuccessMessage::GetMessageData() const
     {
-        return {{"ukcp_version", Plugin::PluginVersion::version}};
+        return {{"ukcp_version", Plugin::PluginVersion::version}, {"encoding", MessageEncodingToString(encoding)}};
     }
 
     MessageType InitialisationSuccessMessage::GetMessageType() const
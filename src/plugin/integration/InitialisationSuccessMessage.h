@@ -1,4 +1,5 @@
 #pragma once
+#include "integration/MessageEncoding.h"
 #include "integration/MessageInterface.h"
 
 namespace UKControllerPlugin::Integration {
@@ -10,7 +11,8 @@ namespace UKControllerPlugin::Integration {
     class InitialisationSuccessMessage : public MessageInterface
     {
         public:
-        explicit InitialisationSuccessMessage(std::string messageId);
+        explicit InitialisationSuccessMessage(
+            std::string messageId, MessageEncoding encoding = MessageEncoding::Json);
         ~InitialisationSuccessMessage() override = default;
         [[nodiscard]] MessageType GetMessageType() const override;
         [[nodiscard]] nlohmann::json GetMessageData() const override;
@@ -19,5 +21,8 @@ namespace UKControllerPlugin::Integration {
         private:
         // The id for the message to return
         std::string messageId;
+
+        // The encoding that will be used from now on
+        MessageEncoding encoding;
     };
 } // namespace UKControllerPlugin::Integration
@@ -13,27 +13,36 @@ namespace UKControllerPlugin::Integration {
 
     void IntegrationConnection::Send(std::shared_ptr<MessageInterface> message) const
     {
-        this->connection->Send(message->ToJson().dump());
+        this->SendSerialised(EncodeMessage(message->ToJson(), this->encoding));
+    }
+
+    /*
+     * Send a message that has already been serialised, so that the same message can be
+     * sent to multiple clients whilst only being serialised once.
+     */
+    void IntegrationConnection::SendSerialised(const std::string& message) const
+    {
+        this->connection->Send(message);
     }
 
     std::queue<std::shared_ptr<MessageInterface>> IntegrationConnection::Receive() const
     {
-        std::queue<std::string> messages = this->connection->Receive();
         std::queue<std::shared_ptr<MessageInterface>> parsedMessages;
-        while (!messages.empty()) {
+        this->connection->ReceiveEach([this, &parsedMessages](std::string_view rawMessage) {
             try {
-                auto message = InboundMessage::FromJson(nlohmann::json::parse(messages.front()));
+                auto message = InboundMessage::FromJson(DecodeMessage(rawMessage, this->encoding));
                 if (!message) {
-                    LogError("Invalid message received from integration: " + messages.front());
+                    LogError("Invalid message received from integration: " + std::string(rawMessage));
                 } else {
                     parsedMessages.push(message);
                 }
             } catch (nlohmann::json::exception&) {
-                LogError("Invalid JSON received from integration: " + messages.front());
+                LogError(
+                    this->encoding == MessageEncoding::Json
+                        ? "Invalid JSON received from integration: " + std::string(rawMessage)
+                        : "Invalid " + MessageEncodingToString(this->encoding) + " received from integration");
             }
-
-            messages.pop();
-        }
+        });
 
         return parsedMessages;
     }
@@ -42,4 +51,20 @@ namespace UKControllerPlugin::Integration {
     {
         return this->connection->Active();
     }
+
+    /*
+     * Binary encodings may contain anything, so they are always length-prefixed.
+     */
+    void IntegrationConnection::SetEncoding(MessageEncoding newEncoding)
+    {
+        this->encoding = newEncoding;
+        if (this->encoding != MessageEncoding::Json) {
+            this->connection->UseLengthPrefixedFrames();
+        }
+    }
+
+    auto IntegrationConnection::Encoding() const -> MessageEncoding
+    {
+        return this->encoding;
+    }
 } // namespace UKControllerPlugin::Integration
@@ -1,4 +1,5 @@
 #pragma once
+#include "integration/MessageEncoding.h"
 
 namespace UKControllerPlugin::Integration {
     class MessageInterface;
@@ -15,11 +16,17 @@ namespace UKControllerPlugin::Integration {
         public:
         explicit IntegrationConnection(std::shared_ptr<Connection> connection);
         void Send(std::shared_ptr<MessageInterface> message) const;
+        void SendSerialised(const std::string& message) const;
         std::queue<std::shared_ptr<MessageInterface>> Receive() const;
         bool Active() const;
+        void SetEncoding(MessageEncoding newEncoding);
+        [[nodiscard]] auto Encoding() const -> MessageEncoding;
 
         private:
         // The raw connection
         std::shared_ptr<Connection> connection;
+
+        // How messages are encoded
+        MessageEncoding encoding = MessageEncoding::Json;
     };
 } // namespace UKControllerPlugin::Integration
@@ -1,8 +1,9 @@
 #include "integration/IntegrationServer.h"
-#include "integration/SocketWrapper.h"
 #include "integration/ClientInitialisationManager.h"
-#include "integration/SocketConnection.h"
 #include "integration/IntegrationConnection.h"
+#include "integration/PolledSocket.h"
+#include "integration/SocketConnection.h"
+#include "integration/SocketPoller.h"
 
 namespace UKControllerPlugin::Integration {
 
@@ -52,34 +53,27 @@ namespace UKControllerPlugin::Integration {
 
         LogInfo("Successfully initialised integration server");
         this->initialised = true;
-        this->acceptingConnections = true;
-        this->acceptThread = std::make_shared<std::thread>(&IntegrationServer::AcceptLoop, this);
+        this->poller =
+            std::make_unique<SocketPoller>(this->serverSocket, [this](std::shared_ptr<PolledSocket> socket) {
+                this->AcceptConnection(std::move(socket));
+            });
     }
 
     IntegrationServer::~IntegrationServer()
     {
         if (this->initialised) {
-            this->acceptingConnections = false;
+            this->poller.reset();
             closesocket(this->serverSocket);
-            this->acceptThread->join();
             LogInfo("Closed integration server socket");
         }
     }
 
-    void IntegrationServer::AcceptLoop() const
+    /*
+     * Called on the poller thread, so the connection is queued up for the EuroScope thread to pick up.
+     */
+    void IntegrationServer::AcceptConnection(std::shared_ptr<PolledSocket> socket) const
     {
-        while (this->acceptingConnections) {
-            SOCKET integrationSocket = accept(this->serverSocket, nullptr, nullptr);
-            if (integrationSocket == INVALID_SOCKET) {
-                if (this->acceptingConnections) {
-                    LogError("Failed to accept integration server connection: " + std::to_string(WSAGetLastError()));
-                }
-                closesocket(integrationSocket);
-                continue;
-            }
-
-            this->initialisationManager->AddConnection(std::make_shared<IntegrationConnection>(
-                std::make_shared<SocketConnection>(std::make_shared<SocketWrapper>(integrationSocket))));
-        }
+        this->initialisationManager->QueueConnection(
+            std::make_shared<IntegrationConnection>(std::make_shared<SocketConnection>(std::move(socket))));
     }
 } // namespace UKControllerPlugin::Integration
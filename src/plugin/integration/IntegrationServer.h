@@ -2,29 +2,34 @@
 
 namespace UKControllerPlugin::Integration {
     class ClientInitialisationManager;
+    class PolledSocket;
+    class SocketPoller;
+
     /*
      * A class that listens for connections on the integration and responds
-     * accordingly
+     * accordingly. All of the integration sockets are serviced by a single poller thread.
      */
     class IntegrationServer
     {
         public:
         explicit IntegrationServer(std::shared_ptr<ClientInitialisationManager> initialisationManager);
         ~IntegrationServer();
-        void AcceptLoop() const;
+        IntegrationServer(const IntegrationServer&) = delete;
+        IntegrationServer(IntegrationServer&&) noexcept = delete;
+        auto operator=(const IntegrationServer&) -> IntegrationServer& = delete;
+        auto operator=(IntegrationServer&&) noexcept -> IntegrationServer& = delete;
 
         private:
+        void AcceptConnection(std::shared_ptr<PolledSocket> socket) const;
+
         // The server socket for listening for new connections
         SOCKET serverSocket = INVALID_SOCKET;
 
         // Whether we fully initialised ourselves
         bool initialised = false;
 
-        // Thread to do all the things
-        std::shared_ptr<std::thread> acceptThread;
-
-        // Are we acceptingConnections
-        bool acceptingConnections;
+        // Services the server socket and all of the integration sockets
+        std::unique_ptr<SocketPoller> poller;
 
         // The connection manager
         std::shared_ptr<ClientInitialisationManager> initialisationManager;
@@ -0,0 +1,65 @@
+#include "MessageEncoding.h"
+
+namespace UKControllerPlugin::Integration {
+
+    auto MessageEncodingFromString(const std::string& encoding) -> std::optional<MessageEncoding>
+    {
+        if (encoding == "json") {
+            return MessageEncoding::Json;
+        }
+
+        if (encoding == "msgpack") {
+            return MessageEncoding::MessagePack;
+        }
+
+        if (encoding == "cbor") {
+            return MessageEncoding::Cbor;
+        }
+
+        return std::nullopt;
+    }
+
+    auto MessageEncodingToString(MessageEncoding encoding) -> std::string
+    {
+        switch (encoding) {
+        case MessageEncoding::MessagePack:
+            return "msgpack";
+        case MessageEncoding::Cbor:
+            return "cbor";
+        default:
+            return "json";
+        }
+    }
+
+    auto EncodeMessage(const nlohmann::json& message, MessageEncoding encoding) -> std::string
+    {
+        std::string encoded;
+        switch (encoding) {
+        case MessageEncoding::MessagePack:
+            nlohmann::json::to_msgpack(message, encoded);
+            break;
+        case MessageEncoding::Cbor:
+            nlohmann::json::to_cbor(message, encoded);
+            break;
+        default:
+            encoded = message.dump();
+        }
+
+        return encoded;
+    }
+
+    /*
+     * Throws nlohmann::json::exception if the message can't be decoded.
+     */
+    auto DecodeMessage(std::string_view message, MessageEncoding encoding) -> nlohmann::json
+    {
+        switch (encoding) {
+        case MessageEncoding::MessagePack:
+            return nlohmann::json::from_msgpack(message.cbegin(), message.cend());
+        case MessageEncoding::Cbor:
+            return nlohmann::json::from_cbor(message.cbegin(), message.cend());
+        default:
+            return nlohmann::json::parse(message.cbegin(), message.cend());
+        }
+    }
+} // namespace UKControllerPlugin::Integration
@@ -0,0 +1,21 @@
+#pragma once
+
+namespace UKControllerPlugin::Integration {
+
+    /*
+     * How messages are encoded on an integration connection. JSON is the default and is what every
+     * integration starts with. Integrations can ask for one of the binary encodings during initialisation,
+     * after which all messages in both directions are sent in that encoding with length-prefixed frames.
+     */
+    enum class MessageEncoding
+    {
+        Json,
+        MessagePack,
+        Cbor
+    };
+
+    [[nodiscard]] auto MessageEncodingFromString(const std::string& encoding) -> std::optional<MessageEncoding>;
+    [[nodiscard]] auto MessageEncodingToString(MessageEncoding encoding) -> std::string;
+    [[nodiscard]] auto EncodeMessage(const nlohmann::json& message, MessageEncoding encoding) -> std::string;
+    [[nodiscard]] auto DecodeMessage(std::string_view message, MessageEncoding encoding) -> nlohmann::json;
+} // namespace UKControllerPlugin::Integration
@@ -0,0 +1,157 @@
+#include "MessageFrameBuffer.h"
+
+namespace UKControllerPlugin::Integration {
+
+    MessageFrameBuffer::MessageFrameBuffer(char delimiter, size_t maxFrameBytes)
+        : delimiter(delimiter), maxFrameBytes(maxFrameBytes)
+    {
+    }
+
+    /*
+     * Appending may move the buffer, so any frames previously returned are invalidated. Once a frame
+     * has been too large, anything more is thrown away.
+     */
+    void MessageFrameBuffer::Append(std::string_view data)
+    {
+        if (data.empty() || this->frameTooLarge) {
+            return;
+        }
+
+        this->Compact();
+        this->buffer.insert(this->buffer.end(), data.cbegin(), data.cend());
+    }
+
+    /*
+     * Returns the next complete frame, without its delimiter, or nothing if the next
+     * frame hasn't fully arrived yet.
+     */
+    auto MessageFrameBuffer::NextFrame() -> std::optional<std::string_view>
+    {
+        if (this->frameTooLarge) {
+            return std::nullopt;
+        }
+
+        return this->lengthPrefixed ? this->NextLengthPrefixedFrame() : this->NextDelimitedFrame();
+    }
+
+    auto MessageFrameBuffer::NextDelimitedFrame() -> std::optional<std::string_view>
+    {
+        const auto scanStart = this->buffer.cbegin() + static_cast<std::ptrdiff_t>(this->scanPosition);
+        const auto delimiterPosition = std::find(scanStart, this->buffer.cend(), this->delimiter);
+        if (delimiterPosition == this->buffer.cend()) {
+            this->scanPosition = this->buffer.size();
+            if (this->BufferedBytes() > this->maxFrameBytes) {
+                this->RejectOversizedFrame();
+            }
+            return std::nullopt;
+        }
+
+        const auto frameEnd = static_cast<size_t>(delimiterPosition - this->buffer.cbegin());
+        if (frameEnd - this->readPosition > this->maxFrameBytes) {
+            this->RejectOversizedFrame();
+            return std::nullopt;
+        }
+        const std::string_view frame(this->buffer.data() + this->readPosition, frameEnd - this->readPosition);
+        this->readPosition = frameEnd + 1;
+        this->scanPosition = this->readPosition;
+
+        return frame;
+    }
+
+    auto MessageFrameBuffer::NextLengthPrefixedFrame() -> std::optional<std::string_view>
+    {
+        if (this->BufferedBytes() < LENGTH_PREFIX_BYTES) {
+            return std::nullopt;
+        }
+
+        size_t frameLength = 0;
+        for (size_t i = 0; i < LENGTH_PREFIX_BYTES; i++) {
+            frameLength = (frameLength << 8) | static_cast<unsigned char>(this->buffer[this->readPosition + i]);
+        }
+
+        if (frameLength > this->maxFrameBytes) {
+            this->RejectOversizedFrame();
+            return std::nullopt;
+        }
+
+        if (this->BufferedBytes() < LENGTH_PREFIX_BYTES + frameLength) {
+            return std::nullopt;
+        }
+
+        const std::string_view frame(this->buffer.data() + this->readPosition + LENGTH_PREFIX_BYTES, frameLength);
+        this->readPosition += LENGTH_PREFIX_BYTES + frameLength;
+        this->scanPosition = this->readPosition;
+
+        return frame;
+    }
+
+    /*
+     * Switch to length-prefixed frames, anything already buffered is assumed to be in the new format.
+     */
+    void MessageFrameBuffer::UseLengthPrefix()
+    {
+        this->lengthPrefixed = true;
+        this->scanPosition = this->readPosition;
+    }
+
+    auto MessageFrameBuffer::UsingLengthPrefix() const -> bool
+    {
+        return this->lengthPrefixed;
+    }
+
+    auto MessageFrameBuffer::FrameTooLarge() const -> bool
+    {
+        return this->frameTooLarge;
+    }
+
+    auto MessageFrameBuffer::LengthPrefix(size_t frameLength) -> std::array<char, 4>
+    {
+        return {
+            static_cast<char>((frameLength >> 24) & 0xFF),
+            static_cast<char>((frameLength >> 16) & 0xFF),
+            static_cast<char>((frameLength >> 8) & 0xFF),
+            static_cast<char>(frameLength & 0xFF)};
+    }
+
+    auto MessageFrameBuffer::BufferedBytes() const -> size_t
+    {
+        return this->buffer.size() - this->readPosition;
+    }
+
+    void MessageFrameBuffer::Compact()
+    {
+        if (this->readPosition == 0) {
+            return;
+        }
+
+        if (this->readPosition == this->buffer.size()) {
+            this->buffer.clear();
+            this->readPosition = 0;
+            this->scanPosition = 0;
+            return;
+        }
+
+        if (this->readPosition < this->buffer.size() / 2) {
+            return;
+        }
+
+        this->buffer.erase(
+            this->buffer.begin(), this->buffer.begin() + static_cast<std::ptrdiff_t>(this->readPosition));
+        this->scanPosition -= this->readPosition;
+        this->readPosition = 0;
+    }
+
+    /*
+     * There's no way to find where the next frame starts, so give up on the stream altogether
+     * and release the memory.
+     */
+    void MessageFrameBuffer::RejectOversizedFrame()
+    {
+        LogError("Integration sent a frame larger than " + std::to_string(this->maxFrameBytes) + " bytes");
+        this->frameTooLarge = true;
+        this->buffer.clear();
+        this->buffer.shrink_to_fit();
+        this->readPosition = 0;
+        this->scanPosition = 0;
+    }
+} // namespace UKControllerPlugin::Integration
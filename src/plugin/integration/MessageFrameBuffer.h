@@ -0,0 +1,66 @@
+#pragma once
+
+namespace UKControllerPlugin::Integration {
+
+    /*
+     * A receive buffer for delimited integration messages.
+     *
+     * Data is appended at the back and complete frames are handed out from the front as views into the
+     * buffer, so messages are never copied out just to find where they end. Consumed space at the front
+     * is reclaimed lazily, once it makes up at least half of the buffer, so compaction is amortised over
+     * the frames read. Each byte is only scanned for the delimiter once, regardless of how many reads it
+     * takes for the rest of its message to arrive.
+     *
+     * Binary encodings can contain the delimiter, so the buffer can be switched to frames that are prefixed
+     * by their length as a 32-bit big-endian integer instead.
+     *
+     * Frames are limited in size, so that a misbehaving peer can't make the buffer grow without bound. Once a
+     * frame goes over the limit, either by announcing a length that is too big or by sending too much without
+     * a delimiter, the buffer is emptied and stops handing out frames, and the connection should be closed.
+     */
+    class MessageFrameBuffer
+    {
+        public:
+        explicit MessageFrameBuffer(char delimiter, size_t maxFrameBytes = DEFAULT_MAX_FRAME_BYTES);
+        void Append(std::string_view data);
+        [[nodiscard]] auto NextFrame() -> std::optional<std::string_view>;
+        [[nodiscard]] auto BufferedBytes() const -> size_t;
+        void UseLengthPrefix();
+        [[nodiscard]] auto UsingLengthPrefix() const -> bool;
+        [[nodiscard]] auto FrameTooLarge() const -> bool;
+        [[nodiscard]] static auto LengthPrefix(size_t frameLength) -> std::array<char, 4>;
+
+        private:
+        [[nodiscard]] auto NextDelimitedFrame() -> std::optional<std::string_view>;
+        [[nodiscard]] auto NextLengthPrefixedFrame() -> std::optional<std::string_view>;
+        void Compact();
+        void RejectOversizedFrame();
+
+        // What separates one message from the next
+        const char delimiter;
+
+        // The raw data
+        std::vector<char> buffer;
+
+        // Where the next frame starts
+        size_t readPosition = 0;
+
+        // How far we've looked for the next delimiter
+        size_t scanPosition = 0;
+
+        // Are frames prefixed by their length, rather than delimited
+        bool lengthPrefixed = false;
+
+        // The biggest frame we'll accept
+        const size_t maxFrameBytes;
+
+        // Has a frame gone over the limit
+        bool frameTooLarge = false;
+
+        // The default frame size limit, far bigger than any message an integration should send
+        static inline const size_t DEFAULT_MAX_FRAME_BYTES = 1048576;
+
+        // How many bytes the length prefix takes up
+        static inline const size_t LENGTH_PREFIX_BYTES = 4;
+    };
+} // namespace UKControllerPlugin::Integration
@@ -12,10 +12,17 @@ namespace UKControllerPlugin::Integration {
     {
     }
 
+    /*
+     * Serialises the message once per encoding in use, then sends the same serialised message to
+     * every interested client.
+     */
     void OutboundIntegrationMessageHandler::SendEvent(std::shared_ptr<MessageInterface> message) const
     {
+        nlohmann::json jsonMessage;
+        std::map<MessageEncoding, std::string> serialisedMessages;
         try {
-            LogDebug("Sending integration message: " + message->ToJson().dump());
+            jsonMessage = message->ToJson();
+            serialisedMessages[MessageEncoding::Json] = jsonMessage.dump();
         } catch (const std::exception& exception) {
             if (apiLoggedTypes.find(message->GetMessageType().type) == apiLoggedTypes.end()) {
                 LogError(
@@ -38,15 +45,24 @@ namespace UKControllerPlugin::Integration {
             return;
         }
 
+        LogDebug("Sending integration message: " + serialisedMessages.at(MessageEncoding::Json));
+        const auto messageType = message->GetMessageType();
         std::for_each(
             this->clientManager->cbegin(),
             this->clientManager->cend(),
-            [&message](const std::shared_ptr<IntegrationClient>& client) {
-                if (!client->InterestedInMessage(message->GetMessageType())) {
+            [&messageType, &jsonMessage, &serialisedMessages](const std::shared_ptr<IntegrationClient>& client) {
+                if (!client->InterestedInMessage(messageType)) {
                     return;
                 }
 
-                client->Connection()->Send(message);
+                const auto encoding = client->Connection()->Encoding();
+                auto serialisedMessage = serialisedMessages.find(encoding);
+                if (serialisedMessage == serialisedMessages.cend()) {
+                    serialisedMessage =
+                        serialisedMessages.insert({encoding, EncodeMessage(jsonMessage, encoding)}).first;
+                }
+
+                client->Connection()->SendSerialised(serialisedMessage->second);
             });
     }
 } // namespace UKControllerPlugin::Integration
@@ -0,0 +1,134 @@
+#include "PolledSocket.h"
+
+namespace UKControllerPlugin::Integration {
+
+    PolledSocket::PolledSocket(SOCKET socket) : socket(socket)
+    {
+        u_long nonBlocking = 1;
+        if (ioctlsocket(this->socket, FIONBIO, &nonBlocking) == SOCKET_ERROR) {
+            LogError("Failed to make integration socket non-blocking: " + std::to_string(WSAGetLastError()));
+            this->active = false;
+        }
+    }
+
+    PolledSocket::~PolledSocket()
+    {
+        if (this->active) {
+            LogDebug("Shutting down socket");
+            if (shutdown(this->socket, SD_BOTH) == SOCKET_ERROR) {
+                LogError("Shutdown error shutting down socket: " + std::to_string(WSAGetLastError()));
+            }
+            this->active = false;
+        }
+
+        LogDebug("Closing socket");
+        closesocket(this->socket);
+    }
+
+    auto PolledSocket::Active() const -> bool
+    {
+        return this->active;
+    }
+
+    /*
+     * Queue the message and try to send it there and then.
+     */
+    auto PolledSocket::operator<<(std::string& message) -> SocketInterface&
+    {
+        std::lock_guard lock(this->writeLock);
+        this->writeBuffer.append(message);
+        this->FlushWithLock();
+        return *this;
+    }
+
+    auto PolledSocket::operator>>(std::string& message) -> SocketInterface&
+    {
+        // Swap the buffers over rather than copy, the caller's buffer is reused for the next reads
+        std::lock_guard lock(this->readLock);
+        message.clear();
+        std::swap(message, this->readBuffer);
+        return *this;
+    }
+
+    auto PolledSocket::operator>>(std::stringstream& inboundStream) -> SocketInterface&
+    {
+        std::lock_guard lock(this->readLock);
+        inboundStream << this->readBuffer;
+        this->readBuffer.clear();
+        return *this;
+    }
+
+    auto PolledSocket::Socket() const -> SOCKET
+    {
+        return this->socket;
+    }
+
+    auto PolledSocket::HasPendingWrites() -> bool
+    {
+        std::lock_guard lock(this->writeLock);
+        return this->writeOffset < this->writeBuffer.size();
+    }
+
+    /*
+     * Called by the poller when the socket is readable, reads until there's nothing left.
+     */
+    void PolledSocket::ReadAvailable()
+    {
+        std::array<char, READ_BUFFER_SIZE> receiveBuffer{};
+        while (this->active) {
+            const int bytesReceived = recv(this->socket, receiveBuffer.data(), READ_BUFFER_SIZE, 0);
+            if (bytesReceived > 0) {
+                std::lock_guard lock(this->readLock);
+                this->readBuffer.append(receiveBuffer.data(), bytesReceived);
+            } else if (bytesReceived == 0) {
+                LogInfo("Integration connection closing");
+                this->active = false;
+            } else if (WSAGetLastError() == WSAEWOULDBLOCK) {
+                return;
+            } else {
+                LogError("Failed to receive data from integration: " + std::to_string(WSAGetLastError()));
+                this->active = false;
+            }
+        }
+    }
+
+    /*
+     * Called by the poller when the socket is writable again.
+     */
+    void PolledSocket::FlushPendingWrites()
+    {
+        std::lock_guard lock(this->writeLock);
+        this->FlushWithLock();
+    }
+
+    void PolledSocket::Deactivate()
+    {
+        this->active = false;
+    }
+
+    void PolledSocket::FlushWithLock()
+    {
+        while (this->active && this->writeOffset < this->writeBuffer.size()) {
+            const int sendResult = send(
+                this->socket,
+                this->writeBuffer.data() + this->writeOffset,
+                static_cast<int>(this->writeBuffer.size() - this->writeOffset),
+                0);
+
+            if (sendResult == SOCKET_ERROR) {
+                if (WSAGetLastError() == WSAEWOULDBLOCK) {
+                    return;
+                }
+
+                LogError("Failed to send on socket, socket will be shut down: " + std::to_string(WSAGetLastError()));
+                this->active = false;
+                return;
+            }
+
+            this->writeOffset += sendResult;
+        }
+
+        this->writeBuffer.clear();
+        this->writeOffset = 0;
+    }
+} // namespace UKControllerPlugin::Integration
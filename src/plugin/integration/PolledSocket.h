@@ -0,0 +1,56 @@
+#pragma once
+#include "SocketInterface.h"
+
+namespace UKControllerPlugin::Integration {
+
+    /*
+     * A non-blocking socket that is serviced by the SocketPoller, rather than having
+     * threads of its own.
+     *
+     * Inbound data is read by the poller thread and buffered until collected. Outbound data is sent
+     * straight away on the calling thread if the socket will take it, with anything left over being
+     * flushed by the poller as soon as the socket becomes writable again.
+     */
+    class PolledSocket : public SocketInterface
+    {
+        public:
+        explicit PolledSocket(SOCKET socket);
+        ~PolledSocket() override;
+        [[nodiscard]] auto Active() const -> bool override;
+        auto operator<<(std::string& message) -> SocketInterface& override;
+        auto operator>>(std::string& message) -> SocketInterface& override;
+        auto operator>>(std::stringstream& inboundStream) -> SocketInterface& override;
+        [[nodiscard]] auto Socket() const -> SOCKET;
+        [[nodiscard]] auto HasPendingWrites() -> bool;
+        void ReadAvailable();
+        void FlushPendingWrites();
+        void Deactivate();
+
+        private:
+        void FlushWithLock();
+
+        // The socket
+        SOCKET socket;
+
+        // Is the socket still active
+        std::atomic<bool> active = true;
+
+        // Data read from the socket that hasn't been collected yet
+        std::string readBuffer;
+
+        // Data waiting to be sent
+        std::string writeBuffer;
+
+        // How much of the write buffer has already been sent
+        size_t writeOffset = 0;
+
+        // Mutex for the read buffer
+        std::mutex readLock;
+
+        // Mutex for the write buffer
+        std::mutex writeLock;
+
+        // How big a message we can read in one go
+        static inline const int READ_BUFFER_SIZE = 4096;
+    };
+} // namespace UKControllerPlugin::Integration
@@ -2,47 +2,51 @@
 #include "SocketInterface.h"
 
 namespace UKControllerPlugin::Integration {
-    SocketConnection::SocketConnection(std::shared_ptr<SocketInterface> socket) : socket(std::move(socket))
+    SocketConnection::SocketConnection(std::shared_ptr<SocketInterface> socket)
+        : socket(std::move(socket)), incomingData(MESSAGE_DELIMITER)
     {
     }
 
+    /*
+     * A connection that has sent a frame too large to buffer is closed.
+     */
     auto SocketConnection::Active() const -> bool
     {
-        return this->socket->Active();
+        return this->socket->Active() && !this->incomingData.FrameTooLarge();
     }
 
     auto SocketConnection::Receive() -> std::queue<std::string>
     {
-        *this->socket >> this->incomingData;
-        return this->ProcessReceivedData();
+        std::queue<std::string> messages;
+        this->ReceiveEach([&messages](std::string_view message) { messages.emplace(message); });
+        return messages;
     }
 
-    void SocketConnection::Send(std::string message)
+    void SocketConnection::ReceiveEach(const std::function<void(std::string_view)>& callback)
     {
-        message.append(MESSAGE_DELIMITER);
-        *this->socket << message;
-    }
+        *this->socket >> this->receivedData;
+        this->incomingData.Append(this->receivedData);
 
-    auto SocketConnection::ProcessReceivedData() -> std::queue<std::string>
-    {
-        if (this->incomingData.tellp() == 0) {
-            return {};
+        // Anything left over is an incomplete message, which stays buffered for later
+        while (const auto message = this->incomingData.NextFrame()) {
+            callback(*message);
         }
+    }
 
-        std::string streamData = this->incomingData.str();
-        std::queue<std::string> messages;
-
-        size_t indexOfMessageSeparator = 0;
-        while ((indexOfMessageSeparator = streamData.find(MESSAGE_DELIMITER)) != std::string::npos) {
-            messages.push(streamData.substr(0, indexOfMessageSeparator));
-            streamData.erase(0, indexOfMessageSeparator + 1);
+    void SocketConnection::Send(std::string message)
+    {
+        if (this->incomingData.UsingLengthPrefix()) {
+            const auto prefix = MessageFrameBuffer::LengthPrefix(message.size());
+            message.insert(message.begin(), prefix.cbegin(), prefix.cend());
+        } else {
+            message.push_back(MESSAGE_DELIMITER);
         }
 
-        // Put any incomplete messages back on the stream for later
-        this->incomingData.str("");
-        this->incomingData.clear();
-        this->incomingData << streamData;
+        *this->socket << message;
+    }
 
-        return messages;
+    void SocketConnection::UseLengthPrefixedFrames()
+    {
+        this->incomingData.UseLengthPrefix();
     }
 } // namespace UKControllerPlugin::Integration
@@ -1,5 +1,6 @@
 #pragma once
 #include "integration/Connection.h"
+#include "integration/MessageFrameBuffer.h"
 
 namespace UKControllerPlugin::Integration {
     class MessageInterface;
@@ -16,17 +17,20 @@ namespace UKControllerPlugin::Integration {
 
         bool Active() const override;
         std::queue<std::string> Receive() override;
+        void ReceiveEach(const std::function<void(std::string_view)>& callback) override;
         void Send(std::string message) override;
+        void UseLengthPrefixedFrames() override;
 
         private:
-        std::queue<std::string> ProcessReceivedData();
-
-        static inline const char MESSAGE_DELIMITER[1] = {'\x1F'};
+        static inline const char MESSAGE_DELIMITER = '\x1F';
 
         // The socket
         std::shared_ptr<SocketInterface> socket;
 
-        // Data that is inbound, but not yet part of a message
-        std::stringstream incomingData;
+        // Data that has just come off the socket, reused between reads
+        std::string receivedData;
+
+        // Data that is inbound, but not yet handed out as messages
+        MessageFrameBuffer incomingData;
     };
 } // namespace UKControllerPlugin::Integration
@@ -0,0 +1,118 @@
+#include "PolledSocket.h"
+#include "SocketPoller.h"
+
+namespace UKControllerPlugin::Integration {
+
+    SocketPoller::SocketPoller(SOCKET listener, AcceptCallback acceptCallback)
+        : listener(listener), acceptCallback(std::move(acceptCallback))
+    {
+        u_long nonBlocking = 1;
+        if (ioctlsocket(this->listener, FIONBIO, &nonBlocking) == SOCKET_ERROR) {
+            LogError("Failed to make integration server socket non-blocking: " + std::to_string(WSAGetLastError()));
+        }
+
+        this->pollThread = std::thread(&SocketPoller::PollLoop, this);
+    }
+
+    SocketPoller::~SocketPoller()
+    {
+        this->polling = false;
+        this->pollThread.join();
+    }
+
+    auto SocketPoller::CountSockets() -> size_t
+    {
+        std::lock_guard lock(this->socketsLock);
+        return this->sockets.size();
+    }
+
+    void SocketPoller::PollLoop()
+    {
+        std::vector<WSAPOLLFD> pollDescriptors;
+        std::vector<std::shared_ptr<PolledSocket>> polledSockets;
+        while (this->polling) {
+            polledSockets.clear();
+            this->RemoveFinishedSockets();
+
+            // The listener is always the first descriptor, followed by each socket
+            pollDescriptors.clear();
+            pollDescriptors.push_back({this->listener, POLLRDNORM, 0});
+            {
+                std::lock_guard lock(this->socketsLock);
+                polledSockets = this->sockets;
+            }
+
+            for (const auto& socket : polledSockets) {
+                const SHORT events = socket->HasPendingWrites() ? POLLRDNORM | POLLWRNORM : POLLRDNORM;
+                pollDescriptors.push_back({socket->Socket(), events, 0});
+            }
+
+            const int ready =
+                WSAPoll(pollDescriptors.data(), static_cast<ULONG>(pollDescriptors.size()), POLL_TIMEOUT_MS);
+            if (ready == SOCKET_ERROR) {
+                LogError("Failed to poll integration sockets: " + std::to_string(WSAGetLastError()));
+                std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS));
+                continue;
+            }
+
+            if (ready == 0) {
+                continue;
+            }
+
+            if (pollDescriptors[0].revents & POLLRDNORM) {
+                this->AcceptConnections();
+            }
+
+            for (size_t i = 0; i < polledSockets.size(); i++) {
+                const auto events = pollDescriptors[i + 1].revents;
+                const auto& socket = polledSockets[i];
+                if (events & (POLLRDNORM | POLLHUP)) {
+                    socket->ReadAvailable();
+                }
+
+                if (events & POLLWRNORM) {
+                    socket->FlushPendingWrites();
+                }
+
+                if (events & (POLLERR | POLLNVAL)) {
+                    socket->Deactivate();
+                }
+            }
+        }
+    }
+
+    void SocketPoller::AcceptConnections()
+    {
+        SOCKET integrationSocket;
+        while ((integrationSocket = accept(this->listener, nullptr, nullptr)) != INVALID_SOCKET) {
+            auto socket = std::make_shared<PolledSocket>(integrationSocket);
+            {
+                std::lock_guard lock(this->socketsLock);
+                this->sockets.push_back(socket);
+            }
+
+            this->acceptCallback(socket);
+        }
+
+        if (WSAGetLastError() != WSAEWOULDBLOCK) {
+            LogError("Failed to accept integration server connection: " + std::to_string(WSAGetLastError()));
+        }
+    }
+
+    /*
+     * Stop polling sockets that have died, or that nobody else is using anymore. If we hold the last
+     * reference, the socket is closed here.
+     */
+    void SocketPoller::RemoveFinishedSockets()
+    {
+        std::lock_guard lock(this->socketsLock);
+        this->sockets.erase(
+            std::remove_if(
+                this->sockets.begin(),
+                this->sockets.end(),
+                [](const std::shared_ptr<PolledSocket>& socket) {
+                    return !socket->Active() || socket.use_count() == 1;
+                }),
+            this->sockets.end());
+    }
+} // namespace UKControllerPlugin::Integration
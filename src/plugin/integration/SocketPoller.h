@@ -0,0 +1,52 @@
+#pragma once
+
+namespace UKControllerPlugin::Integration {
+    class PolledSocket;
+
+    /*
+     * A single I/O thread that services the integration server's listening socket and every
+     * integration socket, using WSAPoll to wait until something is ready to read or write.
+     *
+     * Newly accepted sockets are handed to the accept callback on the poller thread, so the callback
+     * must hand them over to the EuroScope thread safely.
+     */
+    class SocketPoller
+    {
+        public:
+        using AcceptCallback = std::function<void(std::shared_ptr<PolledSocket>)>;
+
+        SocketPoller(SOCKET listener, AcceptCallback acceptCallback);
+        ~SocketPoller();
+        SocketPoller(const SocketPoller&) = delete;
+        SocketPoller(SocketPoller&&) noexcept = delete;
+        auto operator=(const SocketPoller&) -> SocketPoller& = delete;
+        auto operator=(SocketPoller&&) noexcept -> SocketPoller& = delete;
+        [[nodiscard]] auto CountSockets() -> size_t;
+
+        private:
+        void PollLoop();
+        void AcceptConnections();
+        void RemoveFinishedSockets();
+
+        // The socket on which we listen for new connections
+        SOCKET listener;
+
+        // Called with each new connection
+        AcceptCallback acceptCallback;
+
+        // The sockets we're servicing
+        std::vector<std::shared_ptr<PolledSocket>> sockets;
+
+        // Protects the sockets
+        std::mutex socketsLock;
+
+        // Should we keep polling
+        std::atomic<bool> polling = true;
+
+        // The I/O thread
+        std::thread pollThread;
+
+        // How long to wait for events before checking for new writes or shutdown
+        static inline const INT POLL_TIMEOUT_MS = 50;
+    };
+} // namespace UKControllerPlugin::Integration
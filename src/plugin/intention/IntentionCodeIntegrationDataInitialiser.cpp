@@ -32,9 +32,9 @@ namespace UKControllerPlugin::IntentionCode {
     {
         pluginLoopbackInterface.ApplyFunctionToAllFlightplans(
             [this, &client](
-                std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface> fp,
-                std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface> rt) {
-                const auto intentionCode = codeGenerator->Generate(*fp, *rt);
+                const Euroscope::EuroScopeCFlightPlanInterface& fp,
+                const Euroscope::EuroScopeCRadarTargetInterface& rt) {
+                const auto intentionCode = codeGenerator->Generate(fp, rt);
                 if (!intentionCode) {
                     return;
                 }
@@ -6,23 +6,26 @@
 #include "PressureQueryCommandHandler.h"
 #include "PressureQueryMessage.h"
 #include "message/UserMessager.h"
+#include "string/TextMatchers.h"
+
+using UKControllerPluginUtils::String::MatchPressureCommand;
 
 namespace UKControllerPlugin::Metar {
 
     PressureQueryCommandHandler::PressureQueryCommandHandler(
         const ParsedMetarCollection& metars, Message::UserMessager& userMessager)
-        : metars(metars), userMessager(userMessager), commandPattern("^\\.ukcp pressure ([A-Z]{4})$")
+        : metars(metars), userMessager(userMessager)
     {
     }
 
     auto PressureQueryCommandHandler::ProcessCommand(std::string command) -> bool
     {
-        std::smatch matches;
-        if (!std::regex_search(command, matches, commandPattern)) {
+        const auto match = MatchPressureCommand(command);
+        if (!match) {
             return false;
         }
 
-        const std::string airfield = matches[1];
+        const std::string airfield(*match);
         const auto metar = this->metars.GetForAirfield(airfield);
         if (metar == nullptr || metar->Components().pressure == nullptr) {
             this->userMessager.SendMessageToUser(PressureNotFoundMessage(airfield));
@@ -20,7 +20,5 @@ namespace UKControllerPlugin::Metar {
 
         // Sends messages to the user
         Message::UserMessager& userMessager;
-
-        const std::regex commandPattern;
     };
 } // namespace UKControllerPlugin::Metar
@@ -61,17 +61,24 @@ namespace UKControllerPlugin::MissedApproach {
             }
 
             // Only display if relevant to us
-            const auto flightplan = this->plugin.GetFlightplanForCallsign(missed->Callsign());
-            const auto radarTarget = this->plugin.GetRadarTargetForCallsign(missed->Callsign());
-
-            if (!flightplan || !radarTarget ||
-                std::find(relevantAirfields.begin(), relevantAirfields.end(), flightplan->GetDestination()) ==
+            std::string destination;
+            EuroScopePlugIn::CPosition radarTargetPosition;
+            if (!this->plugin.ApplyFunctionToFlightplan(
+                    missed->Callsign(),
+                    [&destination](const Euroscope::EuroScopeCFlightPlanInterface& flightplan) {
+                        destination = flightplan.GetDestination();
+                    }) ||
+                !this->plugin.ApplyFunctionToRadarTarget(
+                    missed->Callsign(),
+                    [&radarTargetPosition](const Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
+                        radarTargetPosition = radarTarget.GetPosition();
+                    }) ||
+                std::find(relevantAirfields.begin(), relevantAirfields.end(), destination) ==
                     relevantAirfields.cend()) {
                 return;
             }
 
             // Draw the line if we need to
-            const auto radarTargetPosition = radarTarget->GetPosition();
             const auto screenCoordinate = radarScreen.ConvertCoordinateToScreenPoint(radarTargetPosition);
             Gdiplus::Rect boundingRect{
                 screenCoordinate.x - (CIRCLE_RENDER_SIZE_PX / 2),
@@ -4,6 +4,7 @@
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Dependency::DependencyLoaderInterface;
+using UKControllerPlugin::SectorFile::CoordinateStrings;
 using UKControllerPlugin::SectorFile::ParseSectorFileCoordinates;
 using UKControllerPlugin::SectorFile::PositionIsInvalid;
 
@@ -21,18 +22,32 @@ namespace UKControllerPlugin {
                 return;
             }
 
+            std::vector<const nlohmann::json*> validNavaids;
+            std::vector<CoordinateStrings> coordinates;
             for (nlohmann::json::const_iterator it = navaidData.cbegin(); it != navaidData.cend(); ++it) {
                 if (!NavaidValid(*it)) {
                     LogWarning("Invalid navaid detected " + it->dump());
                     continue;
                 }
 
+                validNavaids.push_back(&*it);
+                coordinates.push_back(
+                    {it->at("latitude").get_ref<const std::string&>(),
+                     it->at("longitude").get_ref<const std::string&>()});
+            }
+
+            // Coordinates are checked once they've all been parsed together
+            const auto positions = ParseSectorFileCoordinates(coordinates);
+            for (size_t i = 0; i < validNavaids.size(); i++) {
+                if (PositionIsInvalid(positions[i])) {
+                    LogWarning("Invalid navaid detected " + validNavaids[i]->dump());
+                    continue;
+                }
+
                 container.navaids->AddNavaid(
-                    {it->at("id").get<int>(),
-                     it->at("identifier").get<std::string>(),
-                     ParseSectorFileCoordinates(
-                         it->at("latitude").get<std::string>().c_str(),
-                         it->at("longitude").get<std::string>().c_str())});
+                    {validNavaids[i]->at("id").get<int>(),
+                     validNavaids[i]->at("identifier").get<std::string>(),
+                     positions[i]});
             }
 
             LogInfo("Loaded " + std::to_string(container.navaids->Count()) + " navaids");
@@ -42,11 +57,7 @@ namespace UKControllerPlugin {
         {
             return navaid.is_object() && navaid.contains("id") && navaid.at("id").is_number_integer() &&
                    navaid.contains("latitude") && navaid.at("latitude").is_string() && navaid.contains("longitude") &&
-                   navaid.at("longitude").is_string() &&
-                   !PositionIsInvalid(ParseSectorFileCoordinates(
-                       navaid.at("latitude").get<std::string>().c_str(),
-                       navaid.at("longitude").get<std::string>().c_str())) &&
-                   navaid.contains("identifier") && navaid.at("identifier").is_string();
+                   navaid.at("longitude").is_string() && navaid.contains("identifier") && navaid.at("identifier").is_string();
         }
     } // namespace Navaids
 } // namespace UKControllerPlugin
@@ -21,8 +21,15 @@ namespace UKControllerPlugin::Oceanic {
         this->taskRunner.QueueAsynchronousTask([this]() {
             LogInfo("Updating oceanic clearance data from Nattrak");
             Curl::CurlRequest apiUpdateRequest(nattrakUrl, Curl::CurlRequest::METHOD_GET);
+            this->nattrakResponses.AddValidators(apiUpdateRequest);
             Curl::CurlResponse apiUpdateResponse = this->curl.MakeCurlRequest(apiUpdateRequest);
 
+            if (!apiUpdateResponse.IsCurlError() && apiUpdateResponse.GetStatusCode() == nattrakNotModified &&
+                this->nattrakResponses.Has(nattrakUrl)) {
+                LogInfo("Oceanic clearance data from Nattrak has not changed");
+                return;
+            }
+
             if (apiUpdateResponse.IsCurlError() || !apiUpdateResponse.StatusOk()) {
                 LogWarning("Unable to retrieve oceanic clearances from Nattrak.");
                 return;
@@ -41,6 +48,8 @@ namespace UKControllerPlugin::Oceanic {
                 return;
             }
 
+            this->nattrakResponses.Store(nattrakUrl, apiUpdateResponse, clearanceData);
+
             // Loop the clearances and update local data
             auto lock = std::lock_guard(this->clearanceMapMutex);
             this->clearances.clear();
@@ -1,5 +1,6 @@
 #pragma once
 #include "Clearance.h"
+#include "api/ApiResponseCache.h"
 #include "tag/TagItemInterface.h"
 #include "timedevent/AbstractTimedEvent.h"
 
@@ -79,11 +80,17 @@ namespace UKControllerPlugin::Oceanic {
         // The URL to find nattrak
         const std::string nattrakUrl = "https://nattrak.vatsim.net/api/plugins";
 
+        // Remembers the validators of the last Nattrak response, so we only process clearances when they change
+        UKControllerPluginUtils::Api::ApiResponseCache nattrakResponses;
+
         // Returned if clearance doesnt exist
         const Clearance invalidClearance = Clearance("NOTAVALIDCLEARANCESORRY");
 
         static const int NATTRAK_EUROSCOPE_FLIGHT_LEVEL_CONVERSION_FACTOR = 100;
 
+        // Nattrak responds with this if the clearances haven't changed since our last request
+        static const uint64_t nattrakNotModified = 304;
+
         // Currently selected Clearance
         Clearance currentlySelectedClearance = this->invalidClearance;
 
@@ -10,6 +10,7 @@
 #include "controller/ControllerPositionParser.h"
 #include "euroscope/EuroScopeCControllerInterface.h"
 #include "message/UserMessager.h"
+#include "string/TextMatchers.h"
 #include "ownership/ServiceProvision.h"
 
 using UKControllerPlugin::Airfield::AirfieldCollection;
@@ -24,6 +25,8 @@ using UKControllerPlugin::Message::UserMessager;
 using UKControllerPlugin::Ownership::AirfieldOwnerQueryMessage;
 using UKControllerPlugin::Ownership::AirfieldOwnershipManager;
 using UKControllerPlugin::Ownership::AirfieldsOwnedQueryMessage;
+using UKControllerPluginUtils::String::MatchAirfieldOwnerCommand;
+using UKControllerPluginUtils::String::MatchAirfieldsOwnedCommand;
 
 namespace UKControllerPlugin::Ownership {
 
@@ -34,14 +37,11 @@ namespace UKControllerPlugin::Ownership {
     }
 
     /*
-        Loops through each of the airfields in the topdown order and refresh who owns them.
+        Refreshes who owns the airfields where the controller appears in the top-down order.
     */
     void AirfieldOwnershipHandler::ProcessAffectedAirfields(const ControllerPosition& controller)
     {
-        std::vector<std::string> topDown = controller.GetTopdown();
-        for (auto it = topDown.begin(); it != topDown.end(); ++it) {
-            this->airfieldOwnership.RefreshOwner(*it);
-        }
+        this->airfieldOwnership.PositionStatusChanged(controller.GetCallsign());
     }
 
     void AirfieldOwnershipHandler::ActiveCallsignAdded(const ActiveCallsign& callsign)
@@ -66,25 +66,23 @@ namespace UKControllerPlugin::Ownership {
     */
     auto AirfieldOwnershipHandler::ProcessCommand(std::string command) -> bool
     {
-        std::regex ownerRegex(".ukcp owner ([A-Za-z]{4})");
-        std::smatch ownerMatches;
-        if (std::regex_search(command, ownerMatches, ownerRegex)) {
-            auto owner = this->airfieldOwnership.GetProviders().DeliveryProviderForAirfield(ownerMatches[1]);
+        if (const auto ownerMatch = MatchAirfieldOwnerCommand(command)) {
+            const std::string airfield(*ownerMatch);
+            auto owner = this->airfieldOwnership.GetProviders().DeliveryProviderForAirfield(airfield);
             if (!owner) {
                 return true;
             }
 
             const auto active = owner->controller;
             this->userMessager.SendMessageToUser(
-                AirfieldOwnerQueryMessage(ownerMatches[1], active->GetCallsign(), active->GetControllerName()));
+                AirfieldOwnerQueryMessage(airfield, active->GetCallsign(), active->GetControllerName()));
             return true;
         }
 
-        std::regex ownedRegex(".ukcp owned ([A-Za-z0-9_-]+)");
-        std::smatch ownedMatches;
-        if (std::regex_search(command, ownedMatches, ownedRegex)) {
-            this->userMessager.SendMessageToUser(AirfieldsOwnedQueryMessage(
-                this->airfieldOwnership.GetOwnedAirfields(ownedMatches[1]), ownedMatches[1]));
+        if (const auto ownedMatch = MatchAirfieldsOwnedCommand(command)) {
+            const std::string callsign(*ownedMatch);
+            this->userMessager.SendMessageToUser(
+                AirfieldsOwnedQueryMessage(this->airfieldOwnership.GetOwnedAirfields(callsign), callsign));
             return true;
         }
 
@@ -20,7 +20,8 @@ namespace UKControllerPlugin::Ownership {
         std::shared_ptr<AirfieldServiceProviderCollection> serviceProviders,
         const AirfieldCollection& airfields,
         const ActiveCallsignCollection& activeCallsigns)
-        : activeCallsigns(activeCallsigns), airfields(airfields), serviceProviders(std::move(serviceProviders))
+        : activeCallsigns(activeCallsigns), airfields(airfields), serviceProviders(std::move(serviceProviders)),
+          topdownIndex(airfields)
     {
     }
 
@@ -30,6 +31,8 @@ namespace UKControllerPlugin::Ownership {
     void AirfieldOwnershipManager::Flush()
     {
         this->serviceProviders->Flush();
+        this->activePositions.clear();
+        this->activePositionsSeeded = false;
     }
 
     /*
@@ -52,7 +55,7 @@ namespace UKControllerPlugin::Ownership {
     }
 
     /*
-        Updates the owner of a given airfield.
+        Updates the owner of a given airfield, rescanning its entire top-down order.
     */
     void AirfieldOwnershipManager::RefreshOwner(const std::string& icao)
     {
@@ -61,18 +64,102 @@ namespace UKControllerPlugin::Ownership {
             return;
         }
 
-        const auto activeControllers = this->GetActiveControllersInAirfieldTopdownOrder(icao, airfield);
-        if (activeControllers.empty()) {
-            LogInfo("Airfield " + icao + " is now uncontrolled");
-            this->serviceProviders->FlushForAirfield(icao);
+        this->SeedActivePositions();
+        this->RefreshActivePositions(*airfield);
+        this->UpdateProviders(icao);
+    }
+
+    /*
+        A position has logged on or off, update only the airfields whose top-down order it appears in.
+    */
+    void AirfieldOwnershipManager::PositionStatusChanged(const std::string& normalisedPosition)
+    {
+        this->SeedActivePositions();
+
+        const bool positionActive = this->activeCallsigns.PositionActive(normalisedPosition);
+        for (const auto& airfield : this->topdownIndex.AirfieldsForPosition(normalisedPosition)) {
+            auto& activeAtAirfield = this->activePositions[airfield.icao];
+            if (positionActive) {
+                activeAtAirfield[airfield.rank] = normalisedPosition;
+            } else {
+                activeAtAirfield.erase(airfield.rank);
+            }
+
+            this->UpdateProviders(airfield.icao);
+        }
+    }
+
+    /*
+        Builds the index and the active positions at every airfield from scratch, if the airfields
+        have changed or we've been flushed.
+    */
+    void AirfieldOwnershipManager::SeedActivePositions()
+    {
+        if (this->activePositionsSeeded && !this->topdownIndex.Stale()) {
+            return;
+        }
+
+        this->topdownIndex.Rebuild();
+        this->activePositions.clear();
+        this->airfields.ForEach(
+            [this](const Airfield::AirfieldModel& airfield) { this->RefreshActivePositions(airfield); });
+        this->activePositionsSeeded = true;
+    }
+
+    void AirfieldOwnershipManager::RefreshActivePositions(const Airfield::AirfieldModel& airfield)
+    {
+        auto& activeAtAirfield = this->activePositions[airfield.Icao()];
+        activeAtAirfield.clear();
+
+        size_t rank = 0;
+        for (const auto& controller : airfield.TopDownOrder()) {
+            if (this->activeCallsigns.PositionActive(controller->GetCallsign())) {
+                activeAtAirfield[rank] = controller->GetCallsign();
+            }
+            rank++;
+        }
+    }
+
+    /*
+        Works out the service providers from the active positions at the airfield, only
+        updating them if something has changed.
+    */
+    void AirfieldOwnershipManager::UpdateProviders(const std::string& icao)
+    {
+        const auto& activeAtAirfield = this->activePositions[icao];
+        if (activeAtAirfield.empty()) {
+            if (!this->serviceProviders->GetServiceProviders(icao).empty()) {
+                LogInfo("Airfield " + icao + " is now uncontrolled");
+                this->serviceProviders->FlushForAirfield(icao);
+            }
+            return;
+        }
+
+        const auto newServiceProviders = this->GetServiceProvidersAtAirfield(activeAtAirfield);
+        if (ProvidersEqual(this->serviceProviders->GetServiceProviders(icao), newServiceProviders)) {
             return;
         }
 
-        const auto newServiceProviders = this->GetServiceProvidersAtAirfield(activeControllers);
         this->LogProviderChanges(icao, newServiceProviders);
         this->serviceProviders->SetProvidersForAirfield(icao, newServiceProviders);
     }
 
+    auto AirfieldOwnershipManager::ProvidersEqual(
+        const std::vector<std::shared_ptr<ServiceProvision>>& first,
+        const std::vector<std::shared_ptr<ServiceProvision>>& second) -> bool
+    {
+        return std::equal(
+            first.cbegin(),
+            first.cend(),
+            second.cbegin(),
+            second.cend(),
+            [](const std::shared_ptr<ServiceProvision>& provision1,
+               const std::shared_ptr<ServiceProvision>& provision2) -> bool {
+                return provision1->serviceProvided == provision2->serviceProvided &&
+                       *provision1->controller == *provision2->controller;
+            });
+    }
+
     auto AirfieldOwnershipManager::ServiceProviderMatchingConditionExists(
         const std::vector<std::shared_ptr<ServiceProvision>>& providers,
         const std::function<bool(const std::shared_ptr<ServiceProvision>& provider)>& predicate) -> bool
@@ -117,19 +204,6 @@ namespace UKControllerPlugin::Ownership {
             " services at " + icao);
     }
 
-    auto AirfieldOwnershipManager::GetActiveControllersInAirfieldTopdownOrder(
-        const std::string& icao, const std::shared_ptr<Airfield::AirfieldModel>& airfield) -> std::vector<std::string>
-    {
-        std::vector<std::string> activeControllers;
-        for (const auto& controller : airfield->TopDownOrder()) {
-            if (this->activeCallsigns.PositionActive(controller->GetCallsign())) {
-                activeControllers.push_back(controller->GetCallsign());
-            }
-        }
-
-        return activeControllers;
-    }
-
     /**
      * This method has the following rationalle:
      *
@@ -146,12 +220,12 @@ namespace UKControllerPlugin::Ownership {
      * - At all levels apart from Delivery and Final Approach, multiple controllers of the same type can provide
      * the same service.
      */
-    auto AirfieldOwnershipManager::GetServiceProvidersAtAirfield(const std::vector<std::string>& controllers)
+    auto AirfieldOwnershipManager::GetServiceProvidersAtAirfield(const std::map<size_t, std::string>& controllers)
         -> std::vector<std::shared_ptr<ServiceProvision>>
     {
         // Generate the new service providers
         std::vector<std::shared_ptr<ServiceProvision>> serviceProviders;
-        for (const auto& controller : controllers) {
+        for (const auto& [rank, controller] : controllers) {
             const auto& leadCallsign = this->activeCallsigns.GetLeadCallsignForPosition(controller);
             const auto& normalisedPosition = leadCallsign.GetNormalisedPosition();
 
@@ -1,4 +1,5 @@
 #pragma once
+#include "AirfieldTopdownIndex.h"
 
 namespace UKControllerPlugin {
     namespace Airfield {
@@ -32,6 +33,7 @@ namespace UKControllerPlugin::Ownership {
         [[nodiscard]] auto GetOwnedAirfields(const std::string& callsign) const
             -> std::vector<std::shared_ptr<UKControllerPlugin::Airfield::AirfieldModel>>;
         void RefreshOwner(const std::string& icao);
+        void PositionStatusChanged(const std::string& normalisedPosition);
         [[nodiscard]] auto GetProviders() const -> const AirfieldServiceProviderCollection&;
 
         private:
@@ -43,10 +45,13 @@ namespace UKControllerPlugin::Ownership {
         static void LogNewServiceProvision(const std::string& icao, const std::shared_ptr<ServiceProvision>& provision);
         static void
         LogRemovedServiceProvision(const std::string& icao, const std::shared_ptr<ServiceProvision>& provision);
-        [[nodiscard]] auto GetActiveControllersInAirfieldTopdownOrder(
-            const std::string& icao, const std::shared_ptr<Airfield::AirfieldModel>& airfield)
-            -> std::vector<std::string>;
-        [[nodiscard]] auto GetServiceProvidersAtAirfield(const std::vector<std::string>& controllers)
+        [[nodiscard]] static auto ProvidersEqual(
+            const std::vector<std::shared_ptr<ServiceProvision>>& first,
+            const std::vector<std::shared_ptr<ServiceProvision>>& second) -> bool;
+        void SeedActivePositions();
+        void RefreshActivePositions(const Airfield::AirfieldModel& airfield);
+        void UpdateProviders(const std::string& icao);
+        [[nodiscard]] auto GetServiceProvidersAtAirfield(const std::map<size_t, std::string>& controllers)
             -> std::vector<std::shared_ptr<ServiceProvision>>;
         void
         LogProviderChanges(const std::string& icao, const std::vector<std::shared_ptr<ServiceProvision>>& newProviders);
@@ -59,5 +64,14 @@ namespace UKControllerPlugin::Ownership {
 
         // Who's providing services
         const std::shared_ptr<AirfieldServiceProviderCollection> serviceProviders;
+
+        // Which airfields each position covers, and where
+        AirfieldTopdownIndex topdownIndex;
+
+        // For each airfield, the active positions keyed by their rank in the top-down order
+        std::unordered_map<std::string, std::map<size_t, std::string>> activePositions;
+
+        // Whether the active positions reflect the active callsigns
+        bool activePositionsSeeded = false;
     };
 } // namespace UKControllerPlugin::Ownership
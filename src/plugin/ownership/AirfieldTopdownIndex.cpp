@@ -0,0 +1,46 @@
+#include "AirfieldTopdownIndex.h"
+#include "airfield/AirfieldCollection.h"
+#include "airfield/AirfieldModel.h"
+#include "controller/ControllerPosition.h"
+#include "controller/ControllerPositionHierarchy.h"
+
+namespace UKControllerPlugin::Ownership {
+
+    AirfieldTopdownIndex::AirfieldTopdownIndex(const Airfield::AirfieldCollection& airfields) : airfields(airfields)
+    {
+    }
+
+    auto AirfieldTopdownIndex::AirfieldsForPosition(const std::string& position) const
+        -> const std::vector<AirfieldTopdownRank>&
+    {
+        const auto airfieldsForPosition = positionAirfields.find(position);
+        return airfieldsForPosition == positionAirfields.cend() ? noAirfields : airfieldsForPosition->second;
+    }
+
+    auto AirfieldTopdownIndex::CountPositions() const -> size_t
+    {
+        return positionAirfields.size();
+    }
+
+    /*
+        Airfields are loaded after the index is created, so if the number of airfields has
+        changed, the index needs rebuilding.
+    */
+    auto AirfieldTopdownIndex::Stale() const -> bool
+    {
+        return airfields.GetSize() != indexedAirfields;
+    }
+
+    void AirfieldTopdownIndex::Rebuild()
+    {
+        positionAirfields.clear();
+        airfields.ForEach([this](const Airfield::AirfieldModel& airfield) {
+            size_t rank = 0;
+            for (const auto& position : airfield.TopDownOrder()) {
+                positionAirfields[position->GetCallsign()].push_back({airfield.Icao(), rank++});
+            }
+        });
+
+        indexedAirfields = airfields.GetSize();
+    }
+} // namespace UKControllerPlugin::Ownership
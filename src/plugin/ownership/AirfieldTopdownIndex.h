@@ -0,0 +1,50 @@
+#pragma once
+
+namespace UKControllerPlugin::Airfield {
+    class AirfieldCollection;
+} // namespace UKControllerPlugin::Airfield
+
+namespace UKControllerPlugin::Ownership {
+
+    /*
+        Where a controller position appears in the top-down order of an airfield.
+        Lower ranks are higher priority.
+    */
+    using AirfieldTopdownRank = struct AirfieldTopdownRank
+    {
+        // The airfield
+        std::string icao;
+
+        // Position in the top-down order
+        size_t rank;
+    };
+
+    /*
+        An inverted index of the airfield top-down orders, so that we can go straight from a
+        controller position to the airfields (and their position in the order) that it covers,
+        without walking every airfield's hierarchy.
+    */
+    class AirfieldTopdownIndex
+    {
+        public:
+        explicit AirfieldTopdownIndex(const Airfield::AirfieldCollection& airfields);
+        [[nodiscard]] auto AirfieldsForPosition(const std::string& position) const
+            -> const std::vector<AirfieldTopdownRank>&;
+        [[nodiscard]] auto CountPositions() const -> size_t;
+        [[nodiscard]] auto Stale() const -> bool;
+        void Rebuild();
+
+        private:
+        // All the airfields
+        const Airfield::AirfieldCollection& airfields;
+
+        // How many airfields there were when we last built the index
+        size_t indexedAirfields = 0;
+
+        // Normalised position callsign to the airfields it covers
+        std::unordered_map<std::string, std::vector<AirfieldTopdownRank>> positionAirfields;
+
+        // Returned for positions that don't cover any airfields
+        const std::vector<AirfieldTopdownRank> noAirfields;
+    };
+} // namespace UKControllerPlugin::Ownership
@@ -35,8 +35,11 @@ using std::min;
 #include <Shobjidl.h>
 #include <algorithm>
 #include <any>
+#include <atomic>
 #include <cctype>
+#include <charconv>
 #include <codecvt>
+#include <condition_variable>
 #include <ctime>
 #include <filesystem>
 #include <fstream>
@@ -52,13 +55,16 @@ using std::min;
 #include <mmsystem.h>
 #include <mutex>
 #include <queue>
+#include <random>
 #include <regex>
 #include <set>
 #include <shellapi.h>
 #include <shtypes.h>
+#include <span>
 #include <sstream>
 #include <string>
 #include <tchar.h>
+#include <thread>
 #include <type_traits>
 #include <typeindex>
 #include <unordered_map>
@@ -10,6 +10,7 @@
 #include "euroscope/EuroscopeFlightplanListWrapper.h"
 #include "euroscope/EuroscopeSectorFileElementWrapper.h"
 #include "euroscope/RadarTargetEventHandlerCollection.h"
+#include "euroscope/WrapperAllocationCounter.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "radarscreen/UKRadarScreen.h"
 #include "tag/TagData.h"
@@ -32,6 +33,7 @@ using UKControllerPlugin::Euroscope::EuroscopeSectorFileElementInterface;
 using UKControllerPlugin::Euroscope::EuroscopeSectorFileElementWrapper;
 using UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection;
 using UKControllerPlugin::Euroscope::RunwayDialogAwareCollection;
+using UKControllerPlugin::Euroscope::WrapperAllocationCounter;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::Plugin::FunctionCallEventHandler;
 using UKControllerPlugin::Plugin::PluginVersion;
@@ -48,13 +50,14 @@ namespace UKControllerPlugin {
         const RadarTargetEventHandlerCollection& radarTargetEventHandler,
         const FlightPlanEventHandlerCollection& flightplanEventHandler,
         const ControllerStatusEventHandlerCollection& statusEventHandler,
-        const TimedEventCollection& timedEvents,
+        TimedEventCollection& timedEvents,
         const TagItemCollection& tagEvents,
         RadarScreenFactory radarScreenFactory,
         const FunctionCallEventHandler& functionCallHandler,
         const CommandHandlerCollection& commandHandlers,
         const RunwayDialogAwareCollection& runwayDialogHandlers,
-        const HandoffEventHandlerCollection& controllerHandoffHandlers)
+        const HandoffEventHandlerCollection& controllerHandoffHandlers,
+        WrapperAllocationCounter& wrapperAllocations)
         : UKPlugin::CPlugIn(
               EuroScopePlugIn::COMPATIBILITY_CODE,
               PluginVersion::title,
@@ -65,7 +68,8 @@ namespace UKControllerPlugin {
           statusEventHandler(statusEventHandler), timedEvents(timedEvents),
           radarScreenFactory(std::move(radarScreenFactory)), tagEvents(tagEvents),
           functionCallHandler(functionCallHandler), commandHandlers(commandHandlers),
-          runwayDialogHandlers(runwayDialogHandlers), controllerHandoffHandlers(controllerHandoffHandlers)
+          runwayDialogHandlers(runwayDialogHandlers), controllerHandoffHandlers(controllerHandoffHandlers),
+          wrapperAllocations(wrapperAllocations)
 
     {
     }
@@ -279,6 +283,7 @@ namespace UKControllerPlugin {
             return nullptr;
         }
 
+        this->wrapperAllocations.Allocated();
         return std::make_shared<EuroScopeCFlightPlanWrapper>(plan);
     }
 
@@ -294,9 +299,46 @@ namespace UKControllerPlugin {
             return nullptr;
         }
 
+        this->wrapperAllocations.Allocated();
         return std::make_shared<EuroScopeCRadarTargetWrapper>(target);
     }
 
+    /*
+        Passes the flightplan for a given callsign to the function, wrapped on the stack rather than the heap.
+        Returns false if there is no flightplan.
+    */
+    auto UKPlugin::ApplyFunctionToFlightplan(
+        const std::string& callsign, const std::function<void(const EuroScopeCFlightPlanInterface&)>& function) const
+        -> bool
+    {
+        EuroScopePlugIn::CFlightPlan plan = this->FlightPlanSelect(callsign.c_str());
+
+        if (!plan.IsValid()) {
+            return false;
+        }
+
+        function(EuroScopeCFlightPlanWrapper(plan));
+        return true;
+    }
+
+    /*
+        Passes the radar target for a given callsign to the function, wrapped on the stack rather than the heap.
+        Returns false if there is no radar target.
+    */
+    auto UKPlugin::ApplyFunctionToRadarTarget(
+        const std::string& callsign, const std::function<void(const EuroScopeCRadarTargetInterface&)>& function) const
+        -> bool
+    {
+        EuroScopePlugIn::CRadarTarget target = this->RadarTargetSelect(callsign.c_str());
+
+        if (!target.IsValid()) {
+            return false;
+        }
+
+        function(EuroScopeCRadarTargetWrapper(target));
+        return true;
+    }
+
     /*
         Returns the currently selected flightplan
     */
@@ -308,6 +350,7 @@ namespace UKControllerPlugin {
             return nullptr;
         }
 
+        this->wrapperAllocations.Allocated();
         return std::make_shared<EuroScopeCFlightPlanWrapper>(fp);
     }
 
@@ -322,6 +365,7 @@ namespace UKControllerPlugin {
             return nullptr;
         }
 
+        this->wrapperAllocations.Allocated();
         return std::make_shared<EuroScopeCRadarTargetWrapper>(rt);
     }
 
@@ -549,6 +593,8 @@ namespace UKControllerPlugin {
                 continue;
             }
 
+            this->wrapperAllocations.Allocated();
+            this->wrapperAllocations.Allocated();
             function(
                 std::make_shared<EuroScopeCFlightPlanWrapper>(current),
                 std::make_shared<EuroScopeCRadarTargetWrapper>(rt));
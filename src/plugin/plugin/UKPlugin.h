@@ -17,6 +17,7 @@ namespace UKControllerPlugin {
         class AsrEventHandlerCollection;
         class RadarTargetEventHandlerCollection;
         class RadarTargetEventHandlerInterface;
+        class WrapperAllocationCounter;
     } // namespace Euroscope
     namespace TaskManager {
         class TaskRunner;
@@ -66,13 +67,14 @@ namespace UKControllerPlugin {
             const Euroscope::RadarTargetEventHandlerCollection& radarTargetEventHandler,
             const Flightplan::FlightPlanEventHandlerCollection& flightplanEventHandler,
             const Controller::ControllerStatusEventHandlerCollection& statusEventHandler,
-            const TimedEvent::TimedEventCollection& timedEvents,
+            TimedEvent::TimedEventCollection& timedEvents,
             const Tag::TagItemCollection& tagEvents,
             RadarScreen::RadarScreenFactory radarScreenFactory,
             const Plugin::FunctionCallEventHandler& functionCallHandler,
             const Command::CommandHandlerCollection& commandHandlers,
             const Euroscope::RunwayDialogAwareCollection& runwayDialogHandlers,
-            const Controller::HandoffEventHandlerCollection& controllerHandoffHandlers);
+            const Controller::HandoffEventHandlerCollection& controllerHandoffHandlers,
+            Euroscope::WrapperAllocationCounter& wrapperAllocations);
         void AddItemToPopupList(Plugin::PopupMenuItem item) override;
         void ChatAreaMessage(
             std::string handler,
@@ -90,6 +92,14 @@ namespace UKControllerPlugin {
             -> std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface> override;
         auto GetRadarTargetForCallsign(std::string callsign) const
             -> std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface> override;
+        auto ApplyFunctionToFlightplan(
+            const std::string& callsign,
+            const std::function<void(const Euroscope::EuroScopeCFlightPlanInterface&)>& function) const
+            -> bool override;
+        auto ApplyFunctionToRadarTarget(
+            const std::string& callsign,
+            const std::function<void(const Euroscope::EuroScopeCRadarTargetInterface&)>& function) const
+            -> bool override;
         auto GetSelectedFlightplan() const -> std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface> override;
         auto GetSelectedRadarTarget() const -> std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface> override;
         auto OnCompileCommand(const char* command) -> bool override;
@@ -171,7 +181,7 @@ namespace UKControllerPlugin {
         const Controller::ControllerStatusEventHandlerCollection& statusEventHandler;
 
         // Timed events
-        const TimedEvent::TimedEventCollection& timedEvents;
+        TimedEvent::TimedEventCollection& timedEvents;
 
         // Factory for creating radar screens
         const RadarScreen::RadarScreenFactory radarScreenFactory;
@@ -191,6 +201,9 @@ namespace UKControllerPlugin {
         // Handles handoffs between controllers
         const Controller::HandoffEventHandlerCollection& controllerHandoffHandlers;
 
+        // Counts how many flightplan and radar target wrappers we put on the heap
+        Euroscope::WrapperAllocationCounter& wrapperAllocations;
+
         // Whether or not we've initialised the plugin.
         bool initialised = false;
     }; // namespace Windows
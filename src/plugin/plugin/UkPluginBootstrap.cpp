@@ -1,10 +1,13 @@
 #include "UKPlugin.h"
 #include "UkPluginBootstrap.h"
 #include "bootstrap/PersistenceContainer.h"
+#include "euroscope/WrapperAllocationCounter.h"
 #include "radarscreen/RadarScreenFactory.h"
+#include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::UKPlugin;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Euroscope::WrapperAllocationCounter;
 using UKControllerPlugin::RadarScreen::RadarScreenFactory;
 namespace UKControllerPlugin::Bootstrap {
 
@@ -13,6 +16,9 @@ namespace UKControllerPlugin::Bootstrap {
     */
     void UkPluginBootstrap::BootstrapPlugin(PersistenceContainer& persistence)
     {
+        persistence.wrapperAllocations = std::make_shared<WrapperAllocationCounter>();
+        persistence.timedHandler->RegisterEvent(persistence.wrapperAllocations, wrapperAllocationSampleFrequency);
+
         persistence.plugin.reset(new UKPlugin(
             *persistence.radarTargetHandler,
             *persistence.flightplanHandler,
@@ -23,6 +29,7 @@ namespace UKControllerPlugin::Bootstrap {
             *persistence.pluginFunctionHandlers,
             *persistence.commandHandlers,
             *persistence.runwayDialogEventHandlers,
-            *persistence.controllerHandoffHandlers));
+            *persistence.controllerHandoffHandlers,
+            *persistence.wrapperAllocations));
     }
 } // namespace UKControllerPlugin::Bootstrap
@@ -10,5 +10,8 @@ namespace UKControllerPlugin::Bootstrap {
     {
         public:
         static void BootstrapPlugin(UKControllerPlugin::Bootstrap::PersistenceContainer& persistence);
+
+        // How often, in seconds, to work out the rate of EuroScope wrapper allocations
+        static const int wrapperAllocationSampleFrequency = 60;
     };
 } // namespace UKControllerPlugin::Bootstrap
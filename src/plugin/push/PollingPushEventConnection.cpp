@@ -1,6 +1,7 @@
 #include "push/PollingPushEventConnection.h"
 
 #include "PushEventProcessorCollection.h"
+#include "api/ApiHealthTracker.h"
 #include "api/ApiInterface.h"
 #include "task/TaskRunnerInterface.h"
 #include "api/ApiException.h"
@@ -11,8 +12,9 @@ namespace UKControllerPlugin {
         PollingPushEventConnection::PollingPushEventConnection(
             const Api::ApiInterface& api,
             TaskManager::TaskRunnerInterface& taskRunner,
-            const PushEventProcessorCollection& pushEventHandlers)
-            : api(api), taskRunner(taskRunner), pushEventHandlers(pushEventHandlers)
+            const PushEventProcessorCollection& pushEventHandlers,
+            std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> apiHealth)
+            : api(api), taskRunner(taskRunner), pushEventHandlers(pushEventHandlers), apiHealth(std::move(apiHealth))
         {
         }
 
@@ -41,6 +43,12 @@ namespace UKControllerPlugin {
                 return;
             }
 
+            // The endpoint we need is having problems, so wait until it's worth trying again.
+            const auto& endpoint = this->lastEventId == -1 ? syncEndpoint : latestEventsEndpoint;
+            if (this->apiHealth && this->apiHealth->RetryDelay(endpoint) > std::chrono::milliseconds(0)) {
+                return;
+            }
+
             // Either sync, or get latest events, depending on whether we've synced successfully
             if (this->lastEventId == -1) {
                 this->SyncEvents();
@@ -179,5 +187,18 @@ namespace UKControllerPlugin {
         {
             return this->lastEventId;
         }
+
+        /*
+         * Carry on polling from an event that's already been received elsewhere, rather than syncing.
+         */
+        void PollingPushEventConnection::ResumeFrom(int eventId)
+        {
+            this->lastEventId = eventId;
+        }
+
+        bool PollingPushEventConnection::RequestInProgress() const
+        {
+            return this->syncInProgress || this->updateInProgress;
+        }
     } // namespace Push
 } // namespace UKControllerPlugin
@@ -2,6 +2,10 @@
 #include "push/PushEventConnectionInterface.h"
 #include "timedevent/AbstractTimedEvent.h"
 
+namespace UKControllerPluginUtils::Api {
+    class ApiHealthTracker;
+} // namespace UKControllerPluginUtils::Api
+
 namespace UKControllerPlugin {
 
     namespace Api {
@@ -25,7 +29,8 @@ namespace UKControllerPlugin {
             PollingPushEventConnection(
                 const Api::ApiInterface& api,
                 TaskManager::TaskRunnerInterface& taskRunner,
-                const PushEventProcessorCollection& pushEventHandlers);
+                const PushEventProcessorCollection& pushEventHandlers,
+                std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> apiHealth = nullptr);
 
             // Inherited from WebsocketConnectionInterface
             void WriteMessage(std::string message) override;
@@ -42,10 +47,18 @@ namespace UKControllerPlugin {
             void SetUpdateInProgress();
             void SetSynced();
             int LastEventId() const;
+            void ResumeFrom(int eventId);
+            bool RequestInProgress() const;
 
             // How often we should poll for new updates
             const std::chrono::duration<int64_t> pollInterval = std::chrono::seconds(10);
 
+            // The endpoint we sync events from, so we can check on its health
+            inline static const std::string syncEndpoint = "plugin-events/sync";
+
+            // The endpoint we get the latest events from, so we can check on its health
+            inline static const std::string latestEventsEndpoint = "plugin-events/recent";
+
             private:
             void SyncEvents();
             void GetLatestEvents();
@@ -77,6 +90,9 @@ namespace UKControllerPlugin {
 
             // Push event handlers
             const PushEventProcessorCollection& pushEventHandlers;
+
+            // Tells us when the API is having problems, so we can back off polling
+            std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> apiHealth;
         };
     } // namespace Push
 } // namespace UKControllerPlugin
@@ -1,10 +1,12 @@
 #include "ProxyPushDataSync.h"
 #include "PushEventProcessorCollection.h"
+#include "SharedSyncData.h"
 
 namespace UKControllerPlugin::Push {
 
-    ProxyPushDataSync::ProxyPushDataSync(const PushEventProcessorCollection& processors)
-        : processors(processors), synced(false)
+    ProxyPushDataSync::ProxyPushDataSync(
+        const PushEventProcessorCollection& processors, std::shared_ptr<SharedSyncData> sharedSync)
+        : processors(processors), sharedSync(std::move(sharedSync)), synced(false)
     {
     }
 
@@ -14,6 +16,20 @@ namespace UKControllerPlugin::Push {
             return;
         }
 
+        if (this->sharedSync && !this->sharedSync->Ready()) {
+            if (!this->sharedSyncRequested) {
+                this->sharedSync->RequestRefresh();
+                this->sharedSyncRequested = std::chrono::system_clock::now();
+                return;
+            }
+
+            if (std::chrono::system_clock::now() - *this->sharedSyncRequested < sharedSyncTimeout) {
+                return;
+            }
+
+            LogWarning("Timed out waiting for the primary instance to share its sync data");
+        }
+
         LogInfo("Syncing proxy push event data");
         processors.PluginEventsSynced();
         synced = true;
@@ -3,22 +3,36 @@
 
 namespace UKControllerPlugin::Push {
     class PushEventProcessorCollection;
+    class SharedSyncData;
 
     /*
      * When proxy connections are created, we need to make sure their data is synced (more or less)
      * with the API. This handler triggers on a timer once ES is loaded (so we know all the handlers are registered)
      * and triggers their synced event.
+     *
+     * If the primary instance shares its sync data, we ask it for fresh data first and wait a while for
+     * it to arrive, so that the handlers can use it rather than each asking the API.
      */
     class ProxyPushDataSync : public TimedEvent::AbstractTimedEvent
     {
         public:
-        ProxyPushDataSync(const PushEventProcessorCollection& processors);
+        ProxyPushDataSync(
+            const PushEventProcessorCollection& processors, std::shared_ptr<SharedSyncData> sharedSync = nullptr);
         void TimedEventTrigger() override;
 
+        // How long to wait for the primary to share its sync data
+        static inline const std::chrono::seconds sharedSyncTimeout = std::chrono::seconds(15);
+
         private:
         // All the push event processors
         const PushEventProcessorCollection& processors;
 
+        // Data shared by the primary instance
+        std::shared_ptr<SharedSyncData> sharedSync;
+
+        // When we asked the primary to share its sync data
+        std::optional<std::chrono::system_clock::time_point> sharedSyncRequested;
+
         // Has the sync been done
         bool synced;
     };
@@ -1,36 +1,74 @@
-#include "PollingPushEventConnection.h"
 #include "ProxyPushDataSync.h"
 #include "PushEventBootstrap.h"
 #include "PushEventProtocolHandler.h"
 #include "PushEventProxyConnection.h"
 #include "PushEventProxyHandler.h"
+#include "PushEventRingBuffer.h"
+#include "SharedMemoryMapping.h"
+#include "SharedSyncData.h"
+#include "StreamingPushEventConnection.h"
+#include "SyncSnapshotStore.h"
 #include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 
 namespace UKControllerPlugin::Push {
 
+    namespace {
+        /*
+            Map the memory that push events and sync data are shared through. The events come first, followed by
+            the sync data. If we can't, each instance carries on as if it were on its own.
+        */
+        auto BootstrapSharedMemory(
+            PersistenceContainer& container, bool duplicatePlugin, const std::wstring& sharedMemoryName)
+            -> std::shared_ptr<PushEventRingBuffer>
+        {
+            const size_t eventsSize = PushEventRingBuffer::RequiredSize();
+            container.sharedPushEventMemory = std::make_shared<SharedMemoryMapping>(
+                sharedMemoryName, eventsSize + SyncSnapshotStore::RequiredSize());
+            if (!container.sharedPushEventMemory->Valid()) {
+                container.sharedPushEventMemory.reset();
+                return nullptr;
+            }
+
+            auto* memory = static_cast<char*>(container.sharedPushEventMemory->Memory());
+            const auto events = std::make_shared<PushEventRingBuffer>(memory);
+            const auto snapshots = std::make_shared<SyncSnapshotStore>(memory + eventsSize);
+            if (!duplicatePlugin) {
+                events->Initialise();
+                snapshots->Initialise();
+            }
+
+            container.sharedPushSync = std::make_shared<SharedSyncData>(snapshots, events, !duplicatePlugin);
+            return events;
+        }
+    } // namespace
+
     /*
         Bootstrap up the websocket.
     */
-    void BootstrapPlugin(PersistenceContainer& container, bool duplicatePlugin)
+    void BootstrapPlugin(PersistenceContainer& container, bool duplicatePlugin, const std::wstring& sharedMemoryName)
     {
         std::shared_ptr<PushEventConnectionInterface> pushEvents;
 
         // Set up handler collection
         container.pushEventProcessors = std::make_shared<PushEventProcessorCollection>();
+        const auto sharedEvents = BootstrapSharedMemory(container, duplicatePlugin, sharedMemoryName);
 
         // Create a websocket connection depending on whether we're the main plugin
         if (duplicatePlugin) {
-            pushEvents = std::make_shared<PushEventProxyConnection>();
+            pushEvents = std::make_shared<PushEventProxyConnection>(sharedEvents);
             container.timedHandler->RegisterEvent(
-                std::make_shared<ProxyPushDataSync>(*container.pushEventProcessors), 5);
+                std::make_shared<ProxyPushDataSync>(*container.pushEventProcessors, container.sharedPushSync), 5);
         } else {
-            const auto pollingEvents = std::make_shared<PollingPushEventConnection>(
-                *container.api, *container.taskRunner, *container.pushEventProcessors);
-            pushEvents = pollingEvents;
-            container.pushEventProcessors->AddProcessor(std::make_shared<PushEventProxyHandler>());
-            container.timedHandler->RegisterEvent(pollingEvents, 1);
+            const auto streamedEvents = std::make_shared<StreamingPushEventConnection>(
+                *container.api, *container.taskRunner, *container.pushEventProcessors, container.apiHealth);
+            pushEvents = streamedEvents;
+            container.pushEventProcessors->AddProcessor(std::make_shared<PushEventProxyHandler>(sharedEvents));
+            container.timedHandler->RegisterEvent(streamedEvents, 1);
+            if (container.sharedPushSync) {
+                container.timedHandler->RegisterEvent(container.sharedPushSync, 5);
+            }
         }
 
         container.timedHandler->RegisterEvent(
@@ -4,7 +4,10 @@
 namespace UKControllerPlugin {
     namespace Push {
 
-        void BootstrapPlugin(Bootstrap::PersistenceContainer& container, bool duplicatePlugin);
+        void BootstrapPlugin(
+            Bootstrap::PersistenceContainer& container,
+            bool duplicatePlugin,
+            const std::wstring& sharedMemoryName = L"Local\\UKControllerPluginPushEvents");
 
     } // namespace Push
 } // namespace UKControllerPlugin
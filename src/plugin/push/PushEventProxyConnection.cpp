@@ -1,10 +1,17 @@
 #include "push/PushEventProxyConnection.h"
+#include "push/PushEventRingBuffer.h"
 
 namespace UKControllerPlugin {
     namespace Push {
 
-        PushEventProxyConnection::PushEventProxyConnection()
+        PushEventProxyConnection::PushEventProxyConnection(std::shared_ptr<PushEventRingBuffer> sharedEvents)
+            : sharedEvents(std::move(sharedEvents))
         {
+            // Only read events shared from now on, the sync will take care of anything older
+            if (this->sharedEvents) {
+                this->nextSharedEvent = this->sharedEvents->LatestSequence() + 1;
+            }
+
             RegisterClass(&this->windowClass);
 
             this->hiddenWindow = CreateWindow(
@@ -44,7 +51,11 @@ namespace UKControllerPlugin {
         {
             std::lock_guard lock(this->messageLock);
             if (this->messages.empty()) {
-                return this->noMessage;
+                if (!this->sharedEvents) {
+                    return this->noMessage;
+                }
+
+                return this->sharedEvents->Read(this->nextSharedEvent).value_or(this->noMessage);
             }
 
             std::string message = this->messages.front();
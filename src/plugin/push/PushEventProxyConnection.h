@@ -4,13 +4,18 @@
 
 namespace UKControllerPlugin {
     namespace Push {
+        class PushEventRingBuffer;
+
         /*
             Receives messages from external sources and passes them on.
+
+            Messages shared by the primary instance are read from shared memory, larger ones arrive
+            at the hidden window.
         */
         class PushEventProxyConnection : public PushEventConnectionInterface
         {
             public:
-            PushEventProxyConnection();
+            explicit PushEventProxyConnection(std::shared_ptr<PushEventRingBuffer> sharedEvents = nullptr);
             ~PushEventProxyConnection() override;
 
             void AddMessageToQueue(std::string message);
@@ -42,6 +47,12 @@ namespace UKControllerPlugin {
                 nullptr,
                 L"UKControllerPluginPushEventProxyClass"};
 
+            // Push events shared by the primary instance
+            std::shared_ptr<PushEventRingBuffer> sharedEvents;
+
+            // The next shared push event we want to read
+            uint64_t nextSharedEvent = 0;
+
             // The command we should receive if a new message is sent
             std::string newMessageCommand = ".ukcp msg ";
         };
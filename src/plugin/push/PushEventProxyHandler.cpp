@@ -1,13 +1,23 @@
 #include "PushEventProxyHandler.h"
 #include "PushEventProxyWindow.h"
+#include "PushEventRingBuffer.h"
 
 namespace UKControllerPlugin::Push {
 
+    PushEventProxyHandler::PushEventProxyHandler(std::shared_ptr<PushEventRingBuffer> sharedEvents)
+        : sharedEvents(std::move(sharedEvents))
+    {
+    }
+
     /*
         Handle the ping messages by responding with pong.
     */
     void PushEventProxyHandler::ProcessPushEvent(const PushEvent& message)
     {
+        if (this->sharedEvents && this->sharedEvents->Write(message.raw)) {
+            return;
+        }
+
         // Proxy the push event to any proxies listening - in regular string
         COPYDATASTRUCT cds;
         cds.dwData = GetPushEventProxyMessageIdentifier();
@@ -3,13 +3,19 @@
 #include "push/PushEventProcessorInterface.h"
 
 namespace UKControllerPlugin::Push {
+    class PushEventRingBuffer;
+
     /**
      *  Handles push events proxied to a secondary plugin
      *  from the primary instance.
+     *
+     *  Events are written once to shared memory for all secondaries to read. Anything
+     *  too big for that is sent to each secondary's proxy window instead.
      */
     class PushEventProxyHandler : public PushEventProcessorInterface
     {
         public:
+        explicit PushEventProxyHandler(std::shared_ptr<PushEventRingBuffer> sharedEvents = nullptr);
         void ProcessPushEvent(const PushEvent& message) override;
         [[nodiscard]] auto GetPushEventSubscriptions() const -> std::set<PushEventSubscription> override;
         void PluginEventsSynced() override;
@@ -18,5 +24,8 @@ namespace UKControllerPlugin::Push {
         static auto CALLBACK EnumerateWindows(HWND hwnd, LPARAM lparam) -> BOOL;
 
         static const int WINDOW_NAME_BUFFER_SIZE = 1000;
+
+        // Push events shared with the secondaries
+        std::shared_ptr<PushEventRingBuffer> sharedEvents;
     };
 } // namespace UKControllerPlugin::Push
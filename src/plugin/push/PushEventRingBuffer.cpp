@@ -0,0 +1,149 @@
+#include "PushEventRingBuffer.h"
+
+namespace UKControllerPlugin::Push {
+
+    namespace {
+        // Identifies memory that has been set up as a ring
+        const uint32_t RING_MAGIC = 0x554B5052; // NOLINT
+
+        struct RingHeader
+        {
+            uint32_t magic;
+            uint32_t slotCount;
+            uint32_t slotSize;
+            uint32_t padding;
+            uint64_t writeSequence;
+        };
+
+        // Each slot is followed by the message itself. The sequence is zero whilst the slot is being written.
+        struct RingSlot
+        {
+            uint64_t sequence;
+            uint32_t length;
+            uint32_t padding;
+        };
+
+        template <typename T>
+        auto Atomic(T& value) -> std::atomic_ref<T>
+        {
+            return std::atomic_ref<T>(value);
+        }
+    } // namespace
+
+    PushEventRingBuffer::PushEventRingBuffer(void* memory, uint32_t slotCount, uint32_t slotSize)
+        : memory(static_cast<char*>(memory)), slotCount(slotCount), slotSize(slotSize)
+    {
+        assert(slotSize % alignof(RingSlot) == 0 && "Slot size must keep slots aligned");
+    }
+
+    auto PushEventRingBuffer::RequiredSize(uint32_t slotCount, uint32_t slotSize) -> size_t
+    {
+        return sizeof(RingHeader) + static_cast<size_t>(slotCount) * (sizeof(RingSlot) + slotSize);
+    }
+
+    /*
+        Called by the writer before it writes anything. If the ring is already set up, because a previous writer
+        has been and gone, we carry on from where it got to so readers don't lose their place.
+    */
+    void PushEventRingBuffer::Initialise()
+    {
+        auto* header = reinterpret_cast<RingHeader*>(this->memory); // NOLINT
+        if (this->Initialised()) {
+            return;
+        }
+
+        std::memset(this->memory, 0, RequiredSize(this->slotCount, this->slotSize));
+        header->slotCount = this->slotCount;
+        header->slotSize = this->slotSize;
+        Atomic(header->magic).store(RING_MAGIC, std::memory_order_release);
+    }
+
+    auto PushEventRingBuffer::Initialised() const -> bool
+    {
+        auto* header = reinterpret_cast<RingHeader*>(this->memory); // NOLINT
+        return Atomic(header->magic).load(std::memory_order_acquire) == RING_MAGIC &&
+               header->slotCount == this->slotCount && header->slotSize == this->slotSize;
+    }
+
+    auto PushEventRingBuffer::Slot(uint64_t sequence) const -> char*
+    {
+        return this->memory + sizeof(RingHeader) + (sequence % this->slotCount) * (sizeof(RingSlot) + this->slotSize);
+    }
+
+    /*
+        Only the primary instance writes, so there's no need to coordinate with other writers. Messages
+        that are too big for a slot aren't written, so the caller can send them another way.
+    */
+    auto PushEventRingBuffer::Write(const std::string& message) -> bool
+    {
+        if (!this->Initialised() || message.size() > this->slotSize) {
+            return false;
+        }
+
+        auto* header = reinterpret_cast<RingHeader*>(this->memory); // NOLINT
+        const uint64_t sequence = Atomic(header->writeSequence).load(std::memory_order_relaxed) + 1;
+        char* slotMemory = this->Slot(sequence);
+        auto* slot = reinterpret_cast<RingSlot*>(slotMemory); // NOLINT
+
+        Atomic(slot->sequence).store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->length = static_cast<uint32_t>(message.size());
+        std::memcpy(slotMemory + sizeof(RingSlot), message.data(), message.size());
+        Atomic(slot->sequence).store(sequence, std::memory_order_release);
+        Atomic(header->writeSequence).store(sequence, std::memory_order_release);
+        return true;
+    }
+
+    /*
+        Reads the message with the given sequence, if it's been written, and moves the reader on to the next.
+        The slot's sequence is checked before and after copying the message, so we know the writer didn't
+        overwrite it whilst we were reading.
+    */
+    auto PushEventRingBuffer::Read(uint64_t& nextSequence) const -> std::optional<std::string>
+    {
+        if (!this->Initialised()) {
+            return std::nullopt;
+        }
+
+        auto* header = reinterpret_cast<RingHeader*>(this->memory); // NOLINT
+        for (int attempt = 0; attempt < maxReadAttempts; attempt++) {
+            const uint64_t latest = Atomic(header->writeSequence).load(std::memory_order_acquire);
+            if (nextSequence > latest) {
+                return std::nullopt;
+            }
+
+            if (latest - nextSequence >= this->slotCount) {
+                LogWarning(
+                    "Missed " + std::to_string(latest - nextSequence - this->slotCount + 1) + " shared push events");
+                nextSequence = latest - this->slotCount + 1;
+            }
+
+            const char* slotMemory = this->Slot(nextSequence);
+            auto* slot = reinterpret_cast<RingSlot*>(const_cast<char*>(slotMemory)); // NOLINT
+            if (Atomic(slot->sequence).load(std::memory_order_acquire) != nextSequence) {
+                continue;
+            }
+
+            std::string message(slotMemory + sizeof(RingSlot), std::min(slot->length, this->slotSize));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Atomic(slot->sequence).load(std::memory_order_relaxed) != nextSequence) {
+                continue;
+            }
+
+            nextSequence++;
+            return message;
+        }
+
+        return std::nullopt;
+    }
+
+    auto PushEventRingBuffer::LatestSequence() const -> uint64_t
+    {
+        if (!this->Initialised()) {
+            return 0;
+        }
+
+        return Atomic(reinterpret_cast<RingHeader*>(this->memory)->writeSequence) // NOLINT
+            .load(std::memory_order_acquire);
+    }
+} // namespace UKControllerPlugin::Push
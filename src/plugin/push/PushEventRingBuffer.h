@@ -0,0 +1,46 @@
+#pragma once
+
+namespace UKControllerPlugin::Push {
+
+    /*
+        A ring buffer of push event messages in memory shared between EuroScope instances. The primary
+        instance writes each message once, with an increasing sequence number, and every secondary reads
+        them without taking any locks.
+
+        Each reader keeps track of the next sequence it wants. If a reader falls so far behind that the
+        writer has gone all the way round the ring, it skips to the oldest message still available.
+    */
+    class PushEventRingBuffer
+    {
+        public:
+        PushEventRingBuffer(void* memory, uint32_t slotCount = defaultSlotCount, uint32_t slotSize = defaultSlotSize);
+        [[nodiscard]] static auto RequiredSize(uint32_t slotCount = defaultSlotCount, uint32_t slotSize = defaultSlotSize)
+            -> size_t;
+        void Initialise();
+        [[nodiscard]] auto Write(const std::string& message) -> bool;
+        [[nodiscard]] auto Read(uint64_t& nextSequence) const -> std::optional<std::string>;
+        [[nodiscard]] auto LatestSequence() const -> uint64_t;
+
+        // How many messages the ring holds
+        static inline const uint32_t defaultSlotCount = 256;
+
+        // The largest message the ring can hold, in bytes
+        static inline const uint32_t defaultSlotSize = 8192;
+
+        private:
+        [[nodiscard]] auto Initialised() const -> bool;
+        [[nodiscard]] auto Slot(uint64_t sequence) const -> char*;
+
+        // The shared memory
+        char* memory;
+
+        // How many messages the ring holds
+        const uint32_t slotCount;
+
+        // The largest message the ring can hold
+        const uint32_t slotSize;
+
+        // How many times to retry a read that's raced with the writer before giving up until later
+        static inline const int maxReadAttempts = 8;
+    };
+} // namespace UKControllerPlugin::Push
@@ -0,0 +1,81 @@
+#include "PushEventStreamParser.h"
+
+namespace UKControllerPlugin::Push {
+
+    auto PushEventStreamParser::Parse(const std::string& chunk) -> std::vector<StreamedPushEvent>
+    {
+        std::vector<StreamedPushEvent> events;
+        this->buffer += chunk;
+
+        size_t lineStart = 0;
+        size_t lineEnd;
+        while ((lineEnd = this->buffer.find('\n', lineStart)) != std::string::npos) {
+            std::string line = this->buffer.substr(lineStart, lineEnd - lineStart);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+
+            this->ParseLine(line, events);
+            lineStart = lineEnd + 1;
+        }
+
+        this->buffer.erase(0, lineStart);
+        return events;
+    }
+
+    /*
+        Forget anything partially received, for when the stream is reconnected.
+    */
+    void PushEventStreamParser::Reset()
+    {
+        this->buffer.clear();
+        this->currentId = -1;
+        this->currentData.clear();
+        this->hasData = false;
+    }
+
+    /*
+        A blank line ends the event, lines starting with a colon are comments (keep-alives) and
+        everything else is a field. Fields we don't use, such as the event type, are ignored.
+    */
+    void PushEventStreamParser::ParseLine(const std::string& line, std::vector<StreamedPushEvent>& events)
+    {
+        if (line.empty()) {
+            if (this->hasData) {
+                events.push_back({this->currentId, this->currentData});
+            }
+
+            this->currentId = -1;
+            this->currentData.clear();
+            this->hasData = false;
+            return;
+        }
+
+        if (line.front() == ':') {
+            return;
+        }
+
+        const auto separator = line.find(':');
+        const std::string field = line.substr(0, separator);
+        std::string value = separator == std::string::npos ? "" : line.substr(separator + 1);
+        if (!value.empty() && value.front() == ' ') {
+            value.erase(0, 1);
+        }
+
+        if (field == "data") {
+            if (this->hasData) {
+                this->currentData += '\n';
+            }
+
+            this->currentData += value;
+            this->hasData = true;
+        } else if (field == "id") {
+            try {
+                this->currentId = std::stoi(value);
+            } catch (std::exception&) {
+                LogWarning("Invalid plugin event stream id: " + value);
+                this->currentId = -1;
+            }
+        }
+    }
+} // namespace UKControllerPlugin::Push
@@ -0,0 +1,42 @@
+#pragma once
+
+namespace UKControllerPlugin::Push {
+
+    /*
+        An event received over the plugin event stream.
+    */
+    struct StreamedPushEvent
+    {
+        // The id of the event, or -1 if the stream didn't give one
+        int id;
+
+        // The event payload
+        std::string data;
+    };
+
+    /*
+        Turns the chunks of a server-sent event stream back into events. Chunks can split lines and events
+        at any point, so anything incomplete is held until the next chunk arrives.
+    */
+    class PushEventStreamParser
+    {
+        public:
+        [[nodiscard]] auto Parse(const std::string& chunk) -> std::vector<StreamedPushEvent>;
+        void Reset();
+
+        private:
+        void ParseLine(const std::string& line, std::vector<StreamedPushEvent>& events);
+
+        // Received data that doesn't yet make up a whole line
+        std::string buffer;
+
+        // The id of the event currently being received
+        int currentId = -1;
+
+        // The data of the event currently being received
+        std::string currentData;
+
+        // Whether the current event has any data lines yet
+        bool hasData = false;
+    };
+} // namespace UKControllerPlugin::Push
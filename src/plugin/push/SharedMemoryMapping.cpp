@@ -0,0 +1,47 @@
+#include "SharedMemoryMapping.h"
+
+namespace UKControllerPlugin::Push {
+
+    SharedMemoryMapping::SharedMemoryMapping(const std::wstring& name, size_t size)
+    {
+        const auto size64 = static_cast<uint64_t>(size);
+        this->mapping = CreateFileMapping(
+            INVALID_HANDLE_VALUE,
+            nullptr,
+            PAGE_READWRITE,
+            static_cast<DWORD>(size64 >> 32), // NOLINT
+            static_cast<DWORD>(size64 & 0xFFFFFFFF),
+            name.c_str());
+
+        if (this->mapping == nullptr) {
+            LogError("Unable to create shared push event memory: " + std::to_string(GetLastError()));
+            return;
+        }
+
+        this->view = MapViewOfFile(this->mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        if (this->view == nullptr) {
+            LogError("Unable to map shared push event memory: " + std::to_string(GetLastError()));
+        }
+    }
+
+    SharedMemoryMapping::~SharedMemoryMapping()
+    {
+        if (this->view != nullptr) {
+            UnmapViewOfFile(this->view);
+        }
+
+        if (this->mapping != nullptr) {
+            CloseHandle(this->mapping);
+        }
+    }
+
+    auto SharedMemoryMapping::Memory() const -> void*
+    {
+        return this->view;
+    }
+
+    auto SharedMemoryMapping::Valid() const -> bool
+    {
+        return this->view != nullptr;
+    }
+} // namespace UKControllerPlugin::Push
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace UKControllerPlugin::Push {
+
+    /*
+        A named block of memory, backed by the page file, that can be mapped by every EuroScope instance
+        on the machine. The mapping is released when the last instance using it closes it.
+    */
+    class SharedMemoryMapping
+    {
+        public:
+        SharedMemoryMapping(const std::wstring& name, size_t size);
+        ~SharedMemoryMapping();
+        SharedMemoryMapping(const SharedMemoryMapping&) = delete;
+        SharedMemoryMapping(SharedMemoryMapping&&) noexcept = delete;
+        auto operator=(const SharedMemoryMapping&) -> SharedMemoryMapping& = delete;
+        auto operator=(SharedMemoryMapping&&) noexcept -> SharedMemoryMapping& = delete;
+        [[nodiscard]] auto Memory() const -> void*;
+        [[nodiscard]] auto Valid() const -> bool;
+
+        private:
+        // The file mapping
+        HANDLE mapping = nullptr;
+
+        // Where the mapping is in our address space
+        void* view = nullptr;
+    };
+} // namespace UKControllerPlugin::Push
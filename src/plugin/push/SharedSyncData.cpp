@@ -0,0 +1,95 @@
+#include "PushEventProcessorInterface.h"
+#include "PushEventRingBuffer.h"
+#include "SharedSyncData.h"
+#include "SyncSnapshotStore.h"
+
+namespace UKControllerPlugin::Push {
+
+    SharedSyncData::SharedSyncData(
+        std::shared_ptr<SyncSnapshotStore> snapshots, std::shared_ptr<PushEventRingBuffer> events, bool primary)
+        : snapshots(std::move(snapshots)), events(std::move(events)), primary(primary),
+          startSequence(this->events->LatestSequence()), refreshRequests(this->snapshots->RefreshRequests())
+    {
+    }
+
+    void SharedSyncData::Share(const std::string& key, std::shared_ptr<PushEventProcessorInterface> processor)
+    {
+        this->keys.insert(key);
+        this->processors.push_back(std::move(processor));
+    }
+
+    /*
+        The primary always loads its own data, secondaries use the shared data if it's fresh enough.
+    */
+    auto SharedSyncData::Get(const std::string& key) const -> std::optional<nlohmann::json>
+    {
+        if (this->primary) {
+            return std::nullopt;
+        }
+
+        const auto snapshot = this->snapshots->Get(key);
+        if (!snapshot || snapshot->eventSequence < this->startSequence) {
+            return std::nullopt;
+        }
+
+        auto data = nlohmann::json::parse(snapshot->data, nullptr, false);
+        if (data.is_discarded()) {
+            LogWarning("Invalid shared sync data for " + key);
+            return std::nullopt;
+        }
+
+        LogInfo("Using shared sync data for " + key);
+        return data;
+    }
+
+    void SharedSyncData::Publish(const std::string& key, const nlohmann::json& data)
+    {
+        if (!this->primary) {
+            return;
+        }
+
+        if (!this->snapshots->Publish(key, data.dump(), this->events->LatestSequence())) {
+            LogWarning("Unable to share sync data for " + key);
+        }
+    }
+
+    void SharedSyncData::RequestRefresh()
+    {
+        LogInfo("Requesting shared sync data from primary instance");
+        this->snapshots->RequestRefresh();
+    }
+
+    auto SharedSyncData::Ready() const -> bool
+    {
+        return std::all_of(this->keys.cbegin(), this->keys.cend(), [this](const std::string& key) {
+            const auto snapshot = this->snapshots->Get(key);
+            return snapshot && snapshot->eventSequence >= this->startSequence;
+        });
+    }
+
+    auto SharedSyncData::Primary() const -> bool
+    {
+        return this->primary;
+    }
+
+    /*
+        On the primary, load the shared data again if a secondary has asked for it since we last did.
+    */
+    void SharedSyncData::TimedEventTrigger()
+    {
+        if (!this->primary) {
+            return;
+        }
+
+        const auto requests = this->snapshots->RefreshRequests();
+        if (requests == this->refreshRequests) {
+            return;
+        }
+
+        this->refreshRequests = requests;
+        LogInfo("Refreshing shared sync data for secondary instances");
+        for (const auto& processor : this->processors) {
+            processor->PluginEventsSynced();
+        }
+    }
+} // namespace UKControllerPlugin::Push
@@ -0,0 +1,53 @@
+#pragma once
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPlugin::Push {
+    class PushEventProcessorInterface;
+    class PushEventRingBuffer;
+    class SyncSnapshotStore;
+
+    /*
+        Lets push event processors share the data they load when push events are synced between EuroScope
+        instances on the same machine.
+
+        The primary instance publishes whatever it loads. A secondary instance uses that instead of asking
+        the API, as long as it was loaded after the secondary started receiving shared push events, so that
+        nothing in between has been missed. If it wasn't, the secondary asks the primary to load it again,
+        which it does once however many secondaries are waiting.
+    */
+    class SharedSyncData : public TimedEvent::AbstractTimedEvent
+    {
+        public:
+        SharedSyncData(
+            std::shared_ptr<SyncSnapshotStore> snapshots, std::shared_ptr<PushEventRingBuffer> events, bool primary);
+        void Share(const std::string& key, std::shared_ptr<PushEventProcessorInterface> processor);
+        [[nodiscard]] auto Get(const std::string& key) const -> std::optional<nlohmann::json>;
+        void Publish(const std::string& key, const nlohmann::json& data);
+        void RequestRefresh();
+        [[nodiscard]] auto Ready() const -> bool;
+        [[nodiscard]] auto Primary() const -> bool;
+        void TimedEventTrigger() override;
+
+        private:
+        // The shared snapshots
+        std::shared_ptr<SyncSnapshotStore> snapshots;
+
+        // The shared push events
+        std::shared_ptr<PushEventRingBuffer> events;
+
+        // Whether this is the primary instance
+        const bool primary;
+
+        // The latest shared push event when we started, anything loaded before this is too old for us
+        const uint64_t startSequence;
+
+        // The keys that data is shared under
+        std::set<std::string> keys;
+
+        // The processors that load the shared data
+        std::vector<std::shared_ptr<PushEventProcessorInterface>> processors;
+
+        // How many refreshes had been asked for when we last refreshed
+        uint64_t refreshRequests;
+    };
+} // namespace UKControllerPlugin::Push
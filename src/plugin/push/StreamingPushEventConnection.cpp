@@ -0,0 +1,243 @@
+#include "PushEventProcessorCollection.h"
+#include "StreamingPushEventConnection.h"
+#include "api/ApiException.h"
+#include "api/ApiHealthTracker.h"
+#include "api/ApiInterface.h"
+#include "api/ApiNotFoundException.h"
+
+using UKControllerPluginUtils::Api::ApiHealthTracker;
+
+namespace UKControllerPlugin::Push {
+
+    StreamingPushEventConnection::StreamingPushEventConnection(
+        const Api::ApiInterface& api,
+        TaskManager::TaskRunnerInterface& taskRunner,
+        const PushEventProcessorCollection& pushEventHandlers,
+        std::shared_ptr<ApiHealthTracker> apiHealth)
+        : api(api), pushEventHandlers(pushEventHandlers), apiHealth(apiHealth),
+          fallback(api, taskRunner, pushEventHandlers, apiHealth)
+    {
+    }
+
+    StreamingPushEventConnection::~StreamingPushEventConnection()
+    {
+        {
+            std::lock_guard lock(this->reconnectLock);
+            this->stopping = true;
+        }
+
+        this->reconnectCondition.notify_all();
+        if (this->streamThread.joinable()) {
+            this->streamThread.join();
+        }
+    }
+
+    void StreamingPushEventConnection::WriteMessage(std::string message)
+    {
+        // Nothing to do here
+    }
+
+    /*
+        Anything the fallback received whilst we were polling is handed over too, so nothing is lost when
+        we switch between the two.
+    */
+    auto StreamingPushEventConnection::GetNextMessage() -> std::string
+    {
+        {
+            std::lock_guard lock(this->inboundMessageQueueGuard);
+            if (!this->inboundMessages.empty()) {
+                std::string message = this->inboundMessages.front();
+                this->inboundMessages.pop();
+                return message;
+            }
+        }
+
+        return this->fallback.GetNextMessage();
+    }
+
+    /*
+        The stream runs on its own thread, so all we need to do here is make sure it's been started. Whilst we're
+        falling back, this drives the polling.
+    */
+    void StreamingPushEventConnection::TimedEventTrigger()
+    {
+        if (this->usingFallback) {
+            if (std::chrono::system_clock::now() - this->fallbackTime < retryStreamingAfter ||
+                this->fallback.RequestInProgress()) {
+                this->fallback.TimedEventTrigger();
+                return;
+            }
+
+            this->ResumeStreaming();
+        }
+
+        if (!this->streamThread.joinable()) {
+            this->streamThread = std::thread(&StreamingPushEventConnection::StreamLoop, this);
+        }
+    }
+
+    /*
+        Makes one attempt at streaming events, syncing first if we need to. Returns when the stream closes.
+    */
+    void StreamingPushEventConnection::Stream()
+    {
+        if (this->lastEventId == -1 && !this->SyncEvents()) {
+            this->ConnectionFailed();
+            return;
+        }
+
+        this->parser.Reset();
+        try {
+            this->api.StreamPluginEvents(this->lastEventId, [this](const std::string& chunk) -> bool {
+                if (this->stopping) {
+                    return false;
+                }
+
+                this->ProcessEvents(this->parser.Parse(chunk));
+                return true;
+            });
+
+            // The API closes streams periodically, which is expected
+            this->consecutiveFailures = 0;
+        } catch (Api::ApiNotFoundException&) {
+            LogInfo("Plugin event streaming is not available, falling back to polling");
+            this->FallBackToPolling();
+        } catch (Api::ApiException& apiException) {
+            LogWarning("ApiException when streaming plugin events: " + std::string(apiException.what()));
+            this->ConnectionFailed();
+        }
+    }
+
+    void StreamingPushEventConnection::StreamLoop()
+    {
+        while (!this->stopping && !this->usingFallback) {
+            this->Stream();
+            if (this->stopping || this->usingFallback) {
+                return;
+            }
+
+            this->WaitToReconnect();
+        }
+    }
+
+    void StreamingPushEventConnection::WaitToReconnect()
+    {
+        std::unique_lock lock(this->reconnectLock);
+        this->reconnectCondition.wait_for(lock, this->ReconnectDelay(), [this]() { return this->stopping.load(); });
+    }
+
+    /*
+        Reconnect quickly after the API closes the stream, but back off if it keeps failing.
+    */
+    auto StreamingPushEventConnection::ReconnectDelay() const -> std::chrono::milliseconds
+    {
+        std::chrono::milliseconds delay = std::chrono::seconds(1) * (1 << this->consecutiveFailures.load());
+        if (this->apiHealth && this->apiHealth->RetryDelay() > delay) {
+            delay = this->apiHealth->RetryDelay();
+        }
+
+        return delay;
+    }
+
+    auto StreamingPushEventConnection::SyncEvents() -> bool
+    {
+        try {
+            nlohmann::json syncResponse = this->api.SyncPluginEvents();
+            if (!PollingPushEventConnection::SyncResponseValid(syncResponse)) {
+                LogWarning("Invalid plugin event sync response from API");
+                return false;
+            }
+
+            this->lastEventId = syncResponse.at("event_id").get<int>();
+            LogInfo("Plugin events synced at id " + std::to_string(this->lastEventId));
+            this->pushEventHandlers.PluginEventsSynced();
+            return true;
+        } catch (Api::ApiException& apiException) {
+            LogError("ApiException when syncing plugin events: " + std::string(apiException.what()));
+            return false;
+        }
+    }
+
+    /*
+        Events are only ever processed once, so anything we've already seen before a reconnect is dropped.
+    */
+    void StreamingPushEventConnection::ProcessEvents(const std::vector<StreamedPushEvent>& events)
+    {
+        for (const auto& event : events) {
+            const nlohmann::json pluginEvent = {
+                {"id", event.id}, {"event", nlohmann::json::parse(event.data, nullptr, false)}};
+            if (!PollingPushEventConnection::PluginEventValid(pluginEvent)) {
+                LogError("Received invalid plugin event from API stream");
+                continue;
+            }
+
+            if (event.id <= this->lastEventId) {
+                continue;
+            }
+
+            std::lock_guard lock(this->inboundMessageQueueGuard);
+            this->inboundMessages.push(pluginEvent.at("event").dump());
+            this->lastEventId = event.id;
+            LogDebug("Received streamed plugin event: " + pluginEvent.dump());
+        }
+    }
+
+    void StreamingPushEventConnection::ConnectionFailed()
+    {
+        if (++this->consecutiveFailures >= maxConnectionFailures) {
+            LogWarning("Plugin event stream keeps failing, falling back to polling");
+            this->FallBackToPolling();
+        }
+    }
+
+    void StreamingPushEventConnection::FallBackToPolling()
+    {
+        if (this->lastEventId != -1) {
+            this->fallback.ResumeFrom(this->lastEventId);
+        }
+
+        this->fallbackTime = std::chrono::system_clock::now();
+        this->usingFallback = true;
+    }
+
+    /*
+        The old stream thread has finished by the time we fall back, so we can start again from wherever the
+        polling got to.
+    */
+    void StreamingPushEventConnection::ResumeStreaming()
+    {
+        if (this->streamThread.joinable()) {
+            this->streamThread.join();
+        }
+
+        LogInfo("Attempting to stream plugin events again");
+        this->lastEventId = this->fallback.LastEventId();
+        this->consecutiveFailures = 0;
+        this->usingFallback = false;
+    }
+
+    auto StreamingPushEventConnection::LastEventId() const -> int
+    {
+        return this->lastEventId;
+    }
+
+    auto StreamingPushEventConnection::ConsecutiveFailures() const -> int
+    {
+        return this->consecutiveFailures;
+    }
+
+    auto StreamingPushEventConnection::UsingFallback() const -> bool
+    {
+        return this->usingFallback;
+    }
+
+    auto StreamingPushEventConnection::Fallback() -> PollingPushEventConnection&
+    {
+        return this->fallback;
+    }
+
+    void StreamingPushEventConnection::SetFallbackTime(std::chrono::system_clock::time_point time)
+    {
+        this->fallbackTime = time;
+    }
+} // namespace UKControllerPlugin::Push
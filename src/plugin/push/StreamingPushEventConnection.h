@@ -0,0 +1,114 @@
+#pragma once
+#include "push/PollingPushEventConnection.h"
+#include "push/PushEventConnectionInterface.h"
+#include "push/PushEventStreamParser.h"
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPluginUtils::Api {
+    class ApiHealthTracker;
+} // namespace UKControllerPluginUtils::Api
+
+namespace UKControllerPlugin {
+    namespace Api {
+        class ApiInterface;
+    } // namespace Api
+
+    namespace TaskManager {
+        class TaskRunnerInterface;
+    } // namespace TaskManager
+
+    namespace Push {
+        class PushEventProcessorCollection;
+
+        /*
+            Receives push events over a long-lived stream from the API, on its own thread, rather than
+            polling for them. When the stream drops, we reconnect and carry on from the last event
+            we received.
+
+            If the API doesn't support streaming, or the stream keeps failing, we fall back to polling
+            and try streaming again later.
+        */
+        class StreamingPushEventConnection : public PushEventConnectionInterface, public TimedEvent::AbstractTimedEvent
+        {
+            public:
+            StreamingPushEventConnection(
+                const Api::ApiInterface& api,
+                TaskManager::TaskRunnerInterface& taskRunner,
+                const PushEventProcessorCollection& pushEventHandlers,
+                std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> apiHealth = nullptr);
+            ~StreamingPushEventConnection() override;
+            StreamingPushEventConnection(const StreamingPushEventConnection&) = delete;
+            StreamingPushEventConnection(StreamingPushEventConnection&&) noexcept = delete;
+            auto operator=(const StreamingPushEventConnection&) -> StreamingPushEventConnection& = delete;
+            auto operator=(StreamingPushEventConnection&&) noexcept -> StreamingPushEventConnection& = delete;
+            void WriteMessage(std::string message) override;
+            auto GetNextMessage() -> std::string override;
+            void TimedEventTrigger() override;
+            void Stream();
+            [[nodiscard]] auto LastEventId() const -> int;
+            [[nodiscard]] auto ConsecutiveFailures() const -> int;
+            [[nodiscard]] auto UsingFallback() const -> bool;
+            [[nodiscard]] auto Fallback() -> PollingPushEventConnection&;
+            void SetFallbackTime(std::chrono::system_clock::time_point time);
+
+            // How many times in a row the stream can fail before we fall back to polling
+            static inline const int maxConnectionFailures = 5;
+
+            // How long we poll for before trying to stream again
+            static inline const std::chrono::minutes retryStreamingAfter = std::chrono::minutes(10);
+
+            private:
+            void StreamLoop();
+            void WaitToReconnect();
+            [[nodiscard]] auto ReconnectDelay() const -> std::chrono::milliseconds;
+            [[nodiscard]] auto SyncEvents() -> bool;
+            void ProcessEvents(const std::vector<StreamedPushEvent>& events);
+            void ConnectionFailed();
+            void FallBackToPolling();
+            void ResumeStreaming();
+
+            // The api for streaming events
+            const Api::ApiInterface& api;
+
+            // Push event handlers
+            const PushEventProcessorCollection& pushEventHandlers;
+
+            // Tells us when the API is having problems, so we can wait before reconnecting
+            std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> apiHealth;
+
+            // Polls for events when we can't stream them
+            PollingPushEventConnection fallback;
+
+            // Turns the stream back into events
+            PushEventStreamParser parser;
+
+            // The last event that we processed
+            std::atomic<int> lastEventId = -1;
+
+            // How many times in a row the stream has failed
+            std::atomic<int> consecutiveFailures = 0;
+
+            // Whether we're polling instead of streaming
+            std::atomic<bool> usingFallback = false;
+
+            // When we started polling instead of streaming
+            std::chrono::system_clock::time_point fallbackTime;
+
+            // Whether we're shutting down
+            std::atomic<bool> stopping = false;
+
+            // Messages that are yet to be processed by the rest of the plugin
+            std::queue<std::string> inboundMessages;
+
+            // Protects the inbound messages queue
+            std::mutex inboundMessageQueueGuard;
+
+            // Lets us wake the stream thread whilst it waits to reconnect
+            std::mutex reconnectLock;
+            std::condition_variable reconnectCondition;
+
+            // The thread that holds the stream open
+            std::thread streamThread;
+        };
+    } // namespace Push
+} // namespace UKControllerPlugin
@@ -0,0 +1,174 @@
+#include "SyncSnapshotStore.h"
+
+namespace UKControllerPlugin::Push {
+
+    namespace {
+        // Identifies memory that has been set up as a snapshot store
+        const uint32_t SNAPSHOT_MAGIC = 0x554B5353; // NOLINT
+
+        struct SnapshotHeader
+        {
+            uint32_t magic;
+            uint32_t snapshotCount;
+            uint32_t snapshotSize;
+            uint32_t padding;
+            uint64_t refreshRequests;
+        };
+
+        // Each slot is followed by the snapshot data. The version is odd whilst the slot is being written.
+        struct SnapshotSlot
+        {
+            uint64_t version;
+            uint64_t eventSequence;
+            std::array<char, SyncSnapshotStore::maxKeyLength + 1> key;
+            uint32_t length;
+            uint32_t padding;
+        };
+
+        template <typename T>
+        auto Atomic(T& value) -> std::atomic_ref<T>
+        {
+            return std::atomic_ref<T>(value);
+        }
+    } // namespace
+
+    SyncSnapshotStore::SyncSnapshotStore(void* memory, uint32_t snapshotCount, uint32_t snapshotSize)
+        : memory(static_cast<char*>(memory)), snapshotCount(snapshotCount), snapshotSize(snapshotSize)
+    {
+        assert(snapshotSize % alignof(SnapshotSlot) == 0 && "Snapshot size must keep slots aligned");
+    }
+
+    auto SyncSnapshotStore::RequiredSize(uint32_t snapshotCount, uint32_t snapshotSize) -> size_t
+    {
+        return sizeof(SnapshotHeader) + static_cast<size_t>(snapshotCount) * (sizeof(SnapshotSlot) + snapshotSize);
+    }
+
+    /*
+        Called by the primary instance before it publishes anything. Snapshots left by a previous primary are
+        kept, as their sequence tells readers how fresh they are.
+    */
+    void SyncSnapshotStore::Initialise()
+    {
+        if (this->Initialised()) {
+            return;
+        }
+
+        auto* header = reinterpret_cast<SnapshotHeader*>(this->memory); // NOLINT
+        std::memset(this->memory, 0, RequiredSize(this->snapshotCount, this->snapshotSize));
+        header->snapshotCount = this->snapshotCount;
+        header->snapshotSize = this->snapshotSize;
+        Atomic(header->magic).store(SNAPSHOT_MAGIC, std::memory_order_release);
+    }
+
+    auto SyncSnapshotStore::Initialised() const -> bool
+    {
+        auto* header = reinterpret_cast<SnapshotHeader*>(this->memory); // NOLINT
+        return Atomic(header->magic).load(std::memory_order_acquire) == SNAPSHOT_MAGIC &&
+               header->snapshotCount == this->snapshotCount && header->snapshotSize == this->snapshotSize;
+    }
+
+    auto SyncSnapshotStore::Slot(uint32_t index) const -> char*
+    {
+        return this->memory + sizeof(SnapshotHeader) + index * (sizeof(SnapshotSlot) + this->snapshotSize);
+    }
+
+    /*
+        Keys are only ever written once, when the slot is first used, so they're safe to compare without
+        checking the version.
+    */
+    auto SyncSnapshotStore::FindSlot(const std::string& key) const -> char*
+    {
+        for (uint32_t index = 0; index < this->snapshotCount; index++) {
+            auto* slot = reinterpret_cast<SnapshotSlot*>(this->Slot(index)); // NOLINT
+            if (key == slot->key.data()) {
+                return this->Slot(index);
+            }
+        }
+
+        return nullptr;
+    }
+
+    auto SyncSnapshotStore::Publish(const std::string& key, const std::string& data, uint64_t eventSequence) -> bool
+    {
+        if (!this->Initialised() || key.empty() || key.size() > maxKeyLength || data.size() > this->snapshotSize) {
+            return false;
+        }
+
+        std::lock_guard lock(this->publishLock);
+        char* slotMemory = this->FindSlot(key);
+        if (slotMemory == nullptr) {
+            slotMemory = this->FindSlot("");
+        }
+
+        if (slotMemory == nullptr) {
+            LogWarning("No room to share sync data for " + key);
+            return false;
+        }
+
+        auto* slot = reinterpret_cast<SnapshotSlot*>(slotMemory); // NOLINT
+        const uint64_t version = Atomic(slot->version).load(std::memory_order_relaxed);
+        Atomic(slot->version).store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::copy(key.cbegin(), key.cend(), slot->key.begin());
+        slot->eventSequence = eventSequence;
+        slot->length = static_cast<uint32_t>(data.size());
+        std::memcpy(slotMemory + sizeof(SnapshotSlot), data.data(), data.size());
+        Atomic(slot->version).store(version + 2, std::memory_order_release);
+        return true;
+    }
+
+    auto SyncSnapshotStore::Get(const std::string& key) const -> std::optional<SyncSnapshot>
+    {
+        if (!this->Initialised() || key.empty() || key.size() > maxKeyLength) {
+            return std::nullopt;
+        }
+
+        const char* slotMemory = this->FindSlot(key);
+        if (slotMemory == nullptr) {
+            return std::nullopt;
+        }
+
+        auto* slot = reinterpret_cast<SnapshotSlot*>(const_cast<char*>(slotMemory)); // NOLINT
+        for (int attempt = 0; attempt < maxReadAttempts; attempt++) {
+            const uint64_t version = Atomic(slot->version).load(std::memory_order_acquire);
+            if (version % 2 != 0) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            SyncSnapshot snapshot{
+                slot->eventSequence,
+                std::string(slotMemory + sizeof(SnapshotSlot), std::min(slot->length, this->snapshotSize))};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Atomic(slot->version).load(std::memory_order_relaxed) == version) {
+                return snapshot;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /*
+        Any instance can ask for the snapshots to be loaded again.
+    */
+    void SyncSnapshotStore::RequestRefresh()
+    {
+        if (!this->Initialised()) {
+            return;
+        }
+
+        Atomic(reinterpret_cast<SnapshotHeader*>(this->memory)->refreshRequests) // NOLINT
+            .fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    auto SyncSnapshotStore::RefreshRequests() const -> uint64_t
+    {
+        if (!this->Initialised()) {
+            return 0;
+        }
+
+        return Atomic(reinterpret_cast<SnapshotHeader*>(this->memory)->refreshRequests) // NOLINT
+            .load(std::memory_order_acquire);
+    }
+} // namespace UKControllerPlugin::Push
@@ -0,0 +1,66 @@
+#pragma once
+
+namespace UKControllerPlugin::Push {
+
+    /*
+        A copy of some data the primary instance loaded when push events were synced, along with the
+        sequence of the latest shared push event at the time.
+    */
+    struct SyncSnapshot
+    {
+        uint64_t eventSequence;
+        std::string data;
+    };
+
+    /*
+        Keeps the data the primary instance loads when push events are synced in memory shared between
+        EuroScope instances, so that secondary instances can use it rather than asking the API again.
+
+        Only the primary instance publishes snapshots, though it may do so from more than one thread, so
+        publishing is serialised. Secondaries read them without taking any locks, and may ask the primary to
+        load them again.
+    */
+    class SyncSnapshotStore
+    {
+        public:
+        SyncSnapshotStore(
+            void* memory, uint32_t snapshotCount = defaultSnapshotCount, uint32_t snapshotSize = defaultSnapshotSize);
+        [[nodiscard]] static auto
+        RequiredSize(uint32_t snapshotCount = defaultSnapshotCount, uint32_t snapshotSize = defaultSnapshotSize)
+            -> size_t;
+        void Initialise();
+        [[nodiscard]] auto Publish(const std::string& key, const std::string& data, uint64_t eventSequence) -> bool;
+        [[nodiscard]] auto Get(const std::string& key) const -> std::optional<SyncSnapshot>;
+        void RequestRefresh();
+        [[nodiscard]] auto RefreshRequests() const -> uint64_t;
+
+        // How many different snapshots can be stored
+        static inline const uint32_t defaultSnapshotCount = 8;
+
+        // The largest snapshot that can be stored, in bytes
+        static inline const uint32_t defaultSnapshotSize = 262144;
+
+        // The longest key a snapshot can have
+        static inline const size_t maxKeyLength = 31;
+
+        private:
+        [[nodiscard]] auto Initialised() const -> bool;
+        [[nodiscard]] auto Slot(uint32_t index) const -> char*;
+        [[nodiscard]] auto FindSlot(const std::string& key) const -> char*;
+
+        // The shared memory
+        char* memory;
+
+        // How many different snapshots can be stored
+        const uint32_t snapshotCount;
+
+        // The largest snapshot that can be stored
+        const uint32_t snapshotSize;
+
+        // Only one publish at a time, so two publishers can't claim the same slot or interleave their writes
+        std::mutex publishLock;
+
+        // How many times to retry a read that's raced with the writer before giving up
+        static inline const int maxReadAttempts = 8;
+    };
+} // namespace UKControllerPlugin::Push
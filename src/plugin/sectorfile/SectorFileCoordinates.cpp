@@ -3,8 +3,61 @@
 namespace UKControllerPlugin {
     namespace SectorFile {
 
-        std::regex latitudePattern("^([N,S])(\\d{3})\\.(\\d{2})\\.(\\d{2})\\.(\\d{3})$");
-        std::regex longitudePattern("^([E,W])(\\d{3})\\.(\\d{2})\\.(\\d{2})\\.(\\d{3})$");
+        namespace {
+            // Coordinates are always of the form H000.00.00.000
+            const size_t COORDINATE_LENGTH = 14;
+            const size_t DEGREES_START = 1;
+            const size_t MINUTES_START = 5;
+            const size_t SECONDS_START = 8;
+            const size_t THOUSANDTHS_START = 11;
+            const int MINUTES_PER_DEGREE = 60;
+            const int SECONDS_PER_MINUTE = 60;
+            const double SECONDS_PER_DEGREE = 3600.0;
+            const double THOUSANDTHS_PER_SECOND = 1000.0;
+
+            /*
+                Reads a fixed number of digits. Rather than branching on each character, anything that isn't
+                a digit is collected into the invalid flag and checked once at the end.
+            */
+            auto ReadDigits(std::string_view coordinate, size_t start, size_t count, bool& invalid) -> int
+            {
+                unsigned int value = 0;
+                for (size_t i = start; i < start + count; i++) {
+                    const auto digit = static_cast<unsigned int>(coordinate[i]) - '0';
+                    invalid |= digit > 9;
+                    value = value * 10 + digit;
+                }
+
+                return static_cast<int>(value);
+            }
+
+            auto ParseCoordinate(std::string_view coordinate, char positive, char negative, int maxDegrees)
+                -> std::optional<double>
+            {
+                if (coordinate.size() != COORDINATE_LENGTH) {
+                    return std::nullopt;
+                }
+
+                bool invalid = (coordinate[0] != positive && coordinate[0] != negative) ||
+                               coordinate[MINUTES_START - 1] != '.' || coordinate[SECONDS_START - 1] != '.' ||
+                               coordinate[THOUSANDTHS_START - 1] != '.';
+                const auto degrees = ReadDigits(coordinate, DEGREES_START, 3, invalid);
+                const auto minutes = ReadDigits(coordinate, MINUTES_START, 2, invalid);
+                const auto seconds = ReadDigits(coordinate, SECONDS_START, 2, invalid);
+                const auto thousandths = ReadDigits(coordinate, THOUSANDTHS_START, 3, invalid);
+
+                // Nothing can go past the pole or the antimeridian, and minutes and seconds never reach 60
+                invalid |= minutes >= MINUTES_PER_DEGREE || seconds >= SECONDS_PER_MINUTE || degrees > maxDegrees ||
+                           (degrees == maxDegrees && (minutes != 0 || seconds != 0 || thousandths != 0));
+                if (invalid) {
+                    return std::nullopt;
+                }
+
+                const auto value = degrees + (minutes / static_cast<double>(MINUTES_PER_DEGREE)) +
+                                   ((seconds + thousandths / THOUSANDTHS_PER_SECOND) / SECONDS_PER_DEGREE);
+                return coordinate[0] == negative ? -value : value;
+            }
+        } // namespace
 
         EuroScopePlugIn::CPosition GetInvalidPosition(void)
         {
@@ -14,45 +67,44 @@ namespace UKControllerPlugin {
             return pos;
         }
 
-        EuroScopePlugIn::CPosition ParseSectorFileCoordinates(std::string latitude, std::string longitude)
+        auto ParseSectorFileLatitude(std::string_view latitude) -> std::optional<double>
         {
-            std::match_results<std::string::const_iterator> latitudeMatch;
-            std::match_results<std::string::const_iterator> longitudeMatch;
+            return ParseCoordinate(latitude, 'N', 'S', 90);
+        }
 
-            if (!std::regex_match(latitude, latitudeMatch, latitudePattern) ||
-                !std::regex_match(longitude, longitudeMatch, longitudePattern)) {
-                return GetInvalidPosition();
-            }
+        auto ParseSectorFileLongitude(std::string_view longitude) -> std::optional<double>
+        {
+            return ParseCoordinate(longitude, 'E', 'W', 180);
+        }
 
-            // Get the values out of the regex
-            int latitudeDegrees = std::stoi(latitudeMatch[2].str());
-            int latitudeMinutes = std::stoi(latitudeMatch[3].str());
-            double latitudeSeconds = std::stod(latitudeMatch[4].str() + "." + latitudeMatch[5].str());
-            int longitudeDegrees = std::stoi(longitudeMatch[2].str());
-            int longitudeMinutes = std::stoi(longitudeMatch[3].str());
-            double longitudeSeconds = std::stod(longitudeMatch[4].str() + "." + longitudeMatch[5].str());
-
-            // Check the validity of the values
-            if ((latitudeDegrees == 90 && (latitudeMinutes != 0 || latitudeSeconds != 0)) || latitudeDegrees > 90 ||
-                latitudeMinutes >= 60 || latitudeSeconds >= 60.0 ||
-                (longitudeDegrees == 180 && (longitudeMinutes != 0 || longitudeSeconds != 0)) ||
-                longitudeDegrees > 180 || longitudeMinutes >= 60 || longitudeSeconds >= 60.0) {
+        EuroScopePlugIn::CPosition ParseSectorFileCoordinates(std::string_view latitude, std::string_view longitude)
+        {
+            const auto parsedLatitude = ParseSectorFileLatitude(latitude);
+            const auto parsedLongitude = ParseSectorFileLongitude(longitude);
+            if (!parsedLatitude || !parsedLongitude) {
                 return GetInvalidPosition();
             }
 
             EuroScopePlugIn::CPosition position;
-            position.m_Latitude = latitudeDegrees + (latitudeMinutes / 60.0) + (latitudeSeconds / 3600.0);
-            position.m_Longitude = longitudeDegrees + (longitudeMinutes / 60.0) + (longitudeSeconds / 3600.0);
-
-            if (latitudeMatch[1] == "S") {
-                position.m_Latitude *= -1;
-            }
+            position.m_Latitude = *parsedLatitude;
+            position.m_Longitude = *parsedLongitude;
+            return position;
+        }
 
-            if (longitudeMatch[1] == "W") {
-                position.m_Longitude *= -1;
-            }
+        /*
+            Parses lots of coordinates at once, such as when loading a sector file. Any that can't be parsed
+            are given the invalid position, so the results line up with the input.
+        */
+        auto ParseSectorFileCoordinates(std::span<const CoordinateStrings> coordinates)
+            -> std::vector<EuroScopePlugIn::CPosition>
+        {
+            std::vector<EuroScopePlugIn::CPosition> positions(coordinates.size());
+            std::transform(
+                coordinates.begin(), coordinates.end(), positions.begin(), [](const CoordinateStrings& coordinate) {
+                    return ParseSectorFileCoordinates(coordinate.latitude, coordinate.longitude);
+                });
 
-            return position;
+            return positions;
         }
 
         bool PositionIsInvalid(EuroScopePlugIn::CPosition pos)
@@ -1,8 +1,20 @@
 #pragma once
 
 namespace UKControllerPlugin::SectorFile {
+
+    // A latitude and longitude as they appear in the sector file, e.g. N051.28.33.000 and W000.27.41.000
+    using CoordinateStrings = struct CoordinateStrings
+    {
+        std::string_view latitude;
+        std::string_view longitude;
+    };
+
     [[nodiscard]] auto GetInvalidPosition() -> EuroScopePlugIn::CPosition;
-    [[nodiscard]] auto ParseSectorFileCoordinates(std::string latitude, std::string longitude)
+    [[nodiscard]] auto ParseSectorFileLatitude(std::string_view latitude) -> std::optional<double>;
+    [[nodiscard]] auto ParseSectorFileLongitude(std::string_view longitude) -> std::optional<double>;
+    [[nodiscard]] auto ParseSectorFileCoordinates(std::string_view latitude, std::string_view longitude)
         -> EuroScopePlugIn::CPosition;
+    [[nodiscard]] auto ParseSectorFileCoordinates(std::span<const CoordinateStrings> coordinates)
+        -> std::vector<EuroScopePlugIn::CPosition>;
     [[nodiscard]] auto PositionIsInvalid(EuroScopePlugIn::CPosition pos) -> bool;
 } // namespace UKControllerPlugin::SectorFile
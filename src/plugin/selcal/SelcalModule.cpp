@@ -2,8 +2,8 @@
 #include "SelcalParser.h"
 #include "SelcalTagItem.h"
 #include "bootstrap/PersistenceContainer.h"
-#include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "tag/TagItemCollection.h"
+#include "tag/TagItemDependencies.h"
 
 namespace UKControllerPlugin::Selcal {
     const int SELCAL_TAG_ITEM_ID = 128;
@@ -12,8 +12,7 @@ namespace UKControllerPlugin::Selcal {
     void BootstrapPlugin(const Bootstrap::PersistenceContainer& container)
     {
         auto tagItem = std::make_shared<SelcalTagItem>(std::make_shared<SelcalParser>());
-        container.tagHandler->RegisterTagItem(SELCAL_TAG_ITEM_ID, tagItem);
-        container.tagHandler->RegisterTagItem(SELCAL_SEPARATOR_ITEM_ID, tagItem);
-        container.flightplanHandler->RegisterHandler(tagItem);
+        container.tagHandler->RegisterTagItem(SELCAL_TAG_ITEM_ID, tagItem, {.flightplan = true});
+        container.tagHandler->RegisterTagItem(SELCAL_SEPARATOR_ITEM_ID, tagItem, {.flightplan = true});
     }
 } // namespace UKControllerPlugin::Selcal
@@ -1,36 +1,32 @@
 #include "ParsedSelcal.h"
 #include "SelcalParser.h"
+#include "string/TextMatchers.h"
+
+using UKControllerPluginUtils::String::MatchSelcal;
 
 namespace UKControllerPlugin::Selcal {
-    SelcalParser::SelcalParser() : selcalPattern("(\\s+|^)SEL/([ABCDEFGHJKLMPQRS]{4})(\\s+|$)")
-    {
-    }
 
     auto SelcalParser::ParseFromString(const std::string& string) const -> std::shared_ptr<ParsedSelcal>
     {
-        std::smatch matches;
-        std::regex_search(string, matches, selcalPattern);
-        if (matches.empty() || DuplicateLetter(matches[2]) || CharactersOutOfOrder(matches[2])) {
+        const auto code = MatchSelcal(string);
+        if (!code || DuplicateLetter(*code) || CharactersOutOfOrder(*code)) {
             return nullptr;
         }
 
-        return std::make_shared<ParsedSelcal>(matches[2]);
+        return std::make_shared<ParsedSelcal>(std::string(*code));
     }
 
-    auto SelcalParser::CharactersOutOfOrder(const std::string& code) -> bool
+    auto SelcalParser::CharactersOutOfOrder(std::string_view code) -> bool
     {
         return code[0] > code[1] || code[2] > code[3];
     }
 
-    auto SelcalParser::DuplicateLetter(const std::string& code) -> bool
+    auto SelcalParser::DuplicateLetter(std::string_view code) -> bool
     {
-        std::vector<char> letters;
-        for (const auto& letter : code) {
-            if (std::find(letters.begin(), letters.end(), letter) != letters.cend()) {
+        for (size_t i = 1; i < code.size(); i++) {
+            if (code.substr(0, i).find(code[i]) != std::string_view::npos) {
                 return true;
             }
-
-            letters.emplace_back(letter);
         }
 
         return false;
@@ -9,12 +9,10 @@ namespace UKControllerPlugin::Selcal {
     class SelcalParser
     {
         public:
-        SelcalParser();
         [[nodiscard]] auto ParseFromString(const std::string& string) const -> std::shared_ptr<ParsedSelcal>;
 
         private:
-        [[nodiscard]] static auto DuplicateLetter(const std::string& code) -> bool;
-        [[nodiscard]] static auto CharactersOutOfOrder(const std::string& code) -> bool;
-        const std::regex selcalPattern;
+        [[nodiscard]] static auto DuplicateLetter(std::string_view code) -> bool;
+        [[nodiscard]] static auto CharactersOutOfOrder(std::string_view code) -> bool;
     };
 } // namespace UKControllerPlugin::Selcal
@@ -10,23 +10,6 @@ namespace UKControllerPlugin::Selcal {
     {
     }
 
-    void SelcalTagItem::FlightPlanEvent(
-        Euroscope::EuroScopeCFlightPlanInterface& flightPlan, Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
-    {
-        this->cache.erase(flightPlan.GetCallsign());
-    }
-
-    void SelcalTagItem::FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan)
-    {
-        this->cache.erase(flightPlan.GetCallsign());
-    }
-
-    void
-    SelcalTagItem::ControllerFlightPlanDataEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan, int dataType)
-    {
-        // Nothing to do
-    }
-
     auto SelcalTagItem::GetTagItemDescription(int tagItemId) const -> std::string
     {
         return tagItemId == SELCAL_TAG_ITEM_ID ? "SELCAL Code" : "SELCAL Code With Separator";
@@ -34,21 +17,13 @@ namespace UKControllerPlugin::Selcal {
 
     void SelcalTagItem::SetTagItemData(Tag::TagData& tagData)
     {
-        if (this->cache.count(tagData.GetFlightplan().GetCallsign()) == 0) {
-            this->cache[tagData.GetFlightplan().GetCallsign()] =
-                this->parser->ParseFromString(tagData.GetFlightplan().GetRemarks());
-        }
-
-        tagData.SetItemString(this->GetFromCache(tagData.GetFlightplan().GetCallsign(), tagData.GetItemCode()));
-    }
-
-    auto SelcalTagItem::GetFromCache(const std::string& callsign, const int type) const -> std::string
-    {
-        const auto& cacheItem = this->cache.at(callsign);
-        if (cacheItem == nullptr) {
-            return "";
+        const auto selcal = this->parser->ParseFromString(tagData.GetFlightplan().GetRemarks());
+        if (selcal == nullptr) {
+            tagData.SetItemString("");
+            return;
         }
 
-        return type == SELCAL_TAG_ITEM_ID ? cacheItem->GetRaw() : cacheItem->GetWithSeparator();
+        tagData.SetItemString(
+            tagData.GetItemCode() == SELCAL_TAG_ITEM_ID ? selcal->GetRaw() : selcal->GetWithSeparator());
     }
 } // namespace UKControllerPlugin::Selcal
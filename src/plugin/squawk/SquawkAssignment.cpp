@@ -10,6 +10,7 @@
 #include "flightplan/StoredFlightplanCollection.h"
 #include "ownership/AirfieldServiceProviderCollection.h"
 #include "ownership/ServiceProvision.h"
+#include "string/TextMatchers.h"
 
 using UKControllerPlugin::Controller::ActiveCallsign;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
@@ -18,6 +19,7 @@ using UKControllerPlugin::Euroscope::EuroScopeCControllerInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
+using UKControllerPluginUtils::String::IsCircuitRoute;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Ownership::AirfieldServiceProviderCollection;
 
@@ -40,9 +42,7 @@ namespace UKControllerPlugin::Squawk {
         EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget) const -> bool
     {
         return flightplan.IsVfr() && !flightplan.HasAssignedSquawk() &&
-               std::regex_search(
-                   flightplan.GetRawRouteString(), std::regex("^(?:VFR )?CIRCUIT(?:S)?", std::regex::icase)) &&
-               this->GeneralAssignmentNeeded(flightplan, radarTarget);
+               IsCircuitRoute(flightplan.GetRawRouteString()) && this->GeneralAssignmentNeeded(flightplan, radarTarget);
     }
 
     bool SquawkAssignment::DeleteApiSquawkAllowed(EuroScopeCFlightPlanInterface& flightplan) const
@@ -106,14 +106,23 @@ namespace UKControllerPlugin::Squawk {
         When the timed event goes off, check for tracked aircraft and whether they need squawks to be assigned.
         This is required because EuroScope doesn't provide a method to us akin to "OnAssumeAircraft".
     */
-    void SquawkEventHandler::TimedEventTrigger()
+    auto SquawkEventHandler::ShouldSweep() const -> bool
     {
-        if (!this->activeCallsigns.UserHasCallsign() || this->automaticAssignmentDisabled ||
-            !this->userAutomaticAssignmentEnabled) {
+        return this->activeCallsigns.UserHasCallsign() && !this->automaticAssignmentDisabled &&
+               this->userAutomaticAssignmentEnabled;
+    }
+
+    /*
+        Try to assign a squawk to any aircraft that doesn't have one, as long as nobody else is tracking it.
+    */
+    void SquawkEventHandler::SweepFlightplan(
+        EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        if (flightplan.HasAssignedSquawk() || (flightplan.IsTracked() && !flightplan.IsTrackedByUser())) {
             return;
         }
 
-        this->AttemptAssignSquawksToAllAircraft();
+        this->AttemptAssignment(flightplan, radarTarget);
     }
 
     /*
@@ -176,17 +185,11 @@ namespace UKControllerPlugin::Squawk {
             this->generator.RequestGeneralSquawkForAircraft(flightplan, radarTarget);
     }
 
-    void SquawkEventHandler::AttemptAssignSquawksToAllAircraft() const
+    void SquawkEventHandler::AttemptAssignSquawksToAllAircraft()
     {
         this->pluginLoopback.ApplyFunctionToAllFlightplans(
-            [this](
-                const std::shared_ptr<EuroScopeCFlightPlanInterface>& fp,
-                const std::shared_ptr<EuroScopeCRadarTargetInterface>& rt) {
-                if (fp->HasAssignedSquawk() || (fp->IsTracked() && !fp->IsTrackedByUser())) {
-                    return;
-                }
-
-                this->AttemptAssignment(*fp, *rt);
+            [this](EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget) {
+                this->SweepFlightplan(flightplan, radarTarget);
             });
     }
 
@@ -2,7 +2,7 @@
 #include "controller/ActiveCallsignEventHandlerInterface.h"
 #include "euroscope/UserSettingAwareInterface.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
-#include "timedevent/AbstractTimedEvent.h"
+#include "flightplan/FlightplanSweepStage.h"
 
 namespace UKControllerPlugin {
     namespace Euroscope {
@@ -26,7 +26,7 @@ namespace UKControllerPlugin {
 namespace UKControllerPlugin::Squawk {
 
     class SquawkEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
-                               public UKControllerPlugin::TimedEvent::AbstractTimedEvent,
+                               public UKControllerPlugin::Flightplan::FlightplanSweepStage,
                                public UKControllerPlugin::Euroscope::UserSettingAwareInterface,
                                public UKControllerPlugin::Controller::ActiveCallsignEventHandlerInterface
     {
@@ -55,7 +55,10 @@ namespace UKControllerPlugin::Squawk {
             UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface& radarTarget,
             const std::string& context,
             const POINT& mousePos) const;
-        void TimedEventTrigger() override;
+        [[nodiscard]] auto ShouldSweep() const -> bool override;
+        void SweepFlightplan(
+            UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+            UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
         void UserSettingsUpdated(UKControllerPlugin::Euroscope::UserSetting& userSettings) override;
         [[nodiscard]] auto UserAllowedSquawkAssignment() const -> bool;
 
@@ -70,7 +73,7 @@ namespace UKControllerPlugin::Squawk {
             Euroscope::EuroScopeCFlightPlanInterface& flightplan,
             Euroscope::EuroScopeCRadarTargetInterface& radarTarget) const;
 
-        void AttemptAssignSquawksToAllAircraft() const;
+        void AttemptAssignSquawksToAllAircraft();
 
         // Generates squawks
         UKControllerPlugin::Squawk::SquawkGenerator& generator;
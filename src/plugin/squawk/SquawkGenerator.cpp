@@ -5,6 +5,8 @@
 #include "api/ApiException.h"
 #include "api/ApiInterface.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiRequestCoalescer.h"
+#include "api/PerformBulkApiRequest.h"
 #include "eventhandler/EventBus.h"
 #include "controller/ActiveCallsign.h"
 #include "controller/ActiveCallsignCollection.h"
@@ -15,6 +17,7 @@
 #include "flightplan/StoredFlightplanCollection.h"
 #include "helper/HelperFunctions.h"
 #include "log/LoggerFunctions.h"
+#include "squawk/SquawkValidator.h"
 
 using UKControllerPlugin::HelperFunctions;
 using UKControllerPlugin::Api::ApiException;
@@ -198,6 +201,16 @@ namespace UKControllerPlugin::Squawk {
         }
 
         // Search for an existing assignment, create if necessary
+        if (this->requestCoalescer) {
+            this->QueueSquawkRequest(
+                callsign,
+                {{"callsign", callsign},
+                 {"type", generalAssignmentType},
+                 {"origin", origin},
+                 {"destination", destination}});
+            return true;
+        }
+
         this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
             if (!this->GetSquawkAssignment(callsign)) {
                 static_cast<void>(this->CreateGeneralSquawkAssignment(callsign, origin, destination));
@@ -228,6 +241,12 @@ namespace UKControllerPlugin::Squawk {
         std::string flightRules = flightplan.GetFlightRules();
 
         // Check for existing squawk assignment, create if necessary
+        if (this->requestCoalescer) {
+            this->QueueSquawkRequest(
+                callsign, {{"callsign", callsign}, {"type", localAssignmentType}, {"unit", unit}, {"rules", flightRules}});
+            return true;
+        }
+
         this->taskRunner->QueueAsynchronousTask([this, callsign, unit, flightRules]() {
             if (!this->GetSquawkAssignment(callsign)) {
                 static_cast<void>(this->CreateLocalSquawkAssignment(callsign, unit, flightRules));
@@ -327,4 +346,76 @@ namespace UKControllerPlugin::Squawk {
     {
         this->squawkRequests.End(std::move(callsign));
     }
+
+    void SquawkGenerator::SetRequestCoalescer(std::shared_ptr<Api::ApiRequestCoalescer> coalescer)
+    {
+        this->requestCoalescer = std::move(coalescer);
+    }
+
+    /*
+        Hands the request to the coalescer, so it can be sent along with any others made around the same time.
+    */
+    void SquawkGenerator::QueueSquawkRequest(const std::string& callsign, nlohmann::json item)
+    {
+        if (!this->requestCoalescer->Enqueue(callsign, std::move(item))) {
+            LogDebug("Squawk request already in progress for " + callsign);
+            this->EndSquawkUpdate(callsign);
+        }
+    }
+
+    /*
+        Asks the API for squawks for many aircraft at once. The API returns any existing assignment,
+        creating one where necessary, keyed by callsign.
+
+        THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
+    */
+    auto SquawkGenerator::PerformBulkRequest(const nlohmann::json& items) -> std::optional<nlohmann::json>
+    {
+        return Api::PerformBulkApiRequest("squawk-assignment/bulk", items);
+    }
+
+    void SquawkGenerator::ProcessBulkResult(const std::string& callsign, const nlohmann::json& result)
+    {
+        if (!result.is_object() || !result.contains("squawk") || !result.at("squawk").is_string() ||
+            !SquawkValidator::ValidSquawk(result.at("squawk").get<std::string>()) ||
+            !SquawkValidator::AllowedSquawk(result.at("squawk").get<std::string>())) {
+            LogWarning("Invalid bulk squawk assignment for " + callsign + ": " + result.dump());
+            this->EndSquawkUpdate(callsign);
+            return;
+        }
+
+        ApiSquawkAllocation allocation{callsign, result.at("squawk").get<std::string>()};
+        this->allocations->AddAllocationToQueue(allocation);
+        LogInfo("API bulk allocated squawk " + allocation.squawk + " to " + callsign);
+        this->EndSquawkUpdate(callsign);
+    }
+
+    /*
+        Find an existing assignment for the aircraft, or create one if there isn't one.
+
+        THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
+    */
+    void SquawkGenerator::PerformItemRequest(const std::string& callsign, const nlohmann::json& item)
+    {
+        if (!this->GetSquawkAssignment(callsign)) {
+            if (item.value("type", "") == localAssignmentType) {
+                static_cast<void>(this->CreateLocalSquawkAssignment(
+                    callsign, item.value("unit", ""), item.value("rules", "")));
+            } else {
+                static_cast<void>(this->CreateGeneralSquawkAssignment(
+                    callsign, item.value("origin", ""), item.value("destination", "")));
+            }
+        }
+
+        this->EndSquawkUpdate(callsign);
+    }
+
+    /*
+        The bulk request failed, so stop waiting on it. The squawk can be requested again later.
+    */
+    void SquawkGenerator::AbandonRequest(const std::string& callsign)
+    {
+        LogWarning("Abandoning squawk request for " + callsign);
+        this->EndSquawkUpdate(callsign);
+    }
 } // namespace UKControllerPlugin::Squawk
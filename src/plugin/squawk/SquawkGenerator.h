@@ -1,6 +1,7 @@
 #pragma once
 #include "SquawkGeneratorInterface.h"
 #include "SquawkRequest.h"
+#include "api/BulkRequestHandlerInterface.h"
 #include "squawk/SquawkGeneratorInterface.h"
 #include "task/TaskRunnerInterface.h"
 
@@ -8,6 +9,7 @@ namespace UKControllerPlugin {
     namespace Api {
         class ApiResponse;
         class ApiInterface;
+        class ApiRequestCoalescer;
     } // namespace Api
     namespace Euroscope {
         class EuroScopeCFlightPlanInterface;
@@ -30,7 +32,7 @@ namespace UKControllerPlugin::Squawk {
     /*
         Makes the relevant API calls to generate a squawk for an aircraft.
     */
-    class SquawkGenerator : public SquawkGeneratorInterface
+    class SquawkGenerator : public SquawkGeneratorInterface, public Api::BulkRequestHandlerInterface
     {
         public:
         SquawkGenerator(
@@ -61,6 +63,11 @@ namespace UKControllerPlugin::Squawk {
         auto RequestLocalSquawkForAircraft(
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan,
             UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface& radarTarget) -> bool;
+        void SetRequestCoalescer(std::shared_ptr<Api::ApiRequestCoalescer> coalescer);
+        [[nodiscard]] auto PerformBulkRequest(const nlohmann::json& items) -> std::optional<nlohmann::json> override;
+        void ProcessBulkResult(const std::string& callsign, const nlohmann::json& result) override;
+        void PerformItemRequest(const std::string& callsign, const nlohmann::json& item) override;
+        void AbandonRequest(const std::string& callsign) override;
 
         private:
         [[nodiscard]] auto GetSquawkAssignment(const std::string& callsign) const -> bool;
@@ -71,6 +78,7 @@ namespace UKControllerPlugin::Squawk {
         CreateLocalSquawkAssignment(const std::string& callsign, std::string unit, std::string flightRules) const
             -> bool;
         void EndSquawkUpdate(std::string callsign);
+        void QueueSquawkRequest(const std::string& callsign, nlohmann::json item);
         auto StartSquawkUpdate(
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan,
             const std::string& processSquawk = "7000") -> bool;
@@ -95,5 +103,12 @@ namespace UKControllerPlugin::Squawk {
 
         // Receives API squawk allocations, so that they may be assigned to flightplans on the main thread
         const std::shared_ptr<UKControllerPlugin::Squawk::ApiSquawkAllocationHandler> allocations;
+
+        // Batches up automatic squawk requests, if set
+        std::shared_ptr<Api::ApiRequestCoalescer> requestCoalescer;
+
+        // The types of squawk assignment that may be requested
+        inline static const std::string generalAssignmentType = "general";
+        inline static const std::string localAssignmentType = "local";
     };
 } // namespace UKControllerPlugin::Squawk
@@ -6,6 +6,7 @@
 #include "SquawkEventHandler.h"
 #include "SquawkGenerator.h"
 #include "SquawkModule.h"
+#include "api/ApiRequestCoalescer.h"
 #include "bootstrap/PersistenceContainer.h"
 #include "controller/ActiveCallsignCollection.h"
 #include "controller/ControllerStatusEventHandlerCollection.h"
@@ -15,6 +16,7 @@
 #include "eventhandler/EventBus.h"
 #include "eventhandler/EventHandlerFlags.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
 #include "tag/TagFunction.h"
@@ -56,6 +58,12 @@ namespace UKControllerPlugin::Squawk {
             *container.flightplans,
             allocations);
 
+        // Batch up automatic requests so that many aircraft can be served by one API call
+        auto requestCoalescer =
+            std::make_shared<Api::ApiRequestCoalescer>(*container.taskRunner, *container.squawkGenerator);
+        container.squawkGenerator->SetRequestCoalescer(requestCoalescer);
+        container.timedHandler->RegisterEvent(requestCoalescer, SquawkModule::squawkRequestBatchFrequency);
+
         // The event handler
         std::shared_ptr<SquawkEventHandler> eventHandler(new SquawkEventHandler(
             *container.squawkGenerator,
@@ -67,7 +75,7 @@ namespace UKControllerPlugin::Squawk {
 
         container.squawkEvents = eventHandler;
         container.flightplanHandler->RegisterHandler(eventHandler);
-        container.timedHandler->RegisterEvent(eventHandler, squawkAssignmentsCheckFrequency);
+        container.flightplanSweep->RegisterStage(eventHandler, squawkAssignmentsCheckFrequency);
         container.userSettingHandlers->RegisterHandler(eventHandler);
         container.activeCallsigns->AddHandler(eventHandler);
 
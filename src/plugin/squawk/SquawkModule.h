@@ -20,5 +20,8 @@ namespace UKControllerPlugin::Squawk {
 
         // How often to check for new API allocations
         static const int allocationCheckFrequency = 3;
+
+        // How often to send batched automatic squawk requests to the API
+        static const int squawkRequestBatchFrequency = 1;
     };
 } // namespace UKControllerPlugin::Squawk
@@ -1,10 +1,16 @@
 #include "SrdModule.h"
+#include "SrdRouteIndex.h"
+#include "SrdSearchCompletedEvent.h"
 #include "SrdSearchDialog.h"
 #include "SrdSearchHandler.h"
+#include "SrdSearcher.h"
 #include "bootstrap/ModuleFactories.h"
 #include "bootstrap/PersistenceContainer.h"
+#include "dependency/DependencyLoaderInterface.h"
 #include "dialog/DialogManager.h"
 #include "euroscope/CallbackFunction.h"
+#include "eventhandler/EventBus.h"
+#include "eventhandler/EventHandlerFlags.h"
 #include "intention/IntentionCodeModuleFactory.h"
 #include "radarscreen/ConfigurableDisplayCollection.h"
 #include "tag/TagFunction.h"
@@ -14,20 +20,31 @@ using UKControllerPlugin::Dialog::DialogData;
 using UKControllerPlugin::Euroscope::CallbackFunction;
 using UKControllerPlugin::RadarScreen::ConfigurableDisplayCollection;
 using UKControllerPlugin::Tag::TagFunction;
+using UKControllerPluginUtils::EventHandler::EventBus;
+using UKControllerPluginUtils::EventHandler::EventHandlerFlags;
 
 namespace UKControllerPlugin::Srd {
 
     const int srdDialogTagFunctionId = 9004;
     int handlerCallbackId;                              // NOLINT
     std::shared_ptr<SrdSearchHandler> srdSearchHandler; // NOLINT
+    std::shared_ptr<SrdSearcher> srdSearcher;           // NOLINT
 
     void BootstrapPlugin(PersistenceContainer& container)
     {
+        // Index the offline SRD, falling back to the API if we don't have it
+        srdSearcher = std::make_shared<SrdSearcher>(
+            std::make_shared<SrdRouteIndex>(
+                container.dependencyLoader->LoadDependency(GetDependencyKey(), nlohmann::json::array())),
+            *container.api,
+            *container.taskRunner);
+
         // Register the dialog
         std::shared_ptr<SrdSearchDialog> dialog = std::make_shared<SrdSearchDialog>(
             *container.plugin,
-            *container.api,
+            *srdSearcher,
             *container.moduleFactories->IntentionCode().FirExitGenerator(*container.dependencyLoader));
+        EventBus::Bus().AddHandler<SrdSearchCompletedEvent>(dialog, EventHandlerFlags::EuroscopeThread);
         container.dialogManager->AddDialog(
             {IDD_SRD_SEARCH,
              "SRD Search",
@@ -67,4 +84,9 @@ namespace UKControllerPlugin::Srd {
     {
         configurables.RegisterDisplay(srdSearchHandler);
     }
+
+    auto GetDependencyKey() -> std::string
+    {
+        return "DEPENDENCY_SRD";
+    }
 } // namespace UKControllerPlugin::Srd
@@ -16,4 +16,6 @@ namespace UKControllerPlugin::Srd {
     void BootstrapPlugin(UKControllerPlugin::Bootstrap::PersistenceContainer& container);
 
     void BootstrapRadarScreen(UKControllerPlugin::RadarScreen::ConfigurableDisplayCollection& configurables);
+
+    [[nodiscard]] auto GetDependencyKey() -> std::string;
 } // namespace UKControllerPlugin::Srd
@@ -0,0 +1,156 @@
+#include "SrdRouteIndex.h"
+#include "srd/SrdSearchParameters.h"
+
+namespace UKControllerPlugin::Srd {
+
+    SrdRouteIndex::SrdRouteIndex(const nlohmann::json& routes)
+    {
+        if (!routes.is_array()) {
+            LogError("SRD routes are not an array");
+            return;
+        }
+
+        for (const auto& route : routes) {
+            if (!RouteValid(route)) {
+                LogWarning("Invalid SRD route " + route.dump());
+                continue;
+            }
+
+            const auto routeIndex = this->routes.size();
+            this->routes.push_back(
+                {route.at("minimum_level").is_null()
+                     ? std::nullopt
+                     : std::optional<unsigned int>(route.at("minimum_level").get<unsigned int>()),
+                 route.at("maximum_level").get<unsigned int>(),
+                 {{"minimum_level", route.at("minimum_level")},
+                  {"maximum_level", route.at("maximum_level")},
+                  {"route_string", route.at("route_string")},
+                  {"notes", route.at("notes")}}});
+
+            this->byOrigin[Normalise(route.at("origin").get<std::string>())].push_back(routeIndex);
+            this->byDestination[Normalise(route.at("destination").get<std::string>())].push_back(routeIndex);
+
+            // Index each waypoint once, even if the route passes through it more than once
+            std::set<std::string> waypoints;
+            std::istringstream routeString(route.at("route_string").get<std::string>());
+            std::string waypoint;
+            while (routeString >> waypoint) {
+                if (waypoint != "DCT" && waypoints.insert(Normalise(waypoint)).second) {
+                    this->byWaypoint[Normalise(waypoint)].push_back(routeIndex);
+                }
+            }
+        }
+
+        LogInfo("Indexed " + std::to_string(this->routes.size()) + " SRD routes");
+    }
+
+    auto SrdRouteIndex::Count() const -> size_t
+    {
+        return this->routes.size();
+    }
+
+    /*
+        Find all the routes between the origin and destination that are valid at the requested level. If
+        either the origin or destination is blank, it matches anything. If the requested level is zero,
+        all levels match.
+    */
+    auto SrdRouteIndex::Search(const SrdSearchParameters& parameters) const -> nlohmann::json
+    {
+        nlohmann::json results = nlohmann::json::array();
+        const auto origin = Normalise(parameters.origin);
+        const auto destination = Normalise(parameters.destination);
+        if (origin.empty() && destination.empty()) {
+            return results;
+        }
+
+        const auto& candidates =
+            origin.empty() ? this->Find(this->byDestination, destination) : this->Find(this->byOrigin, origin);
+        const auto& destinationRoutes = this->Find(this->byDestination, destination);
+        for (const auto routeIndex : candidates) {
+            const auto& route = this->routes[routeIndex];
+            if (!destination.empty() &&
+                !std::binary_search(destinationRoutes.cbegin(), destinationRoutes.cend(), routeIndex)) {
+                continue;
+            }
+
+            if (!LevelMatches(route, parameters.requestedLevel)) {
+                continue;
+            }
+
+            results.push_back(route.route);
+        }
+
+        return results;
+    }
+
+    /*
+        Find all the routes whose route string passes through the given waypoint or airway.
+    */
+    auto SrdRouteIndex::RoutesVia(const std::string& waypoint) const -> nlohmann::json
+    {
+        nlohmann::json results = nlohmann::json::array();
+        for (const auto routeIndex : this->Find(this->byWaypoint, Normalise(waypoint))) {
+            results.push_back(this->routes[routeIndex].route);
+        }
+
+        return results;
+    }
+
+    auto SrdRouteIndex::RouteValid(const nlohmann::json& route) -> bool
+    {
+        if (!route.is_object() || !route.contains("origin") || !route.at("origin").is_string() ||
+            !route.contains("destination") || !route.at("destination").is_string()) {
+            return false;
+        }
+
+        if (!route.contains("minimum_level") ||
+            (!route.at("minimum_level").is_null() && !LevelValid(route.at("minimum_level")))) {
+            return false;
+        }
+
+        if (!route.contains("maximum_level") || !LevelValid(route.at("maximum_level"))) {
+            return false;
+        }
+
+        if (!route.contains("route_string") || !route.at("route_string").is_string()) {
+            return false;
+        }
+
+        if (!route.contains("notes") || !route.at("notes").is_array()) {
+            return false;
+        }
+
+        return std::all_of(route.at("notes").cbegin(), route.at("notes").cend(), [](const nlohmann::json& note) {
+            return note.is_object() && note.contains("id") && note.at("id").is_number_integer() &&
+                   note.contains("text") && note.at("text").is_string();
+        });
+    }
+
+    auto SrdRouteIndex::LevelValid(const nlohmann::json& level) -> bool
+    {
+        return level.is_number_integer() && level.get<int>() >= 0;
+    }
+
+    auto SrdRouteIndex::LevelMatches(const IndexedRoute& route, unsigned int requestedLevel) -> bool
+    {
+        return requestedLevel == 0 ||
+               (requestedLevel <= route.maximumLevel &&
+                (!route.minimumLevel.has_value() || requestedLevel >= *route.minimumLevel));
+    }
+
+    auto SrdRouteIndex::Normalise(std::string value) -> std::string
+    {
+        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char character) {
+            return static_cast<char>(std::toupper(character));
+        });
+        return value;
+    }
+
+    auto SrdRouteIndex::Find(
+        const std::unordered_map<std::string, std::vector<size_t>>& index, const std::string& key) const
+        -> const std::vector<size_t>&
+    {
+        const auto routes = index.find(key);
+        return routes == index.cend() ? this->noRoutes : routes->second;
+    }
+} // namespace UKControllerPlugin::Srd
@@ -0,0 +1,57 @@
+#pragma once
+
+namespace UKControllerPlugin::Srd {
+    struct SrdSearchParameters;
+
+    /*
+        An in-memory index over the Standard Route Document, so that SRD searches can be answered
+        locally rather than with a round trip to the API.
+
+        Routes are indexed by origin, destination and the waypoints in their route string. Search
+        results are in the same format as the API returns.
+    */
+    class SrdRouteIndex
+    {
+        public:
+        explicit SrdRouteIndex(const nlohmann::json& routes);
+        [[nodiscard]] auto Count() const -> size_t;
+        [[nodiscard]] auto Search(const SrdSearchParameters& parameters) const -> nlohmann::json;
+        [[nodiscard]] auto RoutesVia(const std::string& waypoint) const -> nlohmann::json;
+
+        private:
+        using IndexedRoute = struct IndexedRoute
+        {
+            // The minimum level, if any
+            std::optional<unsigned int> minimumLevel;
+
+            // The maximum level
+            unsigned int maximumLevel;
+
+            // The route, as it would come from the API
+            nlohmann::json route;
+        };
+
+        [[nodiscard]] static auto RouteValid(const nlohmann::json& route) -> bool;
+        [[nodiscard]] static auto LevelValid(const nlohmann::json& level) -> bool;
+        [[nodiscard]] static auto LevelMatches(const IndexedRoute& route, unsigned int requestedLevel) -> bool;
+        [[nodiscard]] static auto Normalise(std::string value) -> std::string;
+        [[nodiscard]] auto Find(
+            const std::unordered_map<std::string, std::vector<size_t>>& index, const std::string& key) const
+            -> const std::vector<size_t>&;
+
+        // All the routes
+        std::vector<IndexedRoute> routes;
+
+        // Routes by origin
+        std::unordered_map<std::string, std::vector<size_t>> byOrigin;
+
+        // Routes by destination
+        std::unordered_map<std::string, std::vector<size_t>> byDestination;
+
+        // Routes by each waypoint in the route string
+        std::unordered_map<std::string, std::vector<size_t>> byWaypoint;
+
+        // No routes to return
+        const std::vector<size_t> noRoutes;
+    };
+} // namespace UKControllerPlugin::Srd
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace UKControllerPlugin::Srd {
+    /*
+        Fired when an SRD search that had to go to the API has finished.
+    */
+    using SrdSearchCompletedEvent = struct SrdSearchCompletedEvent
+    {
+        // The search this is the result of
+        int searchId;
+
+        // The search results, in API format
+        nlohmann::json results;
+    };
+} // namespace UKControllerPlugin::Srd
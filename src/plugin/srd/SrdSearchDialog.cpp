@@ -1,7 +1,6 @@
 #include "ContainsFreeRouteAirspace.h"
 #include "SrdSearchDialog.h"
-#include "api/ApiException.h"
-#include "api/ApiInterface.h"
+#include "SrdSearcher.h"
 #include "datablock/DatablockFunctions.h"
 #include "dialog/DialogCallArgument.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
@@ -12,16 +11,15 @@
 #include "intention/FirExitPoint.h"
 #include "srd/SrdSearchParameters.h"
 
-using UKControllerPlugin::Api::ApiException;
 using UKControllerPlugin::Datablock::ConvertAltitudeToFlightLevel;
 using UKControllerPlugin::Dialog::DialogCallArgument;
 
 namespace UKControllerPlugin::Srd {
     SrdSearchDialog::SrdSearchDialog(
         Euroscope::EuroscopePluginLoopbackInterface& plugin,
-        const UKControllerPlugin::Api::ApiInterface& api,
+        SrdSearcher& searcher,
         IntentionCode::AircraftFirExitGenerator& firExitGenerator)
-        : plugin(plugin), api(api), firExitGenerator(firExitGenerator)
+        : plugin(plugin), searcher(searcher), firExitGenerator(firExitGenerator)
     {
     }
     /*
@@ -128,7 +126,7 @@ namespace UKControllerPlugin::Srd {
         }
         // Dialog Closed
         case WM_CLOSE: {
-            EndDialog(hwnd, wParam);
+            this->CloseDialog(hwnd, wParam);
             return TRUE;
         }
         // Catching the events when search results are clicked.
@@ -148,11 +146,11 @@ namespace UKControllerPlugin::Srd {
         case WM_COMMAND: {
             switch (LOWORD(wParam)) {
             case IDOK: {
-                EndDialog(hwnd, wParam);
+                this->CloseDialog(hwnd, wParam);
                 return TRUE;
             }
             case IDCANCEL: {
-                EndDialog(hwnd, wParam);
+                this->CloseDialog(hwnd, wParam);
                 return TRUE;
             }
             case IDC_SRD_SEARCH: {
@@ -174,6 +172,8 @@ namespace UKControllerPlugin::Srd {
 
     void SrdSearchDialog::InitDialog(HWND hwnd, LPARAM lParam)
     {
+        this->dialogWindow = hwnd;
+
         // Prepopulate the search fields
         this->PrepopulateSearch(hwnd, lParam);
 
@@ -208,6 +208,28 @@ namespace UKControllerPlugin::Srd {
         ListView_InsertColumn(resultsList, 3, &routeStringColumn);
     }
 
+    /*
+        Close the dialog, after which any searches still running in the background have nowhere to go.
+    */
+    void SrdSearchDialog::CloseDialog(HWND hwnd, WPARAM wParam)
+    {
+        this->dialogWindow = nullptr;
+        EndDialog(hwnd, wParam);
+    }
+
+    /*
+        A search that had to go to the API has finished. If the dialog has moved on to another
+        search or been closed in the meantime, the results are no longer wanted.
+    */
+    void SrdSearchDialog::OnEvent(const SrdSearchCompletedEvent& event)
+    {
+        if (this->dialogWindow == nullptr || !this->searcher.IsLatestSearch(event.searchId)) {
+            return;
+        }
+
+        this->DisplayResults(this->dialogWindow, event.results);
+    }
+
     void SrdSearchDialog::StartSearch(HWND hwnd)
     {
         SrdSearchParameters searchParams;
@@ -248,34 +270,31 @@ namespace UKControllerPlugin::Srd {
             return;
         }
 
-        // Do the search and validate the results
-        try {
-            this->previousSearchResults = this->api.SearchSrd(searchParams);
-        } catch (ApiException e) {
-            LogError("Failed to perform SRD search: " + std::string(e.what()));
+        // Do the search, if it has to go to the API the results will come back later
+        auto results = this->searcher.Search(searchParams);
+        if (!results.has_value()) {
+            this->DisplayMessage(hwnd, L"Searching...");
+            return;
         }
 
-        if (this->previousSearchResults.empty() || !this->SearchResultsValid(this->previousSearchResults)) {
-            LVITEM item;
-            item.mask = LVIF_TEXT;
-            item.iItem = 0;
-            item.iSubItem = 0;
+        this->DisplayResults(hwnd, std::move(*results));
+    }
 
-            // Nothing found, display the fact
-            wchar_t zero[2] = L"0";
-            item.pszText = zero;
-            ListView_InsertItem(resultsList, &item);
-            item.iSubItem++;
-            item.pszText = zero;
-            ListView_SetItem(resultsList, &item);
-            item.iSubItem++;
-            item.pszText = zero;
-            ListView_SetItem(resultsList, &item);
-            item.iSubItem++;
-            wchar_t noneFound[16] = L"No routes found";
-            item.pszText = noneFound;
-            ListView_SetItem(resultsList, &item);
+    /*
+        Validate the search results and put them in the results list.
+    */
+    void SrdSearchDialog::DisplayResults(HWND hwnd, nlohmann::json results)
+    {
+        HWND resultsList = GetDlgItem(hwnd, IDC_SRD_RESULTS);
+        if (resultsList == NULL) {
+            return;
+        }
 
+        ListView_DeleteAllItems(resultsList);
+        this->previousSearchResults = std::move(results);
+        if (this->previousSearchResults.empty() || !this->SearchResultsValid(this->previousSearchResults)) {
+            this->previousSearchResults = this->noResultsFound;
+            this->DisplayMessage(hwnd, L"No routes found");
             return;
         }
 
@@ -320,6 +339,33 @@ namespace UKControllerPlugin::Srd {
         }
     }
 
+    /*
+        Show a message in the results list in place of any routes.
+    */
+    void SrdSearchDialog::DisplayMessage(HWND hwnd, const std::wstring& message)
+    {
+        HWND resultsList = GetDlgItem(hwnd, IDC_SRD_RESULTS);
+        ListView_DeleteAllItems(resultsList);
+
+        LVITEM item;
+        item.mask = LVIF_TEXT;
+        item.iItem = 0;
+        item.iSubItem = 0;
+
+        wchar_t zero[2] = L"0";
+        item.pszText = zero;
+        ListView_InsertItem(resultsList, &item);
+        item.iSubItem++;
+        item.pszText = zero;
+        ListView_SetItem(resultsList, &item);
+        item.iSubItem++;
+        item.pszText = zero;
+        ListView_SetItem(resultsList, &item);
+        item.iSubItem++;
+        item.pszText = const_cast<LPWSTR>(message.c_str()); // NOLINT
+        ListView_SetItem(resultsList, &item);
+    }
+
     void SrdSearchDialog::CopyRouteStringToClipboard(HWND hwnd)
     {
         if (!OpenClipboard(hwnd)) {
@@ -1,9 +1,8 @@
 #pragma once
+#include "SrdSearchCompletedEvent.h"
+#include "eventhandler/EventHandler.h"
 
 namespace UKControllerPlugin {
-    namespace Api {
-        class ApiInterface;
-    } // namespace Api
     namespace Euroscope {
         class EuroscopePluginLoopbackInterface;
     } // namespace Euroscope
@@ -13,25 +12,30 @@ namespace UKControllerPlugin {
 } // namespace UKControllerPlugin
 
 namespace UKControllerPlugin::Srd {
+    class SrdSearcher;
 
     /*
         A class for performing SRD searches
     */
-    class SrdSearchDialog
+    class SrdSearchDialog : public UKControllerPluginUtils::EventHandler::EventHandler<SrdSearchCompletedEvent>
     {
         public:
         SrdSearchDialog(
             Euroscope::EuroscopePluginLoopbackInterface& plugin,
-            const UKControllerPlugin::Api::ApiInterface& api,
+            SrdSearcher& searcher,
             IntentionCode::AircraftFirExitGenerator& firExitGenerator);
         static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
         bool SearchResultsValid(const nlohmann::json& results) const;
         std::string FormatNotes(const nlohmann::json& json, size_t selectedIndex) const;
+        void OnEvent(const SrdSearchCompletedEvent& event) override;
 
         private:
         LRESULT _WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
         void InitDialog(HWND hwnd, LPARAM lParam);
+        void CloseDialog(HWND hwnd, WPARAM wParam);
         void StartSearch(HWND hwnd);
+        void DisplayResults(HWND hwnd, nlohmann::json results);
+        void DisplayMessage(HWND hwnd, const std::wstring& message);
         void CopyRouteStringToClipboard(HWND hwnd);
         void SelectSearchResult(HWND hwnd, NMLISTVIEW* details);
         void PrepopulateSearch(HWND hwnd, LPARAM lParam);
@@ -39,8 +43,8 @@ namespace UKControllerPlugin::Srd {
         // Plugin for flightplan finding
         Euroscope::EuroscopePluginLoopbackInterface& plugin;
 
-        // The API for making searches
-        const UKControllerPlugin::Api::ApiInterface& api;
+        // Performs the searches
+        SrdSearcher& searcher;
 
         // For prepopulating UK exit points
         IntentionCode::AircraftFirExitGenerator& firExitGenerator;
@@ -53,5 +57,8 @@ namespace UKControllerPlugin::Srd {
 
         // The selected search result
         size_t selectedResult = 0;
+
+        // The dialog window, whilst it is open
+        HWND dialogWindow = nullptr;
     };
 } // namespace UKControllerPlugin::Srd
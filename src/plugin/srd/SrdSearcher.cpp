@@ -0,0 +1,57 @@
+#include "SrdRouteIndex.h"
+#include "SrdSearchCompletedEvent.h"
+#include "SrdSearcher.h"
+#include "api/ApiException.h"
+#include "api/ApiInterface.h"
+#include "eventhandler/EventBus.h"
+#include "srd/SrdSearchParameters.h"
+#include "task/TaskRunnerInterface.h"
+
+using UKControllerPlugin::Api::ApiException;
+using UKControllerPluginUtils::EventHandler::EventBus;
+
+namespace UKControllerPlugin::Srd {
+
+    SrdSearcher::SrdSearcher(
+        std::shared_ptr<const SrdRouteIndex> index,
+        const Api::ApiInterface& api,
+        TaskManager::TaskRunnerInterface& taskRunner)
+        : index(std::move(index)), api(api), taskRunner(taskRunner)
+    {
+    }
+
+    /*
+        Search for routes. If the results are available straight away, they are returned. Otherwise, the
+        search continues in the background and nullopt is returned.
+    */
+    auto SrdSearcher::Search(const SrdSearchParameters& parameters) -> std::optional<nlohmann::json>
+    {
+        const auto searchId = ++this->latestSearch;
+        if (this->index->Count() != 0) {
+            return this->index->Search(parameters);
+        }
+
+        this->taskRunner.QueueAsynchronousTask([&api = this->api, parameters, searchId]() {
+            nlohmann::json results = nlohmann::json::array();
+            try {
+                results = api.SearchSrd(parameters);
+            } catch (ApiException& exception) {
+                LogError("Failed to perform SRD search: " + std::string(exception.what()));
+            }
+
+            EventBus::Bus().OnEvent<SrdSearchCompletedEvent>({searchId, std::move(results)});
+        });
+
+        return std::nullopt;
+    }
+
+    auto SrdSearcher::IsLatestSearch(int searchId) const -> bool
+    {
+        return searchId == this->latestSearch;
+    }
+
+    auto SrdSearcher::LatestSearch() const -> int
+    {
+        return this->latestSearch;
+    }
+} // namespace UKControllerPlugin::Srd
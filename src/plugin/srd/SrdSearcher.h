@@ -0,0 +1,47 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Api {
+        class ApiInterface;
+    } // namespace Api
+    namespace TaskManager {
+        class TaskRunnerInterface;
+    } // namespace TaskManager
+} // namespace UKControllerPlugin
+
+namespace UKControllerPlugin::Srd {
+    class SrdRouteIndex;
+    struct SrdSearchParameters;
+
+    /*
+        Performs SRD searches without blocking the EuroScope thread.
+
+        Searches are answered from the offline route index where it has been loaded. If it hasn't,
+        the API is searched on the task runner and the results are delivered back on the EuroScope
+        thread as an SrdSearchCompletedEvent.
+    */
+    class SrdSearcher
+    {
+        public:
+        SrdSearcher(
+            std::shared_ptr<const SrdRouteIndex> index,
+            const Api::ApiInterface& api,
+            TaskManager::TaskRunnerInterface& taskRunner);
+        [[nodiscard]] auto Search(const SrdSearchParameters& parameters) -> std::optional<nlohmann::json>;
+        [[nodiscard]] auto IsLatestSearch(int searchId) const -> bool;
+        [[nodiscard]] auto LatestSearch() const -> int;
+
+        private:
+        // The offline index of routes
+        const std::shared_ptr<const SrdRouteIndex> index;
+
+        // The API, for when we have no offline routes
+        const Api::ApiInterface& api;
+
+        // Runs API searches away from the EuroScope thread
+        TaskManager::TaskRunnerInterface& taskRunner;
+
+        // The id of the most recent search, so stale API results can be ignored
+        int latestSearch = 0;
+    };
+} // namespace UKControllerPlugin::Srd
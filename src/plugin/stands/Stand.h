@@ -15,5 +15,10 @@ namespace UKControllerPlugin::Stands {
 
         // The identifier of the stand
         std::string identifier;
+
+        // The position of the stand, if known
+        double latitude = 0.0;
+        double longitude = 0.0;
+        bool hasPosition = false;
     };
 } // namespace UKControllerPlugin::Stands
@@ -1,15 +1,20 @@
 #include "StandAssignedMessage.h"
 #include "StandEventHandler.h"
+#include "StandOccupancyConflictEvent.h"
 #include "StandUnassignedMessage.h"
 #include "api/ApiException.h"
 #include "api/ApiInterface.h"
+#include "api/ApiRequestCoalescer.h"
 #include "api/ApiRequestFactory.h"
 #include "api/ApiRequestException.h"
+#include "api/PerformBulkApiRequest.h"
 #include "euroscope/EuroScopeCControllerInterface.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
+#include "eventhandler/EventBus.h"
 #include "ownership/AirfieldServiceProviderCollection.h"
+#include "push/SharedSyncData.h"
 #include "tag/TagData.h"
 #include "task/TaskRunnerInterface.h"
 
@@ -33,7 +38,7 @@ namespace UKControllerPlugin::Stands {
         std::shared_ptr<Ownership::AirfieldServiceProviderCollection> ownership,
         std::set<Stand, CompareStands> stands,
         int standSelectedCallbackId)
-        : api(api), taskRunner(taskRunner), plugin(plugin), stands(std::move(stands)),
+        : api(api), taskRunner(taskRunner), plugin(plugin), stands(std::move(stands)), standIndex(this->stands),
           integrationEventHandler(integrationEventHandler), ownership(ownership),
           standSelectedCallbackId(standSelectedCallbackId)
     {
@@ -104,12 +109,8 @@ namespace UKControllerPlugin::Stands {
         const std::string& callsign, const std::string& airfield, const std::string& identifier) -> std::string
     {
         // Find the requested stand
-        auto stand = std::find_if(
-            this->stands.cbegin(), this->stands.cend(), [airfield, identifier](const Stand& stand) -> bool {
-                return stand.identifier == identifier && stand.airfieldCode == airfield;
-            });
-
-        if (stand == this->stands.cend()) {
+        const auto* stand = this->standIndex.FindStand(airfield, identifier);
+        if (stand == nullptr) {
             LogInfo("Tried to assign a non-existant stand");
             return "Tried to assign a non-existant stand";
         }
@@ -167,12 +168,8 @@ namespace UKControllerPlugin::Stands {
         menuItem.fixedPosition = false;
 
         // Add each stand in turn
-        for (auto stand = this->stands.cbegin(); stand != this->stands.cend(); ++stand) {
-            if (stand->airfieldCode != this->lastAirfieldUsed) {
-                continue;
-            }
-
-            menuItem.firstValue = stand->identifier;
+        for (const auto& stand : this->standIndex.StandsAtAirfield(this->lastAirfieldUsed)) {
+            menuItem.firstValue = stand.identifier;
             this->plugin.AddItemToPopupList(menuItem);
         }
 
@@ -200,6 +197,18 @@ namespace UKControllerPlugin::Stands {
         return this->lastAirfieldUsed;
     }
 
+    auto StandEventHandler::GetOccupiedStand(const std::string& callsign) const -> int
+    {
+        std::lock_guard lock(this->mapMutex);
+        return this->standIndex.GetOccupiedStand(callsign);
+    }
+
+    auto StandEventHandler::HasStandConflict(const std::string& callsign) const -> bool
+    {
+        std::lock_guard lock(this->mapMutex);
+        return this->standConflicts.contains(callsign);
+    }
+
     /*
         Remove the flight strip annotation for vSMR
     */
@@ -293,6 +302,9 @@ namespace UKControllerPlugin::Stands {
             }
 
             tagData.SetItemString(stand->identifier);
+            if (this->standConflicts.contains(tagData.GetFlightplan().GetCallsign())) {
+                tagData.SetTagColour(this->standConflictColour);
+            }
         }
     }
 
@@ -353,6 +365,8 @@ namespace UKControllerPlugin::Stands {
     void StandEventHandler::FlightPlanEvent(
         EuroScopeCFlightPlanInterface& flightPlan, EuroScopeCRadarTargetInterface& radarTarget)
     {
+        this->aircraftAirfields[flightPlan.GetCallsign()] = {flightPlan.GetOrigin(), flightPlan.GetDestination()};
+
         auto mapLock = this->LockStandMap();
         if (this->standAssignments.count(flightPlan.GetCallsign()) == 0) {
             return;
@@ -369,7 +383,120 @@ namespace UKControllerPlugin::Stands {
 
     void StandEventHandler::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface& flightPlan)
     {
-        // Nothing to do
+        this->aircraftAirfields.erase(flightPlan.GetCallsign());
+
+        auto mapLock = this->LockStandMap();
+        this->standConflicts.erase(flightPlan.GetCallsign());
+        this->UpdateStandOccupancy(flightPlan.GetCallsign(), StandIndex::noStand);
+    }
+
+    /*
+        Keep track of which aircraft are sat on which stands, so we can spot when an aircraft is assigned
+        a stand that is already occupied.
+
+        Occupancy is only ever changed on the EuroScope thread, so we can read it here without the lock and
+        only take the lock when the aircraft has actually moved on or off a stand.
+    */
+    void StandEventHandler::RadarTargetPositionUpdateEvent(EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        const auto callsign = radarTarget.GetCallsign();
+        const auto occupiedStand = this->standIndex.GetOccupiedStand(callsign);
+        const auto airfields = this->aircraftAirfields.find(callsign);
+        const auto canBeOnStand = airfields != this->aircraftAirfields.cend() &&
+                                  (this->standIndex.HasPositionedStands(airfields->second.origin) ||
+                                   this->standIndex.HasPositionedStands(airfields->second.destination));
+
+        if (!canBeOnStand && occupiedStand == StandIndex::noStand) {
+            return;
+        }
+
+        const Stand* stand = nullptr;
+        if (canBeOnStand && radarTarget.GetGroundSpeed() <= this->maxStandOccupancyGroundSpeed) {
+            stand = this->GetStandAtAircraftPosition(airfields->second, radarTarget);
+        }
+
+        const auto standId = stand == nullptr ? StandIndex::noStand : stand->id;
+        if (standId == occupiedStand) {
+            return;
+        }
+
+        auto mapLock = this->LockStandMap();
+        this->UpdateStandOccupancy(callsign, standId);
+    }
+
+    /*
+        Aircraft on the ground will be at either their origin or their destination.
+    */
+    auto StandEventHandler::GetStandAtAircraftPosition(
+        const AircraftAirfields& airfields, const EuroScopeCRadarTargetInterface& radarTarget) const -> const Stand*
+    {
+        const auto position = radarTarget.GetPosition();
+        const auto* stand =
+            this->standIndex.StandAtPosition(airfields.origin, position.m_Latitude, position.m_Longitude);
+
+        return stand != nullptr ? stand
+                                : this->standIndex.StandAtPosition(
+                                      airfields.destination, position.m_Latitude, position.m_Longitude);
+    }
+
+    /*
+        Record the stand that an aircraft is on and re-check anyone assigned to the stands involved.
+    */
+    void StandEventHandler::UpdateStandOccupancy(const std::string& callsign, int standId)
+    {
+        const auto previousStand = this->standIndex.GetOccupiedStand(callsign);
+        if (previousStand == standId) {
+            return;
+        }
+
+        if (standId == StandIndex::noStand) {
+            this->standIndex.RemoveOccupant(callsign);
+        } else {
+            this->standIndex.SetOccupant(callsign, standId);
+            this->CheckStandConflictsForStand(standId);
+        }
+
+        if (previousStand != StandIndex::noStand) {
+            this->CheckStandConflictsForStand(previousStand);
+        }
+    }
+
+    void StandEventHandler::CheckStandConflictsForStand(int standId)
+    {
+        for (const auto& [callsign, assignedStand] : this->standAssignments) {
+            if (assignedStand == standId) {
+                this->CheckStandConflict(callsign);
+            }
+        }
+    }
+
+    /*
+        An aircraft has a stand conflict if a different aircraft is sat on its assigned stand. We only raise the
+        conflict once, rather than every time we check.
+    */
+    void StandEventHandler::CheckStandConflict(const std::string& callsign)
+    {
+        const auto assignment = this->standAssignments.find(callsign);
+        const auto occupant = assignment == this->standAssignments.cend()
+                                  ? ""
+                                  : this->standIndex.GetOccupant(assignment->second);
+
+        if (occupant.empty() || occupant == callsign) {
+            this->standConflicts.erase(callsign);
+            return;
+        }
+
+        const auto existingConflict = this->standConflicts.find(callsign);
+        if (existingConflict != this->standConflicts.cend() && existingConflict->second == occupant) {
+            return;
+        }
+
+        this->standConflicts[callsign] = occupant;
+        LogWarning(
+            "Stand id " + std::to_string(assignment->second) + " assigned to " + callsign + " is occupied by " +
+            occupant);
+        UKControllerPluginUtils::EventHandler::EventBus::Bus().OnEvent<StandOccupancyConflictEvent>(
+            {callsign, assignment->second, occupant});
     }
 
     void StandEventHandler::ControllerFlightPlanDataEvent(EuroScopeCFlightPlanInterface& flightPlan, int dataType)
@@ -381,15 +508,16 @@ namespace UKControllerPlugin::Stands {
     {
         this->taskRunner.QueueAsynchronousTask([this]() {
             try {
-                nlohmann::json standAssignments = this->api.GetAssignedStands();
+                nlohmann::json standAssignments = this->LoadStandAssignments();
 
                 if (!standAssignments.is_array()) {
                     LogWarning("Invalid stand assignment data");
                     return;
                 }
 
-                // Delete all existing assignments
+                // Replace the existing assignments, only announcing those that have changed
                 auto mapLock = this->LockStandMap();
+                auto previousAssignments = std::move(this->standAssignments);
                 this->standAssignments.clear();
 
                 for (auto assignment = standAssignments.cbegin(); assignment != standAssignments.cend(); ++assignment) {
@@ -398,10 +526,20 @@ namespace UKControllerPlugin::Stands {
                         continue;
                     }
 
-                    this->AssignStandToAircraft(
-                        assignment->at("callsign").get<std::string>(),
-                        *this->stands.find(assignment->at("stand_id").get<int>()));
+                    const auto callsign = assignment->at("callsign").get<std::string>();
+                    const auto standId = assignment->at("stand_id").get<int>();
+                    const auto previous = previousAssignments.find(callsign);
+                    if (previous != previousAssignments.cend() && previous->second == standId) {
+                        this->standAssignments[callsign] = standId;
+                        continue;
+                    }
+
+                    this->AssignStandToAircraft(callsign, *this->stands.find(standId));
                 }
+                std::erase_if(this->standConflicts, [this](const auto& conflict) {
+                    return !this->standAssignments.contains(conflict.first);
+                });
+                this->restoredAssignments.clear();
                 LogInfo("Loaded " + std::to_string(this->standAssignments.size()) + " stand assignments");
             } catch (ApiException&) {
                 LogError("Unable to load stand assignment data");
@@ -450,6 +588,7 @@ namespace UKControllerPlugin::Stands {
     {
         this->RemoveFlightStripAnnotation(callsign);
         this->standAssignments.erase(callsign);
+        this->standConflicts.erase(callsign);
         this->integrationEventHandler.SendEvent(std::make_shared<StandUnassignedMessage>(callsign));
         LogInfo("Stand assignment removed for " + callsign);
     }
@@ -458,6 +597,7 @@ namespace UKControllerPlugin::Stands {
     {
         this->AnnotateFlightStrip(callsign, stand.id);
         this->standAssignments[callsign] = stand.id;
+        this->CheckStandConflict(callsign);
         this->integrationEventHandler.SendEvent(
             std::make_shared<StandAssignedMessage>(callsign, stand.airfieldCode, stand.identifier));
         LogInfo(
@@ -579,33 +719,148 @@ namespace UKControllerPlugin::Stands {
 
     void StandEventHandler::DoApiStandRequest(const std::string& callsign, const nlohmann::json data)
     {
+        if (this->requestCoalescer) {
+            if (!this->requestCoalescer->Enqueue(callsign, data)) {
+                LogDebug("Stand assignment request already in progress for " + callsign);
+            }
+            return;
+        }
+
         LogDebug("Requesting stand assignment from API: " + data.dump());
         const std::string requestCallsign = callsign;
         ApiRequest()
             .Post("stand/assignment/requestauto", data)
             .Then([this, requestCallsign](const UKControllerPluginUtils::Api::Response& response) {
-                auto lock = this->LockStandMap();
+                this->ProcessStandRequestResponse(requestCallsign, response.Data());
+            })
+            .Catch([requestCallsign](const UKControllerPluginUtils::Api::ApiRequestException& exception) {
+                LogError("Failed to request stand assignment for " + requestCallsign + ": " + exception.what());
+            });
+    }
 
-                const auto& data = response.Data();
-                if (!data.contains("stand_id") || !data.at("stand_id").is_number_integer()) {
-                    LogWarning("Invalid stand assignment response " + data.dump());
-                    return;
-                }
+    void StandEventHandler::ProcessStandRequestResponse(const std::string& callsign, const nlohmann::json& data)
+    {
+        auto lock = this->LockStandMap();
+        if (!data.contains("stand_id") || !data.at("stand_id").is_number_integer()) {
+            LogWarning("Invalid stand assignment response " + data.dump());
+            return;
+        }
 
-                const auto standId = data.at("stand_id").get<int>();
-                if (!this->stands.contains(standId)) {
-                    LogWarning("Invalid stand assignment response, bad id " + data.dump());
-                    return;
-                }
+        const auto standId = data.at("stand_id").get<int>();
+        if (!this->stands.contains(standId)) {
+            LogWarning("Invalid stand assignment response, bad id " + data.dump());
+            return;
+        }
+
+        const auto& stand = this->stands.find(standId);
+        LogInfo("API generated stand assignment " + std::to_string(standId) + " for " + callsign);
+
+        this->AssignStandToAircraft(callsign, *stand);
+    }
 
-                const auto& stand = this->stands.find(standId);
-                LogInfo("API generated stand assignment " + std::to_string(standId) + " for " + requestCallsign);
+    void StandEventHandler::SetRequestCoalescer(std::shared_ptr<Api::ApiRequestCoalescer> coalescer)
+    {
+        this->requestCoalescer = std::move(coalescer);
+    }
+
+    void StandEventHandler::SetSharedSyncData(std::shared_ptr<Push::SharedSyncData> sharedSync)
+    {
+        this->sharedSync = std::move(sharedSync);
+    }
+
+    /*
+        Save the stand assignments so that after a restart we only have to catch up on what's changed.
+    */
+    auto StandEventHandler::SaveState() const -> nlohmann::json
+    {
+        std::lock_guard lock(this->mapMutex);
+        return this->standAssignments;
+    }
+
+    void StandEventHandler::RestoreState(const nlohmann::json& state)
+    {
+        auto mapLock = this->LockStandMap();
+        for (const auto& [callsign, standId] : state.items()) {
+            if (!standId.is_number_integer() || this->stands.find(standId.get<int>()) == this->stands.cend()) {
+                LogWarning("Invalid saved stand assignment for " + callsign);
+                continue;
+            }
+
+            this->standAssignments[callsign] = standId.get<int>();
+            this->restoredAssignments[callsign] = standId.get<int>();
+        }
+    }
 
-                this->AssignStandToAircraft(requestCallsign, *stand);
+    /*
+        Only drop the assignment if it's still the one we restored, and the API hasn't confirmed it since.
+    */
+    void StandEventHandler::ExpireRestoredState(const std::string& callsign)
+    {
+        auto mapLock = this->LockStandMap();
+        const auto restored = this->restoredAssignments.find(callsign);
+        if (restored == this->restoredAssignments.cend()) {
+            return;
+        }
+
+        const auto assignment = this->standAssignments.find(callsign);
+        if (assignment != this->standAssignments.cend() && assignment->second == restored->second) {
+            this->standAssignments.erase(assignment);
+            this->standConflicts.erase(callsign);
+            LogInfo("Restored stand assignment expired for " + callsign);
+        }
+
+        this->restoredAssignments.erase(restored);
+    }
+
+    /*
+        Use the stand assignments another EuroScope instance has shared if we can, otherwise load them
+        from the API and share them.
+    */
+    auto StandEventHandler::LoadStandAssignments() const -> nlohmann::json
+    {
+        if (!this->sharedSync) {
+            return this->api.GetAssignedStands();
+        }
+
+        if (auto shared = this->sharedSync->Get(sharedSyncKey)) {
+            return *shared;
+        }
+
+        nlohmann::json standAssignments = this->api.GetAssignedStands();
+        this->sharedSync->Publish(sharedSyncKey, standAssignments);
+        return standAssignments;
+    }
+
+    /*
+        Request stands for many aircraft at once, the API responds with the stand assignment for
+        each aircraft keyed by callsign.
+    */
+    auto StandEventHandler::PerformBulkRequest(const nlohmann::json& items) -> std::optional<nlohmann::json>
+    {
+        return Api::PerformBulkApiRequest("stand/assignment/requestauto/bulk", items);
+    }
+
+    void StandEventHandler::ProcessBulkResult(const std::string& callsign, const nlohmann::json& result)
+    {
+        this->ProcessStandRequestResponse(callsign, result);
+    }
+
+    void StandEventHandler::PerformItemRequest(const std::string& callsign, const nlohmann::json& item)
+    {
+        LogDebug("Requesting stand assignment from API: " + item.dump());
+        ApiRequest()
+            .Post("stand/assignment/requestauto", item)
+            .Then([this, callsign](const UKControllerPluginUtils::Api::Response& response) {
+                this->ProcessStandRequestResponse(callsign, response.Data());
             })
-            .Catch([requestCallsign](const UKControllerPluginUtils::Api::ApiRequestException& exception) {
-                LogError("Failed to request stand assignment for " + requestCallsign + ": " + exception.what());
-            });
+            .Catch([callsign](const UKControllerPluginUtils::Api::ApiRequestException& exception) {
+                LogError("Failed to request stand assignment for " + callsign + ": " + exception.what());
+            })
+            .Await();
     }
 
+    void StandEventHandler::AbandonRequest(const std::string& callsign)
+    {
+        LogWarning("Abandoning stand assignment request for " + callsign);
+    }
 } // namespace UKControllerPlugin::Stands
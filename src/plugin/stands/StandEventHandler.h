@@ -1,16 +1,21 @@
 #pragma once
 #include "CompareStands.h"
 #include "Stand.h"
+#include "StandIndex.h"
+#include "api/BulkRequestHandlerInterface.h"
+#include "euroscope/RadarTargetEventHandlerInterface.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
 #include "integration/ExternalMessageHandlerInterface.h"
 #include "integration/IntegrationActionProcessor.h"
 #include "integration/OutboundIntegrationEventHandler.h"
 #include "push/PushEventProcessorInterface.h"
+#include "state/PersistentStateInterface.h"
 #include "tag/TagItemInterface.h"
 
 namespace UKControllerPlugin {
     namespace Api {
         class ApiInterface;
+        class ApiRequestCoalescer;
     } // namespace Api
     namespace Euroscope {
         class EuroscopePluginLoopbackInterface;
@@ -18,6 +23,9 @@ namespace UKControllerPlugin {
     namespace Ownership {
         class AirfieldServiceProviderCollection;
     } // namespace Ownership
+    namespace Push {
+        class SharedSyncData;
+    } // namespace Push
     namespace TaskManager {
         class TaskRunnerInterface;
     } // namespace TaskManager
@@ -30,8 +38,11 @@ namespace UKControllerPlugin::Stands {
     class StandEventHandler : public Tag::TagItemInterface,
                               public Push::PushEventProcessorInterface,
                               public Flightplan::FlightPlanEventHandlerInterface,
+                              public Euroscope::RadarTargetEventHandlerInterface,
                               public Integration::ExternalMessageHandlerInterface,
-                              public Integration::IntegrationActionProcessor
+                              public Integration::IntegrationActionProcessor,
+                              public Api::BulkRequestHandlerInterface,
+                              public State::PersistentStateInterface
     {
         public:
         StandEventHandler(
@@ -62,6 +73,8 @@ namespace UKControllerPlugin::Stands {
             const POINT& mousePos);
         [[nodiscard]] auto GetAssignedStandForCallsign(const std::string& callsign) const -> int;
         [[nodiscard]] auto GetLastAirfield() const -> std::string;
+        [[nodiscard]] auto GetOccupiedStand(const std::string& callsign) const -> int;
+        [[nodiscard]] auto HasStandConflict(const std::string& callsign) const -> bool;
         void RemoveFlightStripAnnotation(const std::string& callsign) const;
         void SetAssignedStand(const std::string& callsign, int standId);
         void StandSelected(int functionId, std::string context, RECT);
@@ -87,13 +100,42 @@ namespace UKControllerPlugin::Stands {
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightPlan, int dataType) override;
         void PluginEventsSynced() override;
 
+        // Inherited via RadarTargetEventHandlerInterface
+        void RadarTargetPositionUpdateEvent(
+            UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
+
         // Inherited via ExternalMessageHandlerInterface
         auto ProcessMessage(std::string message) -> bool override;
 
+        void SetRequestCoalescer(std::shared_ptr<Api::ApiRequestCoalescer> coalescer);
+        [[nodiscard]] auto PerformBulkRequest(const nlohmann::json& items) -> std::optional<nlohmann::json> override;
+        void ProcessBulkResult(const std::string& callsign, const nlohmann::json& result) override;
+        void PerformItemRequest(const std::string& callsign, const nlohmann::json& item) override;
+        void AbandonRequest(const std::string& callsign) override;
+        void SetSharedSyncData(std::shared_ptr<Push::SharedSyncData> sharedSync);
+        [[nodiscard]] auto SaveState() const -> nlohmann::json override;
+        void RestoreState(const nlohmann::json& state) override;
+        void ExpireRestoredState(const std::string& callsign) override;
+
+        // The key stand assignments are shared between EuroScope instances under
+        inline static const std::string sharedSyncKey = "stand-assignments";
+
+        // The key stand assignments are saved under between restarts
+        inline static const std::string stateKey = "stand-assignments";
+
         // No stand has been assigned to the aircraft
         inline static const int noStandAssigned = -1;
 
         private:
+        using AircraftAirfields = struct AircraftAirfields
+        {
+            // Where the aircraft is departing from
+            std::string origin;
+
+            // Where the aircraft is going
+            std::string destination;
+        };
+
         void AssignStandToAircraft(const std::string& callsign, const Stand& stand);
         [[nodiscard]] auto
         AssignStandInApi(const std::string& callsign, const std::string& airfield, const std::string& identifier)
@@ -102,7 +144,14 @@ namespace UKControllerPlugin::Stands {
         void RequestDepartureStandFromApi(const Euroscope::EuroScopeCFlightPlanInterface& flightplan);
         void RequestArrivalStandFromApi(const Euroscope::EuroScopeCFlightPlanInterface& flightplan);
         void DoApiStandRequest(const std::string& callsign, const nlohmann::json data);
+        void ProcessStandRequestResponse(const std::string& callsign, const nlohmann::json& data);
         void UnassignStandForAircraft(const std::string& callsign);
+        [[nodiscard]] auto GetStandAtAircraftPosition(
+            const AircraftAirfields& airfields,
+            const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface& radarTarget) const -> const Stand*;
+        void UpdateStandOccupancy(const std::string& callsign, int standId);
+        void CheckStandConflict(const std::string& callsign);
+        void CheckStandConflictsForStand(int standId);
         [[nodiscard]] auto AssignmentMessageValid(const nlohmann::json& message) const -> bool;
         auto CanAssignStand(UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan) const -> bool;
         static auto UnassignmentMessageValid(const nlohmann::json& message) -> bool;
@@ -110,6 +159,7 @@ namespace UKControllerPlugin::Stands {
         GetAirfieldForStandAssignment(UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan) const
             -> std::string;
         auto LockStandMap() -> std::lock_guard<std::recursive_mutex>;
+        [[nodiscard]] auto LoadStandAssignments() const -> nlohmann::json;
 
         // The last airfield that was used to populate the stand menu, used when we receive the callback
         std::string lastAirfieldUsed;
@@ -126,11 +176,24 @@ namespace UKControllerPlugin::Stands {
         // All the stands we have
         std::set<UKControllerPlugin::Stands::Stand, UKControllerPlugin::Stands::CompareStands> stands;
 
+        // The stands indexed by airfield and position, along with which aircraft are on them
+        StandIndex standIndex;
+
+        // Aircraft whose assigned stand has another aircraft on it, and the aircraft on it
+        std::map<std::string, std::string> standConflicts;
+
         // The currently assigned stands and who they are assigned to
         std::map<std::string, int> standAssignments;
 
+        // Assignments restored after a restart that the API hasn't confirmed yet
+        std::map<std::string, int> restoredAssignments;
+
+        // The origin and destination of each aircraft, from its last flightplan event. Only used on the EuroScope
+        // thread, so isn't covered by the map lock.
+        std::map<std::string, AircraftAirfields> aircraftAirfields;
+
         // Locks the stand assignments map to prevent concurrent edits
-        std::recursive_mutex mapMutex;
+        mutable std::recursive_mutex mapMutex;
 
         // Allows us to send events to our integrations
         Integration::OutboundIntegrationEventHandler& integrationEventHandler;
@@ -138,6 +201,12 @@ namespace UKControllerPlugin::Stands {
         // The ownership of airfields
         std::shared_ptr<Ownership::AirfieldServiceProviderCollection> ownership;
 
+        // Batches up automatic stand requests, if set
+        std::shared_ptr<Api::ApiRequestCoalescer> requestCoalescer;
+
+        // Shares stand assignments with other EuroScope instances, if set
+        std::shared_ptr<Push::SharedSyncData> sharedSync;
+
         // The id for the callback when a stand is selected
         const int standSelectedCallbackId;
 
@@ -158,5 +227,11 @@ namespace UKControllerPlugin::Stands {
 
         // Max distance from origin to do departure stands
         const double maxDistanceForDepartureStands = 3.5;
+
+        // Aircraft moving faster than this, in knots, are not considered to be sat on a stand
+        const int maxStandOccupancyGroundSpeed = 5;
+
+        // The colour of the tag item if another aircraft is on the assigned stand
+        const COLORREF standConflictColour = RGB(255, 153, 0);
     };
 } // namespace UKControllerPlugin::Stands
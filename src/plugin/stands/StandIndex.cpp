@@ -0,0 +1,252 @@
+#include "StandIndex.h"
+#include "geometry/Angle.h"
+
+namespace UKControllerPlugin::Stands {
+
+    /*
+        Calls the function with each positioned stand within range of the point, and its distance.
+    */
+    template <typename Function>
+    void StandIndex::ForEachStandWithin(
+        const AirfieldStands& airfield, const GridPoint& point, double metres, Function&& function) const
+    {
+        const auto visit = [&airfield, &point, metres, &function](const std::vector<size_t>& cell) {
+            for (const auto index : cell) {
+                const auto distance =
+                    std::hypot(airfield.points[index].x - point.x, airfield.points[index].y - point.y);
+                if (distance <= metres) {
+                    function(airfield.stands[index], distance);
+                }
+            }
+        };
+
+        // If the search area covers more cells than are populated, it's quicker to just check the populated ones
+        const auto minX = CellCoordinate(point.x - metres);
+        const auto maxX = CellCoordinate(point.x + metres);
+        const auto minY = CellCoordinate(point.y - metres);
+        const auto maxY = CellCoordinate(point.y + metres);
+        if (static_cast<size_t>((maxX - minX + 1) * (maxY - minY + 1)) > airfield.cells.size()) {
+            for (const auto& [key, cell] : airfield.cells) {
+                visit(cell);
+            }
+            return;
+        }
+
+        for (auto cellX = minX; cellX <= maxX; cellX++) {
+            for (auto cellY = minY; cellY <= maxY; cellY++) {
+                const auto cell = airfield.cells.find(CellKey(cellX, cellY));
+                if (cell != airfield.cells.cend()) {
+                    visit(cell->second);
+                }
+            }
+        }
+    }
+
+    StandIndex::StandIndex(const std::set<Stand, CompareStands>& stands)
+    {
+        for (const auto& stand : stands) {
+            auto& airfield = this->airfields[stand.airfieldCode];
+            airfield.identifiers[stand.identifier] = airfield.stands.size();
+            airfield.stands.push_back(stand);
+        }
+
+        for (auto& [code, airfield] : this->airfields) {
+            const auto origin = std::find_if(airfield.stands.cbegin(), airfield.stands.cend(), [](const Stand& stand) {
+                return stand.hasPosition;
+            });
+
+            if (origin == airfield.stands.cend()) {
+                continue;
+            }
+
+            airfield.originLatitude = origin->latitude;
+            airfield.originLongitude = origin->longitude;
+            airfield.metresPerDegreeLongitude =
+                metresPerDegree * std::cos(Geometry::DegreesToRadians(airfield.originLatitude));
+
+            airfield.points.reserve(airfield.stands.size());
+            for (size_t i = 0; i < airfield.stands.size(); i++) {
+                const auto& stand = airfield.stands[i];
+                airfield.points.push_back(Project(airfield, stand.latitude, stand.longitude));
+                if (!stand.hasPosition) {
+                    continue;
+                }
+
+                airfield.cells[CellKey(CellCoordinate(airfield.points[i].x), CellCoordinate(airfield.points[i].y))]
+                    .push_back(i);
+            }
+        }
+    }
+
+    /*
+        Returns the stands at the airfield, ordered by id.
+    */
+    auto StandIndex::StandsAtAirfield(const std::string& airfield) const -> const std::vector<Stand>&
+    {
+        const auto stands = this->airfields.find(airfield);
+        return stands == this->airfields.cend() ? this->noStands : stands->second.stands;
+    }
+
+    /*
+        Returns true if any stands at the airfield have a position, so an aircraft could be sat on one.
+    */
+    auto StandIndex::HasPositionedStands(const std::string& airfield) const -> bool
+    {
+        const auto stands = this->airfields.find(airfield);
+        return stands != this->airfields.cend() && !stands->second.cells.empty();
+    }
+
+    auto StandIndex::FindStand(const std::string& airfield, const std::string& identifier) const -> const Stand*
+    {
+        const auto stands = this->airfields.find(airfield);
+        if (stands == this->airfields.cend()) {
+            return nullptr;
+        }
+
+        const auto stand = stands->second.identifiers.find(identifier);
+        return stand == stands->second.identifiers.cend() ? nullptr : &stands->second.stands[stand->second];
+    }
+
+    /*
+        Returns the closest stand at the airfield to the given position, provided that it is
+        within the stand radius.
+    */
+    auto StandIndex::StandAtPosition(const std::string& airfield, double latitude, double longitude) const
+        -> const Stand*
+    {
+        const auto stands = this->airfields.find(airfield);
+        if (stands == this->airfields.cend() || stands->second.cells.empty()) {
+            return nullptr;
+        }
+
+        const Stand* closest = nullptr;
+        double closestDistance = standRadius;
+        ForEachStandWithin(
+            stands->second,
+            Project(stands->second, latitude, longitude),
+            standRadius,
+            [&closest, &closestDistance](const Stand& stand, double distance) {
+                if (distance <= closestDistance) {
+                    closest = &stand;
+                    closestDistance = distance;
+                }
+            });
+
+        return closest;
+    }
+
+    auto StandIndex::StandsWithin(const std::string& airfield, double latitude, double longitude, double metres) const
+        -> std::vector<int>
+    {
+        std::vector<int> standIds;
+        const auto stands = this->airfields.find(airfield);
+        if (stands == this->airfields.cend()) {
+            return standIds;
+        }
+
+        ForEachStandWithin(
+            stands->second,
+            Project(stands->second, latitude, longitude),
+            metres,
+            [&standIds](const Stand& stand, double) { standIds.push_back(stand.id); });
+
+        std::sort(standIds.begin(), standIds.end());
+        return standIds;
+    }
+
+    auto StandIndex::OccupiedStandsWithin(
+        const std::string& airfield, double latitude, double longitude, double metres) const -> std::vector<int>
+    {
+        std::vector<int> standIds;
+        const auto stands = this->airfields.find(airfield);
+        if (stands == this->airfields.cend() || this->occupants.empty()) {
+            return standIds;
+        }
+
+        ForEachStandWithin(
+            stands->second,
+            Project(stands->second, latitude, longitude),
+            metres,
+            [this, &standIds](const Stand& stand, double) {
+                if (this->occupants.contains(stand.id)) {
+                    standIds.push_back(stand.id);
+                }
+            });
+
+        std::sort(standIds.begin(), standIds.end());
+        return standIds;
+    }
+
+    /*
+        Record that the aircraft is on the given stand, returns true if this is a change. If another
+        aircraft was previously recorded as being on the stand, it is replaced.
+    */
+    auto StandIndex::SetOccupant(const std::string& callsign, int standId) -> bool
+    {
+        const auto existing = this->occupiedStands.find(callsign);
+        if (existing != this->occupiedStands.cend() && existing->second == standId) {
+            return false;
+        }
+
+        this->RemoveOccupant(callsign);
+        const auto previousOccupant = this->occupants.find(standId);
+        if (previousOccupant != this->occupants.cend()) {
+            this->occupiedStands.erase(previousOccupant->second);
+        }
+
+        this->occupants[standId] = callsign;
+        this->occupiedStands[callsign] = standId;
+        return true;
+    }
+
+    /*
+        Record that the aircraft is no longer on a stand, returns the stand it was on.
+    */
+    auto StandIndex::RemoveOccupant(const std::string& callsign) -> int
+    {
+        const auto existing = this->occupiedStands.find(callsign);
+        if (existing == this->occupiedStands.cend()) {
+            return noStand;
+        }
+
+        const auto standId = existing->second;
+        this->occupants.erase(standId);
+        this->occupiedStands.erase(existing);
+        return standId;
+    }
+
+    auto StandIndex::GetOccupant(int standId) const -> std::string
+    {
+        const auto occupant = this->occupants.find(standId);
+        return occupant == this->occupants.cend() ? "" : occupant->second;
+    }
+
+    auto StandIndex::GetOccupiedStand(const std::string& callsign) const -> int
+    {
+        const auto stand = this->occupiedStands.find(callsign);
+        return stand == this->occupiedStands.cend() ? noStand : stand->second;
+    }
+
+    auto StandIndex::CountOccupiedStands() const -> size_t
+    {
+        return this->occupants.size();
+    }
+
+    auto StandIndex::Project(const AirfieldStands& airfield, double latitude, double longitude) const -> GridPoint
+    {
+        return {
+            (longitude - airfield.originLongitude) * airfield.metresPerDegreeLongitude,
+            (latitude - airfield.originLatitude) * metresPerDegree};
+    }
+
+    auto StandIndex::CellKey(int64_t cellX, int64_t cellY) -> int64_t
+    {
+        return (cellX << 32) ^ (cellY & 0xFFFFFFFF); // NOLINT
+    }
+
+    auto StandIndex::CellCoordinate(double metres) -> int64_t
+    {
+        return static_cast<int64_t>(std::floor(metres / cellSize));
+    }
+
+} // namespace UKControllerPlugin::Stands
@@ -0,0 +1,104 @@
+#pragma once
+#include "CompareStands.h"
+#include "Stand.h"
+
+namespace UKControllerPlugin::Stands {
+
+    /*
+        Indexes stands by airfield so that menus, identifier lookups and position lookups do not have to
+        walk every stand we know about.
+
+        Stands with a known position are also placed into a per-airfield grid of fixed size cells,
+        projected onto a flat plane around the first positioned stand at the airfield. Positional queries
+        then only have to consider stands in the handful of cells that could be within range. Over the
+        size of an airfield, the error from the flat projection is negligible.
+
+        The index also tracks which aircraft is sat on which stand, so that stand conflicts can be found.
+    */
+    class StandIndex
+    {
+        public:
+        explicit StandIndex(const std::set<Stand, CompareStands>& stands);
+        [[nodiscard]] auto StandsAtAirfield(const std::string& airfield) const -> const std::vector<Stand>&;
+        [[nodiscard]] auto HasPositionedStands(const std::string& airfield) const -> bool;
+        [[nodiscard]] auto FindStand(const std::string& airfield, const std::string& identifier) const
+            -> const Stand*;
+        [[nodiscard]] auto StandAtPosition(const std::string& airfield, double latitude, double longitude) const
+            -> const Stand*;
+        [[nodiscard]] auto
+        StandsWithin(const std::string& airfield, double latitude, double longitude, double metres) const
+            -> std::vector<int>;
+        [[nodiscard]] auto
+        OccupiedStandsWithin(const std::string& airfield, double latitude, double longitude, double metres) const
+            -> std::vector<int>;
+        auto SetOccupant(const std::string& callsign, int standId) -> bool;
+        auto RemoveOccupant(const std::string& callsign) -> int;
+        [[nodiscard]] auto GetOccupant(int standId) const -> std::string;
+        [[nodiscard]] auto GetOccupiedStand(const std::string& callsign) const -> int;
+        [[nodiscard]] auto CountOccupiedStands() const -> size_t;
+
+        // How close, in metres, an aircraft has to be to a stand to be considered to be on it
+        inline static const double standRadius = 30.0;
+
+        // The size, in metres, of each cell in the grid
+        inline static const double cellSize = 50.0;
+
+        // The value returned when an aircraft is not on a stand
+        inline static const int noStand = -1;
+
+        private:
+        using GridPoint = struct GridPoint
+        {
+            // Metres east of the airfields grid origin
+            double x;
+
+            // Metres north of the airfields grid origin
+            double y;
+        };
+
+        using AirfieldStands = struct AirfieldStands
+        {
+            // The stands at the airfield, ordered by id
+            std::vector<Stand> stands;
+
+            // Positions of the stands at the airfield in the grid, in the same order as the stands
+            std::vector<GridPoint> points;
+
+            // Stand identifiers to indexes in the stands vector
+            std::unordered_map<std::string, size_t> identifiers;
+
+            // Grid cell keys to the indexes of positioned stands in that cell
+            std::unordered_map<int64_t, std::vector<size_t>> cells;
+
+            // The latitude and longitude that the grid is projected around
+            double originLatitude = 0.0;
+            double originLongitude = 0.0;
+
+            // Metres per degree of longitude at the origin latitude
+            double metresPerDegreeLongitude = 0.0;
+        };
+
+        [[nodiscard]] auto Project(const AirfieldStands& airfield, double latitude, double longitude) const
+            -> GridPoint;
+        [[nodiscard]] static auto CellKey(int64_t cellX, int64_t cellY) -> int64_t;
+        [[nodiscard]] static auto CellCoordinate(double metres) -> int64_t;
+        template <typename Function>
+        void ForEachStandWithin(
+            const AirfieldStands& airfield, const GridPoint& point, double metres, Function&& function) const;
+
+        // Metres per degree of latitude, and of longitude at the equator
+        inline static const double metresPerDegree = 111319.49;
+
+        // Stands by airfield
+        std::unordered_map<std::string, AirfieldStands> airfields;
+
+        // Returned when there are no stands at an airfield
+        const std::vector<Stand> noStands;
+
+        // Which aircraft is on each stand, by stand id
+        std::unordered_map<int, std::string> occupants;
+
+        // Which stand each aircraft is on, by callsign
+        std::unordered_map<std::string, int> occupiedStands;
+    };
+} // namespace UKControllerPlugin::Stands
@@ -2,9 +2,11 @@
 #include "StandEventHandler.h"
 #include "StandModule.h"
 #include "StandSerializer.h"
+#include "api/ApiRequestCoalescer.h"
 #include "bootstrap/PersistenceContainer.h"
 #include "dependency/DependencyLoaderInterface.h"
 #include "euroscope/CallbackFunction.h"
+#include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "integration/ExternalMessageEventHandler.h"
 #include "integration/InboundIntegrationMessageHandler.h"
@@ -12,9 +14,13 @@
 #include "plugin/FunctionCallEventHandler.h"
 #include "plugin/UKPlugin.h"
 #include "push/PushEventProcessorCollection.h"
+#include "push/SharedSyncData.h"
+#include "state/PluginStateSnapshot.h"
 #include "tag/TagFunction.h"
 #include "tag/TagItemCollection.h"
+#include "timedevent/TimedEventCollection.h"
 
+using UKControllerPlugin::Api::ApiRequestCoalescer;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Dependency::DependencyLoaderInterface;
 using UKControllerPlugin::Euroscope::CallbackFunction;
@@ -27,6 +33,9 @@ namespace UKControllerPlugin::Stands {
     const int openStandAssignmentPopupTagFunctionId = 9007;
     const int openStandAssignmentEditBoxTagFunctionId = 9008;
 
+    // How often, in seconds, to send batched automatic stand requests
+    const int standRequestBatchFrequency = 1;
+
     void BootstrapPlugin(PersistenceContainer& container, DependencyLoaderInterface& dependencies)
     {
         // Load stand data from the dependency
@@ -83,10 +92,27 @@ namespace UKControllerPlugin::Stands {
 
         // Assign to handlers
         container.flightplanHandler->RegisterHandler(eventHandler);
+        container.radarTargetHandler->RegisterHandler(eventHandler);
         container.tagHandler->RegisterTagItem(assignedStandTagItemId, eventHandler);
         container.pushEventProcessors->AddProcessor(eventHandler);
         container.externalEventHandler->AddHandler(eventHandler);
         container.integrationModuleContainer->inboundMessageHandler->AddProcessor(eventHandler);
+
+        // Batch up automatic stand requests
+        auto requestCoalescer = std::make_shared<ApiRequestCoalescer>(*container.taskRunner, *eventHandler);
+        eventHandler->SetRequestCoalescer(requestCoalescer);
+        container.timedHandler->RegisterEvent(requestCoalescer, standRequestBatchFrequency);
+
+        // Share stand assignments with other EuroScope instances
+        if (container.sharedPushSync) {
+            eventHandler->SetSharedSyncData(container.sharedPushSync);
+            container.sharedPushSync->Share(StandEventHandler::sharedSyncKey, eventHandler);
+        }
+
+        // Save stand assignments between restarts
+        if (container.pluginState) {
+            container.pluginState->RegisterState(StandEventHandler::stateKey, eventHandler);
+        }
     }
 
     auto GetDependencyKey() -> std::string
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace UKControllerPlugin::Stands {
+    /**
+     * Event fired when an aircraft is assigned a stand that another aircraft is sat on.
+     */
+    struct StandOccupancyConflictEvent
+    {
+        // The aircraft that has been assigned the stand
+        std::string callsign;
+
+        // The stand in question
+        int standId;
+
+        // The aircraft that is on the stand
+        std::string occupiedBy;
+    };
+} // namespace UKControllerPlugin::Stands
@@ -19,8 +19,15 @@ namespace UKControllerPlugin {
                 numberOfAirfields++;
                 for (auto standIt = airfieldIt->cbegin(); standIt != airfieldIt->cend(); ++standIt) {
                     numberOfStands++;
-                    stands.insert(
-                        {standIt->at("id").get<int>(), airfieldIt.key(), standIt->at("identifier").get<std::string>()});
+                    Stand stand{
+                        standIt->at("id").get<int>(), airfieldIt.key(), standIt->at("identifier").get<std::string>()};
+                    if (standIt->contains("latitude") && standIt->at("latitude").is_number() &&
+                        standIt->contains("longitude") && standIt->at("longitude").is_number()) {
+                        stand.latitude = standIt->at("latitude").get<double>();
+                        stand.longitude = standIt->at("longitude").get<double>();
+                        stand.hasPosition = true;
+                    }
+                    stands.insert(stand);
                 }
             }
 
@@ -71,7 +78,16 @@ namespace UKControllerPlugin {
         bool StandDataValid(const nlohmann::json& data)
         {
             return data.is_object() && data.contains("id") && data.at("id").is_number_integer() &&
-                   data.contains("identifier") && data.at("identifier").is_string();
+                   data.contains("identifier") && data.at("identifier").is_string() &&
+                   StandCoordinateValid(data, "latitude") && StandCoordinateValid(data, "longitude");
+        }
+
+        /*
+            Stand coordinates are optional, but must be numeric if present
+        */
+        bool StandCoordinateValid(const nlohmann::json& data, const std::string& key)
+        {
+            return !data.contains(key) || data.at(key).is_null() || data.at(key).is_number();
         }
     } // namespace Stands
 } // namespace UKControllerPlugin
@@ -27,5 +27,10 @@ namespace UKControllerPlugin {
         */
         bool StandDataValid(const nlohmann::json& data);
 
+        /*
+            Returns true if a stand coordinate is either missing or valid
+        */
+        bool StandCoordinateValid(const nlohmann::json& data, const std::string& key);
+
     } // namespace Stands
 } // namespace UKControllerPlugin
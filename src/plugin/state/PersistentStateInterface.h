@@ -0,0 +1,23 @@
+#pragma once
+
+namespace UKControllerPlugin::State {
+
+    /*
+        Something whose in-memory state is saved between plugin restarts.
+
+        The state is a JSON object. Each member is journaled separately whenever it changes, so members
+        should be small and keyed by something like a callsign. A member that's removed from the state is
+        recorded as a null, so members can't themselves be null. Members are keyed by callsign.
+
+        Restored members that aren't confirmed soon after restoring, e.g. because the aircraft hasn't been seen
+        since, are expired.
+    */
+    class PersistentStateInterface
+    {
+        public:
+        virtual ~PersistentStateInterface() = default;
+        [[nodiscard]] virtual auto SaveState() const -> nlohmann::json = 0;
+        virtual void RestoreState(const nlohmann::json& state) = 0;
+        virtual void ExpireRestoredState(const std::string& callsign) = 0;
+    };
+} // namespace UKControllerPlugin::State
@@ -0,0 +1,205 @@
+#include "PersistentStateInterface.h"
+#include "PluginStateSnapshot.h"
+#include "StateJournal.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "task/RunAsyncTask.h"
+#include "time/SystemClock.h"
+
+namespace UKControllerPlugin::State {
+
+    PluginStateSnapshot::PluginStateSnapshot(std::unique_ptr<StateJournal> journal)
+        : PluginStateSnapshot(std::move(journal), Async)
+    {
+    }
+
+    PluginStateSnapshot::PluginStateSnapshot(
+        std::unique_ptr<StateJournal> journal, std::function<void(const std::function<void(void)>&)> runInBackground)
+        : runInBackground(std::move(runInBackground)), save(std::make_shared<SaveState>())
+    {
+        this->save->journal = std::move(journal);
+    }
+
+    PluginStateSnapshot::~PluginStateSnapshot() = default;
+
+    void PluginStateSnapshot::RegisterState(const std::string& key, std::shared_ptr<PersistentStateInterface> state)
+    {
+        if (this->states.contains(key)) {
+            LogWarning("Duplicate persistent state key " + key);
+            return;
+        }
+
+        this->states[key] = std::move(state);
+    }
+
+    auto PluginStateSnapshot::CountStates() const -> size_t
+    {
+        return this->states.size();
+    }
+
+    /*
+        Restore the saved state if it's recent enough, then take a fresh snapshot to journal from. This happens
+        once, before EuroScope starts sending us events, so it's done there and then.
+    */
+    auto PluginStateSnapshot::Restore() -> bool
+    {
+        std::lock_guard lock(this->save->mutex);
+        bool restored = false;
+        const auto saved = this->save->journal->Load();
+        if (saved && Time::TimeNow() - saved->savedAt <= maxStateAge) {
+            for (const auto& [key, state] : this->states) {
+                if (saved->state.contains(key) && saved->state.at(key).is_object()) {
+                    state->RestoreState(saved->state.at(key));
+                    for (const auto& [callsign, value] : saved->state.at(key).items()) {
+                        this->unconfirmed[key].insert(callsign);
+                    }
+                }
+            }
+
+            LogInfo("Restored saved plugin state");
+            this->restoredAt = Time::TimeNow();
+            restored = true;
+        } else if (saved) {
+            LogInfo("Saved plugin state is too old to restore");
+        }
+
+        Compact(*this->save, this->CurrentState());
+        return restored;
+    }
+
+    /*
+        If the last save is still going, this one is skipped. Nothing is lost, as changes are always worked out
+        against what was last saved.
+    */
+    void PluginStateSnapshot::TimedEventTrigger()
+    {
+        this->ExpireUnconfirmedState();
+        if (this->save->saving.exchange(true)) {
+            return;
+        }
+
+        this->runInBackground([save = this->save, current = this->CurrentState()]() {
+            Save(*save, current);
+            save->saving = false;
+        });
+    }
+
+    /*
+        We've seen the aircraft, so anything restored for it is still current.
+    */
+    void PluginStateSnapshot::FlightPlanEvent(
+        Euroscope::EuroScopeCFlightPlanInterface& flightPlan, Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        for (auto& [key, callsigns] : this->unconfirmed) {
+            callsigns.erase(flightPlan.GetCallsign());
+        }
+    }
+
+    void PluginStateSnapshot::FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan)
+    {
+        // Nothing to do here
+    }
+
+    void PluginStateSnapshot::ControllerFlightPlanDataEvent(
+        Euroscope::EuroScopeCFlightPlanInterface& flightPlan, int dataType)
+    {
+        // Nothing to do here
+    }
+
+    void PluginStateSnapshot::ExpireUnconfirmedState()
+    {
+        if (this->unconfirmed.empty() || Time::TimeNow() - this->restoredAt < confirmRestoredStateWithin) {
+            return;
+        }
+
+        size_t expired = 0;
+        for (const auto& [key, callsigns] : this->unconfirmed) {
+            for (const auto& callsign : callsigns) {
+                this->states.at(key)->ExpireRestoredState(callsign);
+                expired++;
+            }
+        }
+
+        LogInfo("Expired " + std::to_string(expired) + " unconfirmed items of restored plugin state");
+        this->unconfirmed.clear();
+    }
+
+    /*
+        Runs in the background. Takes a snapshot if we need one, otherwise journals what's changed.
+    */
+    void PluginStateSnapshot::Save(SaveState& save, nlohmann::json current)
+    {
+        std::lock_guard lock(save.mutex);
+        if ((!save.snapshotTaken || save.journal->JournalEntries() >= compactAfterEntries) &&
+            Compact(save, current)) {
+            return;
+        }
+
+        if (!save.snapshotTaken) {
+            return;
+        }
+
+        const auto changes = Changes(save.savedState, current);
+        if (changes.empty() && Time::TimeNow() - save.lastSaved < unchangedSaveInterval) {
+            return;
+        }
+
+        save.journal->Append(changes);
+        save.savedState = std::move(current);
+        save.lastSaved = Time::TimeNow();
+    }
+
+    auto PluginStateSnapshot::CurrentState() const -> nlohmann::json
+    {
+        auto state = nlohmann::json::object();
+        for (const auto& [key, persistentState] : this->states) {
+            state[key] = persistentState->SaveState();
+        }
+
+        return state;
+    }
+
+    /*
+        Work out which members of each state have been added, changed or removed.
+    */
+    auto PluginStateSnapshot::Changes(const nlohmann::json& previous, const nlohmann::json& current) -> nlohmann::json
+    {
+        static const auto noState = nlohmann::json::object();
+        auto changes = nlohmann::json::object();
+        for (const auto& [key, state] : current.items()) {
+            const auto& previousState = previous.contains(key) ? previous.at(key) : noState;
+            auto stateChanges = nlohmann::json::object();
+            for (const auto& [member, value] : state.items()) {
+                if (!previousState.contains(member) || previousState.at(member) != value) {
+                    stateChanges[member] = value;
+                }
+            }
+
+            for (const auto& [member, value] : previousState.items()) {
+                if (!state.contains(member)) {
+                    stateChanges[member] = nullptr;
+                }
+            }
+
+            if (!stateChanges.empty()) {
+                changes[key] = std::move(stateChanges);
+            }
+        }
+
+        return changes;
+    }
+
+    /*
+        If the snapshot can't be written, we carry on journaling changes from the state we last saved.
+    */
+    auto PluginStateSnapshot::Compact(SaveState& save, const nlohmann::json& state) -> bool
+    {
+        if (!save.journal->Compact(state)) {
+            return false;
+        }
+
+        save.savedState = state;
+        save.lastSaved = Time::TimeNow();
+        save.snapshotTaken = true;
+        return true;
+    }
+} // namespace UKControllerPlugin::State
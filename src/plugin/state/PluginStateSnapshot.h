@@ -0,0 +1,101 @@
+#pragma once
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPlugin::State {
+    class PersistentStateInterface;
+    class StateJournal;
+
+    /*
+        Keeps a snapshot of the plugin's in-memory state on disk, so that if EuroScope is restarted part way
+        through a session we can pick up where we left off, rather than rebuilding everything and repeating
+        automatic assignments.
+
+        On each trigger, the state is collected and handed to a background task, which journals only the members
+        that have changed since the last save. Every so often the journal is compacted into a fresh snapshot. If
+        nothing has changed for a while, an empty entry is journaled so that we know the state on disk is still
+        current.
+
+        Anything restored for an aircraft that we don't receive a flightplan event for soon after restoring is
+        expired, so that aircraft that left whilst the plugin wasn't running don't linger.
+    */
+    class PluginStateSnapshot : public TimedEvent::AbstractTimedEvent,
+                                public Flightplan::FlightPlanEventHandlerInterface
+    {
+        public:
+        explicit PluginStateSnapshot(std::unique_ptr<StateJournal> journal);
+        PluginStateSnapshot(
+            std::unique_ptr<StateJournal> journal,
+            std::function<void(const std::function<void(void)>&)> runInBackground);
+        ~PluginStateSnapshot() override;
+        PluginStateSnapshot(const PluginStateSnapshot&) = delete;
+        PluginStateSnapshot(PluginStateSnapshot&&) noexcept = delete;
+        auto operator=(const PluginStateSnapshot&) -> PluginStateSnapshot& = delete;
+        auto operator=(PluginStateSnapshot&&) noexcept -> PluginStateSnapshot& = delete;
+        void RegisterState(const std::string& key, std::shared_ptr<PersistentStateInterface> state);
+        [[nodiscard]] auto CountStates() const -> size_t;
+        auto Restore() -> bool;
+        void TimedEventTrigger() override;
+        void FlightPlanEvent(
+            Euroscope::EuroScopeCFlightPlanInterface& flightPlan,
+            Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
+        void FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan) override;
+        void ControllerFlightPlanDataEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan, int dataType) override;
+
+        // How old saved state can be before we don't trust it
+        static inline const std::chrono::minutes maxStateAge = std::chrono::minutes(10);
+
+        // How many journal entries to allow before compacting them into a new snapshot
+        static inline const int compactAfterEntries = 120;
+
+        // How long to go without saving before we journal that nothing has changed
+        static inline const std::chrono::seconds unchangedSaveInterval = std::chrono::seconds(60);
+
+        // How long restored state has to be confirmed before it's expired
+        static inline const std::chrono::minutes confirmRestoredStateWithin = std::chrono::minutes(2);
+
+        private:
+        using SaveState = struct SaveState
+        {
+            // Held whilst saving, so that saves never overlap
+            std::mutex mutex;
+
+            // Saves the state
+            std::unique_ptr<StateJournal> journal;
+
+            // The state as it was last saved
+            nlohmann::json savedState;
+
+            // When we last saved
+            std::chrono::system_clock::time_point lastSaved;
+
+            // Whether a snapshot has been taken yet, there's no point journaling until it has
+            bool snapshotTaken = false;
+
+            // Whether a save is waiting to run or running
+            std::atomic<bool> saving = false;
+        };
+
+        [[nodiscard]] auto CurrentState() const -> nlohmann::json;
+        [[nodiscard]] static auto Changes(const nlohmann::json& previous, const nlohmann::json& current)
+            -> nlohmann::json;
+        static void Save(SaveState& save, nlohmann::json current);
+        static auto Compact(SaveState& save, const nlohmann::json& state) -> bool;
+        void ExpireUnconfirmedState();
+
+        // Everything that has state, by key
+        std::map<std::string, std::shared_ptr<PersistentStateInterface>> states;
+
+        // Runs saves, so that the disk isn't touched on the EuroScope thread
+        const std::function<void(const std::function<void(void)>&)> runInBackground;
+
+        // State shared with the background save, which may outlive us
+        std::shared_ptr<SaveState> save;
+
+        // Callsigns with restored state, by the key of the state they're in, until they're confirmed
+        std::map<std::string, std::set<std::string>> unconfirmed;
+
+        // When the state was restored
+        std::chrono::system_clock::time_point restoredAt;
+    };
+} // namespace UKControllerPlugin::State
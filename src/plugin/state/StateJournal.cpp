@@ -0,0 +1,167 @@
+#include "StateJournal.h"
+#include "time/SystemClock.h"
+#include "windows/WinApiInterface.h"
+
+namespace UKControllerPlugin::State {
+
+    StateJournal::StateJournal(Windows::WinApiInterface& windows, std::wstring snapshotFile, std::wstring journalFile)
+        : windows(windows), snapshotFile(std::move(snapshotFile)), temporarySnapshotFile(this->snapshotFile + L".tmp"),
+          journalFile(std::move(journalFile))
+    {
+    }
+
+    /*
+        Load the snapshot and replay the journal over the top of it.
+    */
+    auto StateJournal::Load() -> std::optional<SavedState>
+    {
+        const auto snapshot = this->LoadSnapshot();
+        if (!snapshot) {
+            return std::nullopt;
+        }
+
+        SavedState saved{snapshot->at("state"), TimeFromJson(snapshot->at("saved_at"))};
+        this->sequence = snapshot->at("sequence").get<int64_t>();
+        this->ReplayJournal(saved);
+
+        return saved;
+    }
+
+    auto StateJournal::LoadSnapshot() const -> std::optional<nlohmann::json>
+    {
+        if (!this->windows.FileExists(this->snapshotFile)) {
+            LogInfo("No saved plugin state found");
+            return std::nullopt;
+        }
+
+        const auto snapshot = nlohmann::json::parse(this->windows.ReadFromFile(this->snapshotFile), nullptr, false);
+        if (snapshot.is_discarded() || !snapshot.is_object() || !snapshot.contains("version") ||
+            !snapshot.at("version").is_number_integer() || !snapshot.contains("sequence") ||
+            !snapshot.at("sequence").is_number_integer() || !snapshot.contains("saved_at") ||
+            !snapshot.at("saved_at").is_number_integer() || !snapshot.contains("state") ||
+            !snapshot.at("state").is_object()) {
+            LogWarning("Saved plugin state is invalid");
+            return std::nullopt;
+        }
+
+        if (snapshot.at("version").get<int>() != version) {
+            LogInfo("Saved plugin state is from a different version, ignoring");
+            return std::nullopt;
+        }
+
+        return snapshot;
+    }
+
+    /*
+        Entries already in the snapshot are skipped. We stop at the first entry that's been partly written, or
+        that's out of sequence, as nothing after it can be trusted.
+    */
+    void StateJournal::ReplayJournal(SavedState& saved)
+    {
+        if (!this->windows.FileExists(this->journalFile)) {
+            return;
+        }
+
+        std::istringstream journal(this->windows.ReadFromFile(this->journalFile));
+        std::string line;
+        while (std::getline(journal, line)) {
+            if (line.empty()) {
+                continue;
+            }
+
+            const auto entry = nlohmann::json::parse(line, nullptr, false);
+            if (entry.is_discarded() || !entry.is_object() || !entry.contains("sequence") ||
+                !entry.at("sequence").is_number_integer() || !entry.contains("saved_at") ||
+                !entry.at("saved_at").is_number_integer() || !entry.contains("changes") ||
+                !entry.at("changes").is_object()) {
+                LogWarning("Invalid plugin state journal entry, ignoring the rest of the journal");
+                return;
+            }
+
+            const auto entrySequence = entry.at("sequence").get<int64_t>();
+            if (entrySequence <= this->sequence) {
+                continue;
+            }
+
+            if (entrySequence != this->sequence + 1) {
+                LogWarning("Plugin state journal is out of sequence, ignoring the rest of the journal");
+                return;
+            }
+
+            ApplyChanges(saved.state, entry.at("changes"));
+            saved.savedAt = TimeFromJson(entry.at("saved_at"));
+            this->sequence = entrySequence;
+            this->journalEntries++;
+        }
+    }
+
+    /*
+        Changes are keyed by the owner of the state, then by member. A null member has been removed.
+    */
+    void StateJournal::ApplyChanges(nlohmann::json& state, const nlohmann::json& changes)
+    {
+        for (const auto& [owner, ownerChanges] : changes.items()) {
+            if (!ownerChanges.is_object()) {
+                continue;
+            }
+
+            auto& ownerState = state[owner];
+            if (!ownerState.is_object()) {
+                ownerState = nlohmann::json::object();
+            }
+
+            for (const auto& [key, value] : ownerChanges.items()) {
+                if (value.is_null()) {
+                    ownerState.erase(key);
+                } else {
+                    ownerState[key] = value;
+                }
+            }
+        }
+    }
+
+    void StateJournal::Append(const nlohmann::json& changes)
+    {
+        nlohmann::json entry{
+            {"sequence", this->sequence + 1}, {"saved_at", TimeToJson(Time::TimeNow())}, {"changes", changes}};
+        this->windows.WriteToFile(this->journalFile, entry.dump() + "\n", false, true);
+        this->sequence++;
+        this->journalEntries++;
+    }
+
+    /*
+        The journal is only emptied once the new snapshot is in place.
+    */
+    auto StateJournal::Compact(const nlohmann::json& state) -> bool
+    {
+        nlohmann::json snapshot{
+            {"version", version},
+            {"sequence", this->sequence},
+            {"saved_at", TimeToJson(Time::TimeNow())},
+            {"state", state}};
+        this->windows.WriteToFile(this->temporarySnapshotFile, snapshot.dump(), true, true);
+        if (!this->windows.MoveFileToNewLocation(this->temporarySnapshotFile, this->snapshotFile)) {
+            LogWarning("Unable to save plugin state snapshot");
+            return false;
+        }
+
+        this->windows.WriteToFile(this->journalFile, "", true, true);
+        this->journalEntries = 0;
+        return true;
+    }
+
+    auto StateJournal::JournalEntries() const -> int
+    {
+        return this->journalEntries;
+    }
+
+    auto StateJournal::TimeFromJson(const nlohmann::json& json) -> std::chrono::system_clock::time_point
+    {
+        return std::chrono::system_clock::time_point(std::chrono::seconds(json.get<int64_t>()));
+    }
+
+    auto StateJournal::TimeToJson(std::chrono::system_clock::time_point time) -> int64_t
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+    }
+} // namespace UKControllerPlugin::State
@@ -0,0 +1,69 @@
+#pragma once
+
+namespace UKControllerPlugin::Windows {
+    class WinApiInterface;
+} // namespace UKControllerPlugin::Windows
+
+namespace UKControllerPlugin::State {
+
+    /*
+        State as it was last saved.
+    */
+    using SavedState = struct SavedState
+    {
+        // The state, keyed by who it belongs to
+        nlohmann::json state;
+
+        // When the state was last known to be current
+        std::chrono::system_clock::time_point savedAt;
+    };
+
+    /*
+        Saves plugin state to disk as a snapshot plus an append-only journal of the changes made since.
+
+        Every journal entry carries a sequence number, and the snapshot records the last one it includes. When
+        the journal is compacted into a new snapshot, the snapshot is written in full and moved into place before
+        the journal is emptied, so if the plugin dies part way through, the entries that are already in the
+        snapshot are skipped on loading. A partly written entry at the end of the journal is ignored.
+    */
+    class StateJournal
+    {
+        public:
+        explicit StateJournal(
+            Windows::WinApiInterface& windows,
+            std::wstring snapshotFile = L"state/plugin-state.json",
+            std::wstring journalFile = L"state/plugin-state-journal.jsonl");
+        [[nodiscard]] auto Load() -> std::optional<SavedState>;
+        void Append(const nlohmann::json& changes);
+        auto Compact(const nlohmann::json& state) -> bool;
+        [[nodiscard]] auto JournalEntries() const -> int;
+        static void ApplyChanges(nlohmann::json& state, const nlohmann::json& changes);
+
+        // The version of the snapshot format, anything else is ignored
+        static inline const int version = 1;
+
+        private:
+        [[nodiscard]] auto LoadSnapshot() const -> std::optional<nlohmann::json>;
+        void ReplayJournal(SavedState& saved);
+        [[nodiscard]] static auto TimeFromJson(const nlohmann::json& json) -> std::chrono::system_clock::time_point;
+        [[nodiscard]] static auto TimeToJson(std::chrono::system_clock::time_point time) -> int64_t;
+
+        // For reading and writing files
+        Windows::WinApiInterface& windows;
+
+        // Where the snapshot is kept
+        const std::wstring snapshotFile;
+
+        // Where the snapshot is written before it's moved into place
+        const std::wstring temporarySnapshotFile;
+
+        // Where the journal is kept
+        const std::wstring journalFile;
+
+        // The sequence number of the last journal entry written or loaded
+        int64_t sequence = 0;
+
+        // How many entries are in the journal
+        int journalEntries = 0;
+    };
+} // namespace UKControllerPlugin::State
@@ -0,0 +1,39 @@
+#include "PluginStateSnapshot.h"
+#include "StateJournal.h"
+#include "StateModule.h"
+#include "bootstrap/PersistenceContainer.h"
+#include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "timedevent/TimedEventCollection.h"
+
+namespace UKControllerPlugin::State {
+
+    // How often to save state, in seconds
+    const int saveFrequency = 5;
+
+    /*
+        Only the primary instance saves state, otherwise the instances would overwrite each other's.
+    */
+    void BootstrapPlugin(Bootstrap::PersistenceContainer& container, bool duplicatePlugin)
+    {
+        if (duplicatePlugin) {
+            return;
+        }
+
+        container.pluginState =
+            std::make_shared<PluginStateSnapshot>(std::make_unique<StateJournal>(*container.windows));
+        container.timedHandler->RegisterEvent(container.pluginState, saveFrequency);
+        container.flightplanHandler->RegisterHandler(container.pluginState);
+    }
+
+    /*
+        Called once everything that has state has been bootstrapped, but before EuroScope starts sending us events.
+    */
+    void RestoreState(const Bootstrap::PersistenceContainer& container)
+    {
+        if (!container.pluginState) {
+            return;
+        }
+
+        container.pluginState->Restore();
+    }
+} // namespace UKControllerPlugin::State
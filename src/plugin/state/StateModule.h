@@ -0,0 +1,10 @@
+#pragma once
+
+namespace UKControllerPlugin::Bootstrap {
+    struct PersistenceContainer;
+} // namespace UKControllerPlugin::Bootstrap
+
+namespace UKControllerPlugin::State {
+    void BootstrapPlugin(Bootstrap::PersistenceContainer& container, bool duplicatePlugin);
+    void RestoreState(const Bootstrap::PersistenceContainer& container);
+} // namespace UKControllerPlugin::State
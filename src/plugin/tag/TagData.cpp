@@ -25,15 +25,25 @@ namespace UKControllerPlugin::Tag {
         return {this->itemString};
     }
 
-    void TagData::SetItemString(std::string itemString)
+    auto TagData::GetItemStringView() const -> std::string_view
+    {
+        return {this->itemString};
+    }
+
+    /*
+        Writes straight into EuroScope's fixed buffer, so callers with a literal or a view don't need to build a
+        string first.
+    */
+    void TagData::SetItemString(std::string_view itemString)
     {
         // We only allow data of length maxlength - 1 because of null char on the end.
         if (itemString.size() > maxItemSize - 1) {
-            itemString = this->invalidItemText;
+            itemString = invalidItemText;
         }
 
         // Copy into place
-        strcpy_s(this->itemString, maxItemSize, itemString.c_str());
+        std::copy(itemString.cbegin(), itemString.cend(), this->itemString);
+        this->itemString[itemString.size()] = '\0';
     }
 
     void TagData::SetEuroscopeColourCode(int code)
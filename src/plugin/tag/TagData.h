@@ -24,7 +24,8 @@ namespace UKControllerPlugin::Tag {
             double* fontSize);
 
         [[nodiscard]] auto GetItemString() const -> std::string;
-        void SetItemString(std::string itemString);
+        [[nodiscard]] auto GetItemStringView() const -> std::string_view;
+        void SetItemString(std::string_view itemString);
         void SetEuroscopeColourCode(int code);
         [[nodiscard]] auto GetEuroscopeColourCode() const -> int;
         void SetTagColour(COLORREF colour);
@@ -36,6 +37,9 @@ namespace UKControllerPlugin::Tag {
         [[nodiscard]] auto GetFlightplan() const -> const Euroscope::EuroScopeCFlightPlanInterface&;
         [[nodiscard]] auto GetRadarTarget() const -> const Euroscope::EuroScopeCRadarTargetInterface&;
 
+        // Max length we can have on TAG items, 15 characters + 1 null terminator
+        static const size_t maxItemSize = 16;
+
         private:
         // The string to put into the tag
         char* itemString;
@@ -50,10 +54,7 @@ namespace UKControllerPlugin::Tag {
         double* fontSize;
 
         // The tag item text is too long
-        const std::string invalidItemText = "INVALID";
-
-        // Max length we can have on TAG items, 15 characters + 1 null terminator
-        static const size_t maxItemSize = 16;
+        inline static const std::string_view invalidItemText = "INVALID";
 
         // The flightplan
         const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightPlan;
@@ -1,12 +1,19 @@
 #include "TagData.h"
 #include "TagItemCollection.h"
 #include "TagItemInterface.h"
+#include "TagItemMemo.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
 
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 
 namespace UKControllerPlugin::Tag {
 
+    TagItemCollection::TagItemCollection() : memo(std::make_shared<TagItemMemo>())
+    {
+    }
+
+    TagItemCollection::~TagItemCollection() = default;
+
     /*
         Returns the number of registered handlers.
     */
@@ -22,6 +29,15 @@ namespace UKControllerPlugin::Tag {
     {
         return this->tagItems.count(id) > 0;
     }
+
+    /*
+        Returns the memo, so it can be told when dependencies change.
+    */
+    auto TagItemCollection::Memo() const -> std::shared_ptr<TagItemMemo>
+    {
+        return this->memo;
+    }
+
     /*
         Registers a new TagItem with the collection. Registers it with Euroscope and increments
         the next tag item ID.
@@ -36,6 +52,19 @@ namespace UKControllerPlugin::Tag {
         this->tagItems[itemId] = std::move(tagItem);
     }
 
+    /*
+        Registers a new TagItem whose output only changes when the given dependencies do, so it can be
+        memoised between calls.
+    */
+    void TagItemCollection::RegisterTagItem(
+        int itemId,
+        std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem,
+        TagItemDependencies dependencies)
+    {
+        this->RegisterTagItem(itemId, std::move(tagItem));
+        this->memo->Memoise(itemId, std::move(dependencies));
+    }
+
     /*
         Called when we want to get data for a given tag item. For example, if we're looking
         for an intention code, the intention code tag item will be called to return data.
@@ -51,8 +80,14 @@ namespace UKControllerPlugin::Tag {
             return;
         }
 
+        // Reuse the last output if nothing it depends on has changed
+        if (this->memo->Restore(tagData)) {
+            return;
+        }
+
         // Set the data for the tag item
         this->tagItems.at(itemCode)->SetTagItemData(tagData);
+        this->memo->Store(tagData);
     }
 
     /*
@@ -7,6 +7,8 @@ namespace UKControllerPlugin {
     namespace Tag {
         class TagData;
         class TagItemInterface;
+        class TagItemMemo;
+        struct TagItemDependencies;
     } // namespace Tag
 } // namespace UKControllerPlugin
 
@@ -19,9 +21,20 @@ namespace UKControllerPlugin::Tag {
     class TagItemCollection
     {
         public:
+        TagItemCollection();
+        ~TagItemCollection();
+        TagItemCollection(const TagItemCollection&) = delete;
+        TagItemCollection(TagItemCollection&&) noexcept = delete;
+        auto operator=(const TagItemCollection&) -> TagItemCollection& = delete;
+        auto operator=(TagItemCollection&&) noexcept -> TagItemCollection& = delete;
         [[nodiscard]] auto CountHandlers() const -> size_t;
         [[nodiscard]] auto HasHandlerForItemId(int id) const -> bool;
+        [[nodiscard]] auto Memo() const -> std::shared_ptr<TagItemMemo>;
         void RegisterTagItem(int itemId, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem);
+        void RegisterTagItem(
+            int itemId,
+            std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem,
+            TagItemDependencies dependencies);
         void TagItemUpdate(UKControllerPlugin::Tag::TagData& tagData) const;
         void RegisterAllItemsWithEuroscope(
             UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface& pluginCore) const;
@@ -32,5 +45,8 @@ namespace UKControllerPlugin::Tag {
 
         // All registered tag items
         std::map<int, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface>> tagItems;
+
+        // Remembers the output of tag items that have declared their dependencies
+        const std::shared_ptr<TagItemMemo> memo;
     };
 } // namespace UKControllerPlugin::Tag
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace UKControllerPlugin::Tag {
+    /*
+        Describes what the output of a tag item depends on. When any of these change for an aircraft,
+        the memoised output for that aircraft is forgotten and the handler is asked again. An item with
+        no dependencies is only forgotten when the aircraft disconnects.
+    */
+    using TagItemDependencies = struct TagItemDependencies
+    {
+        // The aircraft's flightplan, or the controller data attached to it, has changed
+        bool flightplan = false;
+    };
+} // namespace UKControllerPlugin::Tag
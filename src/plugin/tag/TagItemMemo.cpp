@@ -0,0 +1,137 @@
+#include "TagItemMemo.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+
+namespace UKControllerPlugin::Tag {
+
+    /*
+        Start memoising an item code, forgetting its output whenever one of the dependencies changes.
+    */
+    void TagItemMemo::Memoise(int itemCode, TagItemDependencies dependencies)
+    {
+        this->dependencies[itemCode] = std::move(dependencies);
+    }
+
+    auto TagItemMemo::IsMemoised(int itemCode) const -> bool
+    {
+        return this->dependencies.contains(itemCode);
+    }
+
+    auto TagItemMemo::Has(const std::string& callsign, int itemCode) const -> bool
+    {
+        const auto callsignItems = this->items.find(callsign);
+        return callsignItems != this->items.cend() && callsignItems->second.contains(itemCode);
+    }
+
+    auto TagItemMemo::Count() const -> size_t
+    {
+        size_t count = 0;
+        for (const auto& callsignItems : this->items) {
+            count += callsignItems.second.size();
+        }
+
+        return count;
+    }
+
+    auto TagItemMemo::Hits() const -> uint64_t
+    {
+        return this->hits;
+    }
+
+    auto TagItemMemo::Misses() const -> uint64_t
+    {
+        return this->misses;
+    }
+
+    /*
+        If we have a memoised output for the tag cell, write it into the tag data and return true.
+    */
+    auto TagItemMemo::Restore(TagData& tagData) -> bool
+    {
+        if (!this->IsMemoised(tagData.GetItemCode())) {
+            return false;
+        }
+
+        const auto callsignItems = this->items.find(tagData.GetFlightplan().GetCallsign());
+        if (callsignItems == this->items.cend()) {
+            this->misses++;
+            return false;
+        }
+
+        const auto item = callsignItems->second.find(tagData.GetItemCode());
+        if (item == callsignItems->second.cend() || item->second.dataAvailable != tagData.GetDataAvailable()) {
+            this->misses++;
+            return false;
+        }
+
+        tagData.SetItemString(item->second.itemString.data());
+        tagData.SetTagColour(item->second.tagColour);
+        tagData.SetEuroscopeColourCode(item->second.euroscopeColourCode);
+        tagData.SetFontSize(item->second.fontSize);
+        this->hits++;
+        return true;
+    }
+
+    /*
+        Remember the output of a tag item that has just been generated.
+    */
+    void TagItemMemo::Store(const TagData& tagData)
+    {
+        const auto dependencies = this->dependencies.find(tagData.GetItemCode());
+        if (dependencies == this->dependencies.cend()) {
+            return;
+        }
+
+        MemoisedTagItem item{
+            {},
+            tagData.GetEuroscopeColourCode(),
+            tagData.GetTagColour(),
+            tagData.GetFontSize(),
+            tagData.GetDataAvailable(),
+            &dependencies->second};
+        const auto itemString = tagData.GetItemStringView();
+        std::copy(itemString.cbegin(), itemString.cend(), item.itemString.begin());
+        item.itemString[itemString.size()] = '\0';
+
+        this->items[tagData.GetFlightplan().GetCallsign()][tagData.GetItemCode()] = item;
+    }
+
+    void TagItemMemo::FlightPlanEvent(
+        Euroscope::EuroScopeCFlightPlanInterface& flightPlan, Euroscope::EuroScopeCRadarTargetInterface& radarTarget)
+    {
+        this->EvictCallsign(
+            flightPlan.GetCallsign(), [](const TagItemDependencies& dependencies) { return dependencies.flightplan; });
+    }
+
+    /*
+        The aircraft has gone, so nothing we remember about it is of any use.
+    */
+    void TagItemMemo::FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan)
+    {
+        this->items.erase(flightPlan.GetCallsign());
+    }
+
+    void TagItemMemo::ControllerFlightPlanDataEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan, int dataType)
+    {
+        this->EvictCallsign(
+            flightPlan.GetCallsign(), [](const TagItemDependencies& dependencies) { return dependencies.flightplan; });
+    }
+
+    void TagItemMemo::Evict(MemoisedTagItems& items, const std::function<bool(const TagItemDependencies&)>& shouldEvict)
+    {
+        std::erase_if(items, [&shouldEvict](const auto& item) { return shouldEvict(*item.second.dependencies); });
+    }
+
+    void TagItemMemo::EvictCallsign(
+        const std::string& callsign, const std::function<bool(const TagItemDependencies&)>& shouldEvict)
+    {
+        const auto callsignItems = this->items.find(callsign);
+        if (callsignItems == this->items.end()) {
+            return;
+        }
+
+        Evict(callsignItems->second, shouldEvict);
+        if (callsignItems->second.empty()) {
+            this->items.erase(callsignItems);
+        }
+    }
+} // namespace UKControllerPlugin::Tag
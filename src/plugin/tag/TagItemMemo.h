@@ -0,0 +1,73 @@
+#pragma once
+#include "TagData.h"
+#include "TagItemDependencies.h"
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+
+namespace UKControllerPlugin::Tag {
+
+    /*
+        Remembers the finished output of tag items, keyed by callsign and item code, so that EuroScope
+        refreshing the same tag cell over and over doesn't recompute it each time.
+
+        Only item codes that have declared their dependencies are memoised. When a dependency changes, only
+        the entries that depend on it are evicted.
+    */
+    class TagItemMemo : public Flightplan::FlightPlanEventHandlerInterface
+    {
+        public:
+        void Memoise(int itemCode, TagItemDependencies dependencies);
+        [[nodiscard]] auto IsMemoised(int itemCode) const -> bool;
+        [[nodiscard]] auto Has(const std::string& callsign, int itemCode) const -> bool;
+        [[nodiscard]] auto Count() const -> size_t;
+        [[nodiscard]] auto Hits() const -> uint64_t;
+        [[nodiscard]] auto Misses() const -> uint64_t;
+        auto Restore(TagData& tagData) -> bool;
+        void Store(const TagData& tagData);
+        void FlightPlanEvent(
+            Euroscope::EuroScopeCFlightPlanInterface& flightPlan,
+            Euroscope::EuroScopeCRadarTargetInterface& radarTarget) override;
+        void FlightPlanDisconnectEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan) override;
+        void ControllerFlightPlanDataEvent(Euroscope::EuroScopeCFlightPlanInterface& flightPlan, int dataType) override;
+
+        private:
+        using MemoisedTagItem = struct MemoisedTagItem
+        {
+            // The finished string for the tag cell
+            std::array<char, TagData::maxItemSize> itemString;
+
+            // The EuroScope colour code
+            int euroscopeColourCode;
+
+            // The custom tag colour
+            COLORREF tagColour;
+
+            // The font size
+            double fontSize;
+
+            // What EuroScope had available when the item was generated
+            int dataAvailable;
+
+            // What the item depends on
+            const TagItemDependencies* dependencies;
+        };
+
+        using MemoisedTagItems = std::unordered_map<int, MemoisedTagItem>;
+
+        static void
+        Evict(MemoisedTagItems& items, const std::function<bool(const TagItemDependencies&)>& shouldEvict);
+        void EvictCallsign(
+            const std::string& callsign, const std::function<bool(const TagItemDependencies&)>& shouldEvict);
+
+        // The dependencies of each memoised item code
+        std::map<int, TagItemDependencies> dependencies;
+
+        // Memoised items, by callsign then item code
+        std::unordered_map<std::string, MemoisedTagItems> items;
+
+        // How many times a memoised item was reused
+        uint64_t hits = 0;
+
+        // How many times a memoised item had to be generated
+        uint64_t misses = 0;
+    };
+} // namespace UKControllerPlugin::Tag
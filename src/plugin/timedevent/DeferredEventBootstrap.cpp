@@ -1,18 +1,18 @@
-#include "pch/stdafx.h"
 #include "timedevent/DeferredEventBootstrap.h"
+#include "bootstrap/PersistenceContainer.h"
 #include "timedevent/DeferredEventHandler.h"
 #include "timedevent/TimedEventCollection.h"
 
-using UKControllerPlugin::TimedEvent::DeferredEventHandler;
-using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPlugin::Bootstrap::PersistenceContainer;
 
-namespace UKControllerPlugin {
-    namespace TimedEvent {
+namespace UKControllerPlugin::TimedEvent {
 
-        void DeferredEventBootstrap(TimedEventCollection& timedEvents)
-        {
-            timedEvents.RegisterEvent(std::make_shared<DeferredEventHandler>(), 5);
-        }
-
-    } // namespace TimedEvent
-} // namespace  UKControllerPlugin
+    /*
+        The deferred event handler drives the shared timeout wheel, so it's triggered as often as the wheel ticks.
+    */
+    void DeferredEventBootstrap(PersistenceContainer& container)
+    {
+        container.deferredEvents = std::make_shared<DeferredEventHandler>(container.timeouts);
+        container.timedHandler->RegisterEvent(container.deferredEvents, 1);
+    }
+} // namespace UKControllerPlugin::TimedEvent
@@ -1,13 +1,9 @@
 #pragma once
 
-namespace UKControllerPlugin {
-    namespace TimedEvent {
-        class TimedEventCollection;
-    } // namespace TimedEvent
-} // namespace UKControllerPlugin
+namespace UKControllerPlugin::Bootstrap {
+    struct PersistenceContainer;
+} // namespace UKControllerPlugin::Bootstrap
 
-namespace UKControllerPlugin {
-    namespace TimedEvent {
-        void DeferredEventBootstrap(UKControllerPlugin::TimedEvent::TimedEventCollection& timedEvents);
-    } // namespace TimedEvent
-} // namespace UKControllerPlugin
+namespace UKControllerPlugin::TimedEvent {
+    void DeferredEventBootstrap(UKControllerPlugin::Bootstrap::PersistenceContainer& container);
+} // namespace UKControllerPlugin::TimedEvent
@@ -1,55 +1,42 @@
-#include "pch/stdafx.h"
 #include "timedevent/DeferredEventHandler.h"
-#include "euroscope/EuroscopePluginLoopbackInterface.h"
-#include "euroscope/EuroScopeCFlightPlanInterface.h"
-#include "euroscope/EuroScopeCRadarTargetInterface.h"
+#include "timedevent/DeferredEventRunnerInterface.h"
 
-using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
-using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
-using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
-using UKControllerPlugin::TimedEvent::DeferredEvent;
 using UKControllerPlugin::TimedEvent::DeferredEventRunnerInterface;
 
 namespace UKControllerPlugin {
     namespace TimedEvent {
 
-        void DeferredEventHandler::DeferFor(
-            std::unique_ptr<DeferredEventRunnerInterface> event, const std::chrono::seconds seconds)
+        DeferredEventHandler::DeferredEventHandler(std::shared_ptr<TimeoutWheel> events) : events(std::move(events))
         {
-            DeferredEvent deferred{std::chrono::system_clock::now() + seconds, std::move(event)};
-
-            this->events.insert(std::move(deferred));
         }
 
         /*
-            Gets the time of the next scheduled event
+            The wheel is shared, so only our own events are counted.
         */
-        std::chrono::system_clock::time_point DeferredEventHandler::NextEventTime(void) const
+        auto DeferredEventHandler::Count() const -> size_t
         {
-            if (this->events.cbegin() == this->events.cend()) {
-                return (std::chrono::system_clock::time_point::max)();
-            }
+            return *this->pending;
+        }
 
-            return this->events.cbegin()->runAt;
+        void DeferredEventHandler::DeferFor(
+            std::unique_ptr<DeferredEventRunnerInterface> event, const std::chrono::seconds seconds)
+        {
+            (*this->pending)++;
+            static_cast<void>(this->events->Schedule(
+                TimeoutWheel::Clock::now(),
+                seconds,
+                [runner = std::shared_ptr<DeferredEventRunnerInterface>(std::move(event)), pending = this->pending]() {
+                    (*pending)--;
+                    runner->Run();
+                }));
         }
 
         /*
-            Check if there are any events to be run.
+            Run anything on the wheel that has come due.
         */
-        void DeferredEventHandler::TimedEventTrigger(void)
+        void DeferredEventHandler::TimedEventTrigger()
         {
-            // Check events
-            for (std::multiset<DeferredEvent>::iterator it = this->events.begin(); it != this->events.end();) {
-
-                // Run any events that we're ready for and remove them from the list
-                if (it->runAt < std::chrono::system_clock::now()) {
-                    it->runner->Run();
-                    this->events.erase(it++);
-                    continue;
-                }
-
-                break;
-            }
+            this->events->Advance(TimeoutWheel::Clock::now());
         }
 
     } // namespace TimedEvent
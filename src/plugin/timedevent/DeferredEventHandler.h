@@ -1,38 +1,35 @@
 #pragma once
-#include "timedevent/DeferredEventRunnerInterface.h"
-#include "timedevent/DeferredEvent.h"
 #include "timedevent/AbstractTimedEvent.h"
-
-namespace UKControllerPlugin {
-    namespace Euroscope {
-        class EuroscopePluginLoopbackInterface;
-    } // namespace Euroscope
-} // namespace UKControllerPlugin
+#include "timedevent/TimeoutWheel.h"
 
 namespace UKControllerPlugin {
     namespace TimedEvent {
+        class DeferredEventRunnerInterface;
 
         /*
             A class for handling deferred events.
             Broadly speaking, it stores an event until a given time
             has passed and then runs it.
+
+            The events go on the plugin's shared timeout wheel, which this handler
+            advances for everything scheduled on it.
         */
         class DeferredEventHandler : public UKControllerPlugin::TimedEvent::AbstractTimedEvent
         {
             public:
-            inline int Count(void) const
-            {
-                return this->events.size();
-            }
+            explicit DeferredEventHandler(std::shared_ptr<TimeoutWheel> events);
+            [[nodiscard]] auto Count() const -> size_t;
             void DeferFor(
                 std::unique_ptr<UKControllerPlugin::TimedEvent::DeferredEventRunnerInterface> event,
-                const std::chrono::seconds seconds);
-            std::chrono::system_clock::time_point NextEventTime(void) const;
-            void TimedEventTrigger(void);
+                std::chrono::seconds seconds);
+            void TimedEventTrigger() override;
 
             private:
-            // The events
-            std::multiset<DeferredEvent> events;
+            // The events, by when they're due to run
+            std::shared_ptr<TimeoutWheel> events;
+
+            // How many of our events are yet to run
+            std::shared_ptr<size_t> pending = std::make_shared<size_t>(0);
         };
     } // namespace TimedEvent
 } // namespace UKControllerPlugin
@@ -1,68 +1,192 @@
-#include "timedevent/TimedEventCollection.h"
 #include "timedevent/AbstractTimedEvent.h"
+#include "timedevent/TimedEventCollection.h"
+
+namespace UKControllerPlugin::TimedEvent {
 
-using UKControllerPlugin::TimedEvent::AbstractTimedEvent;
+    /*
+        Returns the total number of handlers.
+    */
+    auto TimedEventCollection::CountHandlers() const -> int
+    {
+        return static_cast<int>(this->events.size());
+    }
 
-namespace UKControllerPlugin {
-    namespace TimedEvent {
+    /*
+        Returns the number of timed event handlers for a given frequency of event.
+    */
+    auto TimedEventCollection::CountHandlersForFrequency(int frequency) const -> int
+    {
+        return static_cast<int>(
+            std::count_if(this->events.cbegin(), this->events.cend(), [frequency](const ScheduledEvent& event) {
+                return event.statistics.frequency == frequency;
+            }));
+    }
 
+    /*
+        Called by the main plugin when Euroscope calls the "OnTimer" function.
+        The parameter is the number of seconds since program startup.
+    */
+    void TimedEventCollection::Tick(int seconds)
+    {
         /*
-            Returns the total number of handlers.
+            If we've missed any seconds, or time has gone backwards, put everything back on the wheel from
+            now, the same as if we'd just started. Missed runs are skipped rather than all being caught up
+            at once.
         */
-        int TimedEventCollection::CountHandlers(void) const
-        {
-            int count = 0;
-            for (std::map<int, std::vector<std::shared_ptr<AbstractTimedEvent>>>::const_iterator it =
-                     this->eventMap.cbegin();
-                 it != this->eventMap.cend();
-                 ++it) {
-                count += it->second.size();
+        if (this->lastTick.has_value() && seconds != *this->lastTick + 1) {
+            for (auto& slot : this->wheel) {
+                slot.clear();
             }
 
-            return count;
+            this->unscheduled.clear();
+            for (size_t i = 0; i < this->events.size(); i++) {
+                this->unscheduled.push_back(i);
+            }
         }
 
-        /*
-            Returns the number of timed event handlers for a given frequency of event.
-        */
-        int TimedEventCollection::CountHandlersForFrequency(int frequency) const
-        {
-            return (this->eventMap.count(frequency) == 0) ? 0 : this->eventMap.at(frequency).size();
+        for (const auto eventIndex : this->unscheduled) {
+            this->Schedule(eventIndex, seconds);
         }
-        /*
-            Called by the main plugin when Euroscope calls the "OnTimer" function.
-            The parameter is the number of seconds since program startup.
-        */
-        void TimedEventCollection::Tick(int seconds) const
-        {
-            for (std::map<int, std::vector<std::shared_ptr<AbstractTimedEvent>>>::const_iterator it =
-                     this->eventMap.cbegin();
-                 it != this->eventMap.cend();
-                 ++it) {
-
-                // If we manage to find a set of events that wans to run at this time, run them all.
-                if (seconds % it->first == 0) {
-                    std::vector<std::shared_ptr<AbstractTimedEvent>> events = this->eventMap.find(it->first)->second;
-                    for (std::vector<std::shared_ptr<AbstractTimedEvent>>::const_iterator itVector = events.cbegin();
-                         itVector != events.cend();
-                         ++itVector) {
-                        try {
-                            (*itVector)->TimedEventTrigger();
-                        } catch (const std::exception& e) {
-                            LogFatalExceptionAndRethrow(
-                                "TimedEventCollection::Tick", std::string(typeid(*itVector).name()), e);
-                        }
-                    }
-                }
+        this->unscheduled.clear();
+
+        this->RunSlot(seconds, std::chrono::steady_clock::now());
+        this->lastTick = seconds;
+    }
+
+    /*
+        Registers an event, placing it on the least busy phase for its frequency.
+    */
+    void TimedEventCollection::RegisterEvent(std::shared_ptr<AbstractTimedEvent> event, int frequency)
+    {
+        assert(frequency > 0 && "Timed event frequency must be positive");
+        const int phase = this->ChoosePhase(frequency);
+        for (int slot = phase; slot < std::max(WHEEL_SLOTS, phase + 1); slot += frequency) {
+            this->slotLoad[slot % WHEEL_SLOTS]++;
+        }
+
+        TimedEventStatistics statistics{typeid(*event).name(), frequency, phase};
+        this->events.push_back({std::move(event), std::move(statistics), 0, false});
+        this->unscheduled.push_back(this->events.size() - 1);
+    }
+
+    void TimedEventCollection::SetTickBudget(std::chrono::microseconds budget)
+    {
+        this->tickBudget = budget;
+    }
+
+    auto TimedEventCollection::Statistics() const -> std::vector<TimedEventStatistics>
+    {
+        std::vector<TimedEventStatistics> statistics;
+        statistics.reserve(this->events.size());
+        for (const auto& event : this->events) {
+            statistics.push_back(event.statistics);
+        }
+
+        return statistics;
+    }
+
+    /*
+        Picks the phase whose seconds in the cycle currently have the fewest handlers running. Ties go to
+        the earliest phase, so the first handler at any frequency runs on the same seconds it always has.
+    */
+    auto TimedEventCollection::ChoosePhase(int frequency) const -> int
+    {
+        int bestPhase = 0;
+        int bestLoad = std::numeric_limits<int>::max();
+        for (int phase = 0; phase < std::min(frequency, WHEEL_SLOTS); phase++) {
+            int load = 0;
+            for (int slot = phase; slot < std::max(WHEEL_SLOTS, phase + 1); slot += frequency) {
+                load += this->slotLoad[slot % WHEEL_SLOTS];
+            }
+
+            if (load < bestLoad) {
+                bestLoad = load;
+                bestPhase = phase;
             }
         }
 
-        /*
-            Registers an event.
-        */
-        void TimedEventCollection::RegisterEvent(std::shared_ptr<AbstractTimedEvent> event, int frequency)
-        {
-            this->eventMap[frequency].push_back(event);
+        return bestPhase;
+    }
+
+    auto TimedEventCollection::TickBudgetExceeded(const std::chrono::steady_clock::time_point& tickStarted) const
+        -> bool
+    {
+        return this->tickBudget.has_value() && std::chrono::steady_clock::now() - tickStarted > *this->tickBudget;
+    }
+
+    /*
+        Puts the event on the wheel at the first second, from the one given, that falls on its phase.
+    */
+    void TimedEventCollection::Schedule(size_t eventIndex, int fromSecond)
+    {
+        auto& event = this->events[eventIndex];
+        event.nextRun = NextSecondOnPhase(event.statistics, fromSecond);
+        this->wheel[event.nextRun % WHEEL_SLOTS].push_back(eventIndex);
+    }
+
+    /*
+        The first second, from the one given, that falls on the event's phase.
+    */
+    auto TimedEventCollection::NextSecondOnPhase(const TimedEventStatistics& statistics, int fromSecond) -> int
+    {
+        const int frequency = statistics.frequency;
+        return fromSecond + ((statistics.phase - fromSecond) % frequency + frequency) % frequency;
+    }
+
+    /*
+        Runs everything in the slot for the given second that is due, and moves it on to the slot
+        for its next run. Events in the slot that aren't due until a later revolution stay put.
+
+        Events that were deferred from the previous second go first, so nothing gets starved, and
+        at least one event always runs, regardless of the budget. Once a deferred event has run, it goes
+        back to its own phase, so a busy tick doesn't permanently undo the spread from registration.
+    */
+    void TimedEventCollection::RunSlot(int second, const std::chrono::steady_clock::time_point& tickStarted)
+    {
+        auto& slot = this->wheel[second % WHEEL_SLOTS];
+        std::swap(this->slotEvents, slot);
+        std::stable_partition(this->slotEvents.begin(), this->slotEvents.end(), [this](size_t eventIndex) {
+            return this->events[eventIndex].deferred;
+        });
+
+        bool ranEvent = false;
+        for (const auto eventIndex : this->slotEvents) {
+            auto& event = this->events[eventIndex];
+            if (event.nextRun > second) {
+                slot.push_back(eventIndex);
+                continue;
+            }
+
+            if (ranEvent && this->TickBudgetExceeded(tickStarted)) {
+                event.statistics.deferrals++;
+                event.deferred = true;
+                event.nextRun = second + 1;
+            } else {
+                this->Run(event);
+                ranEvent = true;
+                event.deferred = false;
+                event.nextRun = NextSecondOnPhase(event.statistics, second + 1);
+            }
+
+            this->wheel[event.nextRun % WHEEL_SLOTS].push_back(eventIndex);
         }
-    } // namespace TimedEvent
-} // namespace UKControllerPlugin
+
+        this->slotEvents.clear();
+    }
+
+    void TimedEventCollection::Run(ScheduledEvent& event)
+    {
+        const auto started = std::chrono::steady_clock::now();
+        try {
+            event.event->TimedEventTrigger();
+        } catch (const std::exception& e) {
+            LogFatalExceptionAndRethrow("TimedEventCollection::Tick", event.statistics.handler, e);
+        }
+
+        const auto runTime =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+        event.statistics.runs++;
+        event.statistics.totalRunTime += runTime;
+        event.statistics.longestRunTime = std::max(event.statistics.longestRunTime, runTime);
+    }
+} // namespace UKControllerPlugin::TimedEvent
@@ -1,32 +1,102 @@
 #pragma once
 
-// Forward declare
-namespace UKControllerPlugin {
-    namespace TimedEvent {
-        class AbstractTimedEvent;
-    } // namespace TimedEvent
-} // namespace UKControllerPlugin
-// END
-
-namespace UKControllerPlugin {
-    namespace TimedEvent {
-
-        /*
-            A repository of event handlers for FlightPlan events. When an event is received, it will
-            call each of the handlers in turn.
-        */
-        class TimedEventCollection
+namespace UKControllerPlugin::TimedEvent {
+    class AbstractTimedEvent;
+
+    /*
+        How a timed event handler has been performing.
+    */
+    using TimedEventStatistics = struct TimedEventStatistics
+    {
+        // The type of the handler
+        std::string handler;
+
+        // How often the handler runs, in seconds
+        int frequency;
+
+        // The second in each cycle on which the handler runs
+        int phase;
+
+        // How many times the handler has run
+        size_t runs = 0;
+
+        // How many times the handler has been pushed back a second because the tick ran out of time
+        size_t deferrals = 0;
+
+        // Total time spent running the handler
+        std::chrono::microseconds totalRunTime = std::chrono::microseconds::zero();
+
+        // The longest single run of the handler
+        std::chrono::microseconds longestRunTime = std::chrono::microseconds::zero();
+    };
+
+    /*
+        Runs handlers on a timer, as driven by EuroScope calling OnTimer every second.
+
+        Handlers are kept in a hashed timer wheel with a slot for each second, so each tick only looks at the
+        handlers that are due. When a handler is registered, it is given the phase within its frequency that
+        is least busy, so handlers with the same or shared frequencies are spread out across different seconds
+        rather than all running together.
+
+        Optionally, each tick can be given a time budget. Once it's used up, any handlers still due that tick
+        are deferred to the next second.
+    */
+    class TimedEventCollection
+    {
+        public:
+        [[nodiscard]] auto CountHandlers() const -> int;
+        [[nodiscard]] auto CountHandlersForFrequency(int frequency) const -> int;
+        void Tick(int seconds);
+        void RegisterEvent(std::shared_ptr<AbstractTimedEvent> event, int frequency);
+        void SetTickBudget(std::chrono::microseconds budget);
+        [[nodiscard]] auto Statistics() const -> std::vector<TimedEventStatistics>;
+
+        private:
+        using ScheduledEvent = struct ScheduledEvent
         {
-            public:
-            int CountHandlers(void) const;
-            int CountHandlersForFrequency(int frequency) const;
-            void Tick(int seconds) const;
-            void
-            RegisterEvent(std::shared_ptr<UKControllerPlugin::TimedEvent::AbstractTimedEvent> event, int frequency);
-
-            private:
-            // Vector of registered handlers
-            std::map<int, std::vector<std::shared_ptr<AbstractTimedEvent>>> eventMap;
+            // The handler
+            std::shared_ptr<AbstractTimedEvent> event;
+
+            // How it's performing
+            TimedEventStatistics statistics;
+
+            // The second it's next due to run
+            int nextRun;
+
+            // Was it pushed back from its last due second
+            bool deferred;
         };
-    } // namespace TimedEvent
-} // namespace UKControllerPlugin
+
+        [[nodiscard]] auto ChoosePhase(int frequency) const -> int;
+        [[nodiscard]] static auto NextSecondOnPhase(const TimedEventStatistics& statistics, int fromSecond) -> int;
+        [[nodiscard]] auto TickBudgetExceeded(const std::chrono::steady_clock::time_point& tickStarted) const
+            -> bool;
+        void Schedule(size_t eventIndex, int fromSecond);
+        void RunSlot(int second, const std::chrono::steady_clock::time_point& tickStarted);
+        void Run(ScheduledEvent& event);
+
+        // How many slots are in the wheel, one per second
+        static constexpr int WHEEL_SLOTS = 60;
+
+        // All the handlers, never removed so indices stay valid
+        std::vector<ScheduledEvent> events;
+
+        // For each second, the handlers that may be due
+        std::array<std::vector<size_t>, WHEEL_SLOTS> wheel;
+
+        // How many handler runs have been assigned to each second in the cycle
+        std::array<int, WHEEL_SLOTS> slotLoad{};
+
+        // Handlers registered since the last tick, waiting to be put on the wheel
+        std::vector<size_t> unscheduled;
+
+        // Reused whilst running a slot, to save allocating every tick
+        std::vector<size_t> slotEvents;
+
+        // The last second we ticked
+        std::optional<int> lastTick;
+
+        // How long each tick may spend running handlers
+        std::optional<std::chrono::microseconds> tickBudget;
+    };
+} // namespace UKControllerPlugin::TimedEvent
@@ -0,0 +1,141 @@
+#include "TimeoutWheel.h"
+
+namespace UKControllerPlugin::TimedEvent {
+
+    TimeoutWheel::TimeoutWheel(std::chrono::milliseconds resolution, Clock::time_point start)
+        : resolution(resolution), start(start)
+    {
+    }
+
+    /*
+        Schedule a callback to run once the delay has passed since now. Negative delays are due straight away.
+        The wheel may not have been advanced for a while, so the deadline is worked out from the time given
+        rather than the tick we're on.
+    */
+    auto TimeoutWheel::Schedule(Clock::time_point now, std::chrono::milliseconds delay, std::function<void()> callback)
+        -> TimeoutId
+    {
+        const auto id = this->nextId++;
+        const auto expiresAt = this->FirstTickFrom(now + delay);
+        if (delay.count() <= 0 || expiresAt <= this->currentTick) {
+            this->timeouts[id] = {this->currentTick, std::move(callback)};
+            this->due.push_back(id);
+            return id;
+        }
+
+        const auto ticks = std::min<Tick>(expiresAt - this->currentTick, maxTicksAhead);
+        this->timeouts[id] = {this->currentTick + ticks, std::move(callback)};
+        this->Place(id, this->currentTick + ticks);
+        return id;
+    }
+
+    auto TimeoutWheel::Cancel(TimeoutId id) -> bool
+    {
+        return this->timeouts.erase(id) != 0;
+    }
+
+    /*
+        Move the wheel on to the given time, firing everything that's due on the way.
+    */
+    void TimeoutWheel::Advance(Clock::time_point now)
+    {
+        auto dueNow = std::move(this->due);
+        this->due.clear();
+        this->Fire(std::move(dueNow));
+
+        const auto target = now > this->start ? static_cast<Tick>((now - this->start) / this->resolution) : Tick{0};
+        while (this->currentTick < target) {
+            // If nothing is waiting, there's nothing to tick through
+            if (this->timeouts.empty()) {
+                this->currentTick = target;
+                return;
+            }
+
+            this->currentTick++;
+
+            // Work out which of the outer wheels have come round, and cascade them outermost first
+            size_t cascadeTo = 0;
+            while (cascadeTo + 1 < wheelCount && ((this->currentTick >> (slotBits * cascadeTo)) & slotMask) == 0) {
+                cascadeTo++;
+            }
+
+            for (auto level = cascadeTo; level > 0; level--) {
+                this->Cascade(level);
+            }
+
+            auto& slot = this->wheels[0][this->currentTick & slotMask];
+            auto expiring = std::move(slot);
+            slot.clear();
+            this->Fire(std::move(expiring));
+        }
+    }
+
+    auto TimeoutWheel::Count() const -> size_t
+    {
+        return this->timeouts.size();
+    }
+
+    /*
+        A tick is only reached once its start time has passed, so the first tick that starts at or after the
+        given time never fires before it.
+    */
+    auto TimeoutWheel::FirstTickFrom(Clock::time_point time) const -> Tick
+    {
+        if (time <= this->start) {
+            return 0;
+        }
+
+        const auto sinceStart = std::chrono::ceil<std::chrono::milliseconds>(time - this->start).count();
+        return static_cast<Tick>((sinceStart + this->resolution.count() - 1) / this->resolution.count());
+    }
+
+    /*
+        Put the timeout on the innermost wheel that reaches far enough ahead.
+    */
+    void TimeoutWheel::Place(TimeoutId id, Tick expiresAt)
+    {
+        const auto ticksAhead = expiresAt - this->currentTick;
+        for (size_t level = 0; level < wheelCount; level++) {
+            if (ticksAhead < (Tick{1} << (slotBits * (level + 1)))) {
+                this->wheels[level][(expiresAt >> (slotBits * level)) & slotMask].push_back(id);
+                return;
+            }
+        }
+    }
+
+    /*
+        Anything due on this tick lands in the current slot of the inner wheel, which is fired next.
+    */
+    void TimeoutWheel::Cascade(size_t level)
+    {
+        auto& slot = this->wheels[level][(this->currentTick >> (slotBits * level)) & slotMask];
+        const auto ids = std::move(slot);
+        slot.clear();
+
+        for (const auto id : ids) {
+            const auto timeout = this->timeouts.find(id);
+            if (timeout == this->timeouts.cend()) {
+                continue;
+            }
+
+            this->Place(id, std::max(timeout->second.expiresAt, this->currentTick));
+        }
+    }
+
+    /*
+        Callbacks may schedule or cancel other timeouts, so each is removed before it's run.
+    */
+    void TimeoutWheel::Fire(std::vector<TimeoutId> ids)
+    {
+        for (const auto id : ids) {
+            const auto timeout = this->timeouts.find(id);
+            if (timeout == this->timeouts.end()) {
+                continue;
+            }
+
+            auto callback = std::move(timeout->second.callback);
+            this->timeouts.erase(timeout);
+            callback();
+        }
+    }
+} // namespace UKControllerPlugin::TimedEvent
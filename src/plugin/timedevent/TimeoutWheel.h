@@ -0,0 +1,74 @@
+#pragma once
+
+namespace UKControllerPlugin::TimedEvent {
+
+    /*
+        A hierarchical timing wheel for timeouts, driven by a monotonic clock.
+
+        Timeouts are placed in a slot on the innermost wheel that can hold them. Each time the inner wheel goes
+        round, the next slot on the wheel above is cascaded down. Advancing the wheel only touches the slots that
+        have come due, so the cost is in the timeouts that actually expire rather than in the number that are
+        pending. Cancelled timeouts are dropped when their slot is next visited.
+    */
+    class TimeoutWheel
+    {
+        public:
+        using Clock = std::chrono::steady_clock;
+        using TimeoutId = uint64_t;
+
+        explicit TimeoutWheel(
+            std::chrono::milliseconds resolution = std::chrono::seconds(1), Clock::time_point start = Clock::now());
+        auto Schedule(Clock::time_point now, std::chrono::milliseconds delay, std::function<void()> callback)
+            -> TimeoutId;
+        auto Cancel(TimeoutId id) -> bool;
+        void Advance(Clock::time_point now);
+        [[nodiscard]] auto Count() const -> size_t;
+
+        // Returned when nothing is scheduled
+        inline static const TimeoutId noTimeout = 0;
+
+        private:
+        using Tick = uint64_t;
+
+        using Timeout = struct Timeout
+        {
+            Tick expiresAt;
+            std::function<void()> callback;
+        };
+
+        [[nodiscard]] auto FirstTickFrom(Clock::time_point time) const -> Tick;
+        void Place(TimeoutId id, Tick expiresAt);
+        void Cascade(size_t level);
+        void Fire(std::vector<TimeoutId> ids);
+
+        // Bits of the tick each wheel covers, and the number of wheels
+        inline static const size_t slotBits = 6;
+        inline static const size_t slotsPerWheel = 1 << slotBits;
+        inline static const Tick slotMask = slotsPerWheel - 1;
+        inline static const size_t wheelCount = 4;
+
+        // The furthest ahead we can schedule
+        inline static const Tick maxTicksAhead = (Tick{1} << (slotBits * wheelCount)) - 1;
+
+        // How long each tick is
+        const std::chrono::milliseconds resolution;
+
+        // Where tick zero is
+        const Clock::time_point start;
+
+        // The tick we've advanced to
+        Tick currentTick = 0;
+
+        // The id to give the next timeout
+        TimeoutId nextId = 1;
+
+        // Everything that hasn't fired or been cancelled
+        std::unordered_map<TimeoutId, Timeout> timeouts;
+
+        // The wheels, innermost first
+        std::array<std::array<std::vector<TimeoutId>, slotsPerWheel>, wheelCount> wheels;
+
+        // Timeouts that were already due when scheduled
+        std::vector<TimeoutId> due;
+    };
+} // namespace UKControllerPlugin::TimedEvent
@@ -21,14 +21,14 @@ namespace UKControllerPlugin::Wake {
 
         plugin.ApplyFunctionToAllFlightplans(
             [&callsigns, &leadFlightplan, this](
-                const std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface>& flightplan,
-                const std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface>& radarTarget) {
-                if (leadFlightplan->GetCallsign() == flightplan->GetCallsign() ||
-                    RelevantAirfieldForFlightplan(*leadFlightplan) != RelevantAirfieldForFlightplan(*flightplan)) {
+                const Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+                const Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
+                if (leadFlightplan->GetCallsign() == flightplan.GetCallsign() ||
+                    RelevantAirfieldForFlightplan(*leadFlightplan) != RelevantAirfieldForFlightplan(flightplan)) {
                     return;
                 }
 
-                callsigns.insert(flightplan->GetCallsign());
+                callsigns.insert(flightplan.GetCallsign());
             });
         return callsigns;
     }
@@ -21,14 +21,14 @@ namespace UKControllerPlugin::Wake {
 
         plugin.ApplyFunctionToAllFlightplans(
             [&callsigns, &airfields, this](
-                const std::shared_ptr<Euroscope::EuroScopeCFlightPlanInterface>& flightplan,
-                const std::shared_ptr<Euroscope::EuroScopeCRadarTargetInterface>& radarTarget) {
-                if (std::find(airfields.begin(), airfields.end(), RelevantAirfieldForFlightplan(*flightplan)) ==
+                const Euroscope::EuroScopeCFlightPlanInterface& flightplan,
+                const Euroscope::EuroScopeCRadarTargetInterface& radarTarget) {
+                if (std::find(airfields.begin(), airfields.end(), RelevantAirfieldForFlightplan(flightplan)) ==
                     airfields.cend()) {
                     return;
                 }
 
-                callsigns.insert(flightplan->GetCallsign());
+                callsigns.insert(flightplan.GetCallsign());
             });
         return callsigns;
     }
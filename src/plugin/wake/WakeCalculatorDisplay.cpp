@@ -296,9 +296,16 @@ namespace UKControllerPlugin::Wake {
     {
         // Check for the mapper and required flightplans
         const auto mapper = options->SchemeMapper();
-        const auto leadFlightplan = plugin.GetFlightplanForCallsign(options->LeadAircraft());
-        const auto followingFlightplan = plugin.GetFlightplanForCallsign(options->FollowingAircraft());
-        if (options->SchemeMapper() == nullptr || leadFlightplan == nullptr || followingFlightplan == nullptr) {
+        std::shared_ptr<WakeCategory> leadCategory;
+        std::shared_ptr<WakeCategory> followingCategory;
+        const auto mapCategory = [&mapper](std::shared_ptr<WakeCategory>& category) {
+            return [&mapper, &category](const Euroscope::EuroScopeCFlightPlanInterface& flightplan) {
+                category = mapper->MapForFlightplan(flightplan);
+            };
+        };
+        if (mapper == nullptr ||
+            !plugin.ApplyFunctionToFlightplan(options->LeadAircraft(), mapCategory(leadCategory)) ||
+            !plugin.ApplyFunctionToFlightplan(options->FollowingAircraft(), mapCategory(followingCategory))) {
             graphics.DrawString(
                 L"--",
                 calculationResultArea,
@@ -309,8 +316,6 @@ namespace UKControllerPlugin::Wake {
         }
 
         // Check for the categories;
-        const auto leadCategory = mapper->MapForFlightplan(*leadFlightplan);
-        const auto followingCategory = mapper->MapForFlightplan(*followingFlightplan);
         if (leadCategory == nullptr || followingCategory == nullptr) {
             graphics.DrawString(
                 L"--",
@@ -1,7 +1,9 @@
 #include "ApiBootstrap.h"
 #include "ApiFactory.h"
+#include "ApiHealthTracker.h"
 #include "ApiHelper.h"
 #include "ApiKeyReceivedEvent.h"
+#include "ApiResponseCache.h"
 #include "ApiSettings.h"
 #include "ConfigApiSettingsProvider.h"
 #include "CurlApiRequestPerformerFactory.h"
@@ -32,9 +34,11 @@ namespace UKControllerPluginUtils::Api {
         settingRepository.AddProvider(std::make_shared<JsonFileSettingProvider>(
             L"api-settings.json", std::set<std::string>{"api-key", "api-url"}, windows));
 
+        auto healthTracker = std::make_shared<ApiHealthTracker>();
         auto factory = std::make_shared<ApiFactory>(
             std::make_shared<ConfigApiSettingsProvider>(settingRepository),
-            std::make_shared<CurlApiRequestPerformerFactory>(std::make_unique<CurlApi>()));
+            std::make_shared<CurlApiRequestPerformerFactory>(std::make_unique<CurlApi>(), healthTracker),
+            healthTracker);
 
         EventHandler::EventBus::Bus().AddHandler<ApiKeyReceivedEvent>(
             std::make_shared<SetApiKeyInConfig>(settingRepository), EventHandler::EventHandlerFlags::Async);
@@ -57,4 +61,17 @@ namespace UKControllerPluginUtils::Api {
     {
         return std::make_unique<ApiHelper>(curl, factory.LegacyRequestBuilder());
     }
+
+    /**
+     * Bootstrap the "legacy" APIInterface, with responses to periodic requests cached on disk
+     */
+    auto BootstrapLegacy(ApiFactory& factory, CurlInterface& curl, WinApiInterface& windows)
+        -> std::unique_ptr<ApiInterface>
+    {
+        return std::make_unique<ApiHelper>(
+            curl,
+            factory.LegacyRequestBuilder(),
+            std::make_shared<ApiResponseCache>(windows, L"cache/api-responses.json"),
+            factory.HealthTracker());
+    }
 } // namespace UKControllerPluginUtils::Api
@@ -25,4 +25,10 @@ namespace UKControllerPluginUtils::Api {
 
     [[nodiscard]] auto BootstrapLegacy(ApiFactory& factory, UKControllerPlugin::Curl::CurlInterface& curl)
         -> std::unique_ptr<UKControllerPlugin::Api::ApiInterface>;
+
+    [[nodiscard]] auto BootstrapLegacy(
+        ApiFactory& factory,
+        UKControllerPlugin::Curl::CurlInterface& curl,
+        UKControllerPlugin::Windows::WinApiInterface& windows)
+        -> std::unique_ptr<UKControllerPlugin::Api::ApiInterface>;
 } // namespace UKControllerPluginUtils::Api
@@ -1,5 +1,6 @@
 #include "AbstractApiRequestPerformerFactory.h"
 #include "ApiFactory.h"
+#include "ApiHealthTracker.h"
 #include "ApiRequestBuilder.h"
 #include "ApiRequestFactory.h"
 #include "ApiSettings.h"
@@ -11,13 +12,20 @@ namespace UKControllerPluginUtils::Api {
 
     ApiFactory::ApiFactory(
         std::shared_ptr<ApiSettingsProviderInterface> settingsProvider,
-        std::shared_ptr<AbstractApiRequestPerformerFactory> requestPerformerFactory)
-        : settingsProvider(settingsProvider), requestPerformerFactory(std::move(requestPerformerFactory))
+        std::shared_ptr<AbstractApiRequestPerformerFactory> requestPerformerFactory,
+        std::shared_ptr<ApiHealthTracker> healthTracker)
+        : settingsProvider(settingsProvider), requestPerformerFactory(std::move(requestPerformerFactory)),
+          healthTracker(healthTracker ? std::move(healthTracker) : std::make_shared<ApiHealthTracker>())
     {
     }
 
     ApiFactory::~ApiFactory() = default;
 
+    auto ApiFactory::HealthTracker() -> const std::shared_ptr<ApiHealthTracker>&
+    {
+        return healthTracker;
+    }
+
     auto ApiFactory::SettingsProvider() -> const std::shared_ptr<ApiSettingsProviderInterface>
     {
         return settingsProvider;
@@ -11,6 +11,7 @@ namespace UKControllerPlugin {
 
 namespace UKControllerPluginUtils::Api {
     class AbstractApiRequestPerformerFactory;
+    class ApiHealthTracker;
     class ApiRequestFactory;
     class ApiSettings;
     class ApiSettingsProviderInterface;
@@ -24,8 +25,10 @@ namespace UKControllerPluginUtils::Api {
         public:
         ApiFactory(
             std::shared_ptr<ApiSettingsProviderInterface> settingsProvider,
-            std::shared_ptr<AbstractApiRequestPerformerFactory> requestPerformerFactory);
+            std::shared_ptr<AbstractApiRequestPerformerFactory> requestPerformerFactory,
+            std::shared_ptr<ApiHealthTracker> healthTracker = nullptr);
         ~ApiFactory();
+        [[nodiscard]] auto HealthTracker() -> const std::shared_ptr<ApiHealthTracker>&;
         [[nodiscard]] auto LegacyRequestBuilder() -> const UKControllerPlugin::Api::ApiRequestBuilder&;
         [[nodiscard]] auto RequestFactory() -> ApiRequestFactory&;
         [[nodiscard]] auto SettingsProvider() -> const std::shared_ptr<ApiSettingsProviderInterface>;
@@ -37,6 +40,9 @@ namespace UKControllerPluginUtils::Api {
         // Starts performing requests - can be subbed out for a mock.
         std::shared_ptr<AbstractApiRequestPerformerFactory> requestPerformerFactory;
 
+        // Tracks how the API is responding, shared between the new and legacy ways of calling it
+        std::shared_ptr<ApiHealthTracker> healthTracker;
+
         // Builds API requests
         std::unique_ptr<ApiRequestFactory> requestFactory;
 
@@ -0,0 +1,218 @@
+#include "ApiHealthTracker.h"
+
+namespace UKControllerPluginUtils::Api {
+
+    ApiHealthTracker::ApiHealthTracker() : ApiHealthTracker([]() { return std::chrono::steady_clock::now(); })
+    {
+    }
+
+    ApiHealthTracker::ApiHealthTracker(Clock clock, unsigned int jitterSeed)
+        : clock(std::move(clock)), jitter(jitterSeed)
+    {
+    }
+
+    /**
+     * Returns whether a request to the URI should be made. If the circuit has been open long enough,
+     * this moves it to half-open and lets the caller through as the probe.
+     */
+    auto ApiHealthTracker::AllowRequest(const std::string& uri) -> bool
+    {
+        std::lock_guard lock(this->healthLock);
+        auto endpoint = this->endpoints.find(EndpointKey(uri));
+        if (endpoint == this->endpoints.end() || endpoint->second.state == CircuitState::Closed) {
+            return true;
+        }
+
+        auto& health = endpoint->second;
+        if (health.state == CircuitState::Open && this->clock() >= health.openUntil) {
+            health.state = CircuitState::HalfOpen;
+        }
+
+        if (health.state == CircuitState::HalfOpen && !health.probeInFlight) {
+            health.probeInFlight = true;
+            return true;
+        }
+
+        return false;
+    }
+
+    auto ApiHealthTracker::CountOpenCircuits() const -> size_t
+    {
+        std::lock_guard lock(this->healthLock);
+        return std::count_if(this->endpoints.cbegin(), this->endpoints.cend(), [](const auto& endpoint) {
+            return endpoint.second.state != CircuitState::Closed;
+        });
+    }
+
+    auto ApiHealthTracker::Healthy() const -> bool
+    {
+        return this->CountOpenCircuits() == 0;
+    }
+
+    auto ApiHealthTracker::Latency(const std::string& uri) const -> std::chrono::milliseconds
+    {
+        std::lock_guard lock(this->healthLock);
+        const auto endpoint = this->endpoints.find(EndpointKey(uri));
+        return endpoint == this->endpoints.cend()
+                   ? std::chrono::milliseconds(0)
+                   : std::chrono::milliseconds(static_cast<int64_t>(endpoint->second.latency + 0.5));
+    }
+
+    /**
+     * A request failed, either because it couldn't reach the API or because the API had an error.
+     */
+    void ApiHealthTracker::RecordFailure(const std::string& uri, std::chrono::milliseconds latency)
+    {
+        std::lock_guard lock(this->healthLock);
+        auto& health = this->endpoints[EndpointKey(uri)];
+        this->UpdateLatency(health, latency);
+        health.consecutiveFailures++;
+
+        if (health.state == CircuitState::HalfOpen ||
+            (health.state == CircuitState::Closed && health.consecutiveFailures >= failureThreshold)) {
+            this->Open(health);
+        }
+    }
+
+    void ApiHealthTracker::RecordSuccess(const std::string& uri, std::chrono::milliseconds latency)
+    {
+        std::lock_guard lock(this->healthLock);
+        auto& health = this->endpoints[EndpointKey(uri)];
+        this->UpdateLatency(health, latency);
+
+        if (health.state != CircuitState::Closed) {
+            LogInfo("API circuit closed for " + EndpointKey(uri));
+        }
+
+        health.state = CircuitState::Closed;
+        health.consecutiveFailures = 0;
+        health.timesOpened = 0;
+        health.probeInFlight = false;
+    }
+
+    /**
+     * How long until any open circuit may be probed again, so that periodic jobs can back off
+     * while the API is having problems.
+     */
+    auto ApiHealthTracker::RetryDelay() const -> std::chrono::milliseconds
+    {
+        std::lock_guard lock(this->healthLock);
+        const auto now = this->clock();
+        std::chrono::milliseconds delay(0);
+        for (const auto& [key, health] : this->endpoints) {
+            if (health.state == CircuitState::Open && health.openUntil > now) {
+                delay = (std::max)(
+                    delay, std::chrono::duration_cast<std::chrono::milliseconds>(health.openUntil - now));
+            }
+        }
+
+        return delay;
+    }
+
+    /**
+     * How long until the circuit for a particular endpoint may be probed again. The URI may be given without the
+     * API domain, for callers that don't know it, in which case it matches that path on any domain.
+     */
+    auto ApiHealthTracker::RetryDelay(const std::string& uri) const -> std::chrono::milliseconds
+    {
+        std::lock_guard lock(this->healthLock);
+        const auto now = this->clock();
+        const auto key = EndpointKey(uri);
+        std::chrono::milliseconds delay(0);
+        for (const auto& [endpoint, health] : this->endpoints) {
+            if (EndpointMatches(endpoint, key) && health.state == CircuitState::Open && health.openUntil > now) {
+                delay = (std::max)(
+                    delay, std::chrono::duration_cast<std::chrono::milliseconds>(health.openUntil - now));
+            }
+        }
+
+        return delay;
+    }
+
+    /**
+     * The endpoint with the highest average latency, and what that latency is.
+     */
+    auto ApiHealthTracker::Slowest() const -> std::pair<std::string, std::chrono::milliseconds>
+    {
+        std::lock_guard lock(this->healthLock);
+        std::pair<std::string, std::chrono::milliseconds> slowest{"", std::chrono::milliseconds(0)};
+        double slowestLatency = -1;
+        for (const auto& [endpoint, health] : this->endpoints) {
+            if (health.hasLatency && health.latency > slowestLatency) {
+                slowestLatency = health.latency;
+                slowest = {endpoint, std::chrono::milliseconds(static_cast<int64_t>(health.latency + 0.5))};
+            }
+        }
+
+        return slowest;
+    }
+
+    auto ApiHealthTracker::State(const std::string& uri) const -> CircuitState
+    {
+        std::lock_guard lock(this->healthLock);
+        const auto endpoint = this->endpoints.find(EndpointKey(uri));
+        return endpoint == this->endpoints.cend() ? CircuitState::Closed : endpoint->second.state;
+    }
+
+    /**
+     * Groups URIs by endpoint, so that e.g. squawk-assignment/BAW123 and squawk-assignment/EZY456
+     * share a circuit. The scheme and query are dropped and any path segment containing a digit is
+     * treated as a parameter.
+     */
+    auto ApiHealthTracker::EndpointKey(const std::string& uri) -> std::string
+    {
+        std::string path = uri.substr(0, uri.find('?'));
+        const auto schemeEnd = path.find("://");
+        if (schemeEnd != std::string::npos) {
+            path = path.substr(schemeEnd + 3);
+        }
+
+        std::string key;
+        std::stringstream segments(path);
+        std::string segment;
+        while (std::getline(segments, segment, '/')) {
+            if (segment.empty()) {
+                continue;
+            }
+
+            if (!key.empty()) {
+                key += '/';
+            }
+
+            key += std::any_of(segment.cbegin(), segment.cend(), [](char c) { return std::isdigit(c) != 0; })
+                       ? "{}"
+                       : segment;
+        }
+
+        return key;
+    }
+
+    auto ApiHealthTracker::EndpointMatches(const std::string& endpoint, const std::string& key) -> bool
+    {
+        return endpoint == key ||
+               (endpoint.size() > key.size() && endpoint.compare(endpoint.size() - key.size(), key.size(), key) == 0 &&
+                endpoint[endpoint.size() - key.size() - 1] == '/');
+    }
+
+    void ApiHealthTracker::Open(EndpointHealth& health)
+    {
+        // Double the backoff each time we re-open, then take somewhere between half and all of it
+        const auto exponent = (std::min)(health.timesOpened, 16U);
+        const auto backoff =
+            (std::min)(std::chrono::milliseconds(baseBackoff.count() * (int64_t{1} << exponent)), maxBackoff);
+        std::uniform_int_distribution<int64_t> distribution(backoff.count() / 2, backoff.count());
+
+        health.state = CircuitState::Open;
+        health.probeInFlight = false;
+        health.timesOpened++;
+        health.openUntil = this->clock() + std::chrono::milliseconds(distribution(this->jitter));
+        LogWarning("API circuit opened after " + std::to_string(health.consecutiveFailures) + " failures");
+    }
+
+    void ApiHealthTracker::UpdateLatency(EndpointHealth& health, std::chrono::milliseconds latency)
+    {
+        const auto sample = static_cast<double>(latency.count());
+        health.latency = health.hasLatency ? health.latency + latencyWeight * (sample - health.latency) : sample;
+        health.hasLatency = true;
+    }
+} // namespace UKControllerPluginUtils::Api
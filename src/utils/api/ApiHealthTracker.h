@@ -0,0 +1,96 @@
+#pragma once
+
+namespace UKControllerPluginUtils::Api {
+
+    /**
+     * The state of the circuit breaker for an endpoint.
+     */
+    enum class CircuitState
+    {
+        Closed,
+        Open,
+        HalfOpen
+    };
+
+    /**
+     * Tracks how the API is responding, per endpoint, so that we stop hammering it (and tying up
+     * our own threads waiting on timeouts) when it's having problems.
+     *
+     * Each endpoint keeps an average latency and a circuit breaker. After enough consecutive failures
+     * the circuit opens and requests fail fast, for a backoff period that grows exponentially (with jitter)
+     * each time it re-opens. Once the backoff has passed, a single probe request is let through. If it
+     * succeeds the circuit closes, otherwise it opens again.
+     */
+    class ApiHealthTracker
+    {
+        public:
+        using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+        ApiHealthTracker();
+        explicit ApiHealthTracker(Clock clock, unsigned int jitterSeed = std::random_device{}());
+        [[nodiscard]] auto AllowRequest(const std::string& uri) -> bool;
+        [[nodiscard]] auto CountOpenCircuits() const -> size_t;
+        [[nodiscard]] auto Healthy() const -> bool;
+        [[nodiscard]] auto Latency(const std::string& uri) const -> std::chrono::milliseconds;
+        void RecordFailure(const std::string& uri, std::chrono::milliseconds latency);
+        void RecordSuccess(const std::string& uri, std::chrono::milliseconds latency);
+        [[nodiscard]] auto RetryDelay() const -> std::chrono::milliseconds;
+        [[nodiscard]] auto RetryDelay(const std::string& uri) const -> std::chrono::milliseconds;
+        [[nodiscard]] auto Slowest() const -> std::pair<std::string, std::chrono::milliseconds>;
+        [[nodiscard]] auto State(const std::string& uri) const -> CircuitState;
+        [[nodiscard]] static auto EndpointKey(const std::string& uri) -> std::string;
+
+        // How many consecutive failures before the circuit opens
+        inline static const unsigned int failureThreshold = 3;
+
+        // How long the circuit stays open the first time
+        inline static const std::chrono::milliseconds baseBackoff = std::chrono::seconds(5);
+
+        // The longest the circuit will stay open for
+        inline static const std::chrono::milliseconds maxBackoff = std::chrono::minutes(5);
+
+        // How much weight a new latency sample carries in the average
+        inline static const double latencyWeight = 0.2;
+
+        private:
+        struct EndpointHealth
+        {
+            // The state of the circuit
+            CircuitState state = CircuitState::Closed;
+
+            // Failures in a row
+            unsigned int consecutiveFailures = 0;
+
+            // How many times the circuit has opened without a success in between
+            unsigned int timesOpened = 0;
+
+            // Average latency, in milliseconds
+            double latency = 0;
+
+            // Whether we've had a latency sample yet
+            bool hasLatency = false;
+
+            // Whether the half-open probe request is in flight
+            bool probeInFlight = false;
+
+            // When the circuit can next be half-opened
+            std::chrono::steady_clock::time_point openUntil;
+        };
+
+        [[nodiscard]] static auto EndpointMatches(const std::string& endpoint, const std::string& key) -> bool;
+        void Open(EndpointHealth& health);
+        void UpdateLatency(EndpointHealth& health, std::chrono::milliseconds latency);
+
+        // Tells the time, can be swapped out in tests
+        Clock clock;
+
+        // Adds jitter to backoff periods, so many clients don't retry at once
+        std::mt19937 jitter;
+
+        // Protects the endpoints, requests are made on many threads
+        mutable std::mutex healthLock;
+
+        // Health of each endpoint
+        std::map<std::string, EndpointHealth> endpoints;
+    };
+} // namespace UKControllerPluginUtils::Api
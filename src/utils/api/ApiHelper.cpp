@@ -1,7 +1,9 @@
 #include "api/ApiException.h"
+#include "api/ApiHealthTracker.h"
 #include "api/ApiHelper.h"
 #include "api/ApiNotAuthorisedException.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiResponseCache.h"
 #include "api/ApiResponseFactory.h"
 #include "curl/CurlInterface.h"
 #include "squawk/SquawkValidator.h"
@@ -17,21 +19,96 @@ using UKControllerPlugin::Curl::CurlResponse;
 using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using UKControllerPlugin::Squawk::SquawkValidator;
 using UKControllerPlugin::Srd::SrdSearchParameters;
+using UKControllerPluginUtils::Api::ApiHealthTracker;
+using UKControllerPluginUtils::Api::ApiResponseCache;
 
 namespace UKControllerPlugin::Api {
 
-    ApiHelper::ApiHelper(CurlInterface& curlApi, ApiRequestBuilder requestBuilder)
-        : requestBuilder(std::move(requestBuilder)), curlApi(curlApi)
+    ApiHelper::ApiHelper(
+        CurlInterface& curlApi,
+        ApiRequestBuilder requestBuilder,
+        std::shared_ptr<ApiResponseCache> responseCache,
+        std::shared_ptr<ApiHealthTracker> healthTracker)
+        : requestBuilder(std::move(requestBuilder)), curlApi(curlApi), responseCache(std::move(responseCache)),
+          healthTracker(std::move(healthTracker))
     {
     }
 
+    /*
+        Let the health tracker know how the request went. Only failures to reach the API, or errors on its side,
+        count against it.
+    */
+    void ApiHelper::RecordHealth(
+        const std::string& uri, const CurlResponse& response, std::chrono::steady_clock::time_point started) const
+    {
+        if (!this->healthTracker) {
+            return;
+        }
+
+        const auto latency =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+        if (response.IsCurlError() || response.GetStatusCode() >= STATUS_SERVER_ERROR) {
+            this->healthTracker->RecordFailure(uri, latency);
+        } else {
+            this->healthTracker->RecordSuccess(uri, latency);
+        }
+    }
+
     /*
         Makes a request to the API.
     */
     auto ApiHelper::MakeApiRequest(const CurlRequest& request) const -> ApiResponse
     {
+        return ApiResponseFactory::Create(this->PerformApiRequest(request, false));
+    }
+
+    /*
+        Makes a request to the API, sending the validators from any previous response. If the API
+        says nothing has changed, return what we parsed last time.
+    */
+    auto ApiHelper::MakeCachedApiRequest(CurlRequest request) const -> nlohmann::json
+    {
+        if (!this->responseCache) {
+            return this->MakeApiRequest(request).GetRawData();
+        }
+
+        const std::string uri = request.GetUri();
+        const bool haveCachedResponse = this->responseCache->Has(uri);
+        this->responseCache->AddValidators(request);
+        CurlResponse response = this->PerformApiRequest(request, haveCachedResponse);
+        if (response.GetStatusCode() == STATUS_NOT_MODIFIED) {
+            LogDebug("API returned not modified for " + uri + ", using cached response");
+            return this->responseCache->Body(uri);
+        }
+
+        auto body = ApiResponseFactory::Create(response).GetRawData();
+        this->responseCache->Store(uri, response, body);
+        return body;
+    }
+
+    /*
+        Performs the cURL request and checks the response is one the API should be sending.
+
+        If the API has been failing for this endpoint, fail fast rather than waiting for it to time out again.
+    */
+    auto ApiHelper::PerformApiRequest(const CurlRequest& request, bool allowNotModified) const -> CurlResponse
+    {
+        if (this->healthTracker && !this->healthTracker->AllowRequest(request.GetUri())) {
+            throw ApiException("API unavailable, not calling " + std::string(request.GetUri()));
+        }
+
+        const auto started = std::chrono::steady_clock::now();
         CurlResponse response = this->curlApi.MakeCurlRequest(request);
+        this->RecordHealth(request.GetUri(), response, started);
+        return ValidateResponse(request, response, allowNotModified);
+    }
 
+    /*
+        Checks the response is one the API should be sending, throwing if not.
+    */
+    auto ApiHelper::ValidateResponse(const CurlRequest& request, CurlResponse response, bool allowNotModified)
+        -> CurlResponse
+    {
         if (response.IsCurlError()) {
             LogError("cURL error when making API request, route: " + std::string(request.GetUri()));
             throw ApiException("ApiException when calling " + std::string(request.GetUri()));
@@ -56,6 +133,10 @@ namespace UKControllerPlugin::Api {
             throw ApiNotFoundException("The API returned 404 for " + std::string(request.GetUri()));
         }
 
+        if (allowNotModified && response.GetStatusCode() == STATUS_NOT_MODIFIED) {
+            return response;
+        }
+
         // These are the only codes the API should be sending on success
         if (response.GetStatusCode() != STATUS_CREATED && response.GetStatusCode() != STATUS_NO_CONTENT &&
             response.GetStatusCode() != STATUS_OK) {
@@ -63,7 +144,7 @@ namespace UKControllerPlugin::Api {
             throw ApiException("Unknown response");
         }
 
-        return ApiResponseFactory::Create(response);
+        return response;
     }
 
     auto ApiHelper::ProcessSquawkResponse(const ApiResponse& response, const std::string& callsign)
@@ -163,7 +244,7 @@ namespace UKControllerPlugin::Api {
 
     auto ApiHelper::GetAssignedHolds() const -> nlohmann::json
     {
-        return this->MakeApiRequest(this->requestBuilder.BuildAllAssignedHoldsRequest()).GetRawData();
+        return this->MakeCachedApiRequest(this->requestBuilder.BuildAllAssignedHoldsRequest());
     }
 
     void ApiHelper::AssignAircraftToHold(std::string callsign, std::string navaid) const
@@ -181,12 +262,12 @@ namespace UKControllerPlugin::Api {
     */
     auto ApiHelper::GetMinStackLevels() const -> nlohmann::json
     {
-        return this->MakeApiRequest(this->requestBuilder.BuildMinStackLevelRequest()).GetRawData();
+        return this->MakeCachedApiRequest(this->requestBuilder.BuildMinStackLevelRequest());
     }
 
     auto ApiHelper::GetRegionalPressures() const -> nlohmann::json
     {
-        return this->MakeApiRequest(this->requestBuilder.BuildRegionalPressureRequest()).GetRawData();
+        return this->MakeCachedApiRequest(this->requestBuilder.BuildRegionalPressureRequest());
     }
 
     auto ApiHelper::GetUri(std::string uri) const -> nlohmann::json
@@ -206,7 +287,7 @@ namespace UKControllerPlugin::Api {
 
     auto ApiHelper::GetAssignedStands() const -> nlohmann::json
     {
-        return this->MakeApiRequest(this->requestBuilder.BuildGetStandAssignmentsRequest()).GetRawData();
+        return this->MakeCachedApiRequest(this->requestBuilder.BuildGetStandAssignmentsRequest());
     }
 
     void ApiHelper::AssignStandToAircraft(std::string callsign, int standId) const
@@ -249,12 +330,12 @@ namespace UKControllerPlugin::Api {
 
     auto ApiHelper::GetAllNotifications() const -> nlohmann::json
     {
-        return this->MakeApiRequest(this->requestBuilder.BuildGetAllNotificationsRequest()).GetRawData();
+        return this->MakeCachedApiRequest(this->requestBuilder.BuildGetAllNotificationsRequest());
     }
 
     auto ApiHelper::GetUnreadNotifications() const -> nlohmann::json
     {
-        return this->MakeApiRequest(this->requestBuilder.BuildGetUnreadNotificationsRequest()).GetRawData();
+        return this->MakeCachedApiRequest(this->requestBuilder.BuildGetUnreadNotificationsRequest());
     }
 
     auto ApiHelper::SyncPluginEvents() const -> nlohmann::json
@@ -267,6 +348,23 @@ namespace UKControllerPlugin::Api {
         return this->MakeApiRequest(this->requestBuilder.BuildGetLatestPluginEventsRequest(lastEventId)).GetRawData();
     }
 
+    /*
+        Opens the plugin event stream, passing the stream to the callback as it arrives. Returns once the
+        API closes the stream, or the callback asks to stop.
+    */
+    void ApiHelper::StreamPluginEvents(int lastEventId, const std::function<bool(const std::string&)>& onData) const
+    {
+        const CurlRequest request = this->requestBuilder.BuildPluginEventStreamRequest(lastEventId);
+        if (this->healthTracker && !this->healthTracker->AllowRequest(request.GetUri())) {
+            throw ApiException("API unavailable, not calling " + std::string(request.GetUri()));
+        }
+
+        const auto started = std::chrono::steady_clock::now();
+        const CurlResponse response = this->curlApi.MakeStreamingCurlRequest(request, onData);
+        this->RecordHealth(request.GetUri(), response, started);
+        static_cast<void>(ValidateResponse(request, response, false));
+    }
+
     void ApiHelper::AcknowledgeDepartureReleaseRequest(int releaseId, int controllerPositionId) const
     {
         static_cast<void>(this->MakeApiRequest(
@@ -6,8 +6,14 @@
 namespace UKControllerPlugin::Curl {
     class CurlInterface;
     class CurlRequest;
+    class CurlResponse;
 } // namespace UKControllerPlugin::Curl
 
+namespace UKControllerPluginUtils::Api {
+    class ApiHealthTracker;
+    class ApiResponseCache;
+} // namespace UKControllerPluginUtils::Api
+
 namespace UKControllerPlugin::Api {
 
     /*
@@ -16,7 +22,11 @@ namespace UKControllerPlugin::Api {
     class ApiHelper : public UKControllerPlugin::Api::ApiInterface
     {
         public:
-        ApiHelper(UKControllerPlugin::Curl::CurlInterface& curlApi, ApiRequestBuilder requestBuilder);
+        ApiHelper(
+            UKControllerPlugin::Curl::CurlInterface& curlApi,
+            ApiRequestBuilder requestBuilder,
+            std::shared_ptr<UKControllerPluginUtils::Api::ApiResponseCache> responseCache = nullptr,
+            std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> healthTracker = nullptr);
 
         [[nodiscard]] auto
         CreateGeneralSquawkAssignment(std::string callsign, std::string origin, std::string destination) const
@@ -58,6 +68,8 @@ namespace UKControllerPlugin::Api {
         [[nodiscard]] auto GetUnreadNotifications() const -> nlohmann::json override;
         [[nodiscard]] auto SyncPluginEvents() const -> nlohmann::json override;
         [[nodiscard]] auto GetLatestPluginEvents(int lastEventId) const -> nlohmann::json override;
+        void StreamPluginEvents(
+            int lastEventId, const std::function<bool(const std::string&)>& onData) const override;
         void AcknowledgeDepartureReleaseRequest(int releaseId, int controllerPositionId) const override;
         void RejectDepartureReleaseRequest(
             int releaseId, int controllerPositionId, const std::string& remarks) const override;
@@ -90,6 +102,7 @@ namespace UKControllerPlugin::Api {
         static const uint64_t STATUS_OK = 200L;
         static const uint64_t STATUS_CREATED = 201L;
         static const uint64_t STATUS_NO_CONTENT = 204L;
+        static const uint64_t STATUS_NOT_MODIFIED = 304L;
         static const uint64_t STATUS_BAD_REQUEST = 400L;
         static const uint64_t STATUS_UNAUTHORISED = 401L;
         static const uint64_t STATUS_FORBIDDEN = 403L;
@@ -99,6 +112,19 @@ namespace UKControllerPlugin::Api {
 
         private:
         [[nodiscard]] auto MakeApiRequest(const UKControllerPlugin::Curl::CurlRequest& request) const -> ApiResponse;
+        [[nodiscard]] auto MakeCachedApiRequest(UKControllerPlugin::Curl::CurlRequest request) const
+            -> nlohmann::json;
+        [[nodiscard]] auto
+        PerformApiRequest(const UKControllerPlugin::Curl::CurlRequest& request, bool allowNotModified) const
+            -> UKControllerPlugin::Curl::CurlResponse;
+        [[nodiscard]] static auto ValidateResponse(
+            const UKControllerPlugin::Curl::CurlRequest& request,
+            UKControllerPlugin::Curl::CurlResponse response,
+            bool allowNotModified) -> UKControllerPlugin::Curl::CurlResponse;
+        void RecordHealth(
+            const std::string& uri,
+            const UKControllerPlugin::Curl::CurlResponse& response,
+            std::chrono::steady_clock::time_point started) const;
         [[nodiscard]] static auto ProcessSquawkResponse(const ApiResponse& response, const std::string& callsign)
             -> UKControllerPlugin::Squawk::ApiSquawkAllocation;
 
@@ -107,5 +133,11 @@ namespace UKControllerPlugin::Api {
 
         // An interface to the Curl library.
         UKControllerPlugin::Curl::CurlInterface& curlApi;
+
+        // Caches responses to periodic requests, so we can make conditional requests for them
+        const std::shared_ptr<UKControllerPluginUtils::Api::ApiResponseCache> responseCache;
+
+        // Tracks how the API is responding, so we can stop calling it whilst it's down
+        const std::shared_ptr<UKControllerPluginUtils::Api::ApiHealthTracker> healthTracker;
     };
 } // namespace UKControllerPlugin::Api
@@ -55,6 +55,8 @@ namespace UKControllerPlugin::Api {
         [[nodiscard]] virtual auto GetUnreadNotifications() const -> nlohmann::json = 0;
         [[nodiscard]] virtual auto SyncPluginEvents() const -> nlohmann::json = 0;
         [[nodiscard]] virtual auto GetLatestPluginEvents(int lastEventId) const -> nlohmann::json = 0;
+        virtual void
+        StreamPluginEvents(int lastEventId, const std::function<bool(const std::string&)>& onData) const = 0;
         virtual void AcknowledgeDepartureReleaseRequest(int releaseId, int controllerPositionId) const = 0;
         virtual void
         RejectDepartureReleaseRequest(int releaseId, int controllerPositionId, const std::string& remarks) const = 0;
@@ -265,6 +265,22 @@ namespace UKControllerPlugin::Api {
             this->BuildUrl("/plugin-events/recent?previous=" + std::to_string(lastEventId)), CurlRequest::METHOD_GET));
     }
 
+    /*
+        Builds a request to stream plugin events as server-sent events, starting after the given event. The stream
+        is recycled by its maximum request time, so a connection that has silently died doesn't leave us waiting
+        forever. Reaching that time once the stream is flowing is a normal close, not a failure.
+    */
+    auto ApiRequestBuilder::BuildPluginEventStreamRequest(int lastEventId) const -> CurlRequest
+    {
+        CurlRequest request(
+            this->BuildUrl("/plugin-events/stream?previous=" + std::to_string(lastEventId)), CurlRequest::METHOD_GET);
+        request.AddHeader("Authorization", "Bearer " + this->settings.Key());
+        request.AddHeader("Accept", "text/event-stream");
+        request.AddHeader("Cache-Control", "no-cache");
+        request.SetMaxRequestTime(pluginEventStreamMaxTime);
+        return request;
+    }
+
     auto ApiRequestBuilder::BuildAcknowledgeDepartureReleaseRequest(int releaseId, int controllerPositionId) const
         -> CurlRequest
     {
@@ -65,6 +65,8 @@ namespace UKControllerPlugin::Api {
         [[nodiscard]] auto BuildPluginEventSyncRequest() const -> UKControllerPlugin::Curl::CurlRequest;
         [[nodiscard]] auto BuildGetLatestPluginEventsRequest(int lastEventId) const
             -> UKControllerPlugin::Curl::CurlRequest;
+        [[nodiscard]] auto BuildPluginEventStreamRequest(int lastEventId) const
+            -> UKControllerPlugin::Curl::CurlRequest;
         [[nodiscard]] auto BuildAcknowledgeDepartureReleaseRequest(int releaseId, int controllerPositionId) const
             -> UKControllerPlugin::Curl::CurlRequest;
         [[nodiscard]] auto
@@ -110,6 +112,9 @@ namespace UKControllerPlugin::Api {
         // The type string to send in the payload if we want a local squawk
         const std::string localSquawkAssignmentType = "local";
 
+        // How long a plugin event stream stays open before we reconnect, in seconds
+        static const INT64 pluginEventStreamMaxTime = 300L;
+
         // Api settings
         const UKControllerPluginUtils::Api::ApiSettings& settings;
     };
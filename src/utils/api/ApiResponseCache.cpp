@@ -0,0 +1,217 @@
+#include "ApiResponseCache.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+#include "task/RunAsyncTask.h"
+#include "windows/WinApiInterface.h"
+
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Windows::WinApiInterface;
+
+namespace UKControllerPluginUtils::Api {
+
+    ApiResponseCache::ApiResponseCache() = default;
+
+    ApiResponseCache::ApiResponseCache(WinApiInterface& windows, std::wstring cacheFile)
+        : ApiResponseCache(windows, std::move(cacheFile), defaultWriteDelay, AsyncAt)
+    {
+    }
+
+    ApiResponseCache::ApiResponseCache(
+        WinApiInterface& windows,
+        std::wstring cacheFile,
+        std::chrono::milliseconds writeDelay,
+        std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+            runInBackgroundAt)
+        : writeDelay(writeDelay), runInBackgroundAt(std::move(runInBackgroundAt)), windows(&windows),
+          cacheFile(std::move(cacheFile))
+    {
+        this->Load();
+    }
+
+    /*
+        Make sure nothing is lost when the plugin unloads, and stop any waiting write from touching us.
+    */
+    ApiResponseCache::~ApiResponseCache()
+    {
+        std::lock_guard writeLock(this->state->writeMutex);
+        this->Save();
+
+        std::lock_guard lock(this->state->mutex);
+        this->state->closed = true;
+    }
+
+    void ApiResponseCache::AddValidators(CurlRequest& request) const
+    {
+        std::lock_guard lock(this->responseLock);
+        const auto cached = this->responses.find(request.GetUri());
+        if (cached == this->responses.cend()) {
+            return;
+        }
+
+        if (!cached->second.etag.empty()) {
+            request.AddHeader("If-None-Match", cached->second.etag);
+        }
+
+        if (!cached->second.lastModified.empty()) {
+            request.AddHeader("If-Modified-Since", cached->second.lastModified);
+        }
+    }
+
+    auto ApiResponseCache::Body(const std::string& uri) const -> nlohmann::json
+    {
+        std::lock_guard lock(this->responseLock);
+        const auto cached = this->responses.find(uri);
+        return cached == this->responses.cend() ? nlohmann::json() : cached->second.body;
+    }
+
+    auto ApiResponseCache::Count() const -> size_t
+    {
+        std::lock_guard lock(this->responseLock);
+        return this->responses.size();
+    }
+
+    void ApiResponseCache::Flush()
+    {
+        std::lock_guard writeLock(this->state->writeMutex);
+        this->Save();
+    }
+
+    auto ApiResponseCache::Has(const std::string& uri) const -> bool
+    {
+        std::lock_guard lock(this->responseLock);
+        return this->responses.count(uri) != 0;
+    }
+
+    /*
+        Store a response. If it has no validators, we can't make a conditional request for it,
+        so there's no point keeping it around.
+    */
+    void ApiResponseCache::Store(const std::string& uri, const CurlResponse& response, nlohmann::json body)
+    {
+        auto etag = response.GetHeader("ETag");
+        auto lastModified = response.GetHeader("Last-Modified");
+
+        {
+            std::lock_guard lock(this->responseLock);
+            if (etag.empty() && lastModified.empty()) {
+                if (this->responses.erase(uri) == 0) {
+                    return;
+                }
+            } else {
+                this->responses[uri] = {std::move(etag), std::move(lastModified), std::move(body)};
+            }
+
+            this->state->generation++;
+        }
+
+        this->ScheduleSave();
+    }
+
+    /*
+        Schedule a write for the end of the write delay, unless one is already waiting, in which case it'll
+        pick up this change too.
+    */
+    void ApiResponseCache::ScheduleSave()
+    {
+        if (this->windows == nullptr) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(this->state->mutex);
+            if (this->state->writeScheduled) {
+                return;
+            }
+
+            this->state->writeScheduled = true;
+        }
+
+        this->runInBackgroundAt(std::chrono::steady_clock::now() + this->writeDelay, [this, state = this->state]() {
+            std::lock_guard writeLock(state->writeMutex);
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->closed) {
+                    return;
+                }
+
+                state->writeScheduled = false;
+            }
+
+            this->Save();
+        });
+    }
+
+    void ApiResponseCache::Load()
+    {
+        if (!this->windows->FileExists(this->cacheFile)) {
+            return;
+        }
+
+        nlohmann::json cache;
+        try {
+            cache = nlohmann::json::parse(this->windows->ReadFromFile(this->cacheFile));
+        } catch (nlohmann::json::exception&) {
+            LogWarning("API response cache file is not valid JSON, starting with an empty cache");
+            return;
+        }
+
+        if (!cache.is_object()) {
+            LogWarning("API response cache file is not an object, starting with an empty cache");
+            return;
+        }
+
+        for (const auto& [uri, response] : cache.items()) {
+            if (!response.is_object() || !response.contains("etag") || !response.at("etag").is_string() ||
+                !response.contains("last_modified") || !response.at("last_modified").is_string() ||
+                !response.contains("body")) {
+                LogWarning("Invalid API response cache entry for " + uri);
+                continue;
+            }
+
+            this->responses[uri] = {
+                response.at("etag").get<std::string>(),
+                response.at("last_modified").get<std::string>(),
+                response.at("body")};
+        }
+
+        LogInfo("Loaded " + std::to_string(this->responses.size()) + " cached API responses");
+    }
+
+    /*
+        Writes a snapshot of the cache to a temporary file and moves it into place, if anything has changed since
+        the last write. The response lock is only held to take the snapshot, so requests carry on while the disk is
+        busy. Must be called with the write lock held.
+    */
+    void ApiResponseCache::Save()
+    {
+        if (this->windows == nullptr) {
+            return;
+        }
+
+        auto cache = nlohmann::json::object();
+        uint64_t generation = 0;
+        {
+            std::lock_guard lock(this->responseLock);
+            if (this->state->writtenGeneration == this->state->generation) {
+                return;
+            }
+
+            for (const auto& [uri, response] : this->responses) {
+                cache[uri] = {
+                    {"etag", response.etag}, {"last_modified", response.lastModified}, {"body", response.body}};
+            }
+            generation = this->state->generation;
+        }
+
+        const auto temporaryFile = this->cacheFile + L".tmp";
+        if (!this->windows->TryWriteToFile(temporaryFile, cache.dump(), true, false) ||
+            !this->windows->MoveFileToNewLocation(temporaryFile, this->cacheFile)) {
+            LogWarning("Unable to write the API response cache file");
+            return;
+        }
+
+        std::lock_guard lock(this->responseLock);
+        this->state->writtenGeneration = generation;
+    }
+} // namespace UKControllerPluginUtils::Api
@@ -0,0 +1,110 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Curl {
+        class CurlRequest;
+        class CurlResponse;
+    } // namespace Curl
+    namespace Windows {
+        class WinApiInterface;
+    } // namespace Windows
+} // namespace UKControllerPlugin
+
+namespace UKControllerPluginUtils::Api {
+
+    /**
+     * Caches the parsed bodies of GET responses, along with the validators (ETag and Last-Modified)
+     * that came with them. The validators are sent on the next request for the same URI so that
+     * if nothing has changed, the server can respond 304 and we can use what we parsed last time.
+     *
+     * Can optionally be backed by a file on disk, so the cache is still warm after a restart. The file is written
+     * behind, in the same way as the JSON setting files: changes within the write delay are coalesced into one
+     * background write of a snapshot, which goes to a temporary file that is then moved into place.
+     */
+    class ApiResponseCache
+    {
+        public:
+        ApiResponseCache();
+        ApiResponseCache(UKControllerPlugin::Windows::WinApiInterface& windows, std::wstring cacheFile);
+        ApiResponseCache(
+            UKControllerPlugin::Windows::WinApiInterface& windows,
+            std::wstring cacheFile,
+            std::chrono::milliseconds writeDelay,
+            std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+                runInBackgroundAt);
+        ~ApiResponseCache();
+        ApiResponseCache(const ApiResponseCache&) = delete;
+        ApiResponseCache(ApiResponseCache&&) = delete;
+        auto operator=(const ApiResponseCache&) -> ApiResponseCache& = delete;
+        auto operator=(ApiResponseCache&&) -> ApiResponseCache& = delete;
+        void AddValidators(UKControllerPlugin::Curl::CurlRequest& request) const;
+        [[nodiscard]] auto Body(const std::string& uri) const -> nlohmann::json;
+        [[nodiscard]] auto Count() const -> size_t;
+        void Flush();
+        [[nodiscard]] auto Has(const std::string& uri) const -> bool;
+        void Store(const std::string& uri, const UKControllerPlugin::Curl::CurlResponse& response, nlohmann::json body);
+
+        // How long to wait for further responses before writing the cache
+        inline static const std::chrono::milliseconds defaultWriteDelay{5000};
+
+        private:
+        struct CachedResponse
+        {
+            // The ETag header, if one was sent
+            std::string etag;
+
+            // The Last-Modified header, if one was sent
+            std::string lastModified;
+
+            // The parsed body of the response
+            nlohmann::json body;
+        };
+
+        using WriteBehindState = struct WriteBehindState
+        {
+            // Guards whether a write is scheduled and whether the cache has gone
+            std::mutex mutex;
+
+            // Held for the whole of a write, so writes happen one at a time and in order
+            std::mutex writeMutex;
+
+            // Bumped on every change to the cache, guarded by the response lock
+            uint64_t generation = 0;
+
+            // The generation last written to disk, anything newer still needs writing
+            uint64_t writtenGeneration = 0;
+
+            // Whether a background write is waiting to happen
+            bool writeScheduled = false;
+
+            // Whether the cache has gone, so background writes must not touch it
+            bool closed = false;
+        };
+
+        void Load();
+        void ScheduleSave();
+        void Save();
+
+        // Protects the cache, requests are made on many threads
+        mutable std::mutex responseLock;
+
+        // The cached responses, by URI
+        std::map<std::string, CachedResponse> responses;
+
+        // How long to wait for further responses before writing the cache
+        const std::chrono::milliseconds writeDelay = defaultWriteDelay;
+
+        // Runs the write behind task once it is due
+        const std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+            runInBackgroundAt;
+
+        // State shared with the write behind task, which may outlive the cache
+        std::shared_ptr<WriteBehindState> state = std::make_shared<WriteBehindState>();
+
+        // For reading and writing the cache file, if there is one
+        UKControllerPlugin::Windows::WinApiInterface* windows = nullptr;
+
+        // The cache file, relative to the plugin folder
+        std::wstring cacheFile;
+    };
+} // namespace UKControllerPluginUtils::Api
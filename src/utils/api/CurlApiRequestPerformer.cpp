@@ -1,4 +1,5 @@
 #include "ApiCurlRequestFactory.h"
+#include "ApiHealthTracker.h"
 #include "ApiRequestData.h"
 #include "ApiRequestException.h"
 #include "CurlApiRequestPerformer.h"
@@ -13,8 +14,9 @@ using UKControllerPluginUtils::Http::IsSuccessful;
 
 namespace UKControllerPluginUtils::Api {
 
-    CurlApiRequestPerformer::CurlApiRequestPerformer(CurlInterface& curl, const ApiCurlRequestFactory& requestFactory)
-        : curl(curl), requestFactory(requestFactory)
+    CurlApiRequestPerformer::CurlApiRequestPerformer(
+        CurlInterface& curl, const ApiCurlRequestFactory& requestFactory, std::shared_ptr<ApiHealthTracker> healthTracker)
+        : curl(curl), requestFactory(requestFactory), healthTracker(std::move(healthTracker))
     {
     }
 
@@ -25,7 +27,14 @@ namespace UKControllerPluginUtils::Api {
             "CurlApiRequestPerformer: Performing cURL request with method " + std::string(data.Method()) + " to " +
             data.Uri() + " with body " + data.Body().dump());
 
+        if (healthTracker && !healthTracker->AllowRequest(data.Uri())) {
+            LogDebug("CurlApiRequestPerformer: API unavailable, not calling " + data.Uri());
+            throw ApiRequestException(data.Uri(), HttpStatusCode::Unknown, false);
+        }
+
+        const auto started = std::chrono::steady_clock::now();
         auto curlResponse = curl.MakeCurlRequest(requestFactory.BuildCurlRequest(data));
+        RecordHealth(data.Uri(), curlResponse, started);
         if (!ResponseSuccessful(curlResponse)) {
             LogDebug(
                 "CurlApiRequestPerformer: Failed cURL request, status was: " +
@@ -36,6 +45,22 @@ namespace UKControllerPluginUtils::Api {
         return {static_cast<HttpStatusCode>(curlResponse.GetStatusCode()), ParseResponseBody(data, curlResponse)};
     }
 
+    void CurlApiRequestPerformer::RecordHealth(
+        const std::string& uri, const CurlResponse& response, std::chrono::steady_clock::time_point started) const
+    {
+        if (!healthTracker) {
+            return;
+        }
+
+        const auto latency =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+        if (response.IsCurlError() || response.GetStatusCode() >= static_cast<uint64_t>(HttpStatusCode::ServerError)) {
+            healthTracker->RecordFailure(uri, latency);
+        } else {
+            healthTracker->RecordSuccess(uri, latency);
+        }
+    }
+
     auto CurlApiRequestPerformer::ResponseSuccessful(const CurlResponse& response) -> bool
     {
         return !response.IsCurlError() && IsSuccessful(static_cast<HttpStatusCode>(response.GetStatusCode()));
@@ -8,6 +8,7 @@ namespace UKControllerPlugin::Curl {
 
 namespace UKControllerPluginUtils::Api {
     class ApiCurlRequestFactory;
+    class ApiHealthTracker;
 
     /**
      * Performs API requests.
@@ -16,10 +17,16 @@ namespace UKControllerPluginUtils::Api {
     {
         public:
         CurlApiRequestPerformer(
-            UKControllerPlugin::Curl::CurlInterface& curl, const ApiCurlRequestFactory& requestFactory);
+            UKControllerPlugin::Curl::CurlInterface& curl,
+            const ApiCurlRequestFactory& requestFactory,
+            std::shared_ptr<ApiHealthTracker> healthTracker = nullptr);
         auto Perform(const ApiRequestData& data) -> Response override;
 
         private:
+        void RecordHealth(
+            const std::string& uri,
+            const UKControllerPlugin::Curl::CurlResponse& response,
+            std::chrono::steady_clock::time_point started) const;
         [[nodiscard]] static auto ResponseSuccessful(const UKControllerPlugin::Curl::CurlResponse& response) -> bool;
         [[nodiscard]] static auto
         ParseResponseBody(const ApiRequestData& data, const UKControllerPlugin::Curl::CurlResponse& response)
@@ -30,5 +37,8 @@ namespace UKControllerPluginUtils::Api {
 
         // Settings for the API
         const ApiCurlRequestFactory& requestFactory;
+
+        // Tracks how the API is responding, so we can stop calling it whilst it's down
+        std::shared_ptr<ApiHealthTracker> healthTracker;
     };
 } // namespace UKControllerPluginUtils::Api
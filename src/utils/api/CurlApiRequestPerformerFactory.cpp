@@ -9,8 +9,9 @@ using UKControllerPlugin::Curl::CurlInterface;
 
 namespace UKControllerPluginUtils::Api {
 
-    CurlApiRequestPerformerFactory::CurlApiRequestPerformerFactory(std::unique_ptr<CurlInterface> curl)
-        : curl(std::move(curl))
+    CurlApiRequestPerformerFactory::CurlApiRequestPerformerFactory(
+        std::unique_ptr<CurlInterface> curl, std::shared_ptr<ApiHealthTracker> healthTracker)
+        : curl(std::move(curl)), healthTracker(std::move(healthTracker))
     {
     }
 
@@ -22,7 +23,7 @@ namespace UKControllerPluginUtils::Api {
             urlBuilder = std::make_unique<ApiUrlBuilder>(apiSettings);
             headerApplicator = std::make_unique<ApiHeaderApplicator>(apiSettings);
             curlRequestFactory = std::make_unique<ApiCurlRequestFactory>(*urlBuilder, *headerApplicator);
-            performer = std::make_unique<CurlApiRequestPerformer>(*curl, *curlRequestFactory);
+            performer = std::make_unique<CurlApiRequestPerformer>(*curl, *curlRequestFactory, healthTracker);
         }
 
         return *performer;
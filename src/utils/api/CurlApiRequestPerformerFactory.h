@@ -7,6 +7,7 @@ namespace UKControllerPlugin::Curl {
 
 namespace UKControllerPluginUtils::Api {
     class ApiCurlRequestFactory;
+    class ApiHealthTracker;
     class ApiHeaderApplicator;
     class ApiUrlBuilder;
 
@@ -16,7 +17,9 @@ namespace UKControllerPluginUtils::Api {
     class CurlApiRequestPerformerFactory : public AbstractApiRequestPerformerFactory
     {
         public:
-        CurlApiRequestPerformerFactory(std::unique_ptr<UKControllerPlugin::Curl::CurlInterface> curl);
+        CurlApiRequestPerformerFactory(
+            std::unique_ptr<UKControllerPlugin::Curl::CurlInterface> curl,
+            std::shared_ptr<ApiHealthTracker> healthTracker = nullptr);
         ~CurlApiRequestPerformerFactory();
         [[nodiscard]] auto Make(const ApiSettings& apiSettings) -> ApiRequestPerformerInterface& override;
 
@@ -24,6 +27,9 @@ namespace UKControllerPluginUtils::Api {
         // For cURL requests
         std::unique_ptr<UKControllerPlugin::Curl::CurlInterface> curl;
 
+        // Tracks how the API is responding
+        std::shared_ptr<ApiHealthTracker> healthTracker;
+
         // Applies headers
         std::unique_ptr<ApiHeaderApplicator> headerApplicator;
 
@@ -7,6 +7,17 @@ using UKControllerPlugin::Curl::CurlResponse;
 
 namespace UKControllerPlugin::Curl {
 
+    namespace {
+        // What the streaming callbacks need to know about the transfer in progress
+        struct StreamState
+        {
+            CURL* handle;
+            const CurlInterface::StreamCallback& onData;
+            bool cancelled = false;
+            bool receivedData = false;
+        };
+    } // namespace
+
     CurlApi::CurlApi() : userAgent("UK Controller Plugin/" + std::string(Plugin::PluginVersion::version))
     {
     }
@@ -51,6 +62,12 @@ namespace UKControllerPlugin::Curl {
             curlObject,
             CURLOPT_WRITEFUNCTION,
             &CurlApi::WriteFunction);
+        std::map<std::string, std::string> responseHeaders;
+        curl_easy_setopt(curlObject, CURLOPT_HEADERDATA, &responseHeaders); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(                                                   // NOLINT(cppcoreguidelines-pro-type-vararg)
+            curlObject,
+            CURLOPT_HEADERFUNCTION,
+            &CurlApi::HeaderFunction);
         curl_easy_setopt(curlObject, CURLOPT_USERAGENT, userAgent.c_str()); // NOLINT(cppcoreguidelines-pro-type-vararg)
 
         CURLcode result = curl_easy_perform(curlObject);
@@ -69,7 +86,128 @@ namespace UKControllerPlugin::Curl {
             &responseCode);
         curl_easy_cleanup(curlObject);
 
-        return {outBuffer, false, responseCode};
+        CurlResponse response(outBuffer, false, responseCode);
+        for (const auto& [name, value] : responseHeaders) {
+            response.AddHeader(name, value);
+        }
+
+        return response;
+    }
+
+    /*
+        Performs a CURL request, passing the response body to the callback as each chunk arrives.
+        The callback may return false to close the connection, which is not treated as an error.
+
+        Streams are recycled by giving the request a maximum time, so hitting that once the stream is
+        up and running is a normal close rather than an error.
+    */
+    auto CurlApi::MakeStreamingCurlRequest(const CurlRequest& request, const StreamCallback& onData) -> CurlResponse
+    {
+        struct curl_slist* curlHeaders = nullptr;
+        CURL* curlObject = curl_easy_init();
+        curl_easy_setopt(curlObject, CURLOPT_URL, request.GetUri()); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(                                            // NOLINT(cppcoreguidelines-pro-type-vararg)
+            curlObject,
+            CURLOPT_CUSTOMREQUEST,
+            request.GetMethod());
+
+        for (auto it = request.cbegin(); it != request.cend(); ++it) {
+            curlHeaders = curl_slist_append(curlHeaders, std::string(it->first + ": " + it->second).c_str());
+        }
+        curl_easy_setopt(curlObject, CURLOPT_HTTPHEADER, curlHeaders); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+        StreamState state{curlObject, onData};
+        curl_easy_setopt(curlObject, CURLOPT_FOLLOWLOCATION, 1L); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(curlObject, CURLOPT_CONNECTTIMEOUT, 4);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(                                         // NOLINT(cppcoreguidelines-pro-type-vararg)
+            curlObject,
+            CURLOPT_TIMEOUT,
+            request.GetMaxRequestTime());
+        curl_easy_setopt(curlObject, CURLOPT_WRITEDATA, &state); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(                                        // NOLINT(cppcoreguidelines-pro-type-vararg)
+            curlObject,
+            CURLOPT_WRITEFUNCTION,
+            &CurlApi::StreamWriteFunction);
+        curl_easy_setopt(curlObject, CURLOPT_NOPROGRESS, 0L);       // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(curlObject, CURLOPT_XFERINFODATA, &state); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        curl_easy_setopt(                                           // NOLINT(cppcoreguidelines-pro-type-vararg)
+            curlObject,
+            CURLOPT_XFERINFOFUNCTION,
+            &CurlApi::StreamProgressFunction);
+        curl_easy_setopt(curlObject, CURLOPT_USERAGENT, userAgent.c_str()); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+        CURLcode result = curl_easy_perform(curlObject);
+        uint64_t responseCode = 0;
+        curl_easy_getinfo( // NOLINT(cppcoreguidelines-pro-type-vararg)
+            curlObject,
+            CURLINFO_RESPONSE_CODE,
+            &responseCode);
+        curl_slist_free_all(curlHeaders);
+        curl_easy_cleanup(curlObject);
+
+        if (!StreamClosedNormally(result, state.cancelled, state.receivedData, responseCode)) {
+            LogError("cURL Error (" + std::to_string(result) + ")");
+            return {"", true, 0};
+        }
+
+        return {"", false, responseCode};
+    }
+
+    /*
+        Called by Curl as each chunk of a streamed response arrives. Error responses aren't part of
+        the stream, so their bodies are discarded.
+    */
+    auto CurlApi::StreamWriteFunction(void* contents, size_t size, size_t nmemb, void* stream) -> size_t
+    {
+        auto* state = static_cast<StreamState*>(stream);
+        uint64_t responseCode = 0;
+        curl_easy_getinfo( // NOLINT(cppcoreguidelines-pro-type-vararg)
+            state->handle,
+            CURLINFO_RESPONSE_CODE,
+            &responseCode);
+
+        if (responseCode < 200 || responseCode > 299) {
+            return size * nmemb;
+        }
+
+        state->receivedData = true;
+        if (!state->onData(std::string(static_cast<char*>(contents), size * nmemb))) {
+            state->cancelled = true;
+            return 0;
+        }
+
+        return size * nmemb;
+    }
+
+    /*
+        Called by Curl around once a second whilst the connection is open, even if nothing arrives. Gives the
+        callback an empty chunk, so that it can stop the stream (e.g. on shutdown) without waiting for data.
+        Idle streams are closed by the request's maximum time, not here.
+    */
+    auto CurlApi::StreamProgressFunction(
+        void* stream, int64_t /*dltotal*/, int64_t /*dlnow*/, int64_t /*ultotal*/, int64_t /*ulnow*/) -> int
+    {
+        auto* state = static_cast<StreamState*>(stream);
+        if (!state->onData("")) {
+            state->cancelled = true;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /*
+        Whether a stream ended the way we expect one to: the server closed it, the callback asked to stop, or it
+        reached its maximum time after a successful response had started arriving.
+    */
+    auto CurlApi::StreamClosedNormally(CURLcode result, bool cancelled, bool receivedData, uint64_t responseCode)
+        -> bool
+    {
+        if (result == CURLE_OK || cancelled) {
+            return true;
+        }
+
+        return result == CURLE_OPERATION_TIMEDOUT && receivedData && responseCode >= 200 && responseCode <= 299;
     }
 
     /*
@@ -82,4 +220,30 @@ namespace UKControllerPlugin::Curl {
         ((std::string*)outString)->append(reinterpret_cast<char*>(contents), size * nmemb); // NOLINT
         return size * nmemb;
     }
+
+    /*
+        Called by Curl once for each response header line. We keep the name and value of each
+        header, stripped of whitespace. If we're redirected, later headers replace earlier ones.
+    */
+    auto CurlApi::HeaderFunction(char* buffer, size_t size, size_t nitems, void* headers) -> size_t
+    {
+        const std::string line(buffer, size * nitems);
+        const auto separator = line.find(':');
+        if (separator == std::string::npos) {
+            return size * nitems;
+        }
+
+        const auto trim = [](const std::string& value) -> std::string {
+            const auto first = value.find_first_not_of(" \t\r\n");
+            if (first == std::string::npos) {
+                return "";
+            }
+
+            return value.substr(first, value.find_last_not_of(" \t\r\n") - first + 1);
+        };
+
+        (*static_cast<std::map<std::string, std::string>*>(headers))[trim(line.substr(0, separator))] =
+            trim(line.substr(separator + 1));
+        return size * nitems;
+    }
 } // namespace UKControllerPlugin::Curl
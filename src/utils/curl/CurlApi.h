@@ -11,9 +11,18 @@ namespace UKControllerPlugin::Curl {
         CurlApi();
         UKControllerPlugin::Curl::CurlResponse
         MakeCurlRequest(const UKControllerPlugin::Curl::CurlRequest& request) override;
+        auto MakeStreamingCurlRequest(
+            const UKControllerPlugin::Curl::CurlRequest& request, const StreamCallback& onData)
+            -> UKControllerPlugin::Curl::CurlResponse override;
+        [[nodiscard]] static auto
+        StreamClosedNormally(CURLcode result, bool cancelled, bool receivedData, uint64_t responseCode) -> bool;
 
         private:
+        static auto StreamWriteFunction(void* contents, size_t size, size_t nmemb, void* stream) -> size_t;
+        static auto StreamProgressFunction(void* stream, int64_t dltotal, int64_t dlnow, int64_t ultotal, int64_t ulnow)
+            -> int;
         static auto WriteFunction(void* ptr, size_t size, size_t nmemb, void* notused) -> size_t;
+        static auto HeaderFunction(char* buffer, size_t size, size_t nitems, void* headers) -> size_t;
         const std::string userAgent;
     };
 } // namespace UKControllerPlugin::Curl
@@ -5,4 +5,21 @@ namespace UKControllerPlugin::Curl {
     CurlInterface::~CurlInterface() = default;
     CurlInterface::CurlInterface(const CurlInterface&) = default;
     [[nodiscard]] auto CurlInterface::operator=(const CurlInterface&) -> CurlInterface& = default;
+
+    /*
+        Makes a request whose response body is delivered in chunks as it arrives, rather than all at the end.
+        The returned response carries the status code, but not the body.
+
+        By default, a successful response is delivered as one chunk once the request completes.
+    */
+    auto CurlInterface::MakeStreamingCurlRequest(const CurlRequest& request, const StreamCallback& onData)
+        -> CurlResponse
+    {
+        CurlResponse response = this->MakeCurlRequest(request);
+        if (!response.IsCurlError() && response.StatusOk()) {
+            onData(response.GetResponse());
+        }
+
+        return {"", response.IsCurlError(), response.GetStatusCode()};
+    }
 } // namespace UKControllerPlugin::Curl
@@ -10,6 +10,9 @@ namespace UKControllerPlugin::Curl {
     class CurlInterface
     {
         public:
+        // Receives each chunk of a streamed response, return false to stop streaming
+        using StreamCallback = std::function<bool(const std::string&)>;
+
         CurlInterface();
         virtual ~CurlInterface();
         CurlInterface(const CurlInterface&);
@@ -18,5 +21,8 @@ namespace UKControllerPlugin::Curl {
         [[nodiscard]] auto operator=(CurlInterface&&) noexcept -> CurlInterface& = delete;
         virtual auto MakeCurlRequest(const UKControllerPlugin::Curl::CurlRequest& request)
             -> UKControllerPlugin::Curl::CurlResponse = 0;
+        virtual auto MakeStreamingCurlRequest(
+            const UKControllerPlugin::Curl::CurlRequest& request, const StreamCallback& onData)
+            -> UKControllerPlugin::Curl::CurlResponse;
     };
 } // namespace UKControllerPlugin::Curl
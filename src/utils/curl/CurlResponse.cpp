@@ -1,5 +1,13 @@
 #include "curl/CurlResponse.h"
 
+namespace {
+    auto HeaderKey(std::string name) -> std::string
+    {
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+        return name;
+    }
+} // namespace
+
 namespace UKControllerPlugin {
     namespace Curl {
 
@@ -10,6 +18,23 @@ namespace UKControllerPlugin {
             this->curlError = curlError;
         }
 
+        /*
+            Adds a response header, header names are case-insensitive.
+        */
+        void CurlResponse::AddHeader(const std::string& name, std::string value)
+        {
+            this->headers[HeaderKey(name)] = std::move(value);
+        }
+
+        /*
+            Returns the value of a response header, or an empty string if it wasn't sent.
+        */
+        std::string CurlResponse::GetHeader(const std::string& name) const
+        {
+            const auto header = this->headers.find(HeaderKey(name));
+            return header == this->headers.cend() ? "" : header->second;
+        }
+
         /*
             Returns the response.
         */
@@ -11,6 +11,8 @@ namespace UKControllerPlugin {
 
             public:
             CurlResponse(std::string response, bool curlError, uint64_t statusCode);
+            void AddHeader(const std::string& name, std::string value);
+            std::string GetHeader(const std::string& name) const;
             std::string GetResponse(void) const;
             uint64_t GetStatusCode(void) const;
             bool IsCurlError(void) const;
@@ -26,6 +28,9 @@ namespace UKControllerPlugin {
             // Whether or not there was an error in cURL.
             bool curlError;
 
+            // Response headers, keyed by lowercase name
+            std::map<std::string, std::string> headers;
+
             // Ok
             const uint64_t okStatus = 200;
 
@@ -0,0 +1,47 @@
+#pragma once
+#include "EventHandler.h"
+#include <span>
+
+namespace UKControllerPluginUtils::EventHandler {
+
+    /**
+     * An event handler that, when registered as asynchronous, receives its events in batches
+     * rather than having a task queued for every individual event. Events are delivered in the order
+     * they were raised, and a batch is handed over once it is full or once the deadline has passed.
+     */
+    template <class T> class BatchedEventHandler : public EventHandler<T>
+    {
+        public:
+        /**
+         * Process a batch of events.
+         */
+        virtual void OnEvents(std::span<const T> events) = 0;
+
+        /**
+         * Events that aren't delivered via a batch are treated as a batch of one.
+         */
+        void OnEvent(const T& event) override
+        {
+            OnEvents(std::span<const T>(&event, 1));
+        }
+
+        /**
+         * The most events that will be delivered in a single batch.
+         */
+        [[nodiscard]] virtual auto MaxBatchSize() const -> size_t
+        {
+            return defaultMaxBatchSize;
+        }
+
+        /**
+         * How long to wait for a batch to fill before delivering it anyway.
+         */
+        [[nodiscard]] virtual auto BatchDeadline() const -> std::chrono::milliseconds
+        {
+            return defaultBatchDeadline;
+        }
+
+        inline static const size_t defaultMaxBatchSize = 250;
+        inline static const std::chrono::milliseconds defaultBatchDeadline{25};
+    };
+} // namespace UKControllerPluginUtils::EventHandler
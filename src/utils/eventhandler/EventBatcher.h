@@ -0,0 +1,49 @@
+#pragma once
+
+namespace UKControllerPluginUtils::EventHandler {
+    template <class T> class BatchedEventHandler;
+
+    /**
+     * Collects the events for a single batched handler and delivers them in batches on a background task.
+     *
+     * Rather than having a task wait for the batch to fill, a flush is scheduled for the batch deadline, or
+     * straight away once the batch is full, and it finishes as soon as it has delivered. Batches are delivered
+     * one at a time and in the order the events were raised. Any events still waiting when the batcher is
+     * destroyed are delivered on the destroying thread, so nothing is lost on shutdown.
+     */
+    template <typename T> class EventBatcher
+    {
+        public:
+        EventBatcher(
+            std::shared_ptr<BatchedEventHandler<T>> handler,
+            std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+                runInBackgroundAt);
+        ~EventBatcher();
+        EventBatcher(const EventBatcher&) = delete;
+        EventBatcher(EventBatcher&&) noexcept = delete;
+        auto operator=(const EventBatcher&) -> EventBatcher& = delete;
+        auto operator=(EventBatcher&&) noexcept -> EventBatcher& = delete;
+
+        /**
+         * Add an event to the batch, scheduling a flush if there isn't one due soon enough.
+         */
+        void Add(const T& event);
+
+        /**
+         * Deliver all waiting events on the calling thread.
+         */
+        void Flush();
+
+        private:
+        struct BatchState;
+
+        // Shared with the scheduled flushes, which may outlive us
+        std::shared_ptr<BatchState> state;
+
+        // Schedules a flush to run in the background at a given time
+        std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)> runInBackgroundAt;
+    };
+} // namespace UKControllerPluginUtils::EventHandler
+
+// Include the implementation of template methods
+#include "EventBatcher.tpp"
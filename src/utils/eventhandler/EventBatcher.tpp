@@ -0,0 +1,144 @@
+#include "BatchedEventHandler.h"
+#include "log/LoggerFunctions.h"
+
+namespace UKControllerPluginUtils::EventHandler {
+
+    template <typename T> struct EventBatcher<T>::BatchState
+    {
+        BatchState(std::shared_ptr<BatchedEventHandler<T>> handler)
+            : handler(std::move(handler)), maxBatchSize(std::max<size_t>(this->handler->MaxBatchSize(), 1)),
+              deadline(this->handler->BatchDeadline())
+        {
+        }
+
+        /**
+         * Deliver the next batch of waiting events, returning false if there was nothing to deliver.
+         *
+         * The batch is taken whilst holding the delivery lock, so that batches can't overtake each other.
+         */
+        auto DeliverNextBatch() -> bool
+        {
+            std::lock_guard deliveryGuard(deliveryLock);
+            std::vector<T> batch;
+            {
+                std::lock_guard stateGuard(stateLock);
+                const auto batchSize = std::min(pending.size(), maxBatchSize);
+                batch.reserve(batchSize);
+                std::move(pending.begin(), pending.begin() + batchSize, std::back_inserter(batch));
+                pending.erase(pending.begin(), pending.begin() + batchSize);
+            }
+
+            if (batch.empty()) {
+                return false;
+            }
+
+            try {
+                handler->OnEvents(std::span<const T>(batch));
+            } catch (const std::exception& e) {
+                LogFatalExceptionAndRethrow(
+                    "EventBatcher::DeliverNextBatch::" + std::string(typeid(T).name()),
+                    typeid(*handler).name(),
+                    e);
+            }
+
+            return true;
+        }
+
+        /**
+         * Runs when a scheduled flush is due. Delivers the events that were waiting at the time and then
+         * finishes, anything added afterwards schedules its own flush.
+         *
+         * An earlier flush may have replaced this one, in which case this one only delivers what's left.
+         */
+        static void Flush(const std::shared_ptr<BatchState>& state, std::chrono::steady_clock::time_point due)
+        {
+            size_t toDeliver = 0;
+            {
+                std::lock_guard lock(state->stateLock);
+                if (state->nextFlush == due) {
+                    state->nextFlush.reset();
+                }
+                toDeliver = state->pending.size();
+            }
+
+            for (size_t delivered = 0; delivered < toDeliver; delivered += state->maxBatchSize) {
+                if (!state->DeliverNextBatch()) {
+                    return;
+                }
+            }
+        }
+
+        // The handler to deliver to
+        const std::shared_ptr<BatchedEventHandler<T>> handler;
+
+        // The most events in a batch
+        const size_t maxBatchSize;
+
+        // How long to wait for a batch to fill
+        const std::chrono::milliseconds deadline;
+
+        // Protects the pending events and the next flush
+        std::mutex stateLock;
+
+        // Held whilst a batch is taken and delivered, so batches are delivered in order
+        std::mutex deliveryLock;
+
+        // Events waiting to be delivered
+        std::deque<T> pending;
+
+        // When the next scheduled flush is due, if there is one that hasn't started yet
+        std::optional<std::chrono::steady_clock::time_point> nextFlush;
+    };
+
+    template <typename T>
+    EventBatcher<T>::EventBatcher(
+        std::shared_ptr<BatchedEventHandler<T>> handler,
+        std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)> runInBackgroundAt)
+        : state(std::make_shared<BatchState>(std::move(handler))), runInBackgroundAt(std::move(runInBackgroundAt))
+    {
+    }
+
+    template <typename T> EventBatcher<T>::~EventBatcher()
+    {
+        // Throwing out of a destructor is fatal, so a batch that fails is logged and the rest are still delivered
+        while (true) {
+            try {
+                if (!state->DeliverNextBatch()) {
+                    return;
+                }
+            } catch (...) {
+                LogError("Batch of " + std::string(typeid(T).name()) + " events failed whilst destroying EventBatcher");
+            }
+        }
+    }
+
+    template <typename T> void EventBatcher<T>::Add(const T& event)
+    {
+        std::optional<std::chrono::steady_clock::time_point> scheduleAt;
+        {
+            std::lock_guard lock(state->stateLock);
+            state->pending.push_back(event);
+
+            // A full batch goes now, otherwise it goes at the deadline, unless there's already a flush due sooner
+            const auto now = std::chrono::steady_clock::now();
+            const auto due = state->pending.size() >= state->maxBatchSize ? now : now + state->deadline;
+            if (!state->nextFlush || due < *state->nextFlush) {
+                state->nextFlush = due;
+                scheduleAt = due;
+            }
+        }
+
+        // Scheduled outside of the lock, in case the task is run on this thread
+        if (scheduleAt) {
+            runInBackgroundAt(*scheduleAt, [batchState = state, due = *scheduleAt]() {
+                BatchState::Flush(batchState, due);
+            });
+        }
+    }
+
+    template <typename T> void EventBatcher<T>::Flush()
+    {
+        while (state->DeliverNextBatch()) {
+        }
+    }
+} // namespace UKControllerPluginUtils::EventHandler
@@ -1,5 +1,6 @@
 #include "EventBus.h"
 #include "EventBusFactory.h"
+#include "EventStreamBase.h"
 
 namespace UKControllerPluginUtils::EventHandler {
 
@@ -29,9 +30,4 @@ namespace UKControllerPluginUtils::EventHandler {
 
         return *EventBus::singleton;
     }
-
-    auto EventBus::GetAnyStream(const std::type_index& type) const -> const std::any&
-    {
-        return streams.at(type);
-    }
 } // namespace UKControllerPluginUtils::EventHandler
@@ -1,13 +1,14 @@
 #pragma once
 #include "EventHandlerFlags.h"
 #include "EuroscopeThreadEventSink.h"
-#include <typeindex>
+#include <shared_mutex>
 
 namespace UKControllerPluginUtils::EventHandler {
     template <class T> class EventHandler;
     template <class T> class EventStream;
     class EventObserver;
     class EventBusFactory;
+    class EventStreamBase;
 
     /**
      * Handles events around the plugin
@@ -31,13 +32,14 @@ namespace UKControllerPluginUtils::EventHandler {
         template <typename T> void OnEvent(const T& event);
 
         /**
-         * Get the given stream as a std::any. For test purposes only and should not be called
+         * Get the stream for a given event type. For test purposes only and should not be called
          * anywhere else.
          */
-        [[nodiscard]] auto GetAnyStream(const std::type_index& type) const -> const std::any&;
+        template <typename T> [[nodiscard]] auto GetTestStream() -> std::shared_ptr<EventStream<T>>;
 
         protected:
         template <typename T> [[nodiscard]] auto GetStream() -> EventStream<T>&;
+        template <typename T> [[nodiscard]] auto CreateStream() -> EventStream<T>&;
 
         // This is a singleton
         static std::unique_ptr<EventBus> singleton;
@@ -48,8 +50,11 @@ namespace UKControllerPluginUtils::EventHandler {
         // Euroscope event processor
         std::shared_ptr<EuroscopeThreadEventSink> euroscopeThreadEventProcessor;
 
-        // The event streams
-        std::map<std::type_index, std::any> streams;
+        // The event streams, indexed by EventTypeId
+        std::vector<std::shared_ptr<EventStreamBase>> streams;
+
+        // Protects the stream table, streams may be created whilst events are being dispatched
+        mutable std::shared_mutex streamsLock;
 
         // An observer
         std::shared_ptr<EventObserver> observer = nullptr;
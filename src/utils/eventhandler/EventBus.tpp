@@ -1,5 +1,6 @@
 #include "EventObserver.h"
 #include "EventStream.h"
+#include "EventTypeId.h"
 #include "log/LoggerFunctions.h"
 
 namespace UKControllerPluginUtils::EventHandler {
@@ -9,12 +10,41 @@ namespace UKControllerPluginUtils::EventHandler {
      */
     template <typename T> auto EventBus::GetStream() -> EventStream<T>&
     {
-        const auto index = std::type_index(typeid(T));
-        if (!streams.contains(index)) {
-            streams.insert({index, std::any(std::make_shared<EventStream<T>>(euroscopeThreadEventProcessor))});
+        const auto id = EventTypeId<T>();
+        {
+            std::shared_lock lock(streamsLock);
+            if (id < streams.size() && streams[id]) {
+                return static_cast<EventStream<T>&>(*streams[id]);
+            }
         }
 
-        return *std::any_cast<std::shared_ptr<EventStream<T>>>(streams.at(index));
+        return CreateStream<T>();
+    }
+
+    /**
+     * Create the stream for an event type, growing the stream table if required. Another thread
+     * may have got there first, in which case we use theirs.
+     */
+    template <typename T> auto EventBus::CreateStream() -> EventStream<T>&
+    {
+        const auto id = EventTypeId<T>();
+        std::unique_lock lock(streamsLock);
+        if (id >= streams.size()) {
+            streams.resize(id + 1);
+        }
+
+        if (!streams[id]) {
+            streams[id] = std::make_shared<EventStream<T>>(euroscopeThreadEventProcessor);
+        }
+
+        return static_cast<EventStream<T>&>(*streams[id]);
+    }
+
+    template <typename T> auto EventBus::GetTestStream() -> std::shared_ptr<EventStream<T>>
+    {
+        static_cast<void>(GetStream<T>());
+        std::shared_lock lock(streamsLock);
+        return std::static_pointer_cast<EventStream<T>>(streams[EventTypeId<T>()]);
     }
 
     template <typename T> void EventBus::AddHandler(std::shared_ptr<EventHandler<T>> handler, EventHandlerFlags flags)
@@ -1,17 +1,21 @@
 #pragma once
 #include "EventHandlerFlags.h"
+#include "EventStreamBase.h"
+#include <mutex>
 
 namespace UKControllerPluginUtils::EventHandler {
     class EuroscopeThreadEventSink;
     template <class T> class EventHandler;
+    template <class T> class EventBatcher;
 
-    template <typename T> class EventStream
+    template <typename T> class EventStream : public EventStreamBase
     {
         public:
         EventStream(std::shared_ptr<EuroscopeThreadEventSink> euroscopeThreadEventProcessor);
 
         /**
-         * Adds a handler to the event stream.
+         * Adds a handler to the event stream. Asynchronous handlers that are batched handlers
+         * will have their events delivered in batches.
          */
         void AddHandler(std::shared_ptr<EventHandler<T>> handler, EventHandlerFlags flags);
 
@@ -26,10 +30,17 @@ namespace UKControllerPluginUtils::EventHandler {
             std::shared_ptr<EventHandler<T>> handler;
 
             EventHandlerFlags flags;
+
+            // Collects events for batched asynchronous handlers, null for everything else
+            std::shared_ptr<EventBatcher<T>> batcher = nullptr;
         };
 
-        [[nodiscard]] auto Handlers() const -> const std::vector<HandlerData>&
+        /**
+         * Returns a snapshot of the handlers, which stays valid if more handlers are added.
+         */
+        [[nodiscard]] auto Handlers() const -> std::shared_ptr<const std::vector<HandlerData>>
         {
+            std::lock_guard lock(handlersLock);
             return handlers;
         }
 
@@ -37,8 +48,12 @@ namespace UKControllerPluginUtils::EventHandler {
         // Euroscope event processor
         std::shared_ptr<EuroscopeThreadEventSink> euroscopeThreadEventProcessor;
 
-        // Details about each handler
-        std::vector<HandlerData> handlers;
+        // Details about each handler, replaced wholesale when a handler is added so events can be dispatched
+        // from a snapshot without holding the lock
+        std::shared_ptr<const std::vector<HandlerData>> handlers = std::make_shared<std::vector<HandlerData>>();
+
+        // Protects the handlers
+        mutable std::mutex handlersLock;
     };
 } // namespace UKControllerPluginUtils::EventHandler
 
@@ -1,3 +1,5 @@
+#include "BatchedEventHandler.h"
+#include "EventBatcher.h"
 #include "EventHandler.h"
 #include "eventhandler/EuroscopeThreadEventSink.h"
 #include "log/LoggerFunctions.h"
@@ -14,12 +16,28 @@ namespace UKControllerPluginUtils::EventHandler {
     template <typename T>
     void EventStream<T>::AddHandler(std::shared_ptr<EventHandler<T>> handler, EventHandlerFlags flags)
     {
-        this->handlers.push_back({handler, flags});
+        std::shared_ptr<EventBatcher<T>> batcher = nullptr;
+        if ((flags & EventHandlerFlags::Async) == EventHandlerFlags::Async) {
+            if (const auto batchedHandler = std::dynamic_pointer_cast<BatchedEventHandler<T>>(handler)) {
+                batcher = std::make_shared<EventBatcher<T>>(batchedHandler, AsyncAt);
+            }
+        }
+
+        std::lock_guard lock(handlersLock);
+        auto newHandlers = std::make_shared<std::vector<HandlerData>>(*this->handlers);
+        newHandlers->push_back({handler, flags, batcher});
+        this->handlers = std::move(newHandlers);
     }
 
     template <typename T> void EventStream<T>::OnEvent(const T& event)
     {
-        for (const auto& handler : this->handlers) {
+        std::shared_ptr<const std::vector<HandlerData>> snapshot;
+        {
+            std::lock_guard lock(handlersLock);
+            snapshot = this->handlers;
+        }
+
+        for (const auto& handler : *snapshot) {
             if ((handler.flags & EventHandlerFlags::Sync) == EventHandlerFlags::Sync) {
                 try {
                     handler.handler->OnEvent(event);
@@ -31,6 +49,11 @@ namespace UKControllerPluginUtils::EventHandler {
             }
 
             if ((handler.flags & EventHandlerFlags::Async) == EventHandlerFlags::Async) {
+                if (handler.batcher) {
+                    handler.batcher->Add(event);
+                    continue;
+                }
+
                 Async([event, handler]() {
                     try {
                         handler.handler->OnEvent(event);
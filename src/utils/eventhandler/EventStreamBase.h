@@ -0,0 +1,13 @@
+#pragma once
+
+namespace UKControllerPluginUtils::EventHandler {
+    /*
+     * A non-templated base for event streams, so that streams of different event types
+     * can be stored side-by-side in the EventBus.
+     */
+    class EventStreamBase
+    {
+        public:
+        virtual ~EventStreamBase() = default;
+    };
+} // namespace UKControllerPluginUtils::EventHandler
@@ -0,0 +1,10 @@
+#include "EventTypeId.h"
+
+namespace UKControllerPluginUtils::EventHandler {
+
+    auto NextEventTypeId() -> size_t
+    {
+        static std::atomic<size_t> nextId = 0;
+        return nextId++;
+    }
+} // namespace UKControllerPluginUtils::EventHandler
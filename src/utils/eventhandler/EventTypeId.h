@@ -0,0 +1,20 @@
+#pragma once
+
+namespace UKControllerPluginUtils::EventHandler {
+
+    /*
+     * Returns the next unused event type id. Ids are dense and start at zero, so that they
+     * can be used to index directly into the EventBus stream table.
+     */
+    [[nodiscard]] auto NextEventTypeId() -> size_t;
+
+    /*
+     * Each event type is given a fixed id the first time it is seen, which then stays constant for the
+     * lifetime of the process. This lets the EventBus find the stream for an event without a map lookup.
+     */
+    template <typename T> [[nodiscard]] auto EventTypeId() -> size_t
+    {
+        static const size_t id = NextEventTypeId();
+        return id;
+    }
+} // namespace UKControllerPluginUtils::EventHandler
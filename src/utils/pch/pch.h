@@ -20,16 +20,21 @@
 #pragma warning(pop)
 
 #include <any>
+#include <atomic>
 #include <cstdint>
 #include <CommCtrl.h>
 #include <CommDlg.h>
 #include <codecvt>
+#include <condition_variable>
 #include <deque>
 #include <Mmsystem.h>
 #include <iterator>
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
 #include <playsoundapi.h>
 #include <regex>
 #include <set>
@@ -40,6 +45,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <thread>
 
 // Custom headers
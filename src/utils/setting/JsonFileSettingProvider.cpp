@@ -1,18 +1,45 @@
 #include "JsonFileSettingProvider.h"
 #include "helper/HelperFunctions.h"
+#include "task/RunAsyncTask.h"
 #include "windows/WinApiInterface.h"
 
 namespace UKControllerPlugin::Setting {
 
     JsonFileSettingProvider::JsonFileSettingProvider(
         const std::wstring filename, std::set<std::string> providedSettings, Windows::WinApiInterface& windows)
+        : JsonFileSettingProvider(
+              std::move(filename), std::move(providedSettings), windows, defaultWriteDelay, AsyncAt)
+    {
+    }
+
+    JsonFileSettingProvider::JsonFileSettingProvider(
+        const std::wstring filename,
+        std::set<std::string> providedSettings,
+        Windows::WinApiInterface& windows,
+        std::chrono::milliseconds writeDelay,
+        std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+            runInBackgroundAt)
         : filename(std::move(filename)), providedSettings(std::move(providedSettings)), windows(windows),
-          loadedSettings(LoadFromFile())
+          writeDelay(writeDelay), runInBackgroundAt(std::move(runInBackgroundAt)), loadedSettings(LoadFromFile()),
+          state(std::make_shared<WriteBehindState>())
     {
     }
 
+    /*
+        Make sure nothing is lost when the plugin unloads, and stop any waiting write from touching us.
+    */
+    JsonFileSettingProvider::~JsonFileSettingProvider()
+    {
+        std::lock_guard writeLock(state->writeMutex);
+        WriteSettings();
+
+        std::lock_guard lock(state->mutex);
+        state->closed = true;
+    }
+
     auto JsonFileSettingProvider::Get(const std::string& key) -> std::string
     {
+        std::lock_guard lock(state->mutex);
         if (loadedSettings.count(key) == 0) {
             return "";
         }
@@ -22,8 +49,32 @@ namespace UKControllerPlugin::Setting {
 
     void JsonFileSettingProvider::Save(const std::string& key, const std::string& value)
     {
-        loadedSettings[key] = value;
-        windows.WriteToFile(L"settings/" + filename, nlohmann::json(loadedSettings).dump(), true, false);
+        {
+            std::lock_guard lock(state->mutex);
+            loadedSettings[key] = value;
+            state->generation++;
+
+            // A write is already waiting, it'll pick up this change too
+            if (state->writeScheduled) {
+                return;
+            }
+
+            state->writeScheduled = true;
+        }
+
+        runInBackgroundAt(std::chrono::steady_clock::now() + writeDelay, [this, state = this->state]() {
+            std::lock_guard writeLock(state->writeMutex);
+            {
+                std::lock_guard lock(state->mutex);
+                if (state->closed) {
+                    return;
+                }
+
+                state->writeScheduled = false;
+            }
+
+            WriteSettings();
+        });
     }
 
     auto JsonFileSettingProvider::Provides() -> const std::set<std::string>&
@@ -61,8 +112,53 @@ namespace UKControllerPlugin::Setting {
         return data.get<std::map<std::string, std::string>>();
     }
 
+    /*
+        Outstanding changes are written first, as they would have been on disk before anything else changed it.
+    */
     void JsonFileSettingProvider::Reload()
     {
-        this->loadedSettings = this->LoadFromFile();
+        std::lock_guard writeLock(state->writeMutex);
+        WriteSettings();
+
+        auto settings = this->LoadFromFile();
+        std::lock_guard lock(state->mutex);
+        this->loadedSettings = std::move(settings);
+        state->writtenGeneration = state->generation;
+    }
+
+    void JsonFileSettingProvider::Flush()
+    {
+        std::lock_guard writeLock(state->writeMutex);
+        WriteSettings();
+    }
+
+    /*
+        Writes a snapshot of the settings to a temporary file and moves it into place, if anything has changed
+        since the last write. The lock is only held to take the snapshot, so changes can carry on while the disk is
+        busy, and they'll be picked up by the next write. Must be called with the write lock held.
+    */
+    void JsonFileSettingProvider::WriteSettings()
+    {
+        std::string settings;
+        uint64_t generation = 0;
+        {
+            std::lock_guard lock(state->mutex);
+            if (state->closed || state->writtenGeneration == state->generation) {
+                return;
+            }
+
+            settings = nlohmann::json(loadedSettings).dump();
+            generation = state->generation;
+        }
+
+        const auto temporaryFile = L"settings/" + filename + L".tmp";
+        if (!windows.TryWriteToFile(temporaryFile, settings, true, false) ||
+            !windows.MoveFileToNewLocation(temporaryFile, L"settings/" + filename)) {
+            LogError("Unable to save setting file " + HelperFunctions::ConvertToRegularString(filename));
+            return;
+        }
+
+        std::lock_guard lock(state->mutex);
+        state->writtenGeneration = generation;
     }
 } // namespace UKControllerPlugin::Setting
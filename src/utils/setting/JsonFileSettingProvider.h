@@ -8,19 +8,63 @@ namespace UKControllerPlugin::Windows {
 namespace UKControllerPlugin::Setting {
     /**
      * Provides settings from a JSON object stored in a file.
+     *
+     * Saves are written behind. The first change schedules a background write for the end of the write delay and
+     * any further changes before then are coalesced into it, so that bursts of changes don't hit the disk on the
+     * EuroScope thread. The file is written from a snapshot taken under the lock, so reads and saves carry on while
+     * the disk is busy, and goes to a temporary file that is then moved into place, so it is never left half
+     * written. Any outstanding changes are written when the provider is flushed or destroyed.
      */
     class JsonFileSettingProvider : public SettingProviderInterface
     {
         public:
         JsonFileSettingProvider(
             const std::wstring filename, std::set<std::string> providedSettings, Windows::WinApiInterface& windows);
+        JsonFileSettingProvider(
+            const std::wstring filename,
+            std::set<std::string> providedSettings,
+            Windows::WinApiInterface& windows,
+            std::chrono::milliseconds writeDelay,
+            std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+                runInBackgroundAt);
+        ~JsonFileSettingProvider() override;
+        JsonFileSettingProvider(const JsonFileSettingProvider&) = delete;
+        JsonFileSettingProvider(JsonFileSettingProvider&&) = delete;
+        auto operator=(const JsonFileSettingProvider&) -> JsonFileSettingProvider& = delete;
+        auto operator=(JsonFileSettingProvider&&) -> JsonFileSettingProvider& = delete;
         auto Get(const std::string& key) -> std::string override;
         void Save(const std::string& key, const std::string& value) override;
         auto Provides() -> const std::set<std::string>& override;
         void Reload() override;
+        void Flush() override;
+
+        // How long to wait for further changes before writing them
+        inline static const std::chrono::milliseconds defaultWriteDelay{2000};
 
         private:
+        using WriteBehindState = struct WriteBehindState
+        {
+            // Guards the loaded settings and the rest of the state
+            std::mutex mutex;
+
+            // Held for the whole of a write, so writes happen one at a time and in order
+            std::mutex writeMutex;
+
+            // Bumped on every change to the settings
+            uint64_t generation = 0;
+
+            // The generation last written to disk, anything newer still needs writing
+            uint64_t writtenGeneration = 0;
+
+            // Whether a background write is waiting to happen
+            bool writeScheduled = false;
+
+            // Whether the provider has gone, so background writes must not touch it
+            bool closed = false;
+        };
+
         [[nodiscard]] auto LoadFromFile() const -> std::map<std::string, std::string>;
+        void WriteSettings();
 
         // The filename to load
         const std::wstring filename;
@@ -31,7 +75,17 @@ namespace UKControllerPlugin::Setting {
         // Windows API for loading files
         Windows::WinApiInterface& windows;
 
+        // How long to wait for further changes before writing them
+        const std::chrono::milliseconds writeDelay;
+
+        // Runs the write behind task once it is due
+        const std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+            runInBackgroundAt;
+
         // Loaded settings
         std::map<std::string, std::string> loadedSettings;
+
+        // State shared with the write behind task, which may outlive the provider
+        std::shared_ptr<WriteBehindState> state;
     };
 } // namespace UKControllerPlugin::Setting
@@ -17,5 +17,10 @@ namespace UKControllerPlugin::Setting {
         virtual void Save(const std::string& key, const std::string& value) = 0;
         [[nodiscard]] virtual auto Provides() -> const std::set<std::string>& = 0;
         virtual void Reload() = 0;
+
+        /**
+         * Writes any changes that haven't yet been saved.
+         */
+        virtual void Flush() = 0;
     };
 } // namespace UKControllerPlugin::Setting
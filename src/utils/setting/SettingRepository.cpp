@@ -52,4 +52,17 @@ namespace UKControllerPlugin::Setting {
     {
         return this->settings.size();
     }
+
+    /*
+        Providers usually provide more than one setting, so only flush each once.
+    */
+    void SettingRepository::Flush() const
+    {
+        std::set<std::shared_ptr<SettingProviderInterface>> providers;
+        for (const auto& [setting, provider] : this->settings) {
+            if (providers.insert(provider).second) {
+                provider->Flush();
+            }
+        }
+    }
 } // namespace UKControllerPlugin::Setting
@@ -14,6 +14,7 @@ namespace UKControllerPlugin::Setting {
         void UpdateSetting(const std::string& setting, const std::string& value) override;
         void ReloadSetting(const std::string& setting) override;
         [[nodiscard]] auto CountSettings() const -> size_t;
+        void Flush() const;
 
         private:
         // Setting key to provider map
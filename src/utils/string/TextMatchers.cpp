@@ -0,0 +1,207 @@
+#include "TextMatchers.h"
+
+namespace UKControllerPluginUtils::String {
+
+    namespace {
+        auto IsDigit(char character) -> bool
+        {
+            return character >= '0' && character <= '9';
+        }
+
+        auto IsUpper(char character) -> bool
+        {
+            return character >= 'A' && character <= 'Z';
+        }
+
+        auto IsLetter(char character) -> bool
+        {
+            return IsUpper(character) || (character >= 'a' && character <= 'z');
+        }
+
+        // [A-Za-z0-9_-]
+        auto IsCallsignCharacter(char character) -> bool
+        {
+            return IsLetter(character) || IsDigit(character) || character == '_' || character == '-';
+        }
+
+        // \s
+        auto IsSpace(char character) -> bool
+        {
+            return character == ' ' || (character >= '\t' && character <= '\r');
+        }
+
+        // ., which doesn't match line terminators
+        auto IsAnyButNewline(char character) -> bool
+        {
+            return character != '\n' && character != '\r';
+        }
+
+        auto IsSelcalLetter(char character) -> bool
+        {
+            static const std::string_view letters = "ABCDEFGHJKLMPQRS";
+            return letters.find(character) != std::string_view::npos;
+        }
+
+        auto StartsWithIgnoringCase(std::string_view text, std::string_view prefix) -> bool
+        {
+            if (text.size() < prefix.size()) {
+                return false;
+            }
+
+            for (size_t i = 0; i < prefix.size(); i++) {
+                if (std::toupper(static_cast<unsigned char>(text[i])) != prefix[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // How many characters at the start of the text satisfy the predicate
+        template <typename Predicate> auto CountWhile(std::string_view text, Predicate predicate) -> size_t
+        {
+            size_t count = 0;
+            while (count < text.size() && predicate(text[count])) {
+                count++;
+            }
+
+            return count;
+        }
+
+        auto AllOf(std::string_view text, bool (*predicate)(char)) -> bool
+        {
+            return CountWhile(text, predicate) == text.size();
+        }
+
+        /*
+            Searches for .<prefix><capture>, where the capture is at least minimumLength characters that satisfy
+            the predicate, taking up to maximumLength of them.
+        */
+        auto SearchCommand(
+            std::string_view command,
+            std::string_view prefix,
+            bool (*predicate)(char),
+            size_t minimumLength,
+            size_t maximumLength) -> std::optional<std::string_view>
+        {
+            for (auto position = command.find(prefix, 1); position != std::string_view::npos;
+                 position = command.find(prefix, position + 1)) {
+                if (!IsAnyButNewline(command[position - 1])) {
+                    continue;
+                }
+
+                const auto capture = command.substr(position + prefix.size());
+                const auto length = std::min(CountWhile(capture, predicate), maximumLength);
+                if (length >= minimumLength) {
+                    return capture.substr(0, length);
+                }
+            }
+
+            return std::nullopt;
+        }
+    } // namespace
+
+    auto IsCircuitRoute(std::string_view route) -> bool
+    {
+        return StartsWithIgnoringCase(route, "CIRCUIT") || StartsWithIgnoringCase(route, "VFR CIRCUIT");
+    }
+
+    /*
+        The leftmost match is always at the first SEL/ that's surrounded properly, as the whitespace
+        before each one can't overlap.
+    */
+    auto MatchSelcal(std::string_view text) -> std::optional<std::string_view>
+    {
+        static const std::string_view prefix = "SEL/";
+        static const size_t codeLength = 4;
+        for (auto position = text.find(prefix); position != std::string_view::npos;
+             position = text.find(prefix, position + 1)) {
+            const auto codeStart = position + prefix.size();
+            const auto codeEnd = codeStart + codeLength;
+            if ((position == 0 || IsSpace(text[position - 1])) && codeEnd <= text.size() &&
+                AllOf(text.substr(codeStart, codeLength), IsSelcalLetter) &&
+                (codeEnd == text.size() || IsSpace(text[codeEnd]))) {
+                return text.substr(codeStart, codeLength);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    auto MatchFlightLevel(std::string_view level) -> std::optional<std::string_view>
+    {
+        const auto digits = level.starts_with("FL") ? level.substr(2) : level;
+        const size_t maximumDigits = digits.size() == level.size() ? 5 : 3;
+        if (digits.size() < 2 || digits.size() > maximumDigits || !AllOf(digits, IsDigit)) {
+            return std::nullopt;
+        }
+
+        return digits;
+    }
+
+    auto MatchAirfieldOwnerCommand(std::string_view command) -> std::optional<std::string_view>
+    {
+        return SearchCommand(command, "ukcp owner ", IsLetter, 4, 4);
+    }
+
+    auto MatchAirfieldsOwnedCommand(std::string_view command) -> std::optional<std::string_view>
+    {
+        return SearchCommand(command, "ukcp owned ", IsCallsignCharacter, 1, std::string_view::npos);
+    }
+
+    auto MatchNoholdCommand(std::string_view command) -> std::optional<std::string_view>
+    {
+        static const std::string_view prefix = ".ukcp nohold";
+        if (!command.starts_with(prefix)) {
+            return std::nullopt;
+        }
+
+        const auto rest = command.substr(prefix.size());
+        if (rest.empty()) {
+            return rest;
+        }
+
+        if (rest.size() < 2 || rest[0] != ' ' || !AllOf(rest.substr(1), IsCallsignCharacter)) {
+            return std::nullopt;
+        }
+
+        return rest.substr(1);
+    }
+
+    auto MatchHoldCommand(std::string_view command) -> std::optional<HoldCommand>
+    {
+        static const std::string_view prefix = ".ukcp hold ";
+        if (!command.starts_with(prefix)) {
+            return std::nullopt;
+        }
+
+        const auto rest = command.substr(prefix.size());
+        const auto holdLength = CountWhile(rest, IsLetter);
+        if (holdLength == 0) {
+            return std::nullopt;
+        }
+
+        const auto callsign = rest.substr(holdLength);
+        if (callsign.empty()) {
+            return HoldCommand{rest.substr(0, holdLength), callsign};
+        }
+
+        if (callsign.size() < 2 || callsign[0] != ' ' || !AllOf(callsign.substr(1), IsCallsignCharacter)) {
+            return std::nullopt;
+        }
+
+        return HoldCommand{rest.substr(0, holdLength), callsign.substr(1)};
+    }
+
+    auto MatchPressureCommand(std::string_view command) -> std::optional<std::string_view>
+    {
+        static const std::string_view prefix = ".ukcp pressure ";
+        static const size_t airfieldLength = 4;
+        if (command.size() != prefix.size() + airfieldLength || !command.starts_with(prefix) ||
+            !AllOf(command.substr(prefix.size()), IsUpper)) {
+            return std::nullopt;
+        }
+
+        return command.substr(prefix.size());
+    }
+} // namespace UKControllerPluginUtils::String
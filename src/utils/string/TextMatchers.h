@@ -0,0 +1,45 @@
+#pragma once
+
+namespace UKControllerPluginUtils::String {
+
+    /*
+        Hand-written matchers for the patterns we check on hot paths, such as tag items, the flightplan
+        sweep and command handling. Each matcher accepts and rejects exactly what the regular expression
+        in its comment does, but without building a regex or allocating. Any captures are views into the
+        string that was matched, so must not outlive it.
+    */
+
+    // The parts of a .ukcp hold command
+    using HoldCommand = struct HoldCommand
+    {
+        // The hold to assign
+        std::string_view hold;
+
+        // The callsign to assign, empty for the selected aircraft
+        std::string_view callsign;
+    };
+
+    // Search for ^(?:VFR )?CIRCUIT(?:S)?, ignoring case
+    [[nodiscard]] auto IsCircuitRoute(std::string_view route) -> bool;
+
+    // Search for (\s+|^)SEL/([ABCDEFGHJKLMPQRS]{4})(\s+|$), returning the code
+    [[nodiscard]] auto MatchSelcal(std::string_view text) -> std::optional<std::string_view>;
+
+    // Match ^(?:FL)?(\d{2,3})$|^(\d{4,5})$, returning the digits
+    [[nodiscard]] auto MatchFlightLevel(std::string_view level) -> std::optional<std::string_view>;
+
+    // Search for .ukcp owner ([A-Za-z]{4}), returning the airfield
+    [[nodiscard]] auto MatchAirfieldOwnerCommand(std::string_view command) -> std::optional<std::string_view>;
+
+    // Search for .ukcp owned ([A-Za-z0-9_-]+), returning the callsign
+    [[nodiscard]] auto MatchAirfieldsOwnedCommand(std::string_view command) -> std::optional<std::string_view>;
+
+    // Match ^\.ukcp nohold( ([A-Za-z0-9\-_]+))?$, returning the callsign or an empty view
+    [[nodiscard]] auto MatchNoholdCommand(std::string_view command) -> std::optional<std::string_view>;
+
+    // Match ^\.ukcp hold ([A-Za-z]+)( ([A-Za-z0-9\-_]+))?$
+    [[nodiscard]] auto MatchHoldCommand(std::string_view command) -> std::optional<HoldCommand>;
+
+    // Search for ^\.ukcp pressure ([A-Z]{4})$, returning the airfield
+    [[nodiscard]] auto MatchPressureCommand(std::string_view command) -> std::optional<std::string_view>;
+} // namespace UKControllerPluginUtils::String
@@ -14,6 +14,15 @@ void Async(const std::function<void(void)>& function)
     taskRunner->QueueAsynchronousTask(function);
 }
 
+void AsyncAt(std::chrono::steady_clock::time_point due, const std::function<void(void)>& function)
+{
+    if (!taskRunner) {
+        return;
+    }
+
+    taskRunner->QueueAsynchronousTaskAt(due, function);
+}
+
 void SetTaskRunner(std::shared_ptr<TaskRunnerInterface> runner)
 {
     if (taskRunner) {
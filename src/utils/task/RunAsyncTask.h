@@ -5,5 +5,6 @@ namespace UKControllerPlugin::TaskManager {
 } // namespace UKControllerPlugin::TaskManager
 
 void Async(const std::function<void(void)>& function);
+void AsyncAt(std::chrono::steady_clock::time_point due, const std::function<void(void)>& function);
 void SetTaskRunner(std::shared_ptr<UKControllerPlugin::TaskManager::TaskRunnerInterface> taskRunner);
 void UnsetTaskRunner();
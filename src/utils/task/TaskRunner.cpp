@@ -47,6 +47,29 @@ namespace UKControllerPlugin::TaskManager {
         this->asynchronousQueueCondVar.notify_one();
     }
 
+    /*
+        Queue an asynchronous task to be run once the due time has passed. No thread is held up waiting for it,
+        a thread picks it up when it next looks for work.
+    */
+    void TaskRunner::QueueAsynchronousTaskAt(std::chrono::steady_clock::time_point due, std::function<void(void)> task)
+    {
+        std::unique_lock<std::mutex> uniqueLock(this->asynchronousQueueLock);
+        this->scheduledTasks.emplace(due, std::move(task));
+        this->asynchronousQueueCondVar.notify_one();
+    }
+
+    /*
+        Move any scheduled tasks whose time has come onto the queue. Must be called with the queue lock held.
+    */
+    void TaskRunner::QueueDueTasks()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        while (!this->scheduledTasks.empty() && this->scheduledTasks.begin()->first <= now) {
+            this->asynchronousTaskQueue.push_back(std::move(this->scheduledTasks.begin()->second));
+            this->scheduledTasks.erase(this->scheduledTasks.begin());
+        }
+    }
+
     /*
         A method to process tasks that are asynchronous - running outside the normal
         loop of EuroScope execution. For example, tasks that require HTTP requests, which
@@ -65,9 +88,18 @@ namespace UKControllerPlugin::TaskManager {
                 break;
             }
 
-            // If the queue is empty, we should wait for a job
+            // If the queue is empty, we should wait for a job, or the next scheduled one to be due
+            this->QueueDueTasks();
             if (this->asynchronousTaskQueue.empty()) {
-                this->asynchronousQueueCondVar.wait(uniqueLock);
+                if (this->scheduledTasks.empty()) {
+                    this->asynchronousQueueCondVar.wait(uniqueLock);
+                } else {
+                    // Copied, as another thread may take the task while we wait
+                    const auto nextDue = this->scheduledTasks.begin()->first;
+                    this->asynchronousQueueCondVar.wait_until(uniqueLock, nextDue);
+                }
+
+                this->QueueDueTasks();
 
                 // Spurious wakeup, skip the loop
                 if (this->asynchronousTaskQueue.empty()) {
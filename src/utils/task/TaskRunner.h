@@ -24,9 +24,12 @@ namespace UKControllerPlugin {
             ~TaskRunner(void);
             size_t CountThreads(void) const override;
             void QueueAsynchronousTask(std::function<void(void)> task) override;
+            void
+            QueueAsynchronousTaskAt(std::chrono::steady_clock::time_point due, std::function<void(void)> task) override;
 
             private:
             void ProcessAsynchronousTasks();
+            void QueueDueTasks();
 
             // Are the threads running
             bool threadsRunning = true;
@@ -40,6 +43,9 @@ namespace UKControllerPlugin {
             // The master queue for asynchronous tasks - will be taken off in order.
             std::deque<std::function<void(void)>> asynchronousTaskQueue;
 
+            // Tasks waiting for their due time, after which they join the queue.
+            std::multimap<std::chrono::steady_clock::time_point, std::function<void(void)>> scheduledTasks;
+
             // A condition variable for the asynchronous queue.
             std::condition_variable asynchronousQueueCondVar;
         };
@@ -17,6 +17,8 @@ namespace UKControllerPlugin {
             }
             virtual size_t CountThreads(void) const = 0;
             virtual void QueueAsynchronousTask(std::function<void(void)> task) = 0;
+            virtual void
+            QueueAsynchronousTaskAt(std::chrono::steady_clock::time_point due, std::function<void(void)> task) = 0;
         };
     } // namespace TaskManager
 } // namespace UKControllerPlugin
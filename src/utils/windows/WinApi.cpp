@@ -230,9 +230,26 @@ namespace UKControllerPlugin {
             Write a given string into a file.
         */
         void WinApi::WriteToFile(std::wstring filename, std::string data, bool truncate, bool binary)
+        {
+            this->CreateMissingDirectories(this->GetFullPathToLocalFile(filename));
+            if (!this->TryWriteToFile(filename, std::move(data), truncate, binary)) {
+                std::wstring message = L"File not opened for writing: " + filename;
+                this->OpenMessageBox(message.c_str(), L"UKCP Filesystem Error", MB_ICONWARNING | MB_OK);
+            }
+        }
+
+        /*
+            Write a given string into a file, reporting failure to the caller rather than the user. Safe to
+            call off the EuroScope thread.
+        */
+        bool WinApi::TryWriteToFile(std::wstring filename, std::string data, bool truncate, bool binary)
         {
             std::wstring newFilename = this->GetFullPathToLocalFile(filename);
-            this->CreateMissingDirectories(newFilename);
+            std::error_code directoryError;
+            std::filesystem::create_directories(newFilename.substr(0, newFilename.find_last_of('/')), directoryError);
+            if (directoryError) {
+                return false;
+            }
 
             // Set the output mode
             std::ofstream::openmode mode = std::ofstream::out;
@@ -244,14 +261,13 @@ namespace UKControllerPlugin {
 
             // Open file and write
             std::ofstream file(newFilename, mode);
-            file.exceptions(std::ofstream::badbit);
-            if (file.is_open()) {
-                file << data;
-                file.close();
-            } else {
-                std::wstring message = L"File not opened for writing: " + filename;
-                this->OpenMessageBox(message.c_str(), L"UKCP Filesystem Error", MB_ICONWARNING | MB_OK);
+            if (!file.is_open()) {
+                return false;
             }
+
+            file << data;
+            file.close();
+            return !file.fail();
         }
 
         /*
@@ -0,0 +1,97 @@
+#include "api/ApiHealthMonitor.h"
+#include "api/ApiHealthTracker.h"
+#include "message/UserMessager.h"
+
+using testing::_;
+using testing::NiceMock;
+using UKControllerPlugin::Api::ApiHealthMonitor;
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPluginUtils::Api::ApiHealthTracker;
+
+namespace UKControllerPluginTest::Api {
+    class ApiHealthMonitorTest : public testing::Test
+    {
+        public:
+        ApiHealthMonitorTest() : messager(plugin), monitor(health, messager)
+        {
+        }
+
+        void MakeUnhealthy()
+        {
+            for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold; i++) {
+                health.RecordFailure("stand/assignment", std::chrono::milliseconds(100));
+            }
+        }
+
+        NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> plugin;
+        ApiHealthTracker health;
+        UserMessager messager;
+        ApiHealthMonitor monitor;
+    };
+
+    TEST_F(ApiHealthMonitorTest, ItStartsHealthy)
+    {
+        EXPECT_TRUE(monitor.Healthy());
+    }
+
+    TEST_F(ApiHealthMonitorTest, ItDoesntMessageTheUserIfTheApiIsHealthy)
+    {
+        EXPECT_CALL(plugin, ChatAreaMessage(_, _, _, _, _, _, _, _)).Times(0);
+        monitor.TimedEventTrigger();
+        EXPECT_TRUE(monitor.Healthy());
+    }
+
+    TEST_F(ApiHealthMonitorTest, ItMessagesTheUserWhenTheApiBecomesUnhealthy)
+    {
+        MakeUnhealthy();
+        EXPECT_CALL(
+            plugin,
+            ChatAreaMessage(
+                "UKCP_API",
+                "UKCP",
+                "The UKCP API is not responding. Requests will be paused and retried automatically. Slowest endpoint "
+                "is stand/assignment, averaging 100ms.",
+                true,
+                true,
+                false,
+                true,
+                false))
+            .Times(1);
+
+        monitor.TimedEventTrigger();
+        EXPECT_FALSE(monitor.Healthy());
+    }
+
+    TEST_F(ApiHealthMonitorTest, ItOnlyMessagesTheUserOncePerChange)
+    {
+        MakeUnhealthy();
+        EXPECT_CALL(plugin, ChatAreaMessage(_, _, _, _, _, _, _, _)).Times(1);
+
+        monitor.TimedEventTrigger();
+        monitor.TimedEventTrigger();
+    }
+
+    TEST_F(ApiHealthMonitorTest, ItMessagesTheUserWhenTheApiRecovers)
+    {
+        MakeUnhealthy();
+        monitor.TimedEventTrigger();
+        health.RecordSuccess("stand/assignment", std::chrono::milliseconds(100));
+
+        EXPECT_CALL(
+            plugin,
+            ChatAreaMessage(
+                "UKCP_API",
+                "UKCP",
+                "The UKCP API is responding again, normal operation has resumed. Slowest endpoint is "
+                "stand/assignment, averaging 100ms.",
+                true,
+                true,
+                false,
+                false,
+                false))
+            .Times(1);
+
+        monitor.TimedEventTrigger();
+        EXPECT_TRUE(monitor.Healthy());
+    }
+} // namespace UKControllerPluginTest::Api
@@ -0,0 +1,175 @@
+#include "api/ApiRequestCoalescer.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::StrictMock;
+using testing::Throw;
+using UKControllerPlugin::Api::ApiRequestCoalescer;
+
+namespace UKControllerPluginTest::Api {
+    class ApiRequestCoalescerTest : public testing::Test
+    {
+        public:
+        ApiRequestCoalescerTest() : coalescer(taskRunner, handler)
+        {
+        }
+
+        NiceMock<TaskManager::MockTaskRunnerInterface> taskRunner;
+        StrictMock<MockBulkRequestHandler> handler;
+        ApiRequestCoalescer coalescer;
+    };
+
+    TEST_F(ApiRequestCoalescerTest, ItStartsEmpty)
+    {
+        EXPECT_EQ(0, coalescer.CountPending());
+        EXPECT_EQ(0, coalescer.CountInFlight());
+        EXPECT_TRUE(coalescer.BulkSupported());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItQueuesItems)
+    {
+        EXPECT_TRUE(coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+        EXPECT_TRUE(coalescer.Enqueue("BAW456", {{"callsign", "BAW456"}}));
+        EXPECT_EQ(2, coalescer.CountPending());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItDoesntQueueDuplicateItems)
+    {
+        EXPECT_TRUE(coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+        EXPECT_FALSE(coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+        EXPECT_EQ(1, coalescer.CountPending());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItDoesntQueueItemsThatAreInFlight)
+    {
+        NiceMock<TaskManager::MockTaskRunnerInterface> nonRunningTaskRunner(false);
+        ApiRequestCoalescer nonRunningCoalescer(nonRunningTaskRunner, handler);
+        EXPECT_TRUE(nonRunningCoalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+        nonRunningCoalescer.TimedEventTrigger();
+
+        EXPECT_EQ(0, nonRunningCoalescer.CountPending());
+        EXPECT_EQ(1, nonRunningCoalescer.CountInFlight());
+        EXPECT_FALSE(nonRunningCoalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItDoesNothingIfNothingPending)
+    {
+        coalescer.TimedEventTrigger();
+        EXPECT_EQ(0, coalescer.CountInFlight());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItSendsSingleItemsIndividually)
+    {
+        nlohmann::json item = {{"callsign", "BAW123"}};
+        EXPECT_CALL(handler, PerformItemRequest("BAW123", item)).Times(1);
+
+        coalescer.Enqueue("BAW123", item);
+        coalescer.TimedEventTrigger();
+        EXPECT_EQ(0, coalescer.CountPending());
+        EXPECT_EQ(0, coalescer.CountInFlight());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItSendsMultipleItemsInBulk)
+    {
+        nlohmann::json item1 = {{"callsign", "BAW123"}};
+        nlohmann::json item2 = {{"callsign", "BAW456"}};
+        nlohmann::json result1 = {{"stand", 1}};
+        nlohmann::json result2 = {{"stand", 2}};
+        EXPECT_CALL(handler, PerformBulkRequest(nlohmann::json::array({item1, item2})))
+            .Times(1)
+            .WillOnce(Return(nlohmann::json{{"BAW123", result1}, {"BAW456", result2}}));
+        EXPECT_CALL(handler, ProcessBulkResult("BAW123", result1)).Times(1);
+        EXPECT_CALL(handler, ProcessBulkResult("BAW456", result2)).Times(1);
+
+        coalescer.Enqueue("BAW123", item1);
+        coalescer.Enqueue("BAW456", item2);
+        coalescer.TimedEventTrigger();
+        EXPECT_EQ(0, coalescer.CountInFlight());
+        EXPECT_TRUE(coalescer.BulkSupported());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItSendsItemsMissingFromBulkResultsIndividually)
+    {
+        nlohmann::json item1 = {{"callsign", "BAW123"}};
+        nlohmann::json item2 = {{"callsign", "BAW456"}};
+        nlohmann::json result1 = {{"stand", 1}};
+        EXPECT_CALL(handler, PerformBulkRequest(_)).Times(1).WillOnce(Return(nlohmann::json{{"BAW123", result1}}));
+        EXPECT_CALL(handler, ProcessBulkResult("BAW123", result1)).Times(1);
+        EXPECT_CALL(handler, PerformItemRequest("BAW456", item2)).Times(1);
+
+        coalescer.Enqueue("BAW123", item1);
+        coalescer.Enqueue("BAW456", item2);
+        coalescer.TimedEventTrigger();
+        EXPECT_EQ(0, coalescer.CountInFlight());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItFallsBackToIndividualRequestsIfBulkUnsupported)
+    {
+        nlohmann::json item1 = {{"callsign", "BAW123"}};
+        nlohmann::json item2 = {{"callsign", "BAW456"}};
+        EXPECT_CALL(handler, PerformBulkRequest(_)).Times(1).WillOnce(Return(std::nullopt));
+        EXPECT_CALL(handler, PerformItemRequest("BAW123", item1)).Times(1);
+        EXPECT_CALL(handler, PerformItemRequest("BAW456", item2)).Times(1);
+
+        coalescer.Enqueue("BAW123", item1);
+        coalescer.Enqueue("BAW456", item2);
+        coalescer.TimedEventTrigger();
+        EXPECT_FALSE(coalescer.BulkSupported());
+        EXPECT_EQ(0, coalescer.CountInFlight());
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItDoesntTryBulkAgainOnceUnsupported)
+    {
+        EXPECT_CALL(handler, PerformBulkRequest(_)).Times(1).WillOnce(Return(std::nullopt));
+        EXPECT_CALL(handler, PerformItemRequest(_, _)).Times(4);
+
+        coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}});
+        coalescer.Enqueue("BAW456", {{"callsign", "BAW456"}});
+        coalescer.TimedEventTrigger();
+        coalescer.Enqueue("BAW789", {{"callsign", "BAW789"}});
+        coalescer.Enqueue("BAW999", {{"callsign", "BAW999"}});
+        coalescer.TimedEventTrigger();
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItAbandonsItemsRatherThanSendingIndividuallyIfBulkRequestFails)
+    {
+        EXPECT_CALL(handler, PerformBulkRequest(_)).Times(1).WillOnce(Throw(std::runtime_error("oops")));
+        EXPECT_CALL(handler, PerformItemRequest(_, _)).Times(0);
+        EXPECT_CALL(handler, AbandonRequest("BAW123")).Times(1);
+        EXPECT_CALL(handler, AbandonRequest("BAW456")).Times(1);
+
+        coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}});
+        coalescer.Enqueue("BAW456", {{"callsign", "BAW456"}});
+        coalescer.TimedEventTrigger();
+        EXPECT_TRUE(coalescer.BulkSupported());
+        EXPECT_EQ(0, coalescer.CountInFlight());
+        EXPECT_TRUE(coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItCompletesItemsWhoseBulkResultFailsToProcess)
+    {
+        nlohmann::json result = {{"stand", 1}};
+        EXPECT_CALL(handler, PerformBulkRequest(_))
+            .Times(1)
+            .WillOnce(Return(nlohmann::json{{"BAW123", result}, {"BAW456", result}}));
+        EXPECT_CALL(handler, ProcessBulkResult("BAW123", result)).Times(1).WillOnce(Throw(std::runtime_error("oops")));
+        EXPECT_CALL(handler, ProcessBulkResult("BAW456", result)).Times(1);
+
+        coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}});
+        coalescer.Enqueue("BAW456", {{"callsign", "BAW456"}});
+        coalescer.TimedEventTrigger();
+        EXPECT_EQ(0, coalescer.CountInFlight());
+        EXPECT_TRUE(coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+    }
+
+    TEST_F(ApiRequestCoalescerTest, ItCompletesItemsWhoseIndividualRequestFails)
+    {
+        EXPECT_CALL(handler, PerformItemRequest("BAW123", _)).Times(1).WillOnce(Throw(std::runtime_error("oops")));
+
+        coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}});
+        coalescer.TimedEventTrigger();
+        EXPECT_EQ(0, coalescer.CountInFlight());
+        EXPECT_TRUE(coalescer.Enqueue("BAW123", {{"callsign", "BAW123"}}));
+    }
+} // namespace UKControllerPluginTest::Api
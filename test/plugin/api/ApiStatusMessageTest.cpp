@@ -0,0 +1,73 @@
+#include "api/ApiStatusMessage.h"
+
+using UKControllerPlugin::Api::ApiStatusMessage;
+
+namespace UKControllerPluginTest::Api {
+    class ApiStatusMessageTest : public testing::Test
+    {
+        public:
+        ApiStatusMessageTest() : unhealthy(false), healthy(true)
+        {
+        }
+
+        ApiStatusMessage unhealthy;
+        ApiStatusMessage healthy;
+    };
+
+    TEST_F(ApiStatusMessageTest, ItHasAMessageHandler)
+    {
+        EXPECT_EQ("UKCP_API", unhealthy.MessageHandler());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItHasASender)
+    {
+        EXPECT_EQ("UKCP", unhealthy.MessageSender());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItHasAMessageWhenUnhealthy)
+    {
+        EXPECT_EQ(
+            "The UKCP API is not responding. Requests will be paused and retried automatically.",
+            unhealthy.MessageString());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItHasAMessageWhenHealthy)
+    {
+        EXPECT_EQ("The UKCP API is responding again, normal operation has resumed.", healthy.MessageString());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItIncludesTheSlowestEndpoint)
+    {
+        ApiStatusMessage message(false, "ukcp.vatsim.uk/api/stand/assignment", std::chrono::milliseconds(1250));
+        EXPECT_EQ(
+            "The UKCP API is not responding. Requests will be paused and retried automatically. Slowest endpoint is "
+            "ukcp.vatsim.uk/api/stand/assignment, averaging 1250ms.",
+            message.MessageString());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItShowsTheHandler)
+    {
+        EXPECT_TRUE(unhealthy.MessageShowHandler());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItMarksUnread)
+    {
+        EXPECT_TRUE(unhealthy.MessageMarkUnread());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItDoesntOverrideBusy)
+    {
+        EXPECT_FALSE(unhealthy.MessageOverrideBusy());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItFlashesTheHandlerOnlyWhenUnhealthy)
+    {
+        EXPECT_TRUE(unhealthy.MessageFlashHandler());
+        EXPECT_FALSE(healthy.MessageFlashHandler());
+    }
+
+    TEST_F(ApiStatusMessageTest, ItDoesntRequireConfirmation)
+    {
+        EXPECT_FALSE(unhealthy.MessageRequiresConfirm());
+    }
+} // namespace UKControllerPluginTest::Api
@@ -1,18 +1,22 @@
 #include "api/BootstrapApi.h"
+#include "api/ApiFactory.h"
 #include "api/ApiKeyReceivedEvent.h"
 #include "api/ReplaceApiKeyDialog.h"
 #include "bootstrap/PersistenceContainer.h"
 #include "dialog/DialogManager.h"
+#include "message/UserMessager.h"
 #include "mock/MockDialogProvider.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "radarscreen/ConfigurableDisplayCollection.h"
 #include "setting/SettingRepository.h"
 #include "test/ApiTestCase.h"
 #include "test/EventBusTestCase.h"
+#include "timedevent/TimedEventCollection.h"
 #include <gmock/gmock-nice-strict.h>
 #include <gtest/internal/gtest-internal.h>
 #include <memory>
 
+using UKControllerPlugin::Api::apiHealthCheckFrequency;
 using UKControllerPlugin::Api::BootstrapApi;
 using UKControllerPlugin::Api::BootstrapConfigurationMenuItem;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
@@ -42,9 +46,12 @@ namespace UKControllerPluginTest::Api {
             container.settingsRepository = std::make_unique<SettingRepository>();
             container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
             container.dialogManager = std::make_unique<UKControllerPlugin::Dialog::DialogManager>(dialogProvider);
+            container.timedHandler = std::make_unique<UKControllerPlugin::TimedEvent::TimedEventCollection>();
+            container.userMessager = std::make_unique<UKControllerPlugin::Message::UserMessager>(plugin);
         }
 
         testing::NiceMock<UKControllerPluginTest::Dialog::MockDialogProvider> dialogProvider;
+        testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> plugin;
         ConfigurableDisplayCollection configurableDisplays;
         PersistenceContainer container;
     };
@@ -61,6 +68,19 @@ namespace UKControllerPluginTest::Api {
         EXPECT_NE(nullptr, container.api);
     }
 
+    TEST_F(BootstrapApiTest, ItSharesTheApiHealthTracker)
+    {
+        BootstrapApi(container);
+        EXPECT_NE(nullptr, container.apiHealth);
+        EXPECT_EQ(container.apiFactory->HealthTracker(), container.apiHealth);
+    }
+
+    TEST_F(BootstrapApiTest, ItRegistersTheApiHealthMonitor)
+    {
+        BootstrapApi(container);
+        EXPECT_EQ(1, container.timedHandler->CountHandlersForFrequency(apiHealthCheckFrequency));
+    }
+
     TEST_F(BootstrapApiTest, ItBootstrapsTheReplaceDialog)
     {
         BootstrapApi(container);
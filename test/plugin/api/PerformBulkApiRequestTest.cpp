@@ -0,0 +1,47 @@
+#include "api/PerformBulkApiRequest.h"
+
+using UKControllerPlugin::Api::PerformBulkApiRequest;
+
+namespace UKControllerPluginTest::Api {
+    class PerformBulkApiRequestTest : public ApiTestCase
+    {
+        public:
+        nlohmann::json items = nlohmann::json::array({{{"callsign", "BAW123"}}, {{"callsign", "BAW456"}}});
+    };
+
+    TEST_F(PerformBulkApiRequestTest, ItPostsTheItemsToTheEndpointAndReturnsTheResults)
+    {
+        this->ExpectApiRequest()
+            ->Post()
+            .To("foo/bulk")
+            .WithBody(nlohmann::json{{"assignments", items}})
+            .WillReturnOk()
+            .WithResponseBody(nlohmann::json{{"BAW123", {{"foo", "bar"}}}, {"BAW456", {{"foo", "baz"}}}});
+
+        const auto results = PerformBulkApiRequest("foo/bulk", items);
+        ASSERT_TRUE(results.has_value());
+        EXPECT_EQ(nlohmann::json({{"BAW123", {{"foo", "bar"}}}, {"BAW456", {{"foo", "baz"}}}}), results.value());
+    }
+
+    TEST_F(PerformBulkApiRequestTest, ItReturnsNulloptIfTheEndpointDoesntExist)
+    {
+        this->ExpectApiRequest()
+            ->Post()
+            .To("foo/bulk")
+            .WithBody(nlohmann::json{{"assignments", items}})
+            .WillReturnNotFound();
+
+        EXPECT_FALSE(PerformBulkApiRequest("foo/bulk", items).has_value());
+    }
+
+    TEST_F(PerformBulkApiRequestTest, ItThrowsIfTheRequestFails)
+    {
+        this->ExpectApiRequest()
+            ->Post()
+            .To("foo/bulk")
+            .WithBody(nlohmann::json{{"assignments", items}})
+            .WillReturnServerError();
+
+        EXPECT_THROW(static_cast<void>(PerformBulkApiRequest("foo/bulk", items)), std::runtime_error);
+    }
+} // namespace UKControllerPluginTest::Api
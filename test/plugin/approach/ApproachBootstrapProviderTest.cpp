@@ -1,6 +1,7 @@
 #include "airfield/AirfieldCollection.h"
 #include "approach/ApproachBootstrapProvider.h"
 #include "euroscope/PluginSettingsProviderCollection.h"
+#include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "runway/RunwayCollection.h"
@@ -11,6 +12,7 @@
 using UKControllerPlugin::Airfield::AirfieldCollection;
 using UKControllerPlugin::Approach::ApproachBootstrapProvider;
 using UKControllerPlugin::Euroscope::PluginSettingsProviderCollection;
+using UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::TimedEvent::TimedEventCollection;
 using UKControllerPlugin::Wake::WakeCategoryMapperCollection;
@@ -26,6 +28,7 @@ namespace UKControllerPluginTest::Approach {
             container.wakeCategoryMappers = std::make_unique<WakeCategoryMapperCollection>();
             container.timedHandler = std::make_unique<TimedEventCollection>();
             container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.radarTargetHandler = std::make_unique<RadarTargetEventHandlerCollection>();
             container.pluginSettingsProviders =
                 std::make_unique<PluginSettingsProviderCollection>(*container.pluginUserSettingHandler);
             container.runwayCollection = std::make_shared<UKControllerPlugin::Runway::RunwayCollection>();
@@ -56,10 +59,24 @@ namespace UKControllerPluginTest::Approach {
     TEST_F(ApproachBootstrapProviderTest, ItRegistersTheGlideslopeDeviationTagItem)
     {
         this->RunBootstrapPlugin(provider);
-        EXPECT_EQ(1, container.tagHandler->CountHandlers());
+        EXPECT_EQ(3, container.tagHandler->CountHandlers());
         EXPECT_TRUE(container.tagHandler->HasHandlerForItemId(132));
     }
 
+    TEST_F(ApproachBootstrapProviderTest, ItRegistersTheSpacingMonitor)
+    {
+        this->RunBootstrapPlugin(provider);
+        EXPECT_EQ(1, container.radarTargetHandler->CountHandlers());
+    }
+
+    TEST_F(ApproachBootstrapProviderTest, ItRegistersTheSpacingTagItems)
+    {
+        this->RunBootstrapPlugin(provider);
+        EXPECT_EQ(3, container.tagHandler->CountHandlers());
+        EXPECT_TRUE(container.tagHandler->HasHandlerForItemId(133));
+        EXPECT_TRUE(container.tagHandler->HasHandlerForItemId(134));
+    }
+
     TEST_F(ApproachBootstrapProviderTest, ItRegistersTheRenderers)
     {
         this->RunBootstrapRadarScreen(provider);
@@ -0,0 +1,200 @@
+#include "airfield/AirfieldCollection.h"
+#include "airfield/AirfieldModel.h"
+#include "approach/AirfieldApproachOptions.h"
+#include "approach/ApproachSequencer.h"
+#include "approach/ApproachSequencerOptions.h"
+#include "approach/ApproachSpacingCalculator.h"
+#include "approach/ApproachSpacingMonitor.h"
+#include "controller/ControllerPositionHierarchy.h"
+#include "helper/Benchmark.h"
+#include "wake/WakeCategoryMapperCollection.h"
+
+using UKControllerPlugin::Airfield::AirfieldCollection;
+using UKControllerPlugin::Airfield::AirfieldModel;
+using UKControllerPlugin::Approach::AirfieldApproachOptions;
+using UKControllerPlugin::Approach::ApproachSequencer;
+using UKControllerPlugin::Approach::ApproachSequencerOptions;
+using UKControllerPlugin::Approach::ApproachSequencingMode;
+using UKControllerPlugin::Approach::ApproachSpacingCalculator;
+using UKControllerPlugin::Approach::ApproachSpacingMonitor;
+using UKControllerPlugin::Controller::ControllerPositionHierarchy;
+using UKControllerPlugin::Wake::WakeCategoryMapperCollection;
+
+namespace UKControllerPluginTest::Approach {
+    class ApproachSpacingMonitorTest : public testing::Test
+    {
+        public:
+        ApproachSpacingMonitorTest()
+            : calculator(sequencerOptions, airfields, wakeMappers, plugin), monitor(sequencer, calculator)
+        {
+            airfields.AddAirfield(
+                std::make_shared<AirfieldModel>(1, "EGKK", std::make_unique<ControllerPositionHierarchy>()));
+            sequencerOptions.Set(
+                "EGKK", std::make_shared<AirfieldApproachOptions>(ApproachSequencingMode::WakeTurbulence, 6.0, 3.0));
+
+            ON_CALL(plugin, GetFlightplanForCallsign(testing::_)).WillByDefault(testing::Return(flightplan));
+        }
+
+        /*
+         * Puts an aircraft on the extended centreline of a runway at the given distance (in nm) from
+         * the threshold, one minute of latitude being one nautical mile.
+         */
+        void MoveAircraft(const std::string& callsign, double distance)
+        {
+            EuroScopePlugIn::CPosition position;
+            position.m_Latitude = 51.0 + (distance / 60);
+            position.m_Longitude = 0.0;
+
+            testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface> radarTarget;
+            ON_CALL(radarTarget, GetCallsign).WillByDefault(testing::Return(callsign));
+            ON_CALL(radarTarget, GetPosition).WillByDefault(testing::Return(position));
+            monitor.RadarTargetPositionUpdateEvent(radarTarget);
+        }
+
+        std::shared_ptr<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>> flightplan =
+            std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>>();
+        testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> plugin;
+        AirfieldCollection airfields;
+        WakeCategoryMapperCollection wakeMappers;
+        ApproachSequencerOptions sequencerOptions;
+        ApproachSequencer sequencer;
+        ApproachSpacingCalculator calculator;
+        ApproachSpacingMonitor monitor;
+    };
+
+    TEST_F(ApproachSpacingMonitorTest, ItHasNoSpacingForUnsequencedAircraft)
+    {
+        MoveAircraft("BAW123", 5.0);
+        EXPECT_EQ(nullptr, monitor.SpacingFor("BAW123"));
+        EXPECT_EQ(0, monitor.CountTrackedPairs());
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItHasNoSpacingForTheFirstAircraftInSequence)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        MoveAircraft("BAW123", 5.0);
+        EXPECT_EQ(nullptr, monitor.SpacingFor("BAW123"));
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItHasNoSpacingIfLeadPositionNotKnown)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::WakeTurbulence);
+        MoveAircraft("BAW456", 10.0);
+        EXPECT_EQ(nullptr, monitor.SpacingFor("BAW456"));
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItCalculatesSpacingForConsecutivePairs)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW789", ApproachSequencingMode::WakeTurbulence);
+        MoveAircraft("BAW123", 4.0);
+        MoveAircraft("BAW456", 10.0);
+        MoveAircraft("BAW789", 12.0);
+
+        EXPECT_EQ(2, monitor.CountTrackedPairs());
+
+        const auto spacing1 = monitor.SpacingFor("BAW456");
+        ASSERT_NE(nullptr, spacing1);
+        EXPECT_EQ("BAW123", spacing1->lead);
+        EXPECT_NEAR(6.0, spacing1->actual, 0.05);
+        EXPECT_DOUBLE_EQ(3.0, spacing1->required);
+
+        const auto spacing2 = monitor.SpacingFor("BAW789");
+        ASSERT_NE(nullptr, spacing2);
+        EXPECT_EQ("BAW456", spacing2->lead);
+        EXPECT_NEAR(2.0, spacing2->actual, 0.05);
+        EXPECT_DOUBLE_EQ(3.0, spacing2->required);
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItUpdatesTheFollowingAircraftWhenTheLeadMoves)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::WakeTurbulence);
+        MoveAircraft("BAW123", 4.0);
+        MoveAircraft("BAW456", 10.0);
+        MoveAircraft("BAW123", 3.0);
+
+        const auto spacing = monitor.SpacingFor("BAW456");
+        ASSERT_NE(nullptr, spacing);
+        EXPECT_NEAR(7.0, spacing->actual, 0.05);
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItRecalculatesWhenTheSequenceChanges)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW789", ApproachSequencingMode::WakeTurbulence);
+        MoveAircraft("BAW123", 4.0);
+        MoveAircraft("BAW456", 10.0);
+        MoveAircraft("BAW789", 12.0);
+
+        sequencer.RemoveAircraftFromSequences("BAW456");
+
+        const auto spacing = monitor.SpacingFor("BAW789");
+        ASSERT_NE(nullptr, spacing);
+        EXPECT_EQ("BAW123", spacing->lead);
+        EXPECT_NEAR(8.0, spacing->actual, 0.05);
+        EXPECT_EQ(nullptr, monitor.SpacingFor("BAW456"));
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItUsesTheSelectedDistanceForRequiredSpacing)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::MinimumDistance);
+        sequencer.GetForAirfield("EGKK").Get("BAW456")->ExpectedDistance(5.0);
+        MoveAircraft("BAW123", 4.0);
+        MoveAircraft("BAW456", 10.0);
+
+        const auto spacing = monitor.SpacingFor("BAW456");
+        ASSERT_NE(nullptr, spacing);
+        EXPECT_DOUBLE_EQ(5.0, spacing->required);
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, ItForgetsAircraftThatLeaveTheSequence)
+    {
+        sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+        sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::WakeTurbulence);
+        MoveAircraft("BAW123", 4.0);
+        MoveAircraft("BAW456", 10.0);
+        EXPECT_EQ(1, monitor.CountTrackedPairs());
+
+        sequencer.RemoveAircraftFromSequences("BAW456");
+        MoveAircraft("BAW456", 9.0);
+        EXPECT_EQ(0, monitor.CountTrackedPairs());
+    }
+
+    TEST_F(ApproachSpacingMonitorTest, DISABLED_BenchmarkRadarUpdatesWithBusyFinalApproach)
+    {
+        const int aircraftOnFinal = 40;
+        std::vector<std::string> callsigns;
+        std::vector<std::unique_ptr<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>> radarTargets;
+        for (int i = 0; i < aircraftOnFinal; i++) {
+            EuroScopePlugIn::CPosition position;
+            position.m_Latitude = 51.0 + ((3.0 + (i * 3.5)) / 60);
+            position.m_Longitude = 0.0;
+
+            const auto& callsign = callsigns.emplace_back("BAW" + std::to_string(i));
+            auto& radarTarget = radarTargets.emplace_back(
+                std::make_unique<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>());
+            ON_CALL(*radarTarget, GetCallsign).WillByDefault(testing::Return(callsign));
+            ON_CALL(*radarTarget, GetPosition).WillByDefault(testing::Return(position));
+            sequencer.AddAircraftToSequence("EGKK", callsign, ApproachSequencingMode::WakeTurbulence);
+        }
+
+        // One radar update for every aircraft on final, then every spacing being read by the tags
+        RunBenchmark(
+            "ApproachSpacingMonitor radar tick, 40 aircraft on final", 1000, [this, &callsigns, &radarTargets]() {
+                for (const auto& radarTarget : radarTargets) {
+                    monitor.RadarTargetPositionUpdateEvent(*radarTarget);
+                }
+
+                for (const auto& callsign : callsigns) {
+                    static_cast<void>(monitor.SpacingFor(callsign));
+                }
+            });
+
+        EXPECT_EQ(aircraftOnFinal - 1, monitor.CountTrackedPairs());
+    }
+} // namespace UKControllerPluginTest::Approach
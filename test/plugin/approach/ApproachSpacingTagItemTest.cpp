@@ -0,0 +1,135 @@
+#include "airfield/AirfieldCollection.h"
+#include "airfield/AirfieldModel.h"
+#include "approach/AirfieldApproachOptions.h"
+#include "approach/ApproachSequencer.h"
+#include "approach/ApproachSequencerOptions.h"
+#include "approach/ApproachSpacingCalculator.h"
+#include "approach/ApproachSpacingMonitor.h"
+#include "approach/ApproachSpacingTagItem.h"
+#include "controller/ControllerPositionHierarchy.h"
+#include "tag/TagData.h"
+#include "wake/WakeCategoryMapperCollection.h"
+
+using UKControllerPlugin::Airfield::AirfieldCollection;
+using UKControllerPlugin::Airfield::AirfieldModel;
+using UKControllerPlugin::Approach::AirfieldApproachOptions;
+using UKControllerPlugin::Approach::ApproachSequencer;
+using UKControllerPlugin::Approach::ApproachSequencerOptions;
+using UKControllerPlugin::Approach::ApproachSequencingMode;
+using UKControllerPlugin::Approach::ApproachSpacingCalculator;
+using UKControllerPlugin::Approach::ApproachSpacingMonitor;
+using UKControllerPlugin::Approach::ApproachSpacingTagItem;
+using UKControllerPlugin::Controller::ControllerPositionHierarchy;
+using UKControllerPlugin::Tag::TagData;
+using UKControllerPlugin::Wake::WakeCategoryMapperCollection;
+
+namespace UKControllerPluginTest::Approach {
+    class ApproachSpacingTagItemTest : public testing::Test
+    {
+        public:
+        ApproachSpacingTagItemTest()
+            : calculator(sequencerOptions, airfields, wakeMappers, plugin),
+              monitor(std::make_shared<ApproachSpacingMonitor>(sequencer, calculator)), tagItem(monitor)
+        {
+            airfields.AddAirfield(
+                std::make_shared<AirfieldModel>(1, "EGKK", std::make_unique<ControllerPositionHierarchy>()));
+            sequencerOptions.Set(
+                "EGKK", std::make_shared<AirfieldApproachOptions>(ApproachSequencingMode::WakeTurbulence, 6.0, 3.0));
+
+            ON_CALL(plugin, GetFlightplanForCallsign(testing::_)).WillByDefault(testing::Return(mockFlightplanPtr));
+            ON_CALL(mockFlightplan, GetCallsign).WillByDefault(testing::Return("BAW456"));
+
+            sequencer.AddAircraftToSequence("EGKK", "BAW123", ApproachSequencingMode::WakeTurbulence);
+            sequencer.AddAircraftToSequence("EGKK", "BAW456", ApproachSequencingMode::WakeTurbulence);
+            MoveAircraft("BAW123", 4.0);
+        }
+
+        void MoveAircraft(const std::string& callsign, double distance)
+        {
+            EuroScopePlugIn::CPosition position;
+            position.m_Latitude = 51.0 + (distance / 60);
+            position.m_Longitude = 0.0;
+
+            testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface> radarTarget;
+            ON_CALL(radarTarget, GetCallsign).WillByDefault(testing::Return(callsign));
+            ON_CALL(radarTarget, GetPosition).WillByDefault(testing::Return(position));
+            monitor->RadarTargetPositionUpdateEvent(radarTarget);
+        }
+
+        [[nodiscard]] auto MakeTagData(int itemCode) -> TagData
+        {
+            return TagData(
+                mockFlightplan,
+                mockRadarTarget,
+                itemCode,
+                EuroScopePlugIn::TAG_DATA_CORRELATED,
+                itemString,
+                &euroscopeColourCode,
+                &tagColour,
+                &fontSize);
+        }
+
+        double fontSize = 24.1;
+        COLORREF tagColour = RGB(255, 255, 255);
+        int euroscopeColourCode = EuroScopePlugIn::TAG_COLOR_ASSUMED;
+        char itemString[16] = "Foooooo";
+        testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface> mockFlightplan;
+        std::shared_ptr<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>> mockFlightplanPtr =
+            std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>>();
+        testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+        testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> plugin;
+        AirfieldCollection airfields;
+        WakeCategoryMapperCollection wakeMappers;
+        ApproachSequencerOptions sequencerOptions;
+        ApproachSequencer sequencer;
+        ApproachSpacingCalculator calculator;
+        std::shared_ptr<ApproachSpacingMonitor> monitor;
+        ApproachSpacingTagItem tagItem;
+    };
+
+    TEST_F(ApproachSpacingTagItemTest, ItHasTagItemDescriptions)
+    {
+        EXPECT_EQ("Approach Spacing Actual / Required", tagItem.GetTagItemDescription(133));
+        EXPECT_EQ("Approach Spacing Difference", tagItem.GetTagItemDescription(134));
+    }
+
+    TEST_F(ApproachSpacingTagItemTest, ItThrowsExceptionIfAskedAboutInvalidTagItem)
+    {
+        EXPECT_THROW(static_cast<void>(tagItem.GetTagItemDescription(0)), std::invalid_argument);
+    }
+
+    TEST_F(ApproachSpacingTagItemTest, ItDoesNothingIfNoSpacing)
+    {
+        auto tagData = MakeTagData(133);
+        tagItem.SetTagItemData(tagData);
+        EXPECT_EQ("Foooooo", tagData.GetItemString());
+        EXPECT_EQ(RGB(255, 255, 255), tagData.GetTagColour());
+    }
+
+    TEST_F(ApproachSpacingTagItemTest, ItSetsActualAndRequiredSpacing)
+    {
+        MoveAircraft("BAW456", 10.0);
+        auto tagData = MakeTagData(133);
+        tagItem.SetTagItemData(tagData);
+        EXPECT_EQ("6.0/3.0", tagData.GetItemString());
+        EXPECT_EQ(RGB(255, 255, 255), tagData.GetTagColour());
+    }
+
+    TEST_F(ApproachSpacingTagItemTest, ItSetsSpacingDifference)
+    {
+        MoveAircraft("BAW456", 10.0);
+        auto tagData = MakeTagData(134);
+        tagItem.SetTagItemData(tagData);
+        EXPECT_EQ("+3.0", tagData.GetItemString());
+        EXPECT_EQ(RGB(255, 255, 255), tagData.GetTagColour());
+    }
+
+    TEST_F(ApproachSpacingTagItemTest, ItHighlightsInsufficientSpacing)
+    {
+        MoveAircraft("BAW456", 6.0);
+        auto tagData = MakeTagData(134);
+        tagItem.SetTagItemData(tagData);
+        EXPECT_EQ("-1.0", tagData.GetItemString());
+        EXPECT_EQ(RGB(255, 87, 51), tagData.GetTagColour());
+    }
+} // namespace UKControllerPluginTest::Approach
@@ -39,9 +39,9 @@ namespace UKControllerPluginTest::Bootstrap {
         EXPECT_EQ(0, this->container.radarTargetHandler->CountHandlers());
     }
 
-    TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesFlightplanHandler)
+    TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesFlightplanHandlerWithTagItemMemo)
     {
-        EXPECT_EQ(0, this->container.flightplanHandler->CountHandlers());
+        EXPECT_EQ(1, this->container.flightplanHandler->CountHandlers());
     }
 
     TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesControllerHandler)
@@ -3,6 +3,7 @@
 #include "departure/UserShouldClearDepartureDataEvent.h"
 #include "departure/UserShouldClearDepartureDataMonitor.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "mock/MockDepartureHandoffResolver.h"
 #include "timedevent/TimedEventCollection.h"
 #include "bootstrap/PersistenceContainer.h"
@@ -52,6 +53,9 @@ namespace UKControllerPluginTest::Departure {
             container.tagHandler = std::make_unique<TagItemCollection>();
             container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
             container.timedHandler = std::make_unique<TimedEventCollection>();
+            container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
+            container.flightplanSweep =
+                std::make_shared<UKControllerPlugin::Flightplan::FlightplanSweep>(*container.plugin);
             container.flightplanHandler =
                 std::make_unique<UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection>();
             container.departureHandoffResolver =
@@ -82,11 +86,11 @@ namespace UKControllerPluginTest::Departure {
             UKControllerPluginUtils::EventHandler::EventHandlerFlags::Sync);
     }
 
-    TEST_F(DepartureModuleTest, PluginRegistersDepartureMonitorForTimedEvents)
+    TEST_F(DepartureModuleTest, PluginRegistersDepartureMonitorForFlightplanSweeps)
     {
         BootstrapPlugin(this->container);
-        EXPECT_EQ(1, this->container.timedHandler->CountHandlers());
-        EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(10));
+        EXPECT_EQ(1, this->container.flightplanSweep->CountStages());
+        EXPECT_EQ(1, this->container.flightplanSweep->CountStagesForFrequency(10));
     }
 
     TEST_F(DepartureModuleTest, RadarScreenAddsRenderable)
@@ -1,6 +1,7 @@
 #include "controller/ControllerStatusEventHandlerCollection.h"
 #include "departure/AircraftDepartedEvent.h"
 #include "departure/DepartureMonitor.h"
+#include "flightplan/FlightplanSweep.h"
 #include "login/Login.h"
 #include "mock/MockEuroScopeCFlightplanInterface.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
@@ -12,8 +13,11 @@ namespace UKControllerPluginTest::Departure {
     class DepartureMonitorTest : public UKControllerPluginUtilsTest::EventBusTestCase
     {
         public:
-        DepartureMonitorTest() : login(mockPlugin, controllerStatuses), monitor(login, mockPlugin)
+        DepartureMonitorTest() : login(mockPlugin, controllerStatuses), monitor(login), sweep(mockPlugin)
         {
+            sweep.RegisterStage(
+                std::shared_ptr<UKControllerPlugin::Flightplan::FlightplanSweepStage>(&monitor, [](auto*) {}), 1);
+
             mockFlightplan = std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>>();
             mockRadarTarget = std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>();
 
@@ -30,6 +34,7 @@ namespace UKControllerPluginTest::Departure {
         testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> mockPlugin;
         UKControllerPlugin::Controller::Login login;
         UKControllerPlugin::Departure::DepartureMonitor monitor;
+        UKControllerPlugin::Flightplan::FlightplanSweep sweep;
     };
 
     TEST_F(DepartureMonitorTest, ItSendsDepartedEvent)
@@ -40,7 +45,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertSingleEventDispatched();
         AssertFirstEventDispatched<UKControllerPlugin::Departure::AircraftDepartedEvent>([](const auto& event) {
@@ -57,7 +62,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertSingleEventDispatched();
         AssertFirstEventDispatched<UKControllerPlugin::Departure::AircraftDepartedEvent>([](const auto& event) {
@@ -65,7 +70,7 @@ namespace UKControllerPluginTest::Departure {
             EXPECT_EQ("EGKK", event.airfield);
         });
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
         AssertSingleEventDispatched();
     }
 
@@ -77,9 +82,9 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
         monitor.FlightPlanDisconnectEvent(*mockFlightplan);
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertEventDispatchCount(2);
         AssertEventDispatched<UKControllerPlugin::Departure::AircraftDepartedEvent>(1, [](const auto& event) {
@@ -96,12 +101,12 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         ON_CALL(*mockFlightplan, GetOrigin).WillByDefault(testing::Return("EGLL"));
 
         monitor.FlightPlanEvent(*mockFlightplan, *mockRadarTarget);
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertEventDispatchCount(2);
         AssertEventDispatched<UKControllerPlugin::Departure::AircraftDepartedEvent>(1, [](const auto& event) {
@@ -118,9 +123,9 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
         monitor.FlightPlanEvent(*mockFlightplan, *mockRadarTarget);
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertSingleEventDispatched();
     }
@@ -135,7 +140,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
@@ -148,7 +153,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
@@ -161,7 +166,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(5100));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
@@ -174,7 +179,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(1400));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
@@ -187,7 +192,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
@@ -200,7 +205,7 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(0));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
@@ -215,8 +220,59 @@ namespace UKControllerPluginTest::Departure {
 
         ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(3000));
 
-        monitor.TimedEventTrigger();
+        sweep.TimedEventTrigger();
 
         AssertNoEventsDispatched();
     }
+
+    TEST_F(DepartureMonitorTest, ItRestoresDeparturesFromSavedState)
+    {
+        ON_CALL(*mockFlightplan, GetDistanceFromOrigin).WillByDefault(testing::Return(2.5));
+
+        ON_CALL(*mockRadarTarget, GetGroundSpeed).WillByDefault(testing::Return(125));
+
+        ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
+
+        sweep.TimedEventTrigger();
+        const auto state = monitor.SaveState();
+        EXPECT_EQ(nlohmann::json({{"BAW123", "EGKK"}}), state);
+
+        UKControllerPlugin::Departure::DepartureMonitor restored(login);
+        restored.RestoreState(state);
+        EXPECT_EQ(state, restored.SaveState());
+    }
+
+    TEST_F(DepartureMonitorTest, ItDoesntSendDepartedEventsForRestoredDepartures)
+    {
+        ON_CALL(*mockFlightplan, GetDistanceFromOrigin).WillByDefault(testing::Return(2.5));
+
+        ON_CALL(*mockRadarTarget, GetGroundSpeed).WillByDefault(testing::Return(125));
+
+        ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
+
+        monitor.RestoreState({{"BAW123", "EGKK"}, {"EZY234", 55}});
+        sweep.TimedEventTrigger();
+
+        AssertNoEventsDispatched();
+        EXPECT_EQ(nlohmann::json({{"BAW123", "EGKK"}}), monitor.SaveState());
+    }
+
+    TEST_F(DepartureMonitorTest, ItSendsDepartedEventsOnceRestoredDeparturesExpire)
+    {
+        ON_CALL(*mockFlightplan, GetDistanceFromOrigin).WillByDefault(testing::Return(2.5));
+
+        ON_CALL(*mockRadarTarget, GetGroundSpeed).WillByDefault(testing::Return(125));
+
+        ON_CALL(*mockRadarTarget, GetFlightLevel).WillByDefault(testing::Return(2500));
+
+        monitor.RestoreState({{"BAW123", "EGKK"}});
+        monitor.ExpireRestoredState("BAW123");
+        sweep.TimedEventTrigger();
+
+        AssertSingleEventDispatched();
+        AssertFirstEventDispatched<UKControllerPlugin::Departure::AircraftDepartedEvent>([](const auto& event) {
+            EXPECT_EQ("BAW123", event.callsign);
+            EXPECT_EQ("EGKK", event.airfield);
+        });
+    }
 } // namespace UKControllerPluginTest::Departure
@@ -4,8 +4,11 @@
 #include "ECFMP/SdkEvents.h"
 #include "mock/FlowMeasureMock.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "mock/MockEuroscopeExtractedRouteInterface.h"
 #include "mock/MockEuroscopePluginLoopbackInterface.h"
 
+using UKControllerPlugin::ECFMP::FlowMeasureIndexKeys;
+
 namespace UKControllerPluginTest::ECFMP {
     class AircraftFlowMeasureMapTest : public testing::Test
     {
@@ -17,7 +20,10 @@ namespace UKControllerPluginTest::ECFMP {
               mockRadarTarget1(std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>()),
               mockFlightplan2(std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>>()),
               mockRadarTarget2(std::make_shared<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>()),
-              map(mockPlugin)
+              map(mockPlugin, [](const ::ECFMP::FlowMeasure::FlowMeasure&) { return FlowMeasureIndexKeys{}; }),
+              indexedMap(mockPlugin, [this](const ::ECFMP::FlowMeasure::FlowMeasure& measure) {
+                  return measureKeys[measure.Id()];
+              })
         {
             ON_CALL(*mockFlightplan1, GetCallsign).WillByDefault(testing::Return("BAW123"));
             ON_CALL(*mockFlightplan2, GetCallsign).WillByDefault(testing::Return("BAW456"));
@@ -28,6 +34,16 @@ namespace UKControllerPluginTest::ECFMP {
             ON_CALL(*mockRadarTarget1, GetEuroScopeObject).WillByDefault(testing::ReturnRef(euroscopeRadarTarget1));
             ON_CALL(*mockRadarTarget2, GetEuroScopeObject).WillByDefault(testing::ReturnRef(euroscopeRadarTarget2));
 
+            ON_CALL(*mockFlightplan1, GetOrigin).WillByDefault(testing::Return("EGKK"));
+            ON_CALL(*mockFlightplan2, GetOrigin).WillByDefault(testing::Return("EGLL"));
+            ON_CALL(*mockFlightplan1, GetExtractedRoute).WillByDefault(testing::ReturnRef(extractedRoute));
+            ON_CALL(*mockFlightplan2, GetExtractedRoute).WillByDefault(testing::ReturnRef(extractedRoute));
+
+            ON_CALL(mockPlugin, GetFlightplanForCallsign("BAW123")).WillByDefault(testing::Return(mockFlightplan1));
+            ON_CALL(mockPlugin, GetFlightplanForCallsign("BAW456")).WillByDefault(testing::Return(mockFlightplan2));
+            ON_CALL(mockPlugin, GetRadarTargetForCallsign("BAW123")).WillByDefault(testing::Return(mockRadarTarget1));
+            ON_CALL(mockPlugin, GetRadarTargetForCallsign("BAW456")).WillByDefault(testing::Return(mockRadarTarget2));
+
             mockPlugin.AddAllFlightplansItem({mockFlightplan1, mockRadarTarget1});
             mockPlugin.AddAllFlightplansItem({mockFlightplan2, mockRadarTarget2});
 
@@ -45,8 +61,11 @@ namespace UKControllerPluginTest::ECFMP {
         std::shared_ptr<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>> mockRadarTarget1;
         std::shared_ptr<testing::NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>> mockFlightplan2;
         std::shared_ptr<testing::NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>> mockRadarTarget2;
+        testing::NiceMock<Euroscope::MockEuroscopeExtractedRouteInterface> extractedRoute;
         testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> mockPlugin;
+        std::map<int, FlowMeasureIndexKeys> measureKeys;
         UKControllerPlugin::ECFMP::AircraftFlowMeasureMap map;
+        UKControllerPlugin::ECFMP::AircraftFlowMeasureMap indexedMap;
     };
 
     TEST_F(AircraftFlowMeasureMapTest, FlowMeasuresActivatingUpdateAircraftsActiveFlowMeasures)
@@ -435,4 +454,126 @@ namespace UKControllerPluginTest::ECFMP {
         EXPECT_EQ(1, map.GetFlowMeasuresForCallsign("BAW456").size());
         EXPECT_EQ(mockFlowMeasure2, *map.GetFlowMeasuresForCallsign("BAW456").begin());
     }
+
+    TEST_F(AircraftFlowMeasureMapTest, IndexedFlowMeasuresActivatingOnlyCheckCandidateFlightplans)
+    {
+        // Only flightplan 1 departs from Gatwick
+        measureKeys[1] = {{"EGKK"}, {}, {}, {}};
+        EXPECT_CALL(*mockFlowMeasure1, ApplicableToAircraft(testing::_, testing::_))
+            .Times(1)
+            .WillOnce(testing::Return(true));
+
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+
+        EXPECT_EQ(1, indexedMap.GetFlowMeasuresForCallsign("BAW123").size());
+        EXPECT_EQ(mockFlowMeasure1, *indexedMap.GetFlowMeasuresForCallsign("BAW123").begin());
+        EXPECT_EQ(0, indexedMap.GetFlowMeasuresForCallsign("BAW456").size());
+    }
+
+    TEST_F(AircraftFlowMeasureMapTest, IndexedFlowMeasuresActivatingCheckCandidatesInOneFlightplanWalk)
+    {
+        measureKeys[1] = {{"EGKK"}, {}, {}, {}};
+        measureKeys[2] = {{"EGLL"}, {}, {}, {}};
+        ON_CALL(*mockFlowMeasure2, ApplicableToAircraft(testing::_, testing::_)).WillByDefault(testing::Return(true));
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+        const auto loops = mockPlugin.CountFlightplanLoops();
+
+        EXPECT_CALL(mockPlugin, GetFlightplanForCallsign(testing::_)).Times(0);
+        EXPECT_CALL(mockPlugin, GetRadarTargetForCallsign(testing::_)).Times(0);
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure2});
+
+        EXPECT_EQ(loops + 1, mockPlugin.CountFlightplanLoops());
+        EXPECT_EQ(1, indexedMap.GetFlowMeasuresForCallsign("BAW456").size());
+        EXPECT_EQ(mockFlowMeasure2, *indexedMap.GetFlowMeasuresForCallsign("BAW456").begin());
+    }
+
+    TEST_F(AircraftFlowMeasureMapTest, IndexedFlowMeasuresWithNoCandidatesDontWalkTheFlightplans)
+    {
+        measureKeys[1] = {{"EGKK"}, {}, {}, {}};
+        measureKeys[2] = {{"EGCC"}, {}, {}, {}};
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+        const auto loops = mockPlugin.CountFlightplanLoops();
+
+        EXPECT_CALL(*mockFlowMeasure2, ApplicableToAircraft(testing::_, testing::_)).Times(0);
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure2});
+
+        EXPECT_EQ(loops, mockPlugin.CountFlightplanLoops());
+    }
+
+    TEST_F(AircraftFlowMeasureMapTest, UnindexedFlowMeasuresActivatingCheckEveryFlightplan)
+    {
+        EXPECT_CALL(*mockFlowMeasure1, ApplicableToAircraft(testing::_, testing::_))
+            .WillOnce(testing::Return(false))
+            .WillOnce(testing::Return(true));
+
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+
+        EXPECT_EQ(0, indexedMap.GetFlowMeasuresForCallsign("BAW123").size());
+        EXPECT_EQ(1, indexedMap.GetFlowMeasuresForCallsign("BAW456").size());
+        EXPECT_EQ(mockFlowMeasure1, *indexedMap.GetFlowMeasuresForCallsign("BAW456").begin());
+    }
+
+    TEST_F(AircraftFlowMeasureMapTest, FlightplansChangingOnlyCheckCandidateIndexedMeasures)
+    {
+        measureKeys[1] = {{"EGKK"}, {}, {}, {}};
+        measureKeys[2] = {{"EGLL"}, {}, {}, {}};
+
+        // Activation checks each measure against the flightplan departing its airfield, the event only measure 1
+        EXPECT_CALL(*mockFlowMeasure1, ApplicableToAircraft(testing::_, testing::_))
+            .WillOnce(testing::Return(false))
+            .WillOnce(testing::Return(true));
+
+        EXPECT_CALL(*mockFlowMeasure2, ApplicableToAircraft(testing::_, testing::_))
+            .Times(1)
+            .WillOnce(testing::Return(false));
+
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure2});
+        EXPECT_EQ(0, indexedMap.GetFlowMeasuresForCallsign("BAW123").size());
+
+        indexedMap.FlightPlanEvent(*mockFlightplan1, *mockRadarTarget1);
+        EXPECT_EQ(1, indexedMap.GetFlowMeasuresForCallsign("BAW123").size());
+        EXPECT_EQ(mockFlowMeasure1, *indexedMap.GetFlowMeasuresForCallsign("BAW123").begin());
+    }
+
+    TEST_F(AircraftFlowMeasureMapTest, FlightplansChangingAreReindexed)
+    {
+        measureKeys[1] = {{"EGKK"}, {}, {}, {}};
+        measureKeys[2] = {{"EGSS"}, {}, {}, {}};
+
+        EXPECT_CALL(*mockFlowMeasure1, ApplicableToAircraft(testing::_, testing::_))
+            .Times(1)
+            .WillOnce(testing::Return(false));
+
+        EXPECT_CALL(*mockFlowMeasure2, ApplicableToAircraft(testing::_, testing::_))
+            .Times(1)
+            .WillOnce(testing::Return(true));
+
+        // Flightplan 1 changes to depart Stansted after measure 1 has activated
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+        ON_CALL(*mockFlightplan1, GetOrigin).WillByDefault(testing::Return("EGSS"));
+        indexedMap.FlightPlanEvent(*mockFlightplan1, *mockRadarTarget1);
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure2});
+
+        EXPECT_EQ(1, indexedMap.GetFlowMeasuresForCallsign("BAW123").size());
+        EXPECT_EQ(mockFlowMeasure2, *indexedMap.GetFlowMeasuresForCallsign("BAW123").begin());
+    }
+
+    TEST_F(AircraftFlowMeasureMapTest, FlightplansDisconnectingAreRemovedFromTheIndex)
+    {
+        measureKeys[1] = {{"EGKK"}, {}, {}, {}};
+        measureKeys[2] = {{"EGKK"}, {}, {}, {}};
+
+        EXPECT_CALL(*mockFlowMeasure1, ApplicableToAircraft(testing::_, testing::_))
+            .Times(1)
+            .WillOnce(testing::Return(true));
+
+        EXPECT_CALL(*mockFlowMeasure2, ApplicableToAircraft(testing::_, testing::_)).Times(0);
+
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure1});
+        indexedMap.FlightPlanDisconnectEvent(*mockFlightplan1);
+        indexedMap.OnEvent(::ECFMP::Plugin::FlowMeasureActivatedEvent{mockFlowMeasure2});
+
+        EXPECT_EQ(0, indexedMap.GetFlowMeasuresForCallsign("BAW123").size());
+    }
 } // namespace UKControllerPluginTest::ECFMP
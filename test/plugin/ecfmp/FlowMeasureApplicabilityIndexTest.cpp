@@ -0,0 +1,513 @@
+#include "ecfmp/FlowMeasureApplicabilityIndex.h"
+#include "helper/Benchmark.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroscopeExtractedRouteInterface.h"
+
+using testing::ElementsAre;
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+using testing::Test;
+using UKControllerPlugin::ECFMP::FlightplanIndexKeys;
+using UKControllerPlugin::ECFMP::FlowMeasureApplicabilityIndex;
+using UKControllerPlugin::ECFMP::FlowMeasureIndexKeys;
+using UKControllerPluginTest::RunBenchmark;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
+
+namespace UKControllerPluginTest::ECFMP {
+
+    class FlowMeasureApplicabilityIndexTest : public Test
+    {
+        public:
+        /*
+            A stand-in for an ECFMP flow measure, evaluated by brute force in the same way as the SDK
+            evaluates its filters.
+        */
+        using SyntheticMeasure = struct SyntheticMeasure
+        {
+            std::set<std::string> departures;
+            std::set<std::string> arrivals;
+            int minimumLevel = -1;
+            int maximumLevel = -1;
+            std::set<int> levels;
+            std::set<std::string> waypoints;
+        };
+
+        using SyntheticFlightplan = struct SyntheticFlightplan
+        {
+            std::string callsign;
+            std::string origin;
+            std::string destination;
+            int cruiseAltitude;
+            std::set<std::string> waypoints;
+        };
+
+        static auto AirfieldApplicable(const std::set<std::string>& airfields, const std::string& airfield) -> bool
+        {
+            return airfields.empty() ||
+                   std::any_of(airfields.cbegin(), airfields.cend(), [&airfield](const std::string& pattern) {
+                       if (pattern.size() != airfield.size()) {
+                           return false;
+                       }
+
+                       for (size_t i = 0; i < pattern.size(); i++) {
+                           if (pattern[i] != '*' && pattern[i] != airfield[i]) {
+                               return false;
+                           }
+                       }
+
+                       return true;
+                   });
+        }
+
+        static auto AltitudeApplicable(const SyntheticMeasure& measure, int altitude) -> bool
+        {
+            if (!measure.levels.empty()) {
+                return measure.levels.contains(altitude / 100) && altitude % 100 == 0;
+            }
+
+            return (measure.minimumLevel == -1 || altitude >= measure.minimumLevel * 100) &&
+                   (measure.maximumLevel == -1 || altitude <= measure.maximumLevel * 100);
+        }
+
+        static auto Applicable(const SyntheticMeasure& measure, const SyntheticFlightplan& flightplan) -> bool
+        {
+            return AirfieldApplicable(measure.departures, flightplan.origin) &&
+                   AirfieldApplicable(measure.arrivals, flightplan.destination) &&
+                   AltitudeApplicable(measure, flightplan.cruiseAltitude) &&
+                   (measure.waypoints.empty() ||
+                    std::any_of(
+                        flightplan.waypoints.cbegin(),
+                        flightplan.waypoints.cend(),
+                        [&measure](const std::string& waypoint) { return measure.waypoints.contains(waypoint); }));
+        }
+
+        /*
+            Precompiles the measure in the same way as BuildFlowMeasureIndexKeys does for ECFMP measures.
+        */
+        static auto KeysForMeasure(const SyntheticMeasure& measure) -> FlowMeasureIndexKeys
+        {
+            FlowMeasureIndexKeys keys{measure.departures, measure.arrivals, {}, measure.waypoints};
+            if (measure.minimumLevel == -1 && measure.maximumLevel == -1 && measure.levels.empty()) {
+                return keys;
+            }
+
+            for (auto band = 0; band <= FlowMeasureApplicabilityIndex::maxLevelBand; band++) {
+                for (auto altitude = band * 1000; altitude < (band + 1) * 1000; altitude += 100) {
+                    if (AltitudeApplicable(measure, altitude)) {
+                        keys.levelBands.insert(band);
+                        break;
+                    }
+                }
+            }
+
+            return keys;
+        }
+
+        static auto KeysForFlightplan(const SyntheticFlightplan& flightplan) -> FlightplanIndexKeys
+        {
+            return {
+                flightplan.origin,
+                flightplan.destination,
+                FlowMeasureApplicabilityIndex::LevelBand(flightplan.cruiseAltitude),
+                flightplan.waypoints};
+        }
+
+        /*
+            Generates measures with a random mix of filters, drawing from a small pool of airfields and
+            waypoints so that plenty of them overlap.
+        */
+        static auto RandomMeasures(std::mt19937& random, int count) -> std::vector<SyntheticMeasure>
+        {
+            std::uniform_int_distribution<int> chance(0, 3);
+            std::uniform_int_distribution<size_t> airfield(0, airfields.size() - 1);
+            std::uniform_int_distribution<size_t> waypoint(0, waypoints.size() - 1);
+            std::uniform_int_distribution<int> level(0, 45); // NOLINT
+
+            std::vector<SyntheticMeasure> measures;
+            for (int i = 0; i < count; i++) {
+                SyntheticMeasure measure;
+                if (chance(random) == 0) {
+                    measure.departures.insert(airfields[airfield(random)]);
+                    measure.departures.insert(wildcardAirfields[airfield(random) % wildcardAirfields.size()]);
+                } else if (chance(random) != 0) {
+                    measure.departures.insert(airfields[airfield(random)]);
+                }
+
+                if (chance(random) == 0) {
+                    measure.arrivals.insert(wildcardAirfields[airfield(random) % wildcardAirfields.size()]);
+                } else if (chance(random) == 0) {
+                    measure.arrivals.insert(airfields[airfield(random)]);
+                    measure.arrivals.insert(airfields[airfield(random)]);
+                }
+
+                if (chance(random) == 0) {
+                    measure.waypoints.insert(waypoints[waypoint(random)]);
+                    measure.waypoints.insert(waypoints[waypoint(random)]);
+                }
+
+                const auto levelType = chance(random);
+                if (levelType == 0) {
+                    measure.minimumLevel = level(random) * 10; // NOLINT
+                } else if (levelType == 1) {
+                    measure.maximumLevel = level(random) * 10 + 5; // NOLINT
+                } else if (levelType == 2) {
+                    measure.levels = {level(random) * 10, level(random) * 10 + 5}; // NOLINT
+                }
+
+                measures.push_back(measure);
+            }
+
+            return measures;
+        }
+
+        static auto RandomFlightplans(std::mt19937& random, int count) -> std::vector<SyntheticFlightplan>
+        {
+            std::uniform_int_distribution<size_t> airfield(0, airfields.size() - 1);
+            std::uniform_int_distribution<size_t> waypoint(0, waypoints.size() - 1);
+            std::uniform_int_distribution<int> altitude(0, 900);  // NOLINT
+            std::uniform_int_distribution<int> routeLength(0, 6); // NOLINT
+
+            std::vector<SyntheticFlightplan> flightplans;
+            for (int i = 0; i < count; i++) {
+                SyntheticFlightplan flightplan{
+                    "BAW" + std::to_string(i),
+                    airfields[airfield(random)],
+                    airfields[airfield(random)],
+                    altitude(random) * 50, // NOLINT
+                    {}};
+
+                const auto length = routeLength(random);
+                for (int point = 0; point < length; point++) {
+                    flightplan.waypoints.insert(waypoints[waypoint(random)]);
+                }
+
+                flightplans.push_back(flightplan);
+            }
+
+            return flightplans;
+        }
+
+        inline static const std::vector<std::string> airfields{
+            "EGLL", "EGKK", "EGSS", "EGGW", "EGLC", "EGCC", "EGPH", "EGPF", "EHAM", "EDDF", "LFPG", "EIDW", "KJFK"};
+        inline static const std::vector<std::string> wildcardAirfields{"EG**", "EGP*", "ED**", "EH**", "K***"};
+        inline static const std::vector<std::string> waypoints{
+            "DVR", "LAM", "BPK", "CPT", "OCK", "MID", "SAM", "TLA", "GIRVA", "LISTO", "KONAN", "REDFA"};
+
+        FlowMeasureApplicabilityIndex index;
+    };
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresWithNoKeysAreNotIndexed)
+    {
+        index.AddMeasure(1, {});
+        EXPECT_FALSE(index.MeasureIsIndexed(1));
+        EXPECT_FALSE(index.HasIndexedMeasures());
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresWithKeysAreIndexed)
+    {
+        index.AddMeasure(1, {{"EGLL"}, {}, {}, {}});
+        EXPECT_TRUE(index.MeasureIsIndexed(1));
+        EXPECT_TRUE(index.HasIndexedMeasures());
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresThatDontExistAreNotIndexed)
+    {
+        EXPECT_FALSE(index.MeasureIsIndexed(1));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, UnindexedMeasuresAreAlwaysCandidates)
+    {
+        index.AddMeasure(1, {});
+        index.AddMeasure(2, {{"EGKK"}, {}, {}, {}});
+        EXPECT_THAT(index.CandidateMeasures({"EGLL", "EGPH", 35, {}}), ElementsAre(1));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresAreCandidatesByDepartureAirfield)
+    {
+        index.AddMeasure(1, {{"EGLL", "EGKK"}, {}, {}, {}});
+        index.AddMeasure(2, {{"EGSS"}, {}, {}, {}});
+        EXPECT_THAT(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}), ElementsAre(1));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresAreCandidatesByWildcardDepartureAirfield)
+    {
+        index.AddMeasure(1, {{"EG**"}, {}, {}, {}});
+        index.AddMeasure(2, {{"ED**"}, {}, {}, {}});
+        index.AddMeasure(3, {{"****"}, {}, {}, {}});
+        EXPECT_THAT(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}), ElementsAre(1, 3));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresAreCandidatesByArrivalAirfield)
+    {
+        index.AddMeasure(1, {{}, {"EGPH"}, {}, {}});
+        index.AddMeasure(2, {{}, {"EGP*"}, {}, {}});
+        index.AddMeasure(3, {{}, {"EGKK"}, {}, {}});
+        EXPECT_THAT(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}), ElementsAre(1, 2));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresAreCandidatesByWaypoint)
+    {
+        index.AddMeasure(1, {{}, {}, {}, {"LAM"}});
+        index.AddMeasure(2, {{}, {}, {}, {"DVR", "KONAN"}});
+        EXPECT_THAT(index.CandidateMeasures({"EGKK", "EGPH", 35, {"KONAN", "BPK"}}), ElementsAre(2));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, MeasuresAreCandidatesByLevelBand)
+    {
+        index.AddMeasure(1, {{}, {}, {34, 35, 36}, {}});
+        index.AddMeasure(2, {{}, {}, {24}, {}});
+        EXPECT_THAT(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}), ElementsAre(1));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, CandidateMeasuresMustMatchAllKeys)
+    {
+        index.AddMeasure(1, {{"EGKK"}, {"EGPH"}, {35}, {"BPK"}});
+        index.AddMeasure(2, {{"EGKK"}, {"EGPF"}, {}, {}});
+        index.AddMeasure(3, {{"EGKK"}, {}, {24}, {}});
+        index.AddMeasure(4, {{"EGKK"}, {}, {}, {"LAM"}});
+        EXPECT_THAT(index.CandidateMeasures({"EGKK", "EGPH", 35, {"BPK"}}), ElementsAre(1));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, RemovedMeasuresAreNotCandidates)
+    {
+        index.AddMeasure(1, {{"EGKK"}, {}, {}, {}});
+        index.AddMeasure(2, {{"EG**"}, {}, {}, {}});
+        index.AddMeasure(3, {});
+        index.RemoveMeasure(1);
+        index.RemoveMeasure(2);
+        index.RemoveMeasure(3);
+        EXPECT_TRUE(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}).empty());
+        EXPECT_FALSE(index.HasIndexedMeasures());
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, ReaddingAMeasureReplacesItsKeys)
+    {
+        index.AddMeasure(1, {{"EGKK"}, {}, {}, {}});
+        index.AddMeasure(1, {{"EGLL"}, {}, {}, {}});
+        EXPECT_TRUE(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}).empty());
+        EXPECT_THAT(index.CandidateMeasures({"EGLL", "EGPH", 35, {}}), ElementsAre(1));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, ItRemovesAllMeasures)
+    {
+        index.AddMeasure(1, {{"EGKK"}, {}, {}, {}});
+        index.AddMeasure(2, {});
+        index.RemoveAllMeasures();
+        EXPECT_TRUE(index.CandidateMeasures({"EGKK", "EGPH", 35, {}}).empty());
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, FlightplansAreCandidatesForMeasures)
+    {
+        index.AddFlightplan("BAW123", {"EGKK", "EGPH", 35, {"BPK"}});
+        index.AddFlightplan("BAW456", {"EGKK", "EGPF", 35, {"BPK"}});
+        index.AddFlightplan("BAW789", {"EGLL", "EGPH", 35, {"BPK"}});
+        index.AddMeasure(1, {{"EGKK"}, {"EGPH"}, {}, {}});
+        EXPECT_THAT(index.CandidateFlightplans(1), ElementsAre("BAW123"));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, FlightplansAreCandidatesForWildcardMeasures)
+    {
+        index.AddFlightplan("BAW123", {"EGKK", "EGPH", 35, {}});
+        index.AddFlightplan("BAW456", {"EGKK", "EGPF", 35, {}});
+        index.AddFlightplan("BAW789", {"EGLL", "EHAM", 35, {}});
+        index.AddMeasure(1, {{}, {"EGP*"}, {}, {}});
+        EXPECT_THAT(index.CandidateFlightplans(1), ElementsAre("BAW123", "BAW456"));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, FlightplansAreCandidatesForMeasuresByWaypointAndLevel)
+    {
+        index.AddFlightplan("BAW123", {"EGKK", "EGPH", 35, {"BPK"}});
+        index.AddFlightplan("BAW456", {"EGKK", "EGPF", 24, {"BPK"}});
+        index.AddFlightplan("BAW789", {"EGLL", "EHAM", 35, {"DVR"}});
+        index.AddMeasure(1, {{}, {}, {}, {"BPK"}});
+        index.AddMeasure(2, {{}, {}, {35}, {}});
+        EXPECT_THAT(index.CandidateFlightplans(1), ElementsAre("BAW123", "BAW456"));
+        EXPECT_THAT(index.CandidateFlightplans(2), ElementsAre("BAW123", "BAW789"));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, RemovedFlightplansAreNotCandidates)
+    {
+        index.AddFlightplan("BAW123", {"EGKK", "EGPH", 35, {"BPK"}});
+        index.AddFlightplan("BAW456", {"EGKK", "EGPF", 24, {"BPK"}});
+        index.RemoveFlightplan("BAW123");
+        index.AddMeasure(1, {{"EGKK"}, {}, {}, {}});
+        EXPECT_THAT(index.CandidateFlightplans(1), ElementsAre("BAW456"));
+        index.RemoveAllFlightplans();
+        EXPECT_TRUE(index.CandidateFlightplans(1).empty());
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, ReaddingAFlightplanReplacesItsKeys)
+    {
+        index.AddFlightplan("BAW123", {"EGKK", "EGPH", 35, {"BPK"}});
+        index.AddFlightplan("BAW123", {"EGLL", "EGPH", 35, {"BPK"}});
+        index.AddMeasure(1, {{"EGKK"}, {}, {}, {}});
+        EXPECT_TRUE(index.CandidateFlightplans(1).empty());
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, LevelBandsAreThousandsOfFeet)
+    {
+        EXPECT_EQ(0, FlowMeasureApplicabilityIndex::LevelBand(-500));
+        EXPECT_EQ(0, FlowMeasureApplicabilityIndex::LevelBand(999));
+        EXPECT_EQ(24, FlowMeasureApplicabilityIndex::LevelBand(24500));
+        EXPECT_EQ(35, FlowMeasureApplicabilityIndex::LevelBand(35000));
+        EXPECT_EQ(FlowMeasureApplicabilityIndex::maxLevelBand, FlowMeasureApplicabilityIndex::LevelBand(250000));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, ItBuildsKeysForFlightplans)
+    {
+        NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+        NiceMock<MockEuroscopeExtractedRouteInterface> extractedRoute;
+        ON_CALL(flightplan, GetOrigin).WillByDefault(Return("EGKK"));
+        ON_CALL(flightplan, GetDestination).WillByDefault(Return("EGPH"));
+        ON_CALL(flightplan, GetCruiseLevel).WillByDefault(Return(35000));
+        ON_CALL(flightplan, GetRawRouteString).WillByDefault(Return("LAM/N0450F350 L10 BPK"));
+        ON_CALL(flightplan, GetExtractedRoute).WillByDefault(ReturnRef(extractedRoute));
+        ON_CALL(extractedRoute, GetPointsNumber).WillByDefault(Return(3));
+        ON_CALL(extractedRoute, GetPointName(0)).WillByDefault(Return("LAM"));
+        ON_CALL(extractedRoute, GetPointName(1)).WillByDefault(Return("BRAIN"));
+        ON_CALL(extractedRoute, GetPointName(2)).WillByDefault(Return("BPK"));
+
+        const auto keys = FlowMeasureApplicabilityIndex::KeysForFlightplan(flightplan);
+        EXPECT_EQ("EGKK", keys.origin);
+        EXPECT_EQ("EGPH", keys.destination);
+        EXPECT_EQ(35, keys.levelBand);
+        EXPECT_THAT(keys.waypoints, ElementsAre("BPK", "BRAIN", "L10", "LAM"));
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, IndexedResultsMatchBruteForceEvaluation)
+    {
+        for (unsigned int seed = 0; seed < 20; seed++) { // NOLINT
+            std::mt19937 random(seed);
+            const auto measures = RandomMeasures(random, 100);       // NOLINT
+            const auto flightplans = RandomFlightplans(random, 300); // NOLINT
+
+            FlowMeasureApplicabilityIndex randomIndex;
+            for (size_t i = 0; i < flightplans.size(); i++) {
+                randomIndex.AddFlightplan(flightplans[i].callsign, KeysForFlightplan(flightplans[i]));
+            }
+            for (size_t i = 0; i < measures.size(); i++) {
+                randomIndex.AddMeasure(static_cast<int>(i), KeysForMeasure(measures[i]));
+            }
+
+            // When a flightplan changes, only the candidate measures get checked
+            for (const auto& flightplan : flightplans) {
+                std::set<int> expected;
+                for (size_t i = 0; i < measures.size(); i++) {
+                    if (Applicable(measures[i], flightplan)) {
+                        expected.insert(static_cast<int>(i));
+                    }
+                }
+
+                std::set<int> actual;
+                for (const auto id : randomIndex.CandidateMeasures(KeysForFlightplan(flightplan))) {
+                    if (Applicable(measures[id], flightplan)) {
+                        actual.insert(id);
+                    }
+                }
+
+                EXPECT_EQ(expected, actual) << "Seed " << seed << ", flightplan " << flightplan.callsign;
+            }
+
+            // When a measure activates, only the candidate flightplans get checked
+            for (size_t i = 0; i < measures.size(); i++) {
+                std::set<std::string> expected;
+                for (const auto& flightplan : flightplans) {
+                    if (Applicable(measures[i], flightplan)) {
+                        expected.insert(flightplan.callsign);
+                    }
+                }
+
+                std::set<std::string> actual;
+                if (!randomIndex.MeasureIsIndexed(static_cast<int>(i))) {
+                    actual = expected;
+                } else {
+                    for (const auto& callsign : randomIndex.CandidateFlightplans(static_cast<int>(i))) {
+                        const auto flightplan = std::stoi(callsign.substr(3));
+                        if (Applicable(measures[i], flightplans[flightplan])) {
+                            actual.insert(callsign);
+                        }
+                    }
+                }
+
+                EXPECT_EQ(expected, actual) << "Seed " << seed << ", measure " << i;
+            }
+        }
+    }
+
+    TEST_F(FlowMeasureApplicabilityIndexTest, DISABLED_BenchmarkIndexedApplicabilityAgainstBruteForce)
+    {
+        std::mt19937 random(42); // NOLINT
+        const auto measures = RandomMeasures(random, 200);        // NOLINT
+        const auto flightplans = RandomFlightplans(random, 1500); // NOLINT
+
+        FlowMeasureApplicabilityIndex benchmarkIndex;
+        for (const auto& flightplan : flightplans) {
+            benchmarkIndex.AddFlightplan(flightplan.callsign, KeysForFlightplan(flightplan));
+        }
+        for (size_t i = 0; i < measures.size(); i++) {
+            benchmarkIndex.AddMeasure(static_cast<int>(i), KeysForMeasure(measures[i]));
+        }
+
+        // Every flightplan having an event, checking every measure, as AircraftFlowMeasureMap previously did
+        size_t bruteForceApplicable = 0;
+        size_t indexedApplicable = 0;
+        RunBenchmark("Flightplan events (brute force)", 10, [&measures, &flightplans, &bruteForceApplicable] {
+            for (const auto& flightplan : flightplans) {
+                for (const auto& measure : measures) {
+                    bruteForceApplicable += Applicable(measure, flightplan) ? 1 : 0;
+                }
+            }
+        });
+        RunBenchmark(
+            "Flightplan events (index)", 10, [&benchmarkIndex, &measures, &flightplans, &indexedApplicable] {
+                for (const auto& flightplan : flightplans) {
+                    for (const auto id : benchmarkIndex.CandidateMeasures(KeysForFlightplan(flightplan))) {
+                        indexedApplicable += Applicable(measures[id], flightplan) ? 1 : 0;
+                    }
+                }
+            });
+
+        // Every measure activating, checking every flightplan
+        RunBenchmark("Measure activations (brute force)", 10, [&measures, &flightplans, &bruteForceApplicable] {
+            for (const auto& measure : measures) {
+                for (const auto& flightplan : flightplans) {
+                    bruteForceApplicable += Applicable(measure, flightplan) ? 1 : 0;
+                }
+            }
+        });
+        RunBenchmark(
+            "Measure activations (index)", 10, [&benchmarkIndex, &measures, &flightplans, &indexedApplicable] {
+                for (size_t i = 0; i < measures.size(); i++) {
+                    if (!benchmarkIndex.MeasureIsIndexed(static_cast<int>(i))) {
+                        for (const auto& flightplan : flightplans) {
+                            indexedApplicable += Applicable(measures[i], flightplan) ? 1 : 0;
+                        }
+                        continue;
+                    }
+
+                    for (const auto& callsign : benchmarkIndex.CandidateFlightplans(static_cast<int>(i))) {
+                        const auto& flightplan = flightplans[std::stoi(callsign.substr(3))];
+                        indexedApplicable += Applicable(measures[i], flightplan) ? 1 : 0;
+                    }
+                }
+            });
+
+        EXPECT_EQ(bruteForceApplicable, indexedApplicable);
+
+        // The synthetic check is far cheaper than the SDK evaluating real filters against EuroScope, so the number
+        // of checks that the index saves matters more than the timings above
+        size_t indexedChecks = 0;
+        for (const auto& flightplan : flightplans) {
+            indexedChecks += benchmarkIndex.CandidateMeasures(KeysForFlightplan(flightplan)).size();
+        }
+        for (size_t i = 0; i < measures.size(); i++) {
+            indexedChecks += benchmarkIndex.MeasureIsIndexed(static_cast<int>(i))
+                                 ? benchmarkIndex.CandidateFlightplans(static_cast<int>(i)).size()
+                                 : flightplans.size();
+        }
+        std::cout << "[ BENCHMARK] Applicability checks: " << measures.size() * flightplans.size() * 2
+                  << " brute force, " << indexedChecks << " indexed" << std::endl;
+    }
+} // namespace UKControllerPluginTest::ECFMP
@@ -0,0 +1,213 @@
+#include "ecfmp/FlowMeasureIndexKeys.h"
+#include "mock/AirportFilterMock.h"
+#include "mock/FlowMeasureFiltersMock.h"
+#include "mock/FlowMeasureMock.h"
+#include "mock/LevelRangeFilterMock.h"
+#include "mock/MultipleLevelFilterMock.h"
+#include "mock/RouteFilterMock.h"
+
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+using testing::Test;
+using UKControllerPlugin::ECFMP::BuildFlowMeasureIndexKeys;
+using UKControllerPlugin::ECFMP::FlowMeasureApplicabilityIndex;
+
+namespace UKControllerPluginTest::ECFMP {
+
+    class FlowMeasureIndexKeysTest : public Test
+    {
+        public:
+        FlowMeasureIndexKeysTest()
+        {
+            ON_CALL(measure, Filters).WillByDefault(ReturnRef(filters));
+            ON_CALL(filters, ForEachAirportFilter)
+                .WillByDefault([this](const std::function<void(const ::ECFMP::FlowMeasure::AirportFilter&)>& callback) {
+                    for (const auto& filter : airportFilters) {
+                        callback(*filter);
+                    }
+                });
+            ON_CALL(filters, ForEachLevelFilter)
+                .WillByDefault(
+                    [this](const std::function<void(const ::ECFMP::FlowMeasure::LevelRangeFilter&)>& callback) {
+                        for (const auto& filter : levelFilters) {
+                            callback(*filter);
+                        }
+                    });
+            ON_CALL(filters, ForEachMultipleLevelFilter)
+                .WillByDefault(
+                    [this](const std::function<void(const ::ECFMP::FlowMeasure::MultipleLevelFilter&)>& callback) {
+                        for (const auto& filter : multipleLevelFilters) {
+                            callback(*filter);
+                        }
+                    });
+            ON_CALL(filters, ForEachRouteFilter)
+                .WillByDefault([this](const std::function<void(const ::ECFMP::FlowMeasure::RouteFilter&)>& callback) {
+                    for (const auto& filter : routeFilters) {
+                        callback(*filter);
+                    }
+                });
+        }
+
+        void AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType type, std::set<std::string> airports)
+        {
+            const auto& strings = filterStrings.emplace_back(std::move(airports));
+            auto filter = std::make_shared<NiceMock<::ECFMP::Mock::FlowMeasure::AirportFilterMock>>();
+            ON_CALL(*filter, Type).WillByDefault(Return(type));
+            ON_CALL(*filter, AirportStrings).WillByDefault(ReturnRef(strings));
+            airportFilters.push_back(filter);
+        }
+
+        /*
+            Altitudes in feet, -1 for no limit, inclusive in the same way as the SDK.
+        */
+        void AddLevelRangeFilter(int minimum, int maximum)
+        {
+            auto filter = std::make_shared<NiceMock<::ECFMP::Mock::FlowMeasure::LevelRangeFilterMock>>();
+            ON_CALL(*filter, ApplicableToAltitude).WillByDefault([minimum, maximum](int altitude) {
+                return (minimum == -1 || altitude >= minimum) && (maximum == -1 || altitude <= maximum);
+            });
+            levelFilters.push_back(filter);
+        }
+
+        void AddMultipleLevelFilter(std::set<int> altitudes)
+        {
+            auto filter = std::make_shared<NiceMock<::ECFMP::Mock::FlowMeasure::MultipleLevelFilterMock>>();
+            ON_CALL(*filter, ApplicableToAltitude).WillByDefault([altitudes](int altitude) {
+                return altitudes.contains(altitude);
+            });
+            multipleLevelFilters.push_back(filter);
+        }
+
+        void AddRouteFilter(std::set<std::string> waypoints)
+        {
+            const auto& strings = filterStrings.emplace_back(std::move(waypoints));
+            auto filter = std::make_shared<NiceMock<::ECFMP::Mock::FlowMeasure::RouteFilterMock>>();
+            ON_CALL(*filter, RouteStrings).WillByDefault(ReturnRef(strings));
+            routeFilters.push_back(filter);
+        }
+
+        [[nodiscard]] static auto Bands(int from, int to) -> std::set<int>
+        {
+            std::set<int> bands;
+            for (auto band = from; band <= to; band++) {
+                bands.insert(band);
+            }
+
+            return bands;
+        }
+
+        // Strings returned by reference from the filters
+        std::list<std::set<std::string>> filterStrings;
+
+        std::vector<std::shared_ptr<NiceMock<::ECFMP::Mock::FlowMeasure::AirportFilterMock>>> airportFilters;
+        std::vector<std::shared_ptr<NiceMock<::ECFMP::Mock::FlowMeasure::LevelRangeFilterMock>>> levelFilters;
+        std::vector<std::shared_ptr<NiceMock<::ECFMP::Mock::FlowMeasure::MultipleLevelFilterMock>>>
+            multipleLevelFilters;
+        std::vector<std::shared_ptr<NiceMock<::ECFMP::Mock::FlowMeasure::RouteFilterMock>>> routeFilters;
+        NiceMock<::ECFMP::Mock::FlowMeasure::FlowMeasureFiltersMock> filters;
+        NiceMock<::ECFMP::Mock::FlowMeasure::FlowMeasureMock> measure;
+    };
+
+    TEST_F(FlowMeasureIndexKeysTest, ItHasNoKeysIfTheMeasureHasNoFilters)
+    {
+        const auto keys = BuildFlowMeasureIndexKeys(measure);
+        EXPECT_TRUE(keys.departureAirfields.empty());
+        EXPECT_TRUE(keys.arrivalAirfields.empty());
+        EXPECT_TRUE(keys.levelBands.empty());
+        EXPECT_TRUE(keys.waypoints.empty());
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeysDepartureAndArrivalAirports)
+    {
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Departure, {"EGKK", "EGLL"});
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Destination, {"LFPG"});
+
+        const auto keys = BuildFlowMeasureIndexKeys(measure);
+        EXPECT_EQ(std::set<std::string>({"EGKK", "EGLL"}), keys.departureAirfields);
+        EXPECT_EQ(std::set<std::string>({"LFPG"}), keys.arrivalAirfields);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeepsWildcardAirportsForTheIndexToMatch)
+    {
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Departure, {"EG**"});
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Destination, {"LF**", "EHAM"});
+
+        const auto keys = BuildFlowMeasureIndexKeys(measure);
+        EXPECT_EQ(std::set<std::string>({"EG**"}), keys.departureAirfields);
+        EXPECT_EQ(std::set<std::string>({"EHAM", "LF**"}), keys.arrivalAirfields);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItUsesTheFirstDepartureAndArrivalFilters)
+    {
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Departure, {"EGKK"});
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Destination, {"LFPG"});
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Departure, {"EGLL"});
+        AddAirportFilter(::ECFMP::FlowMeasure::AirportFilterType::Destination, {"EHAM"});
+
+        const auto keys = BuildFlowMeasureIndexKeys(measure);
+        EXPECT_EQ(std::set<std::string>({"EGKK"}), keys.departureAirfields);
+        EXPECT_EQ(std::set<std::string>({"LFPG"}), keys.arrivalAirfields);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeysEveryBandALevelRangeTouches)
+    {
+        AddLevelRangeFilter(24500, 35500);
+        EXPECT_EQ(Bands(24, 35), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItDoesntKeyBandsALevelRangeOnlyMeetsAtTheEdge)
+    {
+        AddLevelRangeFilter(25000, 30000);
+        EXPECT_EQ(Bands(25, 30), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeysASingleBandForALevelRangeWithinIt)
+    {
+        AddLevelRangeFilter(31100, 31900);
+        EXPECT_EQ(std::set<int>({31}), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeysOpenEndedLevelRanges)
+    {
+        AddLevelRangeFilter(40000, -1);
+        EXPECT_EQ(
+            Bands(40, FlowMeasureApplicabilityIndex::maxLevelBand), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeysMultipleLevelFilters)
+    {
+        AddMultipleLevelFilter({24000, 24500, 35900});
+        EXPECT_EQ(std::set<int>({24, 35}), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItUsesTheFirstLevelFilter)
+    {
+        AddLevelRangeFilter(25000, 26000);
+        AddLevelRangeFilter(30000, 31000);
+        AddMultipleLevelFilter({35000});
+
+        EXPECT_EQ(Bands(25, 26), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItUsesTheFirstMultipleLevelFilterIfThereIsNoLevelRange)
+    {
+        AddMultipleLevelFilter({35000});
+        AddMultipleLevelFilter({36000});
+
+        EXPECT_EQ(std::set<int>({35}), BuildFlowMeasureIndexKeys(measure).levelBands);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItKeysRouteStrings)
+    {
+        AddRouteFilter({"BPK", "TOTRI"});
+        EXPECT_EQ(std::set<std::string>({"BPK", "TOTRI"}), BuildFlowMeasureIndexKeys(measure).waypoints);
+    }
+
+    TEST_F(FlowMeasureIndexKeysTest, ItUsesTheFirstRouteFilter)
+    {
+        AddRouteFilter({"BPK"});
+        AddRouteFilter({"DVR"});
+        EXPECT_EQ(std::set<std::string>({"BPK"}), BuildFlowMeasureIndexKeys(measure).waypoints);
+    }
+} // namespace UKControllerPluginTest::ECFMP
@@ -0,0 +1,65 @@
+#include "euroscope/WrapperAllocationCounter.h"
+
+using UKControllerPlugin::Euroscope::WrapperAllocationCounter;
+
+namespace UKControllerPluginTest::Euroscope {
+
+    class WrapperAllocationCounterTest : public testing::Test
+    {
+        public:
+        WrapperAllocationCounterTest() : counter([this]() { return now; })
+        {
+        }
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::time_point(std::chrono::hours(1));
+        WrapperAllocationCounter counter;
+    };
+
+    TEST_F(WrapperAllocationCounterTest, ItStartsWithNoAllocations)
+    {
+        EXPECT_EQ(0, counter.TotalAllocations());
+        EXPECT_DOUBLE_EQ(0.0, counter.AllocationsPerSecond());
+    }
+
+    TEST_F(WrapperAllocationCounterTest, ItCountsAllocations)
+    {
+        counter.Allocated();
+        counter.Allocated();
+        counter.Allocated();
+        EXPECT_EQ(3, counter.TotalAllocations());
+    }
+
+    TEST_F(WrapperAllocationCounterTest, ItWorksOutTheAllocationRateWhenTriggered)
+    {
+        counter.Allocated();
+        counter.Allocated();
+        now += std::chrono::milliseconds(500);
+        counter.TimedEventTrigger();
+
+        EXPECT_DOUBLE_EQ(4.0, counter.AllocationsPerSecond());
+    }
+
+    TEST_F(WrapperAllocationCounterTest, ItDoesntWorkOutTheRateIfNoTimeHasPassed)
+    {
+        counter.Allocated();
+        counter.TimedEventTrigger();
+
+        EXPECT_DOUBLE_EQ(0.0, counter.AllocationsPerSecond());
+    }
+
+    TEST_F(WrapperAllocationCounterTest, ItOnlyCountsAllocationsSinceTheLastSample)
+    {
+        counter.Allocated();
+        now += std::chrono::seconds(1);
+        counter.TimedEventTrigger();
+        EXPECT_DOUBLE_EQ(1.0, counter.AllocationsPerSecond());
+
+        counter.Allocated();
+        counter.Allocated();
+        now += std::chrono::seconds(2);
+        counter.TimedEventTrigger();
+
+        EXPECT_DOUBLE_EQ(1.0, counter.AllocationsPerSecond());
+        EXPECT_EQ(3, counter.TotalAllocations());
+    }
+} // namespace UKControllerPluginTest::Euroscope
@@ -2,6 +2,7 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "timedevent/TimedEventCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
@@ -11,16 +12,15 @@ using UKControllerPlugin::TimedEvent::TimedEventCollection;
 namespace UKControllerPluginTest {
     namespace Flightplan {
 
-        TEST(FlightplanStorageBootstrap, BootstrapPluginAddsHandlerToTimedEvents)
+        TEST(FlightplanStorageBootstrap, BootstrapPluginOnlyAddsTheSweepToTimedEvents)
         {
             PersistenceContainer container;
             container.timedHandler = std::make_unique<TimedEventCollection>();
             container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
 
             FlightplanStorageBootstrap::BootstrapPlugin(container);
             EXPECT_EQ(1, container.timedHandler->CountHandlers());
-            EXPECT_EQ(
-                1, container.timedHandler->CountHandlersForFrequency(FlightplanStorageBootstrap::timedEventFrequency));
         }
 
         TEST(FlightplanStorageBootstrap, BootstrapPluginAddsHandlerToFlightplanEvents)
@@ -28,11 +28,24 @@ namespace UKControllerPluginTest {
             PersistenceContainer container;
             container.timedHandler = std::make_unique<TimedEventCollection>();
             container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
 
             FlightplanStorageBootstrap::BootstrapPlugin(container);
             EXPECT_EQ(1, container.flightplanHandler->CountHandlers());
+        }
+
+        TEST(FlightplanStorageBootstrap, BootstrapPluginCreatesTheFlightplanSweep)
+        {
+            PersistenceContainer container;
+            container.timedHandler = std::make_unique<TimedEventCollection>();
+            container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
+
+            FlightplanStorageBootstrap::BootstrapPlugin(container);
+            EXPECT_NE(nullptr, container.flightplanSweep);
+            EXPECT_EQ(0, container.flightplanSweep->CountStages());
             EXPECT_EQ(
-                1, container.timedHandler->CountHandlersForFrequency(FlightplanStorageBootstrap::timedEventFrequency));
+                1, container.timedHandler->CountHandlersForFrequency(FlightplanStorageBootstrap::sweepFrequency));
         }
     } // namespace Flightplan
 } // namespace UKControllerPluginTest
@@ -0,0 +1,149 @@
+#include "flightplan/FlightplanSweep.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::StrictMock;
+using UKControllerPlugin::Flightplan::FlightplanSweep;
+
+namespace UKControllerPluginTest::Flightplan {
+    class FlightplanSweepTest : public testing::Test
+    {
+        public:
+        FlightplanSweepTest() : sweep(plugin)
+        {
+            flightplan1 = std::make_shared<NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>>();
+            radarTarget1 = std::make_shared<NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>();
+            flightplan2 = std::make_shared<NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>>();
+            radarTarget2 = std::make_shared<NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>>();
+            plugin.AddAllFlightplansItem({flightplan1, radarTarget1});
+            plugin.AddAllFlightplansItem({flightplan2, radarTarget2});
+
+            stage1 = std::make_shared<NiceMock<MockFlightplanSweepStage>>();
+            stage2 = std::make_shared<NiceMock<MockFlightplanSweepStage>>();
+            ON_CALL(*stage1, ShouldSweep).WillByDefault(Return(true));
+            ON_CALL(*stage2, ShouldSweep).WillByDefault(Return(true));
+        }
+
+        std::shared_ptr<NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>> flightplan1;
+        std::shared_ptr<NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>> radarTarget1;
+        std::shared_ptr<NiceMock<Euroscope::MockEuroScopeCFlightPlanInterface>> flightplan2;
+        std::shared_ptr<NiceMock<Euroscope::MockEuroScopeCRadarTargetInterface>> radarTarget2;
+        std::shared_ptr<NiceMock<MockFlightplanSweepStage>> stage1;
+        std::shared_ptr<NiceMock<MockFlightplanSweepStage>> stage2;
+        NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> plugin;
+        FlightplanSweep sweep;
+    };
+
+    TEST_F(FlightplanSweepTest, ItStartsEmpty)
+    {
+        EXPECT_EQ(0, sweep.CountStages());
+    }
+
+    TEST_F(FlightplanSweepTest, ItRegistersStages)
+    {
+        sweep.RegisterStage(stage1, 5);
+        sweep.RegisterStage(stage2, 10);
+        EXPECT_EQ(2, sweep.CountStages());
+        EXPECT_EQ(1, sweep.CountStagesForFrequency(5));
+        EXPECT_EQ(1, sweep.CountStagesForFrequency(10));
+        EXPECT_EQ(0, sweep.CountStagesForFrequency(15));
+    }
+
+    TEST_F(FlightplanSweepTest, ItDoesntRegisterStagesWithInvalidFrequencies)
+    {
+        sweep.RegisterStage(stage1, 0);
+        EXPECT_EQ(0, sweep.CountStages());
+    }
+
+    TEST_F(FlightplanSweepTest, ItPassesEveryFlightplanToEveryDueStage)
+    {
+        sweep.RegisterStage(stage1, 1);
+        sweep.RegisterStage(stage2, 1);
+
+        testing::InSequence sequence;
+        EXPECT_CALL(*stage1, SweepFlightplan(testing::Ref(*flightplan1), testing::Ref(*radarTarget1))).Times(1);
+        EXPECT_CALL(*stage2, SweepFlightplan(testing::Ref(*flightplan1), testing::Ref(*radarTarget1))).Times(1);
+        EXPECT_CALL(*stage1, SweepFlightplan(testing::Ref(*flightplan2), testing::Ref(*radarTarget2))).Times(1);
+        EXPECT_CALL(*stage2, SweepFlightplan(testing::Ref(*flightplan2), testing::Ref(*radarTarget2))).Times(1);
+
+        sweep.TimedEventTrigger();
+    }
+
+    TEST_F(FlightplanSweepTest, ItSkipsStagesThatDontWantToSweep)
+    {
+        ON_CALL(*stage1, ShouldSweep).WillByDefault(Return(false));
+        sweep.RegisterStage(stage1, 1);
+        sweep.RegisterStage(stage2, 1);
+
+        EXPECT_CALL(*stage1, SweepFlightplan(_, _)).Times(0);
+        EXPECT_CALL(*stage2, SweepFlightplan(_, _)).Times(2);
+
+        sweep.TimedEventTrigger();
+    }
+
+    TEST_F(FlightplanSweepTest, ItDoesntWalkTheFlightplansIfNoStagesWantToSweep)
+    {
+        ON_CALL(*stage1, ShouldSweep).WillByDefault(Return(false));
+        sweep.RegisterStage(stage1, 1);
+        plugin.ExpectNoFlightplanLoop();
+
+        EXPECT_NO_THROW(sweep.TimedEventTrigger());
+    }
+
+    TEST_F(FlightplanSweepTest, ItRunsStagesAtTheirFrequency)
+    {
+        sweep.RegisterStage(stage1, 5);
+        EXPECT_CALL(*stage1, SweepFlightplan(_, _)).Times(4);
+
+        for (int i = 0; i < 10; i++) {
+            sweep.TimedEventTrigger();
+        }
+    }
+
+    TEST_F(FlightplanSweepTest, ItOnlyAsksDueStagesWhetherTheyWantToSweep)
+    {
+        auto strictStage = std::make_shared<StrictMock<MockFlightplanSweepStage>>();
+        sweep.RegisterStage(strictStage, 5);
+
+        EXPECT_CALL(*strictStage, ShouldSweep).Times(2).WillRepeatedly(Return(false));
+
+        for (int i = 0; i < 10; i++) {
+            sweep.TimedEventTrigger();
+        }
+    }
+
+    TEST_F(FlightplanSweepTest, ItSharesOneWalkBetweenStagesWithTheSameFrequency)
+    {
+        auto stage3 = std::make_shared<NiceMock<MockFlightplanSweepStage>>();
+        ON_CALL(*stage3, ShouldSweep).WillByDefault(Return(true));
+        sweep.RegisterStage(stage1, 10);
+        sweep.RegisterStage(stage2, 10);
+        sweep.RegisterStage(stage3, 10);
+
+        EXPECT_CALL(*stage1, SweepFlightplan(_, _)).Times(2);
+        EXPECT_CALL(*stage2, SweepFlightplan(_, _)).Times(2);
+        EXPECT_CALL(*stage3, SweepFlightplan(_, _)).Times(2);
+
+        for (int i = 0; i < 10; i++) {
+            sweep.TimedEventTrigger();
+        }
+
+        EXPECT_EQ(1, plugin.CountFlightplanLoops());
+    }
+
+    TEST_F(FlightplanSweepTest, ItSharesWalksBetweenStagesWhoseFrequenciesDivide)
+    {
+        sweep.RegisterStage(stage1, 5);
+        sweep.RegisterStage(stage2, 10);
+
+        EXPECT_CALL(*stage1, SweepFlightplan(_, _)).Times(4);
+        EXPECT_CALL(*stage2, SweepFlightplan(_, _)).Times(2);
+
+        for (int i = 0; i < 10; i++) {
+            sweep.TimedEventTrigger();
+        }
+
+        EXPECT_EQ(2, plugin.CountFlightplanLoops());
+    }
+} // namespace UKControllerPluginTest::Flightplan
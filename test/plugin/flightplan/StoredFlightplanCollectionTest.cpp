@@ -1,8 +1,11 @@
 #include "flightplan/StoredFlightplanCollection.h"
 #include "flightplan/StoredFlightplan.h"
 
+using ::testing::NiceMock;
+using ::testing::Return;
 using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
 
 namespace UKControllerPluginTest {
     namespace Flightplan {
@@ -63,5 +66,109 @@ namespace UKControllerPluginTest {
             EXPECT_FALSE(collection.HasFlightplanForCallsign("BAW456"));
         }
 
+        TEST(StoredFlightplanCollection, RemoveTimedOutPlansKeepsPlansThatHaventTimedOutYet)
+        {
+            StoredFlightplanCollection collection;
+            StoredFlightplan notTimedOut = StoredFlightplan("BAW456", "EGKK", "EGLL");
+            notTimedOut.SetTimeout(600);
+            collection.UpdatePlan(notTimedOut);
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW456"));
+        }
+
+        TEST(StoredFlightplanCollection, SetPlanTimeoutTimesOutThePlan)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+
+            collection.SetPlanTimeout("BAW123", -1);
+            collection.SetPlanTimeout("BAW456", 600);
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_FALSE(collection.HasFlightplanForCallsign("BAW123"));
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW456"));
+            EXPECT_TRUE(collection.GetFlightplanForCallsign("BAW456").HasTimeout());
+        }
+
+        TEST(StoredFlightplanCollection, SetPlanTimeoutDoesNothingIfNoPlan)
+        {
+            StoredFlightplanCollection collection;
+            EXPECT_NO_THROW(collection.SetPlanTimeout("BAW123", -1));
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanCancelsTheTimeoutIfTheNewPlanDoesntHaveOne)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -1);
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST(StoredFlightplanCollection, RemovingAPlanCancelsItsTimeout)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -1);
+            collection.RemovePlanByCallsign("BAW123");
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeAddsPlan)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            ON_CALL(flightplan, GetCallsign()).WillByDefault(Return("BAW123"));
+            ON_CALL(flightplan, GetOrigin()).WillByDefault(Return("EGKK"));
+            ON_CALL(flightplan, GetDestination()).WillByDefault(Return("EGLL"));
+
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(flightplan);
+
+            EXPECT_EQ("EGKK", collection.GetFlightplanForCallsign("BAW123").GetOrigin());
+            EXPECT_EQ("EGLL", collection.GetFlightplanForCallsign("BAW123").GetDestination());
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeUpdatesPlanInPlace)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            ON_CALL(flightplan, GetCallsign()).WillByDefault(Return("BAW123"));
+            ON_CALL(flightplan, GetOrigin()).WillByDefault(Return("EGKK"));
+            ON_CALL(flightplan, GetDestination()).WillByDefault(Return("EGPH"));
+
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            const auto* storedPlan = &collection.GetFlightplanForCallsign("BAW123");
+            collection.UpdatePlan(flightplan);
+
+            EXPECT_EQ(storedPlan, &collection.GetFlightplanForCallsign("BAW123"));
+            EXPECT_EQ("EGPH", storedPlan->GetDestination());
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeCancelsTimeout)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            ON_CALL(flightplan, GetCallsign()).WillByDefault(Return("BAW123"));
+
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(flightplan);
+            collection.SetPlanTimeout("BAW123", -1);
+            collection.UpdatePlan(flightplan);
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW123"));
+            EXPECT_FALSE(collection.GetFlightplanForCallsign("BAW123").HasTimeout());
+        }
+
     } // namespace Flightplan
 } // namespace UKControllerPluginTest
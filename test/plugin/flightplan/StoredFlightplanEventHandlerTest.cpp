@@ -137,18 +137,64 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(plan.GetTimeout() == 0);
         }
 
-        TEST_F(StoredFlightplanEventHandlerTest, TimedEventTriggerRemovesTimedOutFlightplans)
+        TEST_F(StoredFlightplanEventHandlerTest, ItRestoresFlightplansFromSavedState)
         {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplanMock;
+            ON_CALL(flightplanMock, GetCallsign()).WillByDefault(Return("BAW123"));
+            ON_CALL(flightplanMock, GetOrigin()).WillByDefault(Return("EGKK"));
+            ON_CALL(flightplanMock, GetDestination()).WillByDefault(Return("EGCC"));
+            NiceMock<MockEuroScopeCFlightPlanInterface> disconnectedMock;
+            ON_CALL(disconnectedMock, GetCallsign()).WillByDefault(Return("EZY234"));
+            ON_CALL(disconnectedMock, GetOrigin()).WillByDefault(Return("EGGD"));
+            ON_CALL(disconnectedMock, GetDestination()).WillByDefault(Return("EGPH"));
+            NiceMock<MockEuroScopeCRadarTargetInterface> radarTargetMock;
+
             StoredFlightplanEventHandler handler(collection);
-            StoredFlightplan planOk("BAW456", "EGKK", "EGLL");
-            StoredFlightplan planTimedOut("BAW123", "EGLL", "EGKK");
-            planTimedOut.SetTimeout(-1);
-            collection.UpdatePlan(planOk);
-            collection.UpdatePlan(planTimedOut);
-
-            handler.TimedEventTrigger();
-            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW456"));
+            handler.FlightPlanEvent(flightplanMock, radarTargetMock);
+            handler.FlightPlanEvent(disconnectedMock, radarTargetMock);
+            handler.FlightPlanDisconnectEvent(disconnectedMock);
+            const auto state = handler.SaveState();
+
+            StoredFlightplanCollection restoredCollection;
+            StoredFlightplanEventHandler restored(restoredCollection);
+            restored.RestoreState(state);
+
+            EXPECT_EQ("EGKK", restoredCollection.GetFlightplanForCallsign("BAW123").GetOrigin());
+            EXPECT_EQ("EGCC", restoredCollection.GetFlightplanForCallsign("BAW123").GetDestination());
+            EXPECT_FALSE(restoredCollection.GetFlightplanForCallsign("BAW123").HasTimeout());
+            EXPECT_EQ("EGGD", restoredCollection.GetFlightplanForCallsign("EZY234").GetOrigin());
+            EXPECT_TRUE(restoredCollection.GetFlightplanForCallsign("EZY234").HasTimeout());
+        }
+
+        TEST_F(StoredFlightplanEventHandlerTest, ItDoesntRestoreInvalidFlightplansFromState)
+        {
+            StoredFlightplanEventHandler handler(collection);
+            handler.RestoreState({{"BAW123", {{"origin", "EGKK"}}}, {"EZY234", "EGGD"}});
+
             EXPECT_FALSE(collection.HasFlightplanForCallsign("BAW123"));
+            EXPECT_FALSE(collection.HasFlightplanForCallsign("EZY234"));
+        }
+
+        TEST_F(StoredFlightplanEventHandlerTest, ItStartsTheTimeoutOfExpiredRestoredFlightplans)
+        {
+            StoredFlightplanEventHandler handler(collection);
+            handler.RestoreState(
+                {{"BAW123", {{"origin", "EGKK"}, {"destination", "EGCC"}, {"squawk", "1234"}, {"timeout", 0}}}});
+            EXPECT_FALSE(collection.GetFlightplanForCallsign("BAW123").HasTimeout());
+
+            handler.ExpireRestoredState("BAW123");
+            EXPECT_TRUE(collection.GetFlightplanForCallsign("BAW123").HasTimeout());
+        }
+
+        TEST_F(StoredFlightplanEventHandlerTest, ItDoesntResetTheTimeoutOfExpiredRestoredFlightplans)
+        {
+            StoredFlightplanEventHandler handler(collection);
+            handler.RestoreState(
+                {{"BAW123", {{"origin", "EGKK"}, {"destination", "EGCC"}, {"squawk", "1234"}, {"timeout", 1}}}});
+            const auto timeout = collection.GetFlightplanForCallsign("BAW123").GetTimeout();
+
+            handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ(timeout, collection.GetFlightplanForCallsign("BAW123").GetTimeout());
         }
     } // namespace Flightplan
 } // namespace UKControllerPluginTest
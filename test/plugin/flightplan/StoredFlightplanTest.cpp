@@ -147,6 +147,45 @@ namespace UKControllerPluginTest::Flightplan {
         EXPECT_FALSE(plan.HasTimedOut());
     }
 
+    TEST(StoredFlightplan, HasTimeoutReturnsFalseIfNotSet)
+    {
+        StoredFlightplan plan("BAW123", "EGKK", "EDDM");
+        EXPECT_FALSE(plan.HasTimeout());
+    }
+
+    TEST(StoredFlightplan, HasTimeoutReturnsTrueIfSet)
+    {
+        StoredFlightplan plan("BAW123", "EGKK", "EDDM");
+        plan.SetTimeout(600);
+        EXPECT_TRUE(plan.HasTimeout());
+    }
+
+    TEST(StoredFlightplan, RefreshUpdatesDetailsFromEuroscope)
+    {
+        NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+        ON_CALL(mockEuroscope, GetCallsign()).WillByDefault(Return("BAW123"));
+        ON_CALL(mockEuroscope, GetOrigin()).WillByDefault(Return("EGLL"));
+        ON_CALL(mockEuroscope, GetDestination()).WillByDefault(Return("EDDF"));
+        ON_CALL(mockEuroscope, HasAssignedSquawk()).WillByDefault(Return(true));
+        ON_CALL(mockEuroscope, GetAssignedSquawk()).WillByDefault(Return("2415"));
+        ON_CALL(mockEuroscope, GetExpectedDepartureTime()).WillByDefault(Return("2301"));
+
+        StoredFlightplan plan("BAW123", "EGKK", "EDDM");
+        const auto aobt = std::chrono::system_clock::now();
+        plan.SetActualOffBlockTime(aobt);
+        plan.SetTimeout(600);
+        plan.Refresh(mockEuroscope);
+
+        EXPECT_EQ("EGLL", plan.GetOrigin());
+        EXPECT_EQ("EDDF", plan.GetDestination());
+        EXPECT_EQ("2415", plan.GetPreviouslyAssignedSquawk());
+        EXPECT_EQ(
+            HelperFunctions::GetTimeFromNumberString("2301") - std::chrono::minutes(15),
+            plan.GetExpectedOffBlockTime());
+        EXPECT_EQ(aobt, plan.GetActualOffBlockTime());
+        EXPECT_TRUE(plan.HasTimeout());
+    }
+
     TEST(StoredFlightplan, TestItSetsADefaultOffBlockTime)
     {
         StoredFlightplan plan("BAW123", "EGKK", "EDDM");
@@ -5,7 +5,10 @@
 #include "navaids/Navaid.h"
 #include "navaids/NavaidCollection.h"
 #include "push/PushEvent.h"
+#include "push/PushEventRingBuffer.h"
 #include "push/PushEventSubscription.h"
+#include "push/SharedSyncData.h"
+#include "push/SyncSnapshotStore.h"
 #include "time/SystemClock.h"
 #include "time/ParseTimeStrings.h"
 
@@ -14,7 +17,10 @@ using UKControllerPlugin::Hold::HoldManager;
 using UKControllerPlugin::Navaids::Navaid;
 using UKControllerPlugin::Navaids::NavaidCollection;
 using UKControllerPlugin::Push::PushEvent;
+using UKControllerPlugin::Push::PushEventRingBuffer;
 using UKControllerPlugin::Push::PushEventSubscription;
+using UKControllerPlugin::Push::SharedSyncData;
+using UKControllerPlugin::Push::SyncSnapshotStore;
 using UKControllerPlugin::Time::ParseIsoZuluString;
 using UKControllerPlugin::Time::SetTestNow;
 using UKControllerPlugin::Time::TimeNow;
@@ -138,4 +144,23 @@ namespace UKControllerPluginTest::Hold {
         handler.ProcessPushEvent(MakePushEvent(nlohmann::json::object({{"entered_at", "abc"}})));
         EXPECT_EQ(0, holdManager.CountHoldingAircraft());
     }
+
+    TEST_F(AircraftEnteredHoldingAreaEventHandlerTest, ItUsesSharedDataOnPluginEventsSyncAsSecondaryInstance)
+    {
+        std::vector<uint64_t> eventMemory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1);
+        std::vector<uint64_t> snapshotMemory(SyncSnapshotStore::RequiredSize(2, 256) / sizeof(uint64_t) + 1);
+        auto events = std::make_shared<PushEventRingBuffer>(eventMemory.data(), 4, 64);
+        auto snapshots = std::make_shared<SyncSnapshotStore>(snapshotMemory.data(), 2, 256);
+        events->Initialise();
+        snapshots->Initialise();
+        handler.SetSharedSyncData(std::make_shared<SharedSyncData>(snapshots, events, false));
+        SharedSyncData(snapshots, events, true)
+            .Publish(
+                AircraftEnteredHoldingAreaEventHandler::sharedSyncKey,
+                nlohmann::json::array({MakePushEvent().data, MakePushEvent({{"callsign", "BAW456"}}).data}));
+
+        handler.PluginEventsSynced();
+        EXPECT_EQ(2, holdManager.CountHoldingAircraft());
+        EXPECT_NE(nullptr, holdManager.GetHoldingAircraft("BAW456"));
+    }
 } // namespace UKControllerPluginTest::Hold
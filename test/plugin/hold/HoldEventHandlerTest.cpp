@@ -2,6 +2,7 @@
 #include "hold/DeemedSeparatedHold.h"
 #include "hold/HoldingAircraft.h"
 #include "hold/HoldManager.h"
+#include "flightplan/FlightplanSweep.h"
 #include "hold/HoldEventHandler.h"
 #include "hold/HoldingData.h"
 #include "hold/ProximityHold.h"
@@ -44,7 +45,7 @@ namespace UKControllerPluginTest {
         {
             public:
             HoldEventHandlerTest()
-                : manager(mockApi, mockTaskRunner), handler(this->manager, this->navaids, this->mockPlugin),
+                : manager(mockApi, mockTaskRunner), handler(this->manager, this->navaids),
                   tagData(
                       mockFlightplan,
                       mockRadarTarget,
@@ -53,8 +54,12 @@ namespace UKControllerPluginTest {
                       itemString,
                       &euroscopeColourCode,
                       &tagColour,
-                      &fontSize)
+                      &fontSize),
+                  sweep(this->mockPlugin)
             {
+                this->sweep.RegisterStage(
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightplanSweepStage>(&this->handler, [](auto*) {}),
+                    1);
                 this->navaids.AddNavaid({1, "TIMBA", ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000")});
                 this->navaids.AddNavaid({2, "MAY", ParseSectorFileCoordinates("N051.01.02.000", "E000.06.58.000")});
                 this->navaids.AddNavaid({3, "OLEVI", ParseSectorFileCoordinates("N051.11.17.400", "E000.06.11.300")});
@@ -99,6 +104,7 @@ namespace UKControllerPluginTest {
             HoldManager manager;
             HoldEventHandler handler;
             TagData tagData;
+            UKControllerPlugin::Flightplan::FlightplanSweep sweep;
             std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>> mockFlightplanPointer;
         };
 
@@ -319,7 +325,7 @@ namespace UKControllerPluginTest {
             this->CreateFlightplanRadarTargetPair(
                 "EZY234", ParseSectorFileCoordinates("N051.01.02.000", "E000.06.58.000"));
 
-            this->handler.TimedEventTrigger();
+            this->sweep.TimedEventTrigger();
 
             // EZY234
             EXPECT_EQ("EZY234", (*this->manager.GetAircraftForHold("TIMBA").cbegin())->GetCallsign());
@@ -370,12 +376,12 @@ namespace UKControllerPluginTest {
             this->CreateFlightplanRadarTargetPair(
                 "RYR123", ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000"));
 
-            this->handler.TimedEventTrigger();
+            this->sweep.TimedEventTrigger();
 
             auto timeBefore = TimeNow();
             EXPECT_EQ(timeBefore, this->manager.GetHoldingAircraft("RYR123")->GetProximityHold("TIMBA")->EnteredAt());
             SetTestNow(TimeNow() + std::chrono::seconds(10));
-            this->handler.TimedEventTrigger();
+            this->sweep.TimedEventTrigger();
             EXPECT_EQ(timeBefore, this->manager.GetHoldingAircraft("RYR123")->GetProximityHold("TIMBA")->EnteredAt());
         }
 
@@ -388,7 +394,7 @@ namespace UKControllerPluginTest {
             this->manager.AddAircraftToProximityHold(std::make_shared<ProximityHold>("RYR123", "OLEVI"));
             this->manager.AddAircraftToProximityHold(std::make_shared<ProximityHold>("RYR123", "MAY"));
 
-            this->handler.TimedEventTrigger();
+            this->sweep.TimedEventTrigger();
 
             EXPECT_EQ("RYR123", (*this->manager.GetAircraftForHold("SAM").cbegin())->GetCallsign());
             EXPECT_EQ(0, this->manager.GetAircraftForHold("OLEVI").size());
@@ -396,5 +402,52 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, this->manager.GetHoldingAircraft("RYR123")->GetProximityHolds().size());
             EXPECT_NE(nullptr, this->manager.GetHoldingAircraft("RYR123")->GetProximityHold("SAM"));
         }
+
+        TEST_F(HoldEventHandlerTest, ItSavesAssignedHoldsAsState)
+        {
+            EXPECT_EQ(nlohmann::json({{"BAW123", "TIMBA"}}), this->handler.SaveState());
+        }
+
+        TEST_F(HoldEventHandlerTest, ItRestoresAssignedHoldsFromSavedState)
+        {
+            EXPECT_CALL(this->mockApi, AssignAircraftToHold(_, _)).Times(0);
+
+            HoldManager restoredManager(mockApi, mockTaskRunner);
+            HoldEventHandler restored(restoredManager, this->navaids);
+            restored.RestoreState(this->handler.SaveState());
+
+            EXPECT_EQ("TIMBA", restoredManager.GetHoldingAircraft("BAW123")->GetAssignedHold());
+            EXPECT_EQ(this->handler.SaveState(), restored.SaveState());
+        }
+
+        TEST_F(HoldEventHandlerTest, ItDoesntRestoreInvalidHoldsFromState)
+        {
+            this->handler.RestoreState({{"EZY234", 55}});
+            EXPECT_EQ(this->manager.invalidAircraft, this->manager.GetHoldingAircraft("EZY234"));
+        }
+
+        TEST_F(HoldEventHandlerTest, ItExpiresRestoredHolds)
+        {
+            EXPECT_CALL(this->mockApi, UnassignAircraftHold(_)).Times(0);
+
+            this->handler.RestoreState({{"EZY234", "MAY"}});
+            this->handler.ExpireRestoredState("EZY234");
+            EXPECT_EQ(this->manager.invalidAircraft, this->manager.GetHoldingAircraft("EZY234"));
+            EXPECT_EQ("TIMBA", this->manager.GetHoldingAircraft("BAW123")->GetAssignedHold());
+        }
+
+        TEST_F(HoldEventHandlerTest, ItDoesntExpireRestoredHoldsThatHaveSinceChanged)
+        {
+            this->handler.RestoreState({{"EZY234", "MAY"}});
+            this->manager.AssignAircraftToHold("EZY234", "SAM", false);
+            this->handler.ExpireRestoredState("EZY234");
+            EXPECT_EQ("SAM", this->manager.GetHoldingAircraft("EZY234")->GetAssignedHold());
+        }
+
+        TEST_F(HoldEventHandlerTest, ItDoesntExpireHoldsThatWerentRestored)
+        {
+            this->handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ("TIMBA", this->manager.GetHoldingAircraft("BAW123")->GetAssignedHold());
+        }
     } // namespace Hold
 } // namespace UKControllerPluginTest
@@ -18,6 +18,7 @@
 #include "push/PushEventProcessorCollection.h"
 #include "api/ApiException.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "hold/HoldManager.h"
 #include "hold/PublishedHoldCollection.h"
 #include "hold/HoldSelectionMenu.h"
@@ -106,6 +107,9 @@ namespace UKControllerPluginTest::Hold {
 
             this->container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
             this->container.timedHandler = std::make_unique<TimedEventCollection>();
+            this->container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
+            this->container.flightplanSweep =
+                std::make_shared<UKControllerPlugin::Flightplan::FlightplanSweep>(*this->container.plugin);
             this->container.commandHandlers = std::make_unique<CommandHandlerCollection>();
             this->container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
             this->container.windows = std::make_unique<NiceMock<MockWinApi>>();
@@ -141,11 +145,11 @@ namespace UKControllerPluginTest::Hold {
         EXPECT_EQ(1, this->container.tagHandler->CountHandlers());
     }
 
-    TEST_F(HoldModuleTest, ItAddsToTimedHandler)
+    TEST_F(HoldModuleTest, ItAddsToFlightplanSweep)
     {
         BootstrapPlugin(this->mockDependencyProvider, this->container);
-        EXPECT_EQ(1, this->container.timedHandler->CountHandlers());
-        EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(7));
+        EXPECT_EQ(1, this->container.flightplanSweep->CountStages());
+        EXPECT_EQ(1, this->container.flightplanSweep->CountStagesForFrequency(7));
     }
 
     TEST_F(HoldModuleTest, ItAddsToFunctionHandlers)
@@ -1,3 +1,4 @@
+#include "flightplan/FlightplanSweep.h"
 #include "initialaltitude/InitialAltitudeEventHandler.h"
 #include "ownership/AirfieldServiceProviderCollection.h"
 #include "ownership/ServiceProvision.h"
@@ -45,8 +46,10 @@ namespace UKControllerPluginTest {
                   userCallsign("LON_S_CTR", "Test", controller, true),
                   notUserCallsign("LON_S_CTR", "Test", controller, false),
                   login(plugin, ControllerStatusEventHandlerCollection()),
-                  handler(sidMapper, callsigns, owners, login, plugin)
+                  handler(sidMapper, callsigns, owners, login, plugin), sweep(plugin)
             {
+                sweep.RegisterStage(
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightplanSweepStage>(&handler, [](auto*) {}), 1);
             }
 
             void SetUp() override
@@ -76,6 +79,22 @@ namespace UKControllerPluginTest {
                         std::make_shared<UKControllerPlugin::Controller::ActiveCallsign>(callsign))});
             }
 
+            void AllowAssignment()
+            {
+                callsigns.AddUserCallsign(userCallsign);
+                this->SetServiceProvision(true);
+                ON_CALL(mockFlightPlan, GetDistanceFromOrigin()).WillByDefault(Return(MAX_DISTANCE_FROM_ORIGIN));
+                ON_CALL(mockRadarTarget, GetFlightLevel()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE));
+                ON_CALL(mockRadarTarget, GetAltitude()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE));
+                ON_CALL(mockRadarTarget, GetGroundSpeed()).WillByDefault(Return(MAX_ASSIGNMENT_SPEED));
+                ON_CALL(mockFlightPlan, HasControllerClearedAltitude()).WillByDefault(Return(false));
+                ON_CALL(mockFlightPlan, IsTracked()).WillByDefault(Return(false));
+                ON_CALL(mockFlightPlan, IsSimulated()).WillByDefault(Return(false));
+                ON_CALL(mockFlightPlan, GetSidName()).WillByDefault(Return("ADMAG2X"));
+                ON_CALL(mockFlightPlan, GetOrigin()).WillByDefault(Return("EGKK"));
+                ON_CALL(mockFlightPlan, GetCruiseLevel()).WillByDefault(Return(6000));
+            }
+
             inline static const double MAX_DISTANCE_FROM_ORIGIN = 3.0;
             inline static const int MAX_ASSIGNMENT_ALTITUDE = 1000;
             inline static const int MAX_ASSIGNMENT_SPEED = 40;
@@ -94,6 +113,7 @@ namespace UKControllerPluginTest {
             ActiveCallsignCollection callsigns;
             AirfieldServiceProviderCollection owners;
             InitialAltitudeEventHandler handler;
+            UKControllerPlugin::Flightplan::FlightplanSweep sweep;
         };
 
         TEST_F(InitialAltitudeEventHandlerTest, TestItDefaultsUserSettingToEnabled)
@@ -778,7 +798,7 @@ namespace UKControllerPluginTest {
             ON_CALL(*this->mockRadarTargetPointer, GetFlightLevel()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE - 1));
             ON_CALL(*this->mockRadarTargetPointer, GetAltitude()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE - 1));
 
-            handler.TimedEventTrigger();
+            sweep.TimedEventTrigger();
         }
 
         TEST_F(InitialAltitudeEventHandlerTest, TimedEventDoesNotAssignIfNoUserCallsign)
@@ -788,7 +808,39 @@ namespace UKControllerPluginTest {
             this->plugin.AddAllFlightplansItem({this->mockFlightplanPointer, this->mockRadarTargetPointer});
             this->plugin.ExpectNoFlightplanLoop();
 
-            handler.TimedEventTrigger();
+            sweep.TimedEventTrigger();
+        }
+
+        TEST_F(InitialAltitudeEventHandlerTest, ItRestoresAssignmentsFromSavedState)
+        {
+            this->AllowAssignment();
+            EXPECT_CALL(mockFlightPlan, SetClearedAltitude(6000)).Times(1);
+            handler.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+
+            const auto state = handler.SaveState();
+            EXPECT_EQ(nlohmann::json({{"BAW123", "ADMAG2X"}}), state);
+
+            InitialAltitudeEventHandler restored(sidMapper, callsigns, owners, login, plugin);
+            restored.RestoreState(state);
+            EXPECT_EQ(state, restored.SaveState());
+            restored.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+        }
+
+        TEST_F(InitialAltitudeEventHandlerTest, ItDoesntRestoreInvalidAssignmentsFromState)
+        {
+            handler.RestoreState({{"BAW123", "ADMAG2X"}, {"EZY234", 55}});
+            EXPECT_EQ(nlohmann::json({{"BAW123", "ADMAG2X"}}), handler.SaveState());
+        }
+
+        TEST_F(InitialAltitudeEventHandlerTest, ItAssignsAgainOnceRestoredStateExpires)
+        {
+            this->AllowAssignment();
+            EXPECT_CALL(mockFlightPlan, SetClearedAltitude(6000)).Times(1);
+
+            handler.RestoreState({{"BAW123", "ADMAG2X"}});
+            handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ(nlohmann::json::object(), handler.SaveState());
+            handler.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
         }
     } // namespace InitialAltitude
 } // namespace UKControllerPluginTest
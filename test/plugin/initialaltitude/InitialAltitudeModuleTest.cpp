@@ -4,6 +4,7 @@
 #include "departure/UserShouldClearDepartureDataEvent.h"
 #include "eventhandler/EventBus.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "euroscope/UserSettingAwareCollection.h"
 #include "initialaltitude/ClearInitialAltitude.h"
 #include "plugin/FunctionCallEventHandler.h"
@@ -35,6 +36,9 @@ namespace UKControllerPluginTest::InitialAltitude {
             container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
             container.activeCallsigns = std::make_shared<ActiveCallsignCollection>();
             container.timedHandler = std::make_unique<TimedEventCollection>();
+            container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
+            container.flightplanSweep =
+                std::make_shared<UKControllerPlugin::Flightplan::FlightplanSweep>(*container.plugin);
         }
 
         PersistenceContainer container;
@@ -65,11 +69,11 @@ namespace UKControllerPluginTest::InitialAltitude {
         EXPECT_EQ(1, container.userSettingHandlers->Count());
     }
 
-    TEST_F(InitialAltitudeModuleTest, BootstrapPluginRegistersTimedEvents)
+    TEST_F(InitialAltitudeModuleTest, BootstrapPluginRegistersForFlightplanSweeps)
     {
         InitialAltitudeModule::BootstrapPlugin(this->container);
-        EXPECT_EQ(1, container.timedHandler->CountHandlers());
-        EXPECT_EQ(1, container.timedHandler->CountHandlersForFrequency(10));
+        EXPECT_EQ(1, container.flightplanSweep->CountStages());
+        EXPECT_EQ(1, container.flightplanSweep->CountStagesForFrequency(10));
     }
 
     TEST_F(InitialAltitudeModuleTest, BootstrapPluginRegistersClearInitialAltitude)
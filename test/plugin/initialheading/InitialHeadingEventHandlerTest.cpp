@@ -1,3 +1,4 @@
+#include "flightplan/FlightplanSweep.h"
 #include "initialheading/InitialHeadingEventHandler.h"
 #include "ownership/AirfieldServiceProviderCollection.h"
 #include "ownership/ServiceProvision.h"
@@ -43,8 +44,10 @@ namespace UKControllerPluginTest {
                   userCallsign("LON_S_CTR", "Test", controller, true),
                   notUserCallsign("LON_S_CTR", "Test", controller, false),
                   login(plugin, ControllerStatusEventHandlerCollection()),
-                  handler(sidMapper, callsigns, owners, login, plugin)
+                  handler(sidMapper, callsigns, owners, login, plugin), sweep(plugin)
             {
+                sweep.RegisterStage(
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightplanSweepStage>(&handler, [](auto*) {}), 1);
             }
 
             virtual void SetUp()
@@ -75,6 +78,21 @@ namespace UKControllerPluginTest {
                         std::make_shared<UKControllerPlugin::Controller::ActiveCallsign>(callsign))});
             }
 
+            void AllowAssignment()
+            {
+                callsigns.AddUserCallsign(userCallsign);
+                this->SetServiceProvision(true);
+                ON_CALL(mockFlightPlan, GetDistanceFromOrigin()).WillByDefault(Return(MAX_DISTANCE_FROM_ORIGIN));
+                ON_CALL(mockRadarTarget, GetFlightLevel()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE));
+                ON_CALL(mockRadarTarget, GetAltitude()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE));
+                ON_CALL(mockRadarTarget, GetGroundSpeed()).WillByDefault(Return(MAX_ASSIGNMENT_SPEED));
+                ON_CALL(mockFlightPlan, HasControllerAssignedHeading()).WillByDefault(Return(false));
+                ON_CALL(mockFlightPlan, IsTracked()).WillByDefault(Return(false));
+                ON_CALL(mockFlightPlan, IsSimulated()).WillByDefault(Return(false));
+                ON_CALL(mockFlightPlan, GetSidName()).WillByDefault(Return("ADMAG2X"));
+                ON_CALL(mockFlightPlan, GetOrigin()).WillByDefault(Return("EGKK"));
+            }
+
             inline static const double MAX_DISTANCE_FROM_ORIGIN = 3.0;
             inline static const int MAX_ASSIGNMENT_ALTITUDE = 1000;
             inline static const int MAX_ASSIGNMENT_SPEED = 40;
@@ -94,6 +112,7 @@ namespace UKControllerPluginTest {
             ActiveCallsignCollection callsigns;
             AirfieldServiceProviderCollection owners;
             InitialHeadingEventHandler handler;
+            UKControllerPlugin::Flightplan::FlightplanSweep sweep;
         };
 
         TEST_F(InitialHeadingEventHandlerTest, TestItDefaultsUserSettingToEnabled)
@@ -773,7 +792,7 @@ namespace UKControllerPluginTest {
             ON_CALL(*this->mockRadarTargetPointer, GetFlightLevel()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE - 1));
             ON_CALL(*this->mockRadarTargetPointer, GetAltitude()).WillByDefault(Return(MAX_ASSIGNMENT_ALTITUDE - 1));
 
-            handler.TimedEventTrigger();
+            sweep.TimedEventTrigger();
         }
 
         TEST_F(InitialHeadingEventHandlerTest, TimedEventDoesNotAssignIfNoUserCallsign)
@@ -784,7 +803,39 @@ namespace UKControllerPluginTest {
             this->plugin.AddAllFlightplansItem({this->mockFlightplanPointer, this->mockRadarTargetPointer});
             this->plugin.ExpectNoFlightplanLoop();
 
-            handler.TimedEventTrigger();
+            sweep.TimedEventTrigger();
+        }
+
+        TEST_F(InitialHeadingEventHandlerTest, ItRestoresAssignmentsFromSavedState)
+        {
+            this->AllowAssignment();
+            EXPECT_CALL(mockFlightPlan, SetHeading(125)).Times(1);
+            handler.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+
+            const auto state = handler.SaveState();
+            EXPECT_EQ(nlohmann::json({{"BAW123", "ADMAG2X"}}), state);
+
+            InitialHeadingEventHandler restored(sidMapper, callsigns, owners, login, plugin);
+            restored.RestoreState(state);
+            EXPECT_EQ(state, restored.SaveState());
+            restored.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+        }
+
+        TEST_F(InitialHeadingEventHandlerTest, ItDoesntRestoreInvalidAssignmentsFromState)
+        {
+            handler.RestoreState({{"BAW123", "ADMAG2X"}, {"EZY234", 55}});
+            EXPECT_EQ(nlohmann::json({{"BAW123", "ADMAG2X"}}), handler.SaveState());
+        }
+
+        TEST_F(InitialHeadingEventHandlerTest, ItAssignsAgainOnceRestoredStateExpires)
+        {
+            this->AllowAssignment();
+            EXPECT_CALL(mockFlightPlan, SetHeading(125)).Times(1);
+
+            handler.RestoreState({{"BAW123", "ADMAG2X"}});
+            handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ(nlohmann::json::object(), handler.SaveState());
+            handler.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
         }
     } // namespace InitialHeading
 } // namespace UKControllerPluginTest
@@ -4,6 +4,7 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "departure/UserShouldClearDepartureDataEvent.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "euroscope/UserSettingAwareCollection.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "controller/ActiveCallsignCollection.h"
@@ -34,6 +35,9 @@ namespace UKControllerPluginTest {
                 container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
                 container.activeCallsigns = std::make_shared<ActiveCallsignCollection>();
                 container.timedHandler = std::make_unique<TimedEventCollection>();
+                container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
+                container.flightplanSweep =
+                    std::make_shared<UKControllerPlugin::Flightplan::FlightplanSweep>(*container.plugin);
             }
 
             PersistenceContainer container;
@@ -64,11 +68,11 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, container.userSettingHandlers->Count());
         }
 
-        TEST_F(InitialHeadingModuleTest, BootstrapPluginRegistersForTimedEvents)
+        TEST_F(InitialHeadingModuleTest, BootstrapPluginRegistersForFlightplanSweeps)
         {
             BootstrapPlugin(this->container);
-            EXPECT_EQ(1, container.timedHandler->CountHandlers());
-            EXPECT_EQ(1, container.timedHandler->CountHandlersForFrequency(10));
+            EXPECT_EQ(1, container.flightplanSweep->CountStages());
+            EXPECT_EQ(1, container.flightplanSweep->CountStagesForFrequency(10));
         }
 
         TEST_F(InitialHeadingModuleTest, BootstrapPluginRegistersClearInitialHeading)
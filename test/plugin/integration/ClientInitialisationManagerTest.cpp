@@ -67,6 +67,22 @@ namespace UKControllerPluginTest::Integration {
         EXPECT_EQ(2, initialisationManager.CountConnections());
     }
 
+    TEST_F(ClientInitialisationManagerTest, ItDoesntAddQueuedConnectionsUntilItNextRuns)
+    {
+        initialisationManager.QueueConnection(integration1);
+        initialisationManager.QueueConnection(integration2);
+        EXPECT_EQ(0, initialisationManager.CountConnections());
+    }
+
+    TEST_F(ClientInitialisationManagerTest, ItAddsQueuedConnectionsWhenItRuns)
+    {
+        initialisationManager.QueueConnection(integration1);
+        initialisationManager.QueueConnection(integration2);
+        initialisationManager.QueueConnection(integration2);
+        initialisationManager.TimedEventTrigger();
+        EXPECT_EQ(2, initialisationManager.CountConnections());
+    }
+
     TEST_F(ClientInitialisationManagerTest, ItDoesNothingIfNoConnections)
     {
         EXPECT_NO_THROW(initialisationManager.TimedEventTrigger());
@@ -786,4 +802,67 @@ namespace UKControllerPluginTest::Integration {
         EXPECT_EQ(0, this->clientManager->CountClients());
         EXPECT_EQ(1, this->initialisationManager.CountConnections());
     }
+
+    TEST_F(ClientInitialisationManagerTest, ItRejectsUnknownEncodings)
+    {
+        initialisationManager.AddConnection(integration1);
+
+        nlohmann::json integrationMessage = {
+            {"type", "initialise"},
+            {"version", 1},
+            {"id", "foo"},
+            {"data",
+             nlohmann::json::object(
+                 {{"integration_name", "UKCPTEST"},
+                  {"integration_version", "1.5"},
+                  {"encoding", "xml"},
+                  {"event_subscriptions", nlohmann::json::array()}})}};
+
+        std::queue<std::string> returnedMessages;
+        returnedMessages.push(integrationMessage.dump());
+        ON_CALL(*this->mockConnection1, Receive).WillByDefault(testing::Return(returnedMessages));
+
+        EXPECT_CALL(
+            *this->mockConnection1,
+            Send(ExpectedFailureMessage(ClientInitialisationManager::VALIDATION_ERROR_INVALID_ENCODING)))
+            .Times(1);
+
+        initialisationManager.TimedEventTrigger();
+        EXPECT_EQ(0, clientManager->CountClients());
+    }
+
+    TEST_F(ClientInitialisationManagerTest, ItSwitchesToTheRequestedEncodingAfterTheSuccessMessage)
+    {
+        initialisationManager.AddConnection(integration1);
+
+        nlohmann::json integrationMessage = {
+            {"type", "initialise"},
+            {"version", 1},
+            {"id", "foo"},
+            {"data",
+             nlohmann::json::object(
+                 {{"integration_name", "UKCPTEST"},
+                  {"integration_version", "1.5"},
+                  {"encoding", "msgpack"},
+                  {"event_subscriptions", nlohmann::json::array()}})}};
+
+        std::queue<std::string> returnedMessages;
+        returnedMessages.push(integrationMessage.dump());
+        ON_CALL(*this->mockConnection1, Receive).WillByDefault(testing::Return(returnedMessages));
+
+        testing::InSequence sequence;
+        EXPECT_CALL(
+            *this->mockConnection1,
+            Send(UKControllerPlugin::Integration::InitialisationSuccessMessage(
+                     "foo", UKControllerPlugin::Integration::MessageEncoding::MessagePack)
+                     .ToJson()
+                     .dump()))
+            .Times(1);
+        EXPECT_CALL(*this->mockConnection1, UseLengthPrefixedFrames).Times(1);
+
+        initialisationManager.TimedEventTrigger();
+        EXPECT_EQ(
+            UKControllerPlugin::Integration::MessageEncoding::MessagePack,
+            (*clientManager->cbegin())->Connection()->Encoding());
+    }
 } // namespace UKControllerPluginTest::Integration
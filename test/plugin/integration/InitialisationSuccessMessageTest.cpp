@@ -4,6 +4,7 @@
 
 using testing::Test;
 using UKControllerPlugin::Integration::InitialisationSuccessMessage;
+using UKControllerPlugin::Integration::MessageEncoding;
 using UKControllerPlugin::Integration::MessageType;
 using UKControllerPlugin::Plugin::PluginVersion;
 
@@ -25,7 +26,13 @@ namespace UKControllerPluginTest::Integration {
             {"type", "initialisation_success"},
             {"id", "foo"},
             {"version", 1},
-            {"data", {{"ukcp_version", PluginVersion::version}}}};
+            {"data", {{"ukcp_version", PluginVersion::version}, {"encoding", "json"}}}};
         EXPECT_EQ(expected, message.ToJson());
     }
+
+    TEST_F(InitialisationSuccessMessageTest, ItIncludesTheNegotiatedEncoding)
+    {
+        InitialisationSuccessMessage msgpackMessage("foo", MessageEncoding::MessagePack);
+        EXPECT_EQ("msgpack", msgpackMessage.ToJson().at("data").at("encoding").get<std::string>());
+    }
 } // namespace UKControllerPluginTest::Integration
@@ -7,6 +7,7 @@ using testing::Test;
 using UKControllerPlugin::Integration::InitialisationSuccessMessage;
 using UKControllerPlugin::Integration::IntegrationClient;
 using UKControllerPlugin::Integration::IntegrationConnection;
+using UKControllerPlugin::Integration::MessageEncoding;
 using UKControllerPlugin::Integration::MessageType;
 using UKControllerPluginTest::Integration::MockConnection;
 
@@ -99,4 +100,48 @@ namespace UKControllerPluginTest::Integration {
         const auto receivedMessages = connection.Receive();
         EXPECT_EQ(0, receivedMessages.size());
     }
+
+    TEST_F(IntegrationConnectionTest, ItDefaultsToJsonEncoding)
+    {
+        EXPECT_EQ(MessageEncoding::Json, connection.Encoding());
+    }
+
+    TEST_F(IntegrationConnectionTest, ItDoesntSwitchToLengthPrefixedFramesForJson)
+    {
+        EXPECT_CALL(*mockConnection, UseLengthPrefixedFrames).Times(0);
+        connection.SetEncoding(MessageEncoding::Json);
+    }
+
+    TEST_F(IntegrationConnectionTest, ItSwitchesToLengthPrefixedFramesForBinaryEncodings)
+    {
+        EXPECT_CALL(*mockConnection, UseLengthPrefixedFrames).Times(1);
+        connection.SetEncoding(MessageEncoding::Cbor);
+        EXPECT_EQ(MessageEncoding::Cbor, connection.Encoding());
+    }
+
+    TEST_F(IntegrationConnectionTest, ItSendsAMessageInTheNegotiatedEncoding)
+    {
+        const auto message = std::make_shared<InitialisationSuccessMessage>("foo");
+        const auto msgpack = nlohmann::json::to_msgpack(message->ToJson());
+
+        EXPECT_CALL(*mockConnection, Send(std::string(msgpack.cbegin(), msgpack.cend()))).Times(1);
+
+        connection.SetEncoding(MessageEncoding::MessagePack);
+        connection.Send(message);
+    }
+
+    TEST_F(IntegrationConnectionTest, ItReturnsMessagesParsedFromTheNegotiatedEncoding)
+    {
+        const auto message = std::make_shared<InitialisationSuccessMessage>("foo");
+        const auto cbor = nlohmann::json::to_cbor(message->ToJson());
+
+        std::queue<std::string> messages;
+        messages.push(std::string(cbor.cbegin(), cbor.cend()));
+        EXPECT_CALL(*mockConnection, Receive).Times(1).WillOnce(testing::Return(messages));
+
+        connection.SetEncoding(MessageEncoding::Cbor);
+        auto receivedMessages = connection.Receive();
+        ASSERT_EQ(1, receivedMessages.size());
+        EXPECT_EQ(message->ToJson(), receivedMessages.front()->ToJson());
+    }
 } // namespace UKControllerPluginTest::Integration
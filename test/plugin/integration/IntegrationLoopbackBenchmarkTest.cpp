@@ -0,0 +1,167 @@
+#include "helper/Benchmark.h"
+#include "integration/IntegrationClient.h"
+#include "integration/IntegrationClientManager.h"
+#include "integration/IntegrationConnection.h"
+#include "integration/InboundMessage.h"
+#include "integration/MessageType.h"
+#include "integration/OutboundIntegrationMessageHandler.h"
+#include "integration/PolledSocket.h"
+#include "integration/SocketConnection.h"
+#include "integration/SocketPoller.h"
+
+using UKControllerPlugin::Integration::InboundMessage;
+using UKControllerPlugin::Integration::IntegrationClient;
+using UKControllerPlugin::Integration::IntegrationClientManager;
+using UKControllerPlugin::Integration::IntegrationConnection;
+using UKControllerPlugin::Integration::MessageType;
+using UKControllerPlugin::Integration::OutboundIntegrationMessageHandler;
+using UKControllerPlugin::Integration::PolledSocket;
+using UKControllerPlugin::Integration::SocketConnection;
+using UKControllerPlugin::Integration::SocketPoller;
+
+namespace UKControllerPluginTest::Integration {
+
+    /*
+     * Connects lots of integrations to the plugin over real loopback sockets, serviced by
+     * the socket poller, to measure how quickly outbound messages can be fanned out to them.
+     */
+    class IntegrationLoopbackBenchmarkTest : public testing::Test
+    {
+        public:
+        void SetUp() override
+        {
+            WSADATA wsaData;
+            ASSERT_EQ(0, WSAStartup(MAKEWORD(2, 2), &wsaData));
+
+            listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            ASSERT_NE(INVALID_SOCKET, listener);
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+            ASSERT_NE(SOCKET_ERROR, bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+            ASSERT_NE(SOCKET_ERROR, listen(listener, SOMAXCONN));
+
+            int addressLength = sizeof(address);
+            ASSERT_NE(SOCKET_ERROR, getsockname(listener, reinterpret_cast<sockaddr*>(&address), &addressLength));
+
+            messageType = std::make_shared<MessageType>(MessageType{"test1", 2});
+            clientManager = std::make_shared<IntegrationClientManager>();
+            handler = std::make_unique<OutboundIntegrationMessageHandler>(clientManager);
+            poller = std::make_unique<SocketPoller>(listener, [this](std::shared_ptr<PolledSocket> socket) {
+                std::lock_guard lock(acceptedLock);
+                accepted.push_back(std::move(socket));
+            });
+
+            for (int i = 0; i < CLIENTS; i++) {
+                SOCKET integrationSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+                ASSERT_NE(
+                    SOCKET_ERROR,
+                    connect(integrationSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+                integrationSockets.push_back(integrationSocket);
+
+                DWORD receiveTimeout = 10000;
+                setsockopt(
+                    integrationSocket,
+                    SOL_SOCKET,
+                    SO_RCVTIMEO,
+                    reinterpret_cast<const char*>(&receiveTimeout),
+                    sizeof(receiveTimeout));
+            }
+
+            // Wait for the poller to accept everything
+            const auto acceptDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (std::chrono::steady_clock::now() < acceptDeadline) {
+                {
+                    std::lock_guard lock(acceptedLock);
+                    if (accepted.size() == CLIENTS) {
+                        break;
+                    }
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            std::lock_guard lock(acceptedLock);
+            ASSERT_EQ(CLIENTS, accepted.size());
+            for (int i = 0; i < CLIENTS; i++) {
+                auto client = std::make_shared<IntegrationClient>(
+                    i,
+                    "benchmark",
+                    "1.0",
+                    std::make_shared<IntegrationConnection>(std::make_shared<SocketConnection>(accepted[i])));
+                client->AddInterestedMessage(messageType);
+                clientManager->AddClient(client);
+            }
+            accepted.clear();
+        }
+
+        void TearDown() override
+        {
+            handler.reset();
+            clientManager.reset();
+            poller.reset();
+
+            for (const auto integrationSocket : integrationSockets) {
+                closesocket(integrationSocket);
+            }
+            closesocket(listener);
+            WSACleanup();
+        }
+
+        /*
+         * Reads from the integration end of the socket until we've got everything we expect.
+         */
+        static auto Drain(SOCKET integrationSocket, size_t expectedBytes) -> size_t
+        {
+            std::array<char, 65536> buffer{};
+            size_t received = 0;
+            while (received < expectedBytes) {
+                const auto bytes = recv(integrationSocket, buffer.data(), static_cast<int>(buffer.size()), 0);
+                if (bytes <= 0) {
+                    break;
+                }
+                received += bytes;
+            }
+
+            return received;
+        }
+
+        static inline const int CLIENTS = 50;
+        static inline const int MESSAGES = 1000;
+
+        SOCKET listener = INVALID_SOCKET;
+        std::vector<SOCKET> integrationSockets;
+        std::shared_ptr<MessageType> messageType;
+        std::shared_ptr<IntegrationClientManager> clientManager;
+        std::unique_ptr<OutboundIntegrationMessageHandler> handler;
+        std::unique_ptr<SocketPoller> poller;
+        std::vector<std::shared_ptr<PolledSocket>> accepted;
+        std::mutex acceptedLock;
+    };
+
+    TEST_F(IntegrationLoopbackBenchmarkTest, DISABLED_BenchmarkFanOutToManyLoopbackClients)
+    {
+        const auto message = InboundMessage::FromJson(nlohmann::json{
+            {"type", "test1"},
+            {"version", 2},
+            {"id", "foo"},
+            {"data", nlohmann::json::object({{"callsign", "BAW123"}, {"stand", "EGLL/531"}})}});
+
+        RunBenchmark("Send to 50 loopback integrations", MESSAGES, [this, &message] {
+            handler->SendEvent(message);
+        });
+
+        // Everything sent, including the warm-up, followed by a delimiter each time
+        const auto expectedBytes = (MESSAGES + 1) * (message->ToJson().dump().size() + 1);
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto integrationSocket : integrationSockets) {
+            EXPECT_EQ(expectedBytes, Drain(integrationSocket, expectedBytes));
+        }
+
+        std::cout << "[ BENCHMARK] Delivered " << CLIENTS * (MESSAGES + 1) << " messages to loopback integrations in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+                         .count()
+                  << "ms after sending" << std::endl;
+    }
+} // namespace UKControllerPluginTest::Integration
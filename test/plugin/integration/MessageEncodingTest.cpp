@@ -0,0 +1,58 @@
+#include "integration/MessageEncoding.h"
+
+using UKControllerPlugin::Integration::DecodeMessage;
+using UKControllerPlugin::Integration::EncodeMessage;
+using UKControllerPlugin::Integration::MessageEncoding;
+using UKControllerPlugin::Integration::MessageEncodingFromString;
+using UKControllerPlugin::Integration::MessageEncodingToString;
+
+namespace UKControllerPluginTest::Integration {
+
+    class MessageEncodingTest : public testing::TestWithParam<MessageEncoding>
+    {
+        public:
+        nlohmann::json message = {
+            {"type", "stand_assigned"},
+            {"version", 1},
+            {"data", {{"callsign", "BAW123"}, {"airfield", "EGLL"}, {"stand", "531"}}}};
+    };
+
+    TEST_P(MessageEncodingTest, ItRoundTripsMessages)
+    {
+        EXPECT_EQ(message, DecodeMessage(EncodeMessage(message, GetParam()), GetParam()));
+    }
+
+    TEST_P(MessageEncodingTest, ItRoundTripsTheEncodingName)
+    {
+        EXPECT_EQ(GetParam(), MessageEncodingFromString(MessageEncodingToString(GetParam())));
+    }
+
+    TEST_P(MessageEncodingTest, ItThrowsOnUndecodableMessages)
+    {
+        EXPECT_THROW(static_cast<void>(DecodeMessage("\xC1", GetParam())), nlohmann::json::exception);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        MessageEncodingTestCases,
+        MessageEncodingTest,
+        testing::Values(MessageEncoding::Json, MessageEncoding::MessagePack, MessageEncoding::Cbor),
+        [](const testing::TestParamInfo<MessageEncoding>& info) { return MessageEncodingToString(info.param); });
+
+    TEST(MessageEncodingNamesTest, ItReturnsNothingForUnknownEncodings)
+    {
+        EXPECT_FALSE(MessageEncodingFromString("xml").has_value());
+    }
+
+    TEST(MessageEncodingNamesTest, ItEncodesJsonAsText)
+    {
+        EXPECT_EQ(R"({"foo":"bar"})", EncodeMessage({{"foo", "bar"}}, MessageEncoding::Json));
+    }
+
+    TEST(MessageEncodingNamesTest, BinaryEncodingsAreSmallerThanJson)
+    {
+        const nlohmann::json message = {{"callsign", "BAW123"}, {"cleared_level", 7000}, {"heading", 270}};
+        const auto json = EncodeMessage(message, MessageEncoding::Json);
+        EXPECT_LT(EncodeMessage(message, MessageEncoding::MessagePack).size(), json.size());
+        EXPECT_LT(EncodeMessage(message, MessageEncoding::Cbor).size(), json.size());
+    }
+} // namespace UKControllerPluginTest::Integration
@@ -0,0 +1,200 @@
+#include "helper/Benchmark.h"
+#include "integration/MessageFrameBuffer.h"
+
+using UKControllerPlugin::Integration::MessageFrameBuffer;
+
+namespace UKControllerPluginTest::Integration {
+
+    class MessageFrameBufferTest : public testing::Test
+    {
+        public:
+        MessageFrameBufferTest() : buffer('|')
+        {
+        }
+
+        MessageFrameBuffer buffer;
+    };
+
+    TEST_F(MessageFrameBufferTest, ItStartsEmpty)
+    {
+        EXPECT_EQ(0, buffer.BufferedBytes());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItReturnsNothingForIncompleteFrames)
+    {
+        buffer.Append("abc");
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        EXPECT_EQ(3, buffer.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItReturnsACompleteFrameWithoutTheDelimiter)
+    {
+        buffer.Append("abc|");
+        EXPECT_EQ("abc", buffer.NextFrame());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        EXPECT_EQ(0, buffer.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItReturnsEmptyFrames)
+    {
+        buffer.Append("||");
+        EXPECT_EQ("", buffer.NextFrame());
+        EXPECT_EQ("", buffer.NextFrame());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItReturnsMultipleFramesInOrder)
+    {
+        buffer.Append("abc|def|gh");
+        EXPECT_EQ("abc", buffer.NextFrame());
+        EXPECT_EQ("def", buffer.NextFrame());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        EXPECT_EQ(2, buffer.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItCompletesFramesSpreadOverMultipleAppends)
+    {
+        buffer.Append("ab");
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        buffer.Append("c");
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        buffer.Append("d|e");
+        EXPECT_EQ("abcd", buffer.NextFrame());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        buffer.Append("f|");
+        EXPECT_EQ("ef", buffer.NextFrame());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItKeepsPartialFramesWhenCompacting)
+    {
+        buffer.Append("aaaaaaaaaa|bb");
+        EXPECT_EQ("aaaaaaaaaa", buffer.NextFrame());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+
+        buffer.Append("b|");
+        EXPECT_EQ("bbb", buffer.NextFrame());
+        EXPECT_EQ(0, buffer.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItIgnoresEmptyAppends)
+    {
+        buffer.Append("abc|");
+        buffer.Append("");
+        EXPECT_EQ("abc", buffer.NextFrame());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItEncodesLengthPrefixesBigEndian)
+    {
+        EXPECT_EQ((std::array<char, 4>{'\x01', '\x02', '\x03', '\x04'}), MessageFrameBuffer::LengthPrefix(0x01020304));
+    }
+
+    TEST_F(MessageFrameBufferTest, ItReturnsLengthPrefixedFrames)
+    {
+        buffer.UseLengthPrefix();
+        EXPECT_TRUE(buffer.UsingLengthPrefix());
+
+        buffer.Append(std::string_view(
+            "\x00\x00\x00\x03"
+            "a|b\x00\x00\x00\x00",
+            11));
+        EXPECT_EQ("a|b", buffer.NextFrame());
+        EXPECT_EQ("", buffer.NextFrame());
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItWaitsForTheWholeLengthPrefixedFrame)
+    {
+        buffer.UseLengthPrefix();
+        buffer.Append(std::string_view("\x00\x00", 2));
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        buffer.Append(std::string_view(
+            "\x00\x04"
+            "ab",
+            4));
+        EXPECT_FALSE(buffer.NextFrame().has_value());
+        buffer.Append("cd");
+        EXPECT_EQ("abcd", buffer.NextFrame());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItAcceptsFramesUpToTheSizeLimit)
+    {
+        MessageFrameBuffer limited('|', 4);
+        limited.Append("abcd|");
+        EXPECT_EQ("abcd", limited.NextFrame());
+        EXPECT_FALSE(limited.FrameTooLarge());
+
+        limited.UseLengthPrefix();
+        limited.Append(std::string_view(
+            "\x00\x00\x00\x04"
+            "abcd",
+            8));
+        EXPECT_EQ("abcd", limited.NextFrame());
+        EXPECT_FALSE(limited.FrameTooLarge());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItRejectsDelimitedFramesOverTheSizeLimit)
+    {
+        MessageFrameBuffer limited('|', 4);
+        limited.Append("abcde|fg|");
+        EXPECT_FALSE(limited.NextFrame().has_value());
+        EXPECT_TRUE(limited.FrameTooLarge());
+        EXPECT_EQ(0, limited.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItRejectsUndelimitedDataOverTheSizeLimit)
+    {
+        MessageFrameBuffer limited('|', 4);
+        limited.Append("abcd");
+        EXPECT_FALSE(limited.NextFrame().has_value());
+        EXPECT_FALSE(limited.FrameTooLarge());
+
+        limited.Append("e");
+        EXPECT_FALSE(limited.NextFrame().has_value());
+        EXPECT_TRUE(limited.FrameTooLarge());
+        EXPECT_EQ(0, limited.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItRejectsLengthPrefixesOverTheSizeLimit)
+    {
+        MessageFrameBuffer limited('|', 4);
+        limited.UseLengthPrefix();
+        limited.Append(std::string_view("\xFF\xFF\xFF\xFF", 4));
+        EXPECT_FALSE(limited.NextFrame().has_value());
+        EXPECT_TRUE(limited.FrameTooLarge());
+        EXPECT_EQ(0, limited.BufferedBytes());
+    }
+
+    TEST_F(MessageFrameBufferTest, ItDiscardsEverythingOnceAFrameIsTooLarge)
+    {
+        MessageFrameBuffer limited('|', 4);
+        limited.Append("abcdefgh");
+        EXPECT_FALSE(limited.NextFrame().has_value());
+
+        limited.Append("|ab|");
+        EXPECT_FALSE(limited.NextFrame().has_value());
+        EXPECT_EQ(0, limited.BufferedBytes());
+        EXPECT_TRUE(limited.FrameTooLarge());
+    }
+
+    TEST_F(MessageFrameBufferTest, DISABLED_BenchmarkManyMessagesInSocketSizedChunks)
+    {
+        std::string data;
+        for (int i = 0; i < 10000; i++) {
+            data += R"({"type":"departure_release_requested","version":1,"data":{"id":)" + std::to_string(i) + "}}|";
+        }
+
+        constexpr size_t chunkSize = 4096;
+        size_t frames = 0;
+        RunBenchmark("Frame 10000 buffered messages", 20, [this, &data, &frames] {
+            for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+                buffer.Append(std::string_view(data).substr(offset, chunkSize));
+                while (buffer.NextFrame()) {
+                    frames++;
+                }
+            }
+        });
+
+        EXPECT_EQ(210000, frames);
+    }
+} // namespace UKControllerPluginTest::Integration
@@ -74,4 +74,17 @@ namespace UKControllerPluginTest::Integration {
 
         this->handler.SendEvent(this->parsedTestMessage);
     }
+
+    TEST_F(OutboundIntegrationMessageHandlerTest, ItSendsTheSameSerialisedMessageToEachClient)
+    {
+        this->clientManager->AddClient(this->client1);
+        this->clientManager->AddClient(this->client2);
+        this->client1->AddInterestedMessage(this->type1);
+        this->client2->AddInterestedMessage(this->type1);
+
+        EXPECT_CALL(*this->mockConnection1, Send(this->parsedTestMessage->ToJson().dump())).Times(1);
+        EXPECT_CALL(*this->mockConnection2, Send(this->parsedTestMessage->ToJson().dump())).Times(1);
+
+        this->handler.SendEvent(this->parsedTestMessage);
+    }
 } // namespace UKControllerPluginTest::Integration
@@ -0,0 +1,160 @@
+#include "integration/PolledSocket.h"
+#include "test/LoopbackSocketTestCase.h"
+
+using UKControllerPlugin::Integration::PolledSocket;
+using UKControllerPluginTest::LoopbackSocketTestCase;
+
+namespace UKControllerPluginTest::Integration {
+
+    class PolledSocketTest : public LoopbackSocketTestCase
+    {
+        public:
+        void SetUp() override
+        {
+            LoopbackSocketTestCase::SetUp();
+            peer = Connect(SMALL_BUFFER_SIZE);
+
+            const SOCKET accepted = Accept();
+            setsockopt(
+                accepted,
+                SOL_SOCKET,
+                SO_SNDBUF,
+                reinterpret_cast<const char*>(&SMALL_BUFFER_SIZE),
+                sizeof(SMALL_BUFFER_SIZE));
+            polledSocket = std::make_unique<PolledSocket>(accepted);
+        }
+
+        void TearDown() override
+        {
+            polledSocket.reset();
+            LoopbackSocketTestCase::TearDown();
+        }
+
+        /*
+            Reads whatever has arrived on the polled socket, as the poller would when it's readable.
+        */
+        [[nodiscard]] auto ReadUntil(const std::string& expected) -> std::string
+        {
+            std::string received;
+            static_cast<void>(WaitFor([this, &received, &expected]() {
+                std::string chunk;
+                polledSocket->ReadAvailable();
+                *polledSocket >> chunk;
+                received += chunk;
+                return received.size() >= expected.size();
+            }));
+
+            return received;
+        }
+
+        static inline const int SMALL_BUFFER_SIZE = 8192;
+        static inline const size_t LARGE_MESSAGE_SIZE = 8 * 1024 * 1024;
+        SOCKET peer = INVALID_SOCKET;
+        std::unique_ptr<PolledSocket> polledSocket;
+    };
+
+    TEST_F(PolledSocketTest, ItIsActiveWhenCreated)
+    {
+        EXPECT_TRUE(polledSocket->Active());
+        EXPECT_FALSE(polledSocket->HasPendingWrites());
+    }
+
+    TEST_F(PolledSocketTest, ItReturnsFromReadingWhenThereIsNothingToRead)
+    {
+        polledSocket->ReadAvailable();
+
+        std::string received = "not empty";
+        *polledSocket >> received;
+        EXPECT_EQ("", received);
+        EXPECT_TRUE(polledSocket->Active());
+    }
+
+    TEST_F(PolledSocketTest, ItReadsAvailableData)
+    {
+        Send(peer, "hello");
+        EXPECT_EQ("hello", ReadUntil("hello"));
+        EXPECT_TRUE(polledSocket->Active());
+    }
+
+    TEST_F(PolledSocketTest, ItReadsAvailableDataIntoAStream)
+    {
+        Send(peer, "hello");
+
+        std::string received;
+        EXPECT_TRUE(WaitFor([this, &received]() {
+            polledSocket->ReadAvailable();
+            std::stringstream stream;
+            *polledSocket >> stream;
+            received += stream.str();
+            return received == "hello";
+        }));
+    }
+
+    TEST_F(PolledSocketTest, ItSendsMessagesStraightAwayIfTheSocketWillTakeThem)
+    {
+        std::string message = "hello";
+        *polledSocket << message;
+
+        EXPECT_FALSE(polledSocket->HasPendingWrites());
+        EXPECT_EQ("hello", Receive(peer, 5));
+    }
+
+    TEST_F(PolledSocketTest, ItQueuesWhatTheSocketWillNotTakeAndFlushesItInOrder)
+    {
+        std::string large(LARGE_MESSAGE_SIZE, 'a');
+        for (size_t i = 0; i < large.size(); i += 1000) {
+            large[i] = static_cast<char>('a' + (i / 1000) % 26);
+        }
+        std::string tail = "tail";
+
+        *polledSocket << large;
+        ASSERT_TRUE(polledSocket->HasPendingWrites());
+        *polledSocket << tail;
+        ASSERT_TRUE(polledSocket->HasPendingWrites());
+
+        std::string received;
+        std::thread reader([this, &received, &large, &tail]() {
+            received = Receive(peer, large.size() + tail.size());
+        });
+
+        EXPECT_TRUE(WaitFor([this]() {
+            polledSocket->FlushPendingWrites();
+            return !polledSocket->HasPendingWrites();
+        }));
+        reader.join();
+
+        EXPECT_TRUE(received == large + tail);
+        EXPECT_TRUE(polledSocket->Active());
+    }
+
+    TEST_F(PolledSocketTest, ItDeactivatesWhenThePeerCloses)
+    {
+        Close(peer);
+
+        EXPECT_TRUE(WaitFor([this]() {
+            polledSocket->ReadAvailable();
+            return !polledSocket->Active();
+        }));
+    }
+
+    TEST_F(PolledSocketTest, ItDeactivatesWhenTheConnectionErrors)
+    {
+        Reset(peer);
+
+        EXPECT_TRUE(WaitFor([this]() {
+            polledSocket->ReadAvailable();
+            return !polledSocket->Active();
+        }));
+    }
+
+    TEST_F(PolledSocketTest, ItDiscardsWritesOnceDeactivated)
+    {
+        polledSocket->Deactivate();
+
+        std::string message = "hello";
+        *polledSocket << message;
+
+        EXPECT_FALSE(polledSocket->Active());
+        EXPECT_FALSE(polledSocket->HasPendingWrites());
+    }
+} // namespace UKControllerPluginTest::Integration
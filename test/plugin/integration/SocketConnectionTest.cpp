@@ -42,7 +42,7 @@ namespace UKControllerPluginTest::Integration {
 
     TEST_F(SocketConnectionTest, ItReceivesNoMessageFromTheSocket)
     {
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride()).Times(1).WillOnce(testing::Return(""));
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride()).Times(1).WillOnce(testing::Return(""));
 
         EXPECT_EQ(0, this->connection.Receive().size());
     }
@@ -52,7 +52,7 @@ namespace UKControllerPluginTest::Integration {
         std::string messageString = "testmessage1";
         messageString.append({'\x1F'});
 
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride()).Times(1).WillOnce(testing::Return(messageString));
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride()).Times(1).WillOnce(testing::Return(messageString));
 
         std::queue<std::string> expected;
         expected.push("testmessage1");
@@ -65,7 +65,7 @@ namespace UKControllerPluginTest::Integration {
         std::string messageString = "testmessage1";
         messageString.append({'\x1F'});
 
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride())
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride())
             .Times(3)
             .WillOnce(testing::Return(""))
             .WillOnce(testing::Return(""))
@@ -86,7 +86,7 @@ namespace UKControllerPluginTest::Integration {
         messageString.append("testmessage2");
         messageString.append({'\x1F'});
 
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride()).Times(1).WillOnce(testing::Return(messageString));
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride()).Times(1).WillOnce(testing::Return(messageString));
 
         std::queue<std::string> expected;
         expected.push("testmessage1");
@@ -100,7 +100,7 @@ namespace UKControllerPluginTest::Integration {
         std::string messageString = "testmessage1";
         messageString.append({'\x1F'});
 
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride())
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride())
             .Times(2)
             .WillOnce(testing::Return(messageString))
             .WillOnce(testing::Return(""));
@@ -119,7 +119,7 @@ namespace UKControllerPluginTest::Integration {
         std::string messageStringPart3 = "e";
         messageStringPart3.append({'\x1F'});
 
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride)
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride)
             .Times(4)
             .WillOnce(testing::Return(messageStringPart1))
             .WillOnce(testing::Return(""))
@@ -145,7 +145,7 @@ namespace UKControllerPluginTest::Integration {
         std::string messageStringPart4 = "message2";
         messageStringPart4.append({'\x1F'});
 
-        EXPECT_CALL(*this->mockSocket, ExtractStreamOverride)
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride)
             .Times(6)
             .WillOnce(testing::Return(messageStringPart1))
             .WillOnce(testing::Return(""))
@@ -167,4 +167,61 @@ namespace UKControllerPluginTest::Integration {
         EXPECT_EQ(0, this->connection.Receive().size());
         EXPECT_EQ(secondExpected, this->connection.Receive());
     }
+
+    TEST_F(SocketConnectionTest, ItHandsEachMessageToTheCallback)
+    {
+        std::string messageString = "testmessage1";
+        messageString.append({'\x1F'});
+        messageString.append("testmessage2");
+        messageString.append({'\x1F'});
+        messageString.append("testmess");
+
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride()).Times(1).WillOnce(testing::Return(messageString));
+
+        std::vector<std::string> received;
+        this->connection.ReceiveEach([&received](std::string_view message) { received.emplace_back(message); });
+
+        EXPECT_EQ(std::vector<std::string>({"testmessage1", "testmessage2"}), received);
+    }
+
+    TEST_F(SocketConnectionTest, ItSendsAMessagePrefixedByLength)
+    {
+        std::string expectedMessage = {'\x00', '\x00', '\x00', '\x0B'};
+        expectedMessage.append("testmessage");
+
+        EXPECT_CALL(*this->mockSocket, InsertStringOverride(expectedMessage)).Times(1);
+
+        this->connection.UseLengthPrefixedFrames();
+        this->connection.Send("testmessage");
+    }
+
+    TEST_F(SocketConnectionTest, ItReceivesLengthPrefixedMessages)
+    {
+        std::string messageString = {'\x00', '\x00', '\x00', '\x03'};
+        messageString.append({'a', '\x1F', 'b'});
+        messageString.append({'\x00', '\x00', '\x00', '\x02'});
+        messageString.append("cd");
+
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride()).Times(1).WillOnce(testing::Return(messageString));
+
+        std::queue<std::string> expected;
+        expected.push({'a', '\x1F', 'b'});
+        expected.push("cd");
+
+        this->connection.UseLengthPrefixedFrames();
+        EXPECT_EQ(expected, this->connection.Receive());
+    }
+
+    TEST_F(SocketConnectionTest, ItBecomesInactiveIfAFrameIsTooLarge)
+    {
+        ON_CALL(*this->mockSocket, Active).WillByDefault(testing::Return(true));
+        std::string messageString = {'\x7F', '\xFF', '\xFF', '\xFF'};
+        messageString.append("abc");
+
+        EXPECT_CALL(*this->mockSocket, ExtractStringOverride()).Times(1).WillOnce(testing::Return(messageString));
+
+        this->connection.UseLengthPrefixedFrames();
+        EXPECT_EQ(0, this->connection.Receive().size());
+        EXPECT_FALSE(this->connection.Active());
+    }
 } // namespace UKControllerPluginTest::Integration
@@ -0,0 +1,167 @@
+#include "integration/PolledSocket.h"
+#include "integration/SocketPoller.h"
+#include "test/LoopbackSocketTestCase.h"
+
+using UKControllerPlugin::Integration::PolledSocket;
+using UKControllerPlugin::Integration::SocketPoller;
+using UKControllerPluginTest::LoopbackSocketTestCase;
+
+namespace UKControllerPluginTest::Integration {
+
+    class SocketPollerTest : public LoopbackSocketTestCase
+    {
+        public:
+        void SetUp() override
+        {
+            LoopbackSocketTestCase::SetUp();
+            poller = std::make_unique<SocketPoller>(listener, [this](std::shared_ptr<PolledSocket> socket) {
+                std::lock_guard lock(acceptedLock);
+                accepted.push_back(std::move(socket));
+            });
+        }
+
+        void TearDown() override
+        {
+            poller.reset();
+            accepted.clear();
+            LoopbackSocketTestCase::TearDown();
+        }
+
+        [[nodiscard]] auto CountAccepted() -> size_t
+        {
+            std::lock_guard lock(acceptedLock);
+            return accepted.size();
+        }
+
+        /*
+            Waits for the poller to accept a connection and returns it.
+        */
+        [[nodiscard]] auto AcceptedSocket(size_t index) -> std::shared_ptr<PolledSocket>
+        {
+            EXPECT_TRUE(WaitFor([this, index]() { return CountAccepted() > index; }));
+            std::lock_guard lock(acceptedLock);
+            return index < accepted.size() ? accepted[index] : nullptr;
+        }
+
+        std::unique_ptr<SocketPoller> poller;
+        std::vector<std::shared_ptr<PolledSocket>> accepted;
+        std::mutex acceptedLock;
+    };
+
+    TEST_F(SocketPollerTest, ItAcceptsNewConnections)
+    {
+        static_cast<void>(Connect());
+        static_cast<void>(Connect());
+
+        EXPECT_TRUE(WaitFor([this]() { return CountAccepted() == 2; }));
+        EXPECT_EQ(2, poller->CountSockets());
+        EXPECT_TRUE(AcceptedSocket(0)->Active());
+        EXPECT_TRUE(AcceptedSocket(1)->Active());
+    }
+
+    TEST_F(SocketPollerTest, ItReadsFromSocketsWhenTheyBecomeReadable)
+    {
+        const auto firstPeer = Connect();
+        const auto firstSocket = AcceptedSocket(0);
+        const auto secondPeer = Connect();
+        const auto secondSocket = AcceptedSocket(1);
+        ASSERT_NE(nullptr, firstSocket);
+        ASSERT_NE(nullptr, secondSocket);
+
+        Send(secondPeer, "world");
+        Send(firstPeer, "hello");
+
+        std::string firstReceived;
+        std::string secondReceived;
+        EXPECT_TRUE(WaitFor([&]() {
+            std::string chunk;
+            *firstSocket >> chunk;
+            firstReceived += chunk;
+            *secondSocket >> chunk;
+            secondReceived += chunk;
+            return firstReceived == "hello" && secondReceived == "world";
+        }));
+    }
+
+    TEST_F(SocketPollerTest, ItFlushesQueuedWritesWhenTheSocketBecomesWritable)
+    {
+        const int smallBuffer = 8192;
+        const auto peer = Connect(smallBuffer);
+        const auto socket = AcceptedSocket(0);
+        ASSERT_NE(nullptr, socket);
+        setsockopt(
+            socket->Socket(), SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&smallBuffer), sizeof(smallBuffer));
+
+        std::string message(8 * 1024 * 1024, 'a');
+        for (size_t i = 0; i < message.size(); i += 1000) {
+            message[i] = static_cast<char>('a' + (i / 1000) % 26);
+        }
+        *socket << message;
+        ASSERT_TRUE(socket->HasPendingWrites());
+
+        // Nobody but the poller flushes the socket from here on
+        EXPECT_TRUE(Receive(peer, message.size()) == message);
+        EXPECT_TRUE(WaitFor([&socket]() { return !socket->HasPendingWrites(); }));
+        EXPECT_TRUE(socket->Active());
+    }
+
+    TEST_F(SocketPollerTest, ItRemovesSocketsWhenThePeerCloses)
+    {
+        const auto peer = Connect();
+        const auto socket = AcceptedSocket(0);
+        ASSERT_NE(nullptr, socket);
+
+        Close(peer);
+
+        EXPECT_TRUE(WaitFor([this]() { return poller->CountSockets() == 0; }));
+        EXPECT_FALSE(socket->Active());
+    }
+
+    TEST_F(SocketPollerTest, ItRemovesSocketsWhenTheConnectionErrors)
+    {
+        const auto peer = Connect();
+        const auto socket = AcceptedSocket(0);
+        ASSERT_NE(nullptr, socket);
+
+        Reset(peer);
+
+        EXPECT_TRUE(WaitFor([this]() { return poller->CountSockets() == 0; }));
+        EXPECT_FALSE(socket->Active());
+    }
+
+    TEST_F(SocketPollerTest, ItRemovesSocketsThatNobodyElseIsUsing)
+    {
+        const auto peer = Connect();
+        ASSERT_NE(nullptr, AcceptedSocket(0));
+        {
+            std::lock_guard lock(acceptedLock);
+            accepted.clear();
+        }
+
+        EXPECT_TRUE(WaitFor([this]() { return poller->CountSockets() == 0; }));
+
+        // The socket has been closed, so the peer sees the connection end
+        EXPECT_EQ("", Receive(peer, 1));
+    }
+
+    TEST_F(SocketPollerTest, ItShutsDownWithSocketsStillRegistered)
+    {
+        const auto firstPeer = Connect();
+        static_cast<void>(Connect());
+        const auto firstSocket = AcceptedSocket(0);
+        const auto secondSocket = AcceptedSocket(1);
+        ASSERT_NE(nullptr, firstSocket);
+        ASSERT_NE(nullptr, secondSocket);
+
+        const auto start = std::chrono::steady_clock::now();
+        poller.reset();
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+        // The sockets belong to whoever else holds them, and carry on working
+        EXPECT_TRUE(firstSocket->Active());
+        EXPECT_TRUE(secondSocket->Active());
+        std::string message = "hello";
+        *firstSocket << message;
+        EXPECT_EQ("hello", Receive(firstPeer, 5));
+    }
+} // namespace UKControllerPluginTest::Integration
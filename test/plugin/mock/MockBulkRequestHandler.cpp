@@ -0,0 +1,4 @@
+#include "MockBulkRequestHandler.h"
+
+UKControllerPluginTest::Api::MockBulkRequestHandler::MockBulkRequestHandler() = default;
+UKControllerPluginTest::Api::MockBulkRequestHandler::~MockBulkRequestHandler() = default;
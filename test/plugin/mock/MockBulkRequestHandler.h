@@ -0,0 +1,15 @@
+#pragma once
+#include "api/BulkRequestHandlerInterface.h"
+
+namespace UKControllerPluginTest::Api {
+    class MockBulkRequestHandler : public UKControllerPlugin::Api::BulkRequestHandlerInterface
+    {
+        public:
+        MockBulkRequestHandler();
+        virtual ~MockBulkRequestHandler();
+        MOCK_METHOD(std::optional<nlohmann::json>, PerformBulkRequest, (const nlohmann::json&), (override));
+        MOCK_METHOD(void, ProcessBulkResult, (const std::string&, const nlohmann::json&), (override));
+        MOCK_METHOD(void, PerformItemRequest, (const std::string&, const nlohmann::json&), (override));
+        MOCK_METHOD(void, AbandonRequest, (const std::string&), (override));
+    };
+} // namespace UKControllerPluginTest::Api
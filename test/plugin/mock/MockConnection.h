@@ -10,5 +10,6 @@ namespace UKControllerPluginTest::Integration {
         MOCK_METHOD(void, Send, (std::string), (override));
         MOCK_METHOD(std::queue<std::string>, Receive, (), (override));
         MOCK_METHOD(bool, Active, (), (const, override));
+        MOCK_METHOD(void, UseLengthPrefixedFrames, (), (override));
     };
 } // namespace UKControllerPluginTest::Integration
@@ -24,6 +24,7 @@ namespace UKControllerPluginTest::Euroscope {
             throw std::logic_error("Was not expecting the flightplan loop");
         }
 
+        this->flightplanLoops++;
         for (auto it = this->allFpRtPairs.cbegin(); it != this->allFpRtPairs.cend(); ++it) {
             function(it->fp, it->rt);
         }
@@ -38,6 +39,7 @@ namespace UKControllerPluginTest::Euroscope {
             throw std::logic_error("Was not expecting the flightplan loop");
         }
 
+        this->flightplanLoops++;
         for (auto it = this->allFpRtPairs.cbegin(); it != this->allFpRtPairs.cend(); ++it) {
             function(*it->fp, *it->rt);
         }
@@ -52,6 +54,7 @@ namespace UKControllerPluginTest::Euroscope {
             throw std::logic_error("Was not expecting the flightplan loop");
         }
 
+        this->flightplanLoops++;
         for (auto it = this->allFpRtPairs.cbegin(); it != this->allFpRtPairs.cend(); ++it) {
             function(*it->fp, *it->rt);
         }
@@ -77,8 +80,44 @@ namespace UKControllerPluginTest::Euroscope {
         this->SetEuroscopeSelectedFlightplanReference(flightplan);
     }
 
+    /*
+        Looks the aircraft up through the mocked getters, so tests can set expectations on those.
+    */
+    auto MockEuroscopePluginLoopbackInterface::ApplyFunctionToFlightplan(
+        const std::string& callsign,
+        const std::function<void(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface&)>& function) const
+        -> bool
+    {
+        const auto flightplan = this->GetFlightplanForCallsign(callsign);
+        if (!flightplan) {
+            return false;
+        }
+
+        function(*flightplan);
+        return true;
+    }
+
+    auto MockEuroscopePluginLoopbackInterface::ApplyFunctionToRadarTarget(
+        const std::string& callsign,
+        const std::function<void(const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface&)>& function) const
+        -> bool
+    {
+        const auto radarTarget = this->GetRadarTargetForCallsign(callsign);
+        if (!radarTarget) {
+            return false;
+        }
+
+        function(*radarTarget);
+        return true;
+    }
+
     void MockEuroscopePluginLoopbackInterface::ExpectNoFlightplanLoop()
     {
         this->expectFlightplanLoopNoFire = true;
     }
+
+    auto MockEuroscopePluginLoopbackInterface::CountFlightplanLoops() const -> int
+    {
+        return this->flightplanLoops;
+    }
 } // namespace UKControllerPluginTest::Euroscope
@@ -30,6 +30,14 @@ namespace UKControllerPluginTest {
             MOCK_CONST_METHOD1(
                 GetRadarTargetForCallsign,
                 std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface>(std::string));
+            auto ApplyFunctionToFlightplan(
+                const std::string& callsign,
+                const std::function<void(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface&)>&
+                    function) const -> bool override;
+            auto ApplyFunctionToRadarTarget(
+                const std::string& callsign,
+                const std::function<void(const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface&)>&
+                    function) const -> bool override;
             MOCK_CONST_METHOD0(
                 GetSelectedFlightplan, std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface>());
             MOCK_CONST_METHOD0(
@@ -84,12 +92,16 @@ namespace UKControllerPluginTest {
             void SetEuroscopeSelectedFlightplan(
                 const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan) override;
             void ExpectNoFlightplanLoop();
+            [[nodiscard]] auto CountFlightplanLoops() const -> int;
 
             private:
             std::list<MockFlightplanRadarTargetPair> allFpRtPairs;
             std::list<std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>> allControllers;
 
             bool expectFlightplanLoopNoFire = false;
+
+            // How many times the flightplans have been walked
+            mutable int flightplanLoops = 0;
         };
     } // namespace Euroscope
 } // namespace UKControllerPluginTest
@@ -0,0 +1,4 @@
+#include "MockFlightplanSweepStage.h"
+
+UKControllerPluginTest::Flightplan::MockFlightplanSweepStage::MockFlightplanSweepStage() = default;
+UKControllerPluginTest::Flightplan::MockFlightplanSweepStage::~MockFlightplanSweepStage() = default;
@@ -0,0 +1,18 @@
+#pragma once
+#include "flightplan/FlightplanSweepStage.h"
+
+namespace UKControllerPluginTest::Flightplan {
+    class MockFlightplanSweepStage : public UKControllerPlugin::Flightplan::FlightplanSweepStage
+    {
+        public:
+        MockFlightplanSweepStage();
+        virtual ~MockFlightplanSweepStage();
+        MOCK_METHOD(bool, ShouldSweep, (), (const, override));
+        MOCK_METHOD(
+            void,
+            SweepFlightplan,
+            (UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface&,
+             UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface&),
+            (override));
+    };
+} // namespace UKControllerPluginTest::Flightplan
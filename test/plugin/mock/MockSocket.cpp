@@ -14,7 +14,7 @@ namespace UKControllerPluginTest::Integration {
 
     SocketInterface& MockSocket::operator>>(std::string& message)
     {
-        this->ExtractStringOverride();
+        message = this->ExtractStringOverride();
         return *this;
     }
 
@@ -8,7 +8,7 @@ namespace UKControllerPluginTest::Integration {
         MockSocket();
         virtual ~MockSocket();
         MOCK_METHOD(bool, Active, (), (const, override));
-        MOCK_METHOD(void, ExtractStringOverride, ());
+        MOCK_METHOD(std::string, ExtractStringOverride, ());
         MOCK_METHOD(std::string, ExtractStreamOverride, ());
         MOCK_METHOD(std::string, InsertStringOverride, (std::string));
         SocketInterface& operator<<(std::string& message) override;
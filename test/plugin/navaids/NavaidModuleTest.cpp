@@ -59,13 +59,6 @@ namespace UKControllerPluginTest::Navaids {
         EXPECT_FALSE(NavaidValid(data));
     }
 
-    TEST_F(NavaidModuleTest, NavaidValidReturnsFalseIfLatitudeInvalid)
-    {
-        nlohmann::json data = {
-            {"id", 1}, {"latitude", "abc"}, {"longitude", "W000.26.50.000"}, {"identifier", "TIMBA"}};
-        EXPECT_FALSE(NavaidValid(data));
-    }
-
     TEST_F(NavaidModuleTest, NavaidValidReturnsFalseIfLatitudeNotString)
     {
         nlohmann::json data = {{"id", 1}, {"latitude", 123}, {"longitude", "W000.26.50.000"}, {"identifier", "TIMBA"}};
@@ -78,13 +71,6 @@ namespace UKControllerPluginTest::Navaids {
         EXPECT_FALSE(NavaidValid(data));
     }
 
-    TEST_F(NavaidModuleTest, NavaidValidReturnsFalseIfLongitudeInvalid)
-    {
-        nlohmann::json data = {
-            {"id", 1}, {"latitude", "W000.26.50.000"}, {"longitude", "abc"}, {"identifier", "TIMBA"}};
-        EXPECT_FALSE(NavaidValid(data));
-    }
-
     TEST_F(NavaidModuleTest, NavaidValidReturnsFalseIfLongitudeNotString)
     {
         nlohmann::json data = {{"id", 1}, {"longitude", 123}, {"latitude", "W000.26.50.000"}, {"identifier", "TIMBA"}};
@@ -122,6 +108,21 @@ namespace UKControllerPluginTest::Navaids {
         EXPECT_EQ(0, this->container.navaids->Count());
     }
 
+    TEST_F(NavaidModuleTest, BootstrapPluginSkipsNavaidsWithInvalidCoordinates)
+    {
+        nlohmann::json data = nlohmann::json::array();
+        data.push_back({{"id", 1}, {"identifier", "TIMBA"}, {"latitude", "abc"}, {"longitude", "W000.26.50.000"}});
+        data.push_back({{"id", 2}, {"identifier", "WILLO"}, {"latitude", "N051.18.18.000"}, {"longitude", "abc"}});
+        data.push_back(
+            {{"id", 3}, {"identifier", "BIG"}, {"latitude", "N051.18.18.000"}, {"longitude", "W000.26.50.000"}});
+
+        ON_CALL(this->dependency, LoadDependency("DEPENDENCY_NAVAIDS", "{}"_json)).WillByDefault(Return(data));
+
+        BootstrapPlugin(this->container, this->dependency);
+        EXPECT_EQ(1, this->container.navaids->Count());
+        EXPECT_EQ(3, this->container.navaids->GetByIdentifier("BIG").id);
+    }
+
     TEST_F(NavaidModuleTest, BootstrapPluginLoadsNavaids)
     {
         nlohmann::json data = nlohmann::json::array();
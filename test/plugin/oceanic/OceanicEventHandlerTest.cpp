@@ -165,6 +165,38 @@ namespace UKControllerPluginTest {
             EXPECT_EQ("", nattrakClearanceTwo.extra);
         }
 
+        TEST_F(OceanicEventHandlerTest, ItKeepsClearanceDataIfNattrakSaysNotModified)
+        {
+            nlohmann::json clearance = {
+                {"callsign", "BAW123"},
+                {"status", "CLEARED"},
+                {"nat", "A"},
+                {"fix", "MALOT"},
+                {"level", "320"},
+                {"mach", ".85"},
+                {"estimating_time", "01:25"},
+                {"clearance_issued", "2021-03-28 11:12:34"},
+                {"extra_info", "More info"},
+            };
+
+            CurlResponse firstResponse(nlohmann::json::array({clearance}).dump(), false, 200);
+            firstResponse.AddHeader("ETag", "\"abc\"");
+
+            CurlRequest firstRequest("https://nattrak.vatsim.net/api/plugins", CurlRequest::METHOD_GET);
+            CurlRequest secondRequest("https://nattrak.vatsim.net/api/plugins", CurlRequest::METHOD_GET);
+            secondRequest.AddHeader("If-None-Match", "\"abc\"");
+
+            EXPECT_CALL(mockCurl, MakeCurlRequest(firstRequest)).Times(1).WillOnce(Return(firstResponse));
+            EXPECT_CALL(mockCurl, MakeCurlRequest(secondRequest))
+                .Times(1)
+                .WillOnce(Return(CurlResponse("", false, 304)));
+
+            this->handler.TimedEventTrigger();
+            this->handler.TimedEventTrigger();
+            EXPECT_EQ(1, this->handler.CountClearances());
+            EXPECT_EQ("CLEARED", this->handler.GetClearanceForCallsign("BAW123").status);
+        }
+
         TEST_F(OceanicEventHandlerTest, ClearanceValidReturnsTrueWithAllFilledIn)
         {
             nlohmann::json clearanceData = {
@@ -404,4 +404,98 @@ namespace UKControllerPluginTest::Ownership {
 
         EXPECT_TRUE(this->providers->GetServiceProviders("EGGD").empty());
     }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedHandlesPositionsNotInAnyTopdown)
+    {
+        EXPECT_NO_THROW(this->manager.PositionStatusChanged("EGFF_TWR"));
+        EXPECT_TRUE(this->providers->GetServiceProviders("EGGD").empty());
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedSetsProvidersOnLogon)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_TWR"),
+            *this->providers->DeliveryProviderForAirfield("EGGD")->controller);
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedUpdatesProvidersOnHigherPriorityLogon)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+        this->activeCallsigns.AddCallsign(groundCallsign);
+        this->manager.PositionStatusChanged("EGGD_GND");
+
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_GND"),
+            *this->providers->DeliveryProviderForAirfield("EGGD")->controller);
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_TWR"),
+            *(*this->providers->GetProvidersForServiceAtAirfield("EGGD", ServiceType::Tower).cbegin())->controller);
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedUpdatesProvidersOnLogoff)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->activeCallsigns.AddCallsign(groundCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+        this->activeCallsigns.RemoveCallsign(groundCallsign);
+        this->manager.PositionStatusChanged("EGGD_GND");
+
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_TWR"),
+            *this->providers->DeliveryProviderForAirfield("EGGD")->controller);
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedRemovesAllProvidersIfNoneOnline)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+        this->activeCallsigns.RemoveCallsign(towerCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+
+        EXPECT_TRUE(this->providers->GetServiceProviders("EGGD").empty());
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedDoesNotReplaceProvidersIfNothingChanged)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->activeCallsigns.AddCallsign(enrouteCallsign);
+        this->manager.PositionStatusChanged("LON_W_CTR");
+        const auto deliveryProvider = this->providers->DeliveryProviderForAirfield("EGGD");
+
+        this->activeCallsigns.AddCallsign(enrouteCallsign2);
+        this->manager.PositionStatusChanged("LON_CTR");
+
+        EXPECT_EQ(deliveryProvider, this->providers->DeliveryProviderForAirfield("EGGD"));
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedPicksUpPositionsActiveBeforeFirstUpdate)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->activeCallsigns.AddCallsign(groundCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_GND"),
+            *this->providers->DeliveryProviderForAirfield("EGGD")->controller);
+    }
+
+    TEST_F(AirfieldOwnershipManagerTest, PositionStatusChangedReseedsAfterFlush)
+    {
+        this->activeCallsigns.AddCallsign(towerCallsign);
+        this->manager.PositionStatusChanged("EGGD_TWR");
+        this->manager.Flush();
+        this->activeCallsigns.AddCallsign(groundCallsign);
+        this->manager.PositionStatusChanged("EGGD_GND");
+
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_GND"),
+            *this->providers->DeliveryProviderForAirfield("EGGD")->controller);
+        EXPECT_EQ(
+            this->activeCallsigns.GetCallsign("EGGD_TWR"),
+            *(*this->providers->GetProvidersForServiceAtAirfield("EGGD", ServiceType::Tower).cbegin())->controller);
+    }
 } // namespace UKControllerPluginTest::Ownership
@@ -0,0 +1,89 @@
+#include "airfield/AirfieldCollection.h"
+#include "airfield/AirfieldModel.h"
+#include "controller/ControllerPosition.h"
+#include "controller/ControllerPositionHierarchy.h"
+#include "ownership/AirfieldTopdownIndex.h"
+
+using UKControllerPlugin::Airfield::AirfieldCollection;
+using UKControllerPlugin::Airfield::AirfieldModel;
+using UKControllerPlugin::Controller::ControllerPosition;
+using UKControllerPlugin::Controller::ControllerPositionHierarchy;
+using UKControllerPlugin::Ownership::AirfieldTopdownIndex;
+
+namespace UKControllerPluginTest::Ownership {
+
+    class AirfieldTopdownIndexTest : public testing::Test
+    {
+        public:
+        AirfieldTopdownIndexTest()
+            : tower(std::make_shared<ControllerPosition>(
+                  1, "EGGD_TWR", 133.850, std::vector<std::string>{"EGGD"}, true, false)),
+              approach(std::make_shared<ControllerPosition>(
+                  2, "EGGD_APP", 125.650, std::vector<std::string>{"EGGD", "EGFF"}, true, false)),
+              index(airfields)
+        {
+            auto bristol = std::make_unique<ControllerPositionHierarchy>();
+            bristol->AddPosition(tower);
+            bristol->AddPosition(approach);
+            airfields.AddAirfield(std::make_shared<AirfieldModel>(1, "EGGD", std::move(bristol)));
+
+            auto cardiff = std::make_unique<ControllerPositionHierarchy>();
+            cardiff->AddPosition(approach);
+            airfields.AddAirfield(std::make_shared<AirfieldModel>(2, "EGFF", std::move(cardiff)));
+        }
+
+        std::shared_ptr<ControllerPosition> tower;
+        std::shared_ptr<ControllerPosition> approach;
+        AirfieldCollection airfields;
+        AirfieldTopdownIndex index;
+    };
+
+    TEST_F(AirfieldTopdownIndexTest, ItStartsEmptyAndStale)
+    {
+        EXPECT_EQ(0, index.CountPositions());
+        EXPECT_TRUE(index.Stale());
+    }
+
+    TEST_F(AirfieldTopdownIndexTest, ItIsNotStaleAfterRebuilding)
+    {
+        index.Rebuild();
+        EXPECT_FALSE(index.Stale());
+    }
+
+    TEST_F(AirfieldTopdownIndexTest, ItBecomesStaleWhenAirfieldsAreAdded)
+    {
+        index.Rebuild();
+        airfields.AddAirfield(
+            std::make_shared<AirfieldModel>(3, "EGTE", std::make_unique<ControllerPositionHierarchy>()));
+        EXPECT_TRUE(index.Stale());
+    }
+
+    TEST_F(AirfieldTopdownIndexTest, ItIndexesEveryPosition)
+    {
+        index.Rebuild();
+        EXPECT_EQ(2, index.CountPositions());
+    }
+
+    TEST_F(AirfieldTopdownIndexTest, ItReturnsAirfieldsAndRanksForPosition)
+    {
+        index.Rebuild();
+        const auto& covered = index.AirfieldsForPosition("EGGD_APP");
+        ASSERT_EQ(2, covered.size());
+
+        const auto bristol = std::find_if(
+            covered.cbegin(), covered.cend(), [](const auto& airfield) { return airfield.icao == "EGGD"; });
+        ASSERT_NE(covered.cend(), bristol);
+        EXPECT_EQ(1, bristol->rank);
+
+        const auto cardiff = std::find_if(
+            covered.cbegin(), covered.cend(), [](const auto& airfield) { return airfield.icao == "EGFF"; });
+        ASSERT_NE(covered.cend(), cardiff);
+        EXPECT_EQ(0, cardiff->rank);
+    }
+
+    TEST_F(AirfieldTopdownIndexTest, ItReturnsNoAirfieldsForUnknownPosition)
+    {
+        index.Rebuild();
+        EXPECT_TRUE(index.AirfieldsForPosition("LON_CTR").empty());
+    }
+} // namespace UKControllerPluginTest::Ownership
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <future>
 #include <gdiplus.h>
 #include <gdiplusgraphics.h>
 #include <gdiplustypes.h>
@@ -35,9 +37,11 @@
 #include <list>
 #include <mutex>
 #include <queue>
+#include <random>
 #include <regex>
 #include <set>
 #include <string>
+#include <thread>
 #include <typeindex>
 #include <unordered_set>
 
@@ -90,6 +94,8 @@
 #include "../mock/MockExitDetermination.h"
 #include "../mock/MockFlightPlanEventHandlerInterface.h"
 #include "../mock/MockFlightplanRadarTargetPair.h"
+#include "../mock/MockFlightplanSweepStage.h"
+#include "../mock/MockBulkRequestHandler.h"
 #include "../mock/MockGraphicsInterface.h"
 #include "../mock/MockIntegrationActionProcessor.h"
 #include "../mock/MockIntegrationDataInitialiser.h"
@@ -1,17 +1,46 @@
 #include "bootstrap/PersistenceContainer.h"
+#include "euroscope/WrapperAllocationCounter.h"
 #include "plugin/UKPlugin.h"
 #include "plugin/UkPluginBootstrap.h"
+#include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Bootstrap::UkPluginBootstrap;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
 
 namespace UKControllerPluginTest::Bootstrap {
 
-    TEST(UkPluginBootstrap, BootstrapPluginCreatesPlugin)
+    class UkPluginBootstrapTest : public testing::Test
     {
+        public:
+        UkPluginBootstrapTest()
+        {
+            container.timedHandler = std::make_unique<TimedEventCollection>();
+        }
+
         PersistenceContainer container;
+    };
+
+    TEST_F(UkPluginBootstrapTest, BootstrapPluginCreatesPlugin)
+    {
         UkPluginBootstrap::BootstrapPlugin(container);
 
         EXPECT_NO_THROW(static_cast<UKControllerPlugin::UKPlugin&>(*container.plugin).GetPlugInName());
     }
+
+    TEST_F(UkPluginBootstrapTest, BootstrapPluginCreatesWrapperAllocationCounter)
+    {
+        UkPluginBootstrap::BootstrapPlugin(container);
+
+        EXPECT_EQ(0, container.wrapperAllocations->TotalAllocations());
+    }
+
+    TEST_F(UkPluginBootstrapTest, BootstrapPluginRegistersWrapperAllocationCounterForTimedEvents)
+    {
+        UkPluginBootstrap::BootstrapPlugin(container);
+
+        EXPECT_EQ(
+            1,
+            container.timedHandler->CountHandlersForFrequency(UkPluginBootstrap::wrapperAllocationSampleFrequency));
+    }
 } // namespace UKControllerPluginTest::Bootstrap
@@ -2,6 +2,7 @@
 #include "push/PushEventProcessorCollection.h"
 #include "push/PushEventSubscription.h"
 #include "api/ApiException.h"
+#include "api/ApiHealthTracker.h"
 
 using testing::NiceMock;
 using testing::Return;
@@ -14,6 +15,7 @@ using UKControllerPlugin::Push::PushEventSubscription;
 using UKControllerPluginTest::Api::MockApiInterface;
 using UKControllerPluginTest::Push::MockPushEventProcessor;
 using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+using UKControllerPluginUtils::Api::ApiHealthTracker;
 
 namespace UKControllerPluginTest {
     namespace Push {
@@ -288,5 +290,76 @@ namespace UKControllerPluginTest {
 
             connection.TimedEventTrigger();
         }
+
+        TEST_F(PollingPushEventConnectionTest, ItResumesFromAGivenEvent)
+        {
+            connection.ResumeFrom(12);
+
+            EXPECT_CALL(mockApi, SyncPluginEvents()).Times(0);
+            EXPECT_CALL(mockApi, GetLatestPluginEvents(12)).Times(1).WillOnce(Return(nlohmann::json::array()));
+
+            connection.TimedEventTrigger();
+            EXPECT_EQ(12, connection.LastEventId());
+        }
+
+        TEST_F(PollingPushEventConnectionTest, ItReportsRequestsInProgress)
+        {
+            EXPECT_FALSE(connection.RequestInProgress());
+            connection.SetUpdateInProgress();
+            EXPECT_TRUE(connection.RequestInProgress());
+        }
+
+        TEST_F(PollingPushEventConnectionTest, ItDoesntSyncWhilstTheSyncEndpointIsBackingOff)
+        {
+            auto apiHealth = std::make_shared<ApiHealthTracker>();
+            for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold; i++) {
+                apiHealth->RecordFailure(
+                    "https://ukcp.vatsim.uk/api/plugin-events/sync", std::chrono::milliseconds(100));
+            }
+            PollingPushEventConnection trackingConnection(mockApi, mockTaskRunner, collection, apiHealth);
+
+            EXPECT_CALL(mockApi, SyncPluginEvents()).Times(0);
+
+            trackingConnection.TimedEventTrigger();
+        }
+
+        TEST_F(PollingPushEventConnectionTest, ItDoesntGetLatestEventsWhilstTheLatestEventsEndpointIsBackingOff)
+        {
+            auto apiHealth = std::make_shared<ApiHealthTracker>();
+            for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold; i++) {
+                apiHealth->RecordFailure(
+                    "https://ukcp.vatsim.uk/api/plugin-events/recent?previous=12", std::chrono::milliseconds(100));
+            }
+            PollingPushEventConnection trackingConnection(mockApi, mockTaskRunner, collection, apiHealth);
+            trackingConnection.ResumeFrom(12);
+
+            EXPECT_CALL(mockApi, GetLatestPluginEvents(testing::_)).Times(0);
+
+            trackingConnection.TimedEventTrigger();
+        }
+
+        TEST_F(PollingPushEventConnectionTest, ItPollsWhilstADifferentEndpointIsBackingOff)
+        {
+            auto apiHealth = std::make_shared<ApiHealthTracker>();
+            for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold; i++) {
+                apiHealth->RecordFailure("https://ukcp.vatsim.uk/api/stand/assignment", std::chrono::milliseconds(100));
+            }
+            ASSERT_FALSE(apiHealth->Healthy());
+            PollingPushEventConnection trackingConnection(mockApi, mockTaskRunner, collection, apiHealth);
+
+            EXPECT_CALL(mockApi, SyncPluginEvents()).Times(1).WillOnce(Return(nlohmann::json{{"event_id", 55}}));
+
+            trackingConnection.TimedEventTrigger();
+        }
+
+        TEST_F(PollingPushEventConnectionTest, ItPollsIfTheApiIsHealthy)
+        {
+            auto apiHealth = std::make_shared<ApiHealthTracker>();
+            PollingPushEventConnection trackingConnection(mockApi, mockTaskRunner, collection, apiHealth);
+
+            EXPECT_CALL(mockApi, SyncPluginEvents()).Times(1).WillOnce(Return(nlohmann::json{{"event_id", 55}}));
+
+            trackingConnection.TimedEventTrigger();
+        }
     } // namespace Push
 } // namespace UKControllerPluginTest
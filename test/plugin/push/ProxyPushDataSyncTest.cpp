@@ -1,23 +1,43 @@
 #include "push/ProxyPushDataSync.h"
 #include "push/PushEventProcessorCollection.h"
+#include "push/PushEventRingBuffer.h"
 #include "push/PushEventSubscription.h"
+#include "push/SharedSyncData.h"
+#include "push/SyncSnapshotStore.h"
 
 using testing::NiceMock;
 using testing::Test;
 using UKControllerPlugin::Push::ProxyPushDataSync;
 using UKControllerPlugin::Push::PushEventProcessorCollection;
+using UKControllerPlugin::Push::PushEventRingBuffer;
 using UKControllerPlugin::Push::PushEventSubscription;
+using UKControllerPlugin::Push::SharedSyncData;
+using UKControllerPlugin::Push::SyncSnapshotStore;
 
 namespace UKControllerPluginTest::Push {
 
     class ProxyPushDataSyncTest : public Test
     {
         public:
-        ProxyPushDataSyncTest() : eventProcessor(std::make_shared<NiceMock<MockPushEventProcessor>>()), sync(collection)
+        ProxyPushDataSyncTest()
+            : eventMemory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1),
+              snapshotMemory(SyncSnapshotStore::RequiredSize(2, 256) / sizeof(uint64_t) + 1),
+              sharedEvents(std::make_shared<PushEventRingBuffer>(eventMemory.data(), 4, 64)),
+              snapshots(std::make_shared<SyncSnapshotStore>(snapshotMemory.data(), 2, 256)),
+              eventProcessor(std::make_shared<NiceMock<MockPushEventProcessor>>()), sync(collection)
         {
             this->collection.AddProcessor(this->eventProcessor);
+            this->sharedEvents->Initialise();
+            this->snapshots->Initialise();
+            this->sharedSync = std::make_shared<SharedSyncData>(snapshots, sharedEvents, false);
+            this->sharedSync->Share("foo", this->eventProcessor);
         }
 
+        std::vector<uint64_t> eventMemory;
+        std::vector<uint64_t> snapshotMemory;
+        std::shared_ptr<PushEventRingBuffer> sharedEvents;
+        std::shared_ptr<SyncSnapshotStore> snapshots;
+        std::shared_ptr<SharedSyncData> sharedSync;
         PushEventProcessorCollection collection;
         std::shared_ptr<NiceMock<MockPushEventProcessor>> eventProcessor;
         ProxyPushDataSync sync;
@@ -38,4 +58,38 @@ namespace UKControllerPluginTest::Push {
         sync.TimedEventTrigger();
         sync.TimedEventTrigger();
     }
+
+    TEST_F(ProxyPushDataSyncTest, ItSyncsImmediatelyIfSharedDataIsReady)
+    {
+        SharedSyncData primary(snapshots, sharedEvents, true);
+        primary.Publish("foo", nlohmann::json::array());
+        ProxyPushDataSync sharedDataSync(collection, sharedSync);
+
+        EXPECT_CALL(*this->eventProcessor, PluginEventsSynced).Times(1);
+        sharedDataSync.TimedEventTrigger();
+        EXPECT_EQ(0, snapshots->RefreshRequests());
+    }
+
+    TEST_F(ProxyPushDataSyncTest, ItRequestsSharedDataAndWaitsForIt)
+    {
+        ProxyPushDataSync sharedDataSync(collection, sharedSync);
+
+        EXPECT_CALL(*this->eventProcessor, PluginEventsSynced).Times(0);
+        sharedDataSync.TimedEventTrigger();
+        sharedDataSync.TimedEventTrigger();
+        EXPECT_EQ(1, snapshots->RefreshRequests());
+    }
+
+    TEST_F(ProxyPushDataSyncTest, ItSyncsOnceSharedDataArrives)
+    {
+        ProxyPushDataSync sharedDataSync(collection, sharedSync);
+        sharedDataSync.TimedEventTrigger();
+
+        SharedSyncData primary(snapshots, sharedEvents, true);
+        primary.Publish("foo", nlohmann::json::array());
+
+        EXPECT_CALL(*this->eventProcessor, PluginEventsSynced).Times(1);
+        sharedDataSync.TimedEventTrigger();
+        sharedDataSync.TimedEventTrigger();
+    }
 } // namespace UKControllerPluginTest::Push
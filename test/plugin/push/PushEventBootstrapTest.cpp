@@ -1,6 +1,7 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "push/PushEventBootstrap.h"
 #include "push/PushEventProcessorCollection.h"
+#include "push/SharedSyncData.h"
 #include "timedevent/TimedEventCollection.h"
 
 using testing::Test;
@@ -18,49 +19,69 @@ namespace UKControllerPluginTest::Push {
             container.timedHandler = std::make_unique<TimedEventCollection>();
         }
 
+        // Keep each test's shared memory separate from any other instance
+        std::wstring sharedMemoryName = L"Local\\UKControllerPluginPushEventsTest" +
+                                        std::to_wstring(reinterpret_cast<uintptr_t>(this)); // NOLINT
         PersistenceContainer container;
     };
 
     TEST_F(PushEventBootstrapTest, ItSetsUpEventProcessorCollectionOnNonDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, false);
+        BootstrapPlugin(this->container, false, sharedMemoryName);
         EXPECT_NE(nullptr, this->container.pushEventProcessors);
     }
 
     TEST_F(PushEventBootstrapTest, ItSetsUpEventProcessorCollectionOnDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, true);
+        BootstrapPlugin(this->container, true, sharedMemoryName);
         EXPECT_NE(nullptr, this->container.pushEventProcessors);
     }
 
     TEST_F(PushEventBootstrapTest, ItSetsUpTimedEventsOnNonDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, false);
-        EXPECT_EQ(2, this->container.timedHandler->CountHandlers());
+        BootstrapPlugin(this->container, false, sharedMemoryName);
+        EXPECT_EQ(3, this->container.timedHandler->CountHandlers());
         EXPECT_EQ(2, this->container.timedHandler->CountHandlersForFrequency(1));
+        EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(5));
     }
 
     TEST_F(PushEventBootstrapTest, ItSetsUpProtocolHandlerForTimedEventsOnDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, true);
+        BootstrapPlugin(this->container, true, sharedMemoryName);
         EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(1));
     }
 
     TEST_F(PushEventBootstrapTest, ItSetsUpProxySyncOnDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, true);
+        BootstrapPlugin(this->container, true, sharedMemoryName);
         EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(5));
     }
 
     TEST_F(PushEventBootstrapTest, ItSetsUpProxyHandlerForPushEventsOnNonDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, false);
+        BootstrapPlugin(this->container, false, sharedMemoryName);
         EXPECT_EQ(1, this->container.pushEventProcessors->CountProcessorsForAll());
     }
 
     TEST_F(PushEventBootstrapTest, ItDoesntSetUpProxyHandlerForPushEventsOnDuplicatePlugin)
     {
-        BootstrapPlugin(this->container, true);
+        BootstrapPlugin(this->container, true, sharedMemoryName);
         EXPECT_EQ(0, this->container.pushEventProcessors->CountProcessorsForAll());
     }
+
+    TEST_F(PushEventBootstrapTest, ItSetsUpSharedSyncDataAsPrimaryOnNonDuplicatePlugin)
+    {
+        BootstrapPlugin(this->container, false, sharedMemoryName);
+        EXPECT_NE(nullptr, this->container.sharedPushEventMemory);
+        ASSERT_NE(nullptr, this->container.sharedPushSync);
+        EXPECT_TRUE(this->container.sharedPushSync->Primary());
+    }
+
+    TEST_F(PushEventBootstrapTest, ItSetsUpSharedSyncDataAsSecondaryOnDuplicatePlugin)
+    {
+        BootstrapPlugin(this->container, true, sharedMemoryName);
+        EXPECT_NE(nullptr, this->container.sharedPushEventMemory);
+        ASSERT_NE(nullptr, this->container.sharedPushSync);
+        EXPECT_FALSE(this->container.sharedPushSync->Primary());
+    }
 } // namespace UKControllerPluginTest::Push
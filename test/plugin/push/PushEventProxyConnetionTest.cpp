@@ -1,7 +1,9 @@
 #include "push/PushEventProxyConnection.h"
+#include "push/PushEventRingBuffer.h"
 
 using ::testing::Test;
 using UKControllerPlugin::Push::PushEventProxyConnection;
+using UKControllerPlugin::Push::PushEventRingBuffer;
 
 namespace UKControllerPluginTest {
     namespace Push {
@@ -28,6 +30,23 @@ namespace UKControllerPluginTest {
             EXPECT_EQ("", connection.GetNextMessage());
         }
 
+        TEST_F(PushEventProxyConnectionTest, ItReturnsMessagesFromSharedMemoryAfterTheQueue)
+        {
+            std::vector<uint64_t> memory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1);
+            auto sharedEvents = std::make_shared<PushEventRingBuffer>(memory.data(), 4, 64);
+            sharedEvents->Initialise();
+            EXPECT_TRUE(sharedEvents->Write("old"));
+            PushEventProxyConnection sharedConnection(sharedEvents);
+
+            EXPECT_TRUE(sharedEvents->Write("b"));
+            EXPECT_TRUE(sharedEvents->Write("c"));
+            sharedConnection.AddMessageToQueue("a");
+            EXPECT_EQ("a", sharedConnection.GetNextMessage());
+            EXPECT_EQ("b", sharedConnection.GetNextMessage());
+            EXPECT_EQ("c", sharedConnection.GetNextMessage());
+            EXPECT_EQ("", sharedConnection.GetNextMessage());
+        }
+
         TEST_F(PushEventProxyConnectionTest, ItLoadsHiddenWindow)
         {
             EXPECT_NE(
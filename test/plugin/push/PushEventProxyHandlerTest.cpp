@@ -1,9 +1,12 @@
 #include "push/PushEventProxyHandler.h"
+#include "push/PushEventRingBuffer.h"
 #include "push/PushEventSubscription.h"
 
 using testing::NiceMock;
 using testing::Test;
+using UKControllerPlugin::Push::PushEvent;
 using UKControllerPlugin::Push::PushEventProxyHandler;
+using UKControllerPlugin::Push::PushEventRingBuffer;
 using UKControllerPlugin::Push::PushEventSubscription;
 
 namespace UKControllerPluginTest {
@@ -21,5 +24,18 @@ namespace UKControllerPluginTest {
 
             EXPECT_EQ(expected, this->handler.GetPushEventSubscriptions());
         }
+
+        TEST_F(PushEventProxyHandlerTest, ItWritesEventsToSharedMemory)
+        {
+            std::vector<uint64_t> memory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1);
+            auto sharedEvents = std::make_shared<PushEventRingBuffer>(memory.data(), 4, 64);
+            sharedEvents->Initialise();
+            PushEventProxyHandler sharedHandler(sharedEvents);
+
+            sharedHandler.ProcessPushEvent({"test", "channel", nlohmann::json::object(), "raw message"});
+
+            uint64_t next = 1;
+            EXPECT_EQ("raw message", sharedEvents->Read(next));
+        }
     } // namespace Push
 } // namespace UKControllerPluginTest
@@ -0,0 +1,105 @@
+#include "push/PushEventRingBuffer.h"
+
+using testing::Test;
+using UKControllerPlugin::Push::PushEventRingBuffer;
+
+namespace UKControllerPluginTest::Push {
+
+    class PushEventRingBufferTest : public Test
+    {
+        public:
+        PushEventRingBufferTest()
+            : memory(PushEventRingBuffer::RequiredSize(slotCount, slotSize) / sizeof(uint64_t) + 1),
+              writer(memory.data(), slotCount, slotSize), reader(memory.data(), slotCount, slotSize)
+        {
+            writer.Initialise();
+        }
+
+        static inline const uint32_t slotCount = 4;
+        static inline const uint32_t slotSize = 16;
+        std::vector<uint64_t> memory;
+        PushEventRingBuffer writer;
+        PushEventRingBuffer reader;
+    };
+
+    TEST_F(PushEventRingBufferTest, ItCalculatesRequiredSize)
+    {
+        EXPECT_LT(4 * 16, PushEventRingBuffer::RequiredSize(4, 16));
+        EXPECT_LT(
+            PushEventRingBuffer::defaultSlotCount * PushEventRingBuffer::defaultSlotSize,
+            PushEventRingBuffer::RequiredSize());
+    }
+
+    TEST_F(PushEventRingBufferTest, ItStartsEmpty)
+    {
+        uint64_t next = reader.LatestSequence() + 1;
+        EXPECT_EQ(0, reader.LatestSequence());
+        EXPECT_EQ(std::nullopt, reader.Read(next));
+    }
+
+    TEST_F(PushEventRingBufferTest, ItReadsWrittenMessagesInOrder)
+    {
+        uint64_t next = reader.LatestSequence() + 1;
+        EXPECT_TRUE(writer.Write("a"));
+        EXPECT_TRUE(writer.Write("bb"));
+
+        EXPECT_EQ("a", reader.Read(next));
+        EXPECT_EQ("bb", reader.Read(next));
+        EXPECT_EQ(std::nullopt, reader.Read(next));
+        EXPECT_EQ(3, next);
+    }
+
+    TEST_F(PushEventRingBufferTest, MultipleReadersEachGetEveryMessage)
+    {
+        PushEventRingBuffer secondReader(memory.data(), slotCount, slotSize);
+        uint64_t firstNext = 1;
+        uint64_t secondNext = 1;
+        EXPECT_TRUE(writer.Write("a"));
+
+        EXPECT_EQ("a", reader.Read(firstNext));
+        EXPECT_EQ("a", secondReader.Read(secondNext));
+    }
+
+    TEST_F(PushEventRingBufferTest, ItDoesntWriteMessagesTooBigForASlot)
+    {
+        EXPECT_TRUE(writer.Write(std::string(slotSize, 'a')));
+        EXPECT_FALSE(writer.Write(std::string(slotSize + 1, 'a')));
+        EXPECT_EQ(1, writer.LatestSequence());
+    }
+
+    TEST_F(PushEventRingBufferTest, ReadersThatFallBehindSkipToTheOldestMessage)
+    {
+        uint64_t next = 1;
+        for (int i = 0; i < 6; i++) {
+            EXPECT_TRUE(writer.Write(std::to_string(i)));
+        }
+
+        EXPECT_EQ("2", reader.Read(next));
+        EXPECT_EQ("3", reader.Read(next));
+        EXPECT_EQ(5, next);
+    }
+
+    TEST_F(PushEventRingBufferTest, ItDoesntWriteOrReadUntilInitialised)
+    {
+        std::vector<uint64_t> otherMemory(memory.size());
+        PushEventRingBuffer uninitialised(otherMemory.data(), slotCount, slotSize);
+        uint64_t next = 1;
+
+        EXPECT_FALSE(uninitialised.Write("a"));
+        EXPECT_EQ(std::nullopt, uninitialised.Read(next));
+    }
+
+    TEST_F(PushEventRingBufferTest, InitialisingAgainKeepsTheSequence)
+    {
+        EXPECT_TRUE(writer.Write("a"));
+        EXPECT_TRUE(writer.Write("b"));
+
+        PushEventRingBuffer newWriter(memory.data(), slotCount, slotSize);
+        newWriter.Initialise();
+        EXPECT_EQ(2, newWriter.LatestSequence());
+        EXPECT_TRUE(newWriter.Write("c"));
+
+        uint64_t next = 3;
+        EXPECT_EQ("c", reader.Read(next));
+    }
+} // namespace UKControllerPluginTest::Push
@@ -0,0 +1,110 @@
+#include "push/PushEventStreamParser.h"
+
+using UKControllerPlugin::Push::PushEventStreamParser;
+
+namespace UKControllerPluginTest::Push {
+    class PushEventStreamParserTest : public testing::Test
+    {
+        public:
+        PushEventStreamParser parser;
+    };
+
+    TEST_F(PushEventStreamParserTest, ItParsesAnEvent)
+    {
+        const auto events = parser.Parse("id: 5\ndata: {\"foo\": \"bar\"}\n\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ(5, events[0].id);
+        EXPECT_EQ("{\"foo\": \"bar\"}", events[0].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItParsesMultipleEventsInOneChunk)
+    {
+        const auto events = parser.Parse("id: 5\ndata: a\n\nid: 6\ndata: b\n\n");
+
+        ASSERT_EQ(2, events.size());
+        EXPECT_EQ(5, events[0].id);
+        EXPECT_EQ("a", events[0].data);
+        EXPECT_EQ(6, events[1].id);
+        EXPECT_EQ("b", events[1].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItParsesEventsSplitAcrossChunks)
+    {
+        EXPECT_TRUE(parser.Parse("id: 1").empty());
+        EXPECT_TRUE(parser.Parse("2\nda").empty());
+        EXPECT_TRUE(parser.Parse("ta: abc\n").empty());
+        const auto events = parser.Parse("\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ(12, events[0].id);
+        EXPECT_EQ("abc", events[0].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItHandlesCarriageReturns)
+    {
+        const auto events = parser.Parse("id: 5\r\ndata: abc\r\n\r\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ(5, events[0].id);
+        EXPECT_EQ("abc", events[0].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItJoinsMultipleDataLines)
+    {
+        const auto events = parser.Parse("id: 5\ndata: abc\ndata: def\n\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ("abc\ndef", events[0].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItIgnoresComments)
+    {
+        const auto events = parser.Parse(": keep-alive\n\nid: 5\n: still here\ndata: abc\n\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ(5, events[0].id);
+        EXPECT_EQ("abc", events[0].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItIgnoresUnknownFields)
+    {
+        const auto events = parser.Parse("event: plugin-event\nretry: 1000\nid: 5\ndata: abc\n\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ("abc", events[0].data);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItDoesntDispatchEventsWithNoData)
+    {
+        EXPECT_TRUE(parser.Parse("id: 5\n\n").empty());
+    }
+
+    TEST_F(PushEventStreamParserTest, ItGivesEventsWithoutAValidIdAnIdOfMinusOne)
+    {
+        const auto events = parser.Parse("id: abc\ndata: abc\n\ndata: def\n\n");
+
+        ASSERT_EQ(2, events.size());
+        EXPECT_EQ(-1, events[0].id);
+        EXPECT_EQ(-1, events[1].id);
+    }
+
+    TEST_F(PushEventStreamParserTest, ItDoesntCarryTheIdOverToTheNextEvent)
+    {
+        const auto events = parser.Parse("id: 5\ndata: abc\n\ndata: def\n\n");
+
+        ASSERT_EQ(2, events.size());
+        EXPECT_EQ(-1, events[1].id);
+    }
+
+    TEST_F(PushEventStreamParserTest, ResettingDiscardsPartialEvents)
+    {
+        EXPECT_TRUE(parser.Parse("id: 5\ndata: ab").empty());
+        parser.Reset();
+        const auto events = parser.Parse("id: 6\ndata: def\n\n");
+
+        ASSERT_EQ(1, events.size());
+        EXPECT_EQ(6, events[0].id);
+        EXPECT_EQ("def", events[0].data);
+    }
+} // namespace UKControllerPluginTest::Push
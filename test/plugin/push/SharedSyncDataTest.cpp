@@ -0,0 +1,122 @@
+#include "push/PushEventRingBuffer.h"
+#include "push/SharedSyncData.h"
+#include "push/SyncSnapshotStore.h"
+
+using testing::NiceMock;
+using testing::Test;
+using UKControllerPlugin::Push::PushEventRingBuffer;
+using UKControllerPlugin::Push::SharedSyncData;
+using UKControllerPlugin::Push::SyncSnapshotStore;
+
+namespace UKControllerPluginTest::Push {
+
+    class SharedSyncDataTest : public Test
+    {
+        public:
+        SharedSyncDataTest()
+            : eventMemory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1),
+              snapshotMemory(SyncSnapshotStore::RequiredSize(2, 256) / sizeof(uint64_t) + 1),
+              events(std::make_shared<PushEventRingBuffer>(eventMemory.data(), 4, 64)),
+              snapshots(std::make_shared<SyncSnapshotStore>(snapshotMemory.data(), 2, 256)),
+              processor(std::make_shared<NiceMock<MockPushEventProcessor>>())
+        {
+            events->Initialise();
+            snapshots->Initialise();
+            static_cast<void>(events->Write("before"));
+        }
+
+        std::vector<uint64_t> eventMemory;
+        std::vector<uint64_t> snapshotMemory;
+        std::shared_ptr<PushEventRingBuffer> events;
+        std::shared_ptr<SyncSnapshotStore> snapshots;
+        std::shared_ptr<NiceMock<MockPushEventProcessor>> processor;
+    };
+
+    TEST_F(SharedSyncDataTest, PrimaryPublishesDataForSecondaries)
+    {
+        SharedSyncData secondary(snapshots, events, false);
+        SharedSyncData primary(snapshots, events, true);
+        primary.Publish("foo", nlohmann::json::array({1, 2}));
+
+        EXPECT_EQ(nlohmann::json::array({1, 2}), secondary.Get("foo"));
+    }
+
+    TEST_F(SharedSyncDataTest, PrimaryDoesntUseSharedData)
+    {
+        SharedSyncData primary(snapshots, events, true);
+        primary.Publish("foo", nlohmann::json::array({1, 2}));
+
+        EXPECT_EQ(std::nullopt, primary.Get("foo"));
+    }
+
+    TEST_F(SharedSyncDataTest, SecondariesDontPublish)
+    {
+        SharedSyncData secondary(snapshots, events, false);
+        secondary.Publish("foo", nlohmann::json::array({1, 2}));
+
+        EXPECT_EQ(std::nullopt, snapshots->Get("foo"));
+    }
+
+    TEST_F(SharedSyncDataTest, SecondariesDontUseDataFromBeforeTheyStarted)
+    {
+        SharedSyncData primary(snapshots, events, true);
+        primary.Publish("foo", nlohmann::json::array({1, 2}));
+        static_cast<void>(events->Write("after"));
+        SharedSyncData secondary(snapshots, events, false);
+
+        EXPECT_EQ(std::nullopt, secondary.Get("foo"));
+    }
+
+    TEST_F(SharedSyncDataTest, SecondariesAreReadyOnceAllSharedDataIsFresh)
+    {
+        SharedSyncData secondary(snapshots, events, false);
+        SharedSyncData primary(snapshots, events, true);
+        secondary.Share("foo", processor);
+        secondary.Share("bar", processor);
+        EXPECT_FALSE(secondary.Ready());
+
+        primary.Publish("foo", nlohmann::json::array());
+        EXPECT_FALSE(secondary.Ready());
+
+        primary.Publish("bar", nlohmann::json::array());
+        EXPECT_TRUE(secondary.Ready());
+    }
+
+    TEST_F(SharedSyncDataTest, ItsReadyIfNothingIsShared)
+    {
+        SharedSyncData secondary(snapshots, events, false);
+        EXPECT_TRUE(secondary.Ready());
+    }
+
+    TEST_F(SharedSyncDataTest, PrimaryReloadsSharedDataWhenAsked)
+    {
+        SharedSyncData primary(snapshots, events, true);
+        SharedSyncData secondary(snapshots, events, false);
+        primary.Share("foo", processor);
+
+        EXPECT_CALL(*processor, PluginEventsSynced).Times(1);
+        secondary.RequestRefresh();
+        primary.TimedEventTrigger();
+        primary.TimedEventTrigger();
+    }
+
+    TEST_F(SharedSyncDataTest, PrimaryDoesntReloadSharedDataIfNotAsked)
+    {
+        snapshots->RequestRefresh();
+        SharedSyncData primary(snapshots, events, true);
+        primary.Share("foo", processor);
+
+        EXPECT_CALL(*processor, PluginEventsSynced).Times(0);
+        primary.TimedEventTrigger();
+    }
+
+    TEST_F(SharedSyncDataTest, SecondariesDontReloadSharedData)
+    {
+        SharedSyncData secondary(snapshots, events, false);
+        secondary.Share("foo", processor);
+
+        EXPECT_CALL(*processor, PluginEventsSynced).Times(0);
+        secondary.RequestRefresh();
+        secondary.TimedEventTrigger();
+    }
+} // namespace UKControllerPluginTest::Push
@@ -0,0 +1,280 @@
+#include "api/ApiException.h"
+#include "api/ApiNotFoundException.h"
+#include "push/PushEventProcessorCollection.h"
+#include "push/PushEventSubscription.h"
+#include "push/StreamingPushEventConnection.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::Test;
+using testing::Throw;
+using UKControllerPlugin::Api::ApiException;
+using UKControllerPlugin::Api::ApiNotFoundException;
+using UKControllerPlugin::Push::PushEventProcessorCollection;
+using UKControllerPlugin::Push::PushEventSubscription;
+using UKControllerPlugin::Push::StreamingPushEventConnection;
+using UKControllerPluginTest::Api::MockApiInterface;
+using UKControllerPluginTest::Push::MockPushEventProcessor;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+
+namespace UKControllerPluginTest::Push {
+
+    class StreamingPushEventConnectionTest : public Test
+    {
+        public:
+        StreamingPushEventConnectionTest()
+            : eventProcessor(std::make_shared<NiceMock<MockPushEventProcessor>>()),
+              connection(mockApi, mockTaskRunner, collection)
+        {
+        }
+
+        static auto StreamedEvent(int id, const nlohmann::json& event) -> std::string
+        {
+            return "id: " + std::to_string(id) + "\ndata: " + event.dump() + "\n\n";
+        }
+
+        static auto Event(const std::string& channel) -> nlohmann::json
+        {
+            return {{"channel", channel}, {"data", {{"foo", "bar"}}}};
+        }
+
+        /*
+            Stands in for the API's event stream, sending the stream in small chunks as a real connection
+            would, then closing it.
+        */
+        static auto StandInServer(std::string stream)
+        {
+            return [stream](int, const std::function<bool(const std::string&)>& onData) {
+                const size_t chunkSize = 7;
+                for (size_t i = 0; i < stream.size(); i += chunkSize) {
+                    if (!onData(stream.substr(i, chunkSize))) {
+                        return;
+                    }
+                }
+            };
+        }
+
+        void Synced(int eventId)
+        {
+            ON_CALL(mockApi, SyncPluginEvents).WillByDefault(Return(nlohmann::json{{"event_id", eventId}}));
+        }
+
+        std::shared_ptr<NiceMock<MockPushEventProcessor>> eventProcessor;
+        PushEventProcessorCollection collection;
+        MockTaskRunnerInterface mockTaskRunner;
+        NiceMock<MockApiInterface> mockApi;
+        StreamingPushEventConnection connection;
+    };
+
+    TEST_F(StreamingPushEventConnectionTest, GetNextMessageReturnsEmptyIfNoMessages)
+    {
+        EXPECT_EQ("", connection.GetNextMessage());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItSyncsBeforeStreaming)
+    {
+        std::set<PushEventSubscription> subs = {{PushEventSubscription::SUB_TYPE_CHANNEL, "channel1"}};
+        ON_CALL(*this->eventProcessor, GetPushEventSubscriptions).WillByDefault(Return(subs));
+        this->collection.AddProcessor(this->eventProcessor);
+
+        EXPECT_CALL(mockApi, SyncPluginEvents()).Times(1).WillOnce(Return(nlohmann::json{{"event_id", 55}}));
+        EXPECT_CALL(*this->eventProcessor, PluginEventsSynced).Times(1);
+        EXPECT_CALL(mockApi, StreamPluginEvents(55, _)).Times(1);
+
+        connection.Stream();
+        EXPECT_EQ(55, connection.LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItDoesntStreamIfSyncFails)
+    {
+        EXPECT_CALL(mockApi, SyncPluginEvents()).Times(1).WillOnce(Throw(ApiException("foo")));
+        EXPECT_CALL(mockApi, StreamPluginEvents(_, _)).Times(0);
+
+        connection.Stream();
+        EXPECT_EQ(-1, connection.LastEventId());
+        EXPECT_EQ(1, connection.ConsecutiveFailures());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItDoesntStreamIfSyncResponseInvalid)
+    {
+        EXPECT_CALL(mockApi, SyncPluginEvents()).Times(1).WillOnce(Return(nlohmann::json{{"event_id", "55"}}));
+        EXPECT_CALL(mockApi, StreamPluginEvents(_, _)).Times(0);
+
+        connection.Stream();
+        EXPECT_EQ(-1, connection.LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItQueuesStreamedEvents)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _))
+            .WillByDefault(StandInServer(StreamedEvent(56, Event("foo")) + StreamedEvent(57, Event("bar"))));
+
+        connection.Stream();
+        EXPECT_EQ(Event("foo").dump(), connection.GetNextMessage());
+        EXPECT_EQ(Event("bar").dump(), connection.GetNextMessage());
+        EXPECT_EQ("", connection.GetNextMessage());
+        EXPECT_EQ(57, connection.LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItResumesFromTheLastEventWhenReconnecting)
+    {
+        Synced(55);
+        EXPECT_CALL(mockApi, SyncPluginEvents()).Times(1);
+        EXPECT_CALL(mockApi, StreamPluginEvents(55, _))
+            .Times(1)
+            .WillOnce(StandInServer(StreamedEvent(56, Event("foo"))));
+        EXPECT_CALL(mockApi, StreamPluginEvents(56, _))
+            .Times(1)
+            .WillOnce(StandInServer(StreamedEvent(57, Event("bar"))));
+
+        connection.Stream();
+        connection.Stream();
+        EXPECT_EQ(Event("foo").dump(), connection.GetNextMessage());
+        EXPECT_EQ(Event("bar").dump(), connection.GetNextMessage());
+        EXPECT_EQ(57, connection.LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItSkipsEventsAlreadyReceived)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _))
+            .WillByDefault(StandInServer(
+                StreamedEvent(54, Event("old")) + StreamedEvent(56, Event("foo")) + StreamedEvent(56, Event("foo"))));
+
+        connection.Stream();
+        EXPECT_EQ(Event("foo").dump(), connection.GetNextMessage());
+        EXPECT_EQ("", connection.GetNextMessage());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItSkipsInvalidEvents)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _))
+            .WillByDefault(StandInServer(
+                "id: 56\ndata: notjson\n\n" + StreamedEvent(57, nlohmann::json{{"channel", "nodata"}}) +
+                "data: " + Event("noid").dump() + "\n\n" + StreamedEvent(58, Event("foo"))));
+
+        connection.Stream();
+        EXPECT_EQ(Event("foo").dump(), connection.GetNextMessage());
+        EXPECT_EQ("", connection.GetNextMessage());
+        EXPECT_EQ(58, connection.LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItCountsFailedConnections)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _)).WillByDefault(Throw(ApiException("foo")));
+
+        connection.Stream();
+        connection.Stream();
+        EXPECT_EQ(2, connection.ConsecutiveFailures());
+        EXPECT_FALSE(connection.UsingFallback());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItResetsFailedConnectionsWhenTheStreamClosesNormally)
+    {
+        Synced(55);
+        EXPECT_CALL(mockApi, StreamPluginEvents(55, _)).WillOnce(Throw(ApiException("foo"))).WillOnce(Return());
+
+        connection.Stream();
+        connection.Stream();
+        EXPECT_EQ(0, connection.ConsecutiveFailures());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItKeepsStreamingThroughRoutineRecycles)
+    {
+        Synced(55);
+        EXPECT_CALL(mockApi, StreamPluginEvents(_, _))
+            .Times(StreamingPushEventConnection::maxConnectionFailures + 1)
+            .WillRepeatedly([](int lastEventId, const std::function<bool(const std::string&)>& onData) {
+                StandInServer(StreamedEvent(lastEventId + 1, Event("foo")))(lastEventId, onData);
+            });
+
+        for (int i = 0; i < StreamingPushEventConnection::maxConnectionFailures + 1; i++) {
+            connection.Stream();
+        }
+
+        EXPECT_EQ(0, connection.ConsecutiveFailures());
+        EXPECT_FALSE(connection.UsingFallback());
+        EXPECT_EQ(55 + StreamingPushEventConnection::maxConnectionFailures + 1, connection.LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItFallsBackToPollingAfterRepeatedFailures)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _)).WillByDefault(Throw(ApiException("foo")));
+
+        for (int i = 0; i < StreamingPushEventConnection::maxConnectionFailures - 1; i++) {
+            connection.Stream();
+        }
+        EXPECT_FALSE(connection.UsingFallback());
+
+        connection.Stream();
+        EXPECT_TRUE(connection.UsingFallback());
+        EXPECT_EQ(55, connection.Fallback().LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItFallsBackToPollingIfStreamingIsNotSupported)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _)).WillByDefault(Throw(ApiNotFoundException("foo")));
+
+        connection.Stream();
+        EXPECT_TRUE(connection.UsingFallback());
+        EXPECT_EQ(55, connection.Fallback().LastEventId());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItPollsWhilstFallingBack)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _)).WillByDefault(Throw(ApiNotFoundException("foo")));
+        connection.Stream();
+
+        EXPECT_CALL(mockApi, GetLatestPluginEvents(55))
+            .Times(1)
+            .WillOnce(Return(nlohmann::json::array({{{"id", 56}, {"event", Event("foo")}}})));
+
+        connection.TimedEventTrigger();
+        EXPECT_EQ(Event("foo").dump(), connection.GetNextMessage());
+        EXPECT_EQ("", connection.GetNextMessage());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItTriesStreamingAgainFromWherePollingGotTo)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _)).WillByDefault(Throw(ApiNotFoundException("foo")));
+        connection.Stream();
+        connection.Fallback().ResumeFrom(60);
+        connection.SetFallbackTime(
+            std::chrono::system_clock::now() - StreamingPushEventConnection::retryStreamingAfter -
+            std::chrono::seconds(1));
+
+        std::promise<int> streamed;
+        auto streamedFrom = streamed.get_future();
+        EXPECT_CALL(mockApi, StreamPluginEvents(60, _))
+            .WillOnce([&streamed](int eventId, const std::function<bool(const std::string&)>&) {
+                streamed.set_value(eventId);
+            })
+            .WillRepeatedly(Return());
+
+        connection.TimedEventTrigger();
+        ASSERT_EQ(std::future_status::ready, streamedFrom.wait_for(std::chrono::seconds(5)));
+        EXPECT_EQ(60, streamedFrom.get());
+        EXPECT_FALSE(connection.UsingFallback());
+    }
+
+    TEST_F(StreamingPushEventConnectionTest, ItKeepsPollingIfNotTimeToTryStreamingAgain)
+    {
+        Synced(55);
+        ON_CALL(mockApi, StreamPluginEvents(55, _)).WillByDefault(Throw(ApiNotFoundException("foo")));
+        connection.Stream();
+
+        EXPECT_CALL(mockApi, StreamPluginEvents(_, _)).Times(0);
+        EXPECT_CALL(mockApi, GetLatestPluginEvents(55)).Times(1).WillOnce(Return(nlohmann::json::array()));
+
+        connection.TimedEventTrigger();
+        EXPECT_TRUE(connection.UsingFallback());
+    }
+} // namespace UKControllerPluginTest::Push
@@ -0,0 +1,108 @@
+#include "push/SyncSnapshotStore.h"
+
+using testing::Test;
+using UKControllerPlugin::Push::SyncSnapshotStore;
+
+namespace UKControllerPluginTest::Push {
+
+    class SyncSnapshotStoreTest : public Test
+    {
+        public:
+        SyncSnapshotStoreTest()
+            : memory(SyncSnapshotStore::RequiredSize(snapshotCount, snapshotSize) / sizeof(uint64_t) + 1),
+              store(memory.data(), snapshotCount, snapshotSize)
+        {
+            store.Initialise();
+        }
+
+        static inline const uint32_t snapshotCount = 2;
+        static inline const uint32_t snapshotSize = 64;
+        std::vector<uint64_t> memory;
+        SyncSnapshotStore store;
+    };
+
+    TEST_F(SyncSnapshotStoreTest, ItReturnsNothingForUnknownKeys)
+    {
+        EXPECT_EQ(std::nullopt, store.Get("foo"));
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ItPublishesSnapshots)
+    {
+        EXPECT_TRUE(store.Publish("foo", "[1]", 5));
+
+        const auto snapshot = store.Get("foo");
+        ASSERT_TRUE(snapshot.has_value());
+        EXPECT_EQ("[1]", snapshot->data);
+        EXPECT_EQ(5, snapshot->eventSequence);
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ItReplacesSnapshots)
+    {
+        EXPECT_TRUE(store.Publish("foo", "[1]", 5));
+        EXPECT_TRUE(store.Publish("foo", "[2]", 6));
+        EXPECT_TRUE(store.Publish("bar", "[3]", 7));
+
+        EXPECT_EQ("[2]", store.Get("foo")->data);
+        EXPECT_EQ(6, store.Get("foo")->eventSequence);
+        EXPECT_EQ("[3]", store.Get("bar")->data);
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ItDoesntPublishWhenFull)
+    {
+        EXPECT_TRUE(store.Publish("foo", "[1]", 5));
+        EXPECT_TRUE(store.Publish("bar", "[2]", 5));
+        EXPECT_FALSE(store.Publish("baz", "[3]", 5));
+        EXPECT_EQ(std::nullopt, store.Get("baz"));
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ConcurrentPublishersGetTheirOwnSlots)
+    {
+        const int publishes = 1000;
+        const auto publisher = [this, publishes](const std::string& key) {
+            for (int i = 0; i < publishes; i++) {
+                EXPECT_TRUE(store.Publish(key, std::string(snapshotSize, static_cast<char>('a' + i % 26)), i));
+            }
+        };
+
+        std::thread stands(publisher, "stands");
+        std::thread holds(publisher, "holds");
+        stands.join();
+        holds.join();
+
+        for (const auto& key : {"stands", "holds"}) {
+            const auto snapshot = store.Get(key);
+            ASSERT_TRUE(snapshot.has_value());
+            EXPECT_EQ(std::string(snapshotSize, static_cast<char>('a' + (publishes - 1) % 26)), snapshot->data);
+            EXPECT_EQ(publishes - 1, snapshot->eventSequence);
+        }
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ItDoesntPublishSnapshotsThatAreTooBig)
+    {
+        EXPECT_FALSE(store.Publish("foo", std::string(snapshotSize + 1, 'a'), 5));
+        EXPECT_EQ(std::nullopt, store.Get("foo"));
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ItDoesntPublishInvalidKeys)
+    {
+        EXPECT_FALSE(store.Publish("", "[1]", 5));
+        EXPECT_FALSE(store.Publish(std::string(SyncSnapshotStore::maxKeyLength + 1, 'a'), "[1]", 5));
+    }
+
+    TEST_F(SyncSnapshotStoreTest, ItCountsRefreshRequests)
+    {
+        EXPECT_EQ(0, store.RefreshRequests());
+        store.RequestRefresh();
+        store.RequestRefresh();
+        EXPECT_EQ(2, store.RefreshRequests());
+    }
+
+    TEST_F(SyncSnapshotStoreTest, InitialisingAgainKeepsSnapshots)
+    {
+        EXPECT_TRUE(store.Publish("foo", "[1]", 5));
+
+        SyncSnapshotStore newStore(memory.data(), snapshotCount, snapshotSize);
+        newStore.Initialise();
+        EXPECT_EQ("[1]", newStore.Get("foo")->data);
+    }
+} // namespace UKControllerPluginTest::Push
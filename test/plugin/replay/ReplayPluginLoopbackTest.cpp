@@ -0,0 +1,128 @@
+#include "replay/ReplayFlightplan.h"
+#include "replay/ReplayPluginLoopback.h"
+#include "replay/ReplayRadarTarget.h"
+
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPluginTest::Replay::RecordedFlightplan;
+using UKControllerPluginTest::Replay::RecordedTarget;
+using UKControllerPluginTest::Replay::ReplayFlightplan;
+using UKControllerPluginTest::Replay::ReplayPluginLoopback;
+using UKControllerPluginTest::Replay::ReplayRadarTarget;
+
+namespace UKControllerPluginTest::Replay {
+    class ReplayPluginLoopbackTest : public testing::Test
+    {
+        public:
+        void AddAircraft(const std::string& callsign)
+        {
+            RecordedTarget target{callsign, 51.5, -0.5, 5000, 250, 0, 90.0, "1234", false, false};
+            loopback.AddAircraft(
+                std::make_shared<ReplayFlightplan>(RecordedFlightplan{callsign, "EGLL", "EGPH"}, target),
+                std::make_shared<ReplayRadarTarget>(target));
+        }
+
+        ReplayPluginLoopback loopback;
+    };
+
+    TEST_F(ReplayPluginLoopbackTest, ItReturnsFlightplansAndRadarTargetsByCallsign)
+    {
+        AddAircraft("BAW123");
+        EXPECT_EQ("BAW123", loopback.GetFlightplanForCallsign("BAW123")->GetCallsign());
+        EXPECT_EQ("EGPH", loopback.GetFlightplanForCallsign("BAW123")->GetDestination());
+        EXPECT_EQ(5000, loopback.GetRadarTargetForCallsign("BAW123")->GetAltitude());
+        EXPECT_EQ(nullptr, loopback.GetFlightplanForCallsign("EZY456"));
+        EXPECT_EQ(nullptr, loopback.GetRadarTargetForCallsign("EZY456"));
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItRemovesAircraft)
+    {
+        AddAircraft("BAW123");
+        AddAircraft("EZY456");
+        loopback.RemoveAircraft("BAW123");
+        EXPECT_EQ(1, loopback.CountAircraft());
+        EXPECT_EQ(nullptr, loopback.GetFlightplanForCallsign("BAW123"));
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItAppliesFunctionsToAllFlightplansByReference)
+    {
+        AddAircraft("EZY456");
+        AddAircraft("BAW123");
+        std::vector<std::string> callsigns;
+        loopback.ApplyFunctionToAllFlightplans(
+            [&callsigns](EuroScopeCFlightPlanInterface& flightplan, EuroScopeCRadarTargetInterface& radarTarget) {
+                EXPECT_EQ(flightplan.GetCallsign(), radarTarget.GetCallsign());
+                callsigns.push_back(flightplan.GetCallsign());
+            });
+
+        EXPECT_EQ(std::vector<std::string>({"BAW123", "EZY456"}), callsigns);
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItAppliesFunctionsToAllFlightplansByConstReference)
+    {
+        AddAircraft("EZY456");
+        AddAircraft("BAW123");
+        std::vector<std::string> callsigns;
+        const auto& constLoopback = loopback;
+        constLoopback.ApplyFunctionToAllFlightplans(
+            [&callsigns](const EuroScopeCFlightPlanInterface& flightplan, const EuroScopeCRadarTargetInterface&) {
+                callsigns.push_back(flightplan.GetCallsign());
+            });
+
+        EXPECT_EQ(std::vector<std::string>({"BAW123", "EZY456"}), callsigns);
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItAppliesFunctionsToAllFlightplansBySharedPointer)
+    {
+        AddAircraft("EZY456");
+        AddAircraft("BAW123");
+        std::vector<std::string> callsigns;
+        loopback.ApplyFunctionToAllFlightplans(
+            [&callsigns](
+                std::shared_ptr<EuroScopeCFlightPlanInterface> flightplan,
+                std::shared_ptr<EuroScopeCRadarTargetInterface> radarTarget) {
+                callsigns.push_back(flightplan->GetCallsign());
+            });
+
+        EXPECT_EQ(std::vector<std::string>({"BAW123", "EZY456"}), callsigns);
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItTracksTheSelectedFlightplan)
+    {
+        AddAircraft("BAW123");
+        EXPECT_EQ(nullptr, loopback.GetSelectedFlightplan());
+        loopback.SetEuroscopeSelectedFlightplan(*loopback.GetFlightplanForCallsign("BAW123"));
+        EXPECT_EQ("BAW123", loopback.GetSelectedFlightplan()->GetCallsign());
+        EXPECT_EQ("BAW123", loopback.GetSelectedRadarTarget()->GetCallsign());
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItRecordsRegisteredTagItems)
+    {
+        loopback.RegisterTagItem(128, "Selcal");
+        EXPECT_EQ("Selcal", loopback.RegisteredTagItems().at(128));
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItCalculatesDistanceFromTheVisibilityCentre)
+    {
+        loopback.SetVisibilityCentre(51.0, -1.0);
+        EuroScopePlugIn::CPosition position;
+        position.m_Latitude = 52.0;
+        position.m_Longitude = -1.0;
+        EXPECT_NEAR(60.0, loopback.GetDistanceFromUserVisibilityCentre(position), 0.1);
+    }
+
+    TEST_F(ReplayPluginLoopbackTest, ItRemembersValuesSetOnTheFlightplan)
+    {
+        AddAircraft("BAW123");
+        auto flightplan = loopback.GetFlightplanForCallsign("BAW123");
+        EXPECT_FALSE(flightplan->HasControllerClearedAltitude());
+        flightplan->SetClearedAltitude(6000);
+        flightplan->SetSquawk("4721");
+        flightplan->AnnotateFlightStrip(3, "abc");
+
+        EXPECT_EQ(6000, flightplan->GetClearedAltitude());
+        EXPECT_TRUE(flightplan->HasControllerClearedAltitude());
+        EXPECT_EQ("4721", flightplan->GetAssignedSquawk());
+        EXPECT_EQ("abc", flightplan->GetAnnotation(3));
+    }
+} // namespace UKControllerPluginTest::Replay
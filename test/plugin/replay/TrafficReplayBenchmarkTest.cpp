@@ -0,0 +1,76 @@
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanEventHandler.h"
+#include "historytrail/HistoryTrailEventHandler.h"
+#include "historytrail/HistoryTrailRepository.h"
+#include "replay/ReplayPluginLoopback.h"
+#include "replay/TrafficReplayer.h"
+#include "replay/TrafficSceneGenerator.h"
+#include "selcal/SelcalParser.h"
+#include "selcal/SelcalTagItem.h"
+#include "timedevent/TimedEventCollection.h"
+
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+using UKControllerPlugin::HistoryTrail::HistoryTrailEventHandler;
+using UKControllerPlugin::HistoryTrail::HistoryTrailRepository;
+using UKControllerPlugin::Selcal::SelcalParser;
+using UKControllerPlugin::Selcal::SelcalTagItem;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPluginTest::Replay::GenerateTrafficScene;
+using UKControllerPluginTest::Replay::ReplayPluginLoopback;
+using UKControllerPluginTest::Replay::TrafficReplayer;
+using UKControllerPluginTest::Replay::TrafficSceneGeneratorOptions;
+
+namespace UKControllerPluginTest::Replay {
+
+    /*
+     * Replays generated scenes of increasing size through real plugin modules and reports how much
+     * time each module costs per simulated second of traffic.
+     */
+    class TrafficReplayBenchmarkTest : public testing::Test
+    {
+        public:
+        void Replay(int aircraft)
+        {
+            TrafficSceneGeneratorOptions options;
+            options.aircraft = aircraft;
+            options.durationSeconds = 300;
+
+            ReplayPluginLoopback loopback;
+            TrafficReplayer replayer(GenerateTrafficScene(options), loopback);
+
+            HistoryTrailRepository historyTrails;
+            auto historyTrailHandler = std::make_shared<HistoryTrailEventHandler>(historyTrails);
+            replayer.AddModule({"History trails", {historyTrailHandler}, {historyTrailHandler}});
+
+            StoredFlightplanCollection storedFlightplans;
+            auto storedFlightplanHandler = std::make_shared<StoredFlightplanEventHandler>(storedFlightplans);
+            auto storedFlightplanTimedEvents = std::make_shared<TimedEventCollection>();
+            storedFlightplanTimedEvents->RegisterEvent(storedFlightplanHandler, 60);
+            replayer.AddModule(
+                {"Stored flightplans", {storedFlightplanHandler}, {}, {}, storedFlightplanTimedEvents});
+
+            replayer.AddModule(
+                {"Selcal", {}, {}, {{128, std::make_shared<SelcalTagItem>(std::make_shared<SelcalParser>())}}});
+
+            std::cout << "[ REPLAY   ] " << aircraft << " aircraft" << std::endl;
+            replayer.Run();
+            replayer.Report(std::cout);
+        }
+    };
+
+    TEST_F(TrafficReplayBenchmarkTest, DISABLED_BenchmarkReplay500Aircraft)
+    {
+        Replay(500);
+    }
+
+    TEST_F(TrafficReplayBenchmarkTest, DISABLED_BenchmarkReplay1000Aircraft)
+    {
+        Replay(1000);
+    }
+
+    TEST_F(TrafficReplayBenchmarkTest, DISABLED_BenchmarkReplay2000Aircraft)
+    {
+        Replay(2000);
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,207 @@
+#include "replay/ReplayPluginLoopback.h"
+#include "replay/TrafficReplayer.h"
+#include "tag/TagData.h"
+#include "tag/TagItemInterface.h"
+#include "timedevent/TimedEventCollection.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Truly;
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Tag::TagData;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPluginTest::EventHandler::MockAbstractTimedEvent;
+using UKControllerPluginTest::EventHandler::MockRadarTargetEventHandlerInterface;
+using UKControllerPluginTest::Flightplan::MockFlightPlanEventHandlerInterface;
+using UKControllerPluginTest::Replay::RecordedTarget;
+using UKControllerPluginTest::Replay::ReplayModule;
+using UKControllerPluginTest::Replay::ReplayPluginLoopback;
+using UKControllerPluginTest::Replay::TrafficFrame;
+using UKControllerPluginTest::Replay::TrafficReplayer;
+using UKControllerPluginTest::Replay::TrafficScene;
+
+namespace UKControllerPluginTest::Replay {
+
+    class CallsignTagItem : public UKControllerPlugin::Tag::TagItemInterface
+    {
+        public:
+        [[nodiscard]] auto GetTagItemDescription(int tagItemId) const -> std::string override
+        {
+            return "Callsign";
+        }
+
+        void SetTagItemData(TagData& tagData) override
+        {
+            queried.push_back(tagData.GetFlightplan().GetCallsign());
+            tagData.SetItemString(tagData.GetFlightplan().GetCallsign());
+        }
+
+        std::vector<std::string> queried;
+    };
+
+    class TrafficReplayerTest : public testing::Test
+    {
+        public:
+        TrafficReplayerTest()
+            : flightplanHandler(std::make_shared<NiceMock<MockFlightPlanEventHandlerInterface>>()),
+              radarTargetHandler(std::make_shared<NiceMock<MockRadarTargetEventHandlerInterface>>()),
+              timedEvent(std::make_shared<NiceMock<MockAbstractTimedEvent>>()),
+              timedEvents(std::make_shared<TimedEventCollection>()), tagItem(std::make_shared<CallsignTagItem>())
+        {
+            timedEvents->RegisterEvent(timedEvent, 1);
+        }
+
+        [[nodiscard]] static auto Target(const std::string& callsign, std::string squawk = "1234", bool tracked = false)
+            -> RecordedTarget
+        {
+            return {callsign, 51.5, -0.5, 5000, 250, 0, 90.0, std::move(squawk), tracked, false};
+        }
+
+        [[nodiscard]] auto MakeReplayer(std::vector<TrafficFrame> frames) -> std::unique_ptr<TrafficReplayer>
+        {
+            TrafficScene scene{{{"BAW123", "EGLL", "EGPH"}, {"EZY456", "EGKK", "EGPF"}}, std::move(frames)};
+            auto replayer = std::make_unique<TrafficReplayer>(std::move(scene), loopback);
+            replayer->AddModule({"test", {flightplanHandler}, {radarTargetHandler}, {{1, tagItem}}, timedEvents});
+            return replayer;
+        }
+
+        [[nodiscard]] static auto HasCallsign(const std::string& callsign)
+        {
+            return Truly([callsign](const auto& aircraft) { return aircraft.GetCallsign() == callsign; });
+        }
+
+        ReplayPluginLoopback loopback;
+        std::shared_ptr<NiceMock<MockFlightPlanEventHandlerInterface>> flightplanHandler;
+        std::shared_ptr<NiceMock<MockRadarTargetEventHandlerInterface>> radarTargetHandler;
+        std::shared_ptr<NiceMock<MockAbstractTimedEvent>> timedEvent;
+        std::shared_ptr<TimedEventCollection> timedEvents;
+        std::shared_ptr<CallsignTagItem> tagItem;
+    };
+
+    TEST_F(TrafficReplayerTest, ItReturnsFalseWhenThereAreNoFramesLeft)
+    {
+        auto replayer = MakeReplayer({{0, {}}});
+        EXPECT_TRUE(replayer->Step());
+        EXPECT_FALSE(replayer->Step());
+    }
+
+    TEST_F(TrafficReplayerTest, ItFiresFlightplanEventsWhenAircraftAppear)
+    {
+        auto replayer = MakeReplayer({{0, {Target("BAW123")}}, {5, {Target("BAW123"), Target("EZY456")}}});
+
+        EXPECT_CALL(*flightplanHandler, FlightPlanEvent(HasCallsign("BAW123"), HasCallsign("BAW123"))).Times(1);
+        EXPECT_CALL(*flightplanHandler, FlightPlanEvent(HasCallsign("EZY456"), HasCallsign("EZY456"))).Times(1);
+        replayer->Run();
+
+        EXPECT_EQ(2, loopback.CountAircraft());
+        EXPECT_EQ("EGPF", loopback.GetFlightplanForCallsign("EZY456")->GetDestination());
+    }
+
+    TEST_F(TrafficReplayerTest, ItCreatesFlightplansForTargetsWithoutARecordedFlightplan)
+    {
+        auto replayer = MakeReplayer({{0, {Target("VIR1")}}});
+        replayer->Run();
+        EXPECT_EQ("VIR1", loopback.GetFlightplanForCallsign("VIR1")->GetCallsign());
+        EXPECT_EQ("", loopback.GetFlightplanForCallsign("VIR1")->GetDestination());
+    }
+
+    TEST_F(TrafficReplayerTest, ItFiresRadarTargetEventsForEveryAircraftEveryFrame)
+    {
+        auto replayer = MakeReplayer(
+            {{0, {Target("BAW123"), Target("EZY456")}},
+             {5, {Target("BAW123"), Target("EZY456")}},
+             {10, {Target("BAW123")}}});
+
+        EXPECT_CALL(*radarTargetHandler, RadarTargetPositionUpdateEvent(HasCallsign("BAW123"))).Times(3);
+        EXPECT_CALL(*radarTargetHandler, RadarTargetPositionUpdateEvent(HasCallsign("EZY456"))).Times(2);
+        replayer->Run();
+    }
+
+    TEST_F(TrafficReplayerTest, ItFiresDisconnectEventsWhenAircraftDisappear)
+    {
+        auto replayer = MakeReplayer({{0, {Target("BAW123"), Target("EZY456")}}, {5, {Target("EZY456")}}});
+
+        EXPECT_CALL(*flightplanHandler, FlightPlanDisconnectEvent(HasCallsign("BAW123"))).Times(1);
+        EXPECT_CALL(*flightplanHandler, FlightPlanDisconnectEvent(HasCallsign("EZY456"))).Times(0);
+        replayer->Run();
+
+        EXPECT_EQ(1, loopback.CountAircraft());
+        EXPECT_EQ(nullptr, loopback.GetFlightplanForCallsign("BAW123"));
+    }
+
+    TEST_F(TrafficReplayerTest, ItFiresControllerDataEventsWhenTheSquawkChanges)
+    {
+        auto replayer = MakeReplayer({{0, {Target("BAW123", "1234")}}, {5, {Target("BAW123", "4721")}}});
+
+        EXPECT_CALL(
+            *flightplanHandler,
+            ControllerFlightPlanDataEvent(HasCallsign("BAW123"), EuroScopePlugIn::CTR_DATA_TYPE_SQUAWK))
+            .Times(1);
+        replayer->Run();
+
+        EXPECT_EQ("4721", loopback.GetFlightplanForCallsign("BAW123")->GetAssignedSquawk());
+    }
+
+    TEST_F(TrafficReplayerTest, ItFiresFlightplanEventsWhenTrackingChanges)
+    {
+        auto replayer = MakeReplayer(
+            {{0, {Target("BAW123", "1234", false)}},
+             {5, {Target("BAW123", "1234", true)}},
+             {10, {Target("BAW123", "1234", true)}}});
+
+        EXPECT_CALL(*flightplanHandler, FlightPlanEvent(HasCallsign("BAW123"), _)).Times(2);
+        replayer->Run();
+
+        EXPECT_TRUE(loopback.GetFlightplanForCallsign("BAW123")->IsTracked());
+    }
+
+    TEST_F(TrafficReplayerTest, ItTicksTimedEventsOncePerSimulatedSecond)
+    {
+        auto replayer = MakeReplayer({{0, {}}, {5, {}}, {7.5, {}}});
+
+        EXPECT_CALL(*timedEvent, TimedEventTrigger()).Times(8);
+        replayer->Run();
+    }
+
+    TEST_F(TrafficReplayerTest, ItQueriesTagItemsForEveryAircraftEveryFrame)
+    {
+        auto replayer = MakeReplayer({{0, {Target("BAW123"), Target("EZY456")}}, {5, {Target("EZY456")}}});
+        replayer->Run();
+
+        EXPECT_EQ(std::vector<std::string>({"BAW123", "EZY456", "EZY456"}), tagItem->queried);
+    }
+
+    TEST_F(TrafficReplayerTest, ItRecordsTimingsForEachModule)
+    {
+        auto replayer = MakeReplayer({{0, {Target("BAW123")}}, {5, {Target("BAW123")}}});
+        replayer->AddModule({"other"});
+        replayer->Run();
+
+        ASSERT_EQ(2, replayer->Timings().size());
+        EXPECT_EQ("test", replayer->Timings()[0].name);
+        EXPECT_EQ("other", replayer->Timings()[1].name);
+        EXPECT_GT(replayer->Timings()[0].Total(), std::chrono::nanoseconds::zero());
+        EXPECT_DOUBLE_EQ(5.0, replayer->SimulatedSeconds());
+    }
+
+    TEST_F(TrafficReplayerTest, ItReportsTimePerSimulatedSecond)
+    {
+        auto replayer = MakeReplayer({{0, {Target("BAW123")}}, {5, {Target("BAW123")}}});
+        replayer->Run();
+
+        std::stringstream report;
+        replayer->Report(report);
+        EXPECT_NE(std::string::npos, report.str().find("test: "));
+        EXPECT_NE(std::string::npos, report.str().find("ms per simulated second"));
+    }
+
+    TEST_F(TrafficReplayerTest, ItReplaysAtTheRequestedSpeed)
+    {
+        auto replayer = MakeReplayer({{0, {}}, {1, {}}, {2, {}}});
+
+        const auto start = std::chrono::steady_clock::now();
+        replayer->Run(20.0);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    }
+} // namespace UKControllerPluginTest::Replay
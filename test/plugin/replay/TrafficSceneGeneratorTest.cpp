@@ -0,0 +1,96 @@
+#include "replay/TrafficScene.h"
+#include "replay/TrafficSceneGenerator.h"
+
+using UKControllerPluginTest::Replay::GenerateTrafficScene;
+using UKControllerPluginTest::Replay::TrafficSceneGeneratorOptions;
+using UKControllerPluginTest::Replay::TrafficSceneToJson;
+
+namespace UKControllerPluginTest::Replay {
+    class TrafficSceneGeneratorTest : public testing::Test
+    {
+        public:
+        TrafficSceneGeneratorTest()
+        {
+            options.aircraft = 500;
+            options.durationSeconds = 120;
+            options.frameIntervalSeconds = 5;
+        }
+
+        TrafficSceneGeneratorOptions options;
+    };
+
+    TEST_F(TrafficSceneGeneratorTest, ItGeneratesAFlightplanForEachAircraft)
+    {
+        const auto scene = GenerateTrafficScene(options);
+        EXPECT_EQ(500, scene.flightplans.size());
+
+        std::set<std::string> callsigns;
+        for (const auto& flightplan : scene.flightplans) {
+            callsigns.insert(flightplan.callsign);
+            EXPECT_NE(flightplan.origin, flightplan.destination);
+            EXPECT_GE(flightplan.routePoints.size(), 2);
+            EXPECT_EQ(flightplan.origin, flightplan.routePoints.front().name);
+            EXPECT_EQ(flightplan.destination, flightplan.routePoints.back().name);
+        }
+
+        EXPECT_EQ(500, callsigns.size());
+    }
+
+    TEST_F(TrafficSceneGeneratorTest, ItGeneratesFramesAtTheFrameInterval)
+    {
+        const auto scene = GenerateTrafficScene(options);
+        ASSERT_EQ(25, scene.frames.size());
+        for (size_t i = 0; i < scene.frames.size(); i++) {
+            EXPECT_DOUBLE_EQ(i * 5.0, scene.frames[i].time);
+        }
+    }
+
+    TEST_F(TrafficSceneGeneratorTest, ItOnlyGeneratesTargetsThatHaveFlightplans)
+    {
+        const auto scene = GenerateTrafficScene(options);
+        std::set<std::string> callsigns;
+        for (const auto& flightplan : scene.flightplans) {
+            callsigns.insert(flightplan.callsign);
+        }
+
+        for (const auto& frame : scene.frames) {
+            for (const auto& target : frame.targets) {
+                EXPECT_TRUE(callsigns.contains(target.callsign));
+                EXPECT_FALSE(target.trackedByUser && !target.tracked);
+            }
+        }
+    }
+
+    TEST_F(TrafficSceneGeneratorTest, ItHasAircraftJoiningPartWayThrough)
+    {
+        const auto scene = GenerateTrafficScene(options);
+        EXPECT_GT(scene.frames.back().targets.size(), 0);
+        EXPECT_LT(scene.frames.front().targets.size(), 500);
+    }
+
+    TEST_F(TrafficSceneGeneratorTest, ItMovesAircraftBetweenFrames)
+    {
+        const auto scene = GenerateTrafficScene(options);
+        const auto& first = scene.frames[0].targets[0];
+        for (const auto& target : scene.frames[1].targets) {
+            if (target.callsign == first.callsign) {
+                EXPECT_TRUE(target.latitude != first.latitude || target.longitude != first.longitude);
+                return;
+            }
+        }
+
+        FAIL() << "Aircraft not found in second frame";
+    }
+
+    TEST_F(TrafficSceneGeneratorTest, ItGeneratesTheSameSceneForTheSameSeed)
+    {
+        EXPECT_EQ(TrafficSceneToJson(GenerateTrafficScene(options)), TrafficSceneToJson(GenerateTrafficScene(options)));
+    }
+
+    TEST_F(TrafficSceneGeneratorTest, ItGeneratesADifferentSceneForADifferentSeed)
+    {
+        const auto first = TrafficSceneToJson(GenerateTrafficScene(options));
+        options.seed = 2;
+        EXPECT_NE(first, TrafficSceneToJson(GenerateTrafficScene(options)));
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,135 @@
+#include "replay/TrafficScene.h"
+
+using UKControllerPluginTest::Replay::DistanceInNauticalMiles;
+using UKControllerPluginTest::Replay::LoadTrafficScene;
+using UKControllerPluginTest::Replay::TrafficScene;
+using UKControllerPluginTest::Replay::TrafficSceneFromJson;
+using UKControllerPluginTest::Replay::TrafficSceneToJson;
+
+namespace UKControllerPluginTest::Replay {
+    class TrafficSceneTest : public testing::Test
+    {
+        public:
+        [[nodiscard]] static auto SceneJson() -> nlohmann::json
+        {
+            return {
+                {"flightplans",
+                 nlohmann::json::array(
+                     {{{"callsign", "BAW123"},
+                       {"origin", "EGLL"},
+                       {"destination", "EGPH"},
+                       {"route", "BPK TNT"},
+                       {"aircraft_type", "A320"},
+                       {"wake_category", "M"},
+                       {"flight_rules", "I"},
+                       {"remarks", "SEL/ABCD"},
+                       {"cruise_level", 35000},
+                       {"route_points",
+                        nlohmann::json::array(
+                            {{{"name", "EGLL"}, {"latitude", 51.47}, {"longitude", -0.46}},
+                             {{"name", "BPK"}, {"latitude", 51.75}, {"longitude", -0.11}}})}}})},
+                {"frames",
+                 nlohmann::json::array(
+                     {{{"time", 5.0},
+                       {"targets",
+                        nlohmann::json::array(
+                            {{{"callsign", "BAW123"},
+                              {"latitude", 51.6},
+                              {"longitude", -0.3},
+                              {"altitude", 6000},
+                              {"ground_speed", 250},
+                              {"vertical_speed", 1500},
+                              {"heading", 45.0},
+                              {"squawk", "4721"},
+                              {"tracked", true},
+                              {"tracked_by_user", false}}})}},
+                      {{"time", 0.0}, {"targets", nlohmann::json::array()}}})}};
+        }
+    };
+
+    TEST_F(TrafficSceneTest, ItLoadsFlightplansFromJson)
+    {
+        const auto scene = TrafficSceneFromJson(SceneJson());
+        ASSERT_EQ(1, scene.flightplans.size());
+        const auto& flightplan = scene.flightplans[0];
+        EXPECT_EQ("BAW123", flightplan.callsign);
+        EXPECT_EQ("EGLL", flightplan.origin);
+        EXPECT_EQ("EGPH", flightplan.destination);
+        EXPECT_EQ("BPK TNT", flightplan.route);
+        EXPECT_EQ("A320", flightplan.aircraftType);
+        EXPECT_EQ("M", flightplan.wakeCategory);
+        EXPECT_EQ("I", flightplan.flightRules);
+        EXPECT_EQ("SEL/ABCD", flightplan.remarks);
+        EXPECT_EQ(35000, flightplan.cruiseLevel);
+        ASSERT_EQ(2, flightplan.routePoints.size());
+        EXPECT_EQ("BPK", flightplan.routePoints[1].name);
+        EXPECT_DOUBLE_EQ(51.75, flightplan.routePoints[1].latitude);
+        EXPECT_DOUBLE_EQ(-0.11, flightplan.routePoints[1].longitude);
+    }
+
+    TEST_F(TrafficSceneTest, ItLoadsFramesFromJsonInTimeOrder)
+    {
+        const auto scene = TrafficSceneFromJson(SceneJson());
+        ASSERT_EQ(2, scene.frames.size());
+        EXPECT_DOUBLE_EQ(0.0, scene.frames[0].time);
+        EXPECT_TRUE(scene.frames[0].targets.empty());
+        EXPECT_DOUBLE_EQ(5.0, scene.frames[1].time);
+
+        ASSERT_EQ(1, scene.frames[1].targets.size());
+        const auto& target = scene.frames[1].targets[0];
+        EXPECT_EQ("BAW123", target.callsign);
+        EXPECT_DOUBLE_EQ(51.6, target.latitude);
+        EXPECT_DOUBLE_EQ(-0.3, target.longitude);
+        EXPECT_EQ(6000, target.altitude);
+        EXPECT_EQ(250, target.groundSpeed);
+        EXPECT_EQ(1500, target.verticalSpeed);
+        EXPECT_DOUBLE_EQ(45.0, target.heading);
+        EXPECT_EQ("4721", target.squawk);
+        EXPECT_TRUE(target.tracked);
+        EXPECT_FALSE(target.trackedByUser);
+    }
+
+    TEST_F(TrafficSceneTest, ItDefaultsOptionalFields)
+    {
+        const auto scene = TrafficSceneFromJson(
+            {{"flightplans", nlohmann::json::array({{{"callsign", "BAW123"}}})},
+             {"frames",
+              nlohmann::json::array(
+                  {{{"time", 0},
+                    {"targets",
+                     nlohmann::json::array({{{"callsign", "BAW123"}, {"latitude", 1.0}, {"longitude", 2.0}}})}}})}});
+
+        EXPECT_EQ("I", scene.flightplans[0].flightRules);
+        EXPECT_TRUE(scene.flightplans[0].routePoints.empty());
+        EXPECT_EQ("2000", scene.frames[0].targets[0].squawk);
+        EXPECT_FALSE(scene.frames[0].targets[0].tracked);
+    }
+
+    TEST_F(TrafficSceneTest, ItThrowsIfTheSceneIsMalformed)
+    {
+        EXPECT_ANY_THROW(static_cast<void>(TrafficSceneFromJson({{"flightplans", nlohmann::json::array()}})));
+        EXPECT_ANY_THROW(static_cast<void>(TrafficSceneFromJson(
+            {{"flightplans", nlohmann::json::array()},
+             {"frames", nlohmann::json::array({{{"time", 0}, {"targets", nlohmann::json::array({{}})}}})}})));
+    }
+
+    TEST_F(TrafficSceneTest, ItThrowsIfTheSceneFileCannotBeOpened)
+    {
+        EXPECT_THROW(static_cast<void>(LoadTrafficScene("not/a/real/scene.json")), std::invalid_argument);
+    }
+
+    TEST_F(TrafficSceneTest, ItRoundTripsThroughJson)
+    {
+        const auto json = TrafficSceneToJson(TrafficSceneFromJson(SceneJson()));
+        const auto scene = TrafficSceneFromJson(json);
+        EXPECT_EQ(TrafficSceneToJson(TrafficSceneFromJson(SceneJson())), TrafficSceneToJson(scene));
+        EXPECT_EQ(2, scene.frames.size());
+        EXPECT_EQ(1, scene.flightplans.size());
+    }
+
+    TEST_F(TrafficSceneTest, ItCalculatesDistancesInNauticalMiles)
+    {
+        EXPECT_NEAR(60.0, DistanceInNauticalMiles(51.0, -1.0, 52.0, -1.0), 0.1);
+        EXPECT_DOUBLE_EQ(0.0, DistanceInNauticalMiles(51.0, -1.0, 51.0, -1.0));
+    }
+} // namespace UKControllerPluginTest::Replay
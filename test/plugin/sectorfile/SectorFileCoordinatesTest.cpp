@@ -1,9 +1,14 @@
+#include "helper/Benchmark.h"
 #include "sectorfile/SectorFileCoordinates.h"
 
 using testing::Test;
+using UKControllerPlugin::SectorFile::CoordinateStrings;
 using UKControllerPlugin::SectorFile::GetInvalidPosition;
 using UKControllerPlugin::SectorFile::ParseSectorFileCoordinates;
+using UKControllerPlugin::SectorFile::ParseSectorFileLatitude;
+using UKControllerPlugin::SectorFile::ParseSectorFileLongitude;
 using UKControllerPlugin::SectorFile::PositionIsInvalid;
+using UKControllerPluginTest::RunBenchmark;
 
 namespace UKControllerPluginTest {
     namespace SectorFile {
@@ -130,5 +135,154 @@ namespace UKControllerPluginTest {
         {
             EXPECT_FALSE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000", "W001.15.59.888")));
         }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesLatitudes)
+        {
+            EXPECT_NEAR(51.47583, *ParseSectorFileLatitude("N051.28.33.000"), 0.00001);
+            EXPECT_NEAR(-51.47583, *ParseSectorFileLatitude("S051.28.33.000"), 0.00001);
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesLongitudes)
+        {
+            EXPECT_NEAR(0.46139, *ParseSectorFileLongitude("E000.27.41.000"), 0.00001);
+            EXPECT_NEAR(-0.46139, *ParseSectorFileLongitude("W000.27.41.000"), 0.00001);
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesThousandthsOfASecond)
+        {
+            EXPECT_NEAR(51.0 + (59.999 / 3600.0), *ParseSectorFileLatitude("N051.00.59.999"), 0.0000001);
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesTheEquatorAndPrimeMeridian)
+        {
+            EXPECT_EQ(0.0, *ParseSectorFileLatitude("N000.00.00.000"));
+            EXPECT_EQ(0.0, *ParseSectorFileLatitude("S000.00.00.000"));
+            EXPECT_EQ(0.0, *ParseSectorFileLongitude("W000.00.00.000"));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesThePolesAndAntimeridian)
+        {
+            EXPECT_EQ(90.0, *ParseSectorFileLatitude("N090.00.00.000"));
+            EXPECT_EQ(-90.0, *ParseSectorFileLatitude("S090.00.00.000"));
+            EXPECT_EQ(180.0, *ParseSectorFileLongitude("E180.00.00.000"));
+            EXPECT_EQ(-180.0, *ParseSectorFileLongitude("W180.00.00.000"));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItDoesntParsePastThePolesOrAntimeridian)
+        {
+            EXPECT_EQ(std::nullopt, ParseSectorFileLatitude("N090.00.00.001"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLongitude("W180.00.00.001"));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItDoesntRollSecondsOverIntoMinutes)
+        {
+            EXPECT_TRUE(ParseSectorFileLatitude("N051.28.59.999").has_value());
+            EXPECT_EQ(std::nullopt, ParseSectorFileLatitude("N051.28.60.000"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLongitude("E001.59.60.000"));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItDoesntRollMinutesOverIntoDegrees)
+        {
+            EXPECT_EQ(std::nullopt, ParseSectorFileLatitude("N051.60.00.000"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLongitude("E001.99.00.000"));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItOnlyAcceptsTheRightHemispheres)
+        {
+            EXPECT_EQ(std::nullopt, ParseSectorFileLatitude("E051.28.33.000"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLatitude("n051.28.33.000"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLatitude(",051.28.33.000"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLongitude("N000.27.41.000"));
+            EXPECT_EQ(std::nullopt, ParseSectorFileLongitude("w000.27.41.000"));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItDoesntParseMalformedCoordinates)
+        {
+            for (const auto* coordinate :
+                 {"",
+                  "N",
+                  "N051.28.33.00",
+                  "N051.28.33.0000",
+                  " N051.28.33.000",
+                  "N051.28.33.000 ",
+                  "N51.28.33.0000",
+                  "N051,28.33.000",
+                  "N051.28:33.000",
+                  "N051.28.33,000",
+                  "N05A.28.33.000",
+                  "N051.2 .33.000",
+                  "N051.28.3-.000",
+                  "N051.28.33.00/",
+                  "N-51.28.33.000"}) {
+                EXPECT_EQ(std::nullopt, ParseSectorFileLatitude(coordinate)) << "Coordinate: " << coordinate;
+            }
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesCoordinatesInBulk)
+        {
+            const std::vector<CoordinateStrings> coordinates{
+                {"N051.28.33.000", "W000.27.41.000"},
+                {"N051.28.33.000", "N000.27.41.000"},
+                {"S033.56.46.000", "E151.10.38.000"}};
+
+            const auto positions = ParseSectorFileCoordinates(coordinates);
+            ASSERT_EQ(3, positions.size());
+            EXPECT_NEAR(51.47583, positions[0].m_Latitude, 0.00001);
+            EXPECT_NEAR(-0.46139, positions[0].m_Longitude, 0.00001);
+            EXPECT_TRUE(PositionIsInvalid(positions[1]));
+            EXPECT_NEAR(-33.94611, positions[2].m_Latitude, 0.00001);
+            EXPECT_NEAR(151.17722, positions[2].m_Longitude, 0.00001);
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesNoCoordinatesInBulk)
+        {
+            EXPECT_TRUE(ParseSectorFileCoordinates(std::span<const CoordinateStrings>()).empty());
+        }
+
+        TEST_F(SectorFileCoordinatesTest, DISABLED_BenchmarkParse100000Coordinates)
+        {
+            std::mt19937 random(42); // NOLINT
+            std::uniform_int_distribution<int> degrees(0, 89);
+            std::uniform_int_distribution<int> sixty(0, 59);
+            std::uniform_int_distribution<int> thousandths(0, 999);
+            std::vector<std::string> latitudes;
+            std::vector<std::string> longitudes;
+            const int count = 100000;
+            char buffer[16]; // NOLINT
+            for (int i = 0; i < count; i++) {
+                snprintf( // NOLINT
+                    buffer,
+                    sizeof(buffer),
+                    "N%03d.%02d.%02d.%03d",
+                    degrees(random),
+                    sixty(random),
+                    sixty(random),
+                    thousandths(random));
+                latitudes.emplace_back(buffer);
+                snprintf( // NOLINT
+                    buffer,
+                    sizeof(buffer),
+                    "W%03d.%02d.%02d.%03d",
+                    degrees(random),
+                    sixty(random),
+                    sixty(random),
+                    thousandths(random));
+                longitudes.emplace_back(buffer);
+            }
+
+            std::vector<CoordinateStrings> coordinates;
+            for (int i = 0; i < count; i++) {
+                coordinates.push_back({latitudes[i], longitudes[i]});
+            }
+
+            size_t invalid = 0;
+            RunBenchmark("Parse 100000 sector file coordinates", 10, [&coordinates, &invalid] {
+                for (const auto& position : ParseSectorFileCoordinates(coordinates)) {
+                    invalid += PositionIsInvalid(position) ? 1 : 0;
+                }
+            });
+
+            EXPECT_EQ(0, invalid);
+        }
     } // namespace SectorFile
 } // namespace UKControllerPluginTest
@@ -2,6 +2,7 @@
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "selcal/SelcalModule.h"
 #include "tag/TagItemCollection.h"
+#include "tag/TagItemMemo.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
@@ -34,9 +35,16 @@ namespace UKControllerPluginTest::Selcal {
         EXPECT_TRUE(container.tagHandler->HasHandlerForItemId(129));
     }
 
-    TEST_F(SelcalModuleTest, ItRegistersFlightplanEvents)
+    TEST_F(SelcalModuleTest, ItMemoisesSelcalTagItems)
     {
         BootstrapPlugin(container);
-        EXPECT_EQ(1, container.flightplanHandler->CountHandlers());
+        EXPECT_TRUE(container.tagHandler->Memo()->IsMemoised(128));
+        EXPECT_TRUE(container.tagHandler->Memo()->IsMemoised(129));
+    }
+
+    TEST_F(SelcalModuleTest, ItDoesntRegisterForFlightplanEvents)
+    {
+        BootstrapPlugin(container);
+        EXPECT_EQ(0, container.flightplanHandler->CountHandlers());
     }
 } // namespace UKControllerPluginTest::Selcal
@@ -71,7 +71,7 @@ namespace UKControllerPluginTest::Selcal {
         EXPECT_EQ("ABCD", tagData.GetItemString());
     }
 
-    TEST_F(SelcalTagItemTest, ItCachesTagItemFromRemarks)
+    TEST_F(SelcalTagItemTest, ItRegeneratesTheTagItemFromRemarks)
     {
         ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/ABCD"));
 
@@ -80,17 +80,19 @@ namespace UKControllerPluginTest::Selcal {
 
         ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/DEFG"));
 
-        EXPECT_EQ("ABCD", tagData.GetItemString());
+        tagItem.SetTagItemData(tagData);
+
+        EXPECT_EQ("DEFG", tagData.GetItemString());
     }
 
-    TEST_F(SelcalTagItemTest, ItCachesInvalidItemFromRemarks)
+    TEST_F(SelcalTagItemTest, ItClearsTheTagItemIfCodeBecomesInvalid)
     {
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/XXXX"));
+        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/ABCD"));
 
         auto tagData = GetTagData(128);
         tagItem.SetTagItemData(tagData);
 
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/DEFG"));
+        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/XXXX"));
 
         tagItem.SetTagItemData(tagData);
 
@@ -106,60 +108,4 @@ namespace UKControllerPluginTest::Selcal {
 
         EXPECT_EQ("AB-CD", tagData.GetItemString());
     }
-
-    TEST_F(SelcalTagItemTest, ItCachesSeparatedItemFromRemarks)
-    {
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/ABCD"));
-
-        auto tagData = GetTagData(129);
-        tagItem.SetTagItemData(tagData);
-
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/DEFG"));
-
-        tagItem.SetTagItemData(tagData);
-
-        EXPECT_EQ("AB-CD", tagData.GetItemString());
-    }
-
-    TEST_F(SelcalTagItemTest, FlightplanEventClearsCache)
-    {
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/ABCD"));
-
-        auto tagData = GetTagData(128);
-        tagItem.SetTagItemData(tagData);
-
-        tagItem.FlightPlanEvent(this->mockFlightplan, this->mockRadarTarget);
-
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/DEFG"));
-
-        tagItem.SetTagItemData(tagData);
-
-        EXPECT_EQ("DEFG", tagData.GetItemString());
-    }
-
-    TEST_F(SelcalTagItemTest, FlightplanDisconnectedEventClearsCache)
-    {
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/ABCD"));
-
-        auto tagData = GetTagData(128);
-        tagItem.SetTagItemData(tagData);
-
-        tagItem.FlightPlanDisconnectEvent(this->mockFlightplan);
-
-        ON_CALL(mockFlightplan, GetRemarks).WillByDefault(testing::Return("RMK/HI SEL/DEFG"));
-
-        tagItem.SetTagItemData(tagData);
-
-        EXPECT_EQ("DEFG", tagData.GetItemString());
-    }
-
-    TEST_F(SelcalTagItemTest, FlightplanDisconnectedHandlesNothingCached)
-    {
-        EXPECT_NO_THROW(tagItem.FlightPlanDisconnectEvent(this->mockFlightplan));
-    }
-
-    TEST_F(SelcalTagItemTest, FlightplanEventHandlesNothingCached)
-    {
-        EXPECT_NO_THROW(tagItem.FlightPlanEvent(this->mockFlightplan, this->mockRadarTarget));
-    }
 } // namespace UKControllerPluginTest::Selcal
@@ -1,3 +1,4 @@
+#include "flightplan/FlightplanSweep.h"
 #include "squawk/SquawkEventHandler.h"
 #include "squawk/SquawkGenerator.h"
 #include "flightplan/StoredFlightplanCollection.h"
@@ -22,6 +23,7 @@ using UKControllerPlugin::Curl::CurlRequest;
 using UKControllerPlugin::Curl::CurlResponse;
 using UKControllerPlugin::Euroscope::GeneralSettingsEntries;
 using UKControllerPlugin::Euroscope::UserSetting;
+using UKControllerPlugin::Flightplan::FlightplanSweep;
 using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Ownership::AirfieldServiceProviderCollection;
@@ -68,9 +70,13 @@ namespace UKControllerPluginTest {
                   controller(1, "EGKK_APP", 126.820, {"EGKK"}, true, false),
                   userCallsign("EGKK_APP", "Testy McTestface", this->controller, true),
                   notUserCallsign("EGKK_APP", "Testy McTestface", this->controller, false),
-                  handler(this->generator, this->activeCallsigns, this->plans, this->pluginLoopback, this->login, false)
-
+                  handler(this->generator, this->activeCallsigns, this->plans, this->pluginLoopback, this->login, false),
+                  sweep(this->pluginLoopback)
             {
+                // The handler outlives the sweep, so the sweep doesn't need to own it
+                this->sweep.RegisterStage(
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightplanSweepStage>(&this->handler, [](auto*) {}),
+                    1);
             }
 
             void SetUp()
@@ -186,6 +192,7 @@ namespace UKControllerPluginTest {
             ActiveCallsign notUserCallsign;
             AirfieldServiceProviderCollection airfieldOwnership;
             SquawkEventHandler handler;
+            FlightplanSweep sweep;
         };
 
         TEST_F(SquawkEventHandlerTest, ItDefaultsToUserSquawksOn)
@@ -365,23 +372,27 @@ namespace UKControllerPluginTest {
             this->AssertLocalAssignment();
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesNothingIfUserNotActive)
+        TEST_F(SquawkEventHandlerTest, SweepDoesNothingIfUserNotActive)
         {
             this->pluginLoopback.ExpectNoFlightplanLoop();
-            SquawkEventHandler handler(
+            auto handler = std::make_shared<SquawkEventHandler>(
                 this->generator, ActiveCallsignCollection(), this->plans, this->pluginLoopback, this->login, true);
-            EXPECT_NO_THROW(handler.TimedEventTrigger());
+            FlightplanSweep sweep(this->pluginLoopback);
+            sweep.RegisterStage(handler, 1);
+            EXPECT_NO_THROW(sweep.TimedEventTrigger());
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesNothingIfAutoAssignDisabled)
+        TEST_F(SquawkEventHandlerTest, SweepDoesNothingIfAutoAssignDisabled)
         {
             this->pluginLoopback.ExpectNoFlightplanLoop();
-            SquawkEventHandler handler(
+            auto handler = std::make_shared<SquawkEventHandler>(
                 this->generator, this->activeCallsigns, this->plans, this->pluginLoopback, this->login, true);
-            EXPECT_NO_THROW(handler.TimedEventTrigger());
+            FlightplanSweep sweep(this->pluginLoopback);
+            sweep.RegisterStage(handler, 1);
+            EXPECT_NO_THROW(sweep.TimedEventTrigger());
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesNothingIfUserToggleOff)
+        TEST_F(SquawkEventHandlerTest, SweepDoesNothingIfUserToggleOff)
         {
             NiceMock<MockUserSettingProviderInterface> userSettingProvider;
             UserSetting userSetting(userSettingProvider);
@@ -393,19 +404,19 @@ namespace UKControllerPluginTest {
             this->pluginLoopback.ExpectNoFlightplanLoop();
 
             this->handler.UserSettingsUpdated(userSetting);
-            EXPECT_NO_THROW(handler.TimedEventTrigger());
+            EXPECT_NO_THROW(this->sweep.TimedEventTrigger());
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesNothingIfFlightplanHasAssignedSquawk)
+        TEST_F(SquawkEventHandlerTest, SweepDoesNothingIfFlightplanHasAssignedSquawk)
         {
             ON_CALL(*this->mockFlightplan, HasAssignedSquawk).WillByDefault(Return(true));
 
             this->pluginLoopback.AddAllFlightplansItem({this->mockFlightplan, this->mockRadarTarget});
 
-            EXPECT_NO_THROW(handler.TimedEventTrigger());
+            EXPECT_NO_THROW(this->sweep.TimedEventTrigger());
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesNothingIfAircraftTrackedByAnotherController)
+        TEST_F(SquawkEventHandlerTest, SweepDoesNothingIfAircraftTrackedByAnotherController)
         {
             ON_CALL(*this->mockFlightplan, HasAssignedSquawk).WillByDefault(Return(false));
 
@@ -415,10 +426,10 @@ namespace UKControllerPluginTest {
 
             this->pluginLoopback.AddAllFlightplansItem({this->mockFlightplan, this->mockRadarTarget});
 
-            EXPECT_NO_THROW(handler.TimedEventTrigger());
+            EXPECT_NO_THROW(this->sweep.TimedEventTrigger());
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesSquawkAssignmentForTrackedByUserAircraft)
+        TEST_F(SquawkEventHandlerTest, SweepDoesSquawkAssignmentForTrackedByUserAircraft)
         {
             this->pluginLoopback.AddAllFlightplansItem({this->mockFlightplan, this->mockRadarTarget});
 
@@ -431,11 +442,11 @@ namespace UKControllerPluginTest {
             ON_CALL(*this->mockRadarTarget, GetFlightLevel()).WillByDefault(Return(999999));
 
             this->expectGeneralAssignment();
-            handler.TimedEventTrigger();
+            this->sweep.TimedEventTrigger();
             this->AssertGeneralAssignment();
         }
 
-        TEST_F(SquawkEventHandlerTest, TimedEventTriggerDoesSquawkAssignmentForUntrackedAircraft)
+        TEST_F(SquawkEventHandlerTest, SweepDoesSquawkAssignmentForUntrackedAircraft)
         {
             this->pluginLoopback.AddAllFlightplansItem({this->mockFlightplan, this->mockRadarTarget});
 
@@ -446,7 +457,7 @@ namespace UKControllerPluginTest {
             ON_CALL(*this->mockRadarTarget, GetFlightLevel()).WillByDefault(Return(999999));
 
             this->expectGeneralAssignment();
-            handler.TimedEventTrigger();
+            this->sweep.TimedEventTrigger();
             this->AssertGeneralAssignment();
         }
 
@@ -6,6 +6,7 @@
 #include "ownership/AirfieldServiceProviderCollection.h"
 #include "controller/ControllerPosition.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiRequestCoalescer.h"
 #include "squawk/ApiSquawkAllocationHandler.h"
 #include "ownership/ServiceProvision.h"
 #include "test/EventBusTestCase.h"
@@ -18,6 +19,7 @@ using ::testing::Throw;
 
 using UKControllerPlugin::Api::ApiInterface;
 using UKControllerPlugin::Api::ApiNotFoundException;
+using UKControllerPlugin::Api::ApiRequestCoalescer;
 using UKControllerPlugin::Controller::ActiveCallsign;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
 using UKControllerPlugin::Controller::ControllerPosition;
@@ -41,9 +43,15 @@ using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
 namespace UKControllerPluginTest {
     namespace Squawk {
 
-        class SquawkGeneratorTest : public UKControllerPluginUtilsTest::EventBusTestCase
+        class SquawkGeneratorTest : public ApiTestCase, public UKControllerPluginUtilsTest::EventBusTestCase
         {
             public:
+            void TearDown() override
+            {
+                ApiTestCase::TearDown();
+                EventBusTestCase::TearDown();
+            }
+
             void SetUp() override
             {
                 UKControllerPluginUtilsTest::EventBusTestCase::SetUp();
@@ -621,5 +629,141 @@ namespace UKControllerPluginTest {
                     EXPECT_EQ("1234", event.previousSquawk);
                 });
         }
+
+        TEST_F(SquawkGeneratorTest, GeneralSquawkIsQueuedWithCoalescerIfSet)
+        {
+            MockTaskRunnerInterface mockRunnerNoExecute(false);
+            auto coalescer = std::make_shared<ApiRequestCoalescer>(mockRunnerNoExecute, *this->generator);
+            this->generator->SetRequestCoalescer(coalescer);
+
+            StoredFlightplan storedPlan("BAW1252", "EGKK", "EGPF");
+            this->flightplans.UpdatePlan(storedPlan);
+            ON_CALL(*this->mockFlightplan, GetCallsign()).WillByDefault(Return("BAW1252"));
+            ON_CALL(*this->mockFlightplan, IsTrackedByUser()).WillByDefault(Return(true));
+            ON_CALL(*this->mockFlightplan, HasAssignedSquawk()).WillByDefault(Return(false));
+            ON_CALL(*this->mockFlightplan, GetOrigin()).WillByDefault(Return("EGKK"));
+            ON_CALL(*this->mockFlightplan, GetDestination()).WillByDefault(Return("EGPF"));
+            EXPECT_CALL(this->api, GetAssignedSquawk(_)).Times(0);
+            EXPECT_CALL(this->api, CreateGeneralSquawkAssignment(_, _, _)).Times(0);
+
+            EXPECT_TRUE(
+                this->generator->RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+            EXPECT_EQ(1, coalescer->CountPending());
+        }
+
+        TEST_F(SquawkGeneratorTest, BulkRequestReturnsResults)
+        {
+            nlohmann::json items = nlohmann::json::array(
+                {{{"callsign", "BAW123"}, {"type", "general"}, {"origin", "EGKK"}, {"destination", "EGPF"}},
+                 {{"callsign", "BAW456"}, {"type", "local"}, {"unit", "EGKK"}, {"rules", "V"}}});
+
+            this->ExpectApiRequest()
+                ->Post()
+                .To("squawk-assignment/bulk")
+                .WithBody(nlohmann::json{{"assignments", items}})
+                .WillReturnOk()
+                .WithResponseBody(nlohmann::json{{"BAW123", {{"squawk", "4521"}}}, {"BAW456", {{"squawk", "7251"}}}});
+
+            const auto results = this->generator->PerformBulkRequest(items);
+            ASSERT_TRUE(results.has_value());
+            EXPECT_EQ(
+                nlohmann::json({{"BAW123", {{"squawk", "4521"}}}, {"BAW456", {{"squawk", "7251"}}}}), results.value());
+        }
+
+        TEST_F(SquawkGeneratorTest, BulkRequestReturnsNulloptIfApiDoesntSupportIt)
+        {
+            nlohmann::json items = nlohmann::json::array({{{"callsign", "BAW123"}}, {{"callsign", "BAW456"}}});
+
+            this->ExpectApiRequest()
+                ->Post()
+                .To("squawk-assignment/bulk")
+                .WithBody(nlohmann::json{{"assignments", items}})
+                .WillReturnNotFound();
+
+            EXPECT_FALSE(this->generator->PerformBulkRequest(items).has_value());
+        }
+
+        TEST_F(SquawkGeneratorTest, BulkRequestThrowsOnFailure)
+        {
+            nlohmann::json items = nlohmann::json::array({{{"callsign", "BAW123"}}, {{"callsign", "BAW456"}}});
+
+            this->ExpectApiRequest()
+                ->Post()
+                .To("squawk-assignment/bulk")
+                .WithBody(nlohmann::json{{"assignments", items}})
+                .WillReturnServerError();
+
+            EXPECT_THROW(static_cast<void>(this->generator->PerformBulkRequest(items)), std::runtime_error);
+        }
+
+        TEST_F(SquawkGeneratorTest, AbandoningRequestEndsTheSquawkUpdate)
+        {
+            MockTaskRunnerInterface mockRunnerNoExecute(false);
+            SquawkGenerator newGenerator(
+                this->api,
+                &mockRunnerNoExecute,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler);
+
+            ON_CALL(*this->mockFlightplan, SetSquawk("7000")).WillByDefault(Return());
+            ON_CALL(*this->mockFlightplan, GetCallsign()).WillByDefault(Return("BAW1252"));
+            ON_CALL(*this->mockFlightplan, IsTrackedByUser()).WillByDefault(Return(true));
+            ON_CALL(*this->mockFlightplan, HasAssignedSquawk()).WillByDefault(Return(false));
+            ON_CALL(*this->mockFlightplan, GetDistanceFromOrigin).WillByDefault(Return(1.0));
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel).WillByDefault(Return(1));
+
+            EXPECT_TRUE(newGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+            EXPECT_FALSE(newGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+            newGenerator.AbandonRequest("BAW1252");
+            EXPECT_TRUE(newGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+        }
+
+        TEST_F(SquawkGeneratorTest, BulkResultQueuesAllocation)
+        {
+            this->generator->ProcessBulkResult("BAW123", {{"squawk", "4521"}});
+            ApiSquawkAllocation expected{"BAW123", "4521"};
+            EXPECT_EQ(1, this->squawkAllocationHandler->Count());
+            EXPECT_TRUE(expected == this->squawkAllocationHandler->First());
+        }
+
+        TEST_F(SquawkGeneratorTest, BulkResultIgnoresInvalidSquawk)
+        {
+            this->generator->ProcessBulkResult("BAW123", {{"squawk", "9999"}});
+            EXPECT_EQ(0, this->squawkAllocationHandler->Count());
+        }
+
+        TEST_F(SquawkGeneratorTest, BulkResultIgnoresMissingSquawk)
+        {
+            this->generator->ProcessBulkResult("BAW123", nlohmann::json::object());
+            EXPECT_EQ(0, this->squawkAllocationHandler->Count());
+        }
+
+        TEST_F(SquawkGeneratorTest, ItemRequestCreatesGeneralSquawk)
+        {
+            ApiSquawkAllocation allocation{"BAW123", "4521"};
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW123")).WillOnce(Throw(ApiNotFoundException("Not found")));
+            EXPECT_CALL(this->api, CreateGeneralSquawkAssignment("BAW123", "EGKK", "EGPF"))
+                .Times(1)
+                .WillOnce(Return(allocation));
+
+            this->generator->PerformItemRequest(
+                "BAW123", {{"callsign", "BAW123"}, {"type", "general"}, {"origin", "EGKK"}, {"destination", "EGPF"}});
+            EXPECT_EQ(1, this->squawkAllocationHandler->Count());
+        }
+
+        TEST_F(SquawkGeneratorTest, ItemRequestCreatesLocalSquawk)
+        {
+            ApiSquawkAllocation allocation{"BAW123", "7251"};
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW123")).WillOnce(Throw(ApiNotFoundException("Not found")));
+            EXPECT_CALL(this->api, CreateLocalSquawkAssignment("BAW123", "EGKK", "V"))
+                .Times(1)
+                .WillOnce(Return(allocation));
+
+            this->generator->PerformItemRequest(
+                "BAW123", {{"callsign", "BAW123"}, {"type", "local"}, {"unit", "EGKK"}, {"rules", "V"}});
+            EXPECT_EQ(1, this->squawkAllocationHandler->Count());
+        }
     } // namespace Squawk
 } // namespace UKControllerPluginTest
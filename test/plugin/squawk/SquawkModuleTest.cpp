@@ -3,6 +3,7 @@
 #include "euroscope/UserSettingAwareCollection.h"
 #include "eventhandler/EventHandlerFlags.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/FlightplanSweep.h"
 #include "plugin/FunctionCallEventHandler.h"
 #include "squawk/ResetSquawkOnFailedDelete.h"
 #include "squawk/SquawkAssignmentDeleteForConspicuityFailedEvent.h"
@@ -30,8 +31,12 @@ namespace UKControllerPluginTest::Squawk {
             this->container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
             this->container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
             this->container.timedHandler = std::make_unique<TimedEventCollection>();
+            this->container.plugin = std::make_unique<testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface>>();
+            this->container.flightplanSweep =
+                std::make_shared<UKControllerPlugin::Flightplan::FlightplanSweep>(*this->container.plugin);
             this->container.userSettingHandlers = std::make_shared<UserSettingAwareCollection>();
             this->container.activeCallsigns = std::make_shared<ActiveCallsignCollection>();
+            this->container.taskRunner = std::make_unique<testing::NiceMock<TaskManager::MockTaskRunnerInterface>>();
         }
 
         PersistenceContainer container;
@@ -49,11 +54,17 @@ namespace UKControllerPluginTest::Squawk {
         EXPECT_EQ(1, container.timedHandler->CountHandlersForFrequency(SquawkModule::allocationCheckFrequency));
     }
 
-    TEST_F(SquawkModuleTest, BootstrapPluginRegistersEventHandlerForTimedEvents)
+    TEST_F(SquawkModuleTest, BootstrapPluginRegistersRequestCoalescerForTimedEvents)
+    {
+        SquawkModule::BootstrapPlugin(container, false);
+        EXPECT_EQ(1, container.timedHandler->CountHandlersForFrequency(SquawkModule::squawkRequestBatchFrequency));
+    }
+
+    TEST_F(SquawkModuleTest, BootstrapPluginRegistersEventHandlerForFlightplanSweeps)
     {
         SquawkModule::BootstrapPlugin(container, false);
         EXPECT_EQ(
-            1, this->container.timedHandler->CountHandlersForFrequency(SquawkModule::squawkAssignmentsCheckFrequency));
+            1, this->container.flightplanSweep->CountStagesForFrequency(SquawkModule::squawkAssignmentsCheckFrequency));
     }
 
     TEST_F(SquawkModuleTest, BootstrapPluginRegistersEventHandlerForActiveCallsignEvents)
@@ -5,6 +5,9 @@
 #include "plugin/FunctionCallEventHandler.h"
 #include "dialog/DialogManager.h"
 #include "radarscreen/ConfigurableDisplayCollection.h"
+#include "srd/SrdSearchCompletedEvent.h"
+#include "srd/SrdSearchDialog.h"
+#include "test/EventBusTestCase.h"
 
 using ::testing::NiceMock;
 using ::testing::Test;
@@ -15,12 +18,15 @@ using UKControllerPlugin::Plugin::FunctionCallEventHandler;
 using UKControllerPlugin::RadarScreen::ConfigurableDisplayCollection;
 using UKControllerPlugin::Srd::BootstrapPlugin;
 using UKControllerPlugin::Srd::BootstrapRadarScreen;
+using UKControllerPlugin::Srd::GetDependencyKey;
+using UKControllerPlugin::Srd::SrdSearchCompletedEvent;
+using UKControllerPlugin::Srd::SrdSearchDialog;
 using UKControllerPluginTest::Dialog::MockDialogProvider;
 
 namespace UKControllerPluginTest {
     namespace Srd {
 
-        class SrdModuleTest : public Test
+        class SrdModuleTest : public UKControllerPluginUtilsTest::EventBusTestCase
         {
             public:
             SrdModuleTest()
@@ -28,6 +34,7 @@ namespace UKControllerPluginTest {
                 container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
                 container.dialogManager = std::make_unique<DialogManager>(NiceMock<MockDialogProvider>());
                 container.dependencyLoader = std::make_unique<testing::NiceMock<Dependency::MockDependencyLoader>>();
+                container.taskRunner = std::make_shared<NiceMock<TaskManager::MockTaskRunnerInterface>>();
                 ModuleBootstrap(container);
             }
 
@@ -56,6 +63,31 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, this->container.pluginFunctionHandlers->CountCallbacks());
         }
 
+        TEST_F(SrdModuleTest, BootstrapPluginLoadsTheSrdDependency)
+        {
+            auto& dependencyLoader =
+                static_cast<testing::NiceMock<Dependency::MockDependencyLoader>&>(*this->container.dependencyLoader);
+            EXPECT_CALL(dependencyLoader, LoadDependency(testing::_, testing::_)).Times(testing::AnyNumber());
+            EXPECT_CALL(dependencyLoader, LoadDependency("DEPENDENCY_SRD", nlohmann::json::array()))
+                .Times(1)
+                .WillOnce(testing::Return(nlohmann::json::array()));
+
+            BootstrapPlugin(this->container);
+        }
+
+        TEST_F(SrdModuleTest, BootstrapPluginRegistersDialogForCompletedSearches)
+        {
+            BootstrapPlugin(this->container);
+            AssertSingleEventHandlerRegistrationForEvent<SrdSearchCompletedEvent>();
+            AssertHandlerRegisteredForEvent<SrdSearchDialog, SrdSearchCompletedEvent>(
+                UKControllerPluginUtils::EventHandler::EventHandlerFlags::EuroscopeThread);
+        }
+
+        TEST_F(SrdModuleTest, ItHasADependencyKey)
+        {
+            EXPECT_EQ("DEPENDENCY_SRD", GetDependencyKey());
+        }
+
         TEST_F(SrdModuleTest, BootstrapRadarScreenAddsToConfigurables)
         {
             BootstrapPlugin(this->container);
@@ -0,0 +1,194 @@
+#include "srd/SrdRouteIndex.h"
+#include "srd/SrdSearchParameters.h"
+
+using UKControllerPlugin::Srd::SrdRouteIndex;
+using UKControllerPlugin::Srd::SrdSearchParameters;
+
+namespace UKControllerPluginTest::Srd {
+    class SrdRouteIndexTest : public testing::Test
+    {
+        public:
+        SrdRouteIndexTest() : index(GetRoutes())
+        {
+        }
+
+        static auto GetRoutes() -> nlohmann::json
+        {
+            return nlohmann::json::array(
+                {{{"origin", "EGLL"},
+                  {"destination", "EGPH"},
+                  {"minimum_level", 24000},
+                  {"maximum_level", 46000},
+                  {"route_string", "CPT3F CPT UL9 KENET DCT TALLA"},
+                  {"notes", nlohmann::json::array({{{"id", 1}, {"text", "Not available 2300-0600"}}})}},
+                 {{"origin", "EGLL"},
+                  {"destination", "EGPH"},
+                  {"minimum_level", nullptr},
+                  {"maximum_level", 23000},
+                  {"route_string", "BPK7F BPK DCT TNT DCT TALLA"},
+                  {"notes", nlohmann::json::array()}},
+                 {{"origin", "EGLL"},
+                  {"destination", "EGCC"},
+                  {"minimum_level", 10000},
+                  {"maximum_level", 25000},
+                  {"route_string", "BPK7F BPK DCT TNT"},
+                  {"notes", nlohmann::json::array()}},
+                 {{"origin", "EGKK"},
+                  {"destination", "EGPH"},
+                  {"minimum_level", 24000},
+                  {"maximum_level", 66000},
+                  {"route_string", "LAM DCT BPK UN57 TNT DCT TNT"},
+                  {"notes", nlohmann::json::array()}},
+                 {{"origin", "EGLL"},
+                  {"destination", "EGPH"},
+                  {"minimum_level", "24000"},
+                  {"maximum_level", 46000},
+                  {"route_string", "INVALID"},
+                  {"notes", nlohmann::json::array()}}});
+        }
+
+        static auto RouteStrings(const nlohmann::json& results) -> std::vector<std::string>
+        {
+            std::vector<std::string> routeStrings;
+            for (const auto& result : results) {
+                routeStrings.push_back(result.at("route_string").get<std::string>());
+            }
+
+            return routeStrings;
+        }
+
+        SrdRouteIndex index;
+    };
+
+    TEST_F(SrdRouteIndexTest, ItIndexesValidRoutes)
+    {
+        EXPECT_EQ(4, index.Count());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItHandlesRoutesNotBeingAnArray)
+    {
+        EXPECT_EQ(0, SrdRouteIndex(nlohmann::json::object()).Count());
+        EXPECT_EQ(0, SrdRouteIndex(nlohmann::json()).Count());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItSkipsInvalidRoutes)
+    {
+        auto routes = GetRoutes();
+        routes[0].erase("origin");
+        routes[1]["maximum_level"] = nullptr;
+        routes[2]["notes"] = nlohmann::json::array({{{"id", "1"}, {"text", "Bad note"}}});
+        routes[3]["route_string"] = 123;
+
+        EXPECT_EQ(0, SrdRouteIndex(routes).Count());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItFindsAllRoutesBetweenOriginAndDestination)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>({"CPT3F CPT UL9 KENET DCT TALLA", "BPK7F BPK DCT TNT DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH"})));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItReturnsRoutesInApiFormat)
+    {
+        const auto results = index.Search({"EGLL", "EGPH", 30000});
+        ASSERT_EQ(1, results.size());
+        EXPECT_EQ(
+            nlohmann::json(
+                {{"minimum_level", 24000},
+                 {"maximum_level", 46000},
+                 {"route_string", "CPT3F CPT UL9 KENET DCT TALLA"},
+                 {"notes", nlohmann::json::array({{{"id", 1}, {"text", "Not available 2300-0600"}}})}}),
+            results[0]);
+    }
+
+    TEST_F(SrdRouteIndexTest, ItFiltersRoutesByRequestedLevel)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>({"CPT3F CPT UL9 KENET DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH", 35000})));
+        EXPECT_EQ(
+            std::vector<std::string>({"BPK7F BPK DCT TNT DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH", 15000})));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItIncludesTheLevelLimits)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>({"CPT3F CPT UL9 KENET DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH", 24000})));
+        EXPECT_EQ(
+            std::vector<std::string>({"CPT3F CPT UL9 KENET DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH", 46000})));
+        EXPECT_EQ(
+            std::vector<std::string>({"BPK7F BPK DCT TNT DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH", 23000})));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItTreatsNoMinimumLevelAsUnrestricted)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>({"BPK7F BPK DCT TNT DCT TALLA"}),
+            RouteStrings(index.Search({"EGLL", "EGPH", 1000})));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItReturnsNothingAboveTheMaximumLevel)
+    {
+        EXPECT_TRUE(index.Search({"EGLL", "EGPH", 47000}).empty());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItSearchesCaseInsensitively)
+    {
+        EXPECT_EQ(2, index.Search({"egll", "egPH"}).size());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItFindsAllRoutesFromAnOriginIfNoDestination)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>(
+                {"CPT3F CPT UL9 KENET DCT TALLA", "BPK7F BPK DCT TNT DCT TALLA", "BPK7F BPK DCT TNT"}),
+            RouteStrings(index.Search({"EGLL", ""})));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItFindsAllRoutesToADestinationIfNoOrigin)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>(
+                {"CPT3F CPT UL9 KENET DCT TALLA", "BPK7F BPK DCT TNT DCT TALLA", "LAM DCT BPK UN57 TNT DCT TNT"}),
+            RouteStrings(index.Search({"", "EGPH"})));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItReturnsNothingIfNoOriginOrDestination)
+    {
+        EXPECT_TRUE(index.Search({"", ""}).empty());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItReturnsNothingForUnknownAirfields)
+    {
+        EXPECT_TRUE(index.Search({"EGSS", "EGPH"}).empty());
+        EXPECT_TRUE(index.Search({"EGLL", "EGPF"}).empty());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItFindsRoutesViaAWaypoint)
+    {
+        EXPECT_EQ(
+            std::vector<std::string>(
+                {"BPK7F BPK DCT TNT DCT TALLA", "BPK7F BPK DCT TNT", "LAM DCT BPK UN57 TNT DCT TNT"}),
+            RouteStrings(index.RoutesVia("TNT")));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItFindsRoutesViaAnAirway)
+    {
+        EXPECT_EQ(std::vector<std::string>({"CPT3F CPT UL9 KENET DCT TALLA"}), RouteStrings(index.RoutesVia("ul9")));
+    }
+
+    TEST_F(SrdRouteIndexTest, ItDoesntIndexDirects)
+    {
+        EXPECT_TRUE(index.RoutesVia("DCT").empty());
+    }
+
+    TEST_F(SrdRouteIndexTest, ItReturnsNothingForUnknownWaypoints)
+    {
+        EXPECT_TRUE(index.RoutesVia("DVR").empty());
+    }
+} // namespace UKControllerPluginTest::Srd
@@ -1,25 +1,40 @@
+#include "srd/SrdRouteIndex.h"
 #include "srd/SrdSearchDialog.h"
+#include "srd/SrdSearcher.h"
 
 using ::testing::NiceMock;
 using ::testing::Test;
+using UKControllerPlugin::Srd::SrdRouteIndex;
+using UKControllerPlugin::Srd::SrdSearchCompletedEvent;
 using UKControllerPlugin::Srd::SrdSearchDialog;
+using UKControllerPlugin::Srd::SrdSearcher;
 using UKControllerPluginTest::Api::MockApiInterface;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
 
 namespace UKControllerPluginTest::Srd {
 
     class SrdSearchDialogTest : public Test
     {
         public:
-        SrdSearchDialogTest() : dialog(plugin, mockApi, exitGenerator)
+        SrdSearchDialogTest()
+            : searcher(std::make_shared<SrdRouteIndex>(nlohmann::json::array()), mockApi, mockTaskRunner),
+              dialog(plugin, searcher, exitGenerator)
         {
         }
 
         testing::NiceMock<Euroscope::MockEuroscopePluginLoopbackInterface> plugin;
         testing::NiceMock<IntentionCode::MockAircraftFirExitGenerator> exitGenerator;
         NiceMock<MockApiInterface> mockApi;
+        NiceMock<MockTaskRunnerInterface> mockTaskRunner;
+        SrdSearcher searcher;
         SrdSearchDialog dialog;
     };
 
+    TEST_F(SrdSearchDialogTest, ItIgnoresCompletedSearchesWhenTheDialogIsClosed)
+    {
+        EXPECT_NO_THROW(dialog.OnEvent(SrdSearchCompletedEvent{0, nlohmann::json::array()}));
+    }
+
     TEST_F(SrdSearchDialogTest, SearchResultsAreValidWithNoNotes)
     {
         nlohmann::json results = nlohmann::json::array();
@@ -0,0 +1,132 @@
+#include "api/ApiException.h"
+#include "srd/SrdRouteIndex.h"
+#include "srd/SrdSearchCompletedEvent.h"
+#include "srd/SrdSearchParameters.h"
+#include "srd/SrdSearcher.h"
+#include "task/TaskRunner.h"
+#include "test/EventBusTestCase.h"
+
+using testing::NiceMock;
+using testing::Return;
+using testing::Throw;
+using UKControllerPlugin::Api::ApiException;
+using UKControllerPlugin::Srd::SrdRouteIndex;
+using UKControllerPlugin::Srd::SrdSearchCompletedEvent;
+using UKControllerPlugin::Srd::SrdSearcher;
+using UKControllerPlugin::Srd::SrdSearchParameters;
+using UKControllerPlugin::TaskManager::TaskRunner;
+using UKControllerPluginTest::Api::MockApiInterface;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+
+namespace UKControllerPluginTest::Srd {
+    class SrdSearcherTest : public UKControllerPluginUtilsTest::EventBusTestCase
+    {
+        public:
+        SrdSearcherTest()
+            : routes(nlohmann::json::array(
+                  {{{"origin", "EGLL"},
+                    {"destination", "EGPH"},
+                    {"minimum_level", 24000},
+                    {"maximum_level", 46000},
+                    {"route_string", "CPT3F CPT UL9 KENET DCT TALLA"},
+                    {"notes", nlohmann::json::array()}}})),
+              apiResults(nlohmann::json::array(
+                  {{{"minimum_level", nullptr},
+                    {"maximum_level", 66000},
+                    {"route_string", "BPK7F BPK DCT TNT DCT TALLA"},
+                    {"notes", nlohmann::json::array()}}})),
+              offlineSearcher(std::make_shared<SrdRouteIndex>(routes), mockApi, mockTaskRunner),
+              onlineSearcher(std::make_shared<SrdRouteIndex>(nlohmann::json::array()), mockApi, mockTaskRunner)
+        {
+        }
+
+        nlohmann::json routes;
+        nlohmann::json apiResults;
+        SrdSearchParameters parameters{"EGLL", "EGPH", 35000};
+        NiceMock<MockApiInterface> mockApi;
+        NiceMock<MockTaskRunnerInterface> mockTaskRunner;
+        SrdSearcher offlineSearcher;
+        SrdSearcher onlineSearcher;
+    };
+
+    TEST_F(SrdSearcherTest, ItSearchesTheOfflineIndexImmediately)
+    {
+        EXPECT_CALL(mockApi, SearchSrd).Times(0);
+
+        const auto results = offlineSearcher.Search(parameters);
+        ASSERT_TRUE(results.has_value());
+        ASSERT_EQ(1, results->size());
+        EXPECT_EQ("CPT3F CPT UL9 KENET DCT TALLA", results->at(0).at("route_string").get<std::string>());
+        AssertNoEventsDispatched();
+    }
+
+    TEST_F(SrdSearcherTest, ItFallsBackToTheApiIfNoOfflineRoutes)
+    {
+        EXPECT_CALL(mockApi, SearchSrd(parameters)).Times(1).WillOnce(Return(apiResults));
+
+        EXPECT_EQ(std::nullopt, onlineSearcher.Search(parameters));
+        AssertSingleEventDispatched();
+        AssertFirstEventDispatched<SrdSearchCompletedEvent>([this](const SrdSearchCompletedEvent& event) {
+            EXPECT_EQ(1, event.searchId);
+            EXPECT_EQ(apiResults, event.results);
+        });
+    }
+
+    TEST_F(SrdSearcherTest, ItDispatchesNoResultsIfTheApiFails)
+    {
+        EXPECT_CALL(mockApi, SearchSrd(parameters)).Times(1).WillOnce(Throw(ApiException("Foo")));
+
+        EXPECT_EQ(std::nullopt, onlineSearcher.Search(parameters));
+        AssertFirstEventDispatched<SrdSearchCompletedEvent>(
+            [](const SrdSearchCompletedEvent& event) { EXPECT_EQ(nlohmann::json::array(), event.results); });
+    }
+
+    TEST_F(SrdSearcherTest, ItTracksTheLatestSearch)
+    {
+        static_cast<void>(onlineSearcher.Search(parameters));
+        static_cast<void>(onlineSearcher.Search(parameters));
+
+        EXPECT_EQ(2, onlineSearcher.LatestSearch());
+        EXPECT_FALSE(onlineSearcher.IsLatestSearch(1));
+        EXPECT_TRUE(onlineSearcher.IsLatestSearch(2));
+    }
+
+    TEST_F(SrdSearcherTest, ItNeverCallsTheApiOnTheCallingThread)
+    {
+        NiceMock<MockTaskRunnerInterface> deferredTaskRunner(false);
+        SrdSearcher searcher(std::make_shared<SrdRouteIndex>(nlohmann::json::array()), mockApi, deferredTaskRunner);
+        EXPECT_CALL(mockApi, SearchSrd).Times(0);
+
+        EXPECT_EQ(std::nullopt, searcher.Search(parameters));
+        AssertNoEventsDispatched();
+    }
+
+    TEST_F(SrdSearcherTest, ASlowApiDoesntBlockTheSearch)
+    {
+        const auto apiDelay = std::chrono::milliseconds(500);
+        std::atomic<bool> apiCalled = false;
+        ON_CALL(mockApi, SearchSrd).WillByDefault([this, apiDelay, &apiCalled](const SrdSearchParameters&) {
+            apiCalled = true;
+            std::this_thread::sleep_for(apiDelay);
+            return apiResults;
+        });
+
+        std::chrono::steady_clock::duration searchTime;
+        {
+            TaskRunner taskRunner(1);
+            SrdSearcher searcher(std::make_shared<SrdRouteIndex>(nlohmann::json::array()), mockApi, taskRunner);
+
+            const auto start = std::chrono::steady_clock::now();
+            EXPECT_EQ(std::nullopt, searcher.Search(parameters));
+            searchTime = std::chrono::steady_clock::now() - start;
+
+            // Shutting down the task runner waits for a running task, so make sure it has started
+            while (!apiCalled) {
+                std::this_thread::yield();
+            }
+        }
+
+        EXPECT_LT(searchTime, apiDelay / 5);
+        AssertSingleEventDispatched();
+    }
+} // namespace UKControllerPluginTest::Srd
@@ -1,4 +1,5 @@
 #include "stands/StandEventHandler.h"
+#include "stands/StandOccupancyConflictEvent.h"
 #include "tag/TagData.h"
 #include "api/ApiException.h"
 #include "controller/ActiveCallsign.h"
@@ -8,6 +9,10 @@
 #include "stands/StandUnassignedMessage.h"
 #include "stands/StandAssignedMessage.h"
 #include "integration/InboundMessage.h"
+#include "push/PushEventRingBuffer.h"
+#include "push/SharedSyncData.h"
+#include "push/SyncSnapshotStore.h"
+#include "test/EventBusTestCase.h"
 
 using ::testing::_;
 using ::testing::NiceMock;
@@ -19,11 +24,16 @@ using UKControllerPlugin::Integration::InboundMessage;
 using UKControllerPlugin::Integration::MessageType;
 using UKControllerPlugin::Plugin::PopupMenuItem;
 using UKControllerPlugin::Push::PushEvent;
+using UKControllerPlugin::Push::PushEventRingBuffer;
 using UKControllerPlugin::Push::PushEventSubscription;
+using UKControllerPlugin::Push::SharedSyncData;
+using UKControllerPlugin::Push::SyncSnapshotStore;
 using UKControllerPlugin::Stands::CompareStands;
 using UKControllerPlugin::Stands::Stand;
 using UKControllerPlugin::Stands::StandAssignedMessage;
 using UKControllerPlugin::Stands::StandEventHandler;
+using UKControllerPlugin::Stands::StandIndex;
+using UKControllerPlugin::Stands::StandOccupancyConflictEvent;
 using UKControllerPlugin::Stands::StandUnassignedMessage;
 using UKControllerPlugin::Tag::TagData;
 using UKControllerPluginTest::Api::MockApiInterface;
@@ -37,7 +47,7 @@ using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
 namespace UKControllerPluginTest {
     namespace Stands {
 
-        class StandEventHandlerTest : public ApiTestCase
+        class StandEventHandlerTest : public ApiTestCase, public UKControllerPluginUtilsTest::EventBusTestCase
         {
             public:
             StandEventHandlerTest()
@@ -56,11 +66,55 @@ namespace UKControllerPluginTest {
                 this->mockController = std::make_shared<NiceMock<MockEuroScopeCControllerInterface>>();
             }
 
+            void TearDown() override
+            {
+                ApiTestCase::TearDown();
+                EventBusTestCase::TearDown();
+            }
+
+            /*
+                Puts an aircraft at the given position, departing Gatwick for Heathrow unless told otherwise.
+            */
+            void PositionAircraft(
+                const std::string& callsign,
+                double latitude,
+                double longitude,
+                int groundSpeed = 0,
+                const std::string& origin = "EGKK",
+                const std::string& destination = "EGLL")
+            {
+                auto aircraftFlightplan = std::make_shared<NiceMock<MockEuroScopeCFlightPlanInterface>>();
+                ON_CALL(*aircraftFlightplan, GetCallsign()).WillByDefault(Return(callsign));
+                ON_CALL(*aircraftFlightplan, GetOrigin()).WillByDefault(Return(origin));
+                ON_CALL(*aircraftFlightplan, GetDestination()).WillByDefault(Return(destination));
+                ON_CALL(this->plugin, GetFlightplanForCallsign(callsign)).WillByDefault(Return(aircraftFlightplan));
+
+                EuroScopePlugIn::CPosition position;
+                position.m_Latitude = latitude;
+                position.m_Longitude = longitude;
+                NiceMock<MockEuroScopeCRadarTargetInterface> aircraftRadarTarget;
+                ON_CALL(aircraftRadarTarget, GetCallsign()).WillByDefault(Return(callsign));
+                ON_CALL(aircraftRadarTarget, GetPosition()).WillByDefault(Return(position));
+                ON_CALL(aircraftRadarTarget, GetGroundSpeed()).WillByDefault(Return(groundSpeed));
+
+                this->handler.FlightPlanEvent(*aircraftFlightplan, aircraftRadarTarget);
+                this->handler.RadarTargetPositionUpdateEvent(aircraftRadarTarget);
+            }
+
+            void AssignStandFromWebsocket(const std::string& callsign, int standId)
+            {
+                this->handler.ProcessPushEvent(
+                    {"App\\Events\\StandAssignedEvent",
+                     "private-stand-assignments",
+                     nlohmann::json{{"callsign", callsign}, {"stand_id", standId}},
+                     ""});
+            }
+
             static std::set<Stand, CompareStands> GetStands()
             {
                 std::set<Stand, CompareStands> stands;
-                stands.insert({1, "EGKK", "1L"});
-                stands.insert({2, "EGKK", "55"});
+                stands.insert({1, "EGKK", "1L", 51.15, -0.19, true});
+                stands.insert({2, "EGKK", "55", 51.15, -0.18, true});
                 stands.insert({3, "EGLL", "317"});
                 return stands;
             }
@@ -345,6 +399,52 @@ namespace UKControllerPluginTest {
             ASSERT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("RYR234"));
         }
 
+        TEST_F(StandEventHandlerTest, ItPublishesAssignmentsOnPluginEventsSyncAsPrimaryInstance)
+        {
+            std::vector<uint64_t> eventMemory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1);
+            std::vector<uint64_t> snapshotMemory(SyncSnapshotStore::RequiredSize(2, 256) / sizeof(uint64_t) + 1);
+            auto events = std::make_shared<PushEventRingBuffer>(eventMemory.data(), 4, 64);
+            auto snapshots = std::make_shared<SyncSnapshotStore>(snapshotMemory.data(), 2, 256);
+            events->Initialise();
+            snapshots->Initialise();
+            this->handler.SetSharedSyncData(std::make_shared<SharedSyncData>(snapshots, events, true));
+
+            nlohmann::json assignments = nlohmann::json::array();
+            assignments.push_back({
+                {"callsign", "BAW123"},
+                {"stand_id", 1},
+            });
+
+            EXPECT_CALL(this->api, GetAssignedStands()).Times(1).WillOnce(Return(assignments));
+
+            this->handler.PluginEventsSynced();
+            ASSERT_EQ(1, this->handler.GetAssignedStandForCallsign("BAW123"));
+            EXPECT_EQ(assignments, SharedSyncData(snapshots, events, false).Get(StandEventHandler::sharedSyncKey));
+        }
+
+        TEST_F(StandEventHandlerTest, ItUsesSharedAssignmentsOnPluginEventsSyncAsSecondaryInstance)
+        {
+            std::vector<uint64_t> eventMemory(PushEventRingBuffer::RequiredSize(4, 64) / sizeof(uint64_t) + 1);
+            std::vector<uint64_t> snapshotMemory(SyncSnapshotStore::RequiredSize(2, 256) / sizeof(uint64_t) + 1);
+            auto events = std::make_shared<PushEventRingBuffer>(eventMemory.data(), 4, 64);
+            auto snapshots = std::make_shared<SyncSnapshotStore>(snapshotMemory.data(), 2, 256);
+            events->Initialise();
+            snapshots->Initialise();
+            this->handler.SetSharedSyncData(std::make_shared<SharedSyncData>(snapshots, events, false));
+
+            nlohmann::json assignments = nlohmann::json::array();
+            assignments.push_back({
+                {"callsign", "BAW123"},
+                {"stand_id", 1},
+            });
+            SharedSyncData(snapshots, events, true).Publish(StandEventHandler::sharedSyncKey, assignments);
+
+            EXPECT_CALL(this->api, GetAssignedStands()).Times(0);
+
+            this->handler.PluginEventsSynced();
+            ASSERT_EQ(1, this->handler.GetAssignedStandForCallsign("BAW123"));
+        }
+
         TEST_F(StandEventHandlerTest, ItHandlesNonArrayStandAssignments)
         {
             nlohmann::json assignments = nlohmann::json::object();
@@ -2736,5 +2836,340 @@ namespace UKControllerPluginTest {
             this->AwaitApiCallCompletion();
             EXPECT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("BAW123"));
         }
+
+        TEST_F(StandEventHandlerTest, BulkRequestReturnsResultsByCallsign)
+        {
+            nlohmann::json items = nlohmann::json::array(
+                {{{"callsign", "BAW123"}, {"assignment_type", "arrival"}},
+                 {{"callsign", "BAW456"}, {"assignment_type", "arrival"}}});
+
+            this->ExpectApiRequest()
+                ->Post()
+                .To("stand/assignment/requestauto/bulk")
+                .WithBody(nlohmann::json{{"assignments", items}})
+                .WillReturnOk()
+                .WithResponseBody(nlohmann::json{{"BAW123", {{"stand_id", 1}}}, {"BAW456", {{"stand_id", 2}}}});
+
+            const auto results = this->handler.PerformBulkRequest(items);
+            ASSERT_TRUE(results.has_value());
+            EXPECT_EQ(
+                nlohmann::json({{"BAW123", {{"stand_id", 1}}}, {"BAW456", {{"stand_id", 2}}}}), results.value());
+        }
+
+        TEST_F(StandEventHandlerTest, BulkRequestReturnsNulloptIfApiDoesntSupportIt)
+        {
+            nlohmann::json items = nlohmann::json::array({{{"callsign", "BAW123"}}, {{"callsign", "BAW456"}}});
+
+            this->ExpectApiRequest()
+                ->Post()
+                .To("stand/assignment/requestauto/bulk")
+                .WithBody(nlohmann::json{{"assignments", items}})
+                .WillReturnNotFound();
+
+            EXPECT_FALSE(this->handler.PerformBulkRequest(items).has_value());
+        }
+
+        TEST_F(StandEventHandlerTest, BulkRequestThrowsOnFailure)
+        {
+            nlohmann::json items = nlohmann::json::array({{{"callsign", "BAW123"}}, {{"callsign", "BAW456"}}});
+
+            this->ExpectApiRequest()
+                ->Post()
+                .To("stand/assignment/requestauto/bulk")
+                .WithBody(nlohmann::json{{"assignments", items}})
+                .WillReturnServerError();
+
+            EXPECT_THROW(static_cast<void>(this->handler.PerformBulkRequest(items)), std::runtime_error);
+        }
+
+        TEST_F(StandEventHandlerTest, BulkResultAssignsStand)
+        {
+            this->handler.ProcessBulkResult("BAW123", {{"stand_id", 2}});
+            EXPECT_EQ(2, this->handler.GetAssignedStandForCallsign("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, BulkResultIgnoresUnknownStand)
+        {
+            this->handler.ProcessBulkResult("BAW123", {{"stand_id", 55}});
+            EXPECT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, AbandoningRequestLeavesAssignmentsUnchanged)
+        {
+            this->handler.ProcessBulkResult("BAW123", {{"stand_id", 2}});
+            this->handler.AbandonRequest("BAW123");
+            this->handler.AbandonRequest("BAW456");
+            EXPECT_EQ(2, this->handler.GetAssignedStandForCallsign("BAW123"));
+            EXPECT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("BAW456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItemRequestAssignsStand)
+        {
+            nlohmann::json item = {{"callsign", "BAW123"}, {"assignment_type", "arrival"}};
+            this->ExpectApiRequest()
+                ->Post()
+                .To("stand/assignment/requestauto")
+                .WithBody(item)
+                .WillReturnCreated()
+                .WithResponseBody(nlohmann::json{{"stand_id", 3}});
+
+            this->handler.PerformItemRequest("BAW123", item);
+            EXPECT_EQ(3, this->handler.GetAssignedStandForCallsign("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItSavesStandAssignmentsAsState)
+        {
+            this->handler.SetAssignedStand("BAW123", 1);
+            this->handler.SetAssignedStand("VIR245", 2);
+            EXPECT_EQ(nlohmann::json({{"BAW123", 1}, {"VIR245", 2}}), this->handler.SaveState());
+        }
+
+        TEST_F(StandEventHandlerTest, ItRestoresStandAssignmentsFromState)
+        {
+            this->handler.RestoreState({{"BAW123", 1}, {"VIR245", 2}});
+            EXPECT_EQ(1, this->handler.GetAssignedStandForCallsign("BAW123"));
+            EXPECT_EQ(2, this->handler.GetAssignedStandForCallsign("VIR245"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntRestoreInvalidStandAssignmentsFromState)
+        {
+            this->handler.RestoreState({{"BAW123", 55}, {"VIR245", "2"}});
+            EXPECT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("BAW123"));
+            EXPECT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("VIR245"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItExpiresRestoredStandAssignments)
+        {
+            this->handler.RestoreState({{"BAW123", 1}, {"VIR245", 2}});
+            this->handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ(this->handler.noStandAssigned, this->handler.GetAssignedStandForCallsign("BAW123"));
+            EXPECT_EQ(2, this->handler.GetAssignedStandForCallsign("VIR245"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntExpireRestoredStandAssignmentsThatHaveSinceChanged)
+        {
+            this->handler.RestoreState({{"BAW123", 1}});
+            this->handler.SetAssignedStand("BAW123", 3);
+            this->handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ(3, this->handler.GetAssignedStandForCallsign("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntExpireRestoredStandAssignmentsConfirmedByTheApi)
+        {
+            nlohmann::json assignments = nlohmann::json::array();
+            assignments.push_back({
+                {"callsign", "BAW123"},
+                {"stand_id", 1},
+            });
+            EXPECT_CALL(this->api, GetAssignedStands()).Times(1).WillOnce(Return(assignments));
+
+            this->handler.RestoreState({{"BAW123", 1}});
+            this->handler.PluginEventsSynced();
+            this->handler.ExpireRestoredState("BAW123");
+            EXPECT_EQ(1, this->handler.GetAssignedStandForCallsign("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItRecordsTheStandAnAircraftIsOn)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            EXPECT_EQ(2, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItRecordsTheStandAnAircraftIsOnAtItsDestination)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.19, 0, "EGLL", "EGKK");
+            EXPECT_EQ(1, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntRecordMovingAircraftAsBeingOnAStand)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18, 15);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntRecordAircraftAwayFromStandsAsBeingOnAStand)
+        {
+            this->PositionAircraft("EZY456", 51.16, -0.18);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntRecordAircraftWithoutFlightplansAsBeingOnAStand)
+        {
+            NiceMock<MockEuroScopeCRadarTargetInterface> aircraftRadarTarget;
+            ON_CALL(aircraftRadarTarget, GetCallsign()).WillByDefault(Return("EZY456"));
+            EXPECT_CALL(aircraftRadarTarget, GetPosition()).Times(0);
+
+            this->handler.RadarTargetPositionUpdateEvent(aircraftRadarTarget);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntLookUpFlightplansOnPositionUpdates)
+        {
+            EXPECT_CALL(this->plugin, GetFlightplanForCallsign(_)).Times(0);
+
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            EXPECT_EQ(2, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntCheckPositionsOfAircraftAtAirfieldsWithoutStands)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> aircraftFlightplan;
+            ON_CALL(aircraftFlightplan, GetCallsign()).WillByDefault(Return("EZY456"));
+            ON_CALL(aircraftFlightplan, GetOrigin()).WillByDefault(Return("EGLL"));
+            ON_CALL(aircraftFlightplan, GetDestination()).WillByDefault(Return("EGPH"));
+            NiceMock<MockEuroScopeCRadarTargetInterface> aircraftRadarTarget;
+            ON_CALL(aircraftRadarTarget, GetCallsign()).WillByDefault(Return("EZY456"));
+            EXPECT_CALL(aircraftRadarTarget, GetGroundSpeed()).Times(0);
+            EXPECT_CALL(aircraftRadarTarget, GetPosition()).Times(0);
+
+            this->handler.FlightPlanEvent(aircraftFlightplan, aircraftRadarTarget);
+            this->handler.RadarTargetPositionUpdateEvent(aircraftRadarTarget);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItRemovesAircraftFromStandsWhenTheirFlightplanMovesToAirfieldsWithoutStands)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->PositionAircraft("EZY456", 51.15, -0.18, 0, "EGLL", "EGPH");
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItRemovesAircraftFromStandsWhenTheyMoveOff)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->PositionAircraft("EZY456", 51.15, -0.18, 15);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItRemovesAircraftFromStandsWhenTheyDisconnect)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            ON_CALL(this->flightplan, GetCallsign()).WillByDefault(Return("EZY456"));
+            this->handler.FlightPlanDisconnectEvent(this->flightplan);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItForgetsTheAirfieldsOfAircraftThatDisconnect)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            ON_CALL(this->flightplan, GetCallsign()).WillByDefault(Return("EZY456"));
+            this->handler.FlightPlanDisconnectEvent(this->flightplan);
+
+            EuroScopePlugIn::CPosition position;
+            position.m_Latitude = 51.15;
+            position.m_Longitude = -0.18;
+            NiceMock<MockEuroScopeCRadarTargetInterface> aircraftRadarTarget;
+            ON_CALL(aircraftRadarTarget, GetCallsign()).WillByDefault(Return("EZY456"));
+            ON_CALL(aircraftRadarTarget, GetPosition()).WillByDefault(Return(position));
+
+            this->handler.RadarTargetPositionUpdateEvent(aircraftRadarTarget);
+            EXPECT_EQ(StandIndex::noStand, this->handler.GetOccupiedStand("EZY456"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItRaisesAConflictWhenAnOccupiedStandIsAssigned)
+        {
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->AssignStandFromWebsocket("BAW123", 2);
+
+            EXPECT_TRUE(this->handler.HasStandConflict("BAW123"));
+            AssertSingleEventDispatched();
+            AssertFirstEventDispatched<StandOccupancyConflictEvent>([](const StandOccupancyConflictEvent& event) {
+                EXPECT_EQ("BAW123", event.callsign);
+                EXPECT_EQ(2, event.standId);
+                EXPECT_EQ("EZY456", event.occupiedBy);
+            });
+        }
+
+        TEST_F(StandEventHandlerTest, ItRaisesAConflictWhenAnAircraftParksOnAnAssignedStand)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+
+            EXPECT_TRUE(this->handler.HasStandConflict("BAW123"));
+            AssertSingleEventDispatched();
+            AssertFirstEventDispatched<StandOccupancyConflictEvent>([](const StandOccupancyConflictEvent& event) {
+                EXPECT_EQ("BAW123", event.callsign);
+                EXPECT_EQ(2, event.standId);
+                EXPECT_EQ("EZY456", event.occupiedBy);
+            });
+        }
+
+        TEST_F(StandEventHandlerTest, ItOnlyRaisesAConflictOnce)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->AssignStandFromWebsocket("BAW123", 2);
+
+            AssertSingleEventDispatched();
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntRaiseAConflictIfTheAircraftIsOnItsOwnStand)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("BAW123", 51.15, -0.18);
+
+            EXPECT_FALSE(this->handler.HasStandConflict("BAW123"));
+            AssertNoEventsDispatched();
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntRaiseAConflictIfTheAircraftIsOnAnotherStand)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.19);
+
+            EXPECT_FALSE(this->handler.HasStandConflict("BAW123"));
+            AssertNoEventsDispatched();
+        }
+
+        TEST_F(StandEventHandlerTest, ItClearsTheConflictWhenTheOccupierLeaves)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->PositionAircraft("EZY456", 51.15, -0.18, 15);
+
+            EXPECT_FALSE(this->handler.HasStandConflict("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItClearsTheConflictWhenTheStandIsUnassigned)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->handler.ProcessPushEvent(
+                {"App\\Events\\StandUnassignedEvent",
+                 "private-stand-assignments",
+                 nlohmann::json{{"callsign", "BAW123"}},
+                 ""});
+
+            EXPECT_FALSE(this->handler.HasStandConflict("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItClearsTheConflictWhenAnotherStandIsAssigned)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->AssignStandFromWebsocket("BAW123", 1);
+
+            EXPECT_FALSE(this->handler.HasStandConflict("BAW123"));
+        }
+
+        TEST_F(StandEventHandlerTest, ItColoursTheTagItemIfThereIsAConflict)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->PositionAircraft("EZY456", 51.15, -0.18);
+            this->handler.SetTagItemData(this->tagData);
+
+            EXPECT_EQ("55", this->tagData.GetItemString());
+            EXPECT_EQ(RGB(255, 153, 0), this->tagData.GetTagColour());
+        }
+
+        TEST_F(StandEventHandlerTest, ItDoesntColourTheTagItemIfThereIsNoConflict)
+        {
+            this->AssignStandFromWebsocket("BAW123", 2);
+            this->handler.SetTagItemData(this->tagData);
+
+            EXPECT_EQ("55", this->tagData.GetItemString());
+            EXPECT_EQ(RGB(255, 255, 255), this->tagData.GetTagColour());
+        }
     } // namespace Stands
 } // namespace UKControllerPluginTest
@@ -0,0 +1,325 @@
+#include "helper/Benchmark.h"
+#include "stands/StandIndex.h"
+
+using testing::ElementsAre;
+using testing::Test;
+using UKControllerPlugin::Stands::CompareStands;
+using UKControllerPlugin::Stands::Stand;
+using UKControllerPlugin::Stands::StandIndex;
+using UKControllerPluginTest::RunBenchmark;
+
+namespace UKControllerPluginTest::Stands {
+
+    class StandIndexTest : public Test
+    {
+        public:
+        StandIndexTest() : index(GetStands())
+        {
+        }
+
+        /*
+            Returns the latitude and longitude the given number of metres north and east of the airfield.
+        */
+        static auto Offset(double north, double east) -> std::pair<double, double>
+        {
+            const double metresPerDegree = 111319.49;
+            return {
+                originLatitude + north / metresPerDegree,
+                originLongitude + east / (metresPerDegree * std::cos(originLatitude * 3.14159265358979323846 / 180))};
+        }
+
+        static auto MakeStand(int id, std::string airfield, std::string identifier, double north, double east)
+            -> Stand
+        {
+            const auto [latitude, longitude] = Offset(north, east);
+            return {id, std::move(airfield), std::move(identifier), latitude, longitude, true};
+        }
+
+        /*
+            A row of stands 60m apart at Gatwick, either side of the origin so that we cross grid cells
+            in both directions, plus one with no known position. Heathrow is somewhere else entirely.
+        */
+        static auto GetStands() -> std::set<Stand, CompareStands>
+        {
+            std::set<Stand, CompareStands> stands;
+            stands.insert(MakeStand(1, "EGKK", "1", 0, 0));
+            stands.insert(MakeStand(2, "EGKK", "2", 0, 60));
+            stands.insert(MakeStand(3, "EGKK", "3", 0, 120));
+            stands.insert(MakeStand(4, "EGKK", "4", 0, -60));
+            stands.insert(MakeStand(5, "EGKK", "5", -60, -60));
+            stands.insert({6, "EGKK", "6"});
+            stands.insert(MakeStand(7, "EGLL", "7", 0, 0));
+            return stands;
+        }
+
+        inline static const double originLatitude = 51.15;
+        inline static const double originLongitude = -0.19;
+        StandIndex index;
+    };
+
+    TEST_F(StandIndexTest, ItReturnsStandsAtAnAirfieldInIdOrder)
+    {
+        std::vector<int> ids;
+        for (const auto& stand : index.StandsAtAirfield("EGKK")) {
+            ids.push_back(stand.id);
+        }
+
+        EXPECT_THAT(ids, ElementsAre(1, 2, 3, 4, 5, 6));
+    }
+
+    TEST_F(StandIndexTest, ItReturnsNoStandsForUnknownAirfield)
+    {
+        EXPECT_TRUE(index.StandsAtAirfield("EGBB").empty());
+    }
+
+    TEST_F(StandIndexTest, ItKnowsWhichAirfieldsHavePositionedStands)
+    {
+        std::set<Stand, CompareStands> stands;
+        stands.insert({8, "EGPH", "8"});
+        const StandIndex unpositioned(stands);
+
+        EXPECT_TRUE(index.HasPositionedStands("EGKK"));
+        EXPECT_FALSE(index.HasPositionedStands("EGBB"));
+        EXPECT_FALSE(unpositioned.HasPositionedStands("EGPH"));
+    }
+
+    TEST_F(StandIndexTest, ItFindsStandsByIdentifier)
+    {
+        const auto* stand = index.FindStand("EGKK", "3");
+        ASSERT_NE(nullptr, stand);
+        EXPECT_EQ(3, stand->id);
+    }
+
+    TEST_F(StandIndexTest, ItDoesntFindStandsAtTheWrongAirfield)
+    {
+        EXPECT_EQ(nullptr, index.FindStand("EGLL", "3"));
+    }
+
+    TEST_F(StandIndexTest, ItDoesntFindUnknownStands)
+    {
+        EXPECT_EQ(nullptr, index.FindStand("EGKK", "55"));
+        EXPECT_EQ(nullptr, index.FindStand("EGBB", "1"));
+    }
+
+    TEST_F(StandIndexTest, ItFindsTheStandAtAPosition)
+    {
+        const auto [latitude, longitude] = Offset(0, 60);
+        const auto* stand = index.StandAtPosition("EGKK", latitude, longitude);
+        ASSERT_NE(nullptr, stand);
+        EXPECT_EQ(2, stand->id);
+    }
+
+    TEST_F(StandIndexTest, ItFindsTheStandAtAPositionNearby)
+    {
+        const auto [latitude, longitude] = Offset(15, -75);
+        const auto* stand = index.StandAtPosition("EGKK", latitude, longitude);
+        ASSERT_NE(nullptr, stand);
+        EXPECT_EQ(4, stand->id);
+    }
+
+    TEST_F(StandIndexTest, ItFindsTheClosestStandAtAPosition)
+    {
+        std::set<Stand, CompareStands> stands;
+        stands.insert(MakeStand(1, "EGKK", "1", 0, 0));
+        stands.insert(MakeStand(2, "EGKK", "2", 0, 40));
+        StandIndex closeIndex(stands);
+
+        const auto [latitude, longitude] = Offset(0, 25);
+        const auto* stand = closeIndex.StandAtPosition("EGKK", latitude, longitude);
+        ASSERT_NE(nullptr, stand);
+        EXPECT_EQ(2, stand->id);
+    }
+
+    TEST_F(StandIndexTest, ItFindsNoStandIfTooFarAway)
+    {
+        const auto [latitude, longitude] = Offset(0, 160);
+        EXPECT_EQ(nullptr, index.StandAtPosition("EGKK", latitude, longitude));
+    }
+
+    TEST_F(StandIndexTest, ItFindsNoStandIfPositionIsAtAnotherAirfield)
+    {
+        EXPECT_EQ(nullptr, index.StandAtPosition("EGKK", 51.4775, -0.4614));
+    }
+
+    TEST_F(StandIndexTest, ItFindsNoStandAtUnknownAirfield)
+    {
+        EXPECT_EQ(nullptr, index.StandAtPosition("EGBB", originLatitude, originLongitude));
+    }
+
+    TEST_F(StandIndexTest, ItReturnsStandsWithinRange)
+    {
+        const auto [latitude, longitude] = Offset(0, 0);
+        EXPECT_THAT(index.StandsWithin("EGKK", latitude, longitude, 90), ElementsAre(1, 2, 4, 5));
+    }
+
+    TEST_F(StandIndexTest, ItReturnsStandsWithinALargeRange)
+    {
+        const auto [latitude, longitude] = Offset(0, 0);
+        EXPECT_THAT(index.StandsWithin("EGKK", latitude, longitude, 50000), ElementsAre(1, 2, 3, 4, 5));
+    }
+
+    TEST_F(StandIndexTest, ItReturnsNoStandsWithinRangeAtUnknownAirfield)
+    {
+        EXPECT_TRUE(index.StandsWithin("EGBB", originLatitude, originLongitude, 1000).empty());
+    }
+
+    TEST_F(StandIndexTest, ItMatchesALinearScanForStandsWithinRange)
+    {
+        std::mt19937 random(42); // NOLINT
+        std::uniform_real_distribution<double> offset(-500, 500);
+        std::set<Stand, CompareStands> stands;
+        std::vector<std::pair<double, double>> offsets;
+        for (int i = 0; i < 300; i++) {
+            offsets.emplace_back(offset(random), offset(random));
+            stands.insert(MakeStand(i, "EGKK", std::to_string(i), offsets.back().first, offsets.back().second));
+        }
+        StandIndex randomIndex(stands);
+
+        for (int i = 0; i < 50; i++) {
+            const auto north = offset(random);
+            const auto east = offset(random);
+            const auto [latitude, longitude] = Offset(north, east);
+
+            // Allow a little leeway at the edge of the range, the index projects around a different point
+            const auto result = randomIndex.StandsWithin("EGKK", latitude, longitude, 120);
+            for (int j = 0; j < 300; j++) {
+                const auto distance = std::hypot(offsets[j].first - north, offsets[j].second - east);
+                const auto returned = std::find(result.cbegin(), result.cend(), j) != result.cend();
+                if (distance < 119.5) {
+                    EXPECT_TRUE(returned);
+                } else if (distance > 120.5) {
+                    EXPECT_FALSE(returned);
+                }
+            }
+        }
+    }
+
+    TEST_F(StandIndexTest, ItStartsWithNoOccupiedStands)
+    {
+        EXPECT_EQ(0, index.CountOccupiedStands());
+        EXPECT_EQ("", index.GetOccupant(1));
+        EXPECT_EQ(StandIndex::noStand, index.GetOccupiedStand("BAW123"));
+    }
+
+    TEST_F(StandIndexTest, ItSetsTheOccupantOfAStand)
+    {
+        EXPECT_TRUE(index.SetOccupant("BAW123", 1));
+        EXPECT_EQ(1, index.CountOccupiedStands());
+        EXPECT_EQ("BAW123", index.GetOccupant(1));
+        EXPECT_EQ(1, index.GetOccupiedStand("BAW123"));
+    }
+
+    TEST_F(StandIndexTest, SettingTheSameOccupantIsNotAChange)
+    {
+        index.SetOccupant("BAW123", 1);
+        EXPECT_FALSE(index.SetOccupant("BAW123", 1));
+    }
+
+    TEST_F(StandIndexTest, ItMovesOccupantsBetweenStands)
+    {
+        index.SetOccupant("BAW123", 1);
+        EXPECT_TRUE(index.SetOccupant("BAW123", 2));
+        EXPECT_EQ(1, index.CountOccupiedStands());
+        EXPECT_EQ("", index.GetOccupant(1));
+        EXPECT_EQ("BAW123", index.GetOccupant(2));
+    }
+
+    TEST_F(StandIndexTest, ANewOccupantReplacesTheOldOne)
+    {
+        index.SetOccupant("BAW123", 1);
+        index.SetOccupant("EZY456", 1);
+        EXPECT_EQ(1, index.CountOccupiedStands());
+        EXPECT_EQ("EZY456", index.GetOccupant(1));
+        EXPECT_EQ(StandIndex::noStand, index.GetOccupiedStand("BAW123"));
+    }
+
+    TEST_F(StandIndexTest, ItRemovesOccupants)
+    {
+        index.SetOccupant("BAW123", 1);
+        EXPECT_EQ(1, index.RemoveOccupant("BAW123"));
+        EXPECT_EQ(0, index.CountOccupiedStands());
+        EXPECT_EQ("", index.GetOccupant(1));
+    }
+
+    TEST_F(StandIndexTest, RemovingAnAircraftNotOnAStandReturnsNoStand)
+    {
+        EXPECT_EQ(StandIndex::noStand, index.RemoveOccupant("BAW123"));
+    }
+
+    TEST_F(StandIndexTest, ItReturnsOccupiedStandsWithinRange)
+    {
+        index.SetOccupant("BAW123", 2);
+        index.SetOccupant("EZY456", 3);
+        index.SetOccupant("VIR789", 5);
+        index.SetOccupant("BAW999", 7);
+
+        const auto [latitude, longitude] = Offset(0, 0);
+        EXPECT_THAT(index.OccupiedStandsWithin("EGKK", latitude, longitude, 90), ElementsAre(2, 5));
+    }
+
+    TEST_F(StandIndexTest, ItReturnsNoOccupiedStandsIfNoneOccupied)
+    {
+        const auto [latitude, longitude] = Offset(0, 0);
+        EXPECT_TRUE(index.OccupiedStandsWithin("EGKK", latitude, longitude, 1000).empty());
+    }
+
+    TEST_F(StandIndexTest, DISABLED_BenchmarkStandLookupAgainstLinearScan)
+    {
+        // 50 airfields, each with 400 stands in rows 50m apart
+        std::set<Stand, CompareStands> stands;
+        int id = 0;
+        for (int airfield = 0; airfield < 50; airfield++) {
+            for (int stand = 0; stand < 400; stand++) {
+                stands.insert(MakeStand(
+                    id++,
+                    "EG" + std::to_string(airfield),
+                    std::to_string(stand),
+                    (stand / 20) * 50, // NOLINT
+                    (stand % 20) * 50  // NOLINT
+                    ));
+            }
+        }
+        StandIndex benchmarkIndex(stands);
+        const auto position = Offset(510, 310);
+        const auto latitude = position.first;
+        const auto longitude = position.second;
+
+        // The linear scan that StandEventHandler previously used to find stands by identifier
+        int found = 0;
+        RunBenchmark("Find stand by identifier (linear scan)", 10000, [&stands, &found] {
+            const auto stand = std::find_if(stands.cbegin(), stands.cend(), [](const Stand& stand) -> bool {
+                return stand.identifier == "255" && stand.airfieldCode == "EG42";
+            });
+            found += stand != stands.cend() ? 1 : 0;
+        });
+        RunBenchmark("Find stand by identifier (index)", 10000, [&benchmarkIndex, &found] {
+            found += benchmarkIndex.FindStand("EG42", "255") != nullptr ? 1 : 0;
+        });
+
+        // Finding the stand an aircraft is on by checking the distance to every stand at the airfield
+        RunBenchmark("Find stand at position (linear scan)", 10000, [&stands, &found, latitude, longitude] {
+            const Stand* closest = nullptr;
+            double closestDistance = StandIndex::standRadius;
+            for (const auto& stand : stands) {
+                if (stand.airfieldCode != "EG42") {
+                    continue;
+                }
+
+                const auto north = (stand.latitude - latitude) * 111319.49;
+                const auto east = (stand.longitude - longitude) * 111319.49 *
+                                  std::cos(originLatitude * 3.14159265358979323846 / 180);
+                const auto distance = std::hypot(north, east);
+                if (distance <= closestDistance) {
+                    closest = &stand;
+                    closestDistance = distance;
+                }
+            }
+            found += closest != nullptr ? 1 : 0;
+        });
+        RunBenchmark("Find stand at position (index)", 10000, [&benchmarkIndex, &found, latitude, longitude] {
+            found += benchmarkIndex.StandAtPosition("EG42", latitude, longitude) != nullptr ? 1 : 0;
+        });
+
+        EXPECT_EQ(40004, found);
+    }
+} // namespace UKControllerPluginTest::Stands
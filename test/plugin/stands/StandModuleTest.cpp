@@ -1,5 +1,6 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "controller/HandoffEventHandlerCollection.h"
+#include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "integration/ExternalMessageEventHandler.h"
 #include "integration/InboundIntegrationMessageHandler.h"
@@ -10,12 +11,14 @@
 #include "push/PushEventProcessorCollection.h"
 #include "stands/StandModule.h"
 #include "tag/TagItemCollection.h"
+#include "timedevent/TimedEventCollection.h"
 
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::Test;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Controller::HandoffEventHandlerCollection;
+using UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::Integration::ExternalMessageEventHandler;
 using UKControllerPlugin::Integration::InboundIntegrationMessageHandler;
@@ -24,6 +27,7 @@ using UKControllerPlugin::Plugin::FunctionCallEventHandler;
 using UKControllerPlugin::Push::PushEventProcessorCollection;
 using UKControllerPlugin::Stands::BootstrapPlugin;
 using UKControllerPlugin::Tag::TagItemCollection;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
 using UKControllerPluginTest::Dependency::MockDependencyLoader;
 
 namespace UKControllerPluginTest::Stands {
@@ -36,6 +40,7 @@ namespace UKControllerPluginTest::Stands {
             container.pushEventProcessors = std::make_shared<PushEventProcessorCollection>();
             container.tagHandler = std::make_unique<TagItemCollection>();
             container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.radarTargetHandler = std::make_unique<RadarTargetEventHandlerCollection>();
             container.pluginFunctionHandlers = std::make_unique<FunctionCallEventHandler>();
             container.externalEventHandler = std::make_shared<ExternalMessageEventHandler>(true);
             container.integrationModuleContainer =
@@ -44,6 +49,7 @@ namespace UKControllerPluginTest::Stands {
                 std::make_shared<InboundIntegrationMessageHandler>(nullptr);
             container.airfieldOwnership =
                 std::make_shared<UKControllerPlugin::Ownership::AirfieldServiceProviderCollection>();
+            container.timedHandler = std::make_unique<TimedEventCollection>();
 
             nlohmann::json gatwick = nlohmann::json::array();
             gatwick.push_back({
@@ -88,6 +94,12 @@ namespace UKControllerPluginTest::Stands {
         EXPECT_EQ(1, this->container.flightplanHandler->CountHandlers());
     }
 
+    TEST_F(StandModuleTest, ItRegistersForRadarTargetEvents)
+    {
+        BootstrapPlugin(this->container, this->dependencyLoader);
+        EXPECT_EQ(1, this->container.radarTargetHandler->CountHandlers());
+    }
+
     TEST_F(StandModuleTest, ItRegistersTheStandAssignmentPopupMenuFunction)
     {
         BootstrapPlugin(this->container, this->dependencyLoader);
@@ -114,4 +126,10 @@ namespace UKControllerPluginTest::Stands {
         BootstrapPlugin(this->container, this->dependencyLoader);
         EXPECT_EQ(2, container.integrationModuleContainer->inboundMessageHandler->CountProcessors());
     }
+
+    TEST_F(StandModuleTest, ItRegistersTheStandRequestCoalescerForTimedEvents)
+    {
+        BootstrapPlugin(this->container, this->dependencyLoader);
+        EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(1));
+    }
 } // namespace UKControllerPluginTest::Stands
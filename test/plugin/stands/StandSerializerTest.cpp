@@ -191,6 +191,51 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(3, stands.find(3)->id);
             EXPECT_EQ("EGLL", stands.find(3)->airfieldCode);
             EXPECT_EQ("76R", stands.find(3)->identifier);
+            EXPECT_FALSE(stands.find(3)->hasPosition);
+        }
+
+        TEST_F(StandSerializerTest, DependencyValidReturnsTrueIfPositionNull)
+        {
+            nlohmann::json gatwick = nlohmann::json::array();
+            gatwick.push_back({{"id", 1}, {"identifier", "31R"}, {"latitude", nullptr}, {"longitude", nullptr}});
+            nlohmann::json dependency = {{"EGKK", gatwick}};
+
+            EXPECT_TRUE(DependencyValid(dependency));
+        }
+
+        TEST_F(StandSerializerTest, DependencyValidReturnsFalseIfLatitudeInvalid)
+        {
+            nlohmann::json gatwick = nlohmann::json::array();
+            gatwick.push_back({{"id", 1}, {"identifier", "31R"}, {"latitude", "abc"}, {"longitude", -0.19}});
+            nlohmann::json dependency = {{"EGKK", gatwick}};
+
+            EXPECT_FALSE(DependencyValid(dependency));
+        }
+
+        TEST_F(StandSerializerTest, DependencyValidReturnsFalseIfLongitudeInvalid)
+        {
+            nlohmann::json gatwick = nlohmann::json::array();
+            gatwick.push_back({{"id", 1}, {"identifier", "31R"}, {"latitude", 51.15}, {"longitude", "abc"}});
+            nlohmann::json dependency = {{"EGKK", gatwick}};
+
+            EXPECT_FALSE(DependencyValid(dependency));
+        }
+
+        TEST_F(StandSerializerTest, FromJsonLoadsStandPositions)
+        {
+            nlohmann::json gatwick = nlohmann::json::array();
+            gatwick.push_back({{"id", 1}, {"identifier", "31R"}, {"latitude", 51.15}, {"longitude", -0.19}});
+            gatwick.push_back({{"id", 2}, {"identifier", "35"}, {"latitude", nullptr}, {"longitude", nullptr}});
+            nlohmann::json dependency = {{"EGKK", gatwick}};
+
+            std::set<Stand, CompareStands> stands;
+            from_json(dependency, stands);
+
+            EXPECT_EQ(2, stands.size());
+            EXPECT_TRUE(stands.find(1)->hasPosition);
+            EXPECT_DOUBLE_EQ(51.15, stands.find(1)->latitude);
+            EXPECT_DOUBLE_EQ(-0.19, stands.find(1)->longitude);
+            EXPECT_FALSE(stands.find(2)->hasPosition);
         }
     } // namespace Stands
 } // namespace UKControllerPluginTest
@@ -0,0 +1,339 @@
+#include "state/PersistentStateInterface.h"
+#include "state/PluginStateSnapshot.h"
+#include "state/StateJournal.h"
+#include "time/SystemClock.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::Test;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPlugin::State::PersistentStateInterface;
+using UKControllerPlugin::State::PluginStateSnapshot;
+using UKControllerPlugin::State::StateJournal;
+using UKControllerPlugin::Time::SetTestNow;
+using UKControllerPlugin::Time::TimeNow;
+
+namespace UKControllerPluginTest::State {
+
+    class TestPersistentState : public PersistentStateInterface
+    {
+        public:
+        [[nodiscard]] auto SaveState() const -> nlohmann::json override
+        {
+            return state;
+        }
+
+        void RestoreState(const nlohmann::json& restored) override
+        {
+            state = restored;
+            timesRestored++;
+        }
+
+        void ExpireRestoredState(const std::string& callsign) override
+        {
+            expired.insert(callsign);
+        }
+
+        nlohmann::json state = nlohmann::json::object();
+        int timesRestored = 0;
+        std::set<std::string> expired;
+    };
+
+    class PluginStateSnapshotTest : public Test
+    {
+        public:
+        PluginStateSnapshotTest()
+            : stands(std::make_shared<TestPersistentState>()), holds(std::make_shared<TestPersistentState>()),
+              snapshot(
+                  std::make_unique<StateJournal>(windows, L"snapshot.json", L"journal.jsonl"),
+                  [this](const std::function<void(void)>& task) { backgroundTasks.push_back(task); })
+        {
+            SetTestNow(std::chrono::system_clock::time_point(std::chrono::seconds(1000)));
+
+            // Keep the files in memory
+            ON_CALL(windows, FileExists(_)).WillByDefault([this](const std::wstring& file) {
+                return files.contains(file);
+            });
+            ON_CALL(windows, ReadFromFileMock(_, _)).WillByDefault([this](const std::wstring& file, bool) {
+                return files.at(file);
+            });
+            ON_CALL(windows, WriteToFile(_, _, _, _))
+                .WillByDefault([this](const std::wstring& file, const std::string& data, bool truncate, bool) {
+                    files[file] = truncate ? data : files[file] + data;
+                });
+            ON_CALL(windows, MoveFileToNewLocation(_, _))
+                .WillByDefault([this](const std::wstring& from, const std::wstring& to) {
+                    files[to] = files.at(from);
+                    files.erase(from);
+                    return true;
+                });
+
+            snapshot.RegisterState("stands", stands);
+            snapshot.RegisterState("holds", holds);
+        }
+
+        [[nodiscard]] auto JournalLines() const -> std::vector<nlohmann::json>
+        {
+            std::vector<nlohmann::json> lines;
+            std::istringstream journal(files.at(L"journal.jsonl"));
+            std::string line;
+            while (std::getline(journal, line)) {
+                lines.push_back(nlohmann::json::parse(line));
+            }
+
+            return lines;
+        }
+
+        void Trigger()
+        {
+            snapshot.TimedEventTrigger();
+            RunBackgroundTasks();
+        }
+
+        void RunBackgroundTasks()
+        {
+            const auto tasks = std::move(backgroundTasks);
+            backgroundTasks.clear();
+            for (const auto& task : tasks) {
+                task();
+            }
+        }
+
+        void SaveOldState(std::chrono::seconds age)
+        {
+            SetTestNow(TimeNow() - age);
+            StateJournal(windows, L"snapshot.json", L"journal.jsonl")
+                .Compact({{"stands", {{"BAW123", 1}}}, {"holds", {{"BAW123", "TIMBA"}}}});
+            SetTestNow(TimeNow() + age);
+        }
+
+        std::map<std::wstring, std::string> files;
+        std::vector<std::function<void(void)>> backgroundTasks;
+        NiceMock<Windows::MockWinApi> windows;
+        std::shared_ptr<TestPersistentState> stands;
+        std::shared_ptr<TestPersistentState> holds;
+        PluginStateSnapshot snapshot;
+    };
+
+    TEST_F(PluginStateSnapshotTest, ItRegistersState)
+    {
+        EXPECT_EQ(2, snapshot.CountStates());
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItDoesntRegisterDuplicateState)
+    {
+        snapshot.RegisterState("stands", std::make_shared<TestPersistentState>());
+        EXPECT_EQ(2, snapshot.CountStates());
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItRestoresRecentState)
+    {
+        SaveOldState(std::chrono::minutes(9));
+
+        EXPECT_TRUE(snapshot.Restore());
+        EXPECT_EQ(nlohmann::json({{"BAW123", 1}}), stands->state);
+        EXPECT_EQ(nlohmann::json({{"BAW123", "TIMBA"}}), holds->state);
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItDoesntRestoreOldState)
+    {
+        SaveOldState(std::chrono::minutes(11));
+
+        EXPECT_FALSE(snapshot.Restore());
+        EXPECT_EQ(0, stands->timesRestored);
+        EXPECT_EQ(0, holds->timesRestored);
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItDoesntRestoreIfThereIsNoSavedState)
+    {
+        EXPECT_FALSE(snapshot.Restore());
+        EXPECT_EQ(0, stands->timesRestored);
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItTakesASnapshotAfterRestoring)
+    {
+        SaveOldState(std::chrono::minutes(11));
+        stands->state = {{"BAW456", 2}};
+
+        static_cast<void>(snapshot.Restore());
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(nlohmann::json({{"BAW456", 2}}), saved->state.at("stands"));
+        EXPECT_EQ(TimeNow(), saved->savedAt);
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItTakesASnapshotOnFirstTrigger)
+    {
+        stands->state = {{"BAW456", 2}};
+        Trigger();
+
+        EXPECT_TRUE(files.contains(L"snapshot.json"));
+        EXPECT_EQ("", files.at(L"journal.jsonl"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItJournalsOnlyWhatHasChanged)
+    {
+        stands->state = {{"BAW123", 1}, {"BAW456", 2}};
+        holds->state = {{"BAW123", "TIMBA"}};
+        static_cast<void>(snapshot.Restore());
+
+        stands->state = {{"BAW123", 3}, {"BAW789", 4}};
+        Trigger();
+
+        const auto lines = JournalLines();
+        ASSERT_EQ(1, lines.size());
+        nlohmann::json expected{{"stands", {{"BAW123", 3}, {"BAW456", nullptr}, {"BAW789", 4}}}};
+        EXPECT_EQ(expected, lines[0].at("changes"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItJournalsChangesRelativeToTheLastSave)
+    {
+        static_cast<void>(snapshot.Restore());
+        stands->state = {{"BAW123", 1}};
+        Trigger();
+        holds->state = {{"BAW123", "TIMBA"}};
+        Trigger();
+
+        const auto lines = JournalLines();
+        ASSERT_EQ(2, lines.size());
+        EXPECT_EQ(nlohmann::json({{"holds", {{"BAW123", "TIMBA"}}}}), lines[1].at("changes"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItDoesntJournalIfNothingHasChangedRecently)
+    {
+        static_cast<void>(snapshot.Restore());
+        SetTestNow(TimeNow() + std::chrono::seconds(59));
+        Trigger();
+
+        EXPECT_EQ("", files.at(L"journal.jsonl"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItJournalsThatNothingHasChangedPeriodically)
+    {
+        static_cast<void>(snapshot.Restore());
+        SetTestNow(TimeNow() + std::chrono::seconds(60));
+        Trigger();
+
+        const auto lines = JournalLines();
+        ASSERT_EQ(1, lines.size());
+        EXPECT_EQ(nlohmann::json::object(), lines[0].at("changes"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItCompactsTheJournalPeriodically)
+    {
+        static_cast<void>(snapshot.Restore());
+        for (int i = 0; i < PluginStateSnapshot::compactAfterEntries; i++) {
+            stands->state = {{"BAW123", i}};
+            Trigger();
+        }
+        EXPECT_EQ(PluginStateSnapshot::compactAfterEntries, JournalLines().size());
+
+        stands->state = {{"BAW123", 999}};
+        Trigger();
+
+        EXPECT_EQ("", files.at(L"journal.jsonl"));
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(999, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItKeepsJournalingIfCompactionFails)
+    {
+        static_cast<void>(snapshot.Restore());
+        for (int i = 0; i < PluginStateSnapshot::compactAfterEntries; i++) {
+            stands->state = {{"BAW123", i}};
+            Trigger();
+        }
+
+        EXPECT_CALL(windows, MoveFileToNewLocation(_, _)).WillOnce(Return(false));
+        stands->state = {{"BAW123", 999}};
+        Trigger();
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(999, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItSavesInTheBackground)
+    {
+        static_cast<void>(snapshot.Restore());
+        stands->state = {{"BAW123", 1}};
+        snapshot.TimedEventTrigger();
+
+        EXPECT_EQ("", files.at(L"journal.jsonl"));
+        RunBackgroundTasks();
+        EXPECT_EQ(1, JournalLines().size());
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItSkipsSavingWhileTheLastSaveIsRunning)
+    {
+        static_cast<void>(snapshot.Restore());
+        stands->state = {{"BAW123", 1}};
+        snapshot.TimedEventTrigger();
+        stands->state = {{"BAW123", 2}};
+        snapshot.TimedEventTrigger();
+        EXPECT_EQ(1, backgroundTasks.size());
+        RunBackgroundTasks();
+
+        Trigger();
+        const auto lines = JournalLines();
+        ASSERT_EQ(2, lines.size());
+        EXPECT_EQ(nlohmann::json({{"stands", {{"BAW123", 2}}}}), lines[1].at("changes"));
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItExpiresUnconfirmedRestoredState)
+    {
+        SaveOldState(std::chrono::minutes(1));
+        static_cast<void>(snapshot.Restore());
+
+        SetTestNow(TimeNow() + PluginStateSnapshot::confirmRestoredStateWithin);
+        Trigger();
+
+        EXPECT_EQ(std::set<std::string>({"BAW123"}), stands->expired);
+        EXPECT_EQ(std::set<std::string>({"BAW123"}), holds->expired);
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItDoesntExpireRestoredStateBeforeTheConfirmationWindowHasPassed)
+    {
+        SaveOldState(std::chrono::minutes(1));
+        static_cast<void>(snapshot.Restore());
+
+        SetTestNow(TimeNow() + PluginStateSnapshot::confirmRestoredStateWithin - std::chrono::seconds(1));
+        Trigger();
+
+        EXPECT_TRUE(stands->expired.empty());
+        EXPECT_TRUE(holds->expired.empty());
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItDoesntExpireRestoredStateConfirmedByAFlightplanEvent)
+    {
+        SaveOldState(std::chrono::minutes(1));
+        static_cast<void>(snapshot.Restore());
+
+        NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+        NiceMock<MockEuroScopeCRadarTargetInterface> radarTarget;
+        ON_CALL(flightplan, GetCallsign).WillByDefault(Return("BAW123"));
+        snapshot.FlightPlanEvent(flightplan, radarTarget);
+
+        SetTestNow(TimeNow() + PluginStateSnapshot::confirmRestoredStateWithin);
+        Trigger();
+
+        EXPECT_TRUE(stands->expired.empty());
+        EXPECT_TRUE(holds->expired.empty());
+    }
+
+    TEST_F(PluginStateSnapshotTest, ItOnlyExpiresRestoredStateOnce)
+    {
+        SaveOldState(std::chrono::minutes(1));
+        static_cast<void>(snapshot.Restore());
+
+        SetTestNow(TimeNow() + PluginStateSnapshot::confirmRestoredStateWithin);
+        Trigger();
+        stands->expired.clear();
+        Trigger();
+
+        EXPECT_TRUE(stands->expired.empty());
+    }
+} // namespace UKControllerPluginTest::State
@@ -0,0 +1,173 @@
+#include "state/StateJournal.h"
+#include "time/SystemClock.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::Test;
+using UKControllerPlugin::State::StateJournal;
+using UKControllerPlugin::Time::SetTestNow;
+using UKControllerPlugin::Time::TimeNow;
+
+namespace UKControllerPluginTest::State {
+
+    class StateJournalTest : public Test
+    {
+        public:
+        StateJournalTest() : journal(windows, L"snapshot.json", L"journal.jsonl")
+        {
+            SetTestNow(std::chrono::system_clock::time_point(std::chrono::seconds(1000)));
+
+            // Keep the files in memory
+            ON_CALL(windows, FileExists(_)).WillByDefault([this](const std::wstring& file) {
+                return files.contains(file);
+            });
+            ON_CALL(windows, ReadFromFileMock(_, _)).WillByDefault([this](const std::wstring& file, bool) {
+                return files.at(file);
+            });
+            ON_CALL(windows, WriteToFile(_, _, _, _))
+                .WillByDefault([this](const std::wstring& file, const std::string& data, bool truncate, bool) {
+                    files[file] = truncate ? data : files[file] + data;
+                });
+            ON_CALL(windows, MoveFileToNewLocation(_, _))
+                .WillByDefault([this](const std::wstring& from, const std::wstring& to) {
+                    files[to] = files.at(from);
+                    files.erase(from);
+                    return true;
+                });
+        }
+
+        [[nodiscard]] static auto Snapshot() -> nlohmann::json
+        {
+            return {{"stands", {{"BAW123", 1}, {"BAW456", 2}}}};
+        }
+
+        std::map<std::wstring, std::string> files;
+        NiceMock<Windows::MockWinApi> windows;
+        StateJournal journal;
+    };
+
+    TEST_F(StateJournalTest, ItLoadsNothingIfThereIsNoSnapshot)
+    {
+        EXPECT_EQ(std::nullopt, journal.Load());
+    }
+
+    TEST_F(StateJournalTest, ItLoadsNothingIfTheSnapshotIsInvalid)
+    {
+        files[L"snapshot.json"] = "{\"version\":";
+        EXPECT_EQ(std::nullopt, journal.Load());
+    }
+
+    TEST_F(StateJournalTest, ItLoadsNothingIfTheSnapshotIsADifferentVersion)
+    {
+        files[L"snapshot.json"] = nlohmann::json{{"version", 0}, {"sequence", 0}, {"saved_at", 1000}, {"state", {}}}
+                                      .dump();
+        EXPECT_EQ(std::nullopt, journal.Load());
+    }
+
+    TEST_F(StateJournalTest, ItLoadsACompactedSnapshot)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        SetTestNow(TimeNow() + std::chrono::seconds(5));
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(Snapshot(), saved->state);
+        EXPECT_EQ(std::chrono::system_clock::time_point(std::chrono::seconds(1000)), saved->savedAt);
+        EXPECT_EQ("", files.at(L"journal.jsonl"));
+        EXPECT_FALSE(files.contains(L"snapshot.json.tmp"));
+    }
+
+    TEST_F(StateJournalTest, ItReplaysTheJournalOverTheSnapshot)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        journal.Append({{"stands", {{"BAW123", 3}}}});
+        SetTestNow(TimeNow() + std::chrono::seconds(5));
+        journal.Append({{"stands", {{"BAW456", nullptr}}}, {"holds", {{"BAW123", "TIMBA"}}}});
+        EXPECT_EQ(2, journal.JournalEntries());
+
+        StateJournal loadingJournal(windows, L"snapshot.json", L"journal.jsonl");
+        const auto saved = loadingJournal.Load();
+        ASSERT_TRUE(saved.has_value());
+        nlohmann::json expected{{"stands", {{"BAW123", 3}}}, {"holds", {{"BAW123", "TIMBA"}}}};
+        EXPECT_EQ(expected, saved->state);
+        EXPECT_EQ(std::chrono::system_clock::time_point(std::chrono::seconds(1005)), saved->savedAt);
+        EXPECT_EQ(2, loadingJournal.JournalEntries());
+    }
+
+    TEST_F(StateJournalTest, ItSkipsJournalEntriesThatAreAlreadyInTheSnapshot)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        journal.Append({{"stands", {{"BAW123", 3}}}});
+        const auto journalBeforeCompaction = files.at(L"journal.jsonl");
+
+        // Put the journal back, as if we'd crashed before it was emptied
+        EXPECT_TRUE(journal.Compact({{"stands", {{"BAW123", 4}}}}));
+        files[L"journal.jsonl"] = journalBeforeCompaction;
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(4, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(StateJournalTest, ItIgnoresAPartlyWrittenJournalEntry)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        journal.Append({{"stands", {{"BAW123", 3}}}});
+        files[L"journal.jsonl"] += "{\"sequence\":2,\"saved_";
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(3, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(StateJournalTest, ItStopsAtJournalEntriesThatAreOutOfSequence)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        journal.Append({{"stands", {{"BAW123", 3}}}});
+        files[L"journal.jsonl"] +=
+            nlohmann::json{{"sequence", 5}, {"saved_at", 1000}, {"changes", {{"stands", {{"BAW123", 4}}}}}}.dump() +
+            "\n";
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(3, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(StateJournalTest, ItContinuesTheSequenceAfterLoading)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        journal.Append({{"stands", {{"BAW123", 3}}}});
+
+        StateJournal loadingJournal(windows, L"snapshot.json", L"journal.jsonl");
+        static_cast<void>(loadingJournal.Load());
+        loadingJournal.Append({{"stands", {{"BAW123", 4}}}});
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(4, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(StateJournalTest, ItKeepsTheJournalIfTheSnapshotCantBeMovedIntoPlace)
+    {
+        EXPECT_TRUE(journal.Compact(Snapshot()));
+        journal.Append({{"stands", {{"BAW123", 3}}}});
+
+        EXPECT_CALL(windows, MoveFileToNewLocation(_, _)).WillOnce(Return(false));
+        EXPECT_FALSE(journal.Compact({{"stands", {{"BAW123", 4}}}}));
+        EXPECT_EQ(1, journal.JournalEntries());
+
+        const auto saved = StateJournal(windows, L"snapshot.json", L"journal.jsonl").Load();
+        ASSERT_TRUE(saved.has_value());
+        EXPECT_EQ(3, saved->state.at("stands").at("BAW123"));
+    }
+
+    TEST_F(StateJournalTest, ItAppliesChanges)
+    {
+        nlohmann::json state{{"stands", {{"BAW123", 1}, {"BAW456", 2}}}};
+        StateJournal::ApplyChanges(state, {{"stands", {{"BAW123", nullptr}, {"BAW789", 3}}}, {"holds", {{"a", "b"}}}});
+
+        nlohmann::json expected{{"stands", {{"BAW456", 2}, {"BAW789", 3}}}, {"holds", {{"a", "b"}}}};
+        EXPECT_EQ(expected, state);
+    }
+} // namespace UKControllerPluginTest::State
@@ -0,0 +1,76 @@
+#include "bootstrap/PersistenceContainer.h"
+#include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "state/PluginStateSnapshot.h"
+#include "state/StateModule.h"
+#include "timedevent/TimedEventCollection.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::Test;
+using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
+using UKControllerPlugin::State::BootstrapPlugin;
+using UKControllerPlugin::State::RestoreState;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
+
+namespace UKControllerPluginTest::State {
+
+    class StateModuleTest : public Test
+    {
+        public:
+        StateModuleTest()
+        {
+            container.timedHandler = std::make_unique<TimedEventCollection>();
+            container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.windows = std::make_unique<NiceMock<Windows::MockWinApi>>();
+        }
+
+        PersistenceContainer container;
+    };
+
+    TEST_F(StateModuleTest, ItDoesntSaveStateOnDuplicatePlugin)
+    {
+        BootstrapPlugin(this->container, true);
+        EXPECT_EQ(nullptr, this->container.pluginState);
+        EXPECT_EQ(0, this->container.timedHandler->CountHandlers());
+        EXPECT_EQ(0, this->container.flightplanHandler->CountHandlers());
+    }
+
+    TEST_F(StateModuleTest, ItSetsUpPluginState)
+    {
+        BootstrapPlugin(this->container, false);
+        EXPECT_NE(nullptr, this->container.pluginState);
+        EXPECT_EQ(0, this->container.pluginState->CountStates());
+    }
+
+    TEST_F(StateModuleTest, ItSavesStatePeriodically)
+    {
+        BootstrapPlugin(this->container, false);
+        EXPECT_EQ(1, this->container.timedHandler->CountHandlers());
+        EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(5));
+    }
+
+    TEST_F(StateModuleTest, ItConfirmsRestoredStateFromFlightplanEvents)
+    {
+        BootstrapPlugin(this->container, false);
+        EXPECT_EQ(1, this->container.flightplanHandler->CountHandlers());
+    }
+
+    TEST_F(StateModuleTest, ItRestoresStateAndTakesASnapshot)
+    {
+        BootstrapPlugin(this->container, false);
+        auto& windows = static_cast<NiceMock<Windows::MockWinApi>&>(*this->container.windows);
+        EXPECT_CALL(windows, FileExists(std::wstring(L"state/plugin-state.json"))).WillOnce(Return(false));
+        EXPECT_CALL(windows, MoveFileToNewLocation(_, std::wstring(L"state/plugin-state.json")))
+            .WillOnce(Return(true));
+
+        RestoreState(this->container);
+    }
+
+    TEST_F(StateModuleTest, ItDoesntRestoreStateOnDuplicatePlugin)
+    {
+        BootstrapPlugin(this->container, true);
+        EXPECT_NO_THROW(RestoreState(this->container));
+    }
+} // namespace UKControllerPluginTest::State
@@ -99,5 +99,24 @@ namespace UKControllerPluginTest {
             tagData.SetItemString("thisdataistoolongforthetagitem");
             EXPECT_EQ("INVALID", tagData.GetItemString());
         }
+
+        TEST_F(TagDataTest, ItSetsItemStringOfMaximumLength)
+        {
+            tagData.SetItemString("123456789012345");
+            EXPECT_EQ("123456789012345", tagData.GetItemString());
+        }
+
+        TEST_F(TagDataTest, ItSetsItemStringFromAView)
+        {
+            const std::string data = "BarrrrrrBazzzzz";
+            tagData.SetItemString(std::string_view(data).substr(0, 8));
+            EXPECT_EQ("Barrrrrr", tagData.GetItemStringView());
+        }
+
+        TEST_F(TagDataTest, ItSetsEmptyItemString)
+        {
+            tagData.SetItemString("");
+            EXPECT_EQ("", tagData.GetItemString());
+        }
     } // namespace Tag
 } // namespace UKControllerPluginTest
@@ -1,7 +1,10 @@
 #include "tag/TagItemCollection.h"
 #include "tag/TagItemInterface.h"
+#include "tag/TagItemMemo.h"
 #include "tag/TagData.h"
 
+using ::testing::NiceMock;
+using ::testing::Return;
 using ::testing::StrictMock;
 using testing::Test;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
@@ -38,9 +41,13 @@ namespace UKControllerPluginTest {
 
             void SetTagItemData(TagData& tagData)
             {
+                calls++;
                 tagData.SetItemString(this->data);
             }
 
+            // How many times the item has been generated
+            int calls = 0;
+
             // Tag item description
             const std::string desc;
 
@@ -106,6 +113,59 @@ namespace UKControllerPluginTest {
             EXPECT_EQ("testdata", tagData.GetItemString());
         }
 
+        TEST_F(TagItemCollectionTest, TagItemUpdateMemoisesItemsWithDependencies)
+        {
+            TagItemCollection collection;
+            NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            ON_CALL(mockFlightplan, GetCallsign).WillByDefault(Return("BAW123"));
+            TagData tagData(
+                mockFlightplan,
+                mockRadarTarget,
+                1,
+                EuroScopePlugIn::TAG_DATA_CORRELATED,
+                itemString,
+                &euroscopeColourCode,
+                &tagColour,
+                &fontSize);
+
+            auto tagItem = std::make_shared<FakeTagItem>("testdesc", "testdata");
+            collection.RegisterTagItem(1, tagItem, {.flightplan = true});
+            collection.TagItemUpdate(tagData);
+            tagData.SetItemString("");
+            collection.TagItemUpdate(tagData);
+
+            EXPECT_EQ("testdata", tagData.GetItemString());
+            EXPECT_EQ(1, tagItem->calls);
+            EXPECT_EQ(1, collection.Memo()->Hits());
+            EXPECT_EQ(1, collection.Memo()->Misses());
+        }
+
+        TEST_F(TagItemCollectionTest, TagItemUpdateDoesntMemoiseItemsWithoutDependencies)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            TagData tagData(
+                mockFlightplan,
+                mockRadarTarget,
+                1,
+                EuroScopePlugIn::TAG_DATA_CORRELATED,
+                itemString,
+                &euroscopeColourCode,
+                &tagColour,
+                &fontSize);
+
+            auto tagItem = std::make_shared<FakeTagItem>("testdesc", "testdata");
+            collection.RegisterTagItem(1, tagItem);
+            collection.TagItemUpdate(tagData);
+            collection.TagItemUpdate(tagData);
+
+            EXPECT_EQ(2, tagItem->calls);
+            EXPECT_FALSE(collection.Memo()->IsMemoised(1));
+            EXPECT_EQ(0, collection.Memo()->Misses());
+        }
+
         TEST_F(TagItemCollectionTest, StartsEmpty)
         {
             TagItemCollection collection;
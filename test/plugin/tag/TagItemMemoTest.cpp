@@ -0,0 +1,212 @@
+#include "tag/TagData.h"
+#include "tag/TagItemMemo.h"
+
+using testing::NiceMock;
+using testing::Return;
+using UKControllerPlugin::Tag::TagData;
+using UKControllerPlugin::Tag::TagItemMemo;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+
+namespace UKControllerPluginTest::Tag {
+    class TagItemMemoTest : public testing::Test
+    {
+        public:
+        TagItemMemoTest()
+        {
+            ON_CALL(flightplan1, GetCallsign).WillByDefault(Return("BAW123"));
+            ON_CALL(flightplan2, GetCallsign).WillByDefault(Return("EZY456"));
+            ON_CALL(radarTarget1, GetCallsign).WillByDefault(Return("BAW123"));
+            memo.Memoise(FLIGHTPLAN_ITEM, {.flightplan = true});
+            memo.Memoise(STATIC_ITEM, {});
+        }
+
+        auto GetTagData(MockEuroScopeCFlightPlanInterface& flightplan, int itemCode) -> TagData
+        {
+            return {
+                flightplan,
+                radarTarget1,
+                itemCode,
+                EuroScopePlugIn::TAG_DATA_CORRELATED,
+                itemString,
+                &euroscopeColourCode,
+                &tagColour,
+                &fontSize};
+        }
+
+        void Store(MockEuroScopeCFlightPlanInterface& flightplan, int itemCode)
+        {
+            auto tagData = GetTagData(flightplan, itemCode);
+            tagData.SetItemString("FOO");
+            memo.Store(tagData);
+        }
+
+        // Store every memoised item for both aircraft
+        void StoreAll()
+        {
+            for (const auto itemCode : {FLIGHTPLAN_ITEM, STATIC_ITEM}) {
+                Store(flightplan1, itemCode);
+                Store(flightplan2, itemCode);
+            }
+        }
+
+        static const int FLIGHTPLAN_ITEM = 1;
+        static const int STATIC_ITEM = 2;
+        static const int UNMEMOISED_ITEM = 3;
+        double fontSize = 24.1;
+        COLORREF tagColour = RGB(255, 255, 255);
+        int euroscopeColourCode = EuroScopePlugIn::TAG_COLOR_ASSUMED;
+        char itemString[16] = "";
+        NiceMock<MockEuroScopeCFlightPlanInterface> flightplan1;
+        NiceMock<MockEuroScopeCFlightPlanInterface> flightplan2;
+        NiceMock<MockEuroScopeCRadarTargetInterface> radarTarget1;
+        TagItemMemo memo;
+    };
+
+    TEST_F(TagItemMemoTest, ItStartsEmpty)
+    {
+        EXPECT_EQ(0, memo.Count());
+        EXPECT_EQ(0, memo.Hits());
+        EXPECT_EQ(0, memo.Misses());
+    }
+
+    TEST_F(TagItemMemoTest, ItKnowsWhichItemsAreMemoised)
+    {
+        EXPECT_TRUE(memo.IsMemoised(FLIGHTPLAN_ITEM));
+        EXPECT_FALSE(memo.IsMemoised(UNMEMOISED_ITEM));
+    }
+
+    TEST_F(TagItemMemoTest, ItDoesntStoreItemsThatArentMemoised)
+    {
+        Store(flightplan1, UNMEMOISED_ITEM);
+        EXPECT_EQ(0, memo.Count());
+    }
+
+    TEST_F(TagItemMemoTest, ItDoesntCountMissesForItemsThatArentMemoised)
+    {
+        auto tagData = GetTagData(flightplan1, UNMEMOISED_ITEM);
+        EXPECT_FALSE(memo.Restore(tagData));
+        EXPECT_EQ(0, memo.Misses());
+    }
+
+    TEST_F(TagItemMemoTest, ItMissesIfNothingStored)
+    {
+        auto tagData = GetTagData(flightplan1, FLIGHTPLAN_ITEM);
+        EXPECT_FALSE(memo.Restore(tagData));
+        EXPECT_EQ(1, memo.Misses());
+        EXPECT_EQ(0, memo.Hits());
+    }
+
+    TEST_F(TagItemMemoTest, ItRestoresStoredItems)
+    {
+        auto stored = GetTagData(flightplan1, FLIGHTPLAN_ITEM);
+        stored.SetItemString("BAR");
+        stored.SetTagColour(RGB(1, 2, 3));
+        stored.SetFontSize(12.5);
+        memo.Store(stored);
+
+        itemString[0] = '\0';
+        tagColour = RGB(255, 255, 255);
+        euroscopeColourCode = EuroScopePlugIn::TAG_COLOR_ASSUMED;
+        fontSize = 24.1;
+
+        auto tagData = GetTagData(flightplan1, FLIGHTPLAN_ITEM);
+        EXPECT_TRUE(memo.Restore(tagData));
+        EXPECT_EQ("BAR", tagData.GetItemString());
+        EXPECT_EQ(RGB(1, 2, 3), tagData.GetTagColour());
+        EXPECT_EQ(EuroScopePlugIn::TAG_COLOR_RGB_DEFINED, tagData.GetEuroscopeColourCode());
+        EXPECT_EQ(12.5, tagData.GetFontSize());
+        EXPECT_EQ(1, memo.Hits());
+        EXPECT_EQ(0, memo.Misses());
+    }
+
+    TEST_F(TagItemMemoTest, ItRestoresEuroscopeColourCodes)
+    {
+        auto stored = GetTagData(flightplan1, FLIGHTPLAN_ITEM);
+        stored.SetEuroscopeColourCode(EuroScopePlugIn::TAG_COLOR_EMERGENCY);
+        memo.Store(stored);
+
+        euroscopeColourCode = EuroScopePlugIn::TAG_COLOR_ASSUMED;
+        auto tagData = GetTagData(flightplan1, FLIGHTPLAN_ITEM);
+        EXPECT_TRUE(memo.Restore(tagData));
+        EXPECT_EQ(EuroScopePlugIn::TAG_COLOR_EMERGENCY, tagData.GetEuroscopeColourCode());
+    }
+
+    TEST_F(TagItemMemoTest, ItMissesIfDataAvailableHasChanged)
+    {
+        Store(flightplan1, FLIGHTPLAN_ITEM);
+        TagData tagData(
+            flightplan1,
+            radarTarget1,
+            FLIGHTPLAN_ITEM,
+            EuroScopePlugIn::TAG_DATA_FLIGHT_PLAN_TRACK,
+            itemString,
+            &euroscopeColourCode,
+            &tagColour,
+            &fontSize);
+
+        EXPECT_FALSE(memo.Restore(tagData));
+        EXPECT_EQ(1, memo.Misses());
+    }
+
+    TEST_F(TagItemMemoTest, ItKeepsItemsSeparateByCallsignAndItemCode)
+    {
+        StoreAll();
+        EXPECT_EQ(4, memo.Count());
+        EXPECT_TRUE(memo.Has("BAW123", FLIGHTPLAN_ITEM));
+        EXPECT_TRUE(memo.Has("EZY456", STATIC_ITEM));
+        EXPECT_FALSE(memo.Has("EZY456", UNMEMOISED_ITEM));
+        EXPECT_FALSE(memo.Has("RYR789", FLIGHTPLAN_ITEM));
+    }
+
+    TEST_F(TagItemMemoTest, FlightplanEventsOnlyEvictFlightplanItemsForThatAircraft)
+    {
+        StoreAll();
+        memo.FlightPlanEvent(flightplan1, radarTarget1);
+
+        EXPECT_EQ(3, memo.Count());
+        EXPECT_FALSE(memo.Has("BAW123", FLIGHTPLAN_ITEM));
+        EXPECT_TRUE(memo.Has("EZY456", FLIGHTPLAN_ITEM));
+        EXPECT_TRUE(memo.Has("BAW123", STATIC_ITEM));
+    }
+
+    TEST_F(TagItemMemoTest, ControllerDataEventsOnlyEvictFlightplanItemsForThatAircraft)
+    {
+        StoreAll();
+        memo.ControllerFlightPlanDataEvent(flightplan2, EuroScopePlugIn::CTR_DATA_TYPE_TEMPORARY_ALTITUDE);
+
+        EXPECT_EQ(3, memo.Count());
+        EXPECT_FALSE(memo.Has("EZY456", FLIGHTPLAN_ITEM));
+        EXPECT_TRUE(memo.Has("BAW123", FLIGHTPLAN_ITEM));
+        EXPECT_TRUE(memo.Has("EZY456", STATIC_ITEM));
+    }
+
+    TEST_F(TagItemMemoTest, FlightplanDisconnectsEvictEverythingForThatAircraft)
+    {
+        StoreAll();
+        memo.FlightPlanDisconnectEvent(flightplan1);
+
+        EXPECT_EQ(2, memo.Count());
+        for (const auto itemCode : {FLIGHTPLAN_ITEM, STATIC_ITEM}) {
+            EXPECT_FALSE(memo.Has("BAW123", itemCode));
+            EXPECT_TRUE(memo.Has("EZY456", itemCode));
+        }
+    }
+
+    TEST_F(TagItemMemoTest, EvictedItemsAreRegeneratedAndStoredAgain)
+    {
+        Store(flightplan1, FLIGHTPLAN_ITEM);
+        memo.FlightPlanEvent(flightplan1, radarTarget1);
+
+        auto tagData = GetTagData(flightplan1, FLIGHTPLAN_ITEM);
+        EXPECT_FALSE(memo.Restore(tagData));
+        tagData.SetItemString("NEW");
+        memo.Store(tagData);
+
+        itemString[0] = '\0';
+        EXPECT_TRUE(memo.Restore(tagData));
+        EXPECT_EQ("NEW", tagData.GetItemString());
+        EXPECT_EQ(1, memo.Hits());
+        EXPECT_EQ(1, memo.Misses());
+    }
+} // namespace UKControllerPluginTest::Tag
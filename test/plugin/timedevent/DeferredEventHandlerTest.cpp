@@ -0,0 +1,114 @@
+#include "flightplan/StoredFlightplan.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "timedevent/DeferredEventHandler.h"
+#include "timedevent/DeferredEventRunnerInterface.h"
+#include "timedevent/TimeoutWheel.h"
+
+using testing::Test;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::TimedEvent::DeferredEventHandler;
+using UKControllerPlugin::TimedEvent::DeferredEventRunnerInterface;
+using UKControllerPlugin::TimedEvent::TimeoutWheel;
+
+namespace UKControllerPluginTest::TimedEvent {
+
+    class CountingDeferredEvent : public DeferredEventRunnerInterface
+    {
+        public:
+        explicit CountingDeferredEvent(int& runs) : runs(runs)
+        {
+        }
+
+        void Run() override
+        {
+            runs++;
+        }
+
+        private:
+        int& runs;
+    };
+
+    class DeferredEventHandlerTest : public Test
+    {
+        public:
+        DeferredEventHandlerTest() : wheel(std::make_shared<TimeoutWheel>()), handler(wheel)
+        {
+        }
+
+        int runs = 0;
+        std::shared_ptr<TimeoutWheel> wheel;
+        DeferredEventHandler handler;
+    };
+
+    TEST_F(DeferredEventHandlerTest, ItStartsWithNoEvents)
+    {
+        EXPECT_EQ(0, handler.Count());
+    }
+
+    TEST_F(DeferredEventHandlerTest, ItDefersEvents)
+    {
+        handler.DeferFor(std::make_unique<CountingDeferredEvent>(runs), std::chrono::seconds(60));
+        EXPECT_EQ(1, handler.Count());
+    }
+
+    TEST_F(DeferredEventHandlerTest, ItRunsEventsThatAreDue)
+    {
+        handler.DeferFor(std::make_unique<CountingDeferredEvent>(runs), std::chrono::seconds(0));
+        handler.TimedEventTrigger();
+
+        EXPECT_EQ(1, runs);
+        EXPECT_EQ(0, handler.Count());
+    }
+
+    TEST_F(DeferredEventHandlerTest, ItDoesntRunEventsThatArentDue)
+    {
+        handler.DeferFor(std::make_unique<CountingDeferredEvent>(runs), std::chrono::seconds(60));
+        handler.TimedEventTrigger();
+
+        EXPECT_EQ(0, runs);
+        EXPECT_EQ(1, handler.Count());
+    }
+
+    TEST_F(DeferredEventHandlerTest, ItOnlyRunsEventsOnce)
+    {
+        handler.DeferFor(std::make_unique<CountingDeferredEvent>(runs), std::chrono::seconds(0));
+        handler.TimedEventTrigger();
+        handler.TimedEventTrigger();
+
+        EXPECT_EQ(1, runs);
+    }
+
+    TEST_F(DeferredEventHandlerTest, ItOnlyCountsItsOwnEventsOnTheWheel)
+    {
+        static_cast<void>(wheel->Schedule(TimeoutWheel::Clock::now(), std::chrono::seconds(60), []() {}));
+        handler.DeferFor(std::make_unique<CountingDeferredEvent>(runs), std::chrono::seconds(60));
+
+        EXPECT_EQ(1, handler.Count());
+        EXPECT_EQ(2, wheel->Count());
+    }
+
+    TEST_F(DeferredEventHandlerTest, ItTimesOutStoredFlightplansOnTheSharedWheel)
+    {
+        StoredFlightplanCollection flightplans(wheel);
+        StoredFlightplan plan("BAW123", "EGLL", "EGKK");
+        plan.SetTimeout(-1);
+        flightplans.UpdatePlan(plan);
+
+        handler.TimedEventTrigger();
+        EXPECT_FALSE(flightplans.HasFlightplanForCallsign("BAW123"));
+    }
+
+    TEST_F(DeferredEventHandlerTest, StoredFlightplansCancelTheirTimeoutsWhenDestroyed)
+    {
+        {
+            StoredFlightplanCollection flightplans(wheel);
+            StoredFlightplan plan("BAW123", "EGLL", "EGKK");
+            plan.SetTimeout(60);
+            flightplans.UpdatePlan(plan);
+            EXPECT_EQ(1, wheel->Count());
+        }
+
+        EXPECT_EQ(0, wheel->Count());
+    }
+} // namespace UKControllerPluginTest::TimedEvent
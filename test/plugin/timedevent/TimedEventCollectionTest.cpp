@@ -7,24 +7,54 @@ using UKControllerPluginTest::EventHandler::MockAbstractTimedEvent;
 namespace UKControllerPluginTest {
     namespace EventHandler {
 
-        TEST(TimedEventCollection, RunsAllEventsForAGivenTime)
+        TEST(TimedEventCollection, RunsEventsWithTheSameFrequencyOnDifferentSeconds)
         {
             std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent1(new StrictMock<MockAbstractTimedEvent>);
             std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent2(new StrictMock<MockAbstractTimedEvent>);
             std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent3(new StrictMock<MockAbstractTimedEvent>);
 
+            TimedEventCollection collection;
+            collection.RegisterEvent(mockEvent1, 10);
+            collection.RegisterEvent(mockEvent2, 10);
+            collection.RegisterEvent(mockEvent3, 10);
+
             EXPECT_CALL(*mockEvent1, TimedEventTrigger()).Times(1);
+            collection.Tick(10);
+            testing::Mock::VerifyAndClearExpectations(mockEvent1.get());
 
             EXPECT_CALL(*mockEvent2, TimedEventTrigger()).Times(1);
+            collection.Tick(11);
+            testing::Mock::VerifyAndClearExpectations(mockEvent2.get());
 
             EXPECT_CALL(*mockEvent3, TimedEventTrigger()).Times(1);
+            collection.Tick(12);
+        }
+
+        TEST(TimedEventCollection, RunsEventsAtTheirFrequency)
+        {
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent(new StrictMock<MockAbstractTimedEvent>);
+            EXPECT_CALL(*mockEvent, TimedEventTrigger()).Times(3);
 
             TimedEventCollection collection;
-            collection.RegisterEvent(mockEvent1, 10);
-            collection.RegisterEvent(mockEvent2, 10);
-            collection.RegisterEvent(mockEvent3, 10);
+            collection.RegisterEvent(mockEvent, 10);
+            for (int second = 10; second < 40; second++) {
+                collection.Tick(second);
+            }
+        }
 
-            collection.Tick(10);
+        TEST(TimedEventCollection, RunsEveryEventEverySecondWithAFrequencyOfOne)
+        {
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent1(new StrictMock<MockAbstractTimedEvent>);
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent2(new StrictMock<MockAbstractTimedEvent>);
+            EXPECT_CALL(*mockEvent1, TimedEventTrigger()).Times(5);
+            EXPECT_CALL(*mockEvent2, TimedEventTrigger()).Times(5);
+
+            TimedEventCollection collection;
+            collection.RegisterEvent(mockEvent1, 1);
+            collection.RegisterEvent(mockEvent2, 1);
+            for (int second = 1; second <= 5; second++) {
+                collection.Tick(second);
+            }
         }
 
         TEST(TimedEventCollection, DoesntRunEventsForDifferentTimes)
@@ -35,8 +65,6 @@ namespace UKControllerPluginTest {
 
             EXPECT_CALL(*mockEvent1, TimedEventTrigger()).Times(1);
 
-            EXPECT_CALL(*mockEvent2, TimedEventTrigger()).Times(1);
-
             TimedEventCollection collection;
             collection.RegisterEvent(mockEvent1, 10);
             collection.RegisterEvent(mockEvent2, 20);
@@ -45,6 +73,120 @@ namespace UKControllerPluginTest {
             collection.Tick(40);
         }
 
+        TEST(TimedEventCollection, SpreadsEventsAcrossTheLeastBusyPhases)
+        {
+            TimedEventCollection collection;
+            collection.RegisterEvent(std::make_shared<MockAbstractTimedEvent>(), 10);
+            collection.RegisterEvent(std::make_shared<MockAbstractTimedEvent>(), 20);
+            collection.RegisterEvent(std::make_shared<MockAbstractTimedEvent>(), 15);
+            collection.RegisterEvent(std::make_shared<MockAbstractTimedEvent>(), 30);
+
+            const auto statistics = collection.Statistics();
+            ASSERT_EQ(4, statistics.size());
+            EXPECT_EQ(0, statistics[0].phase);
+            EXPECT_EQ(1, statistics[1].phase);
+            EXPECT_EQ(2, statistics[2].phase);
+            EXPECT_EQ(3, statistics[3].phase);
+        }
+
+        TEST(TimedEventCollection, RunsEventsRegisteredAfterTickingStarts)
+        {
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent(new StrictMock<MockAbstractTimedEvent>);
+            EXPECT_CALL(*mockEvent, TimedEventTrigger()).Times(1);
+
+            TimedEventCollection collection;
+            collection.Tick(1);
+            collection.RegisterEvent(mockEvent, 5);
+            for (int second = 2; second <= 6; second++) {
+                collection.Tick(second);
+            }
+        }
+
+        TEST(TimedEventCollection, SkipsMissedSecondsRatherThanCatchingUp)
+        {
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent(new StrictMock<MockAbstractTimedEvent>);
+            EXPECT_CALL(*mockEvent, TimedEventTrigger()).Times(2);
+
+            TimedEventCollection collection;
+            collection.RegisterEvent(mockEvent, 1);
+            collection.Tick(1);
+            collection.Tick(100);
+        }
+
+        TEST(TimedEventCollection, DefersEventsOnceTheTickBudgetIsUsedUp)
+        {
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent1(new StrictMock<MockAbstractTimedEvent>);
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> mockEvent2(new StrictMock<MockAbstractTimedEvent>);
+
+            TimedEventCollection collection;
+            collection.SetTickBudget(std::chrono::microseconds(0));
+            collection.RegisterEvent(mockEvent1, 1);
+            collection.RegisterEvent(mockEvent2, 1);
+
+            const auto slowEvent = [] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); };
+
+            // The first always runs, the second is deferred and so goes first next time
+            EXPECT_CALL(*mockEvent1, TimedEventTrigger()).Times(1).WillOnce(slowEvent);
+            EXPECT_CALL(*mockEvent2, TimedEventTrigger()).Times(0);
+            collection.Tick(1);
+            testing::Mock::VerifyAndClearExpectations(mockEvent1.get());
+            testing::Mock::VerifyAndClearExpectations(mockEvent2.get());
+
+            EXPECT_CALL(*mockEvent2, TimedEventTrigger()).Times(1).WillOnce(slowEvent);
+            EXPECT_CALL(*mockEvent1, TimedEventTrigger()).Times(0);
+            collection.Tick(2);
+
+            EXPECT_EQ(1, collection.Statistics()[1].deferrals);
+        }
+
+        TEST(TimedEventCollection, KeepsDeferredEventsOnTheirPhase)
+        {
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> everySecond(new StrictMock<MockAbstractTimedEvent>);
+            std::shared_ptr<StrictMock<MockAbstractTimedEvent>> everyFive(new StrictMock<MockAbstractTimedEvent>);
+            int second = 0;
+            std::vector<int> secondsRun;
+
+            TimedEventCollection collection;
+            collection.SetTickBudget(std::chrono::microseconds(0));
+            collection.RegisterEvent(everySecond, 1);
+            collection.RegisterEvent(everyFive, 5);
+
+            // Overrun the budget once, so the second event is deferred from its first run
+            EXPECT_CALL(*everySecond, TimedEventTrigger()).WillRepeatedly([&second] {
+                if (second == 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            });
+            EXPECT_CALL(*everyFive, TimedEventTrigger()).WillRepeatedly([&second, &secondsRun] {
+                secondsRun.push_back(second);
+            });
+
+            for (second = 0; second < 30; second++) {
+                collection.Tick(second);
+            }
+
+            EXPECT_EQ(0, collection.Statistics()[1].phase);
+            EXPECT_EQ(1, collection.Statistics()[1].deferrals);
+            EXPECT_EQ(std::vector<int>({1, 5, 10, 15, 20, 25}), secondsRun);
+        }
+
+        TEST(TimedEventCollection, RecordsHandlerRuns)
+        {
+            auto mockEvent = std::make_shared<testing::NiceMock<MockAbstractTimedEvent>>();
+            TimedEventCollection collection;
+            collection.RegisterEvent(mockEvent, 2);
+            for (int second = 0; second < 10; second++) {
+                collection.Tick(second);
+            }
+
+            const auto statistics = collection.Statistics().front();
+            EXPECT_EQ(2, statistics.frequency);
+            EXPECT_EQ(5, statistics.runs);
+            EXPECT_EQ(0, statistics.deferrals);
+            EXPECT_LE(statistics.longestRunTime, statistics.totalRunTime);
+            EXPECT_FALSE(statistics.handler.empty());
+        }
+
         TEST(TimedEventCollection, StartsEmpty)
         {
             TimedEventCollection collection;
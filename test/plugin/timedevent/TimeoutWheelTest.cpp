@@ -0,0 +1,215 @@
+#include "timedevent/TimeoutWheel.h"
+
+using testing::Test;
+using UKControllerPlugin::TimedEvent::TimeoutWheel;
+
+namespace UKControllerPluginTest::TimedEvent {
+
+    class TimeoutWheelTest : public Test
+    {
+        public:
+        TimeoutWheelTest() : start(TimeoutWheel::Clock::now()), now(start), wheel(std::chrono::seconds(1), start)
+        {
+        }
+
+        void AdvanceTo(std::chrono::milliseconds time)
+        {
+            now = start + time;
+            wheel.Advance(now);
+        }
+
+        auto Schedule(std::chrono::milliseconds delay, std::function<void()> callback) -> TimeoutWheel::TimeoutId
+        {
+            return wheel.Schedule(now, delay, std::move(callback));
+        }
+
+        auto Record(int timeout) -> std::function<void()>
+        {
+            return [this, timeout]() { fired.push_back(timeout); };
+        }
+
+        std::vector<int> fired;
+        TimeoutWheel::Clock::time_point start;
+        TimeoutWheel::Clock::time_point now;
+        TimeoutWheel wheel;
+    };
+
+    TEST_F(TimeoutWheelTest, ItStartsEmpty)
+    {
+        EXPECT_EQ(0, wheel.Count());
+    }
+
+    TEST_F(TimeoutWheelTest, ItCountsScheduledTimeouts)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(5), Record(1)));
+        static_cast<void>(Schedule(std::chrono::seconds(10), Record(2)));
+        EXPECT_EQ(2, wheel.Count());
+    }
+
+    TEST_F(TimeoutWheelTest, ItGivesEachTimeoutADifferentId)
+    {
+        const auto first = Schedule(std::chrono::seconds(5), Record(1));
+        const auto second = Schedule(std::chrono::seconds(5), Record(2));
+        EXPECT_NE(first, second);
+        EXPECT_NE(TimeoutWheel::noTimeout, first);
+    }
+
+    TEST_F(TimeoutWheelTest, ItFiresTimeoutsOnceTheyExpire)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(5), Record(1)));
+
+        AdvanceTo(std::chrono::seconds(4));
+        EXPECT_TRUE(fired.empty());
+
+        AdvanceTo(std::chrono::seconds(5));
+        EXPECT_EQ(std::vector<int>({1}), fired);
+        EXPECT_EQ(0, wheel.Count());
+    }
+
+    TEST_F(TimeoutWheelTest, ItRoundsPartialTicksUp)
+    {
+        static_cast<void>(Schedule(std::chrono::milliseconds(1500), Record(1)));
+
+        AdvanceTo(std::chrono::seconds(1));
+        EXPECT_TRUE(fired.empty());
+
+        AdvanceTo(std::chrono::seconds(2));
+        EXPECT_EQ(std::vector<int>({1}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItFiresTimeoutsThatAreAlreadyDueOnTheNextAdvance)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(-5), Record(1)));
+        static_cast<void>(Schedule(std::chrono::seconds(0), Record(2)));
+
+        AdvanceTo(std::chrono::seconds(0));
+        EXPECT_EQ(std::vector<int>({1, 2}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItFiresTimeoutsInOrder)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(3000), Record(3)));
+        static_cast<void>(Schedule(std::chrono::seconds(70), Record(2)));
+        static_cast<void>(Schedule(std::chrono::seconds(10), Record(1)));
+
+        for (int second = 1; second <= 3000; second++) {
+            AdvanceTo(std::chrono::seconds(second));
+        }
+
+        EXPECT_EQ(std::vector<int>({1, 2, 3}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItFiresEverythingDueWhenAdvancedALongWay)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(64), Record(1)));
+        static_cast<void>(Schedule(std::chrono::seconds(4096), Record(2)));
+        static_cast<void>(Schedule(std::chrono::seconds(300000), Record(3)));
+        static_cast<void>(Schedule(std::chrono::seconds(300001), Record(4)));
+
+        AdvanceTo(std::chrono::seconds(300000));
+        EXPECT_EQ(std::vector<int>({1, 2, 3}), fired);
+
+        AdvanceTo(std::chrono::seconds(300001));
+        EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItFiresTimeoutsAtTheRightTickAcrossWheels)
+    {
+        for (const auto delay : {63, 64, 65, 127, 128, 4095, 4096, 4097, 262143, 262144}) {
+            TimeoutWheel delayWheel(std::chrono::seconds(1), start);
+            bool hasFired = false;
+            static_cast<void>(
+                delayWheel.Schedule(start, std::chrono::seconds(delay), [&hasFired]() { hasFired = true; }));
+
+            delayWheel.Advance(start + std::chrono::seconds(delay - 1));
+            EXPECT_FALSE(hasFired) << "Delay " << delay;
+
+            delayWheel.Advance(start + std::chrono::seconds(delay));
+            EXPECT_TRUE(hasFired) << "Delay " << delay;
+        }
+    }
+
+    TEST_F(TimeoutWheelTest, ItSchedulesRelativeToTheTimeGiven)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(1000), Record(1)));
+        AdvanceTo(std::chrono::seconds(100));
+        static_cast<void>(Schedule(std::chrono::seconds(10), Record(2)));
+
+        AdvanceTo(std::chrono::seconds(109));
+        EXPECT_TRUE(fired.empty());
+
+        AdvanceTo(std::chrono::seconds(110));
+        EXPECT_EQ(std::vector<int>({2}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItDoesntFireEarlyWhenScheduledPartWayThroughATick)
+    {
+        AdvanceTo(std::chrono::milliseconds(100500));
+        static_cast<void>(Schedule(std::chrono::seconds(1), Record(1)));
+
+        AdvanceTo(std::chrono::milliseconds(101499));
+        EXPECT_TRUE(fired.empty());
+
+        AdvanceTo(std::chrono::seconds(102));
+        EXPECT_EQ(std::vector<int>({1}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItSchedulesFromTheTimeGivenIfTheWheelHasntBeenAdvanced)
+    {
+        static_cast<void>(wheel.Schedule(start + std::chrono::seconds(100), std::chrono::seconds(10), Record(1)));
+
+        AdvanceTo(std::chrono::seconds(109));
+        EXPECT_TRUE(fired.empty());
+
+        AdvanceTo(std::chrono::seconds(110));
+        EXPECT_EQ(std::vector<int>({1}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, ItDoesntFireCancelledTimeouts)
+    {
+        const auto id = Schedule(std::chrono::seconds(5), Record(1));
+        EXPECT_TRUE(wheel.Cancel(id));
+        EXPECT_EQ(0, wheel.Count());
+
+        AdvanceTo(std::chrono::seconds(10));
+        EXPECT_TRUE(fired.empty());
+    }
+
+    TEST_F(TimeoutWheelTest, ItDoesntCancelTimeoutsThatHaveFired)
+    {
+        const auto id = Schedule(std::chrono::seconds(5), Record(1));
+        AdvanceTo(std::chrono::seconds(5));
+        EXPECT_FALSE(wheel.Cancel(id));
+    }
+
+    TEST_F(TimeoutWheelTest, CallbacksCanScheduleMoreTimeouts)
+    {
+        static_cast<void>(Schedule(std::chrono::seconds(5), [this]() {
+            fired.push_back(1);
+            static_cast<void>(Schedule(std::chrono::seconds(-1), Record(2)));
+            static_cast<void>(Schedule(std::chrono::seconds(5), Record(3)));
+        }));
+
+        AdvanceTo(std::chrono::seconds(5));
+        EXPECT_EQ(std::vector<int>({1}), fired);
+
+        AdvanceTo(std::chrono::seconds(6));
+        EXPECT_EQ(std::vector<int>({1, 2}), fired);
+
+        AdvanceTo(std::chrono::seconds(10));
+        EXPECT_EQ(std::vector<int>({1, 2, 3}), fired);
+    }
+
+    TEST_F(TimeoutWheelTest, CallbacksCanCancelOtherTimeouts)
+    {
+        TimeoutWheel::TimeoutId second = TimeoutWheel::noTimeout;
+        static_cast<void>(Schedule(std::chrono::seconds(5), [this, &second]() {
+            fired.push_back(1);
+            static_cast<void>(wheel.Cancel(second));
+        }));
+        second = Schedule(std::chrono::seconds(5), Record(2));
+
+        AdvanceTo(std::chrono::seconds(5));
+        EXPECT_EQ(std::vector<int>({1}), fired);
+    }
+} // namespace UKControllerPluginTest::TimedEvent
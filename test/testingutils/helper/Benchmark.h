@@ -0,0 +1,32 @@
+#pragma once
+#include <chrono>
+#include <iostream>
+
+namespace UKControllerPluginTest {
+    /*
+        Runs the given function for the number of iterations, then reports and returns the
+        mean time taken per iteration.
+
+        Benchmarks are registered as disabled tests so they do not slow down the normal test run. Run them
+        with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+    */
+    template <typename Function>
+    auto RunBenchmark(const std::string& name, int iterations, Function&& function) -> std::chrono::nanoseconds
+    {
+        // Warm up any caches before we start timing
+        function();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            function();
+        }
+        const auto perIteration =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start) /
+            iterations;
+
+        std::cout << "[ BENCHMARK] " << name << ": " << perIteration.count() << "ns per iteration over "
+                  << iterations << " iterations" << std::endl;
+
+        return perIteration;
+    }
+} // namespace UKControllerPluginTest
@@ -50,6 +50,7 @@ namespace UKControllerPluginTest::Api {
         MOCK_CONST_METHOD1(ReadNotification, void(int));
         MOCK_CONST_METHOD0(SyncPluginEvents, nlohmann::json(void));
         MOCK_CONST_METHOD1(GetLatestPluginEvents, nlohmann::json(int));
+        MOCK_CONST_METHOD2(StreamPluginEvents, void(int, const std::function<bool(const std::string&)>&));
         MOCK_CONST_METHOD1(GetUpdateDetails, nlohmann::json(const std::string&));
         MOCK_CONST_METHOD1(UpdateCheck, int(std::string));
         MOCK_CONST_METHOD2(AcknowledgeDepartureReleaseRequest, void(int releaseId, int controllerPositionId));
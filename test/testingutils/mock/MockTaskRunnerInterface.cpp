@@ -19,4 +19,13 @@ namespace UKControllerPluginTest::TaskManager {
             callback();
         };
     };
+
+    /*
+        Tests don't wait for the due time, the task runs straight away if required.
+    */
+    void MockTaskRunnerInterface::QueueAsynchronousTaskAt(
+        std::chrono::steady_clock::time_point due, std::function<void()> callback)
+    {
+        this->QueueAsynchronousTask(std::move(callback));
+    }
 } // namespace UKControllerPluginTest::TaskManager
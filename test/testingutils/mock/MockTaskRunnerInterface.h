@@ -9,6 +9,7 @@ namespace UKControllerPluginTest::TaskManager {
         virtual ~MockTaskRunnerInterface();
         [[nodiscard]] auto CountThreads() const -> size_t override;
         void QueueAsynchronousTask(std::function<void()> callback) override;
+        void QueueAsynchronousTaskAt(std::chrono::steady_clock::time_point due, std::function<void()> callback) override;
 
         private:
         // Whether we actually want to run the task.
@@ -15,6 +15,7 @@ namespace UKControllerPluginTest {
             MOCK_METHOD1(OpenWebBrowser, void(std::wstring));
             MOCK_METHOD1(PlayWave, void(LPCTSTR));
             MOCK_METHOD4(WriteToFile, void(std::wstring, std::string, bool, bool));
+            MOCK_METHOD4(TryWriteToFile, bool(std::wstring, std::string, bool, bool));
             MOCK_METHOD2(ReadFromFileMock, std::string(std::wstring, bool));
             MOCK_METHOD1(FileExists, bool(std::wstring));
             MOCK_METHOD1(CreateFolder, bool(std::wstring folder));
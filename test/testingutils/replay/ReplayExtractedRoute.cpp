@@ -0,0 +1,65 @@
+#include "ReplayExtractedRoute.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    ReplayExtractedRoute::ReplayExtractedRoute(std::vector<RoutePoint> points) : points(std::move(points))
+    {
+    }
+
+    void ReplayExtractedRoute::UpdatePosition(double latitude, double longitude, int groundSpeed)
+    {
+        this->latitude = latitude;
+        this->longitude = longitude;
+        this->groundSpeed = groundSpeed;
+
+        while (pointsPassed < GetPointsNumber() &&
+               DistanceInNauticalMiles(
+                   latitude, longitude, points[pointsPassed].latitude, points[pointsPassed].longitude) <
+                   passedDistance) {
+            pointsPassed++;
+        }
+    }
+
+    auto ReplayExtractedRoute::GetPointDistanceInMinutes(int index) -> int
+    {
+        if (index < pointsPassed) {
+            return pointPassed;
+        }
+
+        if (groundSpeed <= 0) {
+            return 0;
+        }
+
+        const auto& point = points.at(index);
+        return static_cast<int>(
+            DistanceInNauticalMiles(latitude, longitude, point.latitude, point.longitude) / groundSpeed * 60);
+    }
+
+    auto ReplayExtractedRoute::GetPointsAssignedIndex() -> int
+    {
+        return noDirect;
+    }
+
+    auto ReplayExtractedRoute::GetPointsCalculatedIndex() -> int
+    {
+        return std::min(pointsPassed, GetPointsNumber() - 1);
+    }
+
+    auto ReplayExtractedRoute::GetPointsNumber() -> int
+    {
+        return static_cast<int>(points.size());
+    }
+
+    auto ReplayExtractedRoute::GetPointName(int index) -> const char*
+    {
+        return points.at(index).name.c_str();
+    }
+
+    auto ReplayExtractedRoute::GetPointPosition(int index) -> EuroScopePlugIn::CPosition
+    {
+        EuroScopePlugIn::CPosition position;
+        position.m_Latitude = points.at(index).latitude;
+        position.m_Longitude = points.at(index).longitude;
+        return position;
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,38 @@
+#pragma once
+#include "euroscope/EuroscopeExtractedRouteInterface.h"
+#include "TrafficScene.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    /*
+        An extracted route built from the route points in a traffic scene. Points are considered passed
+        once the aircraft has come within a couple of miles of them.
+    */
+    class ReplayExtractedRoute : public UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface
+    {
+        public:
+        explicit ReplayExtractedRoute(std::vector<RoutePoint> points);
+        void UpdatePosition(double latitude, double longitude, int groundSpeed);
+        [[nodiscard]] auto GetPointDistanceInMinutes(int index) -> int override;
+        [[nodiscard]] auto GetPointsAssignedIndex() -> int override;
+        [[nodiscard]] auto GetPointsCalculatedIndex() -> int override;
+        [[nodiscard]] auto GetPointsNumber() -> int override;
+        [[nodiscard]] auto GetPointName(int index) -> const char* override;
+        [[nodiscard]] auto GetPointPosition(int index) -> EuroScopePlugIn::CPosition override;
+
+        private:
+        // The points on the route
+        std::vector<RoutePoint> points;
+
+        // How many points have been passed
+        int pointsPassed = 0;
+
+        // Where the aircraft is
+        double latitude = 0.0;
+        double longitude = 0.0;
+        int groundSpeed = 0;
+
+        // How close an aircraft needs to be to a point to have passed it
+        inline static const double passedDistance = 2.0;
+    };
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,224 @@
+#include "ReplayExtractedRoute.h"
+#include "ReplayFlightplan.h"
+#include "flightplan/ParsedFlightplanFactory.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    ReplayFlightplan::ReplayFlightplan(RecordedFlightplan flightplan, const RecordedTarget& target)
+        : flightplan(std::move(flightplan)),
+          route(std::make_unique<ReplayExtractedRoute>(this->flightplan.routePoints)), latitude(target.latitude),
+          longitude(target.longitude), squawk(target.squawk), tracked(target.tracked),
+          trackedByUser(target.trackedByUser)
+    {
+        route->UpdatePosition(target.latitude, target.longitude, target.groundSpeed);
+    }
+
+    ReplayFlightplan::~ReplayFlightplan() = default;
+
+    void ReplayFlightplan::Update(const RecordedTarget& target)
+    {
+        latitude = target.latitude;
+        longitude = target.longitude;
+        squawk = target.squawk;
+        tracked = target.tracked;
+        trackedByUser = target.trackedByUser;
+        route->UpdatePosition(target.latitude, target.longitude, target.groundSpeed);
+    }
+
+    void ReplayFlightplan::AnnotateFlightStrip(int index, std::string data) const
+    {
+        annotations.at(index) = std::move(data);
+    }
+
+    std::string ReplayFlightplan::GetAnnotation(int index) const
+    {
+        return annotations.at(index);
+    }
+
+    std::string ReplayFlightplan::GetCallsign() const
+    {
+        return flightplan.callsign;
+    }
+
+    int ReplayFlightplan::GetClearedAltitude() const
+    {
+        return clearedAltitude;
+    }
+
+    int ReplayFlightplan::GetAssignedHeading() const
+    {
+        return assignedHeading;
+    }
+
+    int ReplayFlightplan::GetCruiseLevel() const
+    {
+        return flightplan.cruiseLevel;
+    }
+
+    std::string ReplayFlightplan::GetDestination() const
+    {
+        return flightplan.destination;
+    }
+
+    double ReplayFlightplan::GetDistanceFromOrigin() const
+    {
+        if (flightplan.routePoints.empty()) {
+            return 0.0;
+        }
+
+        const auto& origin = flightplan.routePoints.front();
+        return DistanceInNauticalMiles(latitude, longitude, origin.latitude, origin.longitude);
+    }
+
+    double ReplayFlightplan::GetDistanceToDestination() const
+    {
+        if (flightplan.routePoints.empty()) {
+            return 0.0;
+        }
+
+        const auto& destination = flightplan.routePoints.back();
+        return DistanceInNauticalMiles(latitude, longitude, destination.latitude, destination.longitude);
+    }
+
+    std::string ReplayFlightplan::GetExpectedDepartureTime() const
+    {
+        return "";
+    }
+
+    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface& ReplayFlightplan::GetExtractedRoute() const
+    {
+        return *route;
+    }
+
+    std::shared_ptr<UKControllerPlugin::Flightplan::ParsedFlightplan> ReplayFlightplan::GetParsedFlightplan() const
+    {
+        if (!parsedFlightplan) {
+            parsedFlightplan = UKControllerPlugin::Flightplan::ParseFlightplanFromEuroscope(*route);
+        }
+
+        return parsedFlightplan;
+    }
+
+    std::string ReplayFlightplan::GetFlightRules() const
+    {
+        return flightplan.flightRules;
+    }
+
+    std::string ReplayFlightplan::GetGroundState() const
+    {
+        return "";
+    }
+
+    std::string ReplayFlightplan::GetOrigin() const
+    {
+        return flightplan.origin;
+    }
+
+    std::string ReplayFlightplan::GetRawRouteString() const
+    {
+        return flightplan.route;
+    }
+
+    std::string ReplayFlightplan::GetSidName() const
+    {
+        return "";
+    }
+
+    std::string ReplayFlightplan::GetAssignedSquawk() const
+    {
+        return assignedSquawk.value_or(squawk);
+    }
+
+    std::string ReplayFlightplan::GetAircraftType() const
+    {
+        return flightplan.aircraftType;
+    }
+
+    std::string ReplayFlightplan::GetIcaoWakeCategory() const
+    {
+        return flightplan.wakeCategory;
+    }
+
+    bool ReplayFlightplan::HasAssignedSquawk() const
+    {
+        return assignedSquawk.has_value();
+    }
+
+    bool ReplayFlightplan::HasControllerClearedAltitude() const
+    {
+        return clearedAltitude != 0;
+    }
+
+    bool ReplayFlightplan::HasControllerAssignedHeading() const
+    {
+        return assignedHeading != 0;
+    }
+
+    bool ReplayFlightplan::HasSid() const
+    {
+        return false;
+    }
+
+    void ReplayFlightplan::SetClearedAltitude(int cleared)
+    {
+        clearedAltitude = cleared;
+    }
+
+    void ReplayFlightplan::SetHeading(int heading)
+    {
+        assignedHeading = heading;
+    }
+
+    void ReplayFlightplan::SetSquawk(std::string squawk)
+    {
+        assignedSquawk = std::move(squawk);
+    }
+
+    bool ReplayFlightplan::IsSimulated() const
+    {
+        return false;
+    }
+
+    bool ReplayFlightplan::IsTracked() const
+    {
+        return tracked;
+    }
+
+    bool ReplayFlightplan::IsTrackedByUser() const
+    {
+        return trackedByUser;
+    }
+
+    bool ReplayFlightplan::IsValid() const
+    {
+        return true;
+    }
+
+    bool ReplayFlightplan::IsVfr() const
+    {
+        return flightplan.flightRules == "V";
+    }
+
+    /*
+        There's no EuroScope behind a replay, so anything that needs the real object can't be replayed.
+    */
+    EuroScopePlugIn::CFlightPlan& ReplayFlightplan::GetEuroScopeObject() const
+    {
+        throw std::logic_error("EuroScope flightplans are not available during a replay");
+    }
+
+    auto ReplayFlightplan::GetRemarks() const -> std::string
+    {
+        return flightplan.remarks;
+    }
+
+    auto ReplayFlightplan::GetDepartureRunway() const -> std::string
+    {
+        return "";
+    }
+
+    auto ReplayFlightplan::GetArrivalRunway() const -> std::string
+    {
+        return "";
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,90 @@
+#pragma once
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "TrafficScene.h"
+
+namespace UKControllerPluginTest::Replay {
+    class ReplayExtractedRoute;
+
+    /*
+        A flightplan whose details come from a traffic scene. Anything set by the plugin, such as
+        cleared altitudes and annotations, is remembered for the rest of the replay.
+    */
+    class ReplayFlightplan : public UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface
+    {
+        public:
+        ReplayFlightplan(RecordedFlightplan flightplan, const RecordedTarget& target);
+        ~ReplayFlightplan() override;
+        ReplayFlightplan(const ReplayFlightplan&) = delete;
+        ReplayFlightplan(ReplayFlightplan&&) noexcept = delete;
+        auto operator=(const ReplayFlightplan&) -> ReplayFlightplan& = delete;
+        auto operator=(ReplayFlightplan&&) noexcept -> ReplayFlightplan& = delete;
+        void Update(const RecordedTarget& target);
+        void AnnotateFlightStrip(int index, std::string data) const override;
+        [[nodiscard]] std::string GetAnnotation(int index) const override;
+        [[nodiscard]] std::string GetCallsign() const override;
+        [[nodiscard]] int GetClearedAltitude() const override;
+        [[nodiscard]] int GetAssignedHeading() const override;
+        [[nodiscard]] int GetCruiseLevel() const override;
+        [[nodiscard]] std::string GetDestination() const override;
+        [[nodiscard]] double GetDistanceFromOrigin() const override;
+        [[nodiscard]] double GetDistanceToDestination() const override;
+        [[nodiscard]] std::string GetExpectedDepartureTime() const override;
+        [[nodiscard]] UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface&
+        GetExtractedRoute() const override;
+        [[nodiscard]] std::shared_ptr<UKControllerPlugin::Flightplan::ParsedFlightplan>
+        GetParsedFlightplan() const override;
+        [[nodiscard]] std::string GetFlightRules() const override;
+        [[nodiscard]] std::string GetGroundState() const override;
+        [[nodiscard]] std::string GetOrigin() const override;
+        [[nodiscard]] std::string GetRawRouteString() const override;
+        [[nodiscard]] std::string GetSidName() const override;
+        [[nodiscard]] std::string GetAssignedSquawk() const override;
+        [[nodiscard]] std::string GetAircraftType() const override;
+        [[nodiscard]] std::string GetIcaoWakeCategory() const override;
+        [[nodiscard]] bool HasAssignedSquawk() const override;
+        [[nodiscard]] bool HasControllerClearedAltitude() const override;
+        [[nodiscard]] bool HasControllerAssignedHeading() const override;
+        [[nodiscard]] bool HasSid() const override;
+        void SetClearedAltitude(int cleared) override;
+        void SetHeading(int heading) override;
+        void SetSquawk(std::string squawk) override;
+        [[nodiscard]] bool IsSimulated() const override;
+        [[nodiscard]] bool IsTracked() const override;
+        [[nodiscard]] bool IsTrackedByUser() const override;
+        [[nodiscard]] bool IsValid() const override;
+        [[nodiscard]] bool IsVfr() const override;
+        [[nodiscard]] EuroScopePlugIn::CFlightPlan& GetEuroScopeObject() const override;
+        [[nodiscard]] auto GetRemarks() const -> std::string override;
+        [[nodiscard]] auto GetDepartureRunway() const -> std::string override;
+        [[nodiscard]] auto GetArrivalRunway() const -> std::string override;
+
+        private:
+        // The recorded details
+        const RecordedFlightplan flightplan;
+
+        // The extracted route
+        std::unique_ptr<ReplayExtractedRoute> route;
+
+        // The parsed route, built on first use
+        mutable std::shared_ptr<UKControllerPlugin::Flightplan::ParsedFlightplan> parsedFlightplan;
+
+        // Annotations on the flight strip
+        mutable std::array<std::string, 9> annotations;
+
+        // Where the aircraft is
+        double latitude;
+        double longitude;
+
+        // The squawk, which comes from the scene unless the plugin sets it
+        std::string squawk;
+        std::optional<std::string> assignedSquawk;
+
+        // Tracking state
+        bool tracked;
+        bool trackedByUser;
+
+        // Things the plugin has set
+        int clearedAltitude = 0;
+        int assignedHeading = 0;
+    };
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,59 @@
+#include "ReplayFlightplanList.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+
+namespace UKControllerPluginTest::Replay {
+
+    int ReplayFlightplanList::NumberOfColumns()
+    {
+        return columns;
+    }
+
+    void ReplayFlightplanList::AddColumn(
+        std::string title,
+        int width,
+        bool centered,
+        std::string tagItemProvider,
+        int tagItemId,
+        std::string leftMouseFunctionProvider,
+        int leftMouseFunctionId,
+        std::string rightMouseFunctionProvider,
+        int rightMouseFunctionId)
+    {
+        columns++;
+    }
+
+    void ReplayFlightplanList::AddFlightplan(EuroScopeCFlightPlanInterface& flightplan)
+    {
+        callsigns.insert(flightplan.GetCallsign());
+    }
+
+    void ReplayFlightplanList::AddFlightplan(std::shared_ptr<EuroScopeCFlightPlanInterface> flightplan)
+    {
+        AddFlightplan(*flightplan);
+    }
+
+    void ReplayFlightplanList::RemoveFlightplan(EuroScopeCFlightPlanInterface& flightplan)
+    {
+        callsigns.erase(flightplan.GetCallsign());
+    }
+
+    void ReplayFlightplanList::RemoveFlightplan(std::shared_ptr<EuroScopeCFlightPlanInterface> flightplan)
+    {
+        RemoveFlightplan(*flightplan);
+    }
+
+    void ReplayFlightplanList::Show()
+    {
+    }
+
+    void ReplayFlightplanList::Hide()
+    {
+    }
+
+    auto ReplayFlightplanList::Callsigns() const -> const std::set<std::string>&
+    {
+        return callsigns;
+    }
+} // namespace UKControllerPluginTest::Replay
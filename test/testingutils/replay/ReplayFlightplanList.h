@@ -0,0 +1,40 @@
+#pragma once
+#include "euroscope/EuroscopeFlightplanListInterface.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    /*
+        A flightplan list that keeps track of what is in it, but never displays anything.
+    */
+    class ReplayFlightplanList : public UKControllerPlugin::Euroscope::EuroscopeFlightplanListInterface
+    {
+        public:
+        int NumberOfColumns() override;
+        void AddColumn(
+            std::string title,
+            int width,
+            bool centered,
+            std::string tagItemProvider,
+            int tagItemId,
+            std::string leftMouseFunctionProvider,
+            int leftMouseFunctionId,
+            std::string rightMouseFunctionProvider,
+            int rightMouseFunctionId) override;
+        void AddFlightplan(UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan) override;
+        void AddFlightplan(
+            std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface> flightplan) override;
+        void RemoveFlightplan(UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan) override;
+        void RemoveFlightplan(
+            std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface> flightplan) override;
+        void Show() override;
+        void Hide() override;
+        [[nodiscard]] auto Callsigns() const -> const std::set<std::string>&;
+
+        private:
+        // How many columns have been added
+        int columns = 0;
+
+        // The flightplans in the list
+        std::set<std::string> callsigns;
+    };
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,187 @@
+#include "ReplayFlightplan.h"
+#include "ReplayFlightplanList.h"
+#include "ReplayPluginLoopback.h"
+#include "ReplayRadarTarget.h"
+#include "TrafficScene.h"
+
+using UKControllerPlugin::Euroscope::EuroScopeCControllerInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroscopeFlightplanListInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Plugin::PopupMenuItem;
+
+namespace UKControllerPluginTest::Replay {
+
+    ReplayPluginLoopback::ReplayPluginLoopback() = default;
+    ReplayPluginLoopback::~ReplayPluginLoopback() = default;
+
+    void ReplayPluginLoopback::AddAircraft(
+        std::shared_ptr<ReplayFlightplan> flightplan, std::shared_ptr<ReplayRadarTarget> radarTarget)
+    {
+        const auto callsign = flightplan->GetCallsign();
+        aircraft[callsign] = {std::move(flightplan), std::move(radarTarget)};
+    }
+
+    void ReplayPluginLoopback::RemoveAircraft(const std::string& callsign)
+    {
+        aircraft.erase(callsign);
+    }
+
+    auto ReplayPluginLoopback::CountAircraft() const -> size_t
+    {
+        return aircraft.size();
+    }
+
+    auto ReplayPluginLoopback::GetReplayFlightplan(const std::string& callsign) const
+        -> std::shared_ptr<ReplayFlightplan>
+    {
+        const auto replayAircraft = aircraft.find(callsign);
+        return replayAircraft == aircraft.cend() ? nullptr : replayAircraft->second.flightplan;
+    }
+
+    auto ReplayPluginLoopback::GetReplayRadarTarget(const std::string& callsign) const
+        -> std::shared_ptr<ReplayRadarTarget>
+    {
+        const auto replayAircraft = aircraft.find(callsign);
+        return replayAircraft == aircraft.cend() ? nullptr : replayAircraft->second.radarTarget;
+    }
+
+    void ReplayPluginLoopback::SetVisibilityCentre(double latitude, double longitude)
+    {
+        visibilityCentreLatitude = latitude;
+        visibilityCentreLongitude = longitude;
+    }
+
+    auto ReplayPluginLoopback::RegisteredTagItems() const -> const std::map<int, std::string>&
+    {
+        return tagItems;
+    }
+
+    auto ReplayPluginLoopback::ChatAreaMessageCount() const -> size_t
+    {
+        return chatAreaMessages;
+    }
+
+    void ReplayPluginLoopback::AddItemToPopupList(PopupMenuItem item)
+    {
+    }
+
+    void ReplayPluginLoopback::ChatAreaMessage(
+        std::string handler,
+        std::string sender,
+        std::string message,
+        bool showHandler,
+        bool markUnread,
+        bool overrideBusy,
+        bool flash,
+        bool confirm)
+    {
+        chatAreaMessages++;
+    }
+
+    std::shared_ptr<EuroScopeCControllerInterface> ReplayPluginLoopback::GetUserControllerObject() const
+    {
+        return nullptr;
+    }
+
+    int ReplayPluginLoopback::GetEuroscopeConnectionStatus() const
+    {
+        return EuroScopePlugIn::CONNECTION_TYPE_DIRECT;
+    }
+
+    double ReplayPluginLoopback::GetDistanceFromUserVisibilityCentre(EuroScopePlugIn::CPosition position) const
+    {
+        return DistanceInNauticalMiles(
+            visibilityCentreLatitude, visibilityCentreLongitude, position.m_Latitude, position.m_Longitude);
+    }
+
+    std::shared_ptr<EuroScopeCFlightPlanInterface>
+    ReplayPluginLoopback::GetFlightplanForCallsign(std::string callsign) const
+    {
+        return GetReplayFlightplan(callsign);
+    }
+
+    std::shared_ptr<EuroScopeCRadarTargetInterface>
+    ReplayPluginLoopback::GetRadarTargetForCallsign(std::string callsign) const
+    {
+        return GetReplayRadarTarget(callsign);
+    }
+
+    std::shared_ptr<EuroScopeCFlightPlanInterface> ReplayPluginLoopback::GetSelectedFlightplan() const
+    {
+        return GetReplayFlightplan(selectedCallsign);
+    }
+
+    std::shared_ptr<EuroScopeCRadarTargetInterface> ReplayPluginLoopback::GetSelectedRadarTarget() const
+    {
+        return GetReplayRadarTarget(selectedCallsign);
+    }
+
+    void ReplayPluginLoopback::TriggerPopupList(RECT area, std::string title, int numColumns)
+    {
+    }
+
+    void ReplayPluginLoopback::TriggerFlightplanUpdateForCallsign(std::string callsign)
+    {
+    }
+
+    void ReplayPluginLoopback::RegisterTagFunction(int itemCode, std::string description)
+    {
+    }
+
+    void ReplayPluginLoopback::RegisterTagItem(int itemCode, std::string description)
+    {
+        tagItems[itemCode] = std::move(description);
+    }
+
+    void ReplayPluginLoopback::ApplyFunctionToAllFlightplans(
+        std::function<
+            void(std::shared_ptr<EuroScopeCFlightPlanInterface>, std::shared_ptr<EuroScopeCRadarTargetInterface>)>
+            function)
+    {
+        for (const auto& replayAircraft : aircraft) {
+            function(replayAircraft.second.flightplan, replayAircraft.second.radarTarget);
+        }
+    }
+
+    void ReplayPluginLoopback::ApplyFunctionToAllFlightplans(
+        std::function<void(EuroScopeCFlightPlanInterface&, EuroScopeCRadarTargetInterface&)> function)
+    {
+        for (const auto& replayAircraft : aircraft) {
+            function(*replayAircraft.second.flightplan, *replayAircraft.second.radarTarget);
+        }
+    }
+
+    void ReplayPluginLoopback::ApplyFunctionToAllFlightplans(
+        std::function<void(const EuroScopeCFlightPlanInterface&, const EuroScopeCRadarTargetInterface&)> function)
+        const
+    {
+        for (const auto& replayAircraft : aircraft) {
+            function(*replayAircraft.second.flightplan, *replayAircraft.second.radarTarget);
+        }
+    }
+
+    void ReplayPluginLoopback::ApplyFunctionToAllControllers(
+        std::function<void(std::shared_ptr<EuroScopeCControllerInterface>)> function)
+    {
+    }
+
+    void ReplayPluginLoopback::ShowTextEditPopup(RECT editArea, int callbackId, std::string initialValue)
+    {
+    }
+
+    std::shared_ptr<EuroscopeFlightplanListInterface> ReplayPluginLoopback::RegisterFlightplanList(std::string name)
+    {
+        return std::make_shared<ReplayFlightplanList>();
+    }
+
+    void ReplayPluginLoopback::SetEuroscopeSelectedFlightplan(std::shared_ptr<EuroScopeCFlightPlanInterface> flightplan)
+    {
+        SetEuroscopeSelectedFlightplan(*flightplan);
+    }
+
+    void ReplayPluginLoopback::SetEuroscopeSelectedFlightplan(const EuroScopeCFlightPlanInterface& flightplan)
+    {
+        selectedCallsign = flightplan.GetCallsign();
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,102 @@
+#pragma once
+#include "euroscope/EuroscopePluginLoopbackInterface.h"
+
+namespace UKControllerPluginTest::Replay {
+    class ReplayFlightplan;
+    class ReplayRadarTarget;
+
+    /*
+        Stands in for EuroScope during a traffic replay, serving the flightplans and radar targets
+        that are currently in the scene.
+    */
+    class ReplayPluginLoopback : public UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface
+    {
+        public:
+        ReplayPluginLoopback();
+        ~ReplayPluginLoopback() override;
+        ReplayPluginLoopback(const ReplayPluginLoopback&) = delete;
+        ReplayPluginLoopback(ReplayPluginLoopback&&) noexcept = delete;
+        auto operator=(const ReplayPluginLoopback&) -> ReplayPluginLoopback& = delete;
+        auto operator=(ReplayPluginLoopback&&) noexcept -> ReplayPluginLoopback& = delete;
+        void AddAircraft(std::shared_ptr<ReplayFlightplan> flightplan, std::shared_ptr<ReplayRadarTarget> radarTarget);
+        void RemoveAircraft(const std::string& callsign);
+        [[nodiscard]] auto CountAircraft() const -> size_t;
+        [[nodiscard]] auto GetReplayFlightplan(const std::string& callsign) const -> std::shared_ptr<ReplayFlightplan>;
+        [[nodiscard]] auto GetReplayRadarTarget(const std::string& callsign) const
+            -> std::shared_ptr<ReplayRadarTarget>;
+        void SetVisibilityCentre(double latitude, double longitude);
+        [[nodiscard]] auto RegisteredTagItems() const -> const std::map<int, std::string>&;
+        [[nodiscard]] auto ChatAreaMessageCount() const -> size_t;
+        void AddItemToPopupList(UKControllerPlugin::Plugin::PopupMenuItem item) override;
+        void ChatAreaMessage(
+            std::string handler,
+            std::string sender,
+            std::string message,
+            bool showHandler,
+            bool markUnread,
+            bool overrideBusy,
+            bool flash,
+            bool confirm) override;
+        std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>
+        GetUserControllerObject() const override;
+        int GetEuroscopeConnectionStatus() const override;
+        double GetDistanceFromUserVisibilityCentre(EuroScopePlugIn::CPosition position) const override;
+        std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface>
+        GetFlightplanForCallsign(std::string callsign) const override;
+        std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface>
+        GetRadarTargetForCallsign(std::string callsign) const override;
+        std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface>
+        GetSelectedFlightplan() const override;
+        std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface>
+        GetSelectedRadarTarget() const override;
+        void TriggerPopupList(RECT area, std::string title, int numColumns) override;
+        void TriggerFlightplanUpdateForCallsign(std::string callsign) override;
+        void RegisterTagFunction(int itemCode, std::string description) override;
+        void RegisterTagItem(int itemCode, std::string description) override;
+        void ApplyFunctionToAllFlightplans(
+            std::function<void(
+                std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface>,
+                std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface>)> function) override;
+        void ApplyFunctionToAllFlightplans(
+            std::function<void(
+                UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface&,
+                UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface&)> function) override;
+        void ApplyFunctionToAllFlightplans(
+            std::function<void(
+                const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface&,
+                const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface&)> function) const override;
+        void ApplyFunctionToAllControllers(
+            std::function<void(std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>)>
+                function) override;
+        void ShowTextEditPopup(RECT editArea, int callbackId, std::string initialValue) override;
+        std::shared_ptr<UKControllerPlugin::Euroscope::EuroscopeFlightplanListInterface>
+        RegisterFlightplanList(std::string name) override;
+        void SetEuroscopeSelectedFlightplan(
+            std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface> flightplan) override;
+        void SetEuroscopeSelectedFlightplan(
+            const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightplan) override;
+
+        private:
+        using ReplayAircraft = struct ReplayAircraft
+        {
+            std::shared_ptr<ReplayFlightplan> flightplan;
+            std::shared_ptr<ReplayRadarTarget> radarTarget;
+        };
+
+        // The aircraft currently in the scene, kept in callsign order so iteration is repeatable
+        std::map<std::string, ReplayAircraft> aircraft;
+
+        // The selected aircraft
+        std::string selectedCallsign;
+
+        // Tag items that have been registered
+        std::map<int, std::string> tagItems;
+
+        // How many chat area messages have been sent
+        size_t chatAreaMessages = 0;
+
+        // The centre of the user's visibility
+        double visibilityCentreLatitude = 51.5;
+        double visibilityCentreLongitude = -0.2;
+    };
+} // namespace UKControllerPluginTest::Replay
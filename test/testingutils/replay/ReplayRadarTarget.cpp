@@ -0,0 +1,64 @@
+#include "ReplayRadarTarget.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    ReplayRadarTarget::ReplayRadarTarget(RecordedTarget target) : target(std::move(target))
+    {
+    }
+
+    void ReplayRadarTarget::Update(const RecordedTarget& target)
+    {
+        this->target = target;
+    }
+
+    auto ReplayRadarTarget::Target() const -> const RecordedTarget&
+    {
+        return target;
+    }
+
+    const std::string ReplayRadarTarget::GetCallsign() const
+    {
+        return target.callsign;
+    }
+
+    int ReplayRadarTarget::GetFlightLevel() const
+    {
+        return target.altitude;
+    }
+
+    auto ReplayRadarTarget::GetAltitude() const -> int
+    {
+        return target.altitude;
+    }
+
+    const EuroScopePlugIn::CPosition ReplayRadarTarget::GetPosition() const
+    {
+        EuroScopePlugIn::CPosition position;
+        position.m_Latitude = target.latitude;
+        position.m_Longitude = target.longitude;
+        return position;
+    }
+
+    int ReplayRadarTarget::GetGroundSpeed() const
+    {
+        return target.groundSpeed;
+    }
+
+    int ReplayRadarTarget::GetVerticalSpeed() const
+    {
+        return target.verticalSpeed;
+    }
+
+    double ReplayRadarTarget::GetHeading() const
+    {
+        return target.heading;
+    }
+
+    /*
+        There's no EuroScope behind a replay, so anything that needs the real object can't be replayed.
+    */
+    EuroScopePlugIn::CRadarTarget& ReplayRadarTarget::GetEuroScopeObject() const
+    {
+        throw std::logic_error("EuroScope radar targets are not available during a replay");
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,29 @@
+#pragma once
+#include "euroscope/EuroScopeCRadarTargetInterface.h"
+#include "TrafficScene.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    /*
+        A radar target whose position comes from the current frame of a traffic scene.
+    */
+    class ReplayRadarTarget : public UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface
+    {
+        public:
+        explicit ReplayRadarTarget(RecordedTarget target);
+        void Update(const RecordedTarget& target);
+        [[nodiscard]] auto Target() const -> const RecordedTarget&;
+        [[nodiscard]] const std::string GetCallsign() const override;
+        [[nodiscard]] int GetFlightLevel() const override;
+        [[nodiscard]] auto GetAltitude() const -> int override;
+        [[nodiscard]] const EuroScopePlugIn::CPosition GetPosition() const override;
+        [[nodiscard]] int GetGroundSpeed() const override;
+        [[nodiscard]] int GetVerticalSpeed() const override;
+        [[nodiscard]] double GetHeading() const override;
+        [[nodiscard]] EuroScopePlugIn::CRadarTarget& GetEuroScopeObject() const override;
+
+        private:
+        // The latest recorded state
+        RecordedTarget target;
+    };
+} // namespace UKControllerPluginTest::Replay
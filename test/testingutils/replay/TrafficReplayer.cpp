@@ -0,0 +1,236 @@
+#include "ReplayFlightplan.h"
+#include "ReplayPluginLoopback.h"
+#include "ReplayRadarTarget.h"
+#include "TrafficReplayer.h"
+#include "euroscope/RadarTargetEventHandlerInterface.h"
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "tag/TagData.h"
+#include "tag/TagItemInterface.h"
+#include "timedevent/TimedEventCollection.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    TrafficReplayer::TrafficReplayer(TrafficScene scene, ReplayPluginLoopback& plugin)
+        : scene(std::move(scene)), plugin(plugin)
+    {
+        for (const auto& flightplan : this->scene.flightplans) {
+            flightplans[flightplan.callsign] = flightplan;
+        }
+    }
+
+    TrafficReplayer::~TrafficReplayer() = default;
+
+    void TrafficReplayer::AddModule(ReplayModule module)
+    {
+        timings.push_back({module.name});
+        modules.push_back(std::move(module));
+    }
+
+    auto TrafficReplayer::Step() -> bool
+    {
+        if (nextFrame >= scene.frames.size()) {
+            return false;
+        }
+
+        ReplayFrame(scene.frames[nextFrame++]);
+        return true;
+    }
+
+    void TrafficReplayer::Run(double speed)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto startFrame = nextFrame;
+        while (nextFrame < scene.frames.size()) {
+            if (speed > 0.0) {
+                const auto simulatedElapsed = scene.frames[nextFrame].time - scene.frames[startFrame].time;
+                std::this_thread::sleep_until(
+                    start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(simulatedElapsed / speed)));
+            }
+
+            static_cast<void>(Step());
+        }
+    }
+
+    auto TrafficReplayer::SimulatedSeconds() const -> double
+    {
+        if (nextFrame == 0) {
+            return 0.0;
+        }
+
+        return scene.frames[nextFrame - 1].time - scene.frames.front().time;
+    }
+
+    auto TrafficReplayer::Timings() const -> const std::vector<ReplayModuleTiming>&
+    {
+        return timings;
+    }
+
+    void TrafficReplayer::Report(std::ostream& output) const
+    {
+        const auto simulatedSeconds = std::max(SimulatedSeconds(), 1.0);
+        const auto perSecond = [simulatedSeconds](std::chrono::nanoseconds time) {
+            return std::chrono::duration<double, std::milli>(time).count() / simulatedSeconds;
+        };
+
+        output << "[ REPLAY   ] " << simulatedSeconds << " simulated seconds, " << plugin.CountAircraft()
+               << " aircraft in the final frame" << std::endl;
+        for (const auto& timing : timings) {
+            output << "[ REPLAY   ] " << timing.name << ": " << perSecond(timing.Total())
+                   << "ms per simulated second (flightplan events " << perSecond(timing.flightplanEvents)
+                   << "ms, radar target events " << perSecond(timing.radarTargetEvents) << "ms, timed events "
+                   << perSecond(timing.timedEvents) << "ms, tag items " << perSecond(timing.tagItems) << "ms)"
+                   << std::endl;
+        }
+    }
+
+    void TrafficReplayer::ReplayFrame(const TrafficFrame& frame)
+    {
+        UpdateAircraft(frame);
+        DisconnectAircraft(frame);
+        TickTimedEvents(frame.time);
+        QueryTagItems();
+    }
+
+    /*
+        Bring every aircraft in the frame up to date, firing the events that EuroScope would.
+    */
+    void TrafficReplayer::UpdateAircraft(const TrafficFrame& frame)
+    {
+        for (const auto& target : frame.targets) {
+            auto existing = aircraft.find(target.callsign);
+            if (existing == aircraft.cend()) {
+                const auto recordedFlightplan = flightplans.find(target.callsign);
+                auto flightplan = std::make_shared<ReplayFlightplan>(
+                    recordedFlightplan == flightplans.cend() ? RecordedFlightplan{target.callsign}
+                                                             : recordedFlightplan->second,
+                    target);
+                auto radarTarget = std::make_shared<ReplayRadarTarget>(target);
+                plugin.AddAircraft(flightplan, radarTarget);
+                existing = aircraft.insert({target.callsign, {flightplan, radarTarget}}).first;
+
+                TimeModules(&ReplayModuleTiming::flightplanEvents, [&existing](const ReplayModule& module) {
+                    for (const auto& handler : module.flightplanHandlers) {
+                        handler->FlightPlanEvent(*existing->second.flightplan, *existing->second.radarTarget);
+                    }
+                });
+            } else {
+                const auto& previous = existing->second.radarTarget->Target();
+                const bool squawkChanged = previous.squawk != target.squawk;
+                const bool trackingChanged =
+                    previous.tracked != target.tracked || previous.trackedByUser != target.trackedByUser;
+                existing->second.flightplan->Update(target);
+                existing->second.radarTarget->Update(target);
+
+                if (squawkChanged) {
+                    TimeModules(&ReplayModuleTiming::flightplanEvents, [&existing](const ReplayModule& module) {
+                        for (const auto& handler : module.flightplanHandlers) {
+                            handler->ControllerFlightPlanDataEvent(
+                                *existing->second.flightplan, EuroScopePlugIn::CTR_DATA_TYPE_SQUAWK);
+                        }
+                    });
+                }
+
+                if (trackingChanged) {
+                    TimeModules(&ReplayModuleTiming::flightplanEvents, [&existing](const ReplayModule& module) {
+                        for (const auto& handler : module.flightplanHandlers) {
+                            handler->FlightPlanEvent(*existing->second.flightplan, *existing->second.radarTarget);
+                        }
+                    });
+                }
+            }
+        }
+
+        // Time each module across the whole frame, so the clock isn't read once per aircraft
+        TimeModules(&ReplayModuleTiming::radarTargetEvents, [this, &frame](const ReplayModule& module) {
+            for (const auto& target : frame.targets) {
+                for (const auto& handler : module.radarTargetHandlers) {
+                    handler->RadarTargetPositionUpdateEvent(*aircraft.at(target.callsign).radarTarget);
+                }
+            }
+        });
+    }
+
+    /*
+        Any aircraft not in the frame have disconnected.
+    */
+    void TrafficReplayer::DisconnectAircraft(const TrafficFrame& frame)
+    {
+        std::set<std::string> inFrame;
+        for (const auto& target : frame.targets) {
+            inFrame.insert(target.callsign);
+        }
+
+        for (auto replayedAircraft = aircraft.begin(); replayedAircraft != aircraft.end();) {
+            if (inFrame.contains(replayedAircraft->first)) {
+                ++replayedAircraft;
+                continue;
+            }
+
+            TimeModules(&ReplayModuleTiming::flightplanEvents, [&replayedAircraft](const ReplayModule& module) {
+                for (const auto& handler : module.flightplanHandlers) {
+                    handler->FlightPlanDisconnectEvent(*replayedAircraft->second.flightplan);
+                }
+            });
+
+            plugin.RemoveAircraft(replayedAircraft->first);
+            replayedAircraft = aircraft.erase(replayedAircraft);
+        }
+    }
+
+    /*
+        EuroScope calls OnTimer once a second, so tick every second that the frame has moved us on by.
+    */
+    void TrafficReplayer::TickTimedEvents(double time)
+    {
+        const auto second = static_cast<int>(std::floor(time));
+        for (int tick = lastTickedSecond.has_value() ? *lastTickedSecond + 1 : second; tick <= second; tick++) {
+            TimeModules(&ReplayModuleTiming::timedEvents, [tick](const ReplayModule& module) {
+                if (module.timedEvents) {
+                    module.timedEvents->Tick(tick);
+                }
+            });
+        }
+
+        lastTickedSecond = std::max(second, lastTickedSecond.value_or(second));
+    }
+
+    /*
+        Ask every tag item for every aircraft, as EuroScope does when drawing tags.
+    */
+    void TrafficReplayer::QueryTagItems()
+    {
+        std::array<char, UKControllerPlugin::Tag::TagData::maxItemSize> itemString{};
+        int euroscopeColourCode = EuroScopePlugIn::TAG_COLOR_DEFAULT;
+        COLORREF tagColour = RGB(255, 255, 255);
+        double fontSize = 0.0;
+
+        TimeModules(&ReplayModuleTiming::tagItems, [&](const ReplayModule& module) {
+            for (const auto& replayedAircraft : aircraft) {
+                for (const auto& tagItem : module.tagItems) {
+                    itemString[0] = '\0';
+                    UKControllerPlugin::Tag::TagData tagData(
+                        *replayedAircraft.second.flightplan,
+                        *replayedAircraft.second.radarTarget,
+                        tagItem.tagItemId,
+                        EuroScopePlugIn::TAG_DATA_CORRELATED,
+                        itemString.data(),
+                        &euroscopeColourCode,
+                        &tagColour,
+                        &fontSize);
+                    tagItem.tagItem->SetTagItemData(tagData);
+                }
+            }
+        });
+    }
+
+    template <typename Function>
+    void TrafficReplayer::TimeModules(std::chrono::nanoseconds ReplayModuleTiming::*category, Function&& function)
+    {
+        for (size_t i = 0; i < modules.size(); i++) {
+            const auto start = std::chrono::steady_clock::now();
+            function(modules[i]);
+            timings[i].*category += std::chrono::steady_clock::now() - start;
+        }
+    }
+} // namespace UKControllerPluginTest::Replay
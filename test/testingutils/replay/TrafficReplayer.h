@@ -0,0 +1,140 @@
+#pragma once
+#include "TrafficScene.h"
+
+namespace UKControllerPlugin {
+    namespace Euroscope {
+        class RadarTargetEventHandlerInterface;
+    } // namespace Euroscope
+    namespace Flightplan {
+        class FlightPlanEventHandlerInterface;
+    } // namespace Flightplan
+    namespace Tag {
+        class TagItemInterface;
+    } // namespace Tag
+    namespace TimedEvent {
+        class TimedEventCollection;
+    } // namespace TimedEvent
+} // namespace UKControllerPlugin
+
+namespace UKControllerPluginTest::Replay {
+    class ReplayFlightplan;
+    class ReplayPluginLoopback;
+    class ReplayRadarTarget;
+
+    // A tag item, and the id that EuroScope would ask for it with
+    using ReplayTagItem = struct ReplayTagItem
+    {
+        int tagItemId;
+        std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem;
+    };
+
+    // The handlers that make up one module of the plugin
+    using ReplayModule = struct ReplayModule
+    {
+        // The name to report the module under
+        std::string name;
+
+        std::vector<std::shared_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface>>
+            flightplanHandlers;
+        std::vector<std::shared_ptr<UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface>>
+            radarTargetHandlers;
+        std::vector<ReplayTagItem> tagItems;
+
+        // The module's timed events, ticked once per simulated second
+        std::shared_ptr<UKControllerPlugin::TimedEvent::TimedEventCollection> timedEvents;
+    };
+
+    // How long a module has spent handling each kind of event
+    using ReplayModuleTiming = struct ReplayModuleTiming
+    {
+        std::string name;
+        std::chrono::nanoseconds flightplanEvents = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds radarTargetEvents = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds timedEvents = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds tagItems = std::chrono::nanoseconds::zero();
+
+        [[nodiscard]] auto Total() const -> std::chrono::nanoseconds
+        {
+            return flightplanEvents + radarTargetEvents + timedEvents + tagItems;
+        }
+    };
+
+    /*
+        Replays a traffic scene through a set of plugin modules, in the way that EuroScope would drive them.
+
+        For each frame, aircraft that have appeared get a flightplan event, aircraft whose squawk or tracking
+        state has changed get a controller data or flightplan event, every aircraft gets a radar target update
+        and aircraft that have gone get a disconnect event. Timed events are then ticked for each simulated second
+        that has passed, and every tag item is asked for every aircraft, as if each had a tag on screen.
+
+        All of this happens on the calling thread, and the time spent in each module is recorded so that
+        the cost of a module can be reported per simulated second.
+    */
+    class TrafficReplayer
+    {
+        public:
+        TrafficReplayer(TrafficScene scene, ReplayPluginLoopback& plugin);
+        ~TrafficReplayer();
+        TrafficReplayer(const TrafficReplayer&) = delete;
+        TrafficReplayer(TrafficReplayer&&) noexcept = delete;
+        auto operator=(const TrafficReplayer&) -> TrafficReplayer& = delete;
+        auto operator=(TrafficReplayer&&) noexcept -> TrafficReplayer& = delete;
+        void AddModule(ReplayModule module);
+
+        /*
+            Replay the next frame, returning false if there are no frames left.
+        */
+        [[nodiscard]] auto Step() -> bool;
+
+        /*
+            Replay every remaining frame. Speed is a multiple of real time, so 1 replays in real time and
+            10 replays ten times faster. A speed of zero replays as fast as possible.
+        */
+        void Run(double speed = 0.0);
+
+        [[nodiscard]] auto SimulatedSeconds() const -> double;
+        [[nodiscard]] auto Timings() const -> const std::vector<ReplayModuleTiming>&;
+
+        /*
+            Writes the time spent in each module per simulated second.
+        */
+        void Report(std::ostream& output) const;
+
+        private:
+        using ReplayedAircraft = struct ReplayedAircraft
+        {
+            std::shared_ptr<ReplayFlightplan> flightplan;
+            std::shared_ptr<ReplayRadarTarget> radarTarget;
+        };
+
+        void ReplayFrame(const TrafficFrame& frame);
+        void UpdateAircraft(const TrafficFrame& frame);
+        void DisconnectAircraft(const TrafficFrame& frame);
+        void TickTimedEvents(double time);
+        void QueryTagItems();
+        template <typename Function>
+        void TimeModules(std::chrono::nanoseconds ReplayModuleTiming::*category, Function&& function);
+
+        // The scene being replayed
+        const TrafficScene scene;
+
+        // The recorded flightplans, by callsign
+        std::unordered_map<std::string, RecordedFlightplan> flightplans;
+
+        // Stands in for EuroScope
+        ReplayPluginLoopback& plugin;
+
+        // The modules being replayed, and how long each has taken
+        std::vector<ReplayModule> modules;
+        std::vector<ReplayModuleTiming> timings;
+
+        // The aircraft currently in the scene
+        std::map<std::string, ReplayedAircraft> aircraft;
+
+        // The next frame to replay
+        size_t nextFrame = 0;
+
+        // The last second on which timed events were ticked
+        std::optional<int> lastTickedSecond;
+    };
+} // namespace UKControllerPluginTest::Replay
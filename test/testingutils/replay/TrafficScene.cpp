@@ -0,0 +1,153 @@
+#include "TrafficScene.h"
+
+namespace UKControllerPluginTest::Replay {
+    namespace {
+        auto RoutePointFromJson(const nlohmann::json& json) -> RoutePoint
+        {
+            return {
+                json.at("name").get<std::string>(),
+                json.at("latitude").get<double>(),
+                json.at("longitude").get<double>()};
+        }
+
+        auto FlightplanFromJson(const nlohmann::json& json) -> RecordedFlightplan
+        {
+            RecordedFlightplan flightplan{
+                json.at("callsign").get<std::string>(),
+                json.value("origin", ""),
+                json.value("destination", ""),
+                json.value("route", ""),
+                json.value("aircraft_type", ""),
+                json.value("wake_category", ""),
+                json.value("flight_rules", "I"),
+                json.value("remarks", ""),
+                json.value("cruise_level", 0),
+                {}};
+
+            if (json.contains("route_points")) {
+                for (const auto& point : json.at("route_points")) {
+                    flightplan.routePoints.push_back(RoutePointFromJson(point));
+                }
+            }
+
+            return flightplan;
+        }
+
+        auto TargetFromJson(const nlohmann::json& json) -> RecordedTarget
+        {
+            return {
+                json.at("callsign").get<std::string>(),
+                json.at("latitude").get<double>(),
+                json.at("longitude").get<double>(),
+                json.value("altitude", 0),
+                json.value("ground_speed", 0),
+                json.value("vertical_speed", 0),
+                json.value("heading", 0.0),
+                json.value("squawk", "2000"),
+                json.value("tracked", false),
+                json.value("tracked_by_user", false)};
+        }
+    } // namespace
+
+    auto TrafficSceneFromJson(const nlohmann::json& json) -> TrafficScene
+    {
+        TrafficScene scene;
+        for (const auto& flightplan : json.at("flightplans")) {
+            scene.flightplans.push_back(FlightplanFromJson(flightplan));
+        }
+
+        for (const auto& frameJson : json.at("frames")) {
+            TrafficFrame frame{frameJson.at("time").get<double>(), {}};
+            for (const auto& target : frameJson.at("targets")) {
+                frame.targets.push_back(TargetFromJson(target));
+            }
+            scene.frames.push_back(std::move(frame));
+        }
+
+        std::stable_sort(scene.frames.begin(), scene.frames.end(), [](const auto& first, const auto& second) {
+            return first.time < second.time;
+        });
+
+        return scene;
+    }
+
+    auto TrafficSceneToJson(const TrafficScene& scene) -> nlohmann::json
+    {
+        auto flightplans = nlohmann::json::array();
+        for (const auto& flightplan : scene.flightplans) {
+            auto routePoints = nlohmann::json::array();
+            for (const auto& point : flightplan.routePoints) {
+                routePoints.push_back(
+                    {{"name", point.name}, {"latitude", point.latitude}, {"longitude", point.longitude}});
+            }
+
+            flightplans.push_back(
+                {{"callsign", flightplan.callsign},
+                 {"origin", flightplan.origin},
+                 {"destination", flightplan.destination},
+                 {"route", flightplan.route},
+                 {"aircraft_type", flightplan.aircraftType},
+                 {"wake_category", flightplan.wakeCategory},
+                 {"flight_rules", flightplan.flightRules},
+                 {"remarks", flightplan.remarks},
+                 {"cruise_level", flightplan.cruiseLevel},
+                 {"route_points", routePoints}});
+        }
+
+        auto frames = nlohmann::json::array();
+        for (const auto& frame : scene.frames) {
+            auto targets = nlohmann::json::array();
+            for (const auto& target : frame.targets) {
+                targets.push_back(
+                    {{"callsign", target.callsign},
+                     {"latitude", target.latitude},
+                     {"longitude", target.longitude},
+                     {"altitude", target.altitude},
+                     {"ground_speed", target.groundSpeed},
+                     {"vertical_speed", target.verticalSpeed},
+                     {"heading", target.heading},
+                     {"squawk", target.squawk},
+                     {"tracked", target.tracked},
+                     {"tracked_by_user", target.trackedByUser}});
+            }
+
+            frames.push_back({{"time", frame.time}, {"targets", targets}});
+        }
+
+        return {{"flightplans", flightplans}, {"frames", frames}};
+    }
+
+    auto LoadTrafficScene(const std::filesystem::path& path) -> TrafficScene
+    {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            throw std::invalid_argument("Unable to open traffic scene " + path.string());
+        }
+
+        return TrafficSceneFromJson(nlohmann::json::parse(file));
+    }
+
+    void SaveTrafficScene(const TrafficScene& scene, const std::filesystem::path& path)
+    {
+        std::ofstream file(path, std::ofstream::out | std::ofstream::trunc);
+        if (!file.is_open()) {
+            throw std::invalid_argument("Unable to write traffic scene " + path.string());
+        }
+
+        file << TrafficSceneToJson(scene).dump();
+    }
+
+    auto DistanceInNauticalMiles(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude)
+        -> double
+    {
+        const double earthRadiusNauticalMiles = 3440.065;
+        const double degreesToRadians = 3.14159265358979323846 / 180.0;
+        const double deltaLatitude = (toLatitude - fromLatitude) * degreesToRadians;
+        const double deltaLongitude = (toLongitude - fromLongitude) * degreesToRadians;
+        const double a = std::pow(std::sin(deltaLatitude / 2), 2) +
+                         std::cos(fromLatitude * degreesToRadians) * std::cos(toLatitude * degreesToRadians) *
+                             std::pow(std::sin(deltaLongitude / 2), 2);
+
+        return earthRadiusNauticalMiles * 2 * std::atan2(std::sqrt(a), std::sqrt(1 - a));
+    }
+} // namespace UKControllerPluginTest::Replay
@@ -0,0 +1,77 @@
+#pragma once
+
+namespace UKControllerPluginTest::Replay {
+
+    // A point on an aircraft's route
+    using RoutePoint = struct RoutePoint
+    {
+        // The name of the point
+        std::string name;
+
+        // Where the point is
+        double latitude;
+        double longitude;
+    };
+
+    // The parts of a flightplan that stay the same throughout a scene
+    using RecordedFlightplan = struct RecordedFlightplan
+    {
+        std::string callsign;
+        std::string origin;
+        std::string destination;
+        std::string route;
+        std::string aircraftType;
+        std::string wakeCategory;
+        std::string flightRules;
+        std::string remarks;
+        int cruiseLevel;
+
+        // The points that EuroScope would extract from the route
+        std::vector<RoutePoint> routePoints;
+    };
+
+    // Where an aircraft is, and what state it's in, at a point in time
+    using RecordedTarget = struct RecordedTarget
+    {
+        std::string callsign;
+        double latitude;
+        double longitude;
+        int altitude;
+        int groundSpeed;
+        int verticalSpeed;
+        double heading;
+        std::string squawk;
+        bool tracked;
+        bool trackedByUser;
+    };
+
+    // All the aircraft visible at a point in time
+    using TrafficFrame = struct TrafficFrame
+    {
+        // Seconds since the start of the scene
+        double time;
+
+        std::vector<RecordedTarget> targets;
+    };
+
+    // A recorded or generated traffic scene, frames are in time order
+    using TrafficScene = struct TrafficScene
+    {
+        std::vector<RecordedFlightplan> flightplans;
+        std::vector<TrafficFrame> frames;
+    };
+
+    /*
+        Converts scenes to and from JSON. Loading throws if the scene is malformed.
+    */
+    [[nodiscard]] auto TrafficSceneFromJson(const nlohmann::json& json) -> TrafficScene;
+    [[nodiscard]] auto TrafficSceneToJson(const TrafficScene& scene) -> nlohmann::json;
+    [[nodiscard]] auto LoadTrafficScene(const std::filesystem::path& path) -> TrafficScene;
+    void SaveTrafficScene(const TrafficScene& scene, const std::filesystem::path& path);
+
+    /*
+        The great circle distance between two points, in nautical miles.
+    */
+    [[nodiscard]] auto DistanceInNauticalMiles(
+        double fromLatitude, double fromLongitude, double toLatitude, double toLongitude) -> double;
+} // namespace UKControllerPluginTest::Replay
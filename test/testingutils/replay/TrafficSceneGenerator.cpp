@@ -0,0 +1,234 @@
+#include "TrafficSceneGenerator.h"
+
+namespace UKControllerPluginTest::Replay {
+    namespace {
+        // The airfields that aircraft fly between
+        const std::vector<RoutePoint> airfields{
+            {"EGLL", 51.4706, -0.4619}, {"EGKK", 51.1481, -0.1903}, {"EGSS", 51.8850, 0.2350},
+            {"EGGW", 51.8747, -0.3683}, {"EGLC", 51.5053, 0.0553},  {"EGCC", 53.3537, -2.2750},
+            {"EGGP", 53.3336, -2.8497}, {"EGBB", 52.4539, -1.7480}, {"EGNX", 52.8311, -1.3281},
+            {"EGGD", 51.3827, -2.7191}, {"EGHI", 50.9503, -1.3568}, {"EGNT", 55.0375, -1.6917},
+            {"EGPH", 55.9500, -3.3725}, {"EGPF", 55.8719, -4.4331}, {"EGAA", 54.6575, -6.2158},
+        };
+
+        // The fixes that routes are built from
+        const std::vector<RoutePoint> fixes{
+            {"DVR", 51.1625, 1.3597},  {"LAM", 51.6461, 0.1517},  {"BNN", 51.7261, -0.5500},
+            {"OCK", 51.3050, -0.4472}, {"BIG", 51.3308, 0.0344},  {"DET", 51.3040, 0.5972},
+            {"MID", 51.0539, -0.6250}, {"SAM", 50.9550, -1.3450}, {"CPT", 51.4925, -1.2194},
+            {"BPK", 51.7497, -0.1067}, {"CLN", 51.8486, 1.1464},  {"HON", 52.3569, -1.6633},
+            {"TNT", 53.0539, -1.6697}, {"GAM", 53.2811, -0.9472}, {"WAL", 53.3922, -3.1342},
+            {"POL", 53.7444, -2.1036}, {"OTR", 53.6981, -0.1036}, {"NEW", 55.0375, -1.6917},
+            {"TLA", 55.4997, -3.3539}, {"DCS", 54.7233, -3.3400}, {"GOW", 55.8706, -4.4450},
+            {"SFD", 50.7603, 0.1222},
+        };
+
+        const std::vector<std::string> operators{"BAW", "EZY", "RYR", "VIR", "TOM", "EXS", "LOG", "SHT", "EIN", "KLM"};
+
+        // Aircraft types and their wake categories
+        const std::vector<std::pair<std::string, std::string>> aircraftTypes{
+            {"A320", "M"}, {"A20N", "M"}, {"B738", "M"}, {"A319", "M"}, {"E190", "M"},
+            {"DH8D", "M"}, {"A321", "M"}, {"B77W", "H"}, {"B789", "H"}, {"A388", "J"},
+        };
+
+        // Letters that can appear in a SELCAL
+        const std::string selcalLetters = "ABCDEFGHJKLMPQRS";
+
+        // The state of an aircraft as the scene is being generated
+        using GeneratedAircraft = struct GeneratedAircraft
+        {
+            RecordedTarget target;
+            std::vector<RoutePoint> route;
+            size_t nextPoint;
+            int joinTime;
+        };
+
+        auto BearingBetween(double fromLatitude, double fromLongitude, double toLatitude, double toLongitude)
+            -> double
+        {
+            const double degreesToRadians = 3.14159265358979323846 / 180.0;
+            const double north = toLatitude - fromLatitude;
+            const double east = (toLongitude - fromLongitude) * std::cos(fromLatitude * degreesToRadians);
+            const double bearing = std::atan2(east, north) / degreesToRadians;
+            return bearing < 0 ? bearing + 360 : bearing;
+        }
+
+        auto RandomSquawk(std::mt19937& generator) -> std::string
+        {
+            std::uniform_int_distribution<int> digit(0, 7);
+            std::string squawk;
+            for (int i = 0; i < 4; i++) {
+                squawk += static_cast<char>('0' + digit(generator));
+            }
+            return squawk;
+        }
+
+        auto RandomSelcal(std::mt19937& generator) -> std::string
+        {
+            std::string letters = selcalLetters;
+            std::shuffle(letters.begin(), letters.end(), generator);
+            std::string first = letters.substr(0, 2);
+            std::string second = letters.substr(2, 2);
+            std::sort(first.begin(), first.end());
+            std::sort(second.begin(), second.end());
+            return first + second;
+        }
+
+        /*
+            Picks a couple of fixes that sit roughly between the origin and destination, in the order
+            they'd be flown.
+        */
+        auto RandomRoute(const RoutePoint& origin, const RoutePoint& destination, std::mt19937& generator)
+            -> std::vector<RoutePoint>
+        {
+            const auto directDistance =
+                DistanceInNauticalMiles(origin.latitude, origin.longitude, destination.latitude, destination.longitude);
+            std::vector<RoutePoint> candidates;
+            for (const auto& fix : fixes) {
+                const auto viaFix =
+                    DistanceInNauticalMiles(origin.latitude, origin.longitude, fix.latitude, fix.longitude) +
+                    DistanceInNauticalMiles(fix.latitude, fix.longitude, destination.latitude, destination.longitude);
+                if (viaFix < directDistance * 1.3) {
+                    candidates.push_back(fix);
+                }
+            }
+
+            std::shuffle(candidates.begin(), candidates.end(), generator);
+            candidates.resize(std::min<size_t>(candidates.size(), 3));
+            std::sort(candidates.begin(), candidates.end(), [&origin](const auto& first, const auto& second) {
+                return DistanceInNauticalMiles(origin.latitude, origin.longitude, first.latitude, first.longitude) <
+                       DistanceInNauticalMiles(origin.latitude, origin.longitude, second.latitude, second.longitude);
+            });
+
+            std::vector<RoutePoint> route{origin};
+            route.insert(route.end(), candidates.begin(), candidates.end());
+            route.push_back(destination);
+            return route;
+        }
+
+        /*
+            Moves an aircraft towards its next route point, returning false once it has arrived.
+        */
+        auto MoveAircraft(GeneratedAircraft& aircraft, int seconds) -> bool
+        {
+            const double degreesToRadians = 3.14159265358979323846 / 180.0;
+            double distanceToFly = aircraft.target.groundSpeed * seconds / 3600.0;
+            auto& target = aircraft.target;
+            while (distanceToFly > 0 && aircraft.nextPoint < aircraft.route.size()) {
+                const auto& next = aircraft.route[aircraft.nextPoint];
+                const auto distanceToNext =
+                    DistanceInNauticalMiles(target.latitude, target.longitude, next.latitude, next.longitude);
+                target.heading = BearingBetween(target.latitude, target.longitude, next.latitude, next.longitude);
+
+                if (distanceToNext <= distanceToFly) {
+                    target.latitude = next.latitude;
+                    target.longitude = next.longitude;
+                    distanceToFly -= distanceToNext;
+                    aircraft.nextPoint++;
+                    continue;
+                }
+
+                target.latitude += distanceToFly * std::cos(target.heading * degreesToRadians) / 60.0;
+                target.longitude += distanceToFly * std::sin(target.heading * degreesToRadians) /
+                                    (60.0 * std::cos(target.latitude * degreesToRadians));
+                distanceToFly = 0;
+            }
+
+            return aircraft.nextPoint < aircraft.route.size();
+        }
+    } // namespace
+
+    auto GenerateTrafficScene(const TrafficSceneGeneratorOptions& options) -> TrafficScene
+    {
+        std::mt19937 generator(options.seed);
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+        std::uniform_int_distribution<size_t> airfield(0, airfields.size() - 1);
+        std::uniform_int_distribution<size_t> airline(0, operators.size() - 1);
+        std::uniform_int_distribution<size_t> aircraftType(0, aircraftTypes.size() - 1);
+        std::uniform_int_distribution<int> cruiseLevel(10, 39);
+        std::uniform_int_distribution<int> joinTime(0, std::max(options.durationSeconds - 1, 0));
+
+        TrafficScene scene;
+        std::vector<GeneratedAircraft> aircraft;
+        for (int i = 0; i < options.aircraft; i++) {
+            const auto& origin = airfields[airfield(generator)];
+            auto destination = airfields[airfield(generator)];
+            while (destination.name == origin.name) {
+                destination = airfields[airfield(generator)];
+            }
+
+            const auto route = RandomRoute(origin, destination, generator);
+            const auto& type = aircraftTypes[aircraftType(generator)];
+            const auto callsign = operators[airline(generator)] + std::to_string(100 + i);
+
+            std::string routeString;
+            for (size_t point = 1; point + 1 < route.size(); point++) {
+                routeString += (routeString.empty() ? "" : " ") + route[point].name;
+            }
+
+            scene.flightplans.push_back(
+                {callsign,
+                 origin.name,
+                 destination.name,
+                 routeString,
+                 type.first,
+                 type.second,
+                 "I",
+                 chance(generator) < 0.3 ? "SEL/" + RandomSelcal(generator) : "",
+                 cruiseLevel(generator) * 1000,
+                 route});
+
+            // Start somewhere along the first leg, so the scene doesn't begin with every aircraft on the ground
+            const auto& firstLeg = route[1];
+            const auto legProgress = chance(generator);
+            const bool tracked = chance(generator) < options.trackedProportion;
+            RecordedTarget target{
+                callsign,
+                origin.latitude + (firstLeg.latitude - origin.latitude) * legProgress,
+                origin.longitude + (firstLeg.longitude - origin.longitude) * legProgress,
+                scene.flightplans.back().cruiseLevel,
+                std::uniform_int_distribution<int>(250, 480)(generator),
+                0,
+                BearingBetween(origin.latitude, origin.longitude, firstLeg.latitude, firstLeg.longitude),
+                RandomSquawk(generator),
+                tracked,
+                tracked && chance(generator) < options.trackedByUserProportion / options.trackedProportion};
+
+            aircraft.push_back(
+                {target, route, 1, chance(generator) < options.lateJoinProportion ? joinTime(generator) : 0});
+        }
+
+        std::vector<bool> arrived(aircraft.size(), false);
+        for (int time = 0; time <= options.durationSeconds; time += options.frameIntervalSeconds) {
+            TrafficFrame frame{static_cast<double>(time), {}};
+            for (size_t i = 0; i < aircraft.size(); i++) {
+                auto& generated = aircraft[i];
+                if (arrived[i] || generated.joinTime > time) {
+                    continue;
+                }
+
+                if (time > generated.joinTime && !MoveAircraft(generated, options.frameIntervalSeconds)) {
+                    arrived[i] = true;
+                    continue;
+                }
+
+                if (chance(generator) < options.squawkChangeChance) {
+                    generated.target.squawk = RandomSquawk(generator);
+                }
+
+                if (chance(generator) < options.handoffChance) {
+                    generated.target.tracked = !generated.target.tracked;
+                    generated.target.trackedByUser =
+                        generated.target.tracked &&
+                        chance(generator) < options.trackedByUserProportion / options.trackedProportion;
+                }
+
+                frame.targets.push_back(generated.target);
+            }
+
+            scene.frames.push_back(std::move(frame));
+        }
+
+        return scene;
+    }
+} // namespace UKControllerPluginTest::Replay
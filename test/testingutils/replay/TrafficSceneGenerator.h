@@ -0,0 +1,39 @@
+#pragma once
+#include "TrafficScene.h"
+
+namespace UKControllerPluginTest::Replay {
+
+    // How to generate a synthetic traffic scene
+    using TrafficSceneGeneratorOptions = struct TrafficSceneGeneratorOptions
+    {
+        // How many aircraft take part in the scene
+        int aircraft = 1000;
+
+        // How long the scene lasts, in seconds
+        int durationSeconds = 300;
+
+        // How often EuroScope would update the radar targets, in seconds
+        int frameIntervalSeconds = 5;
+
+        // The proportion of aircraft that join part way through the scene
+        double lateJoinProportion = 0.15;
+
+        // The proportion of aircraft that are tracked, and tracked by the user
+        double trackedProportion = 0.3;
+        double trackedByUserProportion = 0.05;
+
+        // The chance, per aircraft per frame, of a squawk change or a handoff
+        double squawkChangeChance = 0.002;
+        double handoffChance = 0.005;
+
+        // The seed, so the same options always produce the same scene
+        unsigned int seed = 1;
+    };
+
+    /*
+        Generates a scene of aircraft flying between UK airfields via a selection of enroute fixes. Aircraft
+        disconnect when they arrive, and some join part way through, so there is a steady stream of
+        flightplan and disconnect events alongside the radar target updates.
+    */
+    [[nodiscard]] auto GenerateTrafficScene(const TrafficSceneGeneratorOptions& options) -> TrafficScene;
+} // namespace UKControllerPluginTest::Replay
@@ -101,6 +101,12 @@ namespace UKControllerPluginTest {
         return *this;
     }
 
+    ApiResponseExpectation& ApiExpectation::WillReturnNotFound()
+    {
+        this->responseCode = HttpStatusCode::NotFound;
+        return *this;
+    }
+
     ApiResponseExpectation& ApiExpectation::WithResponseBody(const nlohmann::json& body)
     {
         this->responseBody = body;
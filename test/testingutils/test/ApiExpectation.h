@@ -39,6 +39,7 @@ namespace UKControllerPluginTest {
         auto WillReturnOk() -> ApiResponseExpectation& override;
         auto WillReturnServerError() -> ApiResponseExpectation& override;
         auto WillReturnForbidden() -> ApiResponseExpectation& override;
+        auto WillReturnNotFound() -> ApiResponseExpectation& override;
         auto WithResponseBody(const nlohmann::json& body) -> ApiResponseExpectation& override;
         auto WithInvalidBodyJson() -> ApiResponseExpectation& override;
         auto To(const std::string& uri) -> ApiRequestExpectation& override;
@@ -11,6 +11,7 @@ namespace UKControllerPluginTest {
         virtual auto WillReturnOk() -> ApiResponseExpectation& = 0;
         virtual auto WillReturnServerError() -> ApiResponseExpectation& = 0;
         virtual auto WillReturnForbidden() -> ApiResponseExpectation& = 0;
+        virtual auto WillReturnNotFound() -> ApiResponseExpectation& = 0;
         virtual auto WithResponseBody(const nlohmann::json& body) -> ApiResponseExpectation& = 0;
         virtual auto WithInvalidBodyJson() -> ApiResponseExpectation& = 0;
     };
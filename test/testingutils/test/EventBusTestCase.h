@@ -111,13 +111,12 @@ namespace UKControllerPluginUtilsTest {
         auto GetStreamForEventType() const
             -> const std::shared_ptr<UKControllerPluginUtils::EventHandler::EventStream<T>>
         {
-            return std::any_cast<std::shared_ptr<UKControllerPluginUtils::EventHandler::EventStream<T>>>(
-                UKControllerPluginUtils::EventHandler::EventBus::Bus().GetAnyStream(typeid(T)));
+            return UKControllerPluginUtils::EventHandler::EventBus::Bus().GetTestStream<T>();
         }
 
         template <typename T> void AssertEventHandlerRegistrationsCountForEvent(int count)
         {
-            EXPECT_EQ(count, GetStreamForEventType<T>()->Handlers().size());
+            EXPECT_EQ(count, GetStreamForEventType<T>()->Handlers()->size());
         }
 
         template <typename T> void AssertSingleEventHandlerRegistrationForEvent()
@@ -129,7 +128,7 @@ namespace UKControllerPluginUtilsTest {
         void AssertHandlerRegisteredForEvent(UKControllerPluginUtils::EventHandler::EventHandlerFlags flags)
         {
             const auto eventStream = GetStreamForEventType<EventType>();
-            for (const auto& handler : eventStream->Handlers()) {
+            for (const auto& handler : *eventStream->Handlers()) {
                 try {
                     static_cast<void>(dynamic_cast<const HandlerType&>(*handler.handler.get()));
                     EXPECT_EQ(flags, handler.flags);
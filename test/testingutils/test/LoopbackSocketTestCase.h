@@ -0,0 +1,148 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+
+    /*
+        A test case that listens on the loopback interface, so that socket code can be tested
+        against real connections rather than mocks.
+    */
+    class LoopbackSocketTestCase : public virtual testing::Test
+    {
+        public:
+        void SetUp() override
+        {
+            WSADATA wsaData;
+            ASSERT_EQ(0, WSAStartup(MAKEWORD(2, 2), &wsaData));
+
+            listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            ASSERT_NE(INVALID_SOCKET, listener);
+
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+            ASSERT_NE(SOCKET_ERROR, bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+            ASSERT_NE(SOCKET_ERROR, listen(listener, SOMAXCONN));
+
+            int addressLength = sizeof(address);
+            ASSERT_NE(SOCKET_ERROR, getsockname(listener, reinterpret_cast<sockaddr*>(&address), &addressLength));
+        }
+
+        void TearDown() override
+        {
+            for (const auto peer : peers) {
+                closesocket(peer);
+            }
+            closesocket(listener);
+            WSACleanup();
+        }
+
+        /*
+            Opens a connection to the listener. Reads on the connection time out rather than
+            blocking forever, so a test that doesn't get its data fails rather than hangs.
+        */
+        [[nodiscard]] auto Connect(int receiveBufferSize = 0) -> SOCKET
+        {
+            SOCKET peer = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            EXPECT_NE(INVALID_SOCKET, peer);
+
+            DWORD receiveTimeout = 5000;
+            setsockopt(
+                peer, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&receiveTimeout), sizeof(receiveTimeout));
+            if (receiveBufferSize > 0) {
+                setsockopt(
+                    peer,
+                    SOL_SOCKET,
+                    SO_RCVBUF,
+                    reinterpret_cast<const char*>(&receiveBufferSize),
+                    sizeof(receiveBufferSize));
+            }
+
+            EXPECT_NE(SOCKET_ERROR, connect(peer, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+            peers.push_back(peer);
+            return peer;
+        }
+
+        /*
+            Accepts a connection on the listener, blocking until there is one.
+        */
+        [[nodiscard]] auto Accept() const -> SOCKET
+        {
+            const SOCKET accepted = accept(listener, nullptr, nullptr);
+            EXPECT_NE(INVALID_SOCKET, accepted);
+            return accepted;
+        }
+
+        /*
+            Closes a connection gracefully.
+        */
+        void Close(SOCKET peer)
+        {
+            peers.erase(std::remove(peers.begin(), peers.end(), peer), peers.end());
+            closesocket(peer);
+        }
+
+        /*
+            Closes a connection abortively, so the other end sees it reset.
+        */
+        void Reset(SOCKET peer)
+        {
+            linger abortiveClose{1, 0};
+            setsockopt(
+                peer, SOL_SOCKET, SO_LINGER, reinterpret_cast<const char*>(&abortiveClose), sizeof(abortiveClose));
+            Close(peer);
+        }
+
+        static void Send(SOCKET peer, const std::string& data)
+        {
+            size_t sent = 0;
+            while (sent < data.size()) {
+                const int bytes = send(peer, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+                ASSERT_NE(SOCKET_ERROR, bytes);
+                sent += bytes;
+            }
+        }
+
+        /*
+            Receives until the given amount of data has arrived, or the connection times out or closes.
+        */
+        [[nodiscard]] static auto Receive(SOCKET peer, size_t expectedBytes) -> std::string
+        {
+            std::string received;
+            std::array<char, 65536> buffer{};
+            while (received.size() < expectedBytes) {
+                const int bytes = recv(peer, buffer.data(), static_cast<int>(buffer.size()), 0);
+                if (bytes <= 0) {
+                    break;
+                }
+                received.append(buffer.data(), bytes);
+            }
+
+            return received;
+        }
+
+        /*
+            Waits for a condition to become true, returning false if it never does.
+        */
+        [[nodiscard]] static auto WaitFor(const std::function<bool()>& condition) -> bool
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (std::chrono::steady_clock::now() < deadline) {
+                if (condition()) {
+                    return true;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            return condition();
+        }
+
+        // The socket that tests connect to
+        SOCKET listener = INVALID_SOCKET;
+
+        // Where the listener is listening
+        sockaddr_in address{};
+
+        // The connections that tests have opened
+        std::vector<SOCKET> peers;
+    };
+} // namespace UKControllerPluginTest
@@ -57,6 +57,17 @@ namespace UKControllerPluginUtilsTest::Api {
         static_cast<void>(legacyInterface->CheckApiAuthorisation());
     }
 
+    TEST_F(ApiBootstrapTest, BootstrapLegacyWithWindowsLoadsResponseCacheFromDisk)
+    {
+        auto factory = Bootstrap(settings, windows);
+
+        EXPECT_CALL(windows, FileExists(std::wstring(L"cache/api-responses.json")))
+            .Times(1)
+            .WillOnce(testing::Return(false));
+
+        EXPECT_NE(nullptr, BootstrapLegacy(*factory, curl, windows));
+    }
+
     TEST_F(ApiBootstrapTest, BootstrapRegistersConfigHandlerForApiKeyReceivedEvent)
     {
         static_cast<void>(Bootstrap(settings, windows));
@@ -1,4 +1,5 @@
 #include "api/ApiFactory.h"
+#include "api/ApiHealthTracker.h"
 #include "api/ApiRequestBuilder.h"
 #include "api/ApiRequestFactory.h"
 #include "api/ApiSettings.h"
@@ -6,6 +7,7 @@
 
 using UKControllerPlugin::Curl::CurlRequest;
 using UKControllerPluginUtils::Api::ApiFactory;
+using UKControllerPluginUtils::Api::ApiHealthTracker;
 using UKControllerPluginUtils::Api::ApiSettings;
 
 namespace UKControllerPluginUtilsTest::Api {
@@ -34,6 +36,19 @@ namespace UKControllerPluginUtilsTest::Api {
         EXPECT_EQ(settingsProvider, factory.SettingsProvider());
     }
 
+    TEST_F(ApiFactoryTest, ItHasAHealthTrackerByDefault)
+    {
+        EXPECT_NE(nullptr, factory.HealthTracker());
+        EXPECT_TRUE(factory.HealthTracker()->Healthy());
+    }
+
+    TEST_F(ApiFactoryTest, ItReturnsAProvidedHealthTracker)
+    {
+        auto healthTracker = std::make_shared<ApiHealthTracker>();
+        ApiFactory trackingFactory(settingsProvider, requestFactory, healthTracker);
+        EXPECT_EQ(healthTracker, trackingFactory.HealthTracker());
+    }
+
     TEST_F(ApiFactoryTest, ItReturnsARequestFactory)
     {
         auto& requestFactory = factory.RequestFactory();
@@ -0,0 +1,190 @@
+#include "api/ApiHealthTracker.h"
+
+using UKControllerPluginUtils::Api::ApiHealthTracker;
+using UKControllerPluginUtils::Api::CircuitState;
+
+namespace UKControllerPluginUtilsTest::Api {
+    class ApiHealthTrackerTest : public testing::Test
+    {
+        public:
+        ApiHealthTrackerTest() : now(std::chrono::steady_clock::now()), tracker([this]() { return now; }, 1234)
+        {
+        }
+
+        void FailRepeatedly(unsigned int times)
+        {
+            for (unsigned int i = 0; i < times; i++) {
+                tracker.RecordFailure(uri, std::chrono::milliseconds(100));
+            }
+        }
+
+        std::string uri = "https://ukcp.vatsim.uk/api/squawk-assignment/BAW123";
+        std::chrono::steady_clock::time_point now;
+        ApiHealthTracker tracker;
+    };
+
+    TEST_F(ApiHealthTrackerTest, ItStartsHealthy)
+    {
+        EXPECT_TRUE(tracker.Healthy());
+        EXPECT_EQ(0, tracker.CountOpenCircuits());
+        EXPECT_EQ(CircuitState::Closed, tracker.State(uri));
+        EXPECT_TRUE(tracker.AllowRequest(uri));
+        EXPECT_EQ(std::chrono::milliseconds(0), tracker.RetryDelay());
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItGroupsUrisByEndpoint)
+    {
+        EXPECT_EQ(
+            "ukcp.vatsim.uk/api/squawk-assignment/{}",
+            ApiHealthTracker::EndpointKey("https://ukcp.vatsim.uk/api/squawk-assignment/BAW123"));
+        EXPECT_EQ(
+            "ukcp.vatsim.uk/api/squawk-assignment/{}",
+            ApiHealthTracker::EndpointKey("https://ukcp.vatsim.uk/api/squawk-assignment/EZY456"));
+        EXPECT_EQ(
+            "ukcp.vatsim.uk/api/plugin-events/latest",
+            ApiHealthTracker::EndpointKey("https://ukcp.vatsim.uk/api/plugin-events/latest?previous=55"));
+        EXPECT_EQ("stand/assignment", ApiHealthTracker::EndpointKey("stand/assignment"));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItAveragesLatency)
+    {
+        tracker.RecordSuccess(uri, std::chrono::milliseconds(100));
+        EXPECT_EQ(std::chrono::milliseconds(100), tracker.Latency(uri));
+        tracker.RecordSuccess(uri, std::chrono::milliseconds(200));
+        EXPECT_EQ(std::chrono::milliseconds(120), tracker.Latency(uri));
+        tracker.RecordFailure(uri, std::chrono::milliseconds(620));
+        EXPECT_EQ(std::chrono::milliseconds(220), tracker.Latency(uri));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItHasNoLatencyForUnknownEndpoints)
+    {
+        EXPECT_EQ(std::chrono::milliseconds(0), tracker.Latency(uri));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItReturnsTheSlowestEndpoint)
+    {
+        tracker.RecordSuccess(uri, std::chrono::milliseconds(100));
+        tracker.RecordSuccess("https://ukcp.vatsim.uk/api/stand/assignment", std::chrono::milliseconds(300));
+        tracker.RecordSuccess("https://ukcp.vatsim.uk/api/stand/assignment", std::chrono::milliseconds(100));
+        tracker.RecordSuccess("https://ukcp.vatsim.uk/api/plugin-events/sync", std::chrono::milliseconds(200));
+
+        const auto [endpoint, latency] = tracker.Slowest();
+        EXPECT_EQ("ukcp.vatsim.uk/api/stand/assignment", endpoint);
+        EXPECT_EQ(std::chrono::milliseconds(260), latency);
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItHasNoSlowestEndpointIfNothingHasBeenRecorded)
+    {
+        const auto [endpoint, latency] = tracker.Slowest();
+        EXPECT_EQ("", endpoint);
+        EXPECT_EQ(std::chrono::milliseconds(0), latency);
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItStaysClosedBelowTheFailureThreshold)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold - 1);
+        EXPECT_EQ(CircuitState::Closed, tracker.State(uri));
+        EXPECT_TRUE(tracker.AllowRequest(uri));
+    }
+
+    TEST_F(ApiHealthTrackerTest, SuccessResetsTheFailureCount)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold - 1);
+        tracker.RecordSuccess(uri, std::chrono::milliseconds(100));
+        FailRepeatedly(ApiHealthTracker::failureThreshold - 1);
+        EXPECT_EQ(CircuitState::Closed, tracker.State(uri));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItOpensTheCircuitAfterRepeatedFailures)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        EXPECT_EQ(CircuitState::Open, tracker.State(uri));
+        EXPECT_FALSE(tracker.AllowRequest(uri));
+        EXPECT_FALSE(tracker.Healthy());
+        EXPECT_EQ(1, tracker.CountOpenCircuits());
+    }
+
+    TEST_F(ApiHealthTrackerTest, OpenCircuitsOnlyAffectTheirEndpoint)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        EXPECT_TRUE(tracker.AllowRequest("https://ukcp.vatsim.uk/api/stand/assignment"));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItReturnsTheRetryDelayForAnEndpoint)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        EXPECT_GE(tracker.RetryDelay(uri), ApiHealthTracker::baseBackoff / 2);
+        EXPECT_EQ(tracker.RetryDelay(), tracker.RetryDelay(uri));
+        EXPECT_EQ(std::chrono::milliseconds(0), tracker.RetryDelay("https://ukcp.vatsim.uk/api/stand/assignment"));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItMatchesTheRetryDelayForAnEndpointWithoutTheDomain)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        EXPECT_EQ(tracker.RetryDelay(uri), tracker.RetryDelay("squawk-assignment/EZY456"));
+        EXPECT_EQ(std::chrono::milliseconds(0), tracker.RetryDelay("assignment/EZY456"));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItHasNoRetryDelayForAnEndpointOnceBackoffHasPassed)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        now += ApiHealthTracker::baseBackoff;
+        EXPECT_EQ(std::chrono::milliseconds(0), tracker.RetryDelay(uri));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItBacksOffWithJitter)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        EXPECT_GE(tracker.RetryDelay(), ApiHealthTracker::baseBackoff / 2);
+        EXPECT_LE(tracker.RetryDelay(), ApiHealthTracker::baseBackoff);
+    }
+
+    TEST_F(ApiHealthTrackerTest, ItLetsASingleProbeThroughOnceBackoffHasPassed)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        now += ApiHealthTracker::baseBackoff;
+
+        EXPECT_EQ(std::chrono::milliseconds(0), tracker.RetryDelay());
+        EXPECT_TRUE(tracker.AllowRequest(uri));
+        EXPECT_EQ(CircuitState::HalfOpen, tracker.State(uri));
+        EXPECT_FALSE(tracker.AllowRequest(uri));
+    }
+
+    TEST_F(ApiHealthTrackerTest, ASuccessfulProbeClosesTheCircuit)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        now += ApiHealthTracker::baseBackoff;
+        static_cast<void>(tracker.AllowRequest(uri));
+        tracker.RecordSuccess(uri, std::chrono::milliseconds(100));
+
+        EXPECT_EQ(CircuitState::Closed, tracker.State(uri));
+        EXPECT_TRUE(tracker.AllowRequest(uri));
+        EXPECT_TRUE(tracker.Healthy());
+    }
+
+    TEST_F(ApiHealthTrackerTest, AFailedProbeReopensTheCircuitForLonger)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        now += ApiHealthTracker::baseBackoff;
+        static_cast<void>(tracker.AllowRequest(uri));
+        tracker.RecordFailure(uri, std::chrono::milliseconds(100));
+
+        EXPECT_EQ(CircuitState::Open, tracker.State(uri));
+        EXPECT_FALSE(tracker.AllowRequest(uri));
+        EXPECT_GE(tracker.RetryDelay(), ApiHealthTracker::baseBackoff);
+        EXPECT_LE(tracker.RetryDelay(), ApiHealthTracker::baseBackoff * 2);
+    }
+
+    TEST_F(ApiHealthTrackerTest, BackoffIsCapped)
+    {
+        FailRepeatedly(ApiHealthTracker::failureThreshold);
+        for (int i = 0; i < 20; i++) {
+            now += ApiHealthTracker::maxBackoff;
+            static_cast<void>(tracker.AllowRequest(uri));
+            tracker.RecordFailure(uri, std::chrono::milliseconds(100));
+        }
+
+        EXPECT_LE(tracker.RetryDelay(), ApiHealthTracker::maxBackoff);
+        EXPECT_GE(tracker.RetryDelay(), ApiHealthTracker::maxBackoff / 2);
+    }
+} // namespace UKControllerPluginUtilsTest::Api
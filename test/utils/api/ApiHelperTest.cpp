@@ -1,7 +1,9 @@
 #include "api/ApiException.h"
+#include "api/ApiHealthTracker.h"
 #include "api/ApiHelper.h"
 #include "api/ApiNotAuthorisedException.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiResponseCache.h"
 #include "curl/CurlInterface.h"
 #include "helper/ApiRequestHelperFunctions.h"
 
@@ -21,17 +23,27 @@ using UKControllerPlugin::Curl::CurlResponse;
 using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using UKControllerPlugin::Srd::SrdSearchParameters;
 using UKControllerPluginTest::Curl::MockCurlApi;
+using UKControllerPluginUtils::Api::ApiHealthTracker;
+using UKControllerPluginUtils::Api::ApiResponseCache;
 
 namespace UKControllerPluginUtilsTest::Api {
 
     class ApiHelperTest : public Test
     {
         public:
-        ApiHelperTest() : helper(mockCurlApi, GetApiRequestBuilder())
+        ApiHelperTest()
+            : responseCache(std::make_shared<ApiResponseCache>()), healthTracker(std::make_shared<ApiHealthTracker>()),
+              helper(mockCurlApi, GetApiRequestBuilder()),
+              cachingHelper(mockCurlApi, GetApiRequestBuilder(), responseCache),
+              trackingHelper(mockCurlApi, GetApiRequestBuilder(), nullptr, healthTracker)
         {
         }
 
+        std::shared_ptr<ApiResponseCache> responseCache;
+        std::shared_ptr<ApiHealthTracker> healthTracker;
         ApiHelper helper;
+        ApiHelper cachingHelper;
+        ApiHelper trackingHelper;
         NiceMock<MockCurlApi> mockCurlApi;
     };
 
@@ -389,6 +401,80 @@ namespace UKControllerPluginUtilsTest::Api {
         EXPECT_EQ(responseData, this->helper.GetRegionalPressures());
     }
 
+    TEST_F(ApiHelperTest, GetMinStackLevelsSendsValidatorsFromPreviousResponse)
+    {
+        nlohmann::json responseData;
+        responseData["bla"] = "bla";
+        CurlResponse response(responseData.dump(), false, 200);
+        response.AddHeader("ETag", "\"abc\"");
+        response.AddHeader("Last-Modified", "Wed, 21 Oct 2015 07:28:00 GMT");
+
+        CurlRequest firstRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        CurlRequest secondRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        secondRequest.AddHeader("If-None-Match", "\"abc\"");
+        secondRequest.AddHeader("If-Modified-Since", "Wed, 21 Oct 2015 07:28:00 GMT");
+
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(firstRequest)).Times(1).WillOnce(Return(response));
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(secondRequest)).Times(1).WillOnce(Return(response));
+
+        EXPECT_EQ(responseData, this->cachingHelper.GetMinStackLevels());
+        EXPECT_EQ(responseData, this->cachingHelper.GetMinStackLevels());
+    }
+
+    TEST_F(ApiHelperTest, GetMinStackLevelsReturnsCachedDataIfNotModified)
+    {
+        nlohmann::json responseData;
+        responseData["bla"] = "bla";
+        CurlResponse response(responseData.dump(), false, 200);
+        response.AddHeader("ETag", "\"abc\"");
+
+        CurlRequest firstRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        CurlRequest secondRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        secondRequest.AddHeader("If-None-Match", "\"abc\"");
+
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(firstRequest)).Times(1).WillOnce(Return(response));
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(secondRequest))
+            .Times(1)
+            .WillOnce(Return(CurlResponse("", false, 304)));
+
+        EXPECT_EQ(responseData, this->cachingHelper.GetMinStackLevels());
+        EXPECT_EQ(responseData, this->cachingHelper.GetMinStackLevels());
+    }
+
+    TEST_F(ApiHelperTest, GetMinStackLevelsUpdatesCacheIfModified)
+    {
+        nlohmann::json firstData;
+        firstData["bla"] = "bla";
+        CurlResponse firstResponse(firstData.dump(), false, 200);
+        firstResponse.AddHeader("ETag", "\"abc\"");
+
+        nlohmann::json secondData;
+        secondData["bla"] = "bla2";
+        CurlResponse secondResponse(secondData.dump(), false, 200);
+        secondResponse.AddHeader("ETag", "\"def\"");
+
+        CurlRequest firstRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        CurlRequest secondRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        secondRequest.AddHeader("If-None-Match", "\"abc\"");
+
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(firstRequest)).Times(1).WillOnce(Return(firstResponse));
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(secondRequest)).Times(1).WillOnce(Return(secondResponse));
+
+        EXPECT_EQ(firstData, this->cachingHelper.GetMinStackLevels());
+        EXPECT_EQ(secondData, this->cachingHelper.GetMinStackLevels());
+        EXPECT_EQ(secondData, this->responseCache->Body(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET).GetUri()));
+    }
+
+    TEST_F(ApiHelperTest, GetMinStackLevelsThrowsIfNotModifiedWithNothingCached)
+    {
+        CurlRequest expectedRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET));
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+            .Times(1)
+            .WillOnce(Return(CurlResponse("", false, 304)));
+
+        EXPECT_THROW(static_cast<void>(this->cachingHelper.GetMinStackLevels()), ApiException);
+    }
+
     TEST_F(ApiHelperTest, GetUriReturnsUriData)
     {
         nlohmann::json responseData;
@@ -625,6 +711,48 @@ namespace UKControllerPluginUtilsTest::Api {
         EXPECT_EQ(responseData, this->helper.GetLatestPluginEvents(5));
     }
 
+    TEST_F(ApiHelperTest, StreamPluginEventsPassesStreamToCallback)
+    {
+        CurlResponse response("id: 6\ndata: {}\n\n", false, 200);
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiRequestBuilder().BuildPluginEventStreamRequest(5)))
+            .Times(1)
+            .WillOnce(Return(response));
+
+        std::string streamed;
+        this->helper.StreamPluginEvents(5, [&streamed](const std::string& chunk) -> bool {
+            streamed += chunk;
+            return true;
+        });
+        EXPECT_EQ("id: 6\ndata: {}\n\n", streamed);
+    }
+
+    TEST_F(ApiHelperTest, StreamPluginEventsThrowsNotFoundIfStreamingNotSupported)
+    {
+        CurlResponse response("not here", false, 404);
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiRequestBuilder().BuildPluginEventStreamRequest(5)))
+            .Times(1)
+            .WillOnce(Return(response));
+
+        bool streamed = false;
+        const auto onData = [&streamed](const std::string&) -> bool {
+            streamed = true;
+            return true;
+        };
+        EXPECT_THROW(this->helper.StreamPluginEvents(5, onData), ApiNotFoundException);
+        EXPECT_FALSE(streamed);
+    }
+
+    TEST_F(ApiHelperTest, StreamPluginEventsThrowsIfStreamFails)
+    {
+        CurlResponse response("", true, 0);
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiRequestBuilder().BuildPluginEventStreamRequest(5)))
+            .Times(1)
+            .WillOnce(Return(response));
+
+        EXPECT_THROW(
+            this->helper.StreamPluginEvents(5, [](const std::string&) -> bool { return true; }), ApiException);
+    }
+
     TEST_F(ApiHelperTest, GetUpdateDetailsReturnsData)
     {
         nlohmann::json responseData;
@@ -827,4 +955,74 @@ namespace UKControllerPluginUtilsTest::Api {
 
         this->helper.AcknowledgeMissedApproach(1, "Some remarks");
     }
+
+    TEST_F(ApiHelperTest, ItStopsCallingTheApiAfterRepeatedServerErrors)
+    {
+        CurlResponse response(R"({"message": "teapots"})", false, 500);
+
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiCurlRequest("/authorise", CurlRequest::METHOD_GET)))
+            .Times(ApiHealthTracker::failureThreshold)
+            .WillRepeatedly(Return(response));
+
+        for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold; i++) {
+            EXPECT_THROW(static_cast<void>(this->trackingHelper.CheckApiAuthorisation()), ApiException);
+        }
+
+        EXPECT_FALSE(this->healthTracker->Healthy());
+        EXPECT_THROW(static_cast<void>(this->trackingHelper.CheckApiAuthorisation()), ApiException);
+    }
+
+    TEST_F(ApiHelperTest, ItStopsCallingTheApiAfterRepeatedCurlErrors)
+    {
+        CurlResponse response("", true, 0);
+
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiCurlRequest("/authorise", CurlRequest::METHOD_GET)))
+            .Times(ApiHealthTracker::failureThreshold)
+            .WillRepeatedly(Return(response));
+
+        for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold + 1; i++) {
+            EXPECT_THROW(static_cast<void>(this->trackingHelper.CheckApiAuthorisation()), ApiException);
+        }
+
+        EXPECT_FALSE(this->healthTracker->Healthy());
+    }
+
+    TEST_F(ApiHelperTest, ItRecordsTheLatencyOfRequests)
+    {
+        CurlResponse response(R"({"message": "teapots"})", false, 200);
+        const auto request = GetApiCurlRequest("/authorise", CurlRequest::METHOD_GET);
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(request)).Times(1).WillOnce(Return(response));
+
+        EXPECT_TRUE(this->trackingHelper.CheckApiAuthorisation());
+        EXPECT_EQ(ApiHealthTracker::EndpointKey(request.GetUri()), this->healthTracker->Slowest().first);
+    }
+
+    TEST_F(ApiHelperTest, ItDoesntCountClientErrorsAgainstApiHealth)
+    {
+        CurlResponse response(R"({"message": "teapots"})", false, 404);
+
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiCurlRequest("/authorise", CurlRequest::METHOD_GET)))
+            .Times(ApiHealthTracker::failureThreshold + 1)
+            .WillRepeatedly(Return(response));
+
+        for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold + 1; i++) {
+            EXPECT_THROW(static_cast<void>(this->trackingHelper.CheckApiAuthorisation()), ApiNotFoundException);
+        }
+
+        EXPECT_TRUE(this->healthTracker->Healthy());
+    }
+
+    TEST_F(ApiHelperTest, ItDoesntCountStreamsClosingNormallyAgainstApiHealth)
+    {
+        CurlResponse response("id: 6\ndata: {}\n\n", false, 200);
+        EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiRequestBuilder().BuildPluginEventStreamRequest(5)))
+            .Times(ApiHealthTracker::failureThreshold + 1)
+            .WillRepeatedly(Return(response));
+
+        for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold + 1; i++) {
+            this->trackingHelper.StreamPluginEvents(5, [](const std::string&) -> bool { return true; });
+        }
+
+        EXPECT_TRUE(this->healthTracker->Healthy());
+    }
 } // namespace UKControllerPluginUtilsTest::Api
@@ -349,6 +349,18 @@ namespace UKControllerPluginUtilsTest::Api {
         EXPECT_TRUE(expectedRequest == this->builder.BuildGetLatestPluginEventsRequest(5));
     }
 
+    TEST_F(ApiRequestBuilderTest, ItBuildsPluginEventStreamRequest)
+    {
+        CurlRequest expectedRequest("http://testurl.com/api/plugin-events/stream?previous=5", CurlRequest::METHOD_GET);
+
+        expectedRequest.AddHeader("Authorization", "Bearer apikey");
+        expectedRequest.AddHeader("Accept", "text/event-stream");
+        expectedRequest.AddHeader("Cache-Control", "no-cache");
+        expectedRequest.SetMaxRequestTime(300L);
+
+        EXPECT_TRUE(expectedRequest == this->builder.BuildPluginEventStreamRequest(5));
+    }
+
     TEST_F(ApiRequestBuilderTest, ItBuildsDepartureReleaseRequest)
     {
         CurlRequest expectedRequest("http://testurl.com/api/departure/release/request", CurlRequest::METHOD_POST);
@@ -0,0 +1,290 @@
+#include "api/ApiResponseCache.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPluginUtils::Api::ApiResponseCache;
+
+namespace UKControllerPluginUtilsTest::Api {
+    class ApiResponseCacheTest : public testing::Test
+    {
+        public:
+        ApiResponseCacheTest() : response(R"({"foo": "bar"})", false, 200)
+        {
+            response.AddHeader("ETag", "\"abc\"");
+            response.AddHeader("Last-Modified", "Wed, 21 Oct 2015 07:28:00 GMT");
+
+            // Keep written files in memory
+            ON_CALL(windows, TryWriteToFile(_, _, _, _))
+                .WillByDefault([this](const std::wstring& file, const std::string& data, bool, bool) {
+                    files[file] = data;
+                    return true;
+                });
+            ON_CALL(windows, MoveFileToNewLocation(_, _))
+                .WillByDefault([this](const std::wstring& from, const std::wstring& to) {
+                    files[to] = files.at(from);
+                    files.erase(from);
+                    return true;
+                });
+        }
+
+        /*
+            Background writes are queued up rather than run, so the tests can decide when the write delay is up.
+        */
+        [[nodiscard]] auto GetDiskCache() -> ApiResponseCache
+        {
+            return {
+                windows,
+                L"cache/api-responses.json",
+                std::chrono::milliseconds(0),
+                [this](std::chrono::steady_clock::time_point, const std::function<void(void)>& task) {
+                    backgroundTasks.push_back(task);
+                }};
+        }
+
+        void RunBackgroundTasks()
+        {
+            auto tasks = std::move(backgroundTasks);
+            backgroundTasks.clear();
+            for (const auto& task : tasks) {
+                task();
+            }
+        }
+
+        [[nodiscard]] auto WrittenCache() const -> nlohmann::json
+        {
+            return nlohmann::json::parse(files.at(L"cache/api-responses.json"));
+        }
+
+        CurlResponse response;
+        std::map<std::wstring, std::string> files;
+        std::vector<std::function<void(void)>> backgroundTasks;
+        NiceMock<UKControllerPluginTest::Windows::MockWinApi> windows;
+        ApiResponseCache cache;
+    };
+
+    TEST_F(ApiResponseCacheTest, ItStartsEmpty)
+    {
+        EXPECT_EQ(0, cache.Count());
+        EXPECT_FALSE(cache.Has("https://foo.com"));
+    }
+
+    TEST_F(ApiResponseCacheTest, ItStoresResponsesWithValidators)
+    {
+        cache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        EXPECT_EQ(1, cache.Count());
+        EXPECT_TRUE(cache.Has("https://foo.com"));
+        EXPECT_EQ(nlohmann::json({{"foo", "bar"}}), cache.Body("https://foo.com"));
+    }
+
+    TEST_F(ApiResponseCacheTest, ItDoesntStoreResponsesWithoutValidators)
+    {
+        cache.Store("https://foo.com", CurlResponse(R"({"foo": "bar"})", false, 200), nlohmann::json{{"foo", "bar"}});
+        EXPECT_EQ(0, cache.Count());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItRemovesResponsesThatNoLongerHaveValidators)
+    {
+        cache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        cache.Store("https://foo.com", CurlResponse(R"({"foo": "bar"})", false, 200), nlohmann::json{{"foo", "bar"}});
+        EXPECT_EQ(0, cache.Count());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItReturnsNullBodyIfNotCached)
+    {
+        EXPECT_TRUE(cache.Body("https://foo.com").is_null());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItAddsValidatorsToRequests)
+    {
+        cache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+
+        CurlRequest request("https://foo.com", CurlRequest::METHOD_GET);
+        cache.AddValidators(request);
+
+        CurlRequest expected("https://foo.com", CurlRequest::METHOD_GET);
+        expected.AddHeader("If-None-Match", "\"abc\"");
+        expected.AddHeader("If-Modified-Since", "Wed, 21 Oct 2015 07:28:00 GMT");
+        EXPECT_EQ(expected, request);
+    }
+
+    TEST_F(ApiResponseCacheTest, ItDoesntAddValidatorsToRequestsForOtherUris)
+    {
+        cache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+
+        CurlRequest request("https://bar.com", CurlRequest::METHOD_GET);
+        cache.AddValidators(request);
+
+        EXPECT_EQ(CurlRequest("https://bar.com", CurlRequest::METHOD_GET), request);
+    }
+
+    TEST_F(ApiResponseCacheTest, ItWritesResponsesToDiskViaATemporaryFile)
+    {
+        EXPECT_CALL(windows, FileExists(std::wstring(L"cache/api-responses.json"))).WillOnce(Return(false));
+        auto diskCache = GetDiskCache();
+
+        nlohmann::json expected = {
+            {"https://foo.com",
+             {{"etag", "\"abc\""}, {"last_modified", "Wed, 21 Oct 2015 07:28:00 GMT"}, {"body", {{"foo", "bar"}}}}}};
+        EXPECT_CALL(windows, WriteToFile(_, _, _, _)).Times(0);
+        EXPECT_CALL(
+            windows, TryWriteToFile(std::wstring(L"cache/api-responses.json.tmp"), expected.dump(), true, false))
+            .Times(1);
+        EXPECT_CALL(
+            windows,
+            MoveFileToNewLocation(
+                std::wstring(L"cache/api-responses.json.tmp"), std::wstring(L"cache/api-responses.json")))
+            .Times(1);
+
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        RunBackgroundTasks();
+        EXPECT_EQ(expected, WrittenCache());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItDoesntWriteToDiskOnTheCallingThread)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(_, _, _, _)).Times(0);
+
+        auto diskCache = GetDiskCache();
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        EXPECT_EQ(1, backgroundTasks.size());
+        testing::Mock::VerifyAndClearExpectations(&windows);
+
+        // Let the destructor write it
+        backgroundTasks.clear();
+    }
+
+    TEST_F(ApiResponseCacheTest, ItCoalescesBurstsOfResponsesIntoOneWrite)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(_, _, _, _)).Times(1);
+
+        auto diskCache = GetDiskCache();
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        diskCache.Store("https://bar.com", response, nlohmann::json{{"bar", "baz"}});
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "baz"}});
+        EXPECT_EQ(1, backgroundTasks.size());
+        RunBackgroundTasks();
+
+        EXPECT_EQ(2, WrittenCache().size());
+        EXPECT_EQ(nlohmann::json({{"foo", "baz"}}), WrittenCache().at("https://foo.com").at("body"));
+    }
+
+    TEST_F(ApiResponseCacheTest, ItWritesAgainForResponsesAfterAWrite)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(_, _, _, _)).Times(2);
+
+        auto diskCache = GetDiskCache();
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        RunBackgroundTasks();
+        diskCache.Store("https://bar.com", response, nlohmann::json{{"bar", "baz"}});
+        RunBackgroundTasks();
+
+        EXPECT_EQ(2, WrittenCache().size());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItWritesRemovalsToDisk)
+    {
+        auto diskCache = GetDiskCache();
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        RunBackgroundTasks();
+        diskCache.Store(
+            "https://foo.com", CurlResponse(R"({"foo": "bar"})", false, 200), nlohmann::json{{"foo", "bar"}});
+        RunBackgroundTasks();
+
+        EXPECT_EQ(nlohmann::json::object(), WrittenCache());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItDoesntWriteIfNothingHasChanged)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(_, _, _, _)).Times(0);
+
+        auto diskCache = GetDiskCache();
+        diskCache.Store(
+            "https://foo.com", CurlResponse(R"({"foo": "bar"})", false, 200), nlohmann::json{{"foo", "bar"}});
+        diskCache.Flush();
+        EXPECT_TRUE(backgroundTasks.empty());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItWritesOutstandingResponsesWhenDestroyed)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(_, _, _, _)).Times(1);
+
+        {
+            auto diskCache = GetDiskCache();
+            diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        }
+
+        EXPECT_EQ(1, WrittenCache().size());
+
+        // The background write must not touch the destroyed cache
+        RunBackgroundTasks();
+    }
+
+    TEST_F(ApiResponseCacheTest, ItKeepsResponsesToWriteIfTheFileCannotBeMovedIntoPlace)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(_, _, _, _)).Times(2);
+        EXPECT_CALL(windows, MoveFileToNewLocation(_, _))
+            .WillOnce(Return(false))
+            .WillOnce([this](const std::wstring& from, const std::wstring& to) {
+                files[to] = files.at(from);
+                return true;
+            });
+
+        auto diskCache = GetDiskCache();
+        diskCache.Store("https://foo.com", response, nlohmann::json{{"foo", "bar"}});
+        RunBackgroundTasks();
+        EXPECT_FALSE(files.contains(L"cache/api-responses.json"));
+
+        diskCache.Flush();
+        EXPECT_EQ(1, WrittenCache().size());
+    }
+
+    TEST_F(ApiResponseCacheTest, ItLoadsResponsesFromDisk)
+    {
+        nlohmann::json file = {
+            {"https://foo.com",
+             {{"etag", "\"abc\""}, {"last_modified", "Wed, 21 Oct 2015 07:28:00 GMT"}, {"body", {{"foo", "bar"}}}}}};
+        EXPECT_CALL(windows, FileExists(std::wstring(L"cache/api-responses.json"))).WillOnce(Return(true));
+        EXPECT_CALL(windows, ReadFromFileMock(std::wstring(L"cache/api-responses.json"), true))
+            .WillOnce(Return(file.dump()));
+
+        ApiResponseCache diskCache(windows, L"cache/api-responses.json");
+        EXPECT_EQ(1, diskCache.Count());
+        EXPECT_EQ(nlohmann::json({{"foo", "bar"}}), diskCache.Body("https://foo.com"));
+
+        CurlRequest request("https://foo.com", CurlRequest::METHOD_GET);
+        diskCache.AddValidators(request);
+        CurlRequest expected("https://foo.com", CurlRequest::METHOD_GET);
+        expected.AddHeader("If-None-Match", "\"abc\"");
+        expected.AddHeader("If-Modified-Since", "Wed, 21 Oct 2015 07:28:00 GMT");
+        EXPECT_EQ(expected, request);
+    }
+
+    TEST_F(ApiResponseCacheTest, ItSkipsInvalidEntriesOnDisk)
+    {
+        nlohmann::json file = {
+            {"https://foo.com", {{"etag", 123}, {"last_modified", ""}, {"body", {{"foo", "bar"}}}}},
+            {"https://bar.com", {{"etag", "\"abc\""}, {"last_modified", ""}, {"body", {{"foo", "bar"}}}}}};
+        EXPECT_CALL(windows, FileExists(std::wstring(L"cache/api-responses.json"))).WillOnce(Return(true));
+        EXPECT_CALL(windows, ReadFromFileMock(std::wstring(L"cache/api-responses.json"), true))
+            .WillOnce(Return(file.dump()));
+
+        ApiResponseCache diskCache(windows, L"cache/api-responses.json");
+        EXPECT_EQ(1, diskCache.Count());
+        EXPECT_TRUE(diskCache.Has("https://bar.com"));
+    }
+
+    TEST_F(ApiResponseCacheTest, ItStartsEmptyIfFileOnDiskIsInvalid)
+    {
+        EXPECT_CALL(windows, FileExists(std::wstring(L"cache/api-responses.json"))).WillOnce(Return(true));
+        EXPECT_CALL(windows, ReadFromFileMock(std::wstring(L"cache/api-responses.json"), true))
+            .WillOnce(Return("{]"));
+
+        ApiResponseCache diskCache(windows, L"cache/api-responses.json");
+        EXPECT_EQ(0, diskCache.Count());
+    }
+} // namespace UKControllerPluginUtilsTest::Api
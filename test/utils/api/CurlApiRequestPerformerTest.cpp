@@ -1,4 +1,5 @@
 #include "api/ApiCurlRequestFactory.h"
+#include "api/ApiHealthTracker.h"
 #include "api/ApiHeaderApplicator.h"
 #include "api/ApiRequestData.h"
 #include "api/ApiSettings.h"
@@ -13,6 +14,7 @@ using UKControllerPlugin::Curl::CurlResponse;
 using UKControllerPluginTest::Curl::MockCurlApi;
 using UKControllerPluginUtils::Api::ApiCurlRequestFactory;
 using UKControllerPluginUtils::Api::ApiHeaderApplicator;
+using UKControllerPluginUtils::Api::ApiHealthTracker;
 using UKControllerPluginUtils::Api::ApiRequestData;
 using UKControllerPluginUtils::Api::ApiRequestException;
 using UKControllerPluginUtils::Api::ApiSettings;
@@ -178,4 +180,32 @@ namespace UKControllerPluginUtilsTest::Api {
 
         GTEST_FAIL();
     }
+
+    TEST_F(CurlApiRequestPerformerTest, ItFailsFastOnceTheApiIsUnhealthy)
+    {
+        auto healthTracker = std::make_shared<ApiHealthTracker>();
+        CurlApiRequestPerformer trackingPerformer(curl, requestFactory, healthTracker);
+        EXPECT_CALL(curl, MakeCurlRequest(GetRequest()))
+            .Times(ApiHealthTracker::failureThreshold)
+            .WillRepeatedly(testing::Return(CurlResponse("", false, 502L)));
+
+        for (unsigned int i = 0; i < ApiHealthTracker::failureThreshold + 1; i++) {
+            EXPECT_THROW(static_cast<void>(trackingPerformer.Perform(requestData)), ApiRequestException);
+        }
+
+        EXPECT_FALSE(healthTracker->Healthy());
+    }
+
+    TEST_F(CurlApiRequestPerformerTest, ItRecordsSuccessfulRequestsWithTheHealthTracker)
+    {
+        auto healthTracker = std::make_shared<ApiHealthTracker>();
+        CurlApiRequestPerformer trackingPerformer(curl, requestFactory, healthTracker);
+        EXPECT_CALL(curl, MakeCurlRequest(GetRequest()))
+            .Times(1)
+            .WillOnce(testing::Return(CurlResponse(GetResponseJson(), false, 200L)));
+
+        static_cast<void>(trackingPerformer.Perform(requestData));
+        EXPECT_TRUE(healthTracker->Healthy());
+        EXPECT_EQ(UKControllerPluginUtils::Api::CircuitState::Closed, healthTracker->State("test"));
+    }
 } // namespace UKControllerPluginUtilsTest::Api
@@ -0,0 +1,42 @@
+#include <curl/curl.h>
+#include "curl/CurlApi.h"
+
+using UKControllerPlugin::Curl::CurlApi;
+
+namespace UKControllerPluginUtilsTest::Curl {
+
+    TEST(CurlApiTest, StreamsThatCompleteCloseNormally)
+    {
+        EXPECT_TRUE(CurlApi::StreamClosedNormally(CURLE_OK, false, true, 200));
+    }
+
+    TEST(CurlApiTest, StreamsThatAreCancelledCloseNormally)
+    {
+        EXPECT_TRUE(CurlApi::StreamClosedNormally(CURLE_WRITE_ERROR, true, true, 200));
+    }
+
+    TEST(CurlApiTest, StreamsRecycledAfterReceivingDataCloseNormally)
+    {
+        EXPECT_TRUE(CurlApi::StreamClosedNormally(CURLE_OPERATION_TIMEDOUT, false, true, 200));
+    }
+
+    TEST(CurlApiTest, StreamsThatTimeOutBeforeReceivingDataFail)
+    {
+        EXPECT_FALSE(CurlApi::StreamClosedNormally(CURLE_OPERATION_TIMEDOUT, false, false, 200));
+    }
+
+    TEST(CurlApiTest, StreamsThatTimeOutOnAnErrorResponseFail)
+    {
+        EXPECT_FALSE(CurlApi::StreamClosedNormally(CURLE_OPERATION_TIMEDOUT, false, true, 500));
+    }
+
+    TEST(CurlApiTest, StreamsThatTimeOutBeforeAResponseFail)
+    {
+        EXPECT_FALSE(CurlApi::StreamClosedNormally(CURLE_OPERATION_TIMEDOUT, false, false, 0));
+    }
+
+    TEST(CurlApiTest, StreamsWithOtherErrorsFail)
+    {
+        EXPECT_FALSE(CurlApi::StreamClosedNormally(CURLE_RECV_ERROR, false, true, 200));
+    }
+} // namespace UKControllerPluginUtilsTest::Curl
@@ -37,5 +37,19 @@ namespace UKControllerPluginUtilsTest {
             EXPECT_FALSE(response1.IsCurlError());
             EXPECT_TRUE(response2.IsCurlError());
         }
+
+        TEST(CurlResponse, GetHeaderReturnsHeaderCaseInsensitively)
+        {
+            CurlResponse response("TestResponse", false, 200);
+            response.AddHeader("ETag", "\"abc\"");
+            EXPECT_EQ("\"abc\"", response.GetHeader("etag"));
+            EXPECT_EQ("\"abc\"", response.GetHeader("ETAG"));
+        }
+
+        TEST(CurlResponse, GetHeaderReturnsEmptyIfNotSent)
+        {
+            CurlResponse response("TestResponse", false, 200);
+            EXPECT_TRUE(response.GetHeader("ETag").empty());
+        }
     } // namespace Curl
 } // namespace UKControllerPluginUtilsTest
@@ -0,0 +1,383 @@
+#include "eventhandler/BatchedEventHandler.h"
+#include "eventhandler/EventBatcher.h"
+#include "helper/Benchmark.h"
+#include "task/TaskRunner.h"
+
+using UKControllerPlugin::TaskManager::TaskRunner;
+using UKControllerPluginTest::RunBenchmark;
+using UKControllerPluginUtils::EventHandler::BatchedEventHandler;
+using UKControllerPluginUtils::EventHandler::EventBatcher;
+using UKControllerPluginUtils::EventHandler::EventHandler;
+
+namespace UKControllerPluginUtilsTest::EventHandler {
+
+    class RecordingBatchedHandler : public BatchedEventHandler<int>
+    {
+        public:
+        RecordingBatchedHandler(size_t maxBatchSize, std::chrono::milliseconds deadline)
+            : maxBatchSize(maxBatchSize), deadline(deadline)
+        {
+        }
+
+        void OnEvents(std::span<const int> events) override
+        {
+            std::lock_guard lock(batchesLock);
+            batches.emplace_back(events.begin(), events.end());
+            received += events.size();
+            batchReceived.notify_all();
+        }
+
+        [[nodiscard]] auto MaxBatchSize() const -> size_t override
+        {
+            return maxBatchSize;
+        }
+
+        [[nodiscard]] auto BatchDeadline() const -> std::chrono::milliseconds override
+        {
+            return deadline;
+        }
+
+        auto WaitForEvents(size_t count) -> bool
+        {
+            std::unique_lock lock(batchesLock);
+            return batchReceived.wait_for(lock, std::chrono::seconds(10), [this, count]() {
+                return received >= count;
+            });
+        }
+
+        [[nodiscard]] auto Batches() -> std::vector<std::vector<int>>
+        {
+            std::lock_guard lock(batchesLock);
+            return batches;
+        }
+
+        size_t maxBatchSize;
+        std::chrono::milliseconds deadline;
+        std::mutex batchesLock;
+        std::condition_variable batchReceived;
+        std::vector<std::vector<int>> batches;
+        size_t received = 0;
+    };
+
+    class ThrowingBatchedHandler : public RecordingBatchedHandler
+    {
+        public:
+        explicit ThrowingBatchedHandler(int throwOn)
+            : RecordingBatchedHandler(1, std::chrono::milliseconds(0)), throwOn(throwOn)
+        {
+        }
+
+        void OnEvents(std::span<const int> events) override
+        {
+            if (std::find(events.begin(), events.end(), throwOn) != events.end()) {
+                throw std::runtime_error("Batch failed");
+            }
+
+            RecordingBatchedHandler::OnEvents(events);
+        }
+
+        int throwOn;
+    };
+
+    class EventBatcherTest : public testing::Test
+    {
+        public:
+        EventBatcherTest()
+            : handler(std::make_shared<RecordingBatchedHandler>(4, std::chrono::milliseconds(0))),
+              batcher(std::make_unique<EventBatcher<int>>(handler, ScheduleTask()))
+        {
+        }
+
+        auto ScheduleTask()
+            -> std::function<void(std::chrono::steady_clock::time_point, const std::function<void(void)>&)>
+        {
+            return [this](std::chrono::steady_clock::time_point due, const std::function<void(void)>& task) {
+                tasks.emplace_back(due, task);
+            };
+        }
+
+        void RunTasks()
+        {
+            auto toRun = tasks;
+            tasks.clear();
+            for (const auto& task : toRun) {
+                task.second();
+            }
+        }
+
+        std::vector<std::pair<std::chrono::steady_clock::time_point, std::function<void(void)>>> tasks;
+        std::shared_ptr<RecordingBatchedHandler> handler;
+        std::unique_ptr<EventBatcher<int>> batcher;
+    };
+
+    TEST_F(EventBatcherTest, ItDoesntDeliverEventsOnTheCallingThread)
+    {
+        batcher->Add(1);
+        batcher->Add(2);
+        EXPECT_TRUE(handler->Batches().empty());
+        EXPECT_EQ(1, tasks.size());
+    }
+
+    TEST_F(EventBatcherTest, ItOnlySchedulesOneFlushAtATime)
+    {
+        for (int i = 0; i < 10; i++) {
+            batcher->Add(i);
+        }
+
+        EXPECT_EQ(1, tasks.size());
+    }
+
+    TEST_F(EventBatcherTest, ItSchedulesANewFlushOnceThePreviousHasStarted)
+    {
+        batcher->Add(1);
+        RunTasks();
+        batcher->Add(2);
+        EXPECT_EQ(1, tasks.size());
+        RunTasks();
+        EXPECT_EQ(std::vector<std::vector<int>>({{1}, {2}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDeliversEventsInTheOrderTheyWereAdded)
+    {
+        batcher->Add(3);
+        batcher->Add(1);
+        batcher->Add(2);
+        RunTasks();
+        EXPECT_EQ(std::vector<std::vector<int>>({{3, 1, 2}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItLimitsTheSizeOfEachBatch)
+    {
+        for (int i = 0; i < 10; i++) {
+            batcher->Add(i);
+        }
+        RunTasks();
+
+        EXPECT_EQ(std::vector<std::vector<int>>({{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItSchedulesAPartialBatchForTheDeadline)
+    {
+        handler = std::make_shared<RecordingBatchedHandler>(4, std::chrono::milliseconds(50));
+        batcher = std::make_unique<EventBatcher<int>>(handler, ScheduleTask());
+
+        const auto start = std::chrono::steady_clock::now();
+        batcher->Add(1);
+        ASSERT_EQ(1, tasks.size());
+        EXPECT_GE(tasks.front().first - start, std::chrono::milliseconds(50));
+
+        RunTasks();
+        EXPECT_EQ(std::vector<std::vector<int>>({{1}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItSchedulesAFullBatchStraightAway)
+    {
+        handler = std::make_shared<RecordingBatchedHandler>(3, std::chrono::minutes(1));
+        batcher = std::make_unique<EventBatcher<int>>(handler, ScheduleTask());
+
+        batcher->Add(1);
+        batcher->Add(2);
+        batcher->Add(3);
+        ASSERT_EQ(2, tasks.size());
+        EXPECT_LE(tasks.back().first, std::chrono::steady_clock::now());
+
+        tasks.back().second();
+        EXPECT_EQ(std::vector<std::vector<int>>({{1, 2, 3}}), handler->Batches());
+
+        // The flush at the deadline has nothing left to do
+        tasks.front().second();
+        EXPECT_EQ(std::vector<std::vector<int>>({{1, 2, 3}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItSchedulesANewFlushForEventsAddedOnceAFlushHasStarted)
+    {
+        handler = std::make_shared<RecordingBatchedHandler>(3, std::chrono::minutes(1));
+        batcher = std::make_unique<EventBatcher<int>>(handler, ScheduleTask());
+
+        batcher->Add(1);
+        batcher->Add(2);
+        batcher->Add(3);
+        tasks.back().second();
+
+        const auto start = std::chrono::steady_clock::now();
+        batcher->Add(4);
+        ASSERT_EQ(3, tasks.size());
+        EXPECT_GE(tasks.back().first - start, std::chrono::minutes(1));
+
+        tasks.back().second();
+        EXPECT_EQ(std::vector<std::vector<int>>({{1, 2, 3}, {4}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDoesntHoldATaskRunnerThreadWhilstWaitingForTheDeadline)
+    {
+        TaskRunner runner(1);
+        handler = std::make_shared<RecordingBatchedHandler>(4, std::chrono::minutes(1));
+        batcher = std::make_unique<EventBatcher<int>>(
+            handler, [&runner](std::chrono::steady_clock::time_point due, const std::function<void(void)>& task) {
+                runner.QueueAsynchronousTaskAt(due, task);
+            });
+        batcher->Add(1);
+
+        // The only thread is free to run other tasks whilst the batch waits
+        const auto other = std::make_shared<RecordingBatchedHandler>(1, std::chrono::milliseconds(0));
+        runner.QueueAsynchronousTask([other]() { other->OnEvent(1); });
+        EXPECT_TRUE(other->WaitForEvents(1));
+        EXPECT_TRUE(handler->Batches().empty());
+
+        batcher.reset();
+        EXPECT_EQ(std::vector<std::vector<int>>({{1}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDeliversWaitingEventsWhenFlushed)
+    {
+        for (int i = 0; i < 6; i++) {
+            batcher->Add(i);
+        }
+        batcher->Flush();
+
+        EXPECT_EQ(std::vector<std::vector<int>>({{0, 1, 2, 3}, {4, 5}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDeliversWaitingEventsOnDestruction)
+    {
+        batcher->Add(1);
+        batcher->Add(2);
+        batcher.reset();
+
+        EXPECT_EQ(std::vector<std::vector<int>>({{1, 2}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDoesNothingWhenAFlushRunsAfterDestruction)
+    {
+        batcher->Add(1);
+        batcher.reset();
+        RunTasks();
+
+        EXPECT_EQ(std::vector<std::vector<int>>({{1}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDeliversEventsInOrderWhenAddedFromAnotherThread)
+    {
+        handler = std::make_shared<RecordingBatchedHandler>(16, std::chrono::milliseconds(1));
+        std::vector<std::thread> workers;
+        std::mutex workersLock;
+        batcher = std::make_unique<EventBatcher<int>>(
+            handler,
+            [&workers, &workersLock](std::chrono::steady_clock::time_point due, const std::function<void(void)>& task) {
+                std::lock_guard lock(workersLock);
+                workers.emplace_back([due, task]() {
+                    std::this_thread::sleep_until(due);
+                    task();
+                });
+            });
+
+        std::thread producer([this]() {
+            for (int i = 0; i < 5000; i++) {
+                batcher->Add(i);
+            }
+        });
+        producer.join();
+        batcher.reset();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        std::vector<int> delivered;
+        for (const auto& batch : handler->Batches()) {
+            EXPECT_LE(batch.size(), 16);
+            delivered.insert(delivered.end(), batch.begin(), batch.end());
+        }
+
+        std::vector<int> expected(5000);
+        std::iota(expected.begin(), expected.end(), 0);
+        EXPECT_EQ(expected, delivered);
+    }
+
+    TEST_F(EventBatcherTest, ItSchedulesANewFlushIfTheHandlerThrows)
+    {
+        handler = std::make_shared<ThrowingBatchedHandler>(1);
+        batcher = std::make_unique<EventBatcher<int>>(handler, ScheduleTask());
+
+        batcher->Add(1);
+        EXPECT_THROW(RunTasks(), std::runtime_error);
+
+        batcher->Add(2);
+        EXPECT_EQ(1, tasks.size());
+        RunTasks();
+        EXPECT_EQ(std::vector<std::vector<int>>({{2}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, ItDeliversTheRemainingBatchesOnDestructionIfTheHandlerThrows)
+    {
+        handler = std::make_shared<ThrowingBatchedHandler>(2);
+        batcher = std::make_unique<EventBatcher<int>>(handler, ScheduleTask());
+
+        batcher->Add(1);
+        batcher->Add(2);
+        batcher->Add(3);
+        EXPECT_NO_THROW(batcher.reset());
+        EXPECT_EQ(std::vector<std::vector<int>>({{1}, {3}}), handler->Batches());
+    }
+
+    TEST_F(EventBatcherTest, BatchedHandlersTreatASingleEventAsABatchOfOne)
+    {
+        handler->OnEvent(55);
+        EXPECT_EQ(std::vector<std::vector<int>>({{55}}), handler->Batches());
+    }
+
+    class CountingEventHandler : public EventHandler<int>
+    {
+        public:
+        void OnEvent(const int& event) override
+        {
+            std::lock_guard lock(countLock);
+            count++;
+            counted.notify_all();
+        }
+
+        void WaitForEvents(int events)
+        {
+            std::unique_lock lock(countLock);
+            counted.wait(lock, [this, events]() { return count >= events; });
+        }
+
+        std::mutex countLock;
+        std::condition_variable counted;
+        int count = 0;
+    };
+
+    /*
+     * Compares delivering a burst of 10k events to an asynchronous handler as a task per event against
+     * delivering the same burst to a batched handler.
+     */
+    TEST_F(EventBatcherTest, DISABLED_BenchmarkAsyncEventBurst)
+    {
+        const int burstSize = 10000;
+        TaskRunner runner(3);
+
+        const auto single = RunBenchmark("10k event burst, one task per event", 20, [&runner]() {
+            const auto countingHandler = std::make_shared<CountingEventHandler>();
+            for (int i = 0; i < burstSize; i++) {
+                runner.QueueAsynchronousTask([countingHandler, i]() { countingHandler->OnEvent(i); });
+            }
+            countingHandler->WaitForEvents(burstSize);
+        });
+
+        const auto batched = RunBenchmark("10k event burst, batched", 20, [&runner]() {
+            const auto batchedHandler = std::make_shared<RecordingBatchedHandler>(
+                BatchedEventHandler<int>::defaultMaxBatchSize, BatchedEventHandler<int>::defaultBatchDeadline);
+            EventBatcher<int> burstBatcher(
+                batchedHandler,
+                [&runner](std::chrono::steady_clock::time_point due, const std::function<void(void)>& task) {
+                    runner.QueueAsynchronousTaskAt(due, task);
+                });
+            for (int i = 0; i < burstSize; i++) {
+                burstBatcher.Add(i);
+            }
+            batchedHandler->WaitForEvents(burstSize);
+        });
+
+        std::cout << "[ BENCHMARK] Speedup: " << static_cast<double>(single.count()) / batched.count() << "x"
+                  << std::endl;
+    }
+} // namespace UKControllerPluginUtilsTest::EventHandler
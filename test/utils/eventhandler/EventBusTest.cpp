@@ -1,8 +1,15 @@
 #include "eventhandler/EventBus.h"
 #include "eventhandler/EventHandler.h"
+#include "eventhandler/EventStream.h"
+#include "eventhandler/MutableEventBus.h"
+#include "helper/Benchmark.h"
 #include "test/EventBusTestCase.h"
 
+using UKControllerPluginTest::RunBenchmark;
 using UKControllerPluginUtils::EventHandler::EventBus;
+using UKControllerPluginUtils::EventHandler::EventHandlerFlags;
+using UKControllerPluginUtils::EventHandler::EventStream;
+using UKControllerPluginUtils::EventHandler::MutableEventBus;
 
 namespace UKControllerPluginUtilsTest::EventHandler {
     class EventBusTest : public EventBusTestCase
@@ -21,6 +28,49 @@ namespace UKControllerPluginUtilsTest::EventHandler {
         int receivedValue = -1;
     };
 
+    class OrderRecordingHandler : public UKControllerPluginUtils::EventHandler::EventHandler<int>
+    {
+        public:
+        OrderRecordingHandler(int id, std::vector<int>& order) : id(id), order(order)
+        {
+        }
+
+        void OnEvent(const int& event) override
+        {
+            order.push_back(id);
+        }
+
+        int id;
+        std::vector<int>& order;
+    };
+
+    class StringHandler : public UKControllerPluginUtils::EventHandler::EventHandler<std::string>
+    {
+        public:
+        void OnEvent(const std::string& event) override
+        {
+            receivedValue = event;
+        }
+
+        std::string receivedValue;
+    };
+
+    template <typename T> class CountingHandler : public UKControllerPluginUtils::EventHandler::EventHandler<T>
+    {
+        public:
+        void OnEvent(const T& event) override
+        {
+            count++;
+        }
+
+        std::atomic<int> count = 0;
+    };
+
+    template <int N> struct ConcurrentEvent
+    {
+        int value;
+    };
+
     TEST_F(EventBusTest, ItProcessesAnEvent)
     {
         const auto handler = std::make_shared<MockHandler>();
@@ -64,4 +114,171 @@ namespace UKControllerPluginUtilsTest::EventHandler {
         EXPECT_EQ(1, EventBusObserver().observedEvents.size());
         EXPECT_EQ(123, std::any_cast<int>(EventBusObserver().observedEvents[0]));
     }
+
+    TEST_F(EventBusTest, ItProcessesHandlersInTheOrderTheyWereRegistered)
+    {
+        std::vector<int> order;
+        EventBus::Bus().AddHandler<int>(std::make_shared<OrderRecordingHandler>(1, order), EventHandlerFlags::Sync);
+        EventBus::Bus().AddHandler<int>(std::make_shared<OrderRecordingHandler>(2, order), EventHandlerFlags::Sync);
+        EventBus::Bus().AddHandler<int>(std::make_shared<OrderRecordingHandler>(3, order), EventHandlerFlags::Sync);
+        EventBus::Bus().OnEvent(123);
+        EXPECT_EQ(std::vector<int>({1, 2, 3}), order);
+    }
+
+    TEST_F(EventBusTest, ItProcessesHandlersRegisteredAfterEventsHaveBeenDispatched)
+    {
+        const auto handler1 = std::make_shared<MockHandler>();
+        const auto handler2 = std::make_shared<MockHandler>();
+        EventBus::Bus().AddHandler<int>(handler1, EventHandlerFlags::Sync);
+        EventBus::Bus().OnEvent(123);
+        EventBus::Bus().AddHandler<int>(handler2, EventHandlerFlags::Sync);
+        EventBus::Bus().OnEvent(456);
+        EXPECT_EQ(456, handler1->receivedValue);
+        EXPECT_EQ(456, handler2->receivedValue);
+    }
+
+    TEST_F(EventBusTest, ItOnlyProcessesEventsWithHandlersForThatType)
+    {
+        const auto intHandler = std::make_shared<MockHandler>();
+        const auto stringHandler = std::make_shared<StringHandler>();
+        EventBus::Bus().AddHandler<int>(intHandler, EventHandlerFlags::Sync);
+        EventBus::Bus().AddHandler<std::string>(stringHandler, EventHandlerFlags::Sync);
+
+        EventBus::Bus().OnEvent(std::string("abc"));
+        EXPECT_EQ(-1, intHandler->receivedValue);
+        EXPECT_EQ("abc", stringHandler->receivedValue);
+
+        EventBus::Bus().OnEvent(123);
+        EXPECT_EQ(123, intHandler->receivedValue);
+        EXPECT_EQ("abc", stringHandler->receivedValue);
+    }
+
+    TEST_F(EventBusTest, ItProcessesAnEventWithNoHandlers)
+    {
+        EXPECT_NO_THROW(EventBus::Bus().OnEvent(std::string("abc")));
+        AssertEventHandlerRegistrationsCountForEvent<std::string>(0);
+    }
+
+    TEST_F(EventBusTest, ItProcessesEventsOfManyTypesFromManyThreads)
+    {
+        MutableEventBus bus(std::make_shared<UKControllerPluginUtilsTest::TestEuroscopeThreadEventProcessor>());
+        const auto handler0 = std::make_shared<CountingHandler<ConcurrentEvent<0>>>();
+        const auto handler1 = std::make_shared<CountingHandler<ConcurrentEvent<1>>>();
+        const auto handler2 = std::make_shared<CountingHandler<ConcurrentEvent<2>>>();
+        const auto handler3 = std::make_shared<CountingHandler<ConcurrentEvent<3>>>();
+        const int eventsPerThread = 1000;
+
+        // Each thread registers its own handler then fires events, so streams are created concurrently
+        std::vector<std::thread> threads;
+        threads.emplace_back([&bus, &handler0]() {
+            bus.AddHandler<ConcurrentEvent<0>>(handler0, EventHandlerFlags::Sync);
+            for (int i = 0; i < eventsPerThread; i++) {
+                bus.OnEvent(ConcurrentEvent<0>{i});
+            }
+        });
+        threads.emplace_back([&bus, &handler1]() {
+            bus.AddHandler<ConcurrentEvent<1>>(handler1, EventHandlerFlags::Sync);
+            for (int i = 0; i < eventsPerThread; i++) {
+                bus.OnEvent(ConcurrentEvent<1>{i});
+            }
+        });
+        threads.emplace_back([&bus, &handler2]() {
+            bus.AddHandler<ConcurrentEvent<2>>(handler2, EventHandlerFlags::Sync);
+            for (int i = 0; i < eventsPerThread; i++) {
+                bus.OnEvent(ConcurrentEvent<2>{i});
+            }
+        });
+        threads.emplace_back([&bus, &handler3]() {
+            bus.AddHandler<ConcurrentEvent<3>>(handler3, EventHandlerFlags::Sync);
+            for (int i = 0; i < eventsPerThread; i++) {
+                bus.OnEvent(ConcurrentEvent<3>{i});
+            }
+        });
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(eventsPerThread, handler0->count);
+        EXPECT_EQ(eventsPerThread, handler1->count);
+        EXPECT_EQ(eventsPerThread, handler2->count);
+        EXPECT_EQ(eventsPerThread, handler3->count);
+    }
+
+    TEST_F(EventBusTest, ItAddsHandlersWhilstEventsAreBeingDispatched)
+    {
+        MutableEventBus bus(std::make_shared<UKControllerPluginUtilsTest::TestEuroscopeThreadEventProcessor>());
+        const auto firstHandler = std::make_shared<CountingHandler<ConcurrentEvent<4>>>();
+        bus.AddHandler<ConcurrentEvent<4>>(firstHandler, EventHandlerFlags::Sync);
+
+        std::vector<std::shared_ptr<CountingHandler<ConcurrentEvent<4>>>> laterHandlers;
+        for (int i = 0; i < 50; i++) {
+            laterHandlers.push_back(std::make_shared<CountingHandler<ConcurrentEvent<4>>>());
+        }
+
+        std::thread dispatcher([&bus]() {
+            for (int i = 0; i < 1000; i++) {
+                bus.OnEvent(ConcurrentEvent<4>{i});
+            }
+        });
+        std::thread registrar([&bus, &laterHandlers]() {
+            for (const auto& handler : laterHandlers) {
+                bus.AddHandler<ConcurrentEvent<4>>(handler, EventHandlerFlags::Sync);
+            }
+        });
+        dispatcher.join();
+        registrar.join();
+
+        // Every handler must be present, and the first handler sees every event
+        bus.OnEvent(ConcurrentEvent<4>{1000});
+        EXPECT_EQ(1001, firstHandler->count);
+        for (const auto& handler : laterHandlers) {
+            EXPECT_GE(handler->count, 1);
+        }
+    }
+
+    /*
+     * Compares the cost of dispatching an event through the bus against the previous approach of
+     * finding the stream via a std::map keyed on std::type_index and then casting it out of a std::any.
+     */
+    TEST_F(EventBusTest, DISABLED_BenchmarkEventDispatch)
+    {
+        const auto processor = std::make_shared<UKControllerPluginUtilsTest::TestEuroscopeThreadEventProcessor>();
+        const auto handler = std::make_shared<CountingHandler<int>>();
+        const int iterations = 1000000;
+
+        // Register a selection of other event types, so the lookup isn't trivial
+        MutableEventBus bus(processor);
+        std::map<std::type_index, std::any> mapStreams;
+        const auto addOtherStream = [&bus, &mapStreams, &processor]<typename T>(T) {
+            bus.AddHandler<T>(std::make_shared<CountingHandler<T>>(), EventHandlerFlags::Sync);
+            mapStreams.insert({std::type_index(typeid(T)), std::any(std::make_shared<EventStream<T>>(processor))});
+        };
+        addOtherStream(ConcurrentEvent<10>{});
+        addOtherStream(ConcurrentEvent<11>{});
+        addOtherStream(ConcurrentEvent<12>{});
+        addOtherStream(ConcurrentEvent<13>{});
+        addOtherStream(std::string());
+        addOtherStream(double());
+
+        bus.AddHandler<int>(handler, EventHandlerFlags::Sync);
+        const auto intStream = std::make_shared<EventStream<int>>(processor);
+        intStream->AddHandler(handler, EventHandlerFlags::Sync);
+        mapStreams.insert({std::type_index(typeid(int)), std::any(intStream)});
+
+        const auto before = RunBenchmark("EventBus dispatch via type_index map and any_cast", iterations, [&]() {
+            const auto index = std::type_index(typeid(int));
+            if (!mapStreams.contains(index)) {
+                return;
+            }
+
+            std::any_cast<std::shared_ptr<EventStream<int>>>(mapStreams.at(index))->OnEvent(123);
+        });
+        const auto after =
+            RunBenchmark("EventBus dispatch via event type id", iterations, [&bus]() { bus.OnEvent(123); });
+
+        std::cout << "[ BENCHMARK] Speedup: " << static_cast<double>(before.count()) / after.count() << "x"
+                  << std::endl;
+        EXPECT_EQ(2 * (iterations + 1), handler->count);
+    }
 } // namespace UKControllerPluginUtilsTest::EventHandler
@@ -1,4 +1,5 @@
 #include "MockEuroscopeThreadEventSink.h"
+#include "eventhandler/BatchedEventHandler.h"
 #include "eventhandler/EventHandler.h"
 #include "eventhandler/EventStream.h"
 #include "test/EventBusTestCase.h"
@@ -28,6 +29,22 @@ namespace UKControllerPluginUtilsTest::EventHandler {
         int receivedValue = -1;
     };
 
+    class MockBatchedHandler : public UKControllerPluginUtils::EventHandler::BatchedEventHandler<int>
+    {
+        public:
+        void OnEvents(std::span<const int> events) override
+        {
+            batches.emplace_back(events.begin(), events.end());
+        }
+
+        [[nodiscard]] auto BatchDeadline() const -> std::chrono::milliseconds override
+        {
+            return std::chrono::milliseconds(0);
+        }
+
+        std::vector<std::vector<int>> batches;
+    };
+
     TEST_F(EventStreamTest, ItProcessesAnEvent)
     {
         const auto handler = std::make_shared<MockHandler>();
@@ -66,4 +83,32 @@ namespace UKControllerPluginUtilsTest::EventHandler {
         EXPECT_EQ(123, handler1->receivedValue);
         EXPECT_EQ(123, handler2->receivedValue);
     }
+
+    TEST_F(EventStreamTest, ItProcessesAnEventToABatchedAsyncHandler)
+    {
+        const auto handler = std::make_shared<MockBatchedHandler>();
+        stream.AddHandler(handler, UKControllerPluginUtils::EventHandler::EventHandlerFlags::Async);
+        stream.OnEvent(123);
+        stream.OnEvent(456);
+        EXPECT_EQ(std::vector<std::vector<int>>({{123}, {456}}), handler->batches);
+        EXPECT_NE(nullptr, stream.Handlers()->at(0).batcher);
+    }
+
+    TEST_F(EventStreamTest, ItDoesntBatchEventsForBatchedSyncHandlers)
+    {
+        const auto handler = std::make_shared<MockBatchedHandler>();
+        stream.AddHandler(handler, UKControllerPluginUtils::EventHandler::EventHandlerFlags::Sync);
+        stream.OnEvent(123);
+        EXPECT_EQ(std::vector<std::vector<int>>({{123}}), handler->batches);
+        EXPECT_EQ(nullptr, stream.Handlers()->at(0).batcher);
+    }
+
+    TEST_F(EventStreamTest, ItDoesntBatchEventsForNonBatchedAsyncHandlers)
+    {
+        const auto handler = std::make_shared<MockHandler>();
+        stream.AddHandler(handler, UKControllerPluginUtils::EventHandler::EventHandlerFlags::Async);
+        stream.OnEvent(123);
+        EXPECT_EQ(123, handler->receivedValue);
+        EXPECT_EQ(nullptr, stream.Handlers()->at(0).batcher);
+    }
 } // namespace UKControllerPluginUtilsTest::EventHandler
@@ -0,0 +1,45 @@
+#include "eventhandler/EventTypeId.h"
+
+using UKControllerPluginUtils::EventHandler::EventTypeId;
+
+namespace UKControllerPluginUtilsTest::EventHandler {
+
+    struct EventTypeIdTestEventOne
+    {
+    };
+
+    struct EventTypeIdTestEventTwo
+    {
+    };
+
+    TEST(EventTypeIdTest, ItReturnsTheSameIdForTheSameType)
+    {
+        EXPECT_EQ(EventTypeId<EventTypeIdTestEventOne>(), EventTypeId<EventTypeIdTestEventOne>());
+    }
+
+    TEST(EventTypeIdTest, ItReturnsDifferentIdsForDifferentTypes)
+    {
+        EXPECT_NE(EventTypeId<EventTypeIdTestEventOne>(), EventTypeId<EventTypeIdTestEventTwo>());
+    }
+
+    TEST(EventTypeIdTest, ItAssignsTheSameIdWhenFirstRequestedConcurrently)
+    {
+        struct ConcurrentEvent
+        {
+        };
+
+        std::vector<size_t> ids(8);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < ids.size(); i++) {
+            threads.emplace_back([&ids, i]() { ids[i] = EventTypeId<ConcurrentEvent>(); });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (const auto id : ids) {
+            EXPECT_EQ(ids[0], id);
+        }
+    }
+} // namespace UKControllerPluginUtilsTest::EventHandler
@@ -13,5 +13,6 @@ namespace UKControllerPluginTest::Setting {
         MOCK_METHOD(void, Save, (const std::string&, const std::string&), (override));
         MOCK_METHOD(const std::set<std::string>&, Provides, (), (override));
         MOCK_METHOD(void, Reload, (), (override));
+        MOCK_METHOD(void, Flush, (), (override));
     };
 } // namespace UKControllerPluginTest::Setting
@@ -13,11 +13,16 @@
 #include "ShlObj.h"
 #include "shtypes.h"
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <mutex>
+#include <numeric>
+#include <random>
 #include <regex>
 #include <string>
+#include <thread>
+#include <typeindex>
 
 // Mocks
 #include "mock/MockSettingProvider.h"
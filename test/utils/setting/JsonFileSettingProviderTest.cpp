@@ -18,13 +18,55 @@ namespace UKControllerPluginTest::Setting {
 
             ON_CALL(windows, ReadFromFileMock(std::wstring(L"settings/setting-file.json"), true))
                 .WillByDefault(testing::Return(settings.dump()));
+
+            // Keep written files in memory
+            ON_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_))
+                .WillByDefault([this](const std::wstring& file, const std::string& data, bool, bool) {
+                    files[file] = data;
+                    return true;
+                });
+            ON_CALL(windows, MoveFileToNewLocation(testing::_, testing::_))
+                .WillByDefault([this](const std::wstring& from, const std::wstring& to) {
+                    files[to] = files.at(from);
+                    files.erase(from);
+                    return true;
+                });
+        }
+
+        /*
+            Background writes are queued up rather than run, so the tests can decide when the write delay is up.
+        */
+        [[nodiscard]] auto GetProvider(std::chrono::milliseconds writeDelay = std::chrono::milliseconds(0))
+            -> JsonFileSettingProvider
+        {
+            return {
+                L"setting-file.json",
+                std::set<std::string>{"setting1", "setting2"},
+                windows,
+                writeDelay,
+                [this](std::chrono::steady_clock::time_point due, const std::function<void(void)>& task) {
+                    backgroundTaskDueTimes.push_back(due);
+                    backgroundTasks.push_back(task);
+                }};
+        }
+
+        void RunBackgroundTasks()
+        {
+            auto tasks = std::move(backgroundTasks);
+            backgroundTasks.clear();
+            for (const auto& task : tasks) {
+                task();
+            }
         }
 
-        [[nodiscard]] auto GetProvider() -> JsonFileSettingProvider
+        [[nodiscard]] auto WrittenSettings() const -> nlohmann::json
         {
-            return {L"setting-file.json", std::set<std::string>{"setting1", "setting2"}, windows};
+            return nlohmann::json::parse(files.at(L"settings/setting-file.json"));
         }
 
+        std::map<std::wstring, std::string> files;
+        std::vector<std::function<void(void)>> backgroundTasks;
+        std::vector<std::chrono::steady_clock::time_point> backgroundTaskDueTimes;
         testing::NiceMock<Windows::MockWinApi> windows;
     };
 
@@ -49,13 +91,191 @@ namespace UKControllerPluginTest::Setting {
     {
         nlohmann::json updatedSettings{{"setting2", "value2a"}, {"setting1", "value1"}};
 
+        testing::InSequence sequence;
         EXPECT_CALL(
-            windows, WriteToFile(std::wstring(L"settings/setting-file.json"), updatedSettings.dump(), true, false))
+            windows,
+            TryWriteToFile(std::wstring(L"settings/setting-file.json.tmp"), updatedSettings.dump(), true, false))
+            .Times(1);
+        EXPECT_CALL(
+            windows,
+            MoveFileToNewLocation(
+                std::wstring(L"settings/setting-file.json.tmp"), std::wstring(L"settings/setting-file.json")))
             .Times(1);
 
         auto provider = GetProvider();
         provider.Save("setting2", "value2a");
         EXPECT_EQ("value2a", provider.Get("setting2"));
+        RunBackgroundTasks();
+        EXPECT_EQ(updatedSettings, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItDoesntWriteSettingsOnTheCallingThread)
+    {
+        auto provider = GetProvider();
+        provider.Save("setting2", "value2a");
+        EXPECT_TRUE(files.empty());
+        EXPECT_EQ(1, backgroundTasks.size());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItCoalescesBurstsOfSavesIntoOneWrite)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_)).Times(1);
+
+        auto provider = GetProvider();
+        for (int i = 0; i < 100; i++) { // NOLINT
+            provider.Save("setting1", "value" + std::to_string(i));
+            provider.Save("setting2", "other" + std::to_string(i));
+        }
+        EXPECT_EQ(1, backgroundTasks.size());
+        RunBackgroundTasks();
+
+        nlohmann::json expected{{"setting1", "value99"}, {"setting2", "other99"}};
+        EXPECT_EQ(expected, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItWritesAgainForChangesAfterAWrite)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_)).Times(2);
+
+        auto provider = GetProvider();
+        provider.Save("setting1", "value1a");
+        provider.Save("setting1", "value1b");
+        RunBackgroundTasks();
+        provider.Save("setting2", "value2a");
+        provider.Save("setting2", "value2b");
+        RunBackgroundTasks();
+
+        nlohmann::json expected{{"setting1", "value1b"}, {"setting2", "value2b"}};
+        EXPECT_EQ(expected, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItWritesOutstandingChangesOnFlush)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_)).Times(1);
+
+        auto provider = GetProvider();
+        provider.Save("setting1", "value1a");
+        provider.Flush();
+
+        // The background write has nothing left to do
+        RunBackgroundTasks();
+        nlohmann::json expected{{"setting1", "value1a"}, {"setting2", "value2"}};
+        EXPECT_EQ(expected, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItDoesntWriteOnFlushIfNothingHasChanged)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_)).Times(0);
+        GetProvider().Flush();
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItWritesOutstandingChangesWhenDestroyed)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_)).Times(1);
+
+        {
+            auto provider = GetProvider();
+            provider.Save("setting1", "value1a");
+            provider.Save("setting2", "value2a");
+        }
+
+        nlohmann::json expected{{"setting1", "value1a"}, {"setting2", "value2a"}};
+        EXPECT_EQ(expected, WrittenSettings());
+
+        // The background write must not touch the destroyed provider
+        RunBackgroundTasks();
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItKeepsChangesIfTheFileCannotBeMovedIntoPlace)
+    {
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_)).Times(2);
+        EXPECT_CALL(windows, MoveFileToNewLocation(testing::_, testing::_))
+            .WillOnce(testing::Return(false))
+            .WillOnce([this](const std::wstring& from, const std::wstring& to) {
+                files[to] = files.at(from);
+                return true;
+            });
+
+        auto provider = GetProvider();
+        provider.Save("setting1", "value1a");
+        RunBackgroundTasks();
+        EXPECT_FALSE(files.contains(L"settings/setting-file.json"));
+
+        provider.Flush();
+        nlohmann::json expected{{"setting1", "value1a"}, {"setting2", "value2"}};
+        EXPECT_EQ(expected, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItSchedulesTheWriteForTheEndOfTheWriteDelay)
+    {
+        const auto before = std::chrono::steady_clock::now();
+        auto provider = GetProvider(std::chrono::seconds(10));
+        provider.Save("setting1", "value1a");
+        provider.Save("setting1", "value1b");
+        const auto after = std::chrono::steady_clock::now();
+
+        ASSERT_EQ(1, backgroundTaskDueTimes.size());
+        EXPECT_GE(backgroundTaskDueTimes.front(), before + std::chrono::seconds(10));
+        EXPECT_LE(backgroundTaskDueTimes.front(), after + std::chrono::seconds(10));
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItKeepsChangesMadeWhileWriting)
+    {
+        auto provider = GetProvider();
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_))
+            .WillOnce([this, &provider](const std::wstring& file, const std::string& data, bool, bool) {
+                // The settings aren't locked while the disk is busy
+                provider.Save("setting2", "value2a");
+                EXPECT_EQ("value2a", provider.Get("setting2"));
+                files[file] = data;
+                return true;
+            })
+            .WillOnce([this](const std::wstring& file, const std::string& data, bool, bool) {
+                files[file] = data;
+                return true;
+            });
+
+        provider.Save("setting1", "value1a");
+        RunBackgroundTasks();
+        nlohmann::json firstWrite{{"setting1", "value1a"}, {"setting2", "value2"}};
+        EXPECT_EQ(firstWrite, WrittenSettings());
+
+        // The change made during the write gets a write of its own
+        RunBackgroundTasks();
+        nlohmann::json secondWrite{{"setting1", "value1a"}, {"setting2", "value2a"}};
+        EXPECT_EQ(secondWrite, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItDoesntShowAMessageBoxIfTheWriteFails)
+    {
+        EXPECT_CALL(windows, OpenMessageBox(testing::_, testing::_, testing::_)).Times(0);
+        EXPECT_CALL(windows, TryWriteToFile(testing::_, testing::_, testing::_, testing::_))
+            .WillOnce(testing::Return(false))
+            .WillOnce([this](const std::wstring& file, const std::string& data, bool, bool) {
+                files[file] = data;
+                return true;
+            });
+        EXPECT_CALL(windows, MoveFileToNewLocation(testing::_, testing::_)).Times(1);
+
+        auto provider = GetProvider();
+        provider.Save("setting1", "value1a");
+        RunBackgroundTasks();
+        EXPECT_FALSE(files.contains(L"settings/setting-file.json"));
+
+        // The changes are kept for the next write
+        provider.Flush();
+        nlohmann::json expected{{"setting1", "value1a"}, {"setting2", "value2"}};
+        EXPECT_EQ(expected, WrittenSettings());
+    }
+
+    TEST_F(JsonFileSettingProviderTest, ItWritesOutstandingChangesBeforeReloading)
+    {
+        auto provider = GetProvider();
+        provider.Save("setting1", "value1a");
+        provider.Reload();
+
+        nlohmann::json expected{{"setting1", "value1a"}, {"setting2", "value2"}};
+        EXPECT_EQ(expected, WrittenSettings());
     }
 
     TEST_F(JsonFileSettingProviderTest, ItReloadsSettingValues)
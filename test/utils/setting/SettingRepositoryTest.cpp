@@ -137,4 +137,16 @@ namespace UKControllerPluginUtilsTest::Setting {
 
         repository.ReloadSetting("setting3");
     }
+
+    TEST_F(SettingRepositoryTest, ItFlushesEachProviderOnce)
+    {
+        EXPECT_CALL(*mockProvider1, Flush()).Times(1);
+
+        EXPECT_CALL(*mockProvider2, Flush()).Times(1);
+
+        repository.AddProvider(mockProvider1);
+        repository.AddProvider(mockProvider2);
+
+        repository.Flush();
+    }
 } // namespace UKControllerPluginUtilsTest::Setting
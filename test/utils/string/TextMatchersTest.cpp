@@ -0,0 +1,238 @@
+#include "helper/Benchmark.h"
+#include "string/TextMatchers.h"
+
+using UKControllerPluginTest::RunBenchmark;
+using UKControllerPluginUtils::String::IsCircuitRoute;
+using UKControllerPluginUtils::String::MatchAirfieldOwnerCommand;
+using UKControllerPluginUtils::String::MatchAirfieldsOwnedCommand;
+using UKControllerPluginUtils::String::MatchFlightLevel;
+using UKControllerPluginUtils::String::MatchHoldCommand;
+using UKControllerPluginUtils::String::MatchNoholdCommand;
+using UKControllerPluginUtils::String::MatchPressureCommand;
+using UKControllerPluginUtils::String::MatchSelcal;
+
+namespace UKControllerPluginUtilsTest::String {
+
+    /*
+        Checks each matcher against the regular expression it replaced, on inputs built from fragments
+        of the pattern mixed with random characters, so that near misses are well covered.
+    */
+    class TextMatchersTest : public testing::Test
+    {
+        public:
+        [[nodiscard]] auto Fuzz(const std::vector<std::string>& fragments, int count) -> std::vector<std::string>
+        {
+            // Line terminators are left out, as implementations differ on whether . matches \r
+            static const std::string characters = "ABCEFGHJKLMNOPQRSTUVWXYZaeiklnoprsuvwdhz0123456789 \t\v\f-_/.";
+            std::uniform_int_distribution<size_t> pieces(0, 5);
+            std::uniform_int_distribution<size_t> fragment(0, fragments.size() - 1);
+            std::uniform_int_distribution<size_t> character(0, characters.size() - 1);
+            std::bernoulli_distribution useFragment(0.7);
+
+            std::vector<std::string> inputs{""};
+            for (int i = 0; i < count; i++) {
+                std::string input;
+                const auto pieceCount = pieces(random);
+                for (size_t piece = 0; piece < pieceCount; piece++) {
+                    if (useFragment(random)) {
+                        input += fragments[fragment(random)];
+                    } else {
+                        input += characters[character(random)];
+                    }
+                }
+
+                inputs.push_back(input);
+            }
+
+            return inputs;
+        }
+
+        [[nodiscard]] static auto SearchCapture(const std::string& input, const std::regex& pattern, int capture)
+            -> std::optional<std::string>
+        {
+            std::smatch matches;
+            if (!std::regex_search(input, matches, pattern)) {
+                return std::nullopt;
+            }
+
+            return matches[capture].str();
+        }
+
+        [[nodiscard]] static auto MatchCapture(const std::string& input, const std::regex& pattern, int capture)
+            -> std::optional<std::string>
+        {
+            std::smatch matches;
+            if (!std::regex_match(input, matches, pattern)) {
+                return std::nullopt;
+            }
+
+            return matches[capture].str();
+        }
+
+        [[nodiscard]] static auto ToString(std::optional<std::string_view> view) -> std::optional<std::string>
+        {
+            return view ? std::optional<std::string>(std::string(*view)) : std::nullopt;
+        }
+
+        // Seeded, so that any failure can be reproduced
+        std::mt19937 random{20211018}; // NOLINT
+        static const int FUZZ_COUNT = 20000;
+    };
+
+    TEST_F(TextMatchersTest, CircuitRouteMatchesRegex)
+    {
+        const std::regex pattern("^(?:VFR )?CIRCUIT(?:S)?", std::regex::icase);
+        for (const auto& input :
+             Fuzz({"VFR ", "vfr ", "VFR", "CIRCUIT", "circuits", "CirCuit", "CIRCUI", " ", "S", "DCT"}, FUZZ_COUNT)) {
+            EXPECT_EQ(std::regex_search(input, pattern), IsCircuitRoute(input)) << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, SelcalMatchesRegex)
+    {
+        const std::regex pattern("(\\s+|^)SEL/([ABCDEFGHJKLMPQRS]{4})(\\s+|$)");
+        for (const auto& input :
+             Fuzz({"SEL/", "SEL", "sel/", " ", "\t", "AB", "CD", "ABCD", "EFGH", "JKLM", "PQRS", "ABIC", "RMK/"},
+                  FUZZ_COUNT)) {
+            EXPECT_EQ(SearchCapture(input, pattern, 2), ToString(MatchSelcal(input))) << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, FlightLevelMatchesRegex)
+    {
+        const std::regex pattern("^(?:FL)?(\\d{2,3})$|^(\\d{4,5})$");
+        for (const auto& input : Fuzz({"FL", "F", "L", "fl", "0", "1", "35", "350", "8000", " "}, FUZZ_COUNT)) {
+            std::smatch matches;
+            std::optional<std::string> expected;
+            if (std::regex_match(input, matches, pattern)) {
+                expected = matches[1].matched ? matches[1].str() : matches[2].str();
+            }
+
+            EXPECT_EQ(expected, ToString(MatchFlightLevel(input))) << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, AirfieldOwnerCommandMatchesRegex)
+    {
+        const std::regex pattern(".ukcp owner ([A-Za-z]{4})");
+        for (const auto& input :
+             Fuzz({".ukcp owner ", "ukcp owner ", ".ukcp owned ", ".", "EGLL", "egkk", "EG", "X", " "}, FUZZ_COUNT)) {
+            EXPECT_EQ(SearchCapture(input, pattern, 1), ToString(MatchAirfieldOwnerCommand(input)))
+                << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, AirfieldsOwnedCommandMatchesRegex)
+    {
+        const std::regex pattern(".ukcp owned ([A-Za-z0-9_-]+)");
+        for (const auto& input :
+             Fuzz({".ukcp owned ", "ukcp owned ", ".ukcp owner ", ".", "EGKK_TWR", "LON-S", "_", " "}, FUZZ_COUNT)) {
+            EXPECT_EQ(SearchCapture(input, pattern, 1), ToString(MatchAirfieldsOwnedCommand(input)))
+                << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, NoholdCommandMatchesRegex)
+    {
+        const std::regex pattern("^\\.ukcp nohold( ([A-Za-z0-9\\-_]+))?$");
+        for (const auto& input :
+             Fuzz({".ukcp nohold", ".ukcp nohold ", ".ukcp hold ", " ", "BAW123", "G-ABCD", "_", "."}, FUZZ_COUNT)) {
+            EXPECT_EQ(MatchCapture(input, pattern, 2), ToString(MatchNoholdCommand(input))) << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, HoldCommandMatchesRegex)
+    {
+        const std::regex pattern("^\\.ukcp hold ([A-Za-z]+)( ([A-Za-z0-9\\-_]+))?$");
+        for (const auto& input :
+             Fuzz({".ukcp hold ", ".ukcp hold", ".ukcp nohold", " ", "TIMBA", "lam", "BAW123", "G-ABCD", "_"},
+                  FUZZ_COUNT)) {
+            std::smatch matches;
+            std::optional<std::pair<std::string, std::string>> expected;
+            if (std::regex_match(input, matches, pattern)) {
+                expected = std::make_pair(matches[1].str(), matches[3].str());
+            }
+
+            const auto match = MatchHoldCommand(input);
+            std::optional<std::pair<std::string, std::string>> actual;
+            if (match) {
+                actual = std::make_pair(std::string(match->hold), std::string(match->callsign));
+            }
+
+            EXPECT_EQ(expected, actual) << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, PressureCommandMatchesRegex)
+    {
+        const std::regex pattern("^\\.ukcp pressure ([A-Z]{4})$");
+        for (const auto& input :
+             Fuzz({".ukcp pressure ", ".ukcp pressure", " ", "EGLL", "EG", "egkk", "X"}, FUZZ_COUNT)) {
+            EXPECT_EQ(SearchCapture(input, pattern, 1), ToString(MatchPressureCommand(input))) << "Input: " << input;
+        }
+    }
+
+    TEST_F(TextMatchersTest, ItMatchesCircuitRoutes)
+    {
+        EXPECT_TRUE(IsCircuitRoute("CIRCUITS"));
+        EXPECT_TRUE(IsCircuitRoute("vfr circuit"));
+        EXPECT_FALSE(IsCircuitRoute("DCT CIRCUITS"));
+    }
+
+    TEST_F(TextMatchersTest, ItMatchesTheFirstSelcal)
+    {
+        EXPECT_EQ("ABCD", MatchSelcal("RMK/TCAS SEL/ABCD SEL/EFGH"));
+        EXPECT_EQ("EFGH", MatchSelcal("SEL/ABCDE SEL/EFGH"));
+        EXPECT_EQ(std::nullopt, MatchSelcal("XSEL/ABCD"));
+    }
+
+    TEST_F(TextMatchersTest, ItMatchesHoldCommands)
+    {
+        const auto match = MatchHoldCommand(".ukcp hold TIMBA BAW123");
+        ASSERT_TRUE(match.has_value());
+        EXPECT_EQ("TIMBA", match->hold);
+        EXPECT_EQ("BAW123", match->callsign);
+
+        const auto selected = MatchHoldCommand(".ukcp hold TIMBA");
+        ASSERT_TRUE(selected.has_value());
+        EXPECT_EQ("TIMBA", selected->hold);
+        EXPECT_TRUE(selected->callsign.empty());
+    }
+
+    TEST_F(TextMatchersTest, DISABLED_BenchmarkMatchersAgainstRegex)
+    {
+        const std::vector<std::string> routes{"VFR CIRCUITS", "DCT MID L9 KENET", "circuit", "N0450F350 DVR UL9"};
+        const std::vector<std::string> remarks{
+            "PBN/A1B1C1D1L1O1S1 SEL/ABCD RMK/TCAS", "RMK/TCAS", "SEL/ABCE", "DOF/211018 SEL/GHJK"};
+        size_t matches = 0;
+
+        const auto regexCircuit = RunBenchmark("Circuit route regex", 20000, [&routes, &matches] {
+            for (const auto& route : routes) {
+                matches +=
+                    std::regex_search(route, std::regex("^(?:VFR )?CIRCUIT(?:S)?", std::regex::icase)) ? 1 : 0;
+            }
+        });
+        const auto matcherCircuit = RunBenchmark("Circuit route matcher", 20000, [&routes, &matches] {
+            for (const auto& route : routes) {
+                matches += IsCircuitRoute(route) ? 1 : 0;
+            }
+        });
+
+        const std::regex selcalPattern("(\\s+|^)SEL/([ABCDEFGHJKLMPQRS]{4})(\\s+|$)");
+        const auto regexSelcal = RunBenchmark("SELCAL regex", 20000, [&remarks, &matches, &selcalPattern] {
+            std::smatch selcal;
+            for (const auto& remark : remarks) {
+                matches += std::regex_search(remark, selcal, selcalPattern) ? 1 : 0;
+            }
+        });
+        const auto matcherSelcal = RunBenchmark("SELCAL matcher", 20000, [&remarks, &matches] {
+            for (const auto& remark : remarks) {
+                matches += MatchSelcal(remark) ? 1 : 0;
+            }
+        });
+
+        EXPECT_LT(matcherCircuit, regexCircuit);
+        EXPECT_LT(matcherSelcal, regexSelcal);
+        EXPECT_GT(matches, 0);
+    }
+} // namespace UKControllerPluginUtilsTest::String